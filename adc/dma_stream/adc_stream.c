@@ -0,0 +1,61 @@
+/**
+ * Copyright (c) 2022 Raspberry Pi (Trading) Ltd.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+#include "adc_stream.h"
+
+// The producer and consumer each own one counter, so no locks are needed:
+//
+// - `produced` counts halves the DMA has finished. Half number n lives at
+//   ring + (n & 1) * ADC_STREAM_HALF_SAMPLES.
+// - `consumed` is the number of the next half the consumer wants to see.
+//
+// Whilst the DMA is busy filling half number `produced`, the only complete
+// half still intact is number `produced - 1`. Anything older has been written
+// over (or is being written over right now).
+//
+// Note the chained channel starts writing slightly before the completion IRQ
+// bumps `produced`, so a consumer which releases its half at the very last
+// moment may see a couple of overwritten samples without it being reported.
+
+static inline uint32_t get_produced(adc_stream_t *s) {
+    return atomic_load_explicit(&s->produced, memory_order_acquire);
+}
+
+bool adc_stream_acquire(adc_stream_t *s, const uint8_t **samples) {
+    hard_assert(!s->holding);
+    uint32_t produced = get_produced(s);
+    if (produced == s->consumed)
+        return false;
+    if (produced - s->consumed > 1) {
+        // We fell behind: skip straight to the newest complete half
+        s->dropped += produced - 1 - s->consumed;
+        s->consumed = produced - 1;
+    }
+    *samples = s->ring + (s->consumed & 1u) * ADC_STREAM_HALF_SAMPLES;
+    s->holding = true;
+    return true;
+}
+
+bool adc_stream_release(adc_stream_t *s) {
+    hard_assert(s->holding);
+    bool intact = get_produced(s) - s->consumed <= 1;
+    if (!intact)
+        ++s->overruns;
+    ++s->consumed;
+    s->holding = false;
+    return intact;
+}
+
+uint32_t adc_stream_pending(adc_stream_t *s) {
+    return get_produced(s) - s->consumed - (s->holding ? 1 : 0);
+}
+
+void adc_stream_get_stats(adc_stream_t *s, adc_stream_stats_t *stats) {
+    stats->halves_produced = get_produced(s);
+    stats->halves_consumed = s->consumed - s->dropped + (s->holding ? 1 : 0);
+    stats->halves_dropped = s->dropped;
+    stats->overruns = s->overruns;
+}
@@ -0,0 +1,115 @@
+/**
+ * Copyright (c) 2022 Raspberry Pi (Trading) Ltd.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+#ifndef _ADC_STREAM_H
+#define _ADC_STREAM_H
+
+#include <stdatomic.h>
+#include "pico.h"
+
+// Continuous ADC capture into a power-of-two ring of 8-bit samples.
+//
+// The ring is split into two halves. On the device, two DMA channels each own
+// one half: every channel wraps its write address on a half-ring boundary, and
+// the channels chain to one another, so the ADC FIFO is drained into alternate
+// halves forever without the processor reprogramming anything. The completion
+// interrupt only bumps a counter.
+//
+// Completed halves are handed to a single consumer in place (no copying):
+//
+//     const uint8_t *samples;
+//     if (adc_stream_acquire(&stream, &samples)) {
+//         ... look at ADC_STREAM_HALF_SAMPLES samples ...
+//         adc_stream_release(&stream);
+//     }
+//
+// If the consumer falls behind, a half can be overwritten whilst it is still
+// waiting (or being looked at). Stale halves are skipped and counted as dropped
+// by adc_stream_acquire(), and adc_stream_release() reports whether the half
+// the consumer was holding got clobbered before it was released.
+
+#ifndef ADC_STREAM_RING_BITS
+// 4 kB ring -> two 2 kB halves, i.e. ~4 ms of samples per half at 0.5 Msps
+#define ADC_STREAM_RING_BITS 12
+#endif
+
+#define ADC_STREAM_RING_SAMPLES (1u << ADC_STREAM_RING_BITS)
+#define ADC_STREAM_HALF_SAMPLES (ADC_STREAM_RING_SAMPLES / 2)
+
+typedef struct {
+    uint32_t halves_produced;   // halves completely written by the DMA
+    uint32_t halves_consumed;   // halves handed out by adc_stream_acquire()
+    uint32_t halves_dropped;    // halves overwritten before they were handed out
+    uint32_t overruns;          // halves overwritten whilst the consumer held them
+} adc_stream_stats_t;
+
+typedef struct {
+    // Must be aligned to the ring size, as the DMA wraps on the address bits
+    uint8_t *ring;
+    // Written only by the producer (the DMA completion IRQ)
+    _Atomic uint32_t produced;
+    // Written only by the consumer
+    uint32_t consumed;
+    uint32_t dropped;
+    uint32_t overruns;
+    bool holding;
+    // Backend specific state
+#if PICO_ON_DEVICE
+    uint dma_chan[2];
+#else
+    uint32_t sim_write_pos;
+    bool sim_running;
+#endif
+} adc_stream_t;
+
+// ----------------------------------------------------------------------------
+// Backend: hardware DMA on the device, a simulated ADC FIFO on the host
+
+// Claim resources and get ready to stream from the given ADC input. The ADC
+// itself must already be initialised and its clock divider set.
+void adc_stream_init(adc_stream_t *s, uint8_t *ring, uint adc_input);
+
+// Start and stop the free-running capture.
+void adc_stream_start(adc_stream_t *s);
+void adc_stream_stop(adc_stream_t *s);
+
+// Release any resources claimed by adc_stream_init()
+void adc_stream_deinit(adc_stream_t *s);
+
+#if !PICO_ON_DEVICE
+// Host only: stand-in for the ADC FIFO + DMA. Feed `n` samples in as though
+// they had just been converted; they land in the ring exactly where the DMA
+// would put them. Ignored unless the stream is started.
+void adc_stream_sim_push(adc_stream_t *s, const uint8_t *samples, uint n);
+#endif
+
+// ----------------------------------------------------------------------------
+// Consumer API. Safe to call from one core/thread whilst the capture is running.
+
+// Get the oldest completed half which has not yet been overwritten. Returns
+// false if none is ready. A successful call must be paired with
+// adc_stream_release() before the next acquire.
+bool adc_stream_acquire(adc_stream_t *s, const uint8_t **samples);
+
+// Hand the half back to the DMA. Returns false if the samples were overwritten
+// whilst the consumer was holding on to them.
+bool adc_stream_release(adc_stream_t *s);
+
+// Number of completed halves waiting for the consumer (including stale ones)
+uint32_t adc_stream_pending(adc_stream_t *s);
+
+void adc_stream_get_stats(adc_stream_t *s, adc_stream_stats_t *stats);
+
+// ----------------------------------------------------------------------------
+// Producer side, called by the backends
+
+// Record that the half with index (produced & 1) has just been filled.
+static inline void adc_stream_half_complete(adc_stream_t *s) {
+    uint32_t p = atomic_load_explicit(&s->produced, memory_order_relaxed);
+    atomic_store_explicit(&s->produced, p + 1, memory_order_release);
+}
+
+#endif
@@ -0,0 +1,107 @@
+/**
+ * Copyright (c) 2022 Raspberry Pi (Trading) Ltd.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+#include "adc_stream.h"
+#include "hardware/adc.h"
+#include "hardware/dma.h"
+#include "hardware/irq.h"
+
+// Only one ADC, so only one stream; the IRQ handler needs to find it.
+static adc_stream_t *irq_stream;
+
+static void __isr adc_stream_dma_irq_handler(void) {
+    adc_stream_t *s = irq_stream;
+    for (int i = 0; i < 2; ++i) {
+        uint chan = s->dma_chan[i];
+        if (dma_channel_get_irq1_status(chan)) {
+            dma_channel_acknowledge_irq1(chan);
+            adc_stream_half_complete(s);
+        }
+    }
+}
+
+void adc_stream_init(adc_stream_t *s, uint8_t *ring, uint adc_input) {
+    // The DMA ring wraps on address bits, so the buffer must be aligned
+    hard_assert(!((uintptr_t) ring & (ADC_STREAM_RING_SAMPLES - 1)));
+    hard_assert(!irq_stream);
+    irq_stream = s;
+
+    s->ring = ring;
+    atomic_store_explicit(&s->produced, 0, memory_order_relaxed);
+    s->consumed = 0;
+    s->dropped = 0;
+    s->overruns = 0;
+    s->holding = false;
+
+    adc_select_input(adc_input);
+    adc_fifo_setup(
+        true,    // Write each completed conversion to the sample FIFO
+        true,    // Enable DMA data request (DREQ)
+        1,       // DREQ (and IRQ) asserted when at least 1 sample present
+        false,   // We won't see the ERR bit because of 8 bit reads; disable.
+        true     // Shift each sample to 8 bits when pushing to FIFO
+    );
+
+    s->dma_chan[0] = dma_claim_unused_channel(true);
+    s->dma_chan[1] = dma_claim_unused_channel(true);
+
+    // Each channel fills its own half, then hands over to the other one. The
+    // write address wraps on a half-ring boundary, so when a channel finishes
+    // it is already pointing back at the start of its half, ready for the next
+    // time it is chained to. Nothing needs reprogramming whilst streaming.
+    for (int i = 0; i < 2; ++i) {
+        uint chan = s->dma_chan[i];
+        dma_channel_config c = dma_channel_get_default_config(chan);
+        channel_config_set_transfer_data_size(&c, DMA_SIZE_8);
+        channel_config_set_read_increment(&c, false);
+        channel_config_set_write_increment(&c, true);
+        channel_config_set_ring(&c, true, ADC_STREAM_RING_BITS - 1);
+        channel_config_set_dreq(&c, DREQ_ADC);
+        channel_config_set_chain_to(&c, s->dma_chan[i ^ 1]);
+
+        dma_channel_configure(chan, &c,
+            ring + i * ADC_STREAM_HALF_SAMPLES, // dst
+            &adc_hw->fifo,                      // src
+            ADC_STREAM_HALF_SAMPLES,            // transfer count, reloaded on every trigger
+            false                               // don't start yet
+        );
+        dma_channel_set_irq1_enabled(chan, true);
+    }
+
+    // Use DMA IRQ 1 and a shared handler, so other code is free to use DMA IRQ 0
+    irq_add_shared_handler(DMA_IRQ_1, adc_stream_dma_irq_handler, PICO_SHARED_IRQ_HANDLER_DEFAULT_ORDER_PRIORITY);
+    irq_set_enabled(DMA_IRQ_1, true);
+}
+
+void adc_stream_start(adc_stream_t *s) {
+    adc_fifo_drain();
+    dma_channel_start(s->dma_chan[0]);
+    adc_run(true);
+}
+
+void adc_stream_stop(adc_stream_t *s) {
+    adc_run(false);
+    // Break the chain before aborting, so neither channel can retrigger the other
+    for (int i = 0; i < 2; ++i) {
+        uint chan = s->dma_chan[i];
+        dma_channel_config c = dma_get_channel_config(chan);
+        channel_config_set_chain_to(&c, chan);
+        dma_channel_set_config(chan, &c, false);
+    }
+    dma_channel_abort(s->dma_chan[0]);
+    dma_channel_abort(s->dma_chan[1]);
+    adc_fifo_drain();
+}
+
+void adc_stream_deinit(adc_stream_t *s) {
+    for (int i = 0; i < 2; ++i) {
+        dma_channel_set_irq1_enabled(s->dma_chan[i], false);
+        dma_channel_acknowledge_irq1(s->dma_chan[i]);
+        dma_channel_unclaim(s->dma_chan[i]);
+    }
+    irq_remove_handler(DMA_IRQ_1, adc_stream_dma_irq_handler);
+    irq_stream = NULL;
+}
@@ -0,0 +1,49 @@
+/**
+ * Copyright (c) 2022 Raspberry Pi (Trading) Ltd.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+#include <string.h>
+#include "adc_stream.h"
+
+// Host build: there is no ADC or DMA, so samples are pushed in by hand and
+// written to the ring in the same order the two chained channels would.
+
+void adc_stream_init(adc_stream_t *s, uint8_t *ring, __unused uint adc_input) {
+    s->ring = ring;
+    atomic_store_explicit(&s->produced, 0, memory_order_relaxed);
+    s->consumed = 0;
+    s->dropped = 0;
+    s->overruns = 0;
+    s->holding = false;
+    s->sim_write_pos = 0;
+    s->sim_running = false;
+}
+
+void adc_stream_start(adc_stream_t *s) {
+    s->sim_running = true;
+}
+
+void adc_stream_stop(adc_stream_t *s) {
+    s->sim_running = false;
+}
+
+void adc_stream_deinit(__unused adc_stream_t *s) {
+}
+
+void adc_stream_sim_push(adc_stream_t *s, const uint8_t *samples, uint n) {
+    if (!s->sim_running)
+        return;
+    while (n) {
+        // Copy up to the end of the half currently being "DMA'd" into
+        uint32_t space = ADC_STREAM_HALF_SAMPLES - (s->sim_write_pos & (ADC_STREAM_HALF_SAMPLES - 1));
+        uint32_t chunk = n < space ? n : space;
+        memcpy(s->ring + s->sim_write_pos, samples, chunk);
+        samples += chunk;
+        n -= chunk;
+        s->sim_write_pos = (s->sim_write_pos + chunk) & (ADC_STREAM_RING_SAMPLES - 1);
+        if (chunk == space)
+            adc_stream_half_complete(s);
+    }
+}
@@ -0,0 +1,121 @@
+/**
+ * Copyright (c) 2022 Raspberry Pi (Trading) Ltd.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+#include <stdio.h>
+#include "pico/stdlib.h"
+#include "hardware/adc.h"
+// For resistor DAC output:
+#include "pico/multicore.h"
+#include "hardware/pio.h"
+#include "resistor_dac.pio.h"
+
+#include "adc_stream.h"
+
+// This example streams ADC samples continuously at 0.5 Msps, using the
+// adc_stream engine (see adc_stream.h). Compare with dma_capture, which takes
+// one fixed-length capture and stops.
+//
+// - Two chained DMA channels ping-pong between the halves of a ring buffer,
+//   so the capture never stops and the processor never copies a sample
+//
+// - The foreground loop picks up each completed half in place, and works out
+//   some statistics for it
+//
+// - Once a second we print the sample rate we actually saw, and how many
+//   halves were dropped or overrun because we didn't keep up
+//
+// As in dma_capture, core 1 drives a triangle wave out through a 5-bit
+// resistor DAC so there is something to measure: connect GPIO 26 to the
+// Green pin on the VGA board, or feed in your own signal.
+
+// Channel 0 is GPIO26
+#define CAPTURE_CHANNEL 0
+
+// Wasting some cycles per half shows what happens when the consumer can't
+// keep up. 0 for none.
+#define CONSUMER_EXTRA_DELAY_US 0
+
+static uint8_t capture_ring[ADC_STREAM_RING_SAMPLES] __attribute__((aligned(ADC_STREAM_RING_SAMPLES)));
+static adc_stream_t stream;
+
+void core1_main();
+
+int main() {
+    stdio_init_all();
+
+    // Send core 1 off to start driving the "DAC" whilst we configure the ADC.
+    multicore_launch_core1(core1_main);
+
+    // Init GPIO for analogue use: hi-Z, no pulls, disable digital input buffer.
+    adc_gpio_init(26 + CAPTURE_CHANNEL);
+    adc_init();
+    // Divisor of 0 -> full speed, one conversion every 96 cycles of 48 MHz
+    adc_set_clkdiv(0);
+
+    adc_stream_init(&stream, capture_ring, CAPTURE_CHANNEL);
+
+    sleep_ms(1000);
+    printf("Starting ADC stream, %d samples per half\n", ADC_STREAM_HALF_SAMPLES);
+    adc_stream_start(&stream);
+
+    absolute_time_t next_report = make_timeout_time_ms(1000);
+    uint64_t samples_seen = 0;
+    uint8_t lo = 0xff, hi = 0;
+    adc_stream_stats_t last = {0};
+
+    while (true) {
+        const uint8_t *samples;
+        if (adc_stream_acquire(&stream, &samples)) {
+            for (int i = 0; i < ADC_STREAM_HALF_SAMPLES; ++i) {
+                uint8_t v = samples[i];
+                lo = v < lo ? v : lo;
+                hi = v > hi ? v : hi;
+            }
+            if (CONSUMER_EXTRA_DELAY_US)
+                busy_wait_us_32(CONSUMER_EXTRA_DELAY_US);
+            if (adc_stream_release(&stream))
+                samples_seen += ADC_STREAM_HALF_SAMPLES;
+        }
+
+        if (time_reached(next_report)) {
+            next_report = delayed_by_ms(next_report, 1000);
+            adc_stream_stats_t stats;
+            adc_stream_get_stats(&stream, &stats);
+            printf("%6.1f ksps produced, %6.1f ksps consumed, min %3d max %3d, dropped %u, overruns %u\n",
+                   (stats.halves_produced - last.halves_produced) * ADC_STREAM_HALF_SAMPLES / 1000.f,
+                   samples_seen / 1000.f, lo, hi,
+                   stats.halves_dropped - last.halves_dropped,
+                   stats.overruns - last.overruns);
+            last = stats;
+            samples_seen = 0;
+            lo = 0xff;
+            hi = 0;
+        }
+    }
+}
+
+// ----------------------------------------------------------------------------
+// Code for driving the "DAC" output for us to measure (same as dma_capture)
+
+#define OUTPUT_FREQ_KHZ 5
+#define SAMPLE_WIDTH 5
+// This is the green channel on the VGA board
+#define DAC_PIN_BASE 6
+
+void core1_main() {
+    PIO pio = pio0;
+    uint sm = pio_claim_unused_sm(pio0, true);
+    uint offset = pio_add_program(pio0, &resistor_dac_5bit_program);
+    resistor_dac_5bit_program_init(pio0, sm, offset,
+        OUTPUT_FREQ_KHZ * 1000 * 2 * (1 << SAMPLE_WIDTH), DAC_PIN_BASE);
+    while (true) {
+        // Triangle wave
+        for (int i = 0; i < (1 << SAMPLE_WIDTH); ++i)
+            pio_sm_put_blocking(pio, sm, i);
+        for (int i = 0; i < (1 << SAMPLE_WIDTH); ++i)
+            pio_sm_put_blocking(pio, sm, (1 << SAMPLE_WIDTH) - 1 - i);
+    }
+}
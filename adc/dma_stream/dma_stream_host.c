@@ -0,0 +1,139 @@
+/**
+ * Copyright (c) 2022 Raspberry Pi (Trading) Ltd.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+#include <stdio.h>
+#include "pico/stdlib.h"
+
+#include "adc_stream.h"
+
+// Host build of the ADC streaming engine. The ADC FIFO is simulated by
+// adc_stream_sim_push(), which puts samples into the ring exactly where the
+// two chained DMA channels would. This lets us check the ring hand-off and
+// drop accounting, and see how fast the consumer side goes, without hardware.
+//
+// Sample number i of the stream has the value (i + i / ADC_STREAM_HALF_SAMPLES),
+// so every half has a distinct, checkable pattern.
+
+// Samples per push: roughly what the 4-deep ADC FIFO + DMA would deliver
+// between two looks from a busy consumer
+#define PUSH_CHUNK 64
+#define BENCH_SAMPLES (64u * 1024 * 1024)
+
+static uint8_t ring[ADC_STREAM_RING_SAMPLES] __attribute__((aligned(ADC_STREAM_RING_SAMPLES)));
+static adc_stream_t stream;
+static uint64_t next_sample;
+
+static void push_samples(uint n) {
+    uint8_t chunk[PUSH_CHUNK];
+    while (n) {
+        uint count = n < PUSH_CHUNK ? n : PUSH_CHUNK;
+        for (uint i = 0; i < count; ++i, ++next_sample)
+            chunk[i] = (uint8_t) (next_sample + next_sample / ADC_STREAM_HALF_SAMPLES);
+        adc_stream_sim_push(&stream, chunk, count);
+        n -= count;
+    }
+}
+
+// Check the half we are holding is the one the consumer index says it is
+static bool check_half(const uint8_t *samples) {
+    uint64_t first = (uint64_t) stream.consumed * ADC_STREAM_HALF_SAMPLES;
+    for (uint i = 0; i < ADC_STREAM_HALF_SAMPLES; ++i) {
+        uint64_t n = first + i;
+        if (samples[i] != (uint8_t) (n + n / ADC_STREAM_HALF_SAMPLES))
+            return false;
+    }
+    return true;
+}
+
+static void restart(void) {
+    adc_stream_init(&stream, ring, 0);
+    adc_stream_start(&stream);
+    next_sample = 0;
+}
+
+static bool report(const char *name, bool ok) {
+    adc_stream_stats_t stats;
+    adc_stream_get_stats(&stream, &stats);
+    printf("%-26s %s: produced %u, consumed %u, dropped %u, overruns %u\n", name, ok ? "ok    " : "FAILED",
+           stats.halves_produced, stats.halves_consumed, stats.halves_dropped, stats.overruns);
+    return ok;
+}
+
+int main() {
+    stdio_init_all();
+    printf("ADC stream host test, %u samples per half\n", ADC_STREAM_HALF_SAMPLES);
+    bool ok = true;
+    const uint8_t *samples;
+
+    // A consumer which keeps up should see every half, intact and in order
+    restart();
+    bool pass = true;
+    for (int i = 0; i < 1000; ++i) {
+        push_samples(PUSH_CHUNK);
+        while (adc_stream_acquire(&stream, &samples)) {
+            pass &= check_half(samples);
+            pass &= adc_stream_release(&stream);
+        }
+    }
+    adc_stream_stats_t stats;
+    adc_stream_get_stats(&stream, &stats);
+    pass &= stats.halves_consumed == 1000 * PUSH_CHUNK / ADC_STREAM_HALF_SAMPLES && !stats.halves_dropped;
+    ok &= report("keeping up", pass);
+
+    // A consumer which looks once every 5 halves only ever gets the newest
+    // one, and the other 4 are dropped
+    restart();
+    pass = true;
+    for (int i = 0; i < 100; ++i) {
+        push_samples(5 * ADC_STREAM_HALF_SAMPLES);
+        pass &= adc_stream_pending(&stream) == 5;
+        pass &= adc_stream_acquire(&stream, &samples);
+        pass &= check_half(samples);
+        pass &= adc_stream_release(&stream);
+        pass &= !adc_stream_acquire(&stream, &samples);
+    }
+    adc_stream_get_stats(&stream, &stats);
+    pass &= stats.halves_consumed == 100 && stats.halves_dropped == 400 && !stats.overruns;
+    ok &= report("falling behind", pass);
+
+    // Holding on to a half whilst the other one fills is fine; holding on
+    // once the DMA has come round to it again is an overrun
+    restart();
+    pass = true;
+    push_samples(ADC_STREAM_HALF_SAMPLES);
+    pass &= adc_stream_acquire(&stream, &samples);
+    push_samples(ADC_STREAM_HALF_SAMPLES - 1);
+    pass &= adc_stream_release(&stream);
+    push_samples(1);
+    pass &= adc_stream_acquire(&stream, &samples);
+    push_samples(ADC_STREAM_HALF_SAMPLES);
+    pass &= !adc_stream_release(&stream);
+    adc_stream_get_stats(&stream, &stats);
+    pass &= stats.overruns == 1;
+    ok &= report("holding too long", pass);
+
+    // Throughput of the whole simulated path: produce, hand off, and read
+    // every sample once
+    restart();
+    uint32_t sum = 0;
+    uint64_t start = time_us_64();
+    for (uint n = 0; n < BENCH_SAMPLES; n += PUSH_CHUNK) {
+        push_samples(PUSH_CHUNK);
+        if (adc_stream_acquire(&stream, &samples)) {
+            for (uint i = 0; i < ADC_STREAM_HALF_SAMPLES; ++i)
+                sum += samples[i];
+            adc_stream_release(&stream);
+        }
+    }
+    uint64_t elapsed = time_us_64() - start;
+    adc_stream_get_stats(&stream, &stats);
+    printf("throughput: %u samples in %llu us, %.1f Msps (checksum %08x, dropped %u)\n",
+           BENCH_SAMPLES, (unsigned long long) elapsed, BENCH_SAMPLES / (double) elapsed, sum,
+           stats.halves_dropped);
+
+    printf(ok ? "All good\n" : "Something went wrong\n");
+    return ok ? 0 : 1;
+}
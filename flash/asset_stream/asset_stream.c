@@ -0,0 +1,74 @@
+/**
+ * Copyright (c) 2022 Raspberry Pi (Trading) Ltd.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+#include <string.h>
+#include "asset_stream.h"
+
+static_assert(ASSET_STREAM_RING >= ASSET_STREAM_CHUNK + RGB565_MAX_LINE_BYTES, "the ring must hold a chunk as well as the longest line");
+
+// Finish off the copy in progress, and start the next if there is room for it
+static void pump(asset_stream_t *s) {
+    if (s->fetching && !s->source.busy(s->source.ctx)) {
+        s->fetched += s->fetch_len;
+        s->fetching = false;
+    }
+    if (!s->fetching && s->fetched < s->size && s->fetched + ASSET_STREAM_CHUNK - s->consumed <= ASSET_STREAM_RING) {
+        // Chunks never wrap, as the ring is a whole number of them
+        s->fetch_len = MIN(ASSET_STREAM_CHUNK, s->size - s->fetched);
+        s->source.start(s->source.ctx, s->ring + s->fetched % ASSET_STREAM_RING, s->fetch_len);
+        s->fetching = true;
+    }
+}
+
+// Wait until the ring holds the packed image up to end
+static bool fill_to(asset_stream_t *s, uint32_t end) {
+    if (end > s->size)
+        return false;
+    pump(s);
+    if (s->fetched < end) {
+        ++s->stalls;
+        do {
+            tight_loop_contents();
+            pump(s);
+        } while (s->fetched < end);
+    }
+    return true;
+}
+
+// Make the len bytes from the consumed position contiguous, and return them
+static const uint8_t *take(asset_stream_t *s, uint32_t len) {
+    uint32_t at = s->consumed % ASSET_STREAM_RING;
+    if (at + len > ASSET_STREAM_RING)
+        memcpy(s->ring + ASSET_STREAM_RING, s->ring, at + len - ASSET_STREAM_RING);
+    s->consumed += len;
+    return s->ring + at;
+}
+
+bool asset_stream_open(asset_stream_t *s, const asset_source_t *source, uint32_t size) {
+    s->source = *source;
+    s->size = size;
+    s->fetched = s->consumed = 0;
+    s->fetching = false;
+    s->line_no = 0;
+    s->stalls = 0;
+    return fill_to(s, RGB565_HEADER_LEN) && rgb565_decoder_init(&s->decoder, take(s, RGB565_HEADER_LEN));
+}
+
+const uint16_t *asset_stream_next_line(asset_stream_t *s) {
+    if (s->line_no >= s->decoder.height || !fill_to(s, s->consumed + 2))
+        return NULL;
+    const uint8_t *p = take(s, 2);
+    uint len = p[0] | p[1] << 8;
+    if (len > RGB565_MAX_LINE_BYTES - 2 || !fill_to(s, s->consumed + len))
+        return NULL;
+    uint16_t *dst = s->lines[s->line_no & 1];
+    const uint16_t *up = s->line_no ? s->lines[(s->line_no - 1) & 1] : NULL;
+    bool ok = rgb565_decode_line(&s->decoder, take(s, len), len, dst, up);
+    ++s->line_no;
+    // Room for another chunk, maybe
+    pump(s);
+    return ok ? dst : NULL;
+}
@@ -0,0 +1,72 @@
+/**
+ * Copyright (c) 2022 Raspberry Pi (Trading) Ltd.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+#ifndef _ASSET_STREAM_H
+#define _ASSET_STREAM_H
+
+#include "pico.h"
+#include "rgb565_codec.h"
+
+// ----------------------------------------------------------------------------
+// Reads an image packed by pack_rgb565.py out of flash a chunk at a time, and
+// hands it back a line at a time, decoded. Only a small ring of packed bytes
+// and two lines of pixels are ever in RAM, however big the image.
+//
+// The chunks are copied into the ring by an asset_source_t. On the device
+// that is the XIP streaming hardware and a DMA channel (flash_asset_stream.c),
+// so the next chunk comes in while the last is decoded; on the host it is
+// memcpy (asset_stream_bench.c).
+
+typedef struct {
+    // Start copying the next len bytes (a multiple of 4) of the packed image
+    // to dst
+    void (*start)(void *ctx, uint8_t *dst, uint32_t len);
+    // Whether the copy started last is still going
+    bool (*busy)(void *ctx);
+    void *ctx;
+} asset_source_t;
+
+#ifndef ASSET_STREAM_CHUNK
+#define ASSET_STREAM_CHUNK 512
+#endif
+
+// Must hold a chunk as well as the longest line
+#define ASSET_STREAM_RING (4 * ASSET_STREAM_CHUNK)
+
+typedef struct {
+    asset_source_t source;
+    uint32_t size;
+    // Bytes of the packed image copied to the ring, and used, so far
+    uint32_t fetched;
+    uint32_t consumed;
+    bool fetching;
+    uint32_t fetch_len;
+    rgb565_decoder_t decoder;
+    uint line_no;
+    // Times a line had to wait for its bytes to arrive
+    uint32_t stalls;
+    uint16_t lines[2][RGB565_MAX_WIDTH];
+    // The ring, with room after it to put a line which wraps back together
+    uint8_t ring[ASSET_STREAM_RING + RGB565_MAX_LINE_BYTES] __attribute__((aligned(4)));
+} asset_stream_t;
+
+// Start reading a packed image of size bytes from source, which must be at
+// its start. Returns false if it isn't an image which can be decoded.
+bool asset_stream_open(asset_stream_t *s, const asset_source_t *source, uint32_t size);
+
+static inline uint asset_stream_width(const asset_stream_t *s) {
+    return s->decoder.width;
+}
+
+static inline uint asset_stream_height(const asset_stream_t *s) {
+    return s->decoder.height;
+}
+
+// Decode the next line, and return it, or NULL if there are no more or the
+// data was bad. The line stays as it is until the next call but one, so it
+// can be sent to a display while the next line is decoded.
+const uint16_t *asset_stream_next_line(asset_stream_t *s);
+
+#endif
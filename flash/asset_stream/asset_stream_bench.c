@@ -0,0 +1,141 @@
+/**
+ * Copyright (c) 2022 Raspberry Pi (Trading) Ltd.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+#include <stdio.h>
+#include <string.h>
+#include "pico/stdlib.h"
+#include "asset_stream.h"
+
+#include "raspberry_256x256_rgb565.h"
+#include "raspberry_256x256_packed.h"
+#include "mountains_128x64_rgb565.h"
+#include "mountains_128x64_packed.h"
+#include "test_rand.h"
+
+// Decodes the packed copies of the images from the st7789_lcd and hub75
+// examples, line by line, checks them against the raw ones, and reports how
+// much smaller they are and how fast they decode. Also feeds the decoder
+// truncated images, which it must give up on, and random ops, which must
+// never take it past the end of the line. The packed images are read with memcpy here, wherever they are;
+// flash_asset_stream.c reads them with the XIP streaming hardware instead.
+
+// ----------------------------------------------------------------------------
+
+typedef struct {
+    const uint8_t *data;
+    uint32_t pos;
+} memcpy_source_t;
+
+static void memcpy_start(void *ctx, uint8_t *dst, uint32_t len) {
+    memcpy_source_t *m = ctx;
+    memcpy(dst, m->data + m->pos, len);
+    m->pos += len;
+}
+
+static bool memcpy_busy(__unused void *ctx) {
+    return false;
+}
+
+static asset_stream_t stream;
+static memcpy_source_t source_ctx;
+
+static bool open_image(const uint8_t *packed, uint32_t size) {
+    source_ctx.data = packed;
+    source_ctx.pos = 0;
+    asset_source_t source = {.start = memcpy_start, .busy = memcpy_busy, .ctx = &source_ctx};
+    return asset_stream_open(&stream, &source, size);
+}
+
+// ----------------------------------------------------------------------------
+
+static uint failures;
+
+static void result(const char *name, bool ok) {
+    printf("%-40s %s\n", name, ok ? "ok" : "FAILED");
+    if (!ok)
+        ++failures;
+}
+
+static void test_image(const char *name, const uint8_t *packed, uint32_t size, const char *raw, uint width,
+                       uint height) {
+    const uint16_t *pixels = (const uint16_t *) raw;
+    bool ok = open_image(packed, size) && asset_stream_width(&stream) == width &&
+              asset_stream_height(&stream) == height;
+    for (uint y = 0; ok && y < height; ++y) {
+        const uint16_t *line = asset_stream_next_line(&stream);
+        ok = line && !memcmp(line, pixels + y * width, width * 2);
+    }
+    ok &= !asset_stream_next_line(&stream);
+    char test_name[64];
+    snprintf(test_name, sizeof(test_name), "%s: decodes exactly", name);
+    result(test_name, ok);
+
+    // Time it
+    uint passes = 0;
+    uint64_t t0 = time_us_64(), t1;
+    do {
+        open_image(packed, size);
+        while (asset_stream_next_line(&stream))
+            ;
+        ++passes;
+        t1 = time_us_64();
+    } while (t1 - t0 < 500000);
+    uint32_t raw_bytes = width * height * 2;
+    uint64_t bytes_per_s = (uint64_t) raw_bytes * passes * 1000000 / (t1 - t0);
+    printf("  %u bytes packed into %u: %u.%02u times smaller; decodes at %u.%02u MB/s\n", raw_bytes, size,
+           raw_bytes / size, raw_bytes * 100 / size % 100,
+           (uint) (bytes_per_s / 1000000), (uint) (bytes_per_s / 10000 % 100));
+}
+
+static void test_bad_data(void) {
+    // Cut short
+    bool ok = true;
+    for (uint32_t size = 0; size < sizeof(mountains_128x64_packed); size += 1 + next_rand() % 200) {
+        uint lines = 0;
+        if (open_image(mountains_128x64_packed, size)) {
+            while (asset_stream_next_line(&stream))
+                ++lines;
+        }
+        ok &= lines < 64;
+    }
+    result("truncated image", ok);
+
+    // Random ops: the decoder must stop at the end of the line
+    static uint8_t ops[512];
+    uint16_t up[RGB565_MAX_WIDTH], line[RGB565_MAX_WIDTH + 16];
+    rgb565_decoder_t d;
+    uint8_t header[RGB565_HEADER_LEN] = {'R', '5', '6', '5', 100, 0, 1, 0};
+    ok = rgb565_decoder_init(&d, header);
+    header[4] = (RGB565_MAX_WIDTH + 1) & 0xff;
+    header[5] = (RGB565_MAX_WIDTH + 1) >> 8;
+    rgb565_decoder_t too_wide;
+    ok &= !rgb565_decoder_init(&too_wide, header);
+    for (uint i = 0; i < 100000; ++i) {
+        uint len = next_rand() % sizeof(ops);
+        for (uint j = 0; j < len; ++j)
+            ops[j] = (uint8_t) next_rand();
+        for (uint j = 0; j < count_of(line); ++j)
+            line[j] = 0xaaaa;
+        rgb565_decode_line(&d, ops, len, line, i & 1 ? up : NULL);
+        for (uint j = 100; j < count_of(line); ++j)
+            ok &= line[j] == 0xaaaa;
+    }
+    result("random ops stay in the line", ok);
+}
+
+int main() {
+    stdio_init_all();
+    printf("RGB565 asset stream benchmark\n");
+
+    test_image("raspberry 256x256", raspberry_256x256_packed, sizeof(raspberry_256x256_packed),
+               raspberry_256x256, 256, 256);
+    test_image("mountains 128x64", mountains_128x64_packed, sizeof(mountains_128x64_packed),
+               mountains_128x64, 128, 64);
+    test_bad_data();
+
+    printf(failures ? "FAILED\n" : "All good\n");
+    return failures ? 1 : 0;
+}
@@ -0,0 +1,139 @@
+/**
+ * Copyright (c) 2022 Raspberry Pi (Trading) Ltd.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "pico/stdlib.h"
+#include "hardware/dma.h"
+#include "hardware/regs/addressmap.h"
+#include "hardware/structs/xip_ctrl.h"
+#include "asset_stream.h"
+
+#include "raspberry_256x256_rgb565.h"
+#include "raspberry_256x256_packed.h"
+#include "mountains_128x64_rgb565.h"
+#include "mountains_128x64_packed.h"
+
+// Streams the packed images out of flash a line at a time, as a display
+// driver would, and times it. The packed bytes come in through the XIP
+// streaming hardware (see flash_xip_stream.c) and a DMA channel, a chunk at a
+// time, while the CPU decodes the chunk before; for comparison, they are also
+// read with memcpy, through the cache and around it.
+//
+// The raw images are only here to check the lines against: a program which
+// shows the packed ones needn't have them at all, which for the raspberry
+// saves 90k of flash, and the 128k of RAM it would be copied into.
+
+typedef struct {
+    uint dma_chan;
+} xip_source_t;
+
+// Point the XIP stream at the packed image; the DMA then takes it from the
+// stream FIFO a chunk at a time
+static void xip_source_begin(xip_source_t *x, const uint8_t *data, uint32_t size) {
+    dma_channel_abort(x->dma_chan);
+    while (!(xip_ctrl_hw->stat & XIP_STAT_FIFO_EMPTY))
+        (void) xip_ctrl_hw->stream_fifo;
+    xip_ctrl_hw->stream_addr = (uint32_t) data;
+    xip_ctrl_hw->stream_ctr = size / 4;
+
+    dma_channel_config cfg = dma_channel_get_default_config(x->dma_chan);
+    channel_config_set_read_increment(&cfg, false);
+    channel_config_set_write_increment(&cfg, true);
+    channel_config_set_dreq(&cfg, DREQ_XIP_STREAM);
+    dma_channel_configure(x->dma_chan, &cfg, NULL, (const void *) XIP_AUX_BASE, 0, false);
+}
+
+static void xip_source_start(void *ctx, uint8_t *dst, uint32_t len) {
+    xip_source_t *x = ctx;
+    dma_channel_transfer_to_buffer_now(x->dma_chan, dst, len / 4);
+}
+
+static bool xip_source_busy(void *ctx) {
+    xip_source_t *x = ctx;
+    return dma_channel_is_busy(x->dma_chan);
+}
+
+typedef struct {
+    const uint8_t *data;
+    uint32_t pos;
+} memcpy_source_t;
+
+static void memcpy_start(void *ctx, uint8_t *dst, uint32_t len) {
+    memcpy_source_t *m = ctx;
+    memcpy(dst, m->data + m->pos, len);
+    m->pos += len;
+}
+
+static bool memcpy_busy(__unused void *ctx) {
+    return false;
+}
+
+static asset_stream_t stream;
+
+// Decode every line, checking each against the raw image, and return the
+// time taken without the checks
+static uint32_t stream_image(const asset_source_t *source, uint32_t size, const uint16_t *raw, bool *ok) {
+    uint32_t us = 0;
+    uint32_t t0 = time_us_32();
+    *ok = asset_stream_open(&stream, source, size);
+    const uint16_t *line;
+    uint y = 0;
+    while ((line = asset_stream_next_line(&stream))) {
+        us += time_us_32() - t0;
+        uint width = asset_stream_width(&stream);
+        *ok &= !memcmp(line, raw + y++ * width, width * 2);
+        t0 = time_us_32();
+    }
+    *ok &= y == asset_stream_height(&stream);
+    return us;
+}
+
+static void print_speed(const char *how, uint32_t us, uint32_t raw_bytes, bool ok) {
+    printf("  %-28s %6u us, %2u.%02u MB/s%s\n", how, us, raw_bytes / us, raw_bytes * 100 / us % 100,
+           ok ? "" : "  MISMATCH");
+}
+
+static void bench_image(const char *name, const uint8_t *packed, uint32_t size, const char *raw, uint32_t raw_bytes) {
+    printf("%s: %u bytes packed into %u (%u.%02u times smaller)\n", name, raw_bytes, size,
+           raw_bytes / size, raw_bytes * 100 / size % 100);
+    bool ok;
+
+    xip_source_t xip = {.dma_chan = dma_claim_unused_channel(true)};
+    asset_source_t source = {.start = xip_source_start, .busy = xip_source_busy, .ctx = &xip};
+    xip_source_begin(&xip, packed, size);
+    uint32_t us = stream_image(&source, size, (const uint16_t *) raw, &ok);
+    print_speed("XIP stream + DMA:", us, raw_bytes, ok);
+    printf("  (waited for data %u times)\n", stream.stalls);
+    dma_channel_unclaim(xip.dma_chan);
+
+    // The cache has the image in it now, or some of it
+    memcpy_source_t m = {.data = packed};
+    source = (asset_source_t) {.start = memcpy_start, .busy = memcpy_busy, .ctx = &m};
+    us = stream_image(&source, size, (const uint16_t *) raw, &ok);
+    print_speed("memcpy, through the cache:", us, raw_bytes, ok);
+
+    m = (memcpy_source_t) {.data = (const uint8_t *) ((uintptr_t) packed - XIP_BASE + XIP_NOCACHE_NOALLOC_BASE)};
+    us = stream_image(&source, size, (const uint16_t *) raw, &ok);
+    print_speed("memcpy, around the cache:", us, raw_bytes, ok);
+}
+
+int main() {
+    stdio_init_all();
+
+    // As in flash_xip_stream.c, the XIP stream only reads from flash
+    if ((uint32_t) raspberry_256x256_packed >= SRAM_BASE) {
+        printf("You need to run this example from flash!\n");
+        exit(-1);
+    }
+
+    bench_image("raspberry 256x256", raspberry_256x256_packed, sizeof(raspberry_256x256_packed),
+                raspberry_256x256, sizeof(raspberry_256x256));
+    bench_image("mountains 128x64", mountains_128x64_packed, sizeof(mountains_128x64_packed),
+                mountains_128x64, sizeof(mountains_128x64));
+}
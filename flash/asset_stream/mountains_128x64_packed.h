@@ -0,0 +1,713 @@
+// Packed by pack_rgb565.py from mountains_128x64_rgb565.h: 128x64, 16384 bytes of RGB565 in 11352
+static const uint8_t __attribute__((aligned(4))) mountains_128x64_packed[] = {
+	0x52, 0x35, 0x36, 0x35, 0x80, 0x00, 0x40, 0x00, 0x70, 0x00, 0xfe, 0xff, 0xff, 0xc3, 0xfe, 0x5f,
+	0x0d, 0x9b, 0xab, 0xfe, 0x9f, 0xaf, 0xa3, 0xe7, 0x9b, 0x2b, 0xfe, 0x9f, 0x04, 0xa2, 0x77, 0x39,
+	0x2b, 0x39, 0x2b, 0x39, 0xa2, 0x77, 0x2b, 0x1d, 0x2b, 0x1d, 0xc1, 0x2b, 0x1d, 0x2b, 0xc3, 0x1d,
+	0x2b, 0xc6, 0x39, 0x2b, 0x39, 0x2b, 0x39, 0xc1, 0x2b, 0x39, 0x2b, 0x39, 0x2b, 0x39, 0x2b, 0xc0,
+	0x1d, 0x2b, 0xc0, 0xa4, 0x66, 0x18, 0xcf, 0x32, 0x62, 0x2b, 0xc0, 0x39, 0x2b, 0x39, 0x2b, 0xc2,
+	0xab, 0xa3, 0xa6, 0xd5, 0xfe, 0xff, 0xe7, 0x4a, 0xfe, 0xff, 0x3d, 0x9a, 0x4b, 0xa6, 0xb5, 0x18,
+	0x9d, 0x0a, 0x32, 0x18, 0xc1, 0xa0, 0x28, 0x9d, 0x7a, 0x94, 0x2e, 0x46, 0x99, 0x4c, 0x00, 0x0e,
+	0xa5, 0x66, 0xfe, 0x5f, 0x5e, 0x9d, 0x3a, 0x0e, 0x1d, 0xcf, 0x6d, 0x00, 0xe6, 0xc0, 0x0e, 0x1d,
+	0xc0, 0xe0, 0x1d, 0xe0, 0x1d, 0xc0, 0x0e, 0xc0, 0x00, 0x0e, 0xc1, 0x00, 0xe0, 0x0e, 0xe0, 0x0e,
+	0xc3, 0xe0, 0x0e, 0x1d, 0xc0, 0xe0, 0x1d, 0xc5, 0xe0, 0x1d, 0x2b, 0x1d, 0xe0, 0x1d, 0xe0, 0x1d,
+	0xe0, 0x1d, 0xc0, 0x00, 0x0e, 0xc1, 0xac, 0xf2, 0xf0, 0xc0, 0xfe, 0x3f, 0x56, 0x99, 0x2c, 0xe0,
+	0x1d, 0xe0, 0x1d, 0xe0, 0x0e, 0xc0, 0xa3, 0x77, 0x00, 0xfe, 0x7f, 0x9f, 0x99, 0x5c, 0x10, 0x0e,
+	0xe0, 0xb0, 0xf0, 0xfe, 0xff, 0xdf, 0x18, 0xc2, 0x4a, 0x9f, 0x59, 0x18, 0x5a, 0xfe, 0x1f, 0x87,
+	0xfe, 0xdf, 0x05, 0x32, 0xa5, 0x76, 0x76, 0x39, 0x32, 0xc0, 0x62, 0xc0, 0xe0, 0x0e, 0xc2, 0x00,
+	0x0e, 0x00, 0x0e, 0x00, 0x0e, 0x00, 0x0e, 0x00, 0x0e, 0x5d, 0x00, 0xe3, 0x20, 0xfe, 0x9f, 0x1d,
+	0xe0, 0x2b, 0xc0, 0xe1, 0xc1, 0x0e, 0xc0, 0x00, 0xcf, 0xe0, 0xc0, 0xe0, 0x0e, 0xc0, 0xe1, 0x0e,
+	0xc1, 0xe0, 0x0e, 0xc1, 0xe0, 0xc4, 0x0e, 0x32, 0xfe, 0x5f, 0x9f, 0xfe, 0xff, 0xff, 0xc0, 0xfe,
+	0x9f, 0x76, 0xa5, 0xb6, 0xe6, 0x2a, 0x3c, 0xe8, 0xc0, 0x9c, 0x1a, 0x1d, 0x2b, 0xe1, 0xc1, 0xe0,
+	0xa4, 0x66, 0xfe, 0x9f, 0xa7, 0x18, 0xa0, 0x58, 0xfe, 0xff, 0x7e, 0x32, 0xa5, 0x66, 0x24, 0xc0,
+	0xfe, 0xdf, 0x96, 0x3c, 0xe1, 0xc0, 0xa0, 0x08, 0x9a, 0x5b, 0x97, 0x3d, 0x00, 0xc3, 0x66, 0x00,
+	0xc1, 0xe0, 0x00, 0xe0, 0x00, 0xe0, 0x00, 0xc9, 0x60, 0x00, 0xe3, 0xc0, 0xa0, 0x38, 0xfe, 0xbf,
+	0x0d, 0x1d, 0x0e, 0xc0, 0x00, 0x0e, 0x00, 0xc0, 0x6e, 0xc4, 0x24, 0x32, 0x24, 0x32, 0x24, 0x32,
+	0xc8, 0x00, 0x32, 0x0e, 0x00, 0xc1, 0xe0, 0x00, 0xe0, 0x00, 0xe0, 0x00, 0x0e, 0x00, 0x0e, 0xc1,
+	0x32, 0xfe, 0xdf, 0x7e, 0x18, 0xc2, 0xa0, 0x38, 0xe3, 0x5a, 0xe0, 0x2a, 0xeb, 0x2a, 0xe0, 0xc1,
+	0x0e, 0xc0, 0x00, 0xc0, 0xe0, 0x28, 0xe0, 0xc1, 0xa0, 0x58, 0x04, 0x20, 0x18, 0xfe, 0xff, 0x8e,
+	0x9a, 0x3b, 0xfe, 0xbf, 0xbf, 0xe1, 0x1a, 0x0e, 0x9a, 0x1b, 0xfe, 0x5f, 0x05, 0xc2, 0xe0, 0x32,
+	0xe0, 0x32, 0xc1, 0xe0, 0x32, 0xe0, 0x32, 0xe0, 0x32, 0xc8, 0x44, 0x00, 0xfe, 0xdd, 0xd6, 0xe3,
+	0x0e, 0x22, 0x00, 0xe0, 0x00, 0x66, 0x00, 0xc0, 0x24, 0xc0, 0xa7, 0xe5, 0x24, 0xd0, 0xe0, 0x24,
+	0xc1, 0x32, 0xc2, 0xe0, 0x32, 0xe0, 0xc7, 0xfe, 0x5f, 0xa7, 0xe3, 0xc7, 0xe0, 0xc1, 0xe7, 0x2a,
+	0x3e, 0x00, 0x0e, 0xc1, 0x00, 0xc0, 0x24, 0xfe, 0xdf, 0x76, 0x20, 0xe2, 0xc4, 0x3c, 0x2a, 0xe1,
+	0xc1, 0xa0, 0x38, 0x9d, 0x0a, 0x24, 0x15, 0x07, 0x24, 0xe0, 0xcd, 0x24, 0xe0, 0x24, 0xe0, 0x24,
+	0x72, 0x00, 0xfe, 0x51, 0x53, 0x52, 0xab, 0x97, 0xb4, 0x86, 0xe0, 0x20, 0x38, 0x9d, 0x8a, 0xa2,
+	0x77, 0x95, 0x1e, 0x15, 0xfe, 0x5f, 0x8f, 0x97, 0x4d, 0xa6, 0xb5, 0x62, 0x04, 0xfe, 0xdf, 0x0d,
+	0x15, 0xc3, 0x6e, 0x15, 0x07, 0x15, 0x07, 0x15, 0xc4, 0xe0, 0x15, 0xe0, 0x15, 0xe0, 0x15, 0x24,
+	0xc2, 0xe0, 0x24, 0x32, 0xc0, 0xe0, 0x32, 0xe0, 0x32, 0xc1, 0xa4, 0x66, 0xfe, 0x1f, 0x8f, 0xe8,
+	0x2a, 0x5a, 0xa0, 0xa8, 0xc7, 0x20, 0x95, 0x2e, 0x9f, 0x29, 0x24, 0xe0, 0xc3, 0x32, 0xe0, 0x04,
+	0x18, 0xa0, 0x18, 0x96, 0x6d, 0xe5, 0xc0, 0xfe, 0xff, 0xb7, 0x9d, 0x9a, 0x16, 0x2a, 0x9f, 0x19,
+	0xfe, 0xff, 0x05, 0x9d, 0xaa, 0xc0, 0x2a, 0xa3, 0xb7, 0x15, 0x24, 0xe0, 0x24, 0xc6, 0x15, 0x24,
+	0xc3, 0x15, 0xe0, 0xc1, 0x72, 0x00, 0x18, 0x90, 0x7b, 0x93, 0x78, 0x98, 0x9a, 0xa9, 0x87, 0x9b,
+	0x9c, 0xb8, 0x26, 0xa7, 0x85, 0x9b, 0x4b, 0x98, 0x2c, 0xa9, 0xf4, 0x08, 0xc0, 0x16, 0x29, 0x10,
+	0x2a, 0x07, 0xe0, 0x07, 0xc2, 0x39, 0xe0, 0x39, 0xe0, 0xc2, 0xe0, 0x07, 0xe0, 0x07, 0xe0, 0xc4,
+	0xe0, 0x6e, 0xe0, 0xc1, 0x15, 0xc1, 0x24, 0x15, 0xa6, 0xa5, 0xa3, 0xd7, 0x3a, 0x9a, 0x6b, 0x0a,
+	0xfe, 0xff, 0xe7, 0xe4, 0x5a, 0xe1, 0x9e, 0x29, 0x20, 0xe6, 0x20, 0x9a, 0x2b, 0x5a, 0x24, 0x32,
+	0xc5, 0x24, 0x15, 0x3c, 0xfe, 0xff, 0xf7, 0x7a, 0xc1, 0x16, 0x98, 0x2c, 0x9a, 0x1b, 0x07, 0x10,
+	0x1e, 0xa0, 0x18, 0x15, 0x07, 0x39, 0x6e, 0x15, 0x07, 0xe0, 0xc0, 0x24, 0xe1, 0xc5, 0x15, 0xe0,
+	0x15, 0x24, 0x15, 0xe2, 0x15, 0xc1, 0xe0, 0x15, 0x82, 0x00, 0xfe, 0xf6, 0x9c, 0xb2, 0x87, 0x18,
+	0x52, 0x92, 0x8b, 0x96, 0x77, 0x93, 0x7a, 0xfe, 0x9c, 0x34, 0xaa, 0x06, 0x9f, 0x69, 0xa2, 0x87,
+	0x7a, 0x2a, 0x18, 0x2a, 0xc3, 0x39, 0xc1, 0x2a, 0xe0, 0x2a, 0xe0, 0x2a, 0x39, 0x2a, 0x39, 0x2a,
+	0x39, 0xc0, 0xe0, 0x39, 0x07, 0x39, 0x07, 0x39, 0x07, 0xc0, 0xe0, 0xc2, 0x07, 0xc1, 0x39, 0x2a,
+	0x6e, 0x1b, 0xfe, 0xff, 0xff, 0xc0, 0xfe, 0xbf, 0xaf, 0x9b, 0x8b, 0xa7, 0xd5, 0xe3, 0xc1, 0x5a,
+	0xfe, 0x5f, 0x5e, 0x7a, 0x04, 0xa0, 0xc8, 0xe3, 0x9c, 0x1a, 0x07, 0x24, 0x66, 0xe0, 0xc0, 0x15,
+	0x24, 0x15, 0x24, 0x15, 0x24, 0x15, 0xc0, 0x07, 0x39, 0xa6, 0xe5, 0xa3, 0xc7, 0x0f, 0xfe, 0x3f,
+	0x06, 0x39, 0x07, 0xa2, 0x77, 0x39, 0xc0, 0x07, 0xe0, 0xc0, 0x07, 0x15, 0x39, 0xe0, 0x39, 0xe0,
+	0x07, 0xe0, 0xc7, 0x07, 0xe0, 0x07, 0xe0, 0xc3, 0x07, 0xe0, 0x07, 0xe0, 0x7f, 0x00, 0xfe, 0x3a,
+	0xbe, 0xa9, 0x98, 0x86, 0x8a, 0xa8, 0x88, 0xaa, 0x77, 0xa6, 0x97, 0xa6, 0x97, 0x52, 0x5a, 0x97,
+	0x3d, 0x99, 0x0c, 0xa0, 0x28, 0x7a, 0xa2, 0x97, 0xe0, 0x1c, 0x39, 0xe1, 0x1c, 0xc2, 0x0e, 0x1c,
+	0x0e, 0x1c, 0xc0, 0xe0, 0xc4, 0xe0, 0x6e, 0xe0, 0xc2, 0xe0, 0xc2, 0xe0, 0x39, 0x1c, 0x39, 0x62,
+	0x07, 0xc0, 0xe2, 0x01, 0x2a, 0x7a, 0xfe, 0xff, 0xf7, 0xa0, 0x48, 0x9c, 0x4a, 0xa1, 0xc8, 0xa3,
+	0xb7, 0x7a, 0x32, 0xfe, 0x5f, 0x05, 0x66, 0x1e, 0xfe, 0xdf, 0xc7, 0x0e, 0xe0, 0x2a, 0xc0, 0x24,
+	0x32, 0xc0, 0x6e, 0xc0, 0x07, 0xe0, 0x07, 0xc3, 0xe0, 0x07, 0xc2, 0x39, 0xc0, 0x07, 0x15, 0xe0,
+	0x15, 0x07, 0xc1, 0xe0, 0x07, 0xc2, 0x39, 0x07, 0xc0, 0x15, 0x07, 0xe0, 0x07, 0xe0, 0x07, 0xe0,
+	0x07, 0xe0, 0x39, 0xc1, 0xe0, 0x39, 0xe0, 0x07, 0xe0, 0x07, 0xc1, 0x15, 0x07, 0x69, 0x00, 0xfe,
+	0xff, 0xff, 0xc1, 0x9c, 0x79, 0x87, 0x8b, 0x97, 0x9b, 0xb8, 0x85, 0x18, 0xc2, 0x8d, 0x8b, 0x99,
+	0x99, 0xa4, 0x77, 0x94, 0x1f, 0xaf, 0x19, 0x42, 0xa6, 0x15, 0xc5, 0x6e, 0xc0, 0x6e, 0x0e, 0xc0,
+	0x1c, 0x0e, 0x1c, 0xc4, 0x66, 0x1c, 0xe0, 0x2a, 0x39, 0xc6, 0xe0, 0x1c, 0x07, 0xfe, 0x7f, 0x97,
+	0x66, 0x39, 0x15, 0xa8, 0xa4, 0x0a, 0x07, 0x24, 0x2a, 0xa0, 0xa8, 0x07, 0xc0, 0xe0, 0xc0, 0xa8,
+	0x74, 0xfe, 0x1f, 0x7f, 0xfe, 0xff, 0xdf, 0xe0, 0xc0, 0x9f, 0x39, 0xa1, 0xd8, 0x39, 0x15, 0xc0,
+	0x07, 0xc0, 0x39, 0xe0, 0x39, 0xc0, 0x6e, 0x39, 0x2a, 0x39, 0xc0, 0xe0, 0x39, 0xce, 0x2a, 0x39,
+	0xc7, 0x2a, 0xe0, 0x2a, 0xe0, 0x2a, 0xe0, 0xc7, 0x76, 0x00, 0xe2, 0xc7, 0xfe, 0xef, 0x52, 0x9d,
+	0x89, 0xb1, 0xa7, 0xa4, 0x87, 0x8b, 0x7a, 0x99, 0x89, 0xad, 0x3d, 0x02, 0xa2, 0x47, 0x76, 0x9d,
+	0xaa, 0x0e, 0xc1, 0x00, 0xc0, 0x7a, 0x00, 0xc0, 0x62, 0x0e, 0xe0, 0x0e, 0xe0, 0x0e, 0xe0, 0xc0,
+	0x66, 0xc2, 0xe0, 0x2a, 0xe0, 0x2a, 0xe2, 0xc1, 0x2a, 0x07, 0x39, 0x07, 0xc2, 0x15, 0xc2, 0x24,
+	0xe0, 0x15, 0x24, 0xc0, 0xa9, 0xb4, 0xfe, 0x3f, 0x97, 0xe0, 0x20, 0x99, 0x2c, 0xa7, 0xa5, 0x07,
+	0xe0, 0x39, 0xc0, 0x2a, 0xe0, 0x2a, 0xc4, 0xa4, 0xc6, 0xfe, 0x9f, 0xa7, 0x9a, 0x4b, 0xe0, 0x2a,
+	0xe0, 0x2a, 0xe0, 0x2a, 0xe0, 0x2a, 0xe0, 0x2a, 0xe0, 0x2a, 0xe0, 0x2a, 0xe0, 0x2a, 0x39, 0x2a,
+	0xe0, 0x2a, 0xe0, 0x2a, 0xe0, 0x2a, 0xc5, 0x39, 0x2a, 0xe0, 0x2a, 0xe0, 0x2a, 0xe0, 0x2a, 0xe1,
+	0x72, 0x00, 0xe1, 0x9d, 0x99, 0xe7, 0xc0, 0x62, 0x5e, 0xfe, 0x91, 0x6b, 0x94, 0x68, 0x7f, 0x9c,
+	0x78, 0xa2, 0x89, 0x5a, 0x9a, 0xa8, 0x7e, 0xb7, 0x0e, 0xfe, 0x3f, 0x2e, 0xa2, 0x47, 0xc0, 0x7a,
+	0x4a, 0x6e, 0x2e, 0xc0, 0xe0, 0x2e, 0xe0, 0x00, 0xe0, 0x00, 0xe0, 0x6e, 0x66, 0xc2, 0xe0, 0x1c,
+	0xe0, 0x1c, 0x2a, 0xc8, 0x39, 0xc2, 0x07, 0x39, 0x2a, 0xc0, 0x07, 0x39, 0x07, 0x39, 0xc0, 0xa6,
+	0xe5, 0x9f, 0x59, 0x39, 0xe0, 0x2a, 0xc0, 0x1c, 0xc2, 0x0e, 0xc0, 0xfe, 0xff, 0xaf, 0xa0, 0xf8,
+	0xa0, 0xb8, 0xc2, 0xfe, 0xbf, 0x46, 0xe0, 0x1c, 0xe0, 0x1c, 0xe0, 0x1c, 0xe0, 0x1c, 0xe0, 0x1c,
+	0xe0, 0x1c, 0xe0, 0x1c, 0xe0, 0x1c, 0xe0, 0xc1, 0x1c, 0xe0, 0x1c, 0xc3, 0xe0, 0x1c, 0xe0, 0x1c,
+	0xe0, 0x1c, 0xe0, 0xc5, 0x6d, 0x00, 0xfe, 0xfb, 0xe6, 0xe0, 0x92, 0x99, 0x7f, 0x59, 0xaa, 0x98,
+	0xe5, 0xc1, 0x98, 0x79, 0xe0, 0xa2, 0x88, 0x98, 0x99, 0x55, 0xa2, 0x99, 0x5a, 0x66, 0x3f, 0xb9,
+	0x6b, 0xfe, 0x9f, 0x36, 0x4a, 0x4a, 0xc0, 0xe0, 0x0d, 0x66, 0x4e, 0x00, 0xc0, 0x76, 0xc0, 0xe0,
+	0xc0, 0xe0, 0xc0, 0xe0, 0x6e, 0xe0, 0x0e, 0xe0, 0x0e, 0xe0, 0xc5, 0x0e, 0x66, 0xc0, 0xe0, 0xc2,
+	0xe0, 0x2a, 0xc3, 0xe0, 0x2a, 0xe0, 0x2a, 0x39, 0x2a, 0xc1, 0x1c, 0x0e, 0xe0, 0x0e, 0xc1, 0x1c,
+	0xfe, 0xff, 0xbf, 0x18, 0xc4, 0xfe, 0xdf, 0xaf, 0x3c, 0xe0, 0x0e, 0xe0, 0xc1, 0x0e, 0xe0, 0xc6,
+	0x2a, 0x1c, 0xe0, 0x1c, 0xc0, 0x0e, 0xa0, 0xb8, 0x7e, 0x0e, 0xc0, 0xe0, 0xc4, 0x2a, 0xc1, 0x1c,
+	0xe0, 0x1c, 0xe1, 0x8b, 0x00, 0xfe, 0xf6, 0xc5, 0x9a, 0x78, 0xa1, 0xaa, 0xaf, 0x88, 0x96, 0x88,
+	0xa9, 0x88, 0x8e, 0x99, 0xe6, 0xc0, 0x82, 0x4e, 0x8f, 0xa6, 0x9d, 0x99, 0x26, 0x1f, 0xc1, 0xa3,
+	0x99, 0xb0, 0x95, 0xa4, 0x5c, 0x01, 0xa2, 0x47, 0x56, 0xc0, 0x46, 0x3f, 0xe0, 0x11, 0x62, 0x0d,
+	0x00, 0x31, 0xe0, 0xc0, 0xe0, 0x00, 0xe0, 0x00, 0xe0, 0x00, 0xe0, 0x00, 0x0e, 0x00, 0x0e, 0xc1,
+	0x00, 0xe0, 0x00, 0x0e, 0x00, 0x0e, 0xc2, 0x00, 0x0c, 0x9b, 0x5b, 0x31, 0x3c, 0x0e, 0xfe, 0x7f,
+	0x8f, 0x5a, 0xa1, 0xf8, 0xa3, 0xf7, 0xfe, 0xbf, 0xaf, 0x99, 0x2c, 0x0e, 0x6e, 0xe0, 0x00, 0xe0,
+	0x00, 0xfe, 0x3f, 0x77, 0xa6, 0xf5, 0x18, 0xc7, 0xfe, 0xff, 0x6e, 0xe0, 0x00, 0x66, 0x00, 0xe0,
+	0x00, 0x0e, 0x00, 0x0e, 0x00, 0x0e, 0xc0, 0xe0, 0xc3, 0xfe, 0xff, 0x76, 0x18, 0xc1, 0xa0, 0x48,
+	0xfe, 0x7f, 0x3e, 0x0e, 0xe0, 0x0e, 0xe0, 0x0e, 0xe0, 0xc0, 0xe0, 0x1c, 0xc1, 0x2a, 0x1c, 0xe0,
+	0x7d, 0x00, 0xfe, 0x17, 0xc6, 0x9d, 0x88, 0x9b, 0x99, 0x9c, 0x88, 0xad, 0x98, 0xa3, 0x99, 0x98,
+	0x78, 0xb0, 0x88, 0x0c, 0xb5, 0x99, 0xe1, 0x9d, 0x99, 0xe1, 0xc0, 0xfe, 0x30, 0x4b, 0x98, 0x97,
+	0xc0, 0x9d, 0x89, 0x61, 0xc0, 0xa3, 0x89, 0xbe, 0xa6, 0x89, 0x87, 0xa3, 0x7b, 0xb4, 0x1e, 0xfe,
+	0xff, 0x4e, 0x9f, 0x59, 0x5a, 0x11, 0xc0, 0x5a, 0xc0, 0x66, 0xc2, 0xe0, 0x31, 0xe0, 0x31, 0xe0,
+	0x31, 0xe0, 0xc0, 0x0e, 0x00, 0xc6, 0x31, 0xe0, 0xc3, 0x31, 0x18, 0xc0, 0x4a, 0xa0, 0x08, 0xfe,
+	0xff, 0xf7, 0x18, 0xc4, 0xa0, 0x58, 0x9f, 0x29, 0x2e, 0x0c, 0x0e, 0x20, 0x18, 0xc9, 0xa0, 0x38,
+	0x00, 0x66, 0x00, 0xc5, 0x0e, 0x00, 0xe0, 0x00, 0xc0, 0xa3, 0xd7, 0xa1, 0xc8, 0x20, 0x18, 0xc5,
+	0x3c, 0x9f, 0x39, 0x3a, 0x97, 0x0d, 0x0e, 0xe0, 0x0e, 0x00, 0xc0, 0x0e, 0xc0, 0xe0, 0xc0, 0x8b,
+	0x00, 0xfe, 0x14, 0xa5, 0x9b, 0x98, 0xa9, 0x98, 0xa8, 0x77, 0x8c, 0x98, 0xa7, 0x89, 0xc0, 0xa7,
+	0x88, 0x66, 0x99, 0x89, 0xaa, 0x98, 0xa5, 0x88, 0x18, 0xc3, 0x85, 0x5f, 0x9a, 0x88, 0x59, 0x9c,
+	0xa8, 0x17, 0xa8, 0xa7, 0xa6, 0x76, 0x9c, 0x8a, 0xa6, 0x97, 0x7e, 0xae, 0x1e, 0xfe, 0x3f, 0x47,
+	0x9c, 0x5a, 0xa0, 0xa8, 0x05, 0x1f, 0xe0, 0x6e, 0x23, 0xc2, 0xe0, 0x23, 0xe0, 0x23, 0xe0, 0x23,
+	0x31, 0x23, 0x31, 0x23, 0x31, 0xc1, 0x23, 0x31, 0x23, 0xe0, 0x23, 0x31, 0x23, 0xa3, 0xc7, 0x3b,
+	0x05, 0x2a, 0xe0, 0xca, 0x2a, 0x18, 0xc1, 0x97, 0x6c, 0x96, 0x99, 0xa5, 0x98, 0xad, 0x85, 0x99,
+	0x8c, 0xc0, 0x3c, 0xe3, 0xa0, 0x28, 0x31, 0xa3, 0xf7, 0xfe, 0xff, 0xc7, 0xa0, 0xc8, 0xa0, 0x38,
+	0x12, 0x23, 0x31, 0xc1, 0xe0, 0x11, 0xfe, 0x5f, 0x6f, 0x3c, 0x18, 0x3c, 0x18, 0xc9, 0x0e, 0x1c,
+	0x6e, 0xc0, 0xa2, 0xc7, 0xfe, 0xff, 0xdf, 0x3c, 0x36, 0x24, 0x9c, 0x2a, 0x8b, 0x00, 0xfe, 0x78,
+	0xd6, 0x9c, 0x89, 0x32, 0x9c, 0x88, 0x51, 0xb1, 0x99, 0x40, 0x98, 0x88, 0x7f, 0x9b, 0x99, 0x24,
+	0xa2, 0x88, 0x9b, 0x99, 0xa7, 0x89, 0x98, 0x88, 0xb2, 0x88, 0xe0, 0xc0, 0x56, 0x9b, 0x9a, 0x6e,
+	0x8f, 0x89, 0x95, 0x98, 0x97, 0x99, 0x9e, 0x68, 0xa9, 0xc8, 0x6c, 0x57, 0xab, 0x5c, 0x18, 0xc1,
+	0xa0, 0x58, 0xfe, 0x1f, 0x57, 0x9c, 0x0a, 0xc3, 0x11, 0xe0, 0xc6, 0xa4, 0xe6, 0x7a, 0xa5, 0xe6,
+	0x7a, 0x08, 0xa3, 0xd7, 0xa3, 0xc7, 0xc0, 0xa1, 0xc8, 0x20, 0xc0, 0x5a, 0x18, 0xc0, 0x32, 0x2a,
+	0x0e, 0xe0, 0x9a, 0x7b, 0xe7, 0xc2, 0x8e, 0x7b, 0x9c, 0x7a, 0x78, 0xa7, 0x88, 0x97, 0x8b, 0x9a,
+	0x79, 0xb0, 0x95, 0x66, 0x7e, 0xa3, 0x8a, 0x8c, 0x59, 0x98, 0x9a, 0xb0, 0x38, 0xb0, 0xa4, 0x18,
+	0xc3, 0xa0, 0x18, 0x9e, 0x59, 0xfe, 0xbf, 0x16, 0xe0, 0xc0, 0x66, 0xc0, 0x6e, 0x28, 0xeb, 0xc0,
+	0xfe, 0xff, 0x66, 0x56, 0x18, 0xc3, 0xa0, 0x48, 0x18, 0xad, 0x00, 0x01, 0xa8, 0x88, 0x9d, 0x88,
+	0x95, 0x99, 0xbc, 0x89, 0x65, 0x94, 0x88, 0xa2, 0x87, 0x6f, 0x90, 0x88, 0xe0, 0x01, 0xb3, 0x98,
+	0xa4, 0x78, 0x98, 0x8a, 0x99, 0x98, 0x97, 0x99, 0xa3, 0x88, 0x3e, 0xad, 0x9a, 0xa5, 0x88, 0x8a,
+	0x88, 0xac, 0x98, 0xfe, 0x68, 0x21, 0xa2, 0x89, 0xa8, 0x95, 0x7a, 0xaa, 0x87, 0x1d, 0xa6, 0x88,
+	0xe1, 0xc1, 0xfe, 0xff, 0x4e, 0x15, 0xc0, 0xa2, 0xb7, 0xfe, 0x9f, 0x87, 0x18, 0xfe, 0xdf, 0x4e,
+	0xe0, 0x15, 0xc0, 0xa0, 0xb8, 0x1a, 0x9e, 0x19, 0x9f, 0xb9, 0xa3, 0xc7, 0xa3, 0xd7, 0x5a, 0xa1,
+	0xb8, 0x66, 0xfe, 0xff, 0xef, 0x18, 0xc3, 0x97, 0x5d, 0xe0, 0x94, 0x5c, 0x18, 0xc0, 0x9a, 0x4b,
+	0x91, 0x6d, 0xa4, 0xc6, 0x98, 0x79, 0xb4, 0x84, 0xe2, 0x5a, 0x86, 0x4e, 0xb2, 0xa6, 0x3c, 0x9a,
+	0xab, 0x8e, 0x69, 0xa2, 0x88, 0x55, 0x42, 0x7a, 0xa9, 0x97, 0x95, 0x8a, 0x18, 0x89, 0x8c, 0x27,
+	0x9c, 0x88, 0x0f, 0x99, 0x8a, 0x27, 0x35, 0xb1, 0xb7, 0xe3, 0xc2, 0xa0, 0x38, 0x4a, 0xa0, 0xd8,
+	0x18, 0xfe, 0xff, 0x5e, 0xa0, 0x48, 0xa4, 0xf6, 0xfe, 0xdf, 0xcf, 0x3c, 0x52, 0xc0, 0x56, 0xa2,
+	0x87, 0xc0, 0x2a, 0xe3, 0xc6, 0xa0, 0x38, 0xc0, 0xb2, 0x00, 0x96, 0xe7, 0x9c, 0x99, 0xe0, 0x60,
+	0xae, 0x79, 0x8c, 0x89, 0x50, 0xa5, 0x89, 0xab, 0x99, 0x90, 0x98, 0xb3, 0x88, 0x96, 0x88, 0x61,
+	0x0f, 0x9d, 0x88, 0x9c, 0x99, 0xae, 0x78, 0x18, 0x9b, 0x98, 0x9b, 0x99, 0x8e, 0x87, 0xb1, 0x99,
+	0xa9, 0x88, 0x96, 0x88, 0x93, 0x9a, 0x90, 0x68, 0xa5, 0x98, 0xa7, 0x88, 0x98, 0x98, 0xa7, 0x88,
+	0x33, 0xaf, 0x99, 0xe1, 0xc0, 0xfe, 0xff, 0x56, 0x9d, 0x0a, 0x6e, 0xa2, 0xd7, 0x0e, 0x1f, 0x46,
+	0xa4, 0x96, 0x9d, 0x7a, 0x99, 0x1c, 0xa5, 0xc6, 0xa4, 0xe6, 0xa2, 0xa7, 0xfe, 0xdf, 0x2e, 0xfe,
+	0xff, 0xd7, 0xa0, 0x08, 0x76, 0x9c, 0xca, 0xe2, 0x97, 0x8c, 0xe1, 0xc1, 0x42, 0x97, 0x6c, 0x93,
+	0x8a, 0x9c, 0x79, 0x65, 0xa7, 0x97, 0x94, 0x6a, 0xa4, 0x78, 0xaa, 0xc7, 0xa5, 0x68, 0x96, 0x5b,
+	0x9f, 0xc8, 0x99, 0x79, 0xad, 0xb5, 0xa8, 0xa6, 0x90, 0x99, 0xac, 0x87, 0x9c, 0x77, 0xa6, 0x99,
+	0xa8, 0x86, 0x8e, 0x8b, 0x9d, 0x79, 0xbb, 0xa4, 0x88, 0x7b, 0xa0, 0x8a, 0x9a, 0x68, 0x7e, 0x97,
+	0x9a, 0x20, 0xa9, 0xa7, 0x8c, 0x6b, 0x20, 0xa3, 0xa8, 0xe5, 0xd1, 0xa0, 0x48, 0x32, 0xa0, 0xc8,
+	0xe0, 0x0e, 0x9f, 0x49, 0x9b, 0x4b, 0x9d, 0x3a, 0xa2, 0xd7, 0xa7, 0xd5, 0xb7, 0x00, 0xfe, 0x4e,
+	0x8c, 0x9d, 0x9a, 0x7d, 0xa3, 0x98, 0xa6, 0x7a, 0x92, 0x77, 0x0f, 0x1a, 0xa2, 0x98, 0x9a, 0x88,
+	0xa3, 0x88, 0x9d, 0x89, 0xa7, 0x98, 0x9a, 0x87, 0x37, 0x79, 0x2b, 0xa7, 0x99, 0xa9, 0x87, 0x96,
+	0x8a, 0xa5, 0x88, 0x98, 0x78, 0x9a, 0x98, 0x18, 0x83, 0x99, 0x96, 0x78, 0x7e, 0xa8, 0x88, 0x9a,
+	0x89, 0xa6, 0x97, 0x51, 0xa4, 0x78, 0xa9, 0x99, 0xb1, 0x39, 0x0e, 0x18, 0xcc, 0x9a, 0x6b, 0x2a,
+	0x9d, 0x7a, 0xa3, 0x97, 0x2a, 0xe0, 0x96, 0x5c, 0x9d, 0xb9, 0xa9, 0x76, 0x9c, 0x99, 0xa2, 0x88,
+	0x8c, 0x6b, 0x9b, 0x69, 0xad, 0xa9, 0x55, 0x92, 0x79, 0x79, 0xa9, 0x87, 0x7f, 0x93, 0x7c, 0xb1,
+	0xb5, 0xa7, 0x98, 0x97, 0x7a, 0xe0, 0x9c, 0x87, 0xa0, 0xa7, 0xa5, 0xa6, 0xa8, 0x97, 0x99, 0x79,
+	0x9c, 0x89, 0x9b, 0x79, 0xab, 0xa8, 0xa5, 0x97, 0x92, 0x7a, 0xab, 0xa7, 0x8d, 0x7b, 0x15, 0x97,
+	0x7b, 0x9b, 0x79, 0x3c, 0x95, 0x89, 0xa4, 0x89, 0xa6, 0x86, 0xa2, 0x89, 0x9a, 0x79, 0x7e, 0xbb,
+	0xb6, 0x7e, 0xeb, 0xa0, 0x48, 0xe2, 0x2a, 0xfe, 0x7f, 0x9f, 0xa4, 0x96, 0xfe, 0x3f, 0x57, 0x99,
+	0x2c, 0xc0, 0xfe, 0xff, 0xbf, 0x18, 0x2a, 0xfe, 0x7f, 0x97, 0xfe, 0x7f, 0x06, 0xc0, 0xa2, 0x97,
+	0xfe, 0x5f, 0x77, 0xa0, 0xb8, 0xd1, 0x00, 0xfe, 0x05, 0x32, 0x9d, 0xaa, 0x7d, 0xa5, 0x9a, 0x9c,
+	0x68, 0xa9, 0x97, 0xa7, 0xa8, 0xa2, 0x8a, 0xa4, 0x77, 0xa2, 0x98, 0x94, 0x79, 0x9d, 0x98, 0xae,
+	0x77, 0x7f, 0xaf, 0x9a, 0x9b, 0x88, 0x98, 0x87, 0xa4, 0xa7, 0x60, 0x93, 0x7b, 0x9a, 0x77, 0xa7,
+	0x89, 0xa5, 0x99, 0xa6, 0x88, 0x8a, 0x79, 0xa9, 0x99, 0x65, 0x9d, 0x99, 0x9d, 0x79, 0xa3, 0x98,
+	0xa3, 0x99, 0xaa, 0x87, 0x0f, 0xa6, 0x6a, 0xb5, 0x88, 0xe6, 0x87, 0x2f, 0xa9, 0x98, 0xa0, 0xa6,
+	0xae, 0xa5, 0xe0, 0x2b, 0x8c, 0x5d, 0xa4, 0x79, 0xb2, 0xc1, 0xa0, 0xa8, 0xc2, 0x98, 0x6b, 0x8e,
+	0x6c, 0xab, 0x87, 0x94, 0x98, 0x9b, 0x7b, 0x09, 0x9b, 0x98, 0xac, 0x86, 0x3e, 0x1f, 0x9a, 0x87,
+	0xb6, 0x87, 0x89, 0x7b, 0xa5, 0x97, 0xaf, 0x98, 0x8e, 0x89, 0xae, 0x89, 0xa9, 0x87, 0x98, 0xb6,
+	0x96, 0x88, 0xa6, 0xa7, 0xa4, 0x68, 0x9c, 0x98, 0xa2, 0x78, 0xb1, 0xa6, 0x8c, 0x8c, 0x96, 0x67,
+	0xa6, 0x88, 0xa4, 0xa8, 0x5e, 0x66, 0x8f, 0x6a, 0xe0, 0xa4, 0x97, 0x62, 0xaf, 0x95, 0xa8, 0x88,
+	0x8a, 0x8a, 0xe0, 0xa2, 0x88, 0x2b, 0xab, 0x97, 0xaa, 0x98, 0xaa, 0x86, 0xa2, 0x97, 0xe8, 0xfe,
+	0xbf, 0x06, 0xfe, 0xdf, 0xb7, 0x3c, 0x4a, 0xfe, 0x3f, 0x7f, 0xfe, 0x7f, 0x06, 0xfe, 0x5f, 0x6f,
+	0xfe, 0x5f, 0x06, 0xa3, 0xa7, 0xfe, 0xff, 0xcf, 0x18, 0xa0, 0x38, 0x04, 0x9e, 0x69, 0x9a, 0x0b,
+	0xe0, 0xfe, 0x1f, 0x57, 0xfe, 0xff, 0xe7, 0x18, 0xca, 0x00, 0xfe, 0xc9, 0x5a, 0x95, 0x79, 0xab,
+	0xa9, 0xa8, 0x96, 0x9b, 0x89, 0x99, 0x88, 0xb7, 0xa7, 0xc0, 0x9c, 0x89, 0xa5, 0x8a, 0x99, 0x78,
+	0x90, 0x89, 0x51, 0x40, 0xaf, 0xa9, 0xa6, 0x88, 0x9b, 0x99, 0xa7, 0x97, 0x99, 0x99, 0x9d, 0x6a,
+	0xae, 0x98, 0x91, 0x87, 0x0b, 0xa2, 0x89, 0x9c, 0x78, 0xa7, 0x99, 0xb1, 0xa8, 0x92, 0x88, 0xa4,
+	0x7a, 0x9d, 0x88, 0xa5, 0xa8, 0x41, 0x9d, 0x98, 0x9d, 0x98, 0xa4, 0x79, 0x5a, 0xa9, 0x7a, 0xac,
+	0x6b, 0xa3, 0xa8, 0xe0, 0x99, 0x7c, 0x46, 0x8e, 0x5c, 0xa7, 0xa5, 0x08, 0x93, 0x6a, 0x2a, 0x9c,
+	0x6a, 0x8f, 0x6e, 0x9e, 0x86, 0xb7, 0xe3, 0xc3, 0x93, 0x6c, 0x97, 0x5c, 0x9b, 0xa8, 0x92, 0x6a,
+	0xa2, 0x87, 0xa2, 0x88, 0x6b, 0xa6, 0xa7, 0xbb, 0x93, 0x76, 0x9b, 0x7b, 0x94, 0x8a, 0x95, 0x69,
+	0xa5, 0xa8, 0xaa, 0x88, 0x9c, 0x7a, 0xe0, 0x99, 0xa7, 0x99, 0x87, 0xaa, 0xb7, 0x41, 0x97, 0x79,
+	0xad, 0xa7, 0xa1, 0xa9, 0xa7, 0x98, 0xa7, 0x98, 0x84, 0x3b, 0x9d, 0xa9, 0x1d, 0xb6, 0xa7, 0x97,
+	0x69, 0x8e, 0x8a, 0x94, 0x69, 0x7f, 0x40, 0xfe, 0xbf, 0xf7, 0xfe, 0x10, 0x43, 0x62, 0xc0, 0xe0,
+	0xa2, 0xa6, 0xb3, 0xa8, 0x6d, 0x90, 0x6c, 0x9a, 0x79, 0xad, 0xb6, 0xb1, 0x85, 0xe6, 0xfe, 0x5f,
+	0x7f, 0xa3, 0xa7, 0x9d, 0x5a, 0x1f, 0x9b, 0x3b, 0x2a, 0x18, 0xc7, 0xfe, 0xbf, 0xaf, 0x9e, 0x59,
+	0x9c, 0x0a, 0xa2, 0xe7, 0xc3, 0x00, 0xfe, 0xa5, 0x29, 0xa6, 0x98, 0xa5, 0x97, 0xa5, 0x88, 0x99,
+	0x89, 0xa8, 0xa7, 0xa3, 0x89, 0x98, 0x89, 0x50, 0xad, 0x99, 0x9b, 0x79, 0xa3, 0xa9, 0x93, 0x79,
+	0x6b, 0x95, 0x97, 0xb1, 0x89, 0xa3, 0x98, 0x0b, 0x9c, 0x78, 0x50, 0x04, 0x94, 0x78, 0x5a, 0xbe,
+	0x99, 0x90, 0x87, 0xa8, 0x99, 0xa5, 0x97, 0x2f, 0xb2, 0x88, 0x90, 0x8b, 0xa4, 0x87, 0x55, 0xa9,
+	0x97, 0x17, 0x9a, 0x78, 0xa8, 0x88, 0x93, 0x87, 0xb0, 0x7a, 0xb0, 0x7a, 0x9d, 0x88, 0xac, 0xb5,
+	0xc1, 0x9d, 0x7a, 0x18, 0xc3, 0x8e, 0x4e, 0xe4, 0xc0, 0xfe, 0xd5, 0x4b, 0x9c, 0x89, 0x96, 0x79,
+	0xa5, 0x78, 0x61, 0xa2, 0x99, 0xb9, 0xa7, 0xae, 0xa2, 0x18, 0x9e, 0x49, 0x97, 0x7d, 0x9d, 0x9a,
+	0xa2, 0x87, 0x42, 0x46, 0x88, 0xb8, 0x9e, 0x86, 0x67, 0xa9, 0x97, 0x9b, 0x99, 0x05, 0x9b, 0x88,
+	0xa6, 0x96, 0x56, 0xab, 0xb7, 0x9c, 0x6a, 0x89, 0x6a, 0xb7, 0xc6, 0x18, 0x91, 0x8b, 0x83, 0x5c,
+	0xa6, 0x97, 0xfe, 0x3f, 0xdf, 0x8d, 0x8a, 0x6c, 0xa1, 0x9a, 0x96, 0x78, 0xa9, 0xc7, 0x5a, 0xb6,
+	0x96, 0x96, 0x79, 0xa5, 0xa8, 0x9d, 0x6a, 0x0e, 0xa3, 0x89, 0xa4, 0x98, 0x9a, 0x68, 0xe2, 0xfe,
+	0xbf, 0xa7, 0xa2, 0xb7, 0xe0, 0xc2, 0x5a, 0x18, 0xc4, 0x4a, 0xe0, 0x2a, 0xfe, 0x1f, 0x8f, 0xa7,
+	0xe5, 0x7a, 0x3b, 0xfe, 0xff, 0x26, 0xfe, 0x7f, 0x87, 0xb9, 0x00, 0xfe, 0x43, 0x21, 0xa4, 0x88,
+	0xa7, 0xa9, 0xa9, 0x87, 0x9a, 0x8a, 0x6e, 0x95, 0x89, 0x9b, 0x89, 0xa6, 0x98, 0xa5, 0x87, 0xa4,
+	0x77, 0x99, 0xaa, 0xa9, 0x98, 0x6e, 0x97, 0x89, 0x9b, 0x88, 0xa6, 0x88, 0xb4, 0x98, 0x11, 0xa4,
+	0x78, 0xa1, 0xa9, 0xa8, 0x88, 0x9d, 0x89, 0x07, 0xa4, 0x9a, 0x99, 0x89, 0xad, 0x87, 0x9d, 0x99,
+	0x04, 0x21, 0x52, 0x59, 0xa7, 0xb9, 0x92, 0x79, 0x6f, 0x7f, 0xa5, 0x88, 0x99, 0x87, 0xa5, 0x88,
+	0xb8, 0x8b, 0xe2, 0xc7, 0x98, 0x7a, 0xa2, 0xa8, 0xa4, 0x77, 0xe0, 0xfe, 0x53, 0x43, 0xad, 0x99,
+	0x89, 0x7a, 0xa4, 0x89, 0x54, 0x41, 0xb3, 0x99, 0xb6, 0xa2, 0x5a, 0xa2, 0x87, 0x9d, 0xaa, 0x9c,
+	0x7a, 0x42, 0xa4, 0x86, 0x46, 0x90, 0xab, 0x8e, 0x87, 0x7f, 0x9d, 0x98, 0x6b, 0xaa, 0x87, 0x3d,
+	0x58, 0x9b, 0x9a, 0x99, 0x89, 0xab, 0x98, 0xa5, 0x89, 0x9c, 0x88, 0xb9, 0xa4, 0x8f, 0xab, 0x07,
+	0x18, 0xc0, 0x91, 0x99, 0x91, 0x7a, 0xa2, 0x89, 0xa8, 0x87, 0x99, 0x8a, 0x2d, 0xa4, 0x87, 0xa8,
+	0x88, 0x7b, 0x54, 0x97, 0x79, 0x9b, 0x79, 0x98, 0x99, 0x5a, 0xa1, 0x9a, 0xa6, 0x77, 0xac, 0x89,
+	0xe0, 0xc0, 0xfe, 0xdf, 0x9f, 0xfe, 0xff, 0xdf, 0xe2, 0xc8, 0x8f, 0x99, 0x18, 0xc1, 0xfe, 0x7f,
+	0x8f, 0x9f, 0xc9, 0x18, 0xbd, 0x00, 0xfe, 0x6a, 0x63, 0x99, 0x9a, 0x9b, 0x89, 0x9a, 0x88, 0x59,
+	0x7a, 0xa4, 0x89, 0x9d, 0x9a, 0x6d, 0x69, 0xb2, 0x97, 0x9a, 0x89, 0x7e, 0xa5, 0x98, 0x9c, 0x79,
+	0x93, 0x89, 0x49, 0xb1, 0xb9, 0x12, 0x9b, 0x89, 0x59, 0x32, 0x00, 0xa8, 0x98, 0xaa, 0x77, 0x9b,
+	0x89, 0x19, 0xe0, 0x56, 0x96, 0x88, 0xb6, 0x87, 0xa2, 0x88, 0x90, 0x8a, 0x9c, 0x89, 0x9a, 0x88,
+	0xa7, 0x98, 0x98, 0x68, 0x7a, 0x9d, 0x88, 0xa7, 0x98, 0xfe, 0xbe, 0xff, 0xe7, 0x93, 0x8b, 0x6e,
+	0x95, 0x8b, 0xb6, 0x94, 0x7e, 0x88, 0x6d, 0x93, 0x4c, 0xa6, 0xa6, 0x02, 0xa5, 0x98, 0x9c, 0x89,
+	0xa3, 0x88, 0xfe, 0xdf, 0xa6, 0x98, 0x8b, 0x7b, 0x9b, 0x98, 0xab, 0x76, 0x56, 0x93, 0xaa, 0xaf,
+	0x86, 0xc0, 0x93, 0xc8, 0x36, 0x8b, 0x5a, 0xaa, 0xa7, 0x03, 0x18, 0xc0, 0x96, 0x7a, 0x8a, 0x6a,
+	0xb3, 0xb6, 0xa3, 0x89, 0x18, 0x95, 0x89, 0x8e, 0x7c, 0xaa, 0x95, 0x18, 0xfe, 0xd1, 0x73, 0xaa,
+	0x98, 0x9d, 0x78, 0xa4, 0x89, 0x3f, 0x92, 0x7a, 0xa4, 0x97, 0x52, 0xaa, 0x96, 0xa4, 0x88, 0x94,
+	0x6a, 0x34, 0xa5, 0x88, 0xae, 0x98, 0x87, 0x79, 0x1f, 0x97, 0x9a, 0xac, 0x87, 0x95, 0x5b, 0xaa,
+	0xb7, 0xb1, 0x85, 0x7a, 0x4a, 0x2a, 0xe0, 0x2a, 0xe7, 0x8d, 0x89, 0x8c, 0x99, 0xe2, 0x83, 0x9a,
+	0x2b, 0xb3, 0xa8, 0xce, 0x00, 0x8c, 0x78, 0xa6, 0x77, 0x99, 0x99, 0xc0, 0x51, 0x6e, 0xa4, 0x88,
+	0x9d, 0x89, 0xa7, 0xa9, 0x98, 0x78, 0xab, 0xb9, 0x97, 0x78, 0x9c, 0x89, 0x54, 0xa9, 0x99, 0x51,
+	0x1c, 0x62, 0x07, 0xa7, 0x88, 0xa5, 0x99, 0x99, 0x99, 0x99, 0x99, 0xaf, 0x88, 0xa4, 0x87, 0x5b,
+	0x95, 0x98, 0xab, 0x99, 0x6f, 0x9d, 0x99, 0xa8, 0x86, 0x9c, 0x88, 0xa2, 0x99, 0x01, 0x99, 0x8a,
+	0x51, 0xa5, 0x98, 0x98, 0x79, 0xc0, 0x9b, 0x78, 0xa6, 0x98, 0xb3, 0xa8, 0xe3, 0x42, 0x87, 0x6c,
+	0xa4, 0x97, 0x9d, 0x9a, 0xb2, 0x85, 0xa8, 0xa6, 0xc0, 0x9c, 0x8a, 0x8e, 0x5b, 0x6e, 0x9b, 0x8b,
+	0x8d, 0x6a, 0x09, 0xa2, 0x88, 0xb5, 0x98, 0x6e, 0xa1, 0xa8, 0x9d, 0x99, 0xa7, 0x79, 0xa5, 0x86,
+	0x97, 0xab, 0x97, 0x97, 0xa6, 0x87, 0x60, 0xa4, 0xb6, 0xa6, 0x97, 0x97, 0x6a, 0xa4, 0x87, 0x72,
+	0xa6, 0x77, 0x69, 0x96, 0x89, 0xbb, 0x96, 0x9b, 0x9a, 0xa3, 0x88, 0x1f, 0xa9, 0xb8, 0xa8, 0x87,
+	0x96, 0x79, 0xa2, 0x78, 0x83, 0x7a, 0x6b, 0xa7, 0x98, 0xab, 0xa7, 0xa2, 0x89, 0x99, 0x88, 0xb2,
+	0x97, 0x8d, 0x8a, 0xa5, 0xa7, 0x14, 0x34, 0xa5, 0x98, 0x93, 0x7b, 0x9a, 0x87, 0xb0, 0x88, 0x92,
+	0x89, 0xae, 0x97, 0x9b, 0x88, 0xa7, 0x89, 0x94, 0x69, 0xa8, 0x99, 0xb0, 0x86, 0xa5, 0xa6, 0x7e,
+	0xc5, 0x66, 0x4a, 0x7e, 0xe0, 0x8d, 0x8a, 0x90, 0x97, 0xe0, 0x9c, 0x5a, 0x8c, 0xa5, 0x88, 0x74,
+	0x67, 0x9c, 0x89, 0xdb, 0x00, 0xa3, 0x9a, 0x9d, 0x9a, 0xa4, 0x87, 0x24, 0x9d, 0x99, 0x9a, 0x66,
+	0xe0, 0x6b, 0x9b, 0x88, 0xe0, 0x65, 0xac, 0x98, 0x96, 0x88, 0xa3, 0x99, 0x1c, 0x9b, 0x99, 0x50,
+	0x6b, 0x32, 0x39, 0x7e, 0xab, 0x99, 0x99, 0x89, 0xc0, 0xad, 0x97, 0x9d, 0x8a, 0x9b, 0x98, 0x99,
+	0x89, 0x9c, 0x78, 0xb1, 0xa9, 0xa7, 0x99, 0x59, 0x9c, 0x87, 0x9a, 0x89, 0x9a, 0x89, 0xaa, 0x99,
+	0x9c, 0x77, 0x57, 0x6e, 0x99, 0x99, 0xa7, 0x78, 0x9c, 0x99, 0xa9, 0x97, 0xe2, 0x86, 0x5c, 0xad,
+	0xb7, 0xad, 0x96, 0xc1, 0x9b, 0x99, 0x90, 0x8a, 0x9f, 0x6a, 0xa6, 0x89, 0x83, 0x4b, 0x41, 0xac,
+	0xa9, 0x99, 0x88, 0xa9, 0x98, 0xa5, 0xa7, 0xa8, 0xa5, 0xb0, 0x96, 0x43, 0x9d, 0x89, 0x99, 0x7d,
+	0x90, 0x67, 0x9f, 0xb7, 0x79, 0x9a, 0x89, 0x9d, 0x87, 0xb7, 0xb7, 0x9b, 0x89, 0x99, 0x89, 0xa9,
+	0x87, 0x97, 0x9b, 0x96, 0x78, 0xba, 0xa6, 0xa6, 0x76, 0x86, 0x7b, 0xb8, 0xa6, 0x96, 0x78, 0x52,
+	0x51, 0x9b, 0x89, 0x98, 0x89, 0x96, 0x68, 0x6b, 0xa5, 0x97, 0xa5, 0x99, 0xa1, 0xa7, 0xa3, 0x88,
+	0x61, 0x7f, 0x6f, 0xa6, 0x87, 0x56, 0xa1, 0xa9, 0xa6, 0x86, 0x96, 0x79, 0xad, 0x98, 0x94, 0x89,
+	0xaf, 0x98, 0x91, 0x8a, 0x6e, 0xa8, 0x88, 0x2a, 0x12, 0x6e, 0xb2, 0xb6, 0xa7, 0x78, 0x9c, 0x87,
+	0x9d, 0x7b, 0xa6, 0x98, 0xa6, 0x85, 0x46, 0x81, 0xa9, 0xb1, 0x9a, 0x8e, 0x86, 0xb7, 0xa9, 0xfe,
+	0x8a, 0x4a, 0x99, 0x98, 0xb7, 0x78, 0x8c, 0x66, 0x9d, 0xa7, 0x9d, 0x9a, 0xa4, 0x86, 0xa2, 0x86,
+	0xd3, 0x00, 0xa3, 0xae, 0xa6, 0x89, 0x9a, 0x88, 0x55, 0x9c, 0x99, 0x07, 0x6b, 0x58, 0xa3, 0x99,
+	0x9b, 0x98, 0x9d, 0x88, 0xa9, 0x88, 0xab, 0x98, 0x9c, 0x89, 0x62, 0x97, 0x78, 0x56, 0xa5, 0xa8,
+	0x41, 0x40, 0x32, 0x9c, 0x88, 0xa7, 0x88, 0x32, 0x99, 0x99, 0xa1, 0x9a, 0xa8, 0x87, 0x5a, 0x9a,
+	0x89, 0xa4, 0x87, 0xa9, 0xa9, 0xa7, 0x88, 0x7e, 0x95, 0x79, 0x7e, 0xb7, 0xa6, 0x90, 0x9a, 0x9e,
+	0x5b, 0x7e, 0xa3, 0x9a, 0x9b, 0x88, 0x3e, 0x97, 0x9a, 0xab, 0x97, 0xbf, 0xa7, 0x6f, 0xa4, 0x77,
+	0xc3, 0x88, 0x6c, 0x8f, 0x8b, 0x9c, 0x5a, 0x65, 0xa4, 0x88, 0x29, 0xaa, 0x87, 0x9d, 0x99, 0xa6,
+	0x95, 0xad, 0xc7, 0x92, 0x5a, 0xa4, 0x97, 0xa7, 0xb6, 0x18, 0x99, 0x7b, 0x82, 0x5b, 0x9b, 0x99,
+	0x65, 0xa3, 0x88, 0xb0, 0xa6, 0x9b, 0xa8, 0xa9, 0x89, 0x8e, 0x79, 0x1d, 0x79, 0xab, 0x98, 0x8f,
+	0x89, 0x97, 0x6a, 0xa3, 0x98, 0xb2, 0xb6, 0x97, 0x89, 0x9b, 0x8a, 0x98, 0x77, 0xa3, 0xa9, 0xa6,
+	0x78, 0x99, 0x87, 0x42, 0xa1, 0xaa, 0xaa, 0x87, 0x9d, 0x87, 0x65, 0xa1, 0xaa, 0xa5, 0x98, 0x06,
+	0xa9, 0x88, 0xa3, 0x89, 0x96, 0x88, 0x30, 0xe0, 0xa5, 0xa9, 0xa8, 0x88, 0x6e, 0x99, 0x8a, 0x7e,
+	0x35, 0x99, 0x88, 0xa3, 0x99, 0x9f, 0x7b, 0x97, 0x79, 0xb9, 0xc5, 0x65, 0x7e, 0x7f, 0x9a, 0x88,
+	0x99, 0x78, 0x8a, 0x97, 0xbe, 0x88, 0x56, 0x98, 0x76, 0x8a, 0x89, 0x9c, 0x84, 0x6e, 0x7d, 0x5b,
+	0xa2, 0x87, 0x34, 0xa3, 0x88, 0xcf, 0x00, 0x9a, 0x9b, 0x6b, 0xc0, 0x7a, 0x56, 0xa2, 0x88, 0xc0,
+	0xa4, 0x88, 0x0e, 0xa5, 0x9a, 0x0e, 0xaf, 0x97, 0x6e, 0x90, 0x9a, 0xa6, 0x88, 0xa5, 0x88, 0x98,
+	0x67, 0xa8, 0x99, 0x59, 0x9d, 0xa9, 0xe0, 0x50, 0x6e, 0x9f, 0x9b, 0x9d, 0x88, 0x66, 0x2b, 0xad,
+	0x99, 0x8e, 0x89, 0x51, 0xa4, 0x78, 0xa2, 0x99, 0x55, 0xa7, 0x88, 0xac, 0x97, 0x65, 0x99, 0x88,
+	0x9a, 0x7a, 0xa5, 0x99, 0xa7, 0x99, 0xa6, 0x88, 0x05, 0xc0, 0x9c, 0x88, 0xa7, 0x88, 0xbc, 0xb7,
+	0xe0, 0x65, 0xe0, 0x95, 0xaa, 0x8b, 0x5b, 0x96, 0x4c, 0x9c, 0x78, 0x65, 0xa9, 0xa9, 0x7f, 0x94,
+	0x67, 0x6e, 0xa8, 0xb8, 0xa9, 0xb7, 0xa6, 0x87, 0xac, 0x86, 0x8e, 0x7a, 0xa4, 0x97, 0x99, 0x89,
+	0xa8, 0x96, 0x47, 0x8a, 0x6a, 0x42, 0xac, 0xa6, 0xa1, 0xa8, 0xa3, 0x89, 0x9c, 0x87, 0xa6, 0x88,
+	0xa7, 0xa8, 0xa4, 0x88, 0x91, 0x8a, 0x94, 0x68, 0x42, 0xe0, 0x7a, 0x11, 0x95, 0x89, 0xa6, 0x88,
+	0x9a, 0x77, 0xc0, 0x65, 0x66, 0xa4, 0x78, 0x9a, 0x98, 0x26, 0xa6, 0x88, 0xa7, 0xa8, 0x97, 0x89,
+	0xa8, 0x87, 0x61, 0xab, 0x98, 0x97, 0x89, 0x52, 0xa7, 0x99, 0x69, 0xa5, 0xa8, 0xa2, 0x68, 0x52,
+	0x9a, 0x98, 0xa9, 0x88, 0x9d, 0x79, 0x0a, 0x9d, 0x88, 0xa6, 0x97, 0x57, 0xa2, 0x99, 0x7c, 0x9f,
+	0xa6, 0xaa, 0x89, 0x55, 0x89, 0x89, 0xb7, 0x97, 0x80, 0x66, 0xa3, 0x84, 0xc0, 0x56, 0x66, 0x7e,
+	0x9d, 0x8a, 0xa5, 0x87, 0x3e, 0x7f, 0xd6, 0x00, 0x99, 0xaf, 0x54, 0x6b, 0xa4, 0x87, 0x66, 0xc0,
+	0xe0, 0xa6, 0x88, 0x9d, 0x98, 0x3c, 0x6b, 0xa2, 0x76, 0xa8, 0xa9, 0x04, 0xa4, 0x88, 0xa4, 0x77,
+	0xa4, 0x98, 0x9a, 0x77, 0x52, 0x04, 0xa3, 0x88, 0x40, 0x2e, 0xa3, 0x86, 0x52, 0xe0, 0xc0, 0xa3,
+	0x89, 0x04, 0x5a, 0x67, 0xa6, 0x86, 0xad, 0x99, 0x96, 0x78, 0xa3, 0x87, 0x9c, 0x88, 0xa3, 0x98,
+	0xa4, 0x89, 0x98, 0x8a, 0x3a, 0xbf, 0xaa, 0x92, 0x77, 0x95, 0x89, 0x7d, 0x98, 0x7a, 0xad, 0x97,
+	0xae, 0xa9, 0xa5, 0x98, 0xa5, 0x89, 0x8d, 0x5a, 0x9c, 0x6b, 0x97, 0x8a, 0x9c, 0x88, 0xc0, 0xa5,
+	0x99, 0x1a, 0x61, 0xa7, 0x88, 0xac, 0xd5, 0xa3, 0x79, 0x19, 0xab, 0xa7, 0x9b, 0x8b, 0x98, 0x88,
+	0x6f, 0xa5, 0x97, 0x7e, 0x94, 0x6a, 0x40, 0xa8, 0xa7, 0xa8, 0x89, 0x94, 0x78, 0xa9, 0x98, 0x18,
+	0x98, 0x88, 0xa6, 0x78, 0xa6, 0xa8, 0x9d, 0x88, 0x90, 0x6a, 0x07, 0x65, 0xa4, 0x87, 0x9d, 0x9a,
+	0xa7, 0x97, 0x97, 0x89, 0xad, 0xa7, 0x9c, 0x89, 0x9c, 0x78, 0x40, 0x9d, 0x8a, 0xa2, 0x98, 0x69,
+	0xa4, 0x88, 0x50, 0xa3, 0x9a, 0xa5, 0x98, 0x9a, 0x88, 0x6e, 0xa1, 0xa9, 0xa6, 0x79, 0x9b, 0x98,
+	0xaa, 0x96, 0xa5, 0x9a, 0x99, 0x79, 0xa3, 0x98, 0x9d, 0x88, 0xae, 0x98, 0x95, 0x78, 0xa4, 0x89,
+	0x9b, 0x88, 0xa5, 0xa9, 0x9c, 0x87, 0x36, 0x54, 0x9d, 0x87, 0xa9, 0x99, 0x9b, 0x87, 0xaa, 0x75,
+	0x29, 0x52, 0x9d, 0xaa, 0x9b, 0x8a, 0xa7, 0x96, 0x42, 0x17, 0x3e, 0xa2, 0x99, 0x41, 0xca, 0x00,
+	0x97, 0xae, 0x66, 0xa2, 0x88, 0x69, 0xa7, 0x88, 0xe0, 0x9c, 0x78, 0x20, 0x66, 0xa1, 0xa9, 0x5a,
+	0xc0, 0xa4, 0x78, 0xa2, 0x98, 0x9b, 0x8a, 0x20, 0x98, 0x89, 0x51, 0x0b, 0xc0, 0x35, 0xa3, 0x98,
+	0xa6, 0x77, 0x55, 0x51, 0x9b, 0x9a, 0x35, 0x27, 0x03, 0xa2, 0x89, 0x5a, 0xa4, 0x97, 0xaa, 0x88,
+	0x96, 0x99, 0x9e, 0x67, 0x7b, 0xa6, 0x77, 0x75, 0x2e, 0x42, 0xb6, 0x98, 0xa8, 0x87, 0x87, 0x89,
+	0xac, 0x88, 0x98, 0x89, 0x55, 0x6f, 0xae, 0xa8, 0xa2, 0x69, 0xa3, 0x99, 0x96, 0x5a, 0x95, 0x7b,
+	0x66, 0xc0, 0x54, 0x66, 0x08, 0xc0, 0x79, 0xb2, 0x97, 0x99, 0xa7, 0xa4, 0x88, 0x9a, 0x79, 0x3c,
+	0x9c, 0x98, 0x51, 0xa9, 0x98, 0x8d, 0x6a, 0xa9, 0x98, 0xa9, 0xa8, 0x93, 0x69, 0xe0, 0x0a, 0x11,
+	0x19, 0x7e, 0xae, 0xa7, 0x94, 0x79, 0x93, 0x79, 0xa5, 0x99, 0x6d, 0xa3, 0xa9, 0x98, 0x69, 0x7a,
+	0xa8, 0x87, 0x06, 0x9b, 0x78, 0x9a, 0x89, 0xa2, 0x88, 0xa3, 0x88, 0x7a, 0xa8, 0x78, 0x96, 0x97,
+	0x1f, 0x65, 0xa1, 0xa9, 0xa7, 0x89, 0x9b, 0x78, 0x6b, 0xa2, 0x95, 0x9d, 0x8b, 0xa9, 0xa7, 0xa8,
+	0x89, 0x50, 0xa7, 0x89, 0x95, 0x8a, 0xa8, 0x87, 0x95, 0xaa, 0xa2, 0x67, 0x9a, 0x97, 0x9e, 0x96,
+	0x9c, 0x88, 0x90, 0x98, 0xac, 0x77, 0x9d, 0x87, 0xa5, 0x76, 0x9f, 0x96, 0xc0, 0x9d, 0x7a, 0x77,
+	0x9d, 0x9b, 0x6c, 0x62, 0xa6, 0x77, 0x50, 0x25, 0x2c, 0x67, 0xcf, 0x00, 0x9c, 0xac, 0xe0, 0x66,
+	0x6e, 0xa2, 0x88, 0x55, 0x7b, 0x5d, 0x2a, 0x6e, 0xe0, 0x9c, 0x78, 0xa4, 0x98, 0xa9, 0x87, 0xa5,
+	0xa9, 0xa4, 0x87, 0x9a, 0x8a, 0x91, 0x89, 0xa2, 0x88, 0x2b, 0xa4, 0x97, 0xa4, 0x78, 0x9a, 0x99,
+	0xa7, 0x77, 0x9d, 0x98, 0x7f, 0x19, 0x35, 0xa2, 0x88, 0x9b, 0x89, 0x7f, 0x6e, 0xa8, 0x98, 0xa4,
+	0x87, 0x98, 0x79, 0x36, 0xa2, 0x98, 0xaa, 0x77, 0x3a, 0x9d, 0x88, 0x67, 0xb6, 0x87, 0x93, 0x99,
+	0xaa, 0x76, 0x97, 0xaa, 0xa2, 0x77, 0x9c, 0x79, 0x99, 0x9a, 0xb2, 0x89, 0xa4, 0x79, 0x8f, 0x5b,
+	0x9c, 0x89, 0x6b, 0x30, 0x61, 0x69, 0xe0, 0xa2, 0x87, 0xa5, 0x98, 0x9d, 0xa9, 0xa5, 0x97, 0x9c,
+	0x79, 0xa8, 0xa7, 0x9d, 0x87, 0xab, 0xa8, 0x97, 0x89, 0x51, 0x96, 0x59, 0x19, 0xa3, 0xa8, 0x9d,
+	0x89, 0x97, 0x79, 0xab, 0x97, 0x99, 0x8a, 0x9a, 0x98, 0x15, 0xb1, 0xa8, 0x90, 0x78, 0x9d, 0x8a,
+	0xa2, 0x86, 0x18, 0x1f, 0x35, 0xa2, 0x98, 0x15, 0xa4, 0x97, 0x7e, 0x9c, 0x78, 0x66, 0xa2, 0x88,
+	0x7e, 0x50, 0xa1, 0x7a, 0x7e, 0x7f, 0xa6, 0x88, 0x9c, 0x98, 0x06, 0x79, 0x95, 0xb5, 0x24, 0xa4,
+	0x7b, 0xa5, 0x97, 0xa5, 0x99, 0x9b, 0x89, 0xa5, 0x88, 0x9c, 0x98, 0xa3, 0x98, 0x96, 0x86, 0x8f,
+	0x98, 0xab, 0x99, 0x9b, 0x76, 0xa5, 0x96, 0x5a, 0x66, 0x2c, 0xa2, 0x88, 0x62, 0x6e, 0x5d, 0xa2,
+	0x98, 0x10, 0x25, 0x99, 0x9b, 0xa3, 0x99, 0x54, 0x7f, 0xa2, 0x77, 0xce, 0x00, 0x98, 0x9d, 0x0b,
+	0x9d, 0x89, 0x7a, 0xa2, 0x77, 0xa1, 0xa9, 0x9c, 0x79, 0xa2, 0x88, 0x23, 0xe0, 0xa2, 0x88, 0x0b,
+	0x6d, 0xa4, 0x77, 0xa9, 0x97, 0x9b, 0xab, 0xa8, 0x87, 0x9c, 0x89, 0x91, 0x8a, 0xa2, 0x87, 0xad,
+	0x87, 0x96, 0x9a, 0x5a, 0xab, 0x99, 0x0b, 0xc0, 0xa2, 0x77, 0xc0, 0xa3, 0x89, 0xe0, 0x16, 0x66,
+	0x2e, 0xa3, 0x99, 0x9b, 0x89, 0xa3, 0x99, 0xa5, 0x87, 0x2e, 0xa2, 0x78, 0x1a, 0x99, 0x88, 0x9d,
+	0x89, 0xb9, 0x99, 0xa9, 0x97, 0x9b, 0x88, 0x8d, 0x8a, 0x36, 0x93, 0x8a, 0xa2, 0x79, 0xa1, 0x7a,
+	0x30, 0xc0, 0x65, 0x66, 0x65, 0x16, 0x68, 0xe0, 0xa2, 0x98, 0x9c, 0x78, 0xa5, 0xa7, 0x50, 0xa2,
+	0x88, 0x3f, 0xac, 0xb8, 0x9d, 0x89, 0x97, 0x79, 0x5a, 0x26, 0xad, 0xa8, 0x94, 0x79, 0xa6, 0x97,
+	0x94, 0x69, 0x67, 0xa7, 0x98, 0x9a, 0x88, 0xab, 0x97, 0x99, 0x79, 0x9a, 0x99, 0xa3, 0x78, 0xa6,
+	0x96, 0xae, 0xa8, 0x8c, 0x69, 0xa4, 0x98, 0x51, 0x66, 0x40, 0x7b, 0x2d, 0x61, 0x2d, 0xa2, 0xa7,
+	0xa4, 0x88, 0x9b, 0x79, 0xa9, 0x98, 0x7f, 0x94, 0x67, 0xe0, 0x98, 0xa3, 0x9a, 0xa9, 0xae, 0x65,
+	0xa5, 0x7c, 0xa5, 0xab, 0x95, 0x97, 0xab, 0x7b, 0x0a, 0xa3, 0x97, 0x83, 0xa6, 0xa6, 0x87, 0x9b,
+	0x89, 0xa6, 0x87, 0x6c, 0xa3, 0x87, 0x6e, 0x3e, 0x67, 0x3b, 0x9b, 0x9c, 0xa3, 0x97, 0xa3, 0x87,
+	0x51, 0x9e, 0x9b, 0x29, 0x26, 0x9a, 0x99, 0xa3, 0x77, 0x6f, 0x3c, 0xbd, 0x00, 0x04, 0x9c, 0x87,
+	0xa3, 0x9a, 0x69, 0xa7, 0x88, 0xa8, 0x87, 0x95, 0x89, 0x9a, 0x8a, 0xe0, 0xa4, 0x87, 0x9c, 0x89,
+	0x2a, 0x5a, 0x55, 0xaa, 0x97, 0x6d, 0xa3, 0x99, 0xa8, 0x87, 0x8d, 0x9c, 0x3c, 0xa2, 0x88, 0x7d,
+	0x04, 0x97, 0x8a, 0x3c, 0xc1, 0x66, 0xa5, 0x88, 0x55, 0x24, 0x35, 0x08, 0x9b, 0x88, 0xa3, 0x9a,
+	0x50, 0x1d, 0x24, 0xa8, 0x88, 0x0f, 0xa7, 0x9a, 0x28, 0xa2, 0x99, 0x05, 0xb6, 0x87, 0x8a, 0x79,
+	0x08, 0x9d, 0x8a, 0x55, 0x6e, 0x22, 0xa2, 0x5b, 0x6b, 0x9d, 0xa7, 0x6f, 0x20, 0x6f, 0xa3, 0x97,
+	0xa1, 0xa9, 0x9a, 0x78, 0x24, 0x6e, 0x65, 0x15, 0xb3, 0xb6, 0x96, 0x87, 0xa8, 0x75, 0xa5, 0x9a,
+	0x96, 0x9a, 0x9b, 0x8a, 0xa3, 0x87, 0x99, 0x8a, 0x9b, 0x8a, 0x6d, 0xac, 0xa7, 0x5a, 0x98, 0x78,
+	0x9b, 0x9a, 0xc0, 0x35, 0x6d, 0xa4, 0x97, 0x99, 0x8b, 0x22, 0x7f, 0x22, 0x6b, 0x50, 0x22, 0x29,
+	0xa2, 0x78, 0xa6, 0x97, 0xc0, 0x9b, 0x69, 0xa3, 0xa9, 0x9d, 0x98, 0x3c, 0xa4, 0x94, 0x95, 0xb7,
+	0x67, 0xa7, 0x75, 0xa7, 0x7a, 0xa0, 0xac, 0x11, 0xb4, 0x6b, 0xc0, 0x7d, 0xe1, 0x6d, 0xa5, 0x86,
+	0x56, 0x02, 0x6e, 0x9d, 0x9b, 0x9d, 0x9a, 0xa3, 0x96, 0x55, 0x02, 0x9c, 0x9a, 0x9d, 0x99, 0x5e,
+	0xa3, 0x98, 0x17, 0x9d, 0x9a, 0xe0, 0xa3, 0x99, 0x99, 0xab, 0xc1, 0x00, 0x6e, 0xa8, 0x88, 0x51,
+	0x9d, 0x88, 0xa5, 0x87, 0x63, 0x55, 0x6f, 0xa3, 0x98, 0x2e, 0x9b, 0x98, 0xc0, 0xe0, 0x6e, 0xa3,
+	0x98, 0xa8, 0x88, 0x9a, 0x88, 0xa7, 0x97, 0x93, 0x9a, 0x2e, 0x0e, 0x69, 0x15, 0x00, 0x99, 0x99,
+	0xc0, 0x16, 0x35, 0x9c, 0x88, 0xa2, 0x88, 0x5a, 0x3c, 0xa2, 0x78, 0x62, 0x55, 0xe0, 0x0f, 0x52,
+	0xa7, 0x86, 0xa7, 0x99, 0x0f, 0xa6, 0x88, 0xa2, 0x87, 0x98, 0x79, 0xfe, 0x75, 0xad, 0x9a, 0x89,
+	0x8c, 0x79, 0x9d, 0x88, 0xa2, 0x88, 0x98, 0x89, 0xa4, 0x88, 0x9e, 0x68, 0xa1, 0x7d, 0x6e, 0xa2,
+	0x88, 0xe0, 0xa2, 0x87, 0x7b, 0xa6, 0x86, 0x95, 0x9b, 0xc0, 0x65, 0x69, 0xa5, 0x88, 0xa9, 0xa7,
+	0xa4, 0x86, 0xa4, 0x75, 0x9c, 0xab, 0x57, 0x95, 0x6a, 0x07, 0x9c, 0x88, 0x62, 0xa2, 0x87, 0xa7,
+	0x88, 0x2d, 0x41, 0x03, 0x59, 0xa3, 0x99, 0x38, 0xab, 0xa6, 0x96, 0x8a, 0x66, 0xc1, 0x9b, 0x88,
+	0x03, 0x1b, 0xa6, 0x98, 0x9c, 0x78, 0xc0, 0xa9, 0xa7, 0x14, 0x5a, 0x7b, 0x61, 0xa2, 0x93, 0x96,
+	0x99, 0x7e, 0xa5, 0x76, 0xa9, 0x88, 0x97, 0x9c, 0x99, 0xb9, 0xae, 0x57, 0x3a, 0x9f, 0x73, 0x05,
+	0x6e, 0x9d, 0x9a, 0x5a, 0x34, 0xa2, 0x88, 0xe0, 0x9d, 0x8a, 0x51, 0x3b, 0xa1, 0x9a, 0x9c, 0x88,
+	0x6b, 0x9d, 0x99, 0xa4, 0x88, 0x9d, 0x89, 0x7a, 0x18, 0xc0, 0x98, 0x9a, 0xc0, 0xc1, 0x00, 0x1c,
+	0x6b, 0x65, 0xe0, 0x2a, 0x2e, 0xa6, 0x87, 0xa3, 0x89, 0x96, 0x99, 0x1c, 0x3c, 0xc0, 0x2a, 0x55,
+	0x1c, 0x41, 0x2a, 0xb1, 0x86, 0x19, 0x95, 0x8b, 0xa4, 0x97, 0x3c, 0x66, 0x69, 0xa5, 0x99, 0x41,
+	0x3c, 0x2e, 0xa2, 0x88, 0x9c, 0x88, 0xa3, 0x99, 0x2e, 0x67, 0x16, 0x24, 0xe0, 0x3c, 0x0f, 0x6e,
+	0xa7, 0xa7, 0x9a, 0x89, 0x5b, 0xa3, 0x99, 0x3a, 0x7f, 0xfe, 0x18, 0xc6, 0x83, 0x7a, 0xa3, 0x98,
+	0x33, 0x9b, 0x89, 0x9b, 0x88, 0x56, 0x1b, 0xa7, 0x7a, 0x5a, 0xa2, 0x98, 0x55, 0xa2, 0xa8, 0xa8,
+	0x75, 0x97, 0x9a, 0xa3, 0x8b, 0x97, 0x88, 0xa3, 0x88, 0xa2, 0x96, 0xad, 0xa5, 0x9d, 0x78, 0x96,
+	0x9c, 0xa6, 0x98, 0x9d, 0x99, 0xa8, 0x78, 0xe0, 0x9d, 0x98, 0x7f, 0x56, 0xa7, 0x87, 0x9d, 0x99,
+	0x9b, 0x99, 0x5a, 0x6e, 0xa6, 0x87, 0x9c, 0xaa, 0xa3, 0x97, 0xa2, 0x88, 0x99, 0x79, 0xc0, 0x14,
+	0xc0, 0x34, 0x7a, 0x14, 0xc0, 0xa2, 0x98, 0xa5, 0x98, 0x9c, 0x78, 0x9e, 0x68, 0xa0, 0xa8, 0xa2,
+	0x86, 0x9a, 0xa5, 0x9a, 0x9b, 0x50, 0xa5, 0x87, 0xa5, 0x77, 0x77, 0x9b, 0x99, 0x05, 0x69, 0x9f,
+	0x9b, 0x9c, 0x78, 0xc0, 0x02, 0x9c, 0x9b, 0xa3, 0x86, 0x6b, 0x18, 0x02, 0x9a, 0x8a, 0x2d, 0xc0,
+	0xa7, 0x77, 0x9e, 0x96, 0x38, 0xa2, 0x87, 0x9d, 0x89, 0x67, 0x65, 0xc0, 0x9b, 0x9b, 0xa2, 0x87,
+	0xb8, 0x00, 0x5b, 0xa2, 0x88, 0x23, 0x3c, 0x55, 0xc1, 0x03, 0x69, 0xa1, 0x9a, 0x6d, 0xe0, 0x61,
+	0xa3, 0x87, 0xa5, 0x88, 0x23, 0xa3, 0x77, 0xa4, 0x87, 0xa4, 0x99, 0x2e, 0x31, 0xe0, 0x23, 0x7f,
+	0x23, 0x56, 0x2e, 0xc0, 0x55, 0x32, 0x9c, 0x88, 0xa8, 0x88, 0x27, 0xe0, 0x03, 0xa3, 0x99, 0x45,
+	0x16, 0x66, 0xa4, 0x77, 0xa8, 0x97, 0x16, 0x6f, 0xa8, 0x97, 0x6e, 0xaa, 0x99, 0x9d, 0x89, 0x93,
+	0x89, 0xae, 0x86, 0x92, 0x8a, 0x6e, 0xa5, 0x99, 0x98, 0x77, 0xa1, 0x7a, 0xb6, 0x87, 0xab, 0x97,
+	0x8b, 0x7b, 0xa7, 0xa8, 0x9d, 0x77, 0x7f, 0x99, 0x8a, 0x67, 0x54, 0xa3, 0x99, 0xa2, 0x87, 0x98,
+	0x8a, 0x5a, 0xaa, 0xa5, 0xaa, 0x88, 0x8f, 0x9b, 0x99, 0x69, 0xa1, 0xa9, 0x11, 0x26, 0x6e, 0x9c,
+	0x88, 0x51, 0x66, 0x7e, 0xa4, 0x88, 0x7e, 0xa4, 0x98, 0xa3, 0x88, 0x98, 0x89, 0x9b, 0x78, 0x1b,
+	0xe0, 0x22, 0x1b, 0xe0, 0x1b, 0xa5, 0x99, 0x2d, 0x6f, 0xe0, 0xa7, 0xa8, 0x9b, 0x98, 0x99, 0xa5,
+	0x99, 0xab, 0x79, 0xa4, 0x77, 0xaa, 0x64, 0x9d, 0x88, 0x7b, 0xa3, 0x77, 0x37, 0x9c, 0x8a, 0x63,
+	0x66, 0x10, 0x52, 0xa1, 0x9a, 0x3f, 0xa3, 0x88, 0x9d, 0x89, 0x38, 0x54, 0xa5, 0x98, 0x50, 0xe0,
+	0x14, 0xc0, 0xa3, 0x87, 0x10, 0xa2, 0x79, 0x18, 0x11, 0x26, 0xb9, 0x00, 0x31, 0xa4, 0x78, 0x65,
+	0x6e, 0xa2, 0x88, 0x1c, 0x56, 0x55, 0x0e, 0x55, 0xa1, 0x9a, 0x61, 0x3c, 0x07, 0xa4, 0x88, 0x9c,
+	0x89, 0x3c, 0xa3, 0x87, 0x2e, 0x04, 0x7e, 0x9c, 0x78, 0xe0, 0x6b, 0x2a, 0x55, 0x1c, 0xc0, 0xa2,
+	0x89, 0x2e, 0x35, 0xa3, 0x88, 0x9d, 0x89, 0x3c, 0x35, 0xe0, 0x35, 0x2e, 0x35, 0x16, 0xa5, 0x98,
+	0xc0, 0x0f, 0xa3, 0x88, 0x66, 0xab, 0x98, 0xa5, 0x89, 0x8f, 0x9a, 0xe0, 0x8f, 0x8a, 0xa5, 0x88,
+	0xa3, 0x99, 0x6d, 0x9b, 0x8a, 0xaf, 0x97, 0xa7, 0x78, 0x7e, 0x9a, 0x88, 0xe0, 0x9a, 0x8a, 0xa3,
+	0xa9, 0xb4, 0x96, 0x8f, 0x78, 0x41, 0x9c, 0x99, 0xad, 0xa9, 0xae, 0x97, 0xa3, 0x87, 0x88, 0x7a,
+	0x93, 0x6a, 0xa0, 0x9a, 0xa2, 0x97, 0xa2, 0x77, 0x55, 0x9c, 0x89, 0x52, 0x7a, 0xa3, 0x97, 0xa4,
+	0x89, 0x60, 0xa7, 0x89, 0x54, 0xa9, 0x99, 0x22, 0x03, 0x22, 0x55, 0x34, 0x9d, 0x99, 0xa2, 0x67,
+	0xa1, 0xaa, 0x50, 0xa5, 0x98, 0x9d, 0x7a, 0xa1, 0xa7, 0xa2, 0x85, 0x69, 0x95, 0xb9, 0x9d, 0x9a,
+	0x66, 0xa3, 0x87, 0xa9, 0x75, 0x51, 0x5d, 0xa5, 0x86, 0x9a, 0x9c, 0x7f, 0x62, 0x42, 0x7d, 0x7f,
+	0x31, 0x6e, 0xa3, 0x88, 0x60, 0x17, 0x22, 0xa3, 0x87, 0x9b, 0x9b, 0x62, 0x38, 0x22, 0x1b, 0x0d,
+	0xc0, 0x02, 0xa4, 0x99, 0x44, 0xc1, 0x00, 0x98, 0x9d, 0x65, 0xe0, 0x9c, 0x88, 0x00, 0x9d, 0x99,
+	0x7e, 0x23, 0xa3, 0x87, 0x23, 0x5a, 0x1c, 0x23, 0x1c, 0x3c, 0x2a, 0xa3, 0x78, 0xa8, 0x98, 0x99,
+	0x88, 0xa2, 0x98, 0xa2, 0x77, 0xa0, 0x9a, 0x12, 0xa3, 0x98, 0x23, 0xa3, 0x99, 0x9c, 0x78, 0xa4,
+	0x88, 0x3c, 0x0b, 0x69, 0x3c, 0xc0, 0x6e, 0x6b, 0xc0, 0x3c, 0x35, 0x16, 0xc0, 0x2e, 0xa3, 0x9a,
+	0xaf, 0x88, 0x94, 0x88, 0x9d, 0x88, 0xae, 0x99, 0x94, 0x88, 0xba, 0x87, 0x8b, 0x99, 0x9d, 0x89,
+	0x41, 0x7f, 0xa8, 0x76, 0x9a, 0x99, 0x6e, 0xae, 0x78, 0xb5, 0xa9, 0x60, 0x98, 0x78, 0x5b, 0x7e,
+	0x95, 0x98, 0x9b, 0x68, 0xa5, 0x99, 0xa4, 0x87, 0xa4, 0xba, 0xaa, 0x88, 0x9a, 0x77, 0x84, 0x5a,
+	0xa1, 0x8a, 0xa2, 0x87, 0x61, 0x0c, 0xa6, 0x99, 0x8d, 0x7a, 0x9a, 0x78, 0x3f, 0xa6, 0x97, 0xa5,
+	0x87, 0x05, 0x9b, 0x9a, 0xae, 0x9a, 0x8b, 0x88, 0x0d, 0xc0, 0x77, 0x0d, 0x66, 0xc0, 0x0d, 0x1b,
+	0xa8, 0x97, 0x9d, 0x89, 0xa2, 0x86, 0x9b, 0x95, 0x07, 0xa7, 0x87, 0x94, 0xab, 0x55, 0xa2, 0x88,
+	0xa3, 0x87, 0xa9, 0x75, 0xa3, 0x86, 0x9c, 0x99, 0x5b, 0x61, 0x6f, 0x66, 0x5a, 0xe0, 0x34, 0x51,
+	0xa3, 0x89, 0x9b, 0xab, 0x5d, 0x25, 0x95, 0xad, 0xa6, 0x86, 0x59, 0x9c, 0x9b, 0xa5, 0x87, 0x61,
+	0x59, 0xa5, 0x88, 0x34, 0x67, 0x29, 0xa8, 0x87, 0xca, 0x00, 0x0b, 0x50, 0x12, 0xc0, 0xa3, 0x98,
+	0x55, 0xa4, 0x88, 0xe0, 0xac, 0x97, 0x96, 0x79, 0x9d, 0x99, 0x2e, 0x2a, 0x23, 0xaa, 0x87, 0xab,
+	0x96, 0x8c, 0x7c, 0xa6, 0x76, 0x0b, 0x1c, 0x6e, 0x15, 0x66, 0x9c, 0x78, 0x23, 0x1c, 0xa3, 0x89,
+	0x1c, 0x23, 0x40, 0xa4, 0x88, 0x9d, 0x8a, 0x35, 0xc1, 0x9d, 0x88, 0xa3, 0x89, 0x7e, 0x2e, 0x9d,
+	0x88, 0xa1, 0x9a, 0x24, 0xa2, 0x87, 0xb8, 0x88, 0x95, 0x99, 0x01, 0x04, 0x95, 0x89, 0xaf, 0x98,
+	0xa2, 0x99, 0x9b, 0x89, 0x95, 0x79, 0xaa, 0x85, 0x97, 0x89, 0xb0, 0x99, 0x91, 0x89, 0xbc, 0xa7,
+	0xb0, 0x87, 0xa5, 0x88, 0x65, 0x9d, 0x99, 0xa2, 0x7a, 0x9d, 0x99, 0x9c, 0x87, 0xa2, 0x78, 0xa2,
+	0x89, 0xe0, 0x9b, 0x98, 0x9c, 0x78, 0x97, 0x79, 0x54, 0xa4, 0x99, 0xa3, 0x99, 0x8f, 0x79, 0x9b,
+	0x8a, 0xa3, 0x87, 0x2d, 0xa5, 0x86, 0xa6, 0x86, 0x97, 0x9b, 0xab, 0xaa, 0x9a, 0x77, 0x96, 0x8a,
+	0x56, 0x56, 0x69, 0xc0, 0x65, 0x22, 0xc0, 0xa2, 0x76, 0xa6, 0x98, 0x9c, 0x88, 0x9e, 0x95, 0x96,
+	0xa8, 0xa6, 0x65, 0xa4, 0x8a, 0x31, 0x51, 0x55, 0xa5, 0x98, 0xa2, 0x75, 0xaa, 0x65, 0x65, 0x9a,
+	0x9b, 0xa2, 0x78, 0x7a, 0xe0, 0xa5, 0x87, 0x9a, 0x8a, 0x18, 0x55, 0xa4, 0x87, 0x0d, 0x9d, 0x99,
+	0xa2, 0x77, 0x63, 0x68, 0xa3, 0x9a, 0x9a, 0x89, 0x7f, 0x9c, 0x89, 0x23, 0x0a, 0xa9, 0x87, 0x9c,
+	0x87, 0x0d, 0xa7, 0x75, 0xc2, 0x00, 0xfe, 0xa2, 0x08, 0x76, 0x55, 0x31, 0x51, 0x0e, 0x9d, 0x99,
+	0xa5, 0x98, 0x9d, 0x89, 0x6f, 0x9c, 0x88, 0x1c, 0x40, 0xa3, 0xaa, 0xa2, 0x76, 0xac, 0x98, 0x15,
+	0x7a, 0x6b, 0xa2, 0x88, 0x15, 0xa4, 0x88, 0x31, 0x23, 0x45, 0xa2, 0x98, 0x31, 0x35, 0x1c, 0xa2,
+	0x87, 0x39, 0x1c, 0x3c, 0x0b, 0xe0, 0x6b, 0x9d, 0x87, 0xa3, 0x89, 0x3c, 0x16, 0x7e, 0x16, 0x3c,
+	0xa6, 0x87, 0xb1, 0x87, 0x93, 0x9a, 0x16, 0xac, 0x88, 0x9c, 0x86, 0xa9, 0x8a, 0xa7, 0xa9, 0x91,
+	0x88, 0x9d, 0x78, 0xac, 0x87, 0x9c, 0x78, 0xa4, 0x9a, 0x9a, 0x86, 0xba, 0x39, 0xa9, 0xc9, 0xa6,
+	0xa7, 0xa2, 0x97, 0xa1, 0x9a, 0x69, 0x62, 0x6e, 0x62, 0x3f, 0x61, 0x9d, 0x78, 0x0d, 0xc0, 0x9d,
+	0x98, 0x98, 0x79, 0x55, 0x9b, 0x88, 0x9c, 0x79, 0x96, 0x89, 0x9d, 0x76, 0x9c, 0x99, 0xaf, 0xaa,
+	0x90, 0x78, 0x96, 0x68, 0xa9, 0xa7, 0x96, 0x7b, 0x51, 0xa3, 0x98, 0x9c, 0x89, 0x6b, 0xa2, 0x76,
+	0x6f, 0x3b, 0x7f, 0x9e, 0x86, 0x9b, 0xa7, 0x9d, 0xa8, 0xaa, 0x65, 0x0e, 0x9d, 0xaa, 0x55, 0x38,
+	0xa6, 0x65, 0xaa, 0x75, 0x9d, 0x88, 0x77, 0x51, 0x26, 0x7e, 0xa2, 0x87, 0x41, 0x1b, 0x51, 0x26,
+	0x9b, 0x99, 0xa9, 0x87, 0x9c, 0x88, 0x67, 0x22, 0x7a, 0x9b, 0x8a, 0x3f, 0x51, 0xa5, 0x78, 0x9a,
+	0xaa, 0xa7, 0x86, 0x3f, 0xa7, 0x87, 0xe0, 0x22, 0xca, 0x00, 0xaa, 0x99, 0x62, 0x9b, 0x89, 0xc0,
+	0x97, 0x9a, 0xa3, 0x77, 0xa2, 0x99, 0x1c, 0x56, 0xc0, 0xa5, 0x97, 0x0b, 0xaa, 0x85, 0x35, 0x66,
+	0xad, 0x87, 0x97, 0x9a, 0x9c, 0x78, 0xa4, 0x88, 0x51, 0xe0, 0xa2, 0x78, 0xa2, 0xa9, 0x9d, 0x88,
+	0x66, 0x55, 0x3c, 0xc0, 0xa3, 0x98, 0x35, 0x6f, 0x3c, 0x1c, 0xc0, 0xa7, 0x98, 0x3c, 0xc0, 0x6e,
+	0x16, 0x1d, 0xe1, 0x7e, 0x0b, 0xa7, 0x88, 0xb0, 0x85, 0x91, 0x9b, 0x9a, 0x8a, 0x2c, 0x9f, 0x86,
+	0xa2, 0x89, 0x6b, 0x96, 0x99, 0x9e, 0x67, 0xaa, 0x88, 0xad, 0x73, 0xa6, 0x75, 0xa1, 0xad, 0xaf,
+	0x5c, 0xfe, 0x15, 0x05, 0xa2, 0x88, 0xa4, 0xe6, 0xa2, 0xba, 0xa1, 0xa9, 0xa5, 0x87, 0x7a, 0xa1,
+	0xb8, 0xa1, 0xa7, 0xa5, 0xca, 0x30, 0xc0, 0x9b, 0x97, 0x52, 0xa4, 0x88, 0x66, 0x9d, 0x88, 0xa2,
+	0x89, 0x9a, 0x89, 0x51, 0x9d, 0x98, 0x98, 0x78, 0x98, 0x77, 0x9d, 0x87, 0x98, 0x7a, 0x9d, 0x8b,
+	0xa2, 0x87, 0x96, 0x8b, 0x3b, 0x66, 0x29, 0xa3, 0x97, 0x9f, 0xa6, 0xa4, 0x76, 0x94, 0xaa, 0x38,
+	0xa5, 0x86, 0x9d, 0x8a, 0x9d, 0x99, 0x38, 0x69, 0xa6, 0x77, 0xa4, 0x76, 0x7e, 0x9c, 0x88, 0x26,
+	0x0d, 0xa1, 0x8a, 0x54, 0x6e, 0x26, 0xa2, 0x88, 0x9d, 0x99, 0x9c, 0x99, 0xa4, 0x67, 0x26, 0x9c,
+	0x99, 0xa5, 0x87, 0x99, 0x8a, 0xa6, 0x96, 0xa3, 0x78, 0xc0, 0x09, 0x26, 0xa3, 0x97, 0x1f, 0xa5,
+	0x85, 0x97, 0x9c, 0x55, 0xba, 0x00, 0x1f, 0xa0, 0x9a, 0x9c, 0x78, 0xa4, 0x87, 0x0a, 0xa3, 0x89,
+	0x55, 0x7b, 0x55, 0x52, 0x35, 0x23, 0xa2, 0x77, 0x63, 0x54, 0xa8, 0x87, 0x9d, 0x9a, 0x45, 0x61,
+	0x56, 0xe0, 0x0e, 0x41, 0xa8, 0x96, 0x3c, 0x0e, 0x15, 0x0e, 0x3c, 0xe0, 0x5a, 0x52, 0x2e, 0xe0,
+	0x0e, 0x7f, 0x2e, 0xc0, 0x32, 0x51, 0x00, 0x63, 0x5d, 0xa2, 0x98, 0x9d, 0x78, 0xa8, 0x98, 0xa9,
+	0x87, 0x8c, 0x8b, 0xa8, 0x88, 0x7f, 0x9d, 0x77, 0xa2, 0x98, 0x2f, 0x96, 0x89, 0xa3, 0x89, 0xab,
+	0x75, 0xab, 0x74, 0xa2, 0x97, 0xa5, 0xcf, 0xb4, 0x7a, 0x95, 0x0a, 0xfe, 0x98, 0x05, 0x69, 0xa2,
+	0x77, 0x7a, 0x7f, 0x79, 0xc0, 0x9d, 0x98, 0x7f, 0xa2, 0xc7, 0xa4, 0xd8, 0xa4, 0xc7, 0xa1, 0xc9,
+	0x9d, 0xa9, 0xa4, 0x98, 0x9d, 0x98, 0x56, 0xa2, 0x88, 0xa2, 0x98, 0x9d, 0x89, 0x7a, 0x9c, 0x87,
+	0x99, 0x88, 0x9a, 0x88, 0xa3, 0x78, 0x97, 0x89, 0x9c, 0x78, 0x46, 0x9b, 0xab, 0x98, 0x87, 0x3f,
+	0x52, 0x9c, 0x9a, 0x31, 0xa9, 0x76, 0xc0, 0x97, 0xbb, 0x31, 0xa2, 0x88, 0xe0, 0x3f, 0x51, 0xa4,
+	0x88, 0x1c, 0xe0, 0x2d, 0xc0, 0x0a, 0x98, 0xab, 0xa3, 0x87, 0x7f, 0x2d, 0x3c, 0x9d, 0x99, 0x2a,
+	0x31, 0x7b, 0xa3, 0x86, 0xa3, 0x78, 0x3b, 0x53, 0x1f, 0x7b, 0x38, 0xac, 0x75, 0x35, 0x9c, 0x89,
+	0xc2, 0x00, 0xa5, 0x88, 0x35, 0x6b, 0xa4, 0x77, 0xa2, 0xa9, 0x2e, 0xa1, 0xa9, 0x9c, 0x88, 0xe0,
+	0x7f, 0x41, 0xa7, 0x97, 0x9a, 0x89, 0xe0, 0xc0, 0xa4, 0x86, 0x2a, 0x23, 0xa4, 0x77, 0x51, 0x1c,
+	0x52, 0x2a, 0xa5, 0x86, 0x2a, 0x1c, 0x6b, 0x1c, 0x2a, 0xa5, 0x88, 0x15, 0x23, 0xa3, 0x99, 0xe0,
+	0x23, 0x5a, 0x2a, 0x55, 0xa8, 0x88, 0xb0, 0x88, 0x55, 0x97, 0x88, 0xa5, 0x98, 0x9c, 0x78, 0x7f,
+	0xa2, 0x87, 0xa8, 0x75, 0x9c, 0x9b, 0x8d, 0xab, 0xaa, 0x78, 0x40, 0xa9, 0x87, 0xa4, 0x77, 0x96,
+	0x9a, 0xa2, 0x87, 0xa7, 0xa9, 0x9e, 0x65, 0xae, 0x87, 0xaf, 0xbc, 0xa7, 0x9a, 0x46, 0xfe, 0x39,
+	0x5e, 0x9b, 0x0b, 0xa3, 0x76, 0x6f, 0xa0, 0xa8, 0x7e, 0x55, 0x55, 0x56, 0xa1, 0xa8, 0x65, 0x6e,
+	0x5a, 0x9f, 0xc9, 0xa1, 0xb7, 0xa3, 0xfa, 0xfe, 0xba, 0xc6, 0x1e, 0x9c, 0x88, 0x61, 0x6e, 0x61,
+	0x55, 0x7b, 0x5d, 0xa1, 0xa9, 0x8f, 0x79, 0x96, 0x88, 0xb4, 0x97, 0x8d, 0x7a, 0x8c, 0x78, 0x9c,
+	0x9a, 0x9d, 0x99, 0x38, 0xa9, 0x75, 0x9a, 0x89, 0x07, 0x38, 0xa7, 0x87, 0x2d, 0xa8, 0x86, 0x2e,
+	0x69, 0x2d, 0xe0, 0x9d, 0x9a, 0xa2, 0x78, 0xa2, 0x87, 0xe0, 0xa5, 0x87, 0x51, 0xa2, 0x77, 0x9c,
+	0x9a, 0x61, 0x5a, 0x38, 0xe0, 0x38, 0xa6, 0x75, 0xc0, 0xae, 0x87, 0x96, 0x89, 0x3c, 0x62, 0xa5,
+	0x88, 0xa2, 0x88, 0x3c, 0xc0, 0x00, 0x15, 0x66, 0xa3, 0x88, 0x35, 0x15, 0xe0, 0x7a, 0xe1, 0x2e,
+	0x15, 0x1c, 0x9d, 0x99, 0xa3, 0x78, 0x66, 0x7d, 0x9d, 0x89, 0x15, 0xa7, 0x98, 0x9a, 0x89, 0x03,
+	0x1c, 0x15, 0xa4, 0x99, 0x9d, 0x88, 0xa2, 0x87, 0xa3, 0x88, 0xe0, 0x15, 0x2e, 0x9d, 0x9a, 0xa2,
+	0x88, 0x3c, 0xe0, 0xa4, 0x88, 0x9c, 0x89, 0xa2, 0x87, 0x3c, 0x59, 0xb6, 0x87, 0xab, 0x70, 0x93,
+	0xae, 0x95, 0x8c, 0xac, 0x96, 0xa6, 0x87, 0x9d, 0x78, 0x98, 0x99, 0xa3, 0x87, 0xa3, 0x8a, 0x97,
+	0xaa, 0x99, 0x9b, 0xab, 0x75, 0xa9, 0x74, 0x9e, 0xcd, 0xad, 0x88, 0xa7, 0xaa, 0xa2, 0x88, 0xa8,
+	0x88, 0xa3, 0x77, 0x0c, 0xa2, 0x78, 0x5f, 0x98, 0x19, 0xe1, 0x7f, 0x69, 0x7f, 0x51, 0x5e, 0xa0,
+	0xa7, 0xc0, 0x61, 0x7a, 0x9f, 0x68, 0x9f, 0xc9, 0x55, 0x4a, 0xfe, 0xb4, 0x45, 0xfe, 0x98, 0xa6,
+	0xa2, 0xe8, 0xa2, 0xa8, 0x9c, 0x87, 0x56, 0x9a, 0x87, 0x98, 0x78, 0x9b, 0x89, 0x95, 0x89, 0x8e,
+	0x7a, 0xb8, 0x96, 0x8f, 0x76, 0x7b, 0x98, 0x9c, 0xc0, 0x6e, 0x69, 0x38, 0xe0, 0x5a, 0x03, 0x6e,
+	0xa9, 0x86, 0x10, 0x9e, 0x8b, 0x3f, 0x56, 0x66, 0x9c, 0x99, 0x2d, 0x6f, 0x2d, 0xa2, 0x98, 0xa4,
+	0x66, 0x99, 0x9b, 0x9c, 0x99, 0x7b, 0x31, 0xe0, 0x11, 0xa6, 0x77, 0x62, 0xa5, 0x87, 0x9a, 0x8a,
+	0xa3, 0x99, 0x2e, 0x52, 0xc0, 0x61, 0xb5, 0x00, 0xa2, 0x67, 0xc0, 0x67, 0x65, 0xc0, 0xa5, 0x87,
+	0x03, 0xa9, 0x88, 0x11, 0x4a, 0x1c, 0x23, 0x7f, 0x23, 0x1c, 0xa2, 0x88, 0x1c, 0xc0, 0x15, 0xa2,
+	0x88, 0x99, 0x99, 0x6f, 0x2a, 0x0b, 0x03, 0xa7, 0x78, 0x2a, 0xc0, 0x3c, 0x1c, 0x0b, 0x23, 0xa2,
+	0x89, 0x6d, 0x19, 0x0b, 0x2a, 0x5e, 0xa4, 0x88, 0xa7, 0x75, 0xb3, 0x82, 0x98, 0x9d, 0x90, 0x9b,
+	0x32, 0xad, 0x97, 0xb9, 0x98, 0x89, 0x77, 0x55, 0xa2, 0x76, 0x9b, 0xab, 0x9f, 0xad, 0xb6, 0x96,
+	0xa9, 0x99, 0xa2, 0x88, 0x7b, 0xa3, 0x88, 0x0c, 0x50, 0xa3, 0x89, 0xa2, 0x77, 0xe0, 0x5b, 0x9b,
+	0x3a, 0xfe, 0x3a, 0x2e, 0xa1, 0x49, 0x69, 0x7f, 0x45, 0x28, 0xa0, 0xa7, 0xc1, 0x59, 0x65, 0xc0,
+	0x51, 0xc0, 0x9d, 0xa9, 0x5a, 0x9d, 0xa8, 0xfe, 0x54, 0x55, 0xfe, 0x16, 0xae, 0xa9, 0xc8, 0x93,
+	0x98, 0xa2, 0x99, 0xfe, 0x84, 0x31, 0x9b, 0x8a, 0xa2, 0x87, 0x99, 0x9a, 0x1f, 0x69, 0x26, 0x9b,
+	0xab, 0xe0, 0xc0, 0xa2, 0x87, 0xe0, 0x69, 0x6b, 0x31, 0xc0, 0xa4, 0x74, 0xa5, 0x99, 0x97, 0x8a,
+	0x26, 0x2e, 0x6f, 0x98, 0x89, 0xa5, 0x97, 0x26, 0x2e, 0xa4, 0x76, 0x1c, 0x50, 0x38, 0x65, 0x38,
+	0x55, 0xe0, 0xa9, 0x88, 0x2a, 0x9d, 0x88, 0x62, 0x38, 0x1f, 0x00, 0xc0, 0x6e, 0xbd, 0x00, 0x6e,
+	0x03, 0x5a, 0x0e, 0x9c, 0x88, 0x26, 0x3c, 0xa7, 0x99, 0x98, 0x88, 0xa1, 0x8a, 0x1c, 0xe0, 0x0e,
+	0x66, 0xa3, 0x89, 0xa2, 0x86, 0x19, 0x97, 0x8a, 0xe0, 0x1c, 0x15, 0x23, 0xa3, 0x89, 0x3c, 0x31,
+	0xa2, 0x88, 0xa3, 0x88, 0x3c, 0xc0, 0xa4, 0x98, 0x35, 0xe0, 0x56, 0x35, 0x18, 0x15, 0x2e, 0x69,
+	0xa5, 0x76, 0xa7, 0x87, 0x9d, 0x99, 0xab, 0x99, 0xa5, 0x85, 0x8f, 0x9e, 0xab, 0x86, 0xa3, 0xa8,
+	0xac, 0x89, 0x92, 0x75, 0xa5, 0x99, 0xa2, 0x9b, 0xaf, 0xab, 0x30, 0xa3, 0x77, 0x56, 0x13, 0xa2,
+	0x89, 0x05, 0xa1, 0x9a, 0x9d, 0x98, 0xa3, 0x78, 0xa3, 0x77, 0xfe, 0x18, 0x4e, 0x9e, 0x19, 0xa3,
+	0x68, 0x7a, 0xa0, 0xa9, 0x16, 0xc0, 0x69, 0x9f, 0xba, 0x59, 0xc0, 0x59, 0xc0, 0x45, 0x76, 0x55,
+	0x7a, 0xe0, 0x66, 0x60, 0x9e, 0xc8, 0xfe, 0xed, 0x3b, 0xfe, 0x67, 0x52, 0xae, 0x78, 0x81, 0xaa,
+	0x5b, 0xa5, 0x87, 0x9b, 0x89, 0x0e, 0x68, 0x9d, 0x9a, 0x9c, 0x8a, 0xe0, 0x55, 0xa8, 0x76, 0x9a,
+	0x9a, 0xc0, 0xe0, 0xc0, 0x7f, 0x35, 0x68, 0x35, 0x56, 0xe0, 0xa3, 0x88, 0x99, 0x89, 0x3c, 0xa2,
+	0x77, 0x3f, 0xa2, 0x89, 0x9c, 0x88, 0xaa, 0x86, 0x94, 0x9a, 0x9d, 0x9b, 0x19, 0x07, 0x38, 0x2a,
+	0x7f, 0xe0, 0x38, 0xa7, 0x97, 0xc0, 0x9d, 0x8a, 0x9b, 0x88, 0xb1, 0x98, 0xbd, 0x00, 0x92, 0x89,
+	0xc0, 0xa9, 0x87, 0x3c, 0xa6, 0x89, 0x15, 0x7f, 0x35, 0x0b, 0x31, 0xc0, 0xe0, 0x2a, 0x5a, 0x65,
+	0xa3, 0x89, 0x7f, 0x23, 0xc0, 0xa5, 0x88, 0x2a, 0xe0, 0xa3, 0x99, 0x9d, 0x88, 0x2a, 0x1c, 0x2a,
+	0x1c, 0x62, 0x1c, 0x5a, 0xa2, 0x88, 0x2e, 0x23, 0xae, 0x76, 0x98, 0x88, 0xa2, 0x9a, 0xa2, 0x87,
+	0x59, 0xab, 0x76, 0x97, 0x99, 0xa9, 0x89, 0x93, 0xab, 0xaa, 0x75, 0xa9, 0xaa, 0x6e, 0xa5, 0x97,
+	0xad, 0xac, 0xa6, 0x98, 0x1a, 0x9b, 0x88, 0xa3, 0x89, 0x0c, 0xc0, 0x7f, 0x9b, 0x88, 0xa0, 0x8a,
+	0xa2, 0x87, 0x7f, 0x97, 0x28, 0x9c, 0x2a, 0x9f, 0x48, 0xa1, 0x38, 0xa2, 0xa7, 0xa3, 0x89, 0x56,
+	0x6f, 0x9c, 0x78, 0xc0, 0x65, 0xc0, 0x25, 0xc0, 0x61, 0xc1, 0xa2, 0x79, 0x9e, 0x96, 0x9c, 0xa9,
+	0x6e, 0x97, 0xf9, 0xfe, 0x06, 0x22, 0x9d, 0xa9, 0x9a, 0xa8, 0x5e, 0x9a, 0xaa, 0xa2, 0x88, 0x6d,
+	0x7e, 0x42, 0xa7, 0x97, 0x9c, 0x78, 0x38, 0xc0, 0x6e, 0xa4, 0x86, 0x38, 0x69, 0xa1, 0x9a, 0xe0,
+	0x6b, 0x38, 0xa7, 0x87, 0x9d, 0x89, 0xa3, 0x97, 0x1f, 0xa3, 0x98, 0x0d, 0xe0, 0x35, 0x38, 0x3f,
+	0x9d, 0x89, 0xa3, 0x97, 0xa4, 0x87, 0x69, 0x99, 0x9d, 0xe0, 0x20, 0x58, 0x9f, 0xab, 0xa3, 0x97,
+	0x55, 0xa6, 0x97, 0xab, 0x88, 0xa1, 0x8a, 0x98, 0x88, 0xb2, 0x87, 0xbe, 0x00, 0x15, 0xa2, 0x88,
+	0xa2, 0x87, 0x9b, 0x9a, 0x56, 0xa5, 0x87, 0xa2, 0x88, 0x99, 0xa9, 0x2a, 0x23, 0x15, 0x7f, 0x03,
+	0x1c, 0x00, 0xa6, 0x97, 0x15, 0x0e, 0xa2, 0x88, 0xa2, 0x98, 0x0e, 0xe0, 0x15, 0xe0, 0xa2, 0x78,
+	0x00, 0x15, 0xa1, 0xaa, 0x6e, 0xa5, 0x88, 0x15, 0xa1, 0x9a, 0xa3, 0x76, 0xa1, 0x9a, 0x9e, 0x76,
+	0xa9, 0x98, 0x56, 0x9a, 0x98, 0xe0, 0x41, 0xa9, 0x86, 0xa9, 0x75, 0x8e, 0xbe, 0xa6, 0x77, 0xaf,
+	0xaa, 0xa0, 0x9a, 0x9c, 0x88, 0x08, 0x9a, 0x78, 0x9c, 0x98, 0x9c, 0x89, 0x65, 0x5a, 0x08, 0x50,
+	0x67, 0x40, 0x6e, 0x62, 0x0e, 0x5a, 0xa3, 0x99, 0xa2, 0x87, 0xa2, 0x88, 0x56, 0xa4, 0x88, 0xa3,
+	0x69, 0xa5, 0x79, 0xa6, 0x77, 0xa6, 0x58, 0xa4, 0x57, 0xa1, 0x59, 0x9d, 0x58, 0x4f, 0x9d, 0x88,
+	0x66, 0xa0, 0xa8, 0x0a, 0xfe, 0x0b, 0x33, 0xa5, 0x67, 0x90, 0xc9, 0x03, 0xa4, 0x86, 0xc1, 0xe0,
+	0xa3, 0x88, 0xa4, 0x96, 0xa4, 0x79, 0x3c, 0xa2, 0x77, 0x23, 0x9d, 0x89, 0xe0, 0x69, 0xa5, 0x89,
+	0xe0, 0x23, 0x9d, 0x99, 0xc0, 0x55, 0xa4, 0x97, 0x2d, 0x62, 0xa4, 0x76, 0x06, 0xe0, 0x6e, 0x26,
+	0x06, 0x26, 0x7f, 0x51, 0xa6, 0x87, 0xa9, 0x84, 0x9b, 0x9b, 0x40, 0xa0, 0x9a, 0x97, 0x9b, 0x50,
+	0x2d, 0xa7, 0xa9, 0xa3, 0x98, 0x3c, 0xc0, 0xe0, 0x6e, 0xa4, 0x88, 0xba, 0x00, 0x94, 0x78, 0x15,
+	0x6f, 0x15, 0x23, 0xa8, 0x76, 0x35, 0x9c, 0x89, 0x7f, 0xa2, 0x88, 0xa5, 0x88, 0x23, 0x2a, 0x23,
+	0xa5, 0x98, 0x55, 0x1c, 0xa2, 0x88, 0x39, 0x58, 0xe0, 0x65, 0x0e, 0x9b, 0x89, 0x2a, 0xe0, 0xa7,
+	0x88, 0x9a, 0x99, 0x0e, 0x15, 0x04, 0x23, 0xa7, 0x78, 0x7e, 0xc0, 0xa3, 0x87, 0xa2, 0x88, 0xa3,
+	0x84, 0x07, 0xa5, 0x88, 0x40, 0xab, 0x74, 0xa0, 0x9a, 0x32, 0x9d, 0x9a, 0xa5, 0x89, 0xa1, 0xa9,
+	0x97, 0x89, 0x9d, 0x89, 0x55, 0x7a, 0xc0, 0xa6, 0x88, 0xa4, 0x88, 0xa2, 0x97, 0x55, 0x00, 0x0e,
+	0xc0, 0x55, 0x0e, 0x56, 0x1d, 0x52, 0x6d, 0x0b, 0x6e, 0x5d, 0x2f, 0x5a, 0x62, 0xa7, 0x98, 0xab,
+	0x78, 0xa7, 0x58, 0xa6, 0x68, 0xa5, 0x68, 0x99, 0x28, 0x9b, 0xd8, 0xfe, 0x03, 0x11, 0xa6, 0x87,
+	0x9b, 0x9a, 0xe0, 0xa7, 0xa6, 0xa5, 0x86, 0x93, 0x9d, 0xa2, 0x88, 0xab, 0x85, 0xa6, 0x87, 0x22,
+	0x0c, 0x98, 0x9b, 0x9d, 0x9a, 0x52, 0xc0, 0x18, 0x03, 0x18, 0x38, 0xc2, 0x6d, 0xa9, 0x88, 0xa3,
+	0x88, 0x96, 0x9a, 0x69, 0xa2, 0x89, 0x69, 0xc0, 0x0d, 0x11, 0x6e, 0xa5, 0x88, 0x66, 0xa8, 0x86,
+	0x69, 0xa5, 0x88, 0x0a, 0x9b, 0x9a, 0x9b, 0x87, 0xa1, 0x8b, 0xa8, 0x61, 0x7f, 0xa3, 0xac, 0x9c,
+	0x9a, 0xa5, 0x88, 0xa4, 0x98, 0xa2, 0x88, 0xb5, 0x00, 0x31, 0x7f, 0x38, 0xe0, 0xa7, 0x77, 0x9d,
+	0xaa, 0x9a, 0x98, 0x6f, 0xe0, 0x23, 0x31, 0xc1, 0xe0, 0x6e, 0x31, 0x5a, 0xaa, 0x86, 0x55, 0xa3,
+	0x9a, 0xe0, 0x69, 0xa1, 0x9a, 0x56, 0x23, 0xa3, 0x88, 0xa3, 0x88, 0x7f, 0x40, 0x9d, 0xa9, 0x6b,
+	0x56, 0x15, 0x1c, 0xa8, 0x87, 0x9b, 0x88, 0x6e, 0xa5, 0x88, 0x0e, 0x55, 0xa8, 0x87, 0x9a, 0x8a,
+	0xac, 0x75, 0x91, 0xab, 0x0e, 0x1c, 0xb0, 0x87, 0xa6, 0x88, 0x95, 0x9a, 0x91, 0x8b, 0x55, 0xe0,
+	0x65, 0x7f, 0xa2, 0x78, 0xa5, 0x98, 0xa2, 0x87, 0x7f, 0x59, 0x77, 0x15, 0x6b, 0x15, 0x3d, 0xe0,
+	0x2b, 0x55, 0x1d, 0x0b, 0xa3, 0x88, 0x2f, 0x5b, 0x01, 0x15, 0x9e, 0x68, 0x66, 0x9c, 0x87, 0x26,
+	0x9b, 0x9a, 0xab, 0x74, 0xa2, 0x98, 0x94, 0x9c, 0xab, 0x86, 0x62, 0xe0, 0xae, 0x75, 0x30, 0x96,
+	0x9b, 0x9e, 0x69, 0xaf, 0x72, 0x2d, 0x2a, 0x62, 0xe0, 0x55, 0xa4, 0x87, 0x7f, 0xa1, 0x9a, 0x9b,
+	0x87, 0x3c, 0xe0, 0x7e, 0xa9, 0x76, 0x6f, 0x1f, 0x62, 0x38, 0x2a, 0x7f, 0xa6, 0x87, 0xa2, 0x78,
+	0x32, 0x38, 0xad, 0x98, 0xa3, 0x97, 0xa4, 0x88, 0x9c, 0x78, 0x34, 0xa7, 0x87, 0xa0, 0x84, 0xa2,
+	0x77, 0xa1, 0x85, 0xa1, 0x9e, 0x98, 0xad, 0xc0, 0xa2, 0x96, 0x9b, 0x8a, 0xa7, 0x97, 0xbc, 0x00,
+	0x89, 0x8e, 0x55, 0x66, 0xa2, 0x78, 0xac, 0x63, 0x98, 0x9a, 0xa4, 0x99, 0x97, 0x89, 0xa3, 0x99,
+	0xc0, 0x7f, 0xe0, 0x39, 0x0b, 0xaa, 0x75, 0x9a, 0x89, 0xc0, 0x03, 0x9b, 0x9a, 0xa6, 0x75, 0x23,
+	0x0a, 0x20, 0x9c, 0x79, 0x39, 0xe0, 0x62, 0x1c, 0x0e, 0xa6, 0x76, 0x63, 0x99, 0x89, 0x23, 0x40,
+	0xaa, 0x87, 0x15, 0xa3, 0x99, 0x9d, 0x89, 0xe0, 0xa3, 0x99, 0x23, 0x15, 0x7e, 0x27, 0x15, 0xe0,
+	0x6f, 0xa6, 0x76, 0xb0, 0x87, 0x9b, 0x98, 0x98, 0x8a, 0x92, 0x8a, 0x7b, 0xc0, 0x76, 0x5a, 0xa4,
+	0x87, 0xa2, 0x88, 0xa2, 0x89, 0x7e, 0x3d, 0x65, 0x1d, 0xe0, 0xc1, 0x0b, 0x3d, 0x6b, 0x56, 0x59,
+	0x9d, 0x99, 0x12, 0x9f, 0x86, 0xa2, 0x78, 0xc0, 0x9c, 0x99, 0xa3, 0x88, 0xe0, 0xa7, 0x87, 0xa1,
+	0xa9, 0xa5, 0x85, 0x67, 0x9d, 0x99, 0xa7, 0x76, 0xa2, 0x85, 0x53, 0x94, 0x8d, 0x31, 0xa5, 0x75,
+	0x67, 0x9a, 0x99, 0x6b, 0x59, 0xa6, 0x88, 0x07, 0x9d, 0xaa, 0x69, 0x1f, 0x69, 0xc0, 0x9d, 0x89,
+	0x63, 0x1c, 0x26, 0xa5, 0x98, 0x98, 0x9b, 0x11, 0xa1, 0x9a, 0x51, 0xa7, 0x87, 0xaa, 0x96, 0xa7,
+	0xaa, 0x59, 0x9b, 0x99, 0xaa, 0x79, 0xa3, 0x87, 0xa2, 0x75, 0x9a, 0x9a, 0xa9, 0x86, 0x93, 0x99,
+	0xa0, 0x9a, 0xaa, 0x88, 0x96, 0x51, 0xa5, 0x99, 0x52, 0x9f, 0x9c, 0x75, 0xc6, 0x00, 0x8e, 0x7e,
+	0x9d, 0x88, 0x31, 0x23, 0x18, 0xa3, 0x88, 0x26, 0x9b, 0xaa, 0x5e, 0x6f, 0xa2, 0x98, 0x32, 0x31,
+	0xa9, 0x76, 0xa4, 0x78, 0xa2, 0x75, 0x6f, 0x96, 0xbb, 0x9d, 0x99, 0xae, 0x78, 0x98, 0x98, 0x45,
+	0x9a, 0x99, 0xa4, 0x99, 0x31, 0xac, 0x77, 0x95, 0x98, 0xa4, 0x89, 0x9b, 0x89, 0x3f, 0x67, 0x97,
+	0xab, 0x56, 0x1c, 0xa9, 0x86, 0x95, 0x9b, 0xc0, 0x1c, 0x55, 0xa3, 0x99, 0x56, 0xa9, 0x86, 0x26,
+	0x15, 0x9c, 0x78, 0xa3, 0x98, 0xe0, 0x56, 0xa3, 0x86, 0xad, 0x75, 0x55, 0xa1, 0xaa, 0x96, 0x89,
+	0x99, 0xac, 0x08, 0x36, 0x59, 0x6e, 0x6f, 0xa3, 0x99, 0xc0, 0x6f, 0xa2, 0x88, 0x28, 0x9b, 0xa8,
+	0xc0, 0x5a, 0xa2, 0x78, 0x9d, 0x99, 0x6e, 0x64, 0x6e, 0x61, 0x9d, 0x99, 0x7f, 0x23, 0x9d, 0x99,
+	0xac, 0x75, 0x51, 0x9b, 0xab, 0xac, 0x62, 0x0c, 0xa6, 0x97, 0x9c, 0x9a, 0x40, 0x66, 0x99, 0x8c,
+	0x7a, 0xa2, 0x77, 0xa3, 0x98, 0x52, 0x38, 0x56, 0xa6, 0x76, 0xa3, 0x97, 0xa2, 0x78, 0x26, 0xa3,
+	0x88, 0x40, 0xa3, 0x99, 0x54, 0xa2, 0x88, 0xa3, 0xaa, 0x95, 0x9a, 0x51, 0xa9, 0xa8, 0xb0, 0x85,
+	0x8f, 0x9d, 0x99, 0x67, 0xad, 0x99, 0xae, 0x98, 0x9a, 0x77, 0x23, 0xa9, 0x97, 0xa3, 0x99, 0x51,
+	0x42, 0x9d, 0xaa, 0x7a, 0xa2, 0x87, 0xa3, 0x87, 0xa3, 0x86, 0x5c, 0x9b, 0x65, 0xc0, 0x9c, 0x8a,
+	0xab, 0xc7, 0xab, 0xa5, 0xc3, 0x00, 0x15, 0xa2, 0x88, 0x2e, 0x9d, 0x99, 0xa1, 0xa8, 0x03, 0x7a,
+	0x55, 0xa6, 0x88, 0xa2, 0x77, 0x9a, 0x9a, 0x69, 0x7e, 0xaa, 0x64, 0x9e, 0x8b, 0xa8, 0x63, 0x9c,
+	0x8a, 0xa2, 0xa9, 0x91, 0xac, 0x3f, 0x9b, 0x9a, 0x9c, 0x88, 0xa3, 0x9a, 0x1c, 0x6f, 0xa2, 0x86,
+	0x0b, 0x6d, 0xa3, 0x99, 0xa2, 0x77, 0x1f, 0xa1, 0x9a, 0x35, 0x2e, 0xa6, 0x87, 0x9c, 0x98, 0x0a,
+	0x46, 0xc0, 0x7f, 0xa5, 0x86, 0xaa, 0x65, 0x9b, 0xab, 0xe0, 0x32, 0xa2, 0x88, 0x99, 0xaa, 0x1c,
+	0x04, 0x03, 0xa6, 0x87, 0xa4, 0x77, 0x9f, 0x86, 0x6b, 0x53, 0x8f, 0xac, 0x73, 0xe0, 0x27, 0x55,
+	0x6f, 0xc0, 0xa2, 0x88, 0xc1, 0x13, 0x6e, 0xa2, 0x86, 0xa3, 0x98, 0x9a, 0x88, 0x31, 0xa4, 0x66,
+	0xe0, 0x1c, 0xe0, 0x51, 0x20, 0x3b, 0x9d, 0x98, 0xa1, 0x9a, 0x55, 0x6d, 0xaa, 0x85, 0x30, 0x9d,
+	0xab, 0x95, 0x8b, 0x6c, 0xab, 0x95, 0x9b, 0x8c, 0xa2, 0x88, 0x77, 0x95, 0x7a, 0xa2, 0x87, 0xa2,
+	0x78, 0x1f, 0x64, 0xa6, 0x88, 0x9c, 0x76, 0xa4, 0x8a, 0x9d, 0x99, 0x9c, 0x9a, 0xa6, 0x76, 0x0e,
+	0x9c, 0x99, 0xa8, 0x86, 0xa5, 0x88, 0xa5, 0xa8, 0x42, 0xc0, 0x55, 0xa4, 0x98, 0xa3, 0x87, 0x9f,
+	0x86, 0x9d, 0x89, 0xc0, 0xa2, 0x89, 0xc0, 0x64, 0x62, 0x59, 0x65, 0xa2, 0x62, 0x9e, 0x69, 0x9a,
+	0x9b, 0xab, 0x95, 0xa8, 0x84, 0xa5, 0xad, 0x9a, 0x8a, 0xca, 0x00, 0xfe, 0xa1, 0x08, 0xa2, 0x99,
+	0x55, 0xc0, 0xa4, 0x77, 0xa3, 0x87, 0x15, 0x9d, 0xaa, 0x1c, 0x9c, 0x88, 0x15, 0xa2, 0x88, 0xad,
+	0x63, 0xe0, 0x15, 0xa7, 0x87, 0xa7, 0x76, 0x9d, 0x99, 0x9c, 0x9b, 0xa6, 0x74, 0x6b, 0x7b, 0x93,
+	0xab, 0x5d, 0xa1, 0x8a, 0xa2, 0x98, 0x9a, 0x99, 0xab, 0x76, 0x62, 0x0b, 0xa5, 0x88, 0x03, 0x20,
+	0x99, 0x9a, 0xa2, 0x66, 0xad, 0x96, 0x9b, 0x89, 0x2a, 0x15, 0x1c, 0x0a, 0x65, 0xa9, 0x67, 0x9d,
+	0xbb, 0x0a, 0x07, 0x66, 0xc0, 0x9d, 0x89, 0xa6, 0x87, 0xae, 0x76, 0x9c, 0x88, 0x68, 0xa6, 0x88,
+	0xa0, 0x53, 0xa5, 0x9b, 0x93, 0xab, 0x9a, 0xa9, 0x94, 0x9c, 0x6f, 0x38, 0x12, 0x66, 0xa2, 0x88,
+	0x54, 0x1c, 0x0e, 0x15, 0xa0, 0x75, 0xe0, 0x51, 0xa5, 0x88, 0x9d, 0x99, 0xa6, 0x88, 0x9a, 0x98,
+	0xa2, 0x87, 0xa7, 0x87, 0xa6, 0x86, 0x3a, 0x9d, 0x8a, 0x9c, 0x8a, 0xac, 0x95, 0xa1, 0x65, 0xa0,
+	0xaa, 0x96, 0x7b, 0x61, 0xab, 0x85, 0x9a, 0x9a, 0x51, 0xa7, 0x87, 0x3a, 0x42, 0x56, 0x62, 0xa5,
+	0x89, 0x02, 0x50, 0x9b, 0x9b, 0xaa, 0x76, 0xe0, 0x77, 0xa4, 0x88, 0x34, 0xa5, 0x99, 0x3e, 0x6b,
+	0xa5, 0x99, 0xc0, 0x9c, 0x99, 0x56, 0xb0, 0x87, 0x65, 0x94, 0x7a, 0x9b, 0x88, 0xa7, 0x87, 0x3e,
+	0x6f, 0x9f, 0x9b, 0xa7, 0x9a, 0x7f, 0x94, 0x77, 0xa5, 0x98, 0x9e, 0x86, 0xb1, 0x87, 0x94, 0x88,
+	0xa3, 0x99, 0xa2, 0x88, 0x2b, 0xc4, 0x00, 0x18, 0xa0, 0x9a, 0x9c, 0x99, 0xa2, 0x66, 0xaa, 0x76,
+	0xa3, 0x76, 0x1b, 0x9c, 0xab, 0x0a, 0x67, 0xac, 0x76, 0x9e, 0x66, 0xa3, 0x88, 0x65, 0x9b, 0xab,
+	0x9b, 0x8a, 0xa6, 0x76, 0xa4, 0x87, 0x66, 0x14, 0x73, 0x9a, 0x99, 0x15, 0xa2, 0x77, 0x9b, 0xaa,
+	0xa7, 0x76, 0x15, 0x1f, 0x52, 0x9d, 0x99, 0xa5, 0x77, 0xa4, 0x86, 0xa1, 0xaa, 0x1c, 0xa2, 0x88,
+	0x26, 0x9c, 0x97, 0xe0, 0xc0, 0x0a, 0x9d, 0x9a, 0x19, 0xa4, 0x76, 0x6b, 0x9b, 0x99, 0x2a, 0xa3,
+	0x78, 0x0e, 0xa7, 0x89, 0x2e, 0xa5, 0x87, 0x6e, 0xac, 0x96, 0x9d, 0x77, 0x6f, 0x9d, 0x88, 0x67,
+	0x3b, 0x7e, 0x8f, 0xad, 0x00, 0xc0, 0xa2, 0x87, 0x56, 0xa2, 0x77, 0x7a, 0x6e, 0x45, 0xa2, 0xa9,
+	0x9d, 0x88, 0x62, 0xe0, 0x18, 0xa5, 0x87, 0xa3, 0x88, 0xa4, 0x87, 0xa6, 0x95, 0x9a, 0x68, 0x38,
+	0xa3, 0x88, 0x38, 0x6d, 0xc1, 0x77, 0xa8, 0x74, 0x9c, 0x89, 0xa2, 0x88, 0x67, 0x02, 0x23, 0x51,
+	0x62, 0x56, 0xa3, 0x88, 0xa5, 0x98, 0xa3, 0x98, 0x03, 0xb2, 0x87, 0xa6, 0x98, 0x97, 0x76, 0x9b,
+	0xac, 0xa5, 0x85, 0x9d, 0x88, 0x01, 0xaa, 0x8a, 0x9a, 0x99, 0x66, 0xa7, 0x9a, 0x59, 0x9d, 0x87,
+	0x7a, 0x5b, 0x9a, 0x87, 0xac, 0x89, 0x69, 0x9a, 0x97, 0xa0, 0x7b, 0x97, 0x9a, 0x99, 0x9a, 0xa8,
+	0x88, 0xa4, 0x77, 0x98, 0xa9, 0x1c, 0x7f, 0xc0, 0x69, 0x9b, 0x99, 0xd1, 0x00, 0x97, 0x56, 0x7b,
+	0x55, 0x67, 0xac, 0x65, 0x07, 0xac, 0x41, 0x9b, 0x9a, 0x31, 0xa3, 0x78, 0x9c, 0x98, 0xab, 0x88,
+	0xa0, 0x74, 0xa9, 0x77, 0x9a, 0x98, 0x9b, 0x9c, 0xc0, 0x9b, 0xab, 0xa6, 0x66, 0xa9, 0x83, 0x99,
+	0xad, 0xa4, 0x77, 0x93, 0xac, 0xa7, 0x98, 0x2a, 0xa9, 0x87, 0x99, 0x99, 0xa4, 0x8a, 0xa1, 0x85,
+	0x39, 0x9b, 0x88, 0xa7, 0x87, 0xa2, 0x86, 0x99, 0xac, 0x99, 0x8a, 0x32, 0x6d, 0x99, 0xab, 0x00,
+	0xa7, 0x86, 0xc0, 0x96, 0x9c, 0x00, 0xaa, 0x98, 0xa2, 0x78, 0x07, 0x2e, 0xa3, 0x89, 0x50, 0x07,
+	0xae, 0x75, 0x94, 0x8b, 0xa9, 0x85, 0x51, 0x35, 0xa7, 0x87, 0x9c, 0x78, 0x2a, 0x96, 0x99, 0xa5,
+	0x99, 0xa2, 0x89, 0x95, 0x99, 0x51, 0x52, 0x59, 0x35, 0x15, 0xa5, 0x87, 0x99, 0xa9, 0xe0, 0xc0,
+	0x35, 0xa4, 0x76, 0xa9, 0x96, 0x9c, 0x88, 0xa1, 0x9a, 0x9b, 0x89, 0x9c, 0x89, 0x6f, 0xa2, 0x86,
+	0x9d, 0x8a, 0x9d, 0xa9, 0xa3, 0x89, 0x3f, 0xa6, 0x86, 0xa2, 0x97, 0x06, 0x59, 0xc0, 0x1c, 0x06,
+	0x27, 0xa7, 0x98, 0x9a, 0x99, 0xaa, 0x85, 0x31, 0xa8, 0x88, 0x9d, 0x98, 0xa5, 0x88, 0x60, 0x59,
+	0xa2, 0x99, 0x68, 0xa6, 0x8a, 0x6f, 0x9a, 0x75, 0xa2, 0x76, 0x7f, 0x6c, 0xa2, 0x99, 0x99, 0x9d,
+	0x69, 0xa2, 0x64, 0xa2, 0xac, 0x9b, 0x9c, 0x9e, 0x86, 0x55, 0x98, 0x8b, 0x9b, 0x89, 0xaa, 0x99,
+	0x27, 0xa3, 0xa9, 0xa6, 0x87, 0x7f, 0x9c, 0x77, 0xa8, 0x99, 0x9d, 0x87, 0xa8, 0x86, 0xca, 0x00,
+	0x8e, 0x59, 0x51, 0xa3, 0x98, 0xa3, 0x77, 0x62, 0x65, 0xaa, 0x65, 0x51, 0xa3, 0x79, 0x97, 0xac,
+	0x9c, 0xaa, 0x51, 0xae, 0x65, 0x9e, 0x76, 0xa1, 0xab, 0x93, 0xac, 0xab, 0x75, 0x58, 0x0d, 0x41,
+	0x9a, 0xbc, 0xac, 0x52, 0xa8, 0x85, 0x93, 0xad, 0x27, 0x00, 0x66, 0x52, 0x7a, 0x51, 0x2a, 0x6e,
+	0xa7, 0x77, 0x98, 0x99, 0x3c, 0x0e, 0x1c, 0xc0, 0xa8, 0x67, 0x60, 0xa2, 0x75, 0x07, 0x9b, 0x9a,
+	0xaa, 0x87, 0x54, 0xa4, 0x66, 0x1c, 0xa6, 0x66, 0xa6, 0x88, 0x9a, 0x9a, 0xa5, 0x97, 0x3c, 0xa9,
+	0x76, 0x7a, 0xa2, 0x89, 0x9a, 0x87, 0x53, 0x64, 0x56, 0x26, 0x6f, 0x69, 0x31, 0x51, 0x0e, 0x9d,
+	0x88, 0xa2, 0x99, 0x51, 0x9d, 0x9a, 0xa2, 0x86, 0x22, 0xa3, 0xba, 0xa3, 0x97, 0xa2, 0x77, 0x9d,
+	0x8a, 0x9a, 0x78, 0xc1, 0x77, 0x18, 0x66, 0x09, 0xa7, 0x9a, 0x98, 0x76, 0x50, 0xa6, 0x75, 0x34,
+	0x62, 0xa9, 0x99, 0xa2, 0x89, 0xa4, 0x88, 0x23, 0xa2, 0x98, 0xa3, 0x87, 0xa4, 0x85, 0x9f, 0x83,
+	0x9f, 0xac, 0xa0, 0x7a, 0x09, 0x9e, 0x76, 0x9f, 0x8c, 0xa2, 0x99, 0x12, 0x9d, 0x88, 0x69, 0xa9,
+	0x87, 0x9d, 0x97, 0xa7, 0x87, 0xa4, 0x85, 0x9c, 0x76, 0x94, 0x8d, 0xa2, 0x75, 0x9d, 0x8b, 0x95,
+	0xae, 0xa7, 0xbb, 0xa3, 0x78, 0xa5, 0x89, 0x93, 0x86, 0x7e, 0x9d, 0x99, 0xa2, 0x89, 0xa6, 0x86,
+	0xa2, 0x97, 0xaa, 0x87, 0x55, 0x9c, 0x88, 0x5a, 0x9e, 0x75, 0xd8, 0x00, 0x92, 0x6c, 0xa2, 0x98,
+	0xc0, 0x66, 0x42, 0xa3, 0x96, 0xa2, 0x78, 0xa2, 0x99, 0x54, 0x6b, 0x03, 0xa7, 0x86, 0xa8, 0x64,
+	0x67, 0x96, 0x9e, 0x9b, 0xb9, 0xa7, 0x87, 0x6d, 0x9b, 0x8a, 0xa8, 0x77, 0x95, 0xab, 0xa5, 0x76,
+	0xa9, 0x84, 0x9c, 0xbd, 0x45, 0x98, 0xac, 0x58, 0xa3, 0x9a, 0x99, 0x99, 0x7b, 0xa3, 0x87, 0x6e,
+	0x4d, 0xa4, 0x99, 0x97, 0xa9, 0xa5, 0x8a, 0xa3, 0x86, 0xe0, 0xa7, 0x76, 0x9a, 0x9a, 0xa3, 0x76,
+	0x66, 0xa0, 0x8a, 0xa2, 0x97, 0xa8, 0x78, 0x60, 0x95, 0x9a, 0xa8, 0x77, 0x9d, 0x88, 0xa7, 0x99,
+	0x9c, 0x88, 0x98, 0x99, 0x6f, 0x69, 0xa3, 0x89, 0x35, 0x9d, 0x89, 0x35, 0x56, 0x0e, 0x9c, 0x98,
+	0x35, 0x14, 0x0a, 0x6b, 0x55, 0x0a, 0xa2, 0x88, 0x9c, 0x89, 0x31, 0xac, 0x83, 0xa2, 0x99, 0xa3,
+	0x78, 0x97, 0x89, 0x9b, 0x7a, 0x7a, 0xc0, 0x06, 0x69, 0x9d, 0x8a, 0xa4, 0x87, 0xa8, 0x94, 0xa1,
+	0x8c, 0x5a, 0x97, 0x9a, 0xab, 0x97, 0x6e, 0xa5, 0xa9, 0xa4, 0x87, 0x5c, 0xa0, 0x71, 0x9e, 0x9f,
+	0xa2, 0x9a, 0x97, 0x89, 0x6e, 0xa4, 0x85, 0xa0, 0x74, 0xa7, 0x76, 0xfe, 0x06, 0x53, 0xaa, 0x96,
+	0xa2, 0x85, 0x95, 0x89, 0xa0, 0x9b, 0xa6, 0x8a, 0xa1, 0x95, 0xa5, 0x8a, 0x2b, 0x9a, 0x76, 0xa2,
+	0x88, 0xa0, 0x85, 0x9c, 0x7a, 0x9b, 0x9c, 0x9f, 0x8b, 0x98, 0x9b, 0xa3, 0x9b, 0x9d, 0x97, 0xa8,
+	0x89, 0x9c, 0x89, 0xa4, 0x88, 0xa6, 0x96, 0x50, 0xa7, 0x83, 0x9c, 0x77, 0x6b, 0xa4, 0x88, 0xa3,
+	0x88, 0x69, 0x9c, 0x99, 0xd2, 0x00, 0x8d, 0x8f, 0xa2, 0x78, 0x54, 0xa2, 0x87, 0x6f, 0x34, 0xa3,
+	0x88, 0x9d, 0x98, 0x7f, 0x34, 0xa2, 0x87, 0x9d, 0x8a, 0x6f, 0xa6, 0x97, 0x99, 0x9c, 0x9c, 0x86,
+	0xa9, 0x88, 0x56, 0x97, 0xbc, 0x48, 0xaa, 0x88, 0xa0, 0x75, 0xa3, 0x99, 0x96, 0xab, 0x32, 0x2a,
+	0xa2, 0x87, 0x55, 0xa9, 0x89, 0x95, 0x99, 0xa6, 0x87, 0x35, 0x6f, 0xa9, 0x75, 0x0e, 0x55, 0xaa,
+	0x88, 0x9c, 0x87, 0x7f, 0x96, 0x89, 0xa9, 0x76, 0x68, 0xa2, 0x9c, 0x07, 0x39, 0xa8, 0x77, 0x0a,
+	0xa2, 0x78, 0x27, 0xa3, 0x77, 0x2a, 0x9d, 0x88, 0x23, 0x6e, 0x7f, 0x15, 0xa2, 0x98, 0x2a, 0x1c,
+	0x15, 0x65, 0xc0, 0xa1, 0x9a, 0xc0, 0xa2, 0x86, 0x56, 0x66, 0xa7, 0x87, 0x35, 0xa2, 0x97, 0xaa,
+	0x75, 0x9a, 0x89, 0x6f, 0xa5, 0x8a, 0x94, 0x88, 0xa2, 0x88, 0xa8, 0xa8, 0xa7, 0x87, 0xa2, 0x99,
+	0x9e, 0x68, 0x7b, 0xa8, 0x86, 0x99, 0x87, 0x31, 0x7e, 0x9a, 0x89, 0x96, 0x8a, 0xa8, 0x75, 0xae,
+	0x71, 0xa3, 0x88, 0x9b, 0x64, 0x9d, 0xbf, 0x9d, 0xaa, 0xa2, 0x74, 0x9a, 0x8a, 0xa2, 0x75, 0xa2,
+	0x97, 0xb2, 0x85, 0x9b, 0xa9, 0xa7, 0x9a, 0x97, 0x86, 0xa7, 0x9c, 0x99, 0x9b, 0x99, 0x77, 0x9d,
+	0x8b, 0x9a, 0x89, 0x9a, 0x8b, 0x5c, 0x71, 0xa6, 0x99, 0x44, 0xa5, 0x87, 0xa4, 0x96, 0xa5, 0x9b,
+	0x98, 0x9d, 0x56, 0xa9, 0x98, 0x9d, 0x87, 0xa8, 0x9a, 0x96, 0x73, 0x9e, 0x8b, 0x9c, 0x87, 0x5a,
+	0x6b, 0x99, 0x99, 0xa6, 0x62, 0x9e, 0x9c, 0x53, 0xc4, 0x00, 0x94, 0x8b, 0x52, 0xc0, 0xa2, 0x88,
+	0xa3, 0x76, 0x67, 0xa2, 0x87, 0x7a, 0x41, 0x2d, 0x34, 0x09, 0x55, 0xa6, 0x74, 0x52, 0xa4, 0x76,
+	0xc0, 0xa1, 0x8b, 0x9b, 0x9a, 0xa0, 0xa9, 0x9a, 0x8a, 0xa9, 0x87, 0x97, 0xac, 0xa6, 0x65, 0x9c,
+	0x98, 0x99, 0xac, 0xa6, 0x77, 0x27, 0x9c, 0x88, 0xa4, 0x87, 0x9d, 0x8a, 0x51, 0x52, 0x06, 0x15,
+	0x77, 0x07, 0xc0, 0x35, 0x6b, 0x54, 0xa4, 0x77, 0x35, 0x1c, 0x15, 0xaa, 0x88, 0x9b, 0x87, 0x66,
+	0x1c, 0x3c, 0x7f, 0xc0, 0x35, 0x5a, 0x3c, 0x23, 0x65, 0x03, 0x0a, 0x35, 0xe0, 0xa4, 0x88, 0x55,
+	0x69, 0xaf, 0x61, 0x99, 0xae, 0xa4, 0x86, 0xa1, 0xaa, 0x3f, 0x1e, 0x1b, 0xa6, 0x9a, 0x51, 0xa8,
+	0x78, 0x9b, 0x99, 0xa2, 0x87, 0xad, 0x99, 0x9c, 0x84, 0x7d, 0xa0, 0x8c, 0x5f, 0x99, 0xa9, 0xaa,
+	0x88, 0x9f, 0xab, 0x58, 0x98, 0x76, 0xa1, 0x70, 0xa3, 0x8b, 0x6d, 0xa2, 0x9a, 0xa3, 0x95, 0xa1,
+	0xbe, 0xae, 0x96, 0xa0, 0x73, 0x87, 0x7a, 0xa3, 0x99, 0x6f, 0xa3, 0x89, 0x78, 0xa4, 0x88, 0x9d,
+	0x75, 0xad, 0xba, 0x66, 0x2c, 0xa5, 0x8b, 0x52, 0x90, 0x8e, 0xa4, 0x86, 0x6f, 0x94, 0x78, 0xa2,
+	0x97, 0x67, 0x9c, 0x88, 0x9f, 0x75, 0x98, 0x7d, 0xa3, 0xa8, 0xb0, 0x76, 0x91, 0x97, 0xb1, 0x9b,
+	0x98, 0x96, 0x98, 0x7c, 0x9b, 0x9a, 0xa7, 0x76, 0x6d, 0x52, 0x79, 0x57, 0x9c, 0x8a, 0xd1, 0x00,
+	0x99, 0x9b, 0x38, 0x52, 0xc0, 0x6e, 0xa4, 0x65, 0x73, 0xa2, 0x89, 0x2a, 0x6d, 0x38, 0x7e, 0xa3,
+	0x76, 0x5a, 0xa2, 0x97, 0x9d, 0x89, 0xa0, 0x9b, 0x58, 0xa7, 0x84, 0x53, 0x9d, 0x9d, 0xa2, 0x86,
+	0x9b, 0xac, 0x5d, 0xa9, 0x96, 0x99, 0xab, 0x97, 0x9b, 0x0e, 0x15, 0x18, 0x9c, 0x9a, 0x55, 0x56,
+	0xa9, 0x76, 0x9b, 0xba, 0x59, 0xa3, 0x99, 0xe0, 0x61, 0x9a, 0x89, 0x31, 0xaa, 0x63, 0x9c, 0x8b,
+	0x9c, 0x99, 0xa4, 0x88, 0x26, 0x15, 0x3f, 0x3c, 0x15, 0x66, 0x15, 0x6e, 0x26, 0x23, 0x1c, 0x66,
+	0xa3, 0x86, 0x0e, 0x14, 0xab, 0x73, 0x44, 0x22, 0x9d, 0xab, 0xfe, 0xa0, 0x42, 0xfe, 0xc4, 0x31,
+	0x65, 0xa5, 0x89, 0x9b, 0x99, 0xa7, 0x88, 0xa8, 0x99, 0xa6, 0x89, 0x7f, 0x9a, 0x87, 0x28, 0x50,
+	0xa6, 0x88, 0x9c, 0x88, 0xa4, 0x97, 0x0e, 0x99, 0x9a, 0xa7, 0xa8, 0x69, 0x9b, 0x98, 0xa4, 0x66,
+	0xa2, 0x67, 0xa9, 0x97, 0x95, 0x9a, 0xad, 0x99, 0x98, 0x78, 0xa8, 0x91, 0xa1, 0xa7, 0xa8, 0x87,
+	0x9b, 0x98, 0x9b, 0x9e, 0x98, 0x6a, 0x9f, 0x83, 0xa4, 0x8c, 0x9e, 0x84, 0xa3, 0x7a, 0x9c, 0x96,
+	0xa2, 0x87, 0x9f, 0xcb, 0xab, 0x86, 0xa3, 0x8c, 0x9a, 0x86, 0xa3, 0x9a, 0x9a, 0x77, 0x9b, 0x8a,
+	0x57, 0x49, 0x98, 0x8b, 0xa3, 0xaa, 0x9d, 0x75, 0x9d, 0x8a, 0x7b, 0x72, 0xaf, 0xb6, 0xae, 0xa5,
+	0xa5, 0x66, 0x85, 0x6e, 0x99, 0x8d, 0xa7, 0x88, 0x9d, 0x86, 0xa4, 0x89, 0x9b, 0x98, 0xa4, 0x86,
+	0x55, 0xdc, 0x00, 0xfe, 0xa1, 0x10, 0xa4, 0x87, 0x45, 0xa2, 0x98, 0x3c, 0xa4, 0x76, 0xa4, 0x99,
+	0x20, 0xa2, 0x77, 0x60, 0x9d, 0x78, 0xa0, 0x9a, 0x51, 0x5a, 0xa4, 0x85, 0xa2, 0x77, 0x9d, 0x9a,
+	0x7f, 0x25, 0xa2, 0x87, 0x51, 0x05, 0x25, 0xa3, 0x86, 0xa5, 0x99, 0x98, 0x9c, 0x66, 0x66, 0x9a,
+	0x8a, 0x6e, 0x9d, 0x99, 0xa4, 0x78, 0x23, 0xa4, 0x87, 0x31, 0xa8, 0x66, 0x15, 0xae, 0x87, 0x15,
+	0x23, 0x65, 0xac, 0x41, 0x34, 0x9f, 0x9b, 0x9c, 0x99, 0x6f, 0x9c, 0x88, 0x7d, 0x26, 0xa2, 0x87,
+	0x9c, 0x89, 0x63, 0x15, 0x6e, 0x61, 0xc0, 0x5e, 0xaa, 0x84, 0x66, 0x9b, 0x8b, 0x05, 0x3a, 0xa1,
+	0xab, 0xa3, 0xa9, 0x41, 0xac, 0x9b, 0x9c, 0x75, 0xa1, 0x8a, 0x75, 0xa4, 0x88, 0x9c, 0x8a, 0x99,
+	0x9a, 0xa6, 0x87, 0xa4, 0x88, 0x1d, 0xac, 0x88, 0x99, 0x87, 0x95, 0x97, 0xa0, 0x63, 0xa4, 0x57,
+	0x9e, 0xce, 0x99, 0x9a, 0xa3, 0x51, 0xa3, 0x89, 0x9a, 0xab, 0xa9, 0xaa, 0xa7, 0x88, 0x97, 0x89,
+	0x06, 0xab, 0x86, 0xa4, 0xa4, 0xa8, 0x99, 0x96, 0x69, 0x9d, 0x77, 0x97, 0x98, 0xa0, 0x85, 0xc0,
+	0xfe, 0xea, 0x83, 0xfe, 0xa0, 0x73, 0xb1, 0xb8, 0xa5, 0x76, 0x96, 0x89, 0x93, 0x8b, 0x9f, 0xad,
+	0xa5, 0x85, 0xa6, 0x87, 0x97, 0x88, 0xa7, 0x9a, 0x96, 0x7a, 0xa2, 0x8b, 0xa5, 0x85, 0xa8, 0xac,
+	0xa6, 0x95, 0x9a, 0x86, 0x9c, 0x88, 0xa5, 0x96, 0xa8, 0x8a, 0x9d, 0xa7, 0x5d, 0x9b, 0x79, 0x90,
+	0x7d, 0x9c, 0x8e, 0x9d, 0x89, 0xac, 0x98, 0x9a, 0x67, 0x98, 0xa8, 0xaf, 0x84, 0xac, 0x97, 0xd6,
+	0x00, 0xfe, 0x82, 0x10, 0x7d, 0xa7, 0x88, 0x55, 0x9d, 0x9a, 0xa3, 0x88, 0x7b, 0x9a, 0x77, 0xa6,
+	0x98, 0x27, 0x3f, 0x2e, 0xa3, 0x97, 0x52, 0x55, 0x02, 0x6b, 0x79, 0xa4, 0x78, 0x40, 0xa3, 0x88,
+	0x34, 0x59, 0x37, 0xa2, 0x87, 0x55, 0x1e, 0x63, 0x3f, 0xa2, 0x78, 0xa3, 0x76, 0x9a, 0xa9, 0x9f,
+	0x8b, 0x52, 0xa2, 0x98, 0x27, 0x3c, 0xa4, 0x88, 0x9d, 0x9a, 0x9c, 0x88, 0xe0, 0xa5, 0x76, 0x2a,
+	0x68, 0x57, 0x65, 0xa6, 0x77, 0x0a, 0x1b, 0x35, 0xa7, 0x77, 0x07, 0xe0, 0x31, 0xa8, 0x88, 0x35,
+	0xa3, 0x77, 0xa2, 0x86, 0xa3, 0x99, 0xa7, 0xa8, 0xa8, 0x89, 0x7f, 0xa1, 0x9b, 0xa6, 0x86, 0x6d,
+	0x43, 0xa9, 0x97, 0x8e, 0x8a, 0xa3, 0x73, 0x9f, 0xab, 0x98, 0x9d, 0x97, 0x88, 0xb4, 0x99, 0x9c,
+	0x87, 0xa1, 0xa8, 0xa1, 0x54, 0xaa, 0x76, 0x93, 0xba, 0xa1, 0x55, 0x94, 0x9b, 0xa4, 0xaa, 0xa1,
+	0x56, 0xa6, 0x71, 0xb0, 0xa6, 0xa4, 0xbd, 0xfe, 0xab, 0x7b, 0x98, 0x8b, 0xa5, 0x97, 0x7a, 0x99,
+	0x7a, 0xa8, 0x99, 0x9e, 0x85, 0x7e, 0xa7, 0x83, 0x9d, 0x8b, 0xa8, 0x76, 0x9b, 0x73, 0x94, 0x8c,
+	0xbb, 0xb1, 0xa3, 0xad, 0x95, 0x88, 0xa5, 0xa6, 0x42, 0x7d, 0xa4, 0x99, 0xa4, 0x98, 0x9e, 0x56,
+	0x36, 0x9b, 0x8b, 0xaa, 0x9c, 0xa0, 0x85, 0x99, 0x74, 0xa3, 0x9c, 0xa1, 0x9b, 0xa4, 0x94, 0x9d,
+	0x77, 0xa3, 0x97, 0xa0, 0x8b, 0x97, 0x8a, 0xa0, 0x7c, 0x96, 0x99, 0x9c, 0x7a, 0xa6, 0x95, 0xa2,
+	0x78, 0x60, 0xa9, 0x77, 0x7b, 0xa5, 0x97, 0x00,
+};
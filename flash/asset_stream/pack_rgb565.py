@@ -0,0 +1,143 @@
+#!/usr/bin/env python3
+
+# Packs an RGB565 image into the format rgb565_codec.h describes, as a C array
+# to stream out of flash with asset_stream.h.
+#
+# usage: python3 pack_rgb565.py <image.png> [name]
+#        python3 pack_rgb565.py <image_rgb565.h> <width> <height> [name]
+#
+# The second form reads back an existing header of raw RGB565 bytes, low byte
+# first, such as pio/st7789_lcd/raspberry_256x256_rgb565.h. Reading a PNG
+# depends on the Pillow library
+# `python3 -m pip install --upgrade Pillow`
+
+import re
+import struct
+import sys
+from pathlib import Path
+
+MAX_WIDTH = 320
+
+OP_INDEX = 0x00
+OP_DIFF = 0x40
+OP_LUMA = 0x80
+OP_RUN = 0xc0
+OP_UP = 0xe0
+OP_RAW = 0xfe
+
+MAX_RUN = 32
+MAX_UP = 30
+
+
+def cache_slot(px):
+    return ((px * 0x9e37) & 0xffff) >> 10
+
+
+def fields(px):
+    return px >> 11, (px >> 5) & 63, px & 31
+
+
+def pack_line(line, up, state):
+    out = bytearray()
+    x = 0
+    width = len(line)
+    while x < width:
+        prev = state["prev"]
+        run = 0
+        while x + run < width and run < MAX_RUN and line[x + run] == prev:
+            run += 1
+        up_run = 0
+        if up is not None:
+            while x + up_run < width and up_run < MAX_UP and line[x + up_run] == up[x + up_run]:
+                up_run += 1
+        if run and run >= up_run:
+            out.append(OP_RUN | (run - 1))
+            x += run
+            continue
+        if up_run:
+            out.append(OP_UP | (up_run - 1))
+            state["prev"] = line[x + up_run - 1]
+            x += up_run
+            continue
+
+        px = line[x]
+        slot = cache_slot(px)
+        cache = state["cache"]
+        if cache[slot] == px:
+            out.append(OP_INDEX | slot)
+        else:
+            r, g, b = fields(px)
+            pr, pg, pb = fields(prev)
+            dr, dg, db = r - pr, g - pg, b - pb
+            if -2 <= dr <= 1 and -2 <= dg <= 1 and -2 <= db <= 1:
+                out.append(OP_DIFF | (dr + 2) << 4 | (dg + 2) << 2 | (db + 2))
+            elif -32 <= dg <= 31 and -8 <= dr - (dg >> 1) <= 7 and -8 <= db - (dg >> 1) <= 7:
+                out.append(OP_LUMA | (dg + 32))
+                out.append((dr - (dg >> 1) + 8) << 4 | (db - (dg >> 1) + 8))
+            else:
+                out.append(OP_RAW)
+                out += struct.pack("<H", px)
+            cache[slot] = px
+        state["prev"] = px
+        x += 1
+    return out
+
+
+def pack(pixels, width, height):
+    if width > MAX_WIDTH:
+        raise Exception(f"Images can be at most {MAX_WIDTH} pixels wide")
+    out = bytearray(b"R565")
+    out += struct.pack("<HH", width, height)
+    state = {"prev": 0, "cache": [0] * 64}
+    up = None
+    for y in range(height):
+        line = pixels[y * width:(y + 1) * width]
+        packed = pack_line(line, up, state)
+        out += struct.pack("<H", len(packed))
+        out += packed
+        up = line
+    # XIP streaming moves whole words
+    while len(out) % 4:
+        out.append(0)
+    return out
+
+
+def read_png(path):
+    from PIL import Image
+    im = Image.open(path).convert("RGB")
+    pixels = [(r >> 3) << 11 | (g >> 2) << 5 | (b >> 3) for r, g, b in im.getdata()]
+    return pixels, im.size[0], im.size[1]
+
+
+def read_header(path, width, height):
+    data = bytes(int(v, 16) for v in re.findall(r"0x([0-9a-fA-F]{2})", Path(path).read_text()))
+    if len(data) != width * height * 2:
+        raise Exception(f"Found {len(data)} bytes, not {width * height * 2}")
+    return list(struct.unpack(f"<{width * height}H", data)), width, height
+
+
+if len(sys.argv) < 2:
+    print("No image path provided.")
+    sys.exit()
+
+path = sys.argv[1]
+if path.endswith(".h"):
+    if len(sys.argv) < 4:
+        print("The width and height of a header must be given.")
+        sys.exit()
+    pixels, width, height = read_header(path, int(sys.argv[2]), int(sys.argv[3]))
+    name_arg = 4
+else:
+    pixels, width, height = read_png(path)
+    name_arg = 2
+
+name = sys.argv[name_arg] if len(sys.argv) > name_arg else Path(path).stem.replace("_rgb565", "") + "_packed"
+packed = pack(pixels, width, height)
+
+with open(f"{name}.h", "wt") as file:
+    file.write(f"// Packed by pack_rgb565.py from {Path(path).name}: {width}x{height}, "
+               f"{width * height * 2} bytes of RGB565 in {len(packed)}\n")
+    file.write(f"static const uint8_t __attribute__((aligned(4))) {name}[] = {{\n")
+    for i in range(0, len(packed), 16):
+        file.write("\t" + ", ".join(f"{b:#04x}" for b in packed[i:i + 16]) + ",\n")
+    file.write("};\n")
@@ -0,0 +1,2426 @@
+// Packed by pack_rgb565.py from raspberry_256x256_rgb565.h: 256x256, 131072 bytes of RGB565 in 38756
+static const uint8_t __attribute__((aligned(4))) raspberry_256x256_packed[] = {
+	0x52, 0x35, 0x36, 0x35, 0x00, 0x01, 0x00, 0x01, 0x0b, 0x00, 0xfe, 0xff, 0xff, 0xdf, 0xdf, 0xdf,
+	0xdf, 0xdf, 0xdf, 0xdf, 0xde, 0x08, 0x00, 0xdf, 0xdf, 0xdf, 0xdf, 0xdf, 0xdf, 0xdf, 0xdf, 0x08,
+	0x00, 0xdf, 0xdf, 0xdf, 0xdf, 0xdf, 0xdf, 0xdf, 0xdf, 0x08, 0x00, 0xdf, 0xdf, 0xdf, 0xdf, 0xdf,
+	0xdf, 0xdf, 0xdf, 0x08, 0x00, 0xdf, 0xdf, 0xdf, 0xdf, 0xdf, 0xdf, 0xdf, 0xdf, 0x2a, 0x00, 0xdf,
+	0xdf, 0xc6, 0x66, 0x51, 0x55, 0x7b, 0xa2, 0x77, 0xe3, 0x1f, 0x84, 0x88, 0x00, 0xc0, 0xb5, 0x99,
+	0xb8, 0x77, 0xb0, 0x99, 0xfd, 0xdf, 0xd3, 0x26, 0x8e, 0x99, 0x8b, 0x88, 0xc0, 0xad, 0x99, 0x2d,
+	0xe3, 0x66, 0x2d, 0x55, 0x3c, 0x2d, 0xfd, 0xdf, 0xc9, 0x41, 0x00, 0xdf, 0xdf, 0xc4, 0x2d, 0xfe,
+	0xcb, 0x5a, 0x00, 0xc4, 0xfe, 0xb7, 0xbd, 0xaf, 0x88, 0x87, 0x99, 0x00, 0x6f, 0xe0, 0x6e, 0x00,
+	0xc1, 0xbf, 0x99, 0x1f, 0xe0, 0x66, 0x2d, 0x3c, 0x2d, 0xc0, 0xfd, 0xdf, 0xc2, 0x2d, 0xc0, 0x55,
+	0x2d, 0x1f, 0xe0, 0x1f, 0x93, 0x99, 0x00, 0xc1, 0x31, 0x00, 0x19, 0x00, 0xb5, 0x89, 0x1f, 0x97,
+	0x99, 0xfe, 0x45, 0x29, 0x00, 0xc3, 0xa6, 0x88, 0x26, 0xfd, 0xdf, 0xc7, 0x42, 0x00, 0xdf, 0xde,
+	0x66, 0x35, 0x1f, 0x35, 0x1f, 0x94, 0x99, 0x00, 0x7f, 0xe0, 0x07, 0xe0, 0x07, 0xe0, 0x07, 0x00,
+	0xc1, 0x07, 0x00, 0x07, 0x00, 0x07, 0xe0, 0x07, 0x00, 0xc0, 0xaf, 0x99, 0x00, 0xc4, 0x35, 0xfd,
+	0xde, 0x35, 0x00, 0xc7, 0x07, 0xe0, 0x07, 0x00, 0x07, 0x00, 0x07, 0x00, 0xc1, 0x07, 0xe0, 0x07,
+	0xe0, 0x07, 0xe0, 0x07, 0x00, 0xfe, 0x51, 0x8c, 0x26, 0x35, 0x59, 0x35, 0xc0, 0xfd, 0xdf, 0xc1,
+	0x5a, 0x00, 0xdf, 0xdc, 0x2d, 0xfe, 0xa6, 0x31, 0x00, 0xc4, 0x31, 0x00, 0x19, 0x00, 0x31, 0x00,
+	0x19, 0x00, 0x31, 0xe0, 0x19, 0x00, 0x31, 0x00, 0x19, 0x00, 0x31, 0x00, 0x19, 0xe0, 0x31, 0xe0,
+	0x19, 0xe0, 0x31, 0xe0, 0x19, 0x00, 0xb1, 0x99, 0x1f, 0x26, 0x9b, 0x88, 0x66, 0x55, 0x26, 0xfd,
+	0xd0, 0x26, 0x51, 0x3b, 0x6e, 0x26, 0x1f, 0xfe, 0xe7, 0x39, 0x91, 0x99, 0x19, 0xe0, 0x31, 0xe0,
+	0x19, 0xe0, 0x31, 0xe0, 0x19, 0x00, 0x31, 0x00, 0x19, 0x00, 0x31, 0x00, 0x19, 0xe0, 0x31, 0x00,
+	0x19, 0x00, 0x31, 0x00, 0x19, 0x00, 0x31, 0x00, 0xc5, 0x3b, 0xfd, 0xdf, 0x5c, 0x00, 0xdf, 0xdb,
+	0x2d, 0x00, 0x7f, 0xe0, 0x07, 0xe0, 0x07, 0xe0, 0x07, 0x00, 0x07, 0x00, 0x07, 0x00, 0x07, 0x00,
+	0x07, 0x00, 0x07, 0x00, 0x07, 0x00, 0x07, 0x00, 0x07, 0x00, 0x07, 0x00, 0x07, 0x00, 0x07, 0x00,
+	0x07, 0x00, 0x07, 0x00, 0x07, 0x00, 0xc6, 0x3b, 0xfd, 0xcc, 0x9b, 0x99, 0xfe, 0x04, 0x21, 0x00,
+	0xc5, 0x07, 0x00, 0x07, 0x00, 0x07, 0x00, 0x07, 0x00, 0x07, 0x00, 0x07, 0x00, 0x07, 0x00, 0x07,
+	0x00, 0x07, 0x00, 0x07, 0x00, 0x07, 0x00, 0x07, 0x00, 0x07, 0x00, 0x07, 0x00, 0x07, 0xe0, 0x07,
+	0xe0, 0x07, 0xe0, 0x07, 0x00, 0xfe, 0x76, 0xb5, 0xfd, 0xde, 0x76, 0x00, 0xdf, 0xd4, 0x8d, 0x99,
+	0x83, 0x88, 0x91, 0xa9, 0x5a, 0xc1, 0x2e, 0x00, 0x19, 0x00, 0x31, 0x00, 0x19, 0x00, 0x31, 0x00,
+	0x19, 0x00, 0x31, 0x00, 0x19, 0x00, 0x31, 0x00, 0x19, 0x00, 0x31, 0x00, 0x19, 0x00, 0x31, 0x00,
+	0x19, 0x00, 0x31, 0x00, 0x19, 0x00, 0x31, 0x00, 0x19, 0x00, 0x31, 0x00, 0x19, 0xe0, 0x31, 0xe0,
+	0x19, 0xe0, 0x31, 0xe0, 0xc0, 0xfe, 0xb2, 0x94, 0xfd, 0xca, 0x8a, 0x88, 0x00, 0xc0, 0x31, 0xe0,
+	0x19, 0xe0, 0x31, 0xe0, 0x19, 0x00, 0x31, 0x00, 0x19, 0x00, 0x31, 0x00, 0x19, 0x00, 0x31, 0x00,
+	0x19, 0x00, 0x31, 0x00, 0x19, 0x00, 0x31, 0x00, 0x19, 0x00, 0x31, 0x00, 0x19, 0x00, 0x31, 0x00,
+	0x19, 0x00, 0x31, 0x00, 0x19, 0x00, 0x31, 0x00, 0x19, 0x00, 0xc3, 0x7e, 0xae, 0x78, 0xbd, 0x99,
+	0xfd, 0xd7, 0x7b, 0x00, 0xdf, 0xd2, 0x00, 0x91, 0x99, 0xc0, 0x07, 0x00, 0x07, 0xe0, 0x07, 0x00,
+	0x07, 0x00, 0x07, 0x00, 0x07, 0x00, 0x07, 0x00, 0x07, 0x00, 0x07, 0x00, 0x07, 0x00, 0xc1, 0x07,
+	0x00, 0x07, 0x00, 0x07, 0x00, 0x07, 0xa5, 0x77, 0xe0, 0xc0, 0x07, 0x00, 0x07, 0x00, 0x07, 0x00,
+	0x07, 0x00, 0x07, 0x00, 0x07, 0x00, 0x07, 0x00, 0x07, 0x00, 0x07, 0x00, 0x07, 0xe0, 0xc0, 0xbd,
+	0x88, 0xfd, 0xc8, 0x08, 0x00, 0xc0, 0x07, 0x00, 0x07, 0x00, 0x07, 0x00, 0x07, 0x00, 0x07, 0x00,
+	0x07, 0x00, 0x07, 0x00, 0x07, 0x00, 0x07, 0x00, 0x07, 0x00, 0x19, 0x00, 0xa7, 0x87, 0x00, 0x07,
+	0x00, 0x07, 0x00, 0x07, 0x00, 0x07, 0x00, 0xc1, 0x07, 0x00, 0x07, 0x00, 0x07, 0x00, 0x07, 0x00,
+	0x07, 0x00, 0x07, 0xe0, 0x07, 0xe0, 0x07, 0x00, 0x07, 0x00, 0x31, 0xaa, 0x88, 0xfd, 0xd5, 0x95,
+	0x00, 0xdf, 0xd0, 0x26, 0x31, 0x19, 0xe0, 0x31, 0x00, 0x19, 0x00, 0x31, 0x00, 0x19, 0x00, 0x31,
+	0x00, 0x19, 0x00, 0x31, 0x00, 0x19, 0x00, 0x31, 0x00, 0x19, 0x00, 0xa5, 0x77, 0xfe, 0x6a, 0x76,
+	0xfe, 0x86, 0x43, 0xfe, 0x01, 0x08, 0xe0, 0xc0, 0x19, 0x00, 0x31, 0x00, 0xc0, 0xfe, 0x09, 0x6e,
+	0xfe, 0x66, 0x43, 0x00, 0x31, 0x00, 0x31, 0x00, 0x19, 0x00, 0xc1, 0x19, 0x00, 0x31, 0x00, 0x19,
+	0x00, 0x31, 0x00, 0x19, 0x00, 0x31, 0xe0, 0xc0, 0xbc, 0x88, 0xe1, 0x51, 0xfd, 0xc0, 0x9d, 0x99,
+	0xe1, 0x81, 0x99, 0x00, 0xc0, 0x31, 0x00, 0x19, 0x00, 0x31, 0x00, 0x19, 0x00, 0x31, 0x00, 0x19,
+	0x00, 0x31, 0x00, 0x19, 0x00, 0x31, 0x00, 0x19, 0x00, 0xc0, 0xb8, 0x31, 0xb6, 0x31, 0x00, 0x6e,
+	0x00, 0x19, 0x00, 0xc1, 0x15, 0xb3, 0x32, 0x37, 0xfe, 0x40, 0x00, 0x19, 0x00, 0x31, 0x00, 0x19,
+	0x00, 0x31, 0x00, 0x19, 0x00, 0x31, 0x00, 0x19, 0x00, 0x31, 0x00, 0x19, 0x00, 0x31, 0x00, 0x19,
+	0x00, 0xfe, 0x59, 0xce, 0xfd, 0xd3, 0xa3, 0x00, 0xdf, 0xcd, 0x3c, 0x9c, 0x88, 0xa2, 0x88, 0x00,
+	0x07, 0x00, 0x07, 0x00, 0x07, 0x00, 0x07, 0x00, 0x07, 0x00, 0x07, 0x00, 0x07, 0x00, 0x07, 0x00,
+	0xc3, 0x07, 0x00, 0x07, 0x00, 0xa8, 0x65, 0xfe, 0x4a, 0x76, 0xc0, 0x37, 0x98, 0xab, 0xfe, 0x02,
+	0x08, 0xe0, 0xc0, 0x07, 0x31, 0x67, 0x37, 0x7f, 0xfe, 0x03, 0x2a, 0xe0, 0xc0, 0x07, 0x00, 0x27,
+	0xb9, 0x30, 0x97, 0xbc, 0x00, 0x07, 0x00, 0x07, 0x00, 0x07, 0x00, 0x07, 0x00, 0x07, 0x00, 0x07,
+	0xe0, 0xc0, 0xa9, 0x88, 0x00, 0xc0, 0xab, 0x99, 0xfe, 0x3c, 0xe7, 0xfa, 0x3b, 0x24, 0x00, 0xc0,
+	0x15, 0x00, 0xc0, 0x07, 0x00, 0x07, 0x00, 0x07, 0x00, 0x07, 0x00, 0x07, 0x00, 0x07, 0x00, 0xc0,
+	0xaf, 0x54, 0xa5, 0x87, 0x00, 0x07, 0x00, 0x07, 0x00, 0xb1, 0x54, 0xfe, 0xaa, 0x7e, 0x62, 0x27,
+	0x07, 0x00, 0x07, 0x00, 0xa2, 0x99, 0xfe, 0xa7, 0x54, 0x25, 0x05, 0xa3, 0x88, 0xfe, 0x80, 0x08,
+	0x07, 0x00, 0x07, 0x00, 0x07, 0x00, 0xc3, 0x07, 0x00, 0x07, 0x00, 0x07, 0x00, 0x07, 0x00, 0x07,
+	0x00, 0x07, 0x00, 0x07, 0x00, 0x3b, 0xa5, 0x88, 0x66, 0xfd, 0xd0, 0xac, 0x00, 0xdf, 0xc9, 0x98,
+	0x88, 0x80, 0x88, 0x00, 0xc3, 0x07, 0x00, 0x31, 0x00, 0x19, 0x00, 0x31, 0x00, 0x19, 0x00, 0x31,
+	0x00, 0x19, 0x00, 0x31, 0x00, 0xa4, 0x87, 0x0c, 0x9d, 0xaa, 0x91, 0xbd, 0xfe, 0x01, 0x08, 0x27,
+	0xe0, 0xc0, 0x19, 0x00, 0xc0, 0xfe, 0x6a, 0x76, 0x9d, 0x9a, 0x0c, 0x05, 0xa2, 0x77, 0x11, 0x00,
+	0xe0, 0x00, 0xfe, 0x28, 0x65, 0xa6, 0x66, 0x05, 0x0c, 0xe0, 0xc0, 0x31, 0x00, 0xa4, 0x77, 0xfe,
+	0x0b, 0x7f, 0x95, 0xbc, 0x00, 0x19, 0x00, 0x31, 0x00, 0xa2, 0x98, 0x00, 0x31, 0x00, 0x19, 0x00,
+	0x31, 0xe0, 0x19, 0xe0, 0x31, 0x00, 0xc0, 0x0f, 0xf8, 0x85, 0x99, 0x00, 0xc0, 0x31, 0xe0, 0x19,
+	0xe0, 0x31, 0x00, 0x19, 0x00, 0x31, 0x00, 0xc1, 0x31, 0x00, 0x19, 0x00, 0xc0, 0xfe, 0x88, 0x65,
+	0xab, 0x66, 0xfe, 0xa0, 0x08, 0x31, 0x00, 0x31, 0x00, 0x37, 0x51, 0x1a, 0x9b, 0x9a, 0x00, 0xc1,
+	0xb1, 0x53, 0x37, 0x3e, 0x77, 0x1a, 0x08, 0x23, 0x19, 0x00, 0xc2, 0x27, 0xfe, 0xc6, 0x43, 0x1e,
+	0x22, 0x1c, 0x31, 0x00, 0x19, 0x00, 0x31, 0x00, 0x19, 0x00, 0x31, 0x00, 0x19, 0x00, 0x31, 0x00,
+	0x19, 0x00, 0xc3, 0xb5, 0x98, 0xb9, 0x89, 0xfd, 0xcc, 0xb2, 0x00, 0xdf, 0xc8, 0xfe, 0xaf, 0x7b,
+	0x00, 0xc0, 0x07, 0xe0, 0x07, 0xe0, 0x07, 0x00, 0x07, 0x00, 0x07, 0x00, 0x07, 0x00, 0x27, 0x00,
+	0xc3, 0x07, 0x00, 0x07, 0x00, 0x07, 0xfe, 0x2a, 0x76, 0xc1, 0x37, 0x3e, 0x8f, 0xdf, 0x27, 0xe1,
+	0xfe, 0x87, 0x54, 0x0c, 0x22, 0x0c, 0x22, 0xa2, 0x77, 0xc0, 0xfe, 0xc2, 0x10, 0xe0, 0x0c, 0x34,
+	0x0c, 0x22, 0x37, 0x11, 0xe0, 0x07, 0x26, 0xfe, 0xcb, 0x7e, 0x0c, 0xa3, 0x98, 0x00, 0x07, 0x00,
+	0x07, 0x27, 0xfe, 0xe8, 0x5c, 0x00, 0x07, 0x00, 0x07, 0x00, 0x07, 0x00, 0x07, 0x00, 0x07, 0xe0,
+	0xc0, 0xae, 0x88, 0xf6, 0xfe, 0x69, 0x4a, 0x00, 0xc0, 0x07, 0x00, 0x07, 0x00, 0x07, 0x00, 0x07,
+	0x00, 0x07, 0x00, 0xc0, 0xfe, 0x48, 0x65, 0xe0, 0xc0, 0x07, 0x00, 0xc0, 0x37, 0x13, 0x28, 0xfe,
+	0x41, 0x08, 0x00, 0x31, 0xb0, 0x53, 0x37, 0x9d, 0x99, 0x22, 0x0c, 0x9c, 0xaa, 0xe0, 0xa8, 0x77,
+	0xfe, 0x4a, 0x76, 0x13, 0x0c, 0x22, 0x0c, 0x13, 0x1e, 0x00, 0xc0, 0x7b, 0x10, 0xaa, 0x66, 0x37,
+	0x05, 0x0c, 0x25, 0x00, 0x07, 0x00, 0x07, 0x00, 0x07, 0x00, 0x27, 0x00, 0xc1, 0x07, 0x00, 0x07,
+	0x00, 0x07, 0x00, 0x07, 0xe0, 0x07, 0xe0, 0x07, 0x00, 0xc0, 0x16, 0xfd, 0xcb, 0xb4, 0x00, 0xdf,
+	0xc7, 0x87, 0x99, 0x00, 0xc0, 0x6f, 0x00, 0x31, 0x00, 0x19, 0x00, 0x31, 0x00, 0x19, 0x00, 0x31,
+	0xa0, 0xa9, 0x27, 0xb6, 0x30, 0x30, 0x6e, 0x7e, 0x90, 0xbd, 0x97, 0xbc, 0x00, 0xc3, 0x29, 0x28,
+	0x0c, 0x1a, 0x34, 0x0c, 0x05, 0x37, 0x02, 0x3e, 0xe0, 0x1a, 0x34, 0x1a, 0x0c, 0x1a, 0x05, 0x3e,
+	0x34, 0x1a, 0x34, 0x1a, 0x0c, 0x37, 0x8e, 0xce, 0x00, 0xfe, 0x67, 0x54, 0x1a, 0x34, 0x0c, 0x08,
+	0xfe, 0x62, 0x10, 0x19, 0x65, 0xc0, 0x05, 0x9a, 0x9a, 0x00, 0x31, 0x00, 0x19, 0x00, 0x31, 0x00,
+	0x19, 0x00, 0x31, 0xe0, 0xc1, 0xfe, 0xbf, 0xff, 0xf3, 0x31, 0x00, 0xc0, 0x31, 0x00, 0x19, 0x00,
+	0x31, 0x00, 0x19, 0x00, 0x31, 0x00, 0xc0, 0x1a, 0x37, 0xe0, 0x19, 0x00, 0xa3, 0x99, 0x05, 0x34,
+	0x1a, 0x13, 0xfe, 0xa4, 0x32, 0xe0, 0xfe, 0x26, 0x4c, 0x37, 0x1a, 0x6f, 0x1a, 0xe0, 0xc0, 0x1a,
+	0xa3, 0x87, 0x0c, 0x1a, 0x34, 0x1a, 0xe0, 0x1a, 0x34, 0x22, 0x05, 0x65, 0x13, 0x0c, 0xc0, 0x1a,
+	0x37, 0xfe, 0x23, 0x22, 0x31, 0x66, 0xc2, 0xa5, 0x87, 0xad, 0x55, 0xa5, 0x76, 0x30, 0xc0, 0x99,
+	0xab, 0x00, 0x31, 0x00, 0x19, 0x00, 0x31, 0x00, 0x19, 0x00, 0x31, 0x00, 0x19, 0xe0, 0xc0, 0xb5,
+	0x99, 0xfd, 0xca, 0xb5, 0x00, 0xdf, 0xc7, 0x00, 0xc0, 0x7f, 0x00, 0x07, 0x00, 0x07, 0x00, 0x07,
+	0x00, 0x07, 0x00, 0x07, 0x00, 0xc0, 0x0c, 0x37, 0x13, 0x05, 0x13, 0x05, 0xc1, 0x2c, 0x98, 0xab,
+	0xfe, 0xc3, 0x21, 0xe0, 0xaf, 0x53, 0xfe, 0x8a, 0x7e, 0xe0, 0x7b, 0x0c, 0x22, 0x0c, 0x22, 0x13,
+	0x22, 0xe0, 0x22, 0x0c, 0x22, 0xe0, 0x22, 0x0c, 0x22, 0x0c, 0x22, 0x0c, 0x22, 0xe0, 0x22, 0x05,
+	0x99, 0xab, 0x05, 0x22, 0x0c, 0x22, 0x55, 0xa6, 0x77, 0xfe, 0xe2, 0x10, 0x9a, 0xaa, 0xe1, 0x0c,
+	0x9c, 0xaa, 0x00, 0x07, 0x00, 0x07, 0x00, 0x07, 0x00, 0x07, 0x00, 0x07, 0xe0, 0x19, 0x00, 0x35,
+	0xf1, 0x00, 0x07, 0xe0, 0x07, 0x00, 0x07, 0x00, 0x07, 0x00, 0x07, 0x00, 0x07, 0x00, 0xc0, 0x1a,
+	0x13, 0x3e, 0xe0, 0x31, 0xa7, 0x87, 0x08, 0x22, 0x0c, 0x22, 0x0c, 0xa2, 0x88, 0x98, 0xaa, 0x05,
+	0x51, 0x22, 0x0c, 0x22, 0xe0, 0x22, 0x0c, 0x22, 0xe0, 0x22, 0x0c, 0x22, 0xe0, 0x22, 0x0c, 0x13,
+	0x1a, 0x22, 0x0c, 0x22, 0xe0, 0x22, 0x21, 0xfe, 0x61, 0x08, 0x00, 0x18, 0x09, 0x1a, 0x05, 0x37,
+	0x13, 0x05, 0x2c, 0x05, 0xc0, 0x9a, 0xaa, 0x00, 0x07, 0x00, 0x07, 0x00, 0x07, 0x00, 0x07, 0x00,
+	0x07, 0x00, 0x07, 0xe0, 0xc0, 0xfe, 0x39, 0xce, 0xfd, 0xc9, 0xad, 0x00, 0xdf, 0xc6, 0x8d, 0x99,
+	0xe0, 0x19, 0x00, 0x31, 0x00, 0x19, 0x00, 0x31, 0x00, 0x19, 0x00, 0x31, 0x00, 0x19, 0xe0, 0xc0,
+	0xfe, 0x48, 0x65, 0xe0, 0x1a, 0x6e, 0x1a, 0x34, 0x1a, 0x0c, 0xc0, 0x37, 0x3e, 0x7f, 0x1a, 0x34,
+	0x1a, 0xe0, 0x1a, 0x34, 0x1a, 0x0c, 0x1a, 0x34, 0x1a, 0xe0, 0x1a, 0x34, 0x1a, 0xe0, 0x1a, 0x34,
+	0x1a, 0xe0, 0x1a, 0x34, 0x1a, 0x0c, 0xc0, 0x34, 0x1a, 0xe0, 0x1a, 0x34, 0x1a, 0x16, 0x00, 0x1e,
+	0x3e, 0xe0, 0x3e, 0x17, 0x00, 0x31, 0x00, 0x19, 0x00, 0xc1, 0x19, 0x00, 0x31, 0x00, 0x19, 0x00,
+	0xf0, 0x00, 0x19, 0x00, 0x31, 0x00, 0x19, 0x00, 0x31, 0x00, 0x19, 0x00, 0x31, 0x00, 0xc0, 0xfe,
+	0xc9, 0x65, 0x13, 0x1a, 0x05, 0x8b, 0xde, 0x8a, 0xcf, 0x28, 0x0c, 0x1a, 0xe0, 0x1a, 0x34, 0x1a,
+	0x34, 0x1a, 0x34, 0x1a, 0xe0, 0x1a, 0x34, 0x1a, 0xe0, 0x1a, 0x34, 0x1a, 0xe0, 0x1a, 0x34, 0x1a,
+	0xe0, 0x1a, 0x34, 0x1a, 0xe0, 0x1a, 0x34, 0x1a, 0x0c, 0xc0, 0x13, 0x1d, 0x13, 0xe0, 0x34, 0x1a,
+	0x0c, 0x1a, 0x34, 0x0c, 0x62, 0x00, 0x19, 0x00, 0x6e, 0x00, 0x19, 0x00, 0x31, 0x00, 0x19, 0x00,
+	0x31, 0x00, 0x19, 0xe0, 0xfe, 0x51, 0x8c, 0xfd, 0xc9, 0xa0, 0x00, 0xdf, 0xc6, 0x89, 0x99, 0xe0,
+	0xc0, 0x07, 0x00, 0x07, 0x31, 0xe0, 0xc9, 0xfe, 0xa9, 0x6d, 0x13, 0xe0, 0x22, 0x0c, 0x22, 0xe0,
+	0x22, 0x0c, 0x22, 0x1a, 0x22, 0x0c, 0x22, 0xe0, 0x22, 0x0c, 0x22, 0xe0, 0x22, 0x0c, 0x22, 0xe0,
+	0x22, 0x0c, 0x22, 0xe0, 0x22, 0x0c, 0x22, 0xe0, 0x22, 0x0c, 0x22, 0xe0, 0x22, 0x0c, 0x22, 0xe0,
+	0x22, 0x0c, 0x22, 0x1a, 0x05, 0x13, 0x22, 0xe0, 0x22, 0x13, 0x99, 0xab, 0x00, 0x07, 0x00, 0x07,
+	0xb0, 0x42, 0x31, 0x00, 0x07, 0x00, 0x07, 0x00, 0x07, 0x00, 0xee, 0xfe, 0x24, 0x21, 0x07, 0x00,
+	0x07, 0x00, 0x07, 0x00, 0x07, 0x23, 0x03, 0x00, 0x07, 0x00, 0xc0, 0xfe, 0x28, 0x65, 0x13, 0x0c,
+	0x22, 0x55, 0x05, 0x1a, 0x22, 0xe0, 0x22, 0xe0, 0x22, 0x0c, 0x22, 0x0c, 0x22, 0x0c, 0x22, 0xe0,
+	0x22, 0x0c, 0x22, 0xe0, 0x22, 0x0c, 0x22, 0xe0, 0x22, 0x0c, 0x22, 0xe0, 0x22, 0x0c, 0x22, 0xe0,
+	0x22, 0x0c, 0x22, 0xe0, 0x22, 0x1a, 0x22, 0x0c, 0x22, 0x0c, 0x22, 0xe0, 0x22, 0x0c, 0x9c, 0x9a,
+	0x00, 0xc9, 0x07, 0x00, 0x07, 0x00, 0x07, 0xb8, 0x77, 0xfd, 0xc9, 0xbb, 0x00, 0xdf, 0xc6, 0x8a,
+	0x98, 0xe0, 0x31, 0x00, 0x19, 0x00, 0xc0, 0xfe, 0x46, 0x4c, 0x37, 0x59, 0x7f, 0x1a, 0x22, 0x9d,
+	0x89, 0x29, 0x1a, 0xc0, 0x0c, 0xc0, 0x1a, 0x6f, 0x1a, 0xe0, 0x1a, 0x34, 0x1a, 0xe0, 0x1a, 0x34,
+	0x1a, 0xe0, 0x1a, 0x34, 0x1a, 0xe0, 0x1a, 0x34, 0x1a, 0xe0, 0x1a, 0x34, 0x1a, 0xe0, 0x1a, 0x34,
+	0x1a, 0xe0, 0x1a, 0x34, 0x1a, 0xe0, 0x1a, 0x34, 0x1a, 0xe0, 0x1a, 0x34, 0x1a, 0xe0, 0x1a, 0x34,
+	0x1a, 0x0c, 0x1a, 0x34, 0x1a, 0x0c, 0x3e, 0x96, 0xbc, 0x00, 0x31, 0x00, 0xfe, 0xeb, 0x7e, 0x14,
+	0x31, 0x00, 0x19, 0x00, 0x31, 0x00, 0x07, 0xb5, 0x88, 0xec, 0xfe, 0xae, 0x73, 0x07, 0x00, 0x31,
+	0x00, 0x19, 0x00, 0x31, 0xc0, 0xb2, 0x53, 0xfe, 0xaa, 0x7e, 0xe0, 0xc1, 0xfe, 0xc7, 0x54, 0xad,
+	0x65, 0x1a, 0x34, 0x1a, 0x0c, 0x1a, 0x34, 0x1a, 0xe0, 0x1a, 0x34, 0x1a, 0xe0, 0x1a, 0x34, 0x1a,
+	0xe0, 0x1a, 0x34, 0x1a, 0xe0, 0x1a, 0x34, 0x1a, 0xe0, 0x1a, 0x34, 0x1a, 0xe0, 0x1a, 0x34, 0x1a,
+	0xe0, 0x1a, 0x34, 0x1a, 0xe0, 0x1a, 0x34, 0x1a, 0x0c, 0x1a, 0x34, 0x1a, 0xe0, 0x1a, 0x34, 0x1a,
+	0xe0, 0x29, 0x1a, 0xc0, 0x34, 0x9d, 0x99, 0x29, 0x09, 0x61, 0x6e, 0x17, 0x3e, 0x93, 0xbd, 0x00,
+	0x19, 0x00, 0x31, 0x00, 0xbd, 0x99, 0xfd, 0xc9, 0xba, 0x00, 0xdf, 0xc6, 0x1f, 0xe0, 0xc0, 0x07,
+	0x00, 0x07, 0x31, 0x00, 0x37, 0x9c, 0x9a, 0x1a, 0x7f, 0x1a, 0x34, 0x1a, 0x22, 0xe0, 0x34, 0xe0,
+	0x22, 0x0c, 0x22, 0xe0, 0x22, 0x0c, 0x22, 0xe0, 0x22, 0x0c, 0x22, 0xe0, 0x22, 0x0c, 0x22, 0xe0,
+	0x22, 0x0c, 0x22, 0xe0, 0x22, 0x0c, 0x22, 0xe0, 0x22, 0x0c, 0x22, 0xe0, 0x22, 0x0c, 0x22, 0xe0,
+	0x22, 0x0c, 0x22, 0xe0, 0x22, 0x0c, 0x22, 0xe0, 0x22, 0x0c, 0x22, 0xe0, 0x22, 0x0c, 0x22, 0xe0,
+	0x22, 0x05, 0x8d, 0xde, 0x00, 0x06, 0x28, 0x16, 0xfe, 0x42, 0x11, 0x07, 0x00, 0x07, 0x00, 0x07,
+	0x00, 0xa2, 0x88, 0xfe, 0x18, 0xc6, 0xea, 0x93, 0x99, 0x00, 0xc0, 0x07, 0x00, 0x07, 0x00, 0x07,
+	0x00, 0xab, 0x76, 0x08, 0x6f, 0xfe, 0x82, 0x19, 0xe0, 0xfe, 0x67, 0x54, 0x05, 0x0c, 0x22, 0x0c,
+	0x22, 0xe0, 0x22, 0x0c, 0x22, 0xe0, 0x22, 0x0c, 0x22, 0xe0, 0x22, 0x0c, 0x22, 0xe0, 0x22, 0x0c,
+	0x22, 0xe0, 0x22, 0x0c, 0x22, 0xe0, 0x22, 0x0c, 0x22, 0xe0, 0x22, 0x0c, 0x22, 0xe0, 0x22, 0x0c,
+	0x22, 0xe0, 0x22, 0x0c, 0x22, 0xe0, 0x22, 0x0c, 0x22, 0xe0, 0x22, 0x0c, 0x22, 0xe0, 0x22, 0xe0,
+	0x34, 0x1a, 0x22, 0x1a, 0x34, 0x0c, 0x22, 0x1a, 0x05, 0x00, 0x07, 0x00, 0x07, 0x00, 0x07, 0xfe,
+	0xf3, 0x9c, 0xfd, 0xc9, 0xba, 0x00, 0xdf, 0xc7, 0xe0, 0x19, 0x00, 0x31, 0x00, 0x19, 0xe0, 0xb3,
+	0x43, 0x37, 0x9d, 0x9a, 0x1a, 0x0c, 0x1a, 0x34, 0x1a, 0x0c, 0x1a, 0x34, 0x1a, 0xe0, 0x1a, 0x34,
+	0x1a, 0xe0, 0x1a, 0x34, 0x1a, 0xe0, 0x1a, 0x34, 0x1a, 0xe0, 0x1a, 0x34, 0x1a, 0xe0, 0x1a, 0x34,
+	0x1a, 0xe0, 0x1a, 0x34, 0x1a, 0xe0, 0x1a, 0x34, 0x1a, 0xe0, 0x1a, 0x34, 0x1a, 0xe0, 0x1a, 0x34,
+	0x1a, 0xe0, 0x1a, 0x34, 0x1a, 0xe0, 0x1a, 0x34, 0x1a, 0xe0, 0x1a, 0x34, 0x1a, 0x0c, 0x37, 0xfe,
+	0x45, 0x3b, 0xb0, 0x43, 0x1a, 0xc0, 0x21, 0x00, 0x31, 0x00, 0x19, 0x00, 0x31, 0x00, 0xc0, 0xfe,
+	0xdf, 0xff, 0xe8, 0x51, 0x00, 0xc0, 0x31, 0x00, 0x19, 0x00, 0x31, 0x00, 0xc0, 0x28, 0x0c, 0x1a,
+	0x9a, 0xaa, 0x8f, 0xbd, 0x37, 0x9c, 0x99, 0x34, 0x1a, 0xe0, 0x1a, 0x34, 0x1a, 0xe0, 0x1a, 0x34,
+	0x1a, 0xe0, 0x1a, 0x34, 0x1a, 0xe0, 0x1a, 0x34, 0x1a, 0xe0, 0x1a, 0x34, 0x1a, 0xe0, 0x1a, 0x34,
+	0x1a, 0xe0, 0x1a, 0x34, 0x1a, 0xe0, 0x1a, 0x34, 0x1a, 0xe0, 0x1a, 0x34, 0x1a, 0xe0, 0x1a, 0x34,
+	0x1a, 0xe0, 0x1a, 0x34, 0x1a, 0xe0, 0x1a, 0x34, 0x1a, 0x0c, 0x1a, 0x34, 0x1a, 0x0c, 0x1a, 0x34,
+	0x1a, 0x08, 0xfe, 0x23, 0x2a, 0x19, 0x00, 0x31, 0x00, 0x19, 0x00, 0xfe, 0xbb, 0xd6, 0xfd, 0xc9,
+	0xb4, 0x00, 0xdf, 0xc7, 0x88, 0x99, 0x00, 0x07, 0x00, 0x07, 0x00, 0x07, 0x00, 0xfe, 0x08, 0x5d,
+	0x0c, 0x22, 0xe0, 0x22, 0x0c, 0x22, 0xe0, 0x22, 0x0c, 0x22, 0xe0, 0x22, 0x0c, 0x22, 0xe0, 0x22,
+	0x0c, 0x22, 0xe0, 0x22, 0x0c, 0x22, 0xe0, 0x22, 0x0c, 0x22, 0xe0, 0x22, 0x0c, 0x22, 0xe0, 0x22,
+	0x0c, 0x22, 0xe0, 0x22, 0x0c, 0x22, 0xe0, 0x22, 0x0c, 0x22, 0xe0, 0x22, 0x0c, 0x22, 0xe0, 0x22,
+	0x0c, 0x22, 0xe0, 0x22, 0x0c, 0x22, 0xe0, 0x22, 0x0c, 0x22, 0xe0, 0x22, 0x05, 0x66, 0x0c, 0x22,
+	0x0c, 0x05, 0x00, 0x07, 0x00, 0x07, 0x00, 0x07, 0xe0, 0xa9, 0x99, 0xe8, 0xfe, 0x0c, 0x63, 0x31,
+	0x07, 0x00, 0x07, 0x00, 0x07, 0x00, 0xc0, 0x05, 0x22, 0xe0, 0x22, 0x0c, 0x37, 0x1a, 0x22, 0x0c,
+	0x22, 0xe0, 0x22, 0x0c, 0x22, 0xe0, 0x22, 0x0c, 0x22, 0xe0, 0x22, 0x0c, 0x22, 0xe0, 0x22, 0x0c,
+	0x22, 0xe0, 0x22, 0x0c, 0x22, 0xe0, 0x22, 0x0c, 0x22, 0xe0, 0x22, 0x0c, 0x22, 0xe0, 0x22, 0x0c,
+	0x22, 0xe0, 0x22, 0x0c, 0x22, 0xe0, 0x22, 0x0c, 0x22, 0xe0, 0x22, 0x0c, 0x22, 0xe0, 0x22, 0x0c,
+	0x22, 0xe0, 0x22, 0x0c, 0x22, 0xe0, 0x22, 0x0c, 0x13, 0x2d, 0x00, 0xc0, 0x07, 0x00, 0x07, 0x00,
+	0x24, 0xfe, 0xff, 0xff, 0xdf, 0xc7, 0xb4, 0x00, 0xdf, 0xc7, 0x86, 0x88, 0xe0, 0xc0, 0x19, 0x00,
+	0x31, 0x00, 0x19, 0xa9, 0x64, 0x21, 0x1a, 0x6f, 0x1a, 0xe0, 0x1a, 0x34, 0x1a, 0xe0, 0x1a, 0x34,
+	0x1a, 0xe0, 0x1a, 0x34, 0x1a, 0xe0, 0x1a, 0x34, 0x1a, 0xe0, 0x1a, 0x34, 0x1a, 0xe0, 0x1a, 0x34,
+	0x1a, 0xe0, 0x1a, 0x34, 0x1a, 0xe0, 0x1a, 0x34, 0x1a, 0xe0, 0x1a, 0x34, 0x1a, 0xe0, 0x1a, 0x34,
+	0x1a, 0xe0, 0x1a, 0x34, 0x1a, 0xe0, 0x1a, 0x34, 0x1a, 0xe0, 0x1a, 0x34, 0x1a, 0xe0, 0x1a, 0x34,
+	0x1a, 0x0c, 0x1a, 0x34, 0x1a, 0xe0, 0xc0, 0x96, 0xbc, 0x00, 0x31, 0x00, 0x19, 0x00, 0x31, 0x00,
+	0xfe, 0xdb, 0xde, 0xe6, 0x02, 0x00, 0xe0, 0x00, 0x19, 0x00, 0x31, 0x00, 0xc0, 0x3e, 0x0c, 0x1a,
+	0x34, 0x1a, 0xe0, 0x1a, 0x34, 0x1a, 0xe0, 0x1a, 0x34, 0x1a, 0xe0, 0x1a, 0x34, 0x1a, 0xe0, 0x1a,
+	0x34, 0x1a, 0xe0, 0x1a, 0x34, 0x1a, 0xe0, 0x1a, 0x34, 0x1a, 0xe0, 0x1a, 0x34, 0x1a, 0xe0, 0x1a,
+	0x34, 0x1a, 0xe0, 0x1a, 0x34, 0x1a, 0xe0, 0x1a, 0x34, 0x1a, 0xe0, 0x1a, 0x34, 0x1a, 0xe0, 0x1a,
+	0x34, 0x1a, 0xe0, 0x1a, 0x34, 0x1a, 0xe0, 0x1a, 0x34, 0x1a, 0xe0, 0x1a, 0x34, 0x1a, 0xe0, 0x08,
+	0xfe, 0xa1, 0x08, 0xe0, 0x31, 0x00, 0x19, 0x00, 0xc0, 0x39, 0xfd, 0xca, 0xb8, 0x00, 0xdf, 0xc6,
+	0x9a, 0x99, 0x00, 0xc0, 0x07, 0x00, 0x07, 0x00, 0x07, 0x00, 0xc0, 0xfe, 0xa7, 0x54, 0x22, 0x0c,
+	0x22, 0xe0, 0x22, 0x0c, 0x22, 0xe0, 0x22, 0x0c, 0x22, 0xe0, 0x22, 0x0c, 0x22, 0xe0, 0x22, 0x0c,
+	0x22, 0xe0, 0x22, 0x0c, 0x22, 0xe0, 0x22, 0x0c, 0x22, 0xe0, 0x22, 0x0c, 0x22, 0xe0, 0x22, 0x0c,
+	0x22, 0xe0, 0x22, 0x0c, 0x22, 0xe0, 0x22, 0x0c, 0x22, 0xe0, 0x22, 0x0c, 0x22, 0xe0, 0x22, 0x0c,
+	0x22, 0xe0, 0x22, 0x0c, 0x22, 0xe0, 0x22, 0x0c, 0x22, 0xe0, 0x22, 0x0c, 0x22, 0xe0, 0x22, 0x37,
+	0xfe, 0x64, 0x32, 0x00, 0x07, 0x00, 0x07, 0x00, 0x07, 0x00, 0xe6, 0x00, 0x07, 0x00, 0x07, 0x00,
+	0x07, 0x00, 0x07, 0xb1, 0x43, 0x05, 0xe0, 0x7b, 0x0c, 0x22, 0xe0, 0x22, 0x0c, 0x22, 0xe0, 0x22,
+	0x0c, 0x22, 0xe0, 0x22, 0x0c, 0x22, 0xe0, 0x22, 0x0c, 0x22, 0xe0, 0x22, 0x0c, 0x22, 0xe0, 0x22,
+	0x0c, 0x22, 0xe0, 0x22, 0x0c, 0x22, 0xe0, 0x22, 0x0c, 0x22, 0xe0, 0x22, 0x0c, 0x22, 0xe0, 0x22,
+	0x0c, 0x22, 0xe0, 0x22, 0x0c, 0x22, 0xe0, 0x22, 0x0c, 0x22, 0xe0, 0x22, 0x0c, 0x22, 0xe0, 0x22,
+	0x0c, 0x22, 0xe0, 0x22, 0x0c, 0x22, 0x1a, 0x96, 0xbc, 0x00, 0x07, 0x00, 0x07, 0x00, 0x07, 0xe0,
+	0xc0, 0xfe, 0x14, 0xa5, 0xfd, 0xc9, 0xbb, 0x00, 0xdf, 0xc6, 0xfe, 0x2d, 0x6b, 0xe0, 0x19, 0x00,
+	0x31, 0x00, 0x19, 0x00, 0x31, 0xe0, 0xae, 0x53, 0xfe, 0x49, 0x76, 0xe0, 0x1a, 0x34, 0x1a, 0xe0,
+	0x1a, 0x34, 0x1a, 0xe0, 0x1a, 0x34, 0x1a, 0xe0, 0x1a, 0x34, 0x1a, 0xe0, 0x1a, 0x34, 0x1a, 0xe0,
+	0x1a, 0x34, 0x1a, 0xe0, 0x1a, 0x34, 0x1a, 0xe0, 0x1a, 0x34, 0x1a, 0xe0, 0x1a, 0x34, 0x1a, 0xe0,
+	0x1a, 0x34, 0x1a, 0xe0, 0x1a, 0x34, 0x1a, 0xe0, 0x1a, 0x34, 0x1a, 0xe0, 0x1a, 0x34, 0x1a, 0xe0,
+	0x1a, 0x34, 0x1a, 0xe0, 0x1a, 0x34, 0x1a, 0xe0, 0x1a, 0x34, 0x1a, 0x0c, 0x08, 0x27, 0x00, 0x31,
+	0x00, 0x19, 0x00, 0x07, 0xfe, 0x39, 0xce, 0xe4, 0x93, 0x99, 0x31, 0x00, 0x19, 0x00, 0x31, 0x00,
+	0x19, 0x00, 0x21, 0x1a, 0x34, 0x1a, 0xe0, 0x1a, 0x34, 0x1a, 0xe0, 0x1a, 0x34, 0x1a, 0xe0, 0x1a,
+	0x34, 0x1a, 0xe0, 0x1a, 0x34, 0x1a, 0xe0, 0x1a, 0x34, 0x1a, 0xe0, 0x1a, 0x34, 0x1a, 0xe0, 0x1a,
+	0x34, 0x1a, 0xe0, 0x1a, 0x34, 0x1a, 0xe0, 0x1a, 0x34, 0x1a, 0xe0, 0x1a, 0x34, 0x1a, 0xe0, 0x1a,
+	0x34, 0x1a, 0xe0, 0x1a, 0x34, 0x1a, 0xe0, 0x1a, 0x34, 0x1a, 0xe0, 0x1a, 0x34, 0x1a, 0xe0, 0x1a,
+	0x34, 0x1a, 0xe0, 0x1a, 0x21, 0xfe, 0x41, 0x11, 0x31, 0x00, 0x19, 0x00, 0x31, 0x00, 0x19, 0xe0,
+	0xc0, 0xfd, 0xc9, 0xb7, 0x00, 0xdf, 0xc6, 0x00, 0x07, 0x00, 0x07, 0x00, 0x07, 0x00, 0x07, 0x00,
+	0x07, 0x00, 0x05, 0xe0, 0x22, 0x0c, 0x22, 0xe0, 0x22, 0x0c, 0x22, 0xe0, 0x22, 0x0c, 0x22, 0xe0,
+	0x22, 0x0c, 0x13, 0xe0, 0x22, 0x0c, 0x22, 0xe0, 0x22, 0x0c, 0x22, 0xe0, 0x22, 0x0c, 0x22, 0xe0,
+	0x22, 0x0c, 0x22, 0xe0, 0x22, 0x0c, 0x22, 0xe0, 0x22, 0x0c, 0x22, 0xe0, 0x22, 0x0c, 0x22, 0xe0,
+	0x22, 0x0c, 0x22, 0xe0, 0x22, 0x0c, 0x22, 0xe0, 0x22, 0x0c, 0x22, 0xe0, 0x22, 0x0c, 0x22, 0xe0,
+	0x22, 0x0c, 0x22, 0xe0, 0x22, 0x99, 0xaa, 0x27, 0x00, 0x07, 0x00, 0x07, 0x00, 0xc0, 0xe4, 0x00,
+	0xc0, 0x07, 0x00, 0x07, 0x00, 0x07, 0x00, 0xfe, 0x49, 0x65, 0x0c, 0x22, 0x0c, 0x22, 0xe0, 0x22,
+	0x0c, 0x22, 0xe0, 0x22, 0x0c, 0x22, 0xe0, 0x22, 0x0c, 0x22, 0xe0, 0x22, 0x0c, 0x22, 0xe0, 0x22,
+	0x0c, 0x22, 0xe0, 0x22, 0x0c, 0x22, 0xe0, 0x22, 0x0c, 0x22, 0xe0, 0x22, 0x0c, 0x22, 0xe0, 0x22,
+	0x0c, 0x22, 0xe0, 0x22, 0x0c, 0x22, 0xe0, 0x22, 0x0c, 0x22, 0xe0, 0x22, 0x0c, 0x22, 0xe0, 0x22,
+	0x0c, 0x22, 0xe0, 0x22, 0x0c, 0x22, 0xe0, 0x22, 0x0c, 0x22, 0xe0, 0x22, 0x55, 0x00, 0xc0, 0x07,
+	0x00, 0x07, 0x00, 0x07, 0x00, 0x07, 0xe0, 0xfe, 0xd7, 0xbd, 0xfd, 0xc8, 0xc3, 0x00, 0xdf, 0xc5,
+	0x99, 0x99, 0xe0, 0xc0, 0x31, 0x00, 0x19, 0x00, 0xa4, 0x77, 0x00, 0xc2, 0x14, 0xb6, 0x32, 0x1a,
+	0xe0, 0x1a, 0x34, 0x1a, 0xe0, 0x1a, 0x34, 0x1a, 0xe0, 0x1a, 0x34, 0x1a, 0xc0, 0x8c, 0xce, 0xb1,
+	0x54, 0x37, 0x13, 0x1a, 0x34, 0x1a, 0xe0, 0x1a, 0x34, 0x1a, 0xe0, 0x1a, 0x34, 0x1a, 0xe0, 0x1a,
+	0x34, 0x1a, 0xe0, 0x1a, 0x34, 0x1a, 0xe0, 0x1a, 0x34, 0x1a, 0xe0, 0x1a, 0x34, 0x1a, 0xe0, 0x1a,
+	0x34, 0x1a, 0xe0, 0x1a, 0x34, 0x1a, 0xe0, 0x1a, 0x34, 0x1a, 0xe0, 0x1a, 0x34, 0x1a, 0xe0, 0x1a,
+	0x34, 0x1a, 0x37, 0xfe, 0xa2, 0x21, 0x19, 0x00, 0x31, 0x00, 0x19, 0xe0, 0xfe, 0x7a, 0xd6, 0xe2,
+	0x18, 0xe0, 0x19, 0x00, 0x31, 0x00, 0x19, 0x00, 0xad, 0x65, 0xfe, 0x29, 0x76, 0x34, 0x1a, 0xe0,
+	0x1a, 0x34, 0x1a, 0xe0, 0x1a, 0x34, 0x1a, 0xe0, 0x1a, 0x34, 0x1a, 0xe0, 0x1a, 0x34, 0x1a, 0xe0,
+	0x1a, 0x34, 0x1a, 0xe0, 0x1a, 0x34, 0x1a, 0xe0, 0x1a, 0x34, 0x1a, 0xe0, 0x1a, 0x34, 0x1a, 0xe0,
+	0x1a, 0x34, 0x1a, 0xe0, 0x1a, 0x34, 0x1a, 0xe0, 0x1a, 0x34, 0x1a, 0xe0, 0xc0, 0x16, 0x3e, 0x97,
+	0xac, 0x0c, 0x34, 0x1a, 0xe0, 0x1a, 0x34, 0x1a, 0xe0, 0x1a, 0x34, 0x1a, 0xe0, 0x1a, 0x34, 0x1a,
+	0xfe, 0xc4, 0x32, 0xe1, 0xc1, 0xa2, 0x77, 0x19, 0x00, 0x31, 0x00, 0xc0, 0xfe, 0xf4, 0x9c, 0xfd,
+	0xc8, 0xca, 0x00, 0xdf, 0xc5, 0x9b, 0x99, 0xe0, 0x07, 0x00, 0x07, 0x00, 0x07, 0x2a, 0xfe, 0x4c,
+	0x87, 0x13, 0x9c, 0x99, 0x17, 0xa9, 0x76, 0x0c, 0x22, 0xe0, 0x22, 0x0c, 0x22, 0xe0, 0x22, 0x0c,
+	0x22, 0xe0, 0x22, 0x0c, 0x22, 0xe0, 0xa5, 0x88, 0x97, 0xaa, 0x11, 0xae, 0x43, 0x05, 0x6e, 0x13,
+	0xe0, 0x7b, 0x0c, 0x22, 0xe0, 0x22, 0x0c, 0x22, 0xe0, 0x22, 0x0c, 0x22, 0xe0, 0x22, 0x0c, 0x22,
+	0xe0, 0x22, 0x0c, 0x22, 0xe0, 0x22, 0x0c, 0x22, 0xe0, 0x22, 0x0c, 0x22, 0xe0, 0x22, 0x0c, 0x22,
+	0xe0, 0x22, 0x0c, 0x22, 0xe0, 0x22, 0x0c, 0x22, 0xe0, 0x22, 0x0c, 0x22, 0x0c, 0x37, 0x00, 0x07,
+	0x00, 0x07, 0x00, 0x07, 0x00, 0xe2, 0x00, 0x07, 0x00, 0x07, 0x00, 0x07, 0x00, 0xc0, 0x28, 0x22,
+	0x0c, 0x22, 0xe0, 0x22, 0x0c, 0x22, 0xe0, 0x22, 0x0c, 0x22, 0xe0, 0x22, 0x0c, 0x22, 0xe0, 0x22,
+	0x0c, 0x22, 0xe0, 0x22, 0x0c, 0x22, 0xe0, 0x22, 0x0c, 0x22, 0xe0, 0x22, 0x0c, 0x22, 0xe0, 0x22,
+	0x0c, 0x22, 0xe0, 0x22, 0x0c, 0x22, 0xe0, 0x22, 0x0c, 0x22, 0xe0, 0x22, 0x0c, 0x37, 0x05, 0xfe,
+	0x25, 0x3b, 0x8e, 0xde, 0xfe, 0xa9, 0x6d, 0xa4, 0x66, 0x77, 0x0c, 0x22, 0xe0, 0x22, 0x0c, 0x22,
+	0xe0, 0x22, 0x0c, 0x22, 0xe0, 0x22, 0x0c, 0x22, 0xa3, 0x77, 0x95, 0xcc, 0x17, 0x7a, 0xac, 0x54,
+	0xfe, 0x81, 0x10, 0x00, 0x07, 0x00, 0x07, 0xe0, 0xfe, 0x35, 0xad, 0xfd, 0xc8, 0xcb, 0x00, 0xdf,
+	0xc6, 0xfe, 0xc3, 0x18, 0x00, 0x19, 0x00, 0x31, 0x00, 0xc0, 0xfe, 0x85, 0x43, 0xe0, 0x1a, 0x6f,
+	0x1a, 0xe0, 0x1a, 0x34, 0x1a, 0xe0, 0x1a, 0x34, 0x1a, 0xe0, 0x1a, 0x34, 0x1a, 0xe0, 0x1a, 0x34,
+	0x1a, 0x0c, 0xa2, 0x88, 0x1a, 0xfe, 0x80, 0x00, 0x00, 0xfe, 0xc6, 0x43, 0x37, 0x0c, 0xc0, 0x1a,
+	0x34, 0x1a, 0xe0, 0x1a, 0x34, 0x1a, 0xe0, 0x1a, 0x34, 0x1a, 0xe0, 0x1a, 0x34, 0x1a, 0xe0, 0x1a,
+	0x34, 0x1a, 0xe0, 0x1a, 0x34, 0x1a, 0xe0, 0x1a, 0x34, 0x1a, 0xe0, 0x1a, 0x34, 0x1a, 0xe0, 0x1a,
+	0x34, 0x1a, 0xe0, 0x1a, 0x34, 0x1a, 0xe0, 0x1a, 0x34, 0x1d, 0xfe, 0x24, 0x2a, 0x00, 0x19, 0x00,
+	0x31, 0x00, 0xc0, 0x02, 0xe0, 0x98, 0x99, 0xe0, 0xc0, 0x31, 0x00, 0x19, 0x00, 0xc0, 0xb5, 0x42,
+	0x13, 0x1a, 0xe0, 0x1a, 0x34, 0x1a, 0xe0, 0x1a, 0x34, 0x1a, 0xe0, 0x1a, 0x34, 0x1a, 0xe0, 0x1a,
+	0x34, 0x1a, 0xe0, 0x1a, 0x34, 0x1a, 0xe0, 0x1a, 0x34, 0x1a, 0xe0, 0x1a, 0x34, 0x1a, 0xe0, 0x1a,
+	0x34, 0x1a, 0xe0, 0x1a, 0x34, 0x1a, 0xe0, 0x1a, 0x34, 0x1a, 0xe0, 0xc0, 0x13, 0xa4, 0x66, 0x30,
+	0x00, 0xa8, 0x76, 0xfe, 0xc9, 0x65, 0x05, 0x9d, 0x99, 0x34, 0x1a, 0xe0, 0x1a, 0x34, 0x1a, 0xe0,
+	0x1a, 0x34, 0x1a, 0xe0, 0x1a, 0x34, 0x1a, 0xe0, 0x1a, 0x34, 0x1a, 0x0c, 0x05, 0x8a, 0xdf, 0x00,
+	0x31, 0x00, 0x19, 0x00, 0xc0, 0xfe, 0x5d, 0xef, 0xfd, 0xc8, 0xc8, 0x00, 0xdf, 0xc6, 0x89, 0x99,
+	0xe0, 0xc0, 0x07, 0x00, 0x07, 0xe0, 0xc0, 0xfe, 0x68, 0x65, 0x22, 0x0c, 0x22, 0xe0, 0x22, 0x0c,
+	0x22, 0xe0, 0x22, 0x0c, 0x22, 0xe0, 0x22, 0x0c, 0x22, 0xe0, 0x22, 0x0c, 0x22, 0xe0, 0x22, 0x0c,
+	0xa3, 0x98, 0x96, 0x9b, 0x07, 0x00, 0xaf, 0x54, 0x1a, 0x21, 0x0c, 0x22, 0xe0, 0x22, 0x0c, 0x22,
+	0xe0, 0x22, 0x0c, 0x22, 0xe0, 0x22, 0x0c, 0x22, 0xe0, 0x22, 0x0c, 0x22, 0xe0, 0x22, 0x0c, 0x22,
+	0xe0, 0x22, 0x0c, 0x22, 0xe0, 0x22, 0x0c, 0x22, 0xe0, 0x22, 0x0c, 0x22, 0xe0, 0x22, 0x0c, 0x22,
+	0xe0, 0x22, 0x0c, 0x22, 0x5d, 0x27, 0x00, 0x07, 0x00, 0x07, 0xe0, 0xbf, 0x99, 0xe0, 0x8c, 0x99,
+	0xe0, 0x07, 0x00, 0x07, 0x00, 0x07, 0xe0, 0x16, 0x0c, 0x22, 0xe0, 0x22, 0x0c, 0x22, 0xe0, 0x22,
+	0x0c, 0x22, 0xe0, 0x22, 0x0c, 0x22, 0xe0, 0x22, 0x0c, 0x22, 0xe0, 0x22, 0x0c, 0x22, 0xe0, 0x22,
+	0x0c, 0x22, 0xe0, 0x22, 0x0c, 0x22, 0xe0, 0x22, 0x0c, 0x22, 0xe0, 0x22, 0x0c, 0x22, 0xe0, 0x22,
+	0x0c, 0x22, 0x08, 0x96, 0xac, 0xfe, 0xc3, 0x21, 0x00, 0xa1, 0xa9, 0xfe, 0xea, 0x6d, 0x05, 0x22,
+	0x0c, 0x22, 0x0c, 0x22, 0xe0, 0x22, 0x0c, 0x22, 0xe0, 0x22, 0x0c, 0x22, 0xe0, 0x22, 0x0c, 0x22,
+	0xe0, 0x22, 0x0c, 0x22, 0x1a, 0x98, 0xab, 0x00, 0x07, 0x00, 0x07, 0x00, 0x07, 0xb9, 0x88, 0xfe,
+	0xff, 0xff, 0xdf, 0xc6, 0xbd, 0x00, 0xdf, 0xc7, 0xe1, 0xc0, 0x19, 0x00, 0x31, 0xe0, 0xc0, 0x1a,
+	0xc1, 0x6f, 0x1a, 0xe0, 0x1a, 0x34, 0x1a, 0xe0, 0x1a, 0x34, 0x1a, 0xe0, 0x1a, 0x34, 0x1a, 0xe0,
+	0x1a, 0x34, 0x1a, 0xe0, 0x1a, 0x34, 0x28, 0x90, 0xcd, 0x00, 0xc0, 0x31, 0xbc, 0x20, 0x28, 0x05,
+	0x1a, 0xe0, 0x1a, 0x34, 0x1a, 0xe0, 0x1a, 0x34, 0x1a, 0xe0, 0x1a, 0x34, 0x1a, 0xe0, 0x1a, 0x34,
+	0x1a, 0xe0, 0x1a, 0x34, 0x1a, 0xe0, 0x1a, 0x34, 0x1a, 0xe0, 0x1a, 0x34, 0x1a, 0xe0, 0x1a, 0x34,
+	0x1a, 0xe0, 0x1a, 0x34, 0x1a, 0xe0, 0x1a, 0x16, 0xfe, 0xc2, 0x21, 0x31, 0x00, 0x19, 0x00, 0x31,
+	0x00, 0xe0, 0x00, 0x31, 0x00, 0x19, 0x00, 0x31, 0x00, 0xb3, 0x43, 0x3e, 0xe0, 0x1a, 0x6f, 0x1a,
+	0xe0, 0x1a, 0x34, 0x1a, 0xe0, 0x1a, 0x34, 0x1a, 0xe0, 0x1a, 0x34, 0x1a, 0xe0, 0x1a, 0x34, 0x1a,
+	0xe0, 0x1a, 0x34, 0x1a, 0xe0, 0x1a, 0x34, 0x1a, 0xe0, 0x1a, 0x34, 0x1a, 0xe0, 0x1a, 0x34, 0x1a,
+	0xe0, 0x1a, 0x34, 0xa2, 0x76, 0x05, 0x8a, 0xde, 0x23, 0x00, 0xc0, 0xfe, 0xc9, 0x6d, 0x37, 0x1a,
+	0x0c, 0x1a, 0x34, 0x1a, 0xe0, 0x1a, 0x34, 0x1a, 0xe0, 0x1a, 0x34, 0x1a, 0xe0, 0x1a, 0x34, 0x1a,
+	0xe0, 0x1a, 0x34, 0x1a, 0xe0, 0x1a, 0xc0, 0x00, 0x31, 0x00, 0x19, 0x00, 0x31, 0x00, 0xfe, 0xbb,
+	0xde, 0xfd, 0xc9, 0xc2, 0x00, 0xdf, 0xc7, 0x11, 0xe0, 0x07, 0x00, 0x07, 0x00, 0x07, 0xe0, 0xc0,
+	0xe0, 0x13, 0x0c, 0x22, 0xe0, 0x22, 0x0c, 0x22, 0xe0, 0x22, 0x0c, 0x22, 0xe0, 0x22, 0x0c, 0x22,
+	0xe0, 0x22, 0x0c, 0x22, 0xe0, 0x22, 0x0c, 0x22, 0x0c, 0x21, 0xfe, 0xa6, 0x43, 0x00, 0xc0, 0xa2,
+	0x88, 0xae, 0x43, 0x22, 0x28, 0x22, 0x0c, 0x22, 0xe0, 0x22, 0x0c, 0x22, 0xe0, 0x22, 0x0c, 0x22,
+	0xe0, 0x22, 0x0c, 0x22, 0xe0, 0x22, 0x0c, 0x22, 0xe0, 0x22, 0x0c, 0x22, 0xe0, 0x22, 0x0c, 0x22,
+	0xe0, 0x22, 0x0c, 0x22, 0xe0, 0x22, 0x0c, 0x22, 0xe0, 0x22, 0x1a, 0x09, 0x00, 0x07, 0x00, 0x07,
+	0x00, 0xc0, 0xfe, 0x75, 0xad, 0xe0, 0xc0, 0x07, 0x00, 0x07, 0x00, 0xc0, 0x17, 0x22, 0xe0, 0x22,
+	0x0c, 0x22, 0xe0, 0x22, 0x0c, 0x22, 0xe0, 0x22, 0x0c, 0x22, 0xe0, 0x22, 0x0c, 0x22, 0xe0, 0x22,
+	0x0c, 0x22, 0xe0, 0x22, 0x0c, 0x22, 0xe0, 0x22, 0x0c, 0x22, 0xe0, 0x22, 0x0c, 0x22, 0xe0, 0x22,
+	0x0c, 0x22, 0x1a, 0xa6, 0x77, 0x29, 0xfe, 0xe3, 0x21, 0x00, 0xc1, 0xfe, 0xa8, 0x54, 0x08, 0x22,
+	0x0c, 0x22, 0xe0, 0x22, 0x0c, 0x22, 0xe0, 0x22, 0x0c, 0x22, 0xe0, 0x22, 0x0c, 0x22, 0xe0, 0x22,
+	0x0c, 0x22, 0xe0, 0x22, 0x0c, 0x22, 0xe0, 0x9a, 0xab, 0x00, 0x07, 0x00, 0x07, 0x00, 0x07, 0x00,
+	0xfe, 0x76, 0xb5, 0xb4, 0x77, 0xdf, 0xc7, 0xc1, 0x00, 0xdf, 0xc7, 0x66, 0xe0, 0xc0, 0x31, 0x00,
+	0x19, 0x00, 0x31, 0xe0, 0xc0, 0xfe, 0xe6, 0x43, 0x37, 0x1a, 0x6f, 0x1a, 0xe0, 0x1a, 0x34, 0x1a,
+	0xe0, 0x1a, 0x34, 0x1a, 0xe0, 0x1a, 0x34, 0x1a, 0xe0, 0x1a, 0x34, 0x1a, 0xe0, 0x1a, 0x34, 0x1a,
+	0x34, 0x28, 0x3f, 0x00, 0xc1, 0xa9, 0x76, 0xb9, 0x20, 0x21, 0x1a, 0x34, 0x1a, 0xe0, 0x1a, 0x34,
+	0x1a, 0xe0, 0x1a, 0x34, 0x1a, 0xe0, 0x1a, 0x34, 0x1a, 0xe0, 0x1a, 0x34, 0x1a, 0xe0, 0x1a, 0x34,
+	0x1a, 0xe0, 0x1a, 0x34, 0x1a, 0xe0, 0x1a, 0x34, 0x1a, 0xe0, 0x1a, 0x34, 0x1a, 0x0c, 0x28, 0xfe,
+	0x21, 0x11, 0x00, 0x31, 0x00, 0x19, 0xe0, 0xa2, 0x88, 0xe0, 0x19, 0x00, 0x31, 0x00, 0x31, 0xa7,
+	0x66, 0xfe, 0x0b, 0x87, 0x1a, 0x34, 0x1a, 0xe0, 0x1a, 0x34, 0x1a, 0xe0, 0x1a, 0x34, 0x1a, 0xe0,
+	0x1a, 0x34, 0x1a, 0xe0, 0x1a, 0x34, 0x1a, 0xe0, 0x1a, 0x34, 0x1a, 0xe0, 0x1a, 0x34, 0x1a, 0xe0,
+	0x1a, 0x34, 0x1a, 0xe0, 0x1a, 0x34, 0x1a, 0xe0, 0xa7, 0x76, 0x91, 0xce, 0x23, 0x00, 0xc1, 0xb7,
+	0x31, 0x08, 0x0c, 0x34, 0x1a, 0xe0, 0x1a, 0x34, 0x1a, 0xe0, 0x1a, 0x34, 0x1a, 0xe0, 0x1a, 0x34,
+	0x1a, 0xe0, 0x1a, 0x34, 0x1a, 0xe0, 0x1a, 0x34, 0x1a, 0xe0, 0x37, 0x8d, 0xde, 0x00, 0x31, 0x00,
+	0x19, 0x00, 0x31, 0x00, 0xc0, 0xfe, 0x79, 0xce, 0xfd, 0xca, 0xc0, 0x00, 0xdf, 0xc7, 0x10, 0xe0,
+	0x07, 0x00, 0x07, 0x00, 0x07, 0x00, 0x07, 0xe0, 0xc0, 0xba, 0x20, 0xba, 0x31, 0x0c, 0x7b, 0xe0,
+	0x22, 0x0c, 0x22, 0xe0, 0x22, 0x0c, 0x22, 0xe0, 0x22, 0x0c, 0x22, 0xe0, 0x22, 0x0c, 0x22, 0xe0,
+	0x22, 0x0c, 0x22, 0x0c, 0x22, 0x0c, 0x16, 0xfe, 0x23, 0x19, 0xe0, 0xc1, 0xa7, 0x66, 0x3f, 0x16,
+	0x13, 0xe0, 0x22, 0x0c, 0x22, 0xe0, 0x22, 0x0c, 0x22, 0xe0, 0x22, 0x0c, 0x22, 0xe0, 0x22, 0x0c,
+	0x22, 0xe0, 0x22, 0x0c, 0x22, 0xe0, 0x22, 0x0c, 0x22, 0xe0, 0x22, 0x0c, 0x22, 0xe0, 0x22, 0x0c,
+	0x22, 0xe0, 0x05, 0xfe, 0x05, 0x33, 0x27, 0x69, 0x07, 0x00, 0x07, 0x00, 0x07, 0x00, 0x07, 0x00,
+	0x07, 0x00, 0x14, 0x1a, 0x22, 0x0c, 0x22, 0xe0, 0x22, 0x0c, 0x22, 0xe0, 0x22, 0x0c, 0x22, 0xe0,
+	0x22, 0x0c, 0x22, 0xe0, 0x22, 0x0c, 0x22, 0xe0, 0x22, 0x0c, 0x22, 0xe0, 0x22, 0x0c, 0x22, 0xe0,
+	0x22, 0x0c, 0x22, 0xe0, 0x22, 0x5d, 0x30, 0x86, 0xdf, 0x8e, 0xce, 0x00, 0x07, 0xe0, 0xb8, 0x31,
+	0x05, 0x13, 0x0c, 0x22, 0x0c, 0x22, 0xe0, 0x22, 0x0c, 0x22, 0xe0, 0x22, 0x0c, 0x22, 0xe0, 0x22,
+	0x0c, 0x22, 0xe0, 0x22, 0x0c, 0x22, 0xe0, 0x22, 0x0c, 0x22, 0x37, 0xfe, 0xe5, 0x3a, 0x00, 0x07,
+	0x00, 0x07, 0x00, 0x07, 0x00, 0x07, 0xe0, 0xfe, 0x92, 0x94, 0xfd, 0xca, 0xb8, 0x00, 0xdf, 0xc7,
+	0x8b, 0x99, 0xe0, 0xc0, 0x19, 0x00, 0x6e, 0x00, 0xc4, 0xfe, 0x85, 0x3b, 0x13, 0x1a, 0x34, 0x1a,
+	0xe0, 0x1a, 0x34, 0x1a, 0xe0, 0x1a, 0x34, 0x1a, 0xe0, 0x1a, 0x34, 0x1a, 0xe0, 0x1a, 0x34, 0x1a,
+	0xe0, 0x1a, 0x34, 0x1a, 0xe0, 0x1a, 0x05, 0x2f, 0x35, 0xe0, 0x19, 0x00, 0xa2, 0x77, 0xba, 0x30,
+	0x05, 0x2f, 0xe0, 0x1a, 0x34, 0x1a, 0xe0, 0x1a, 0x34, 0x1a, 0xe0, 0x1a, 0x34, 0x1a, 0xe0, 0x1a,
+	0x34, 0x1a, 0xe0, 0x1a, 0x34, 0x1a, 0xe0, 0x1a, 0x34, 0x1a, 0xe0, 0x1a, 0x34, 0x1a, 0xe0, 0x1a,
+	0x34, 0x1a, 0x09, 0x00, 0x19, 0x00, 0x31, 0x00, 0x19, 0x00, 0x31, 0x00, 0x19, 0x00, 0xc0, 0xfe,
+	0x88, 0x65, 0x34, 0x1a, 0xe0, 0x1a, 0x34, 0x1a, 0xe0, 0x1a, 0x34, 0x1a, 0xe0, 0x1a, 0x34, 0x1a,
+	0xe0, 0x1a, 0x34, 0x1a, 0xe0, 0x1a, 0x34, 0x1a, 0xe0, 0x1a, 0x34, 0x1a, 0xe0, 0x1a, 0x34, 0x1a,
+	0xe0, 0x1a, 0x13, 0x28, 0x0d, 0x23, 0x00, 0xc1, 0xa4, 0x88, 0x13, 0x0c, 0xc0, 0x1a, 0x34, 0x1a,
+	0xe0, 0x1a, 0x34, 0x1a, 0xe0, 0x1a, 0x34, 0x1a, 0xe0, 0x1a, 0x34, 0x1a, 0xe0, 0x1a, 0x34, 0x1a,
+	0xe0, 0x1a, 0x34, 0x1a, 0xe0, 0x1a, 0x8a, 0xdf, 0x00, 0x6e, 0x00, 0xc0, 0x2e, 0x31, 0x00, 0x19,
+	0x00, 0x31, 0xba, 0x88, 0xfd, 0xca, 0xc2, 0x00, 0xdf, 0xc7, 0x90, 0x99, 0xe0, 0x07, 0x00, 0x07,
+	0x00, 0x27, 0xb3, 0x42, 0x05, 0x8c, 0xce, 0x22, 0x09, 0x05, 0x0c, 0x7b, 0x0c, 0x22, 0xe0, 0x22,
+	0x0c, 0x22, 0xe0, 0x22, 0x0c, 0x22, 0xe0, 0x22, 0x0c, 0x22, 0xe0, 0x22, 0x0c, 0x22, 0xe0, 0x22,
+	0x0c, 0x22, 0xe0, 0x22, 0x0c, 0x22, 0x05, 0x09, 0x00, 0x19, 0x00, 0xc1, 0xbb, 0x30, 0x3e, 0xa2,
+	0x88, 0x1a, 0x22, 0xe0, 0x22, 0x0c, 0x22, 0xe0, 0x22, 0x0c, 0x22, 0xe0, 0x22, 0x0c, 0x22, 0xe0,
+	0x22, 0x0c, 0x22, 0xe0, 0x22, 0x0c, 0x22, 0xe0, 0x22, 0x0c, 0x22, 0xe0, 0x22, 0x0c, 0x22, 0x37,
+	0xe0, 0xc0, 0x07, 0x00, 0x07, 0x00, 0x07, 0x00, 0x07, 0x00, 0x07, 0xa2, 0x76, 0xfe, 0x8b, 0x7e,
+	0x0c, 0x22, 0xe0, 0x22, 0x0c, 0x22, 0xe0, 0x22, 0x0c, 0x22, 0xe0, 0x22, 0x0c, 0x22, 0xe0, 0x22,
+	0x0c, 0x22, 0xe0, 0x22, 0x0c, 0x22, 0xe0, 0x22, 0x0c, 0x22, 0xe0, 0x22, 0x0c, 0x22, 0x05, 0x13,
+	0x8c, 0xcd, 0x00, 0xc0, 0x07, 0xe1, 0x09, 0x37, 0x0c, 0x22, 0xe0, 0x22, 0x0c, 0x22, 0xe0, 0x22,
+	0x0c, 0x22, 0xe0, 0x22, 0x0c, 0x22, 0xe0, 0x22, 0x0c, 0x22, 0xe0, 0x22, 0x0c, 0x22, 0xe0, 0x22,
+	0x0c, 0x22, 0xe0, 0x22, 0x5d, 0x90, 0xce, 0x8d, 0xde, 0xb1, 0x53, 0xb2, 0x42, 0xfe, 0x44, 0x2a,
+	0x00, 0x07, 0x00, 0x07, 0x00, 0xfe, 0x31, 0x8c, 0xfd, 0xca, 0xc0, 0x00, 0xdf, 0xc7, 0x9c, 0x99,
+	0xe0, 0xc0, 0x31, 0x00, 0x19, 0x00, 0xc0, 0xfe, 0xe7, 0x54, 0x05, 0x2f, 0x13, 0x1a, 0x6f, 0x1a,
+	0xe0, 0x1a, 0x34, 0x1a, 0xe0, 0x1a, 0x34, 0x1a, 0xe0, 0x1a, 0x34, 0x1a, 0xe0, 0x1a, 0x34, 0x1a,
+	0xe0, 0x1a, 0x34, 0x1a, 0xe0, 0x1a, 0x34, 0x1a, 0xe0, 0x1a, 0x34, 0x3e, 0x05, 0x14, 0xe1, 0x31,
+	0x00, 0xc0, 0xfe, 0x85, 0x3b, 0x22, 0x05, 0x34, 0x1a, 0xe0, 0x1a, 0x34, 0x1a, 0xe0, 0x1a, 0x34,
+	0x1a, 0xe0, 0x1a, 0x34, 0x1a, 0xe0, 0x1a, 0x34, 0x1a, 0xe0, 0x1a, 0x34, 0x1a, 0xe0, 0x1a, 0x34,
+	0x1a, 0xe0, 0x1a, 0xa5, 0x87, 0xfe, 0x21, 0x11, 0x31, 0x00, 0x19, 0x00, 0x31, 0x00, 0x19, 0x00,
+	0x31, 0x00, 0xaf, 0x54, 0x28, 0xe0, 0x1a, 0x34, 0x1a, 0xe0, 0x1a, 0x34, 0x1a, 0xe0, 0x1a, 0x34,
+	0x1a, 0xe0, 0x1a, 0x34, 0x1a, 0xe0, 0x1a, 0x34, 0x1a, 0xe0, 0x1a, 0x34, 0x1a, 0xe0, 0x1a, 0x34,
+	0x1a, 0xa4, 0x77, 0x0c, 0xfe, 0x66, 0x43, 0x00, 0xc1, 0x31, 0x00, 0x14, 0x05, 0x13, 0x1a, 0xe0,
+	0x1a, 0x34, 0x1a, 0xe0, 0x1a, 0x34, 0x1a, 0xe0, 0x1a, 0x34, 0x1a, 0xe0, 0x1a, 0x34, 0x1a, 0xe0,
+	0x1a, 0x34, 0x1a, 0xe0, 0x1a, 0x34, 0x1a, 0xe0, 0x1a, 0x34, 0x1a, 0x0c, 0x3e, 0x05, 0x3e, 0x93,
+	0xcd, 0x00, 0x19, 0x00, 0x31, 0x00, 0xc0, 0xfe, 0x75, 0xad, 0xfd, 0xca, 0xbc, 0x00, 0xdf, 0xc8,
+	0xfe, 0x69, 0x4a, 0x07, 0x00, 0x07, 0x00, 0x07, 0xe0, 0xa3, 0x88, 0x1a, 0x6b, 0x0c, 0x22, 0x0c,
+	0x22, 0xe0, 0x22, 0x0c, 0x22, 0xe0, 0x22, 0x0c, 0x22, 0xe0, 0x22, 0x0c, 0x22, 0xe0, 0x22, 0x0c,
+	0x22, 0xe0, 0x22, 0x0c, 0x22, 0xe0, 0x22, 0x0c, 0x22, 0xe0, 0x22, 0x0c, 0x22, 0x1a, 0x37, 0x1a,
+	0xfe, 0x43, 0x19, 0x00, 0x07, 0xe0, 0xc1, 0x10, 0x37, 0x13, 0xe0, 0x22, 0x0c, 0x22, 0xe0, 0x22,
+	0x0c, 0x22, 0xe0, 0x22, 0x0c, 0x22, 0xe0, 0x22, 0x0c, 0x22, 0xe0, 0x22, 0x0c, 0x22, 0xe0, 0x22,
+	0x0c, 0x22, 0xe0, 0x22, 0x28, 0xfe, 0x64, 0x32, 0x00, 0x07, 0x00, 0x07, 0x00, 0x07, 0x00, 0x07,
+	0x00, 0x7b, 0xb7, 0x21, 0x13, 0xe0, 0x7b, 0x0c, 0x22, 0xe0, 0x22, 0x0c, 0x22, 0xe0, 0x22, 0x0c,
+	0x22, 0xe0, 0x22, 0x0c, 0x22, 0xe0, 0x22, 0x0c, 0x22, 0xe0, 0x22, 0x0c, 0x22, 0xe0, 0x22, 0x13,
+	0x37, 0x8c, 0xce, 0x00, 0xc0, 0x07, 0xe1, 0xa8, 0x66, 0x13, 0x05, 0x62, 0x0c, 0x22, 0xe0, 0x22,
+	0x0c, 0x22, 0xe0, 0x22, 0x0c, 0x22, 0xe0, 0x22, 0x0c, 0x22, 0xe0, 0x22, 0x0c, 0x22, 0xe0, 0x22,
+	0x0c, 0x22, 0xe0, 0x22, 0x0c, 0x22, 0xe0, 0x22, 0x0c, 0x22, 0xe0, 0x22, 0x1a, 0x22, 0x00, 0x07,
+	0x00, 0x07, 0x00, 0x07, 0xe0, 0xfe, 0xdf, 0xff, 0xfd, 0xca, 0xbd, 0x00, 0xdf, 0xc8, 0x9a, 0x88,
+	0x00, 0x19, 0x00, 0x6e, 0x00, 0x19, 0x00, 0xc0, 0x05, 0x1a, 0xc0, 0xe0, 0x1a, 0x34, 0x1a, 0xe0,
+	0x1a, 0x34, 0x1a, 0xe0, 0x1a, 0x34, 0x1a, 0xe0, 0x1a, 0x34, 0x1a, 0xe0, 0x1a, 0x34, 0x1a, 0xe0,
+	0x1a, 0x34, 0x1a, 0xe0, 0x1a, 0x34, 0x1a, 0xe0, 0x1a, 0x34, 0x1a, 0x0c, 0x05, 0x09, 0x00, 0x31,
+	0xe0, 0x19, 0x00, 0x15, 0xfe, 0x87, 0x54, 0x08, 0x1a, 0xe0, 0x1a, 0x34, 0x1a, 0xe0, 0x1a, 0x34,
+	0x1a, 0xe0, 0x1a, 0x34, 0x1a, 0xe0, 0x1a, 0x34, 0x1a, 0xe0, 0x1a, 0x34, 0x1a, 0xe0, 0x1a, 0x34,
+	0x1a, 0x37, 0xfe, 0x84, 0x2a, 0xe0, 0xc0, 0x31, 0x00, 0x19, 0x00, 0x31, 0x00, 0x19, 0x00, 0xb9,
+	0x31, 0x0c, 0x34, 0x1a, 0xe0, 0x1a, 0x34, 0x1a, 0xe0, 0x1a, 0x34, 0x1a, 0xe0, 0x1a, 0x34, 0x1a,
+	0xe0, 0x1a, 0x34, 0x1a, 0xe0, 0x1a, 0x34, 0x1a, 0xe0, 0x1a, 0xc0, 0x28, 0x8e, 0xce, 0x00, 0xc1,
+	0x31, 0xc0, 0xe0, 0xfe, 0x48, 0x5d, 0x37, 0x1a, 0x34, 0x1a, 0xe0, 0x1a, 0x34, 0x1a, 0xe0, 0x1a,
+	0x34, 0x1a, 0xe0, 0x1a, 0x34, 0x1a, 0xe0, 0x1a, 0x34, 0x1a, 0xe0, 0x1a, 0x34, 0x1a, 0xe0, 0x1a,
+	0x34, 0x1a, 0xe0, 0x1a, 0x34, 0x1a, 0xe0, 0x1a, 0x34, 0x1a, 0x05, 0x00, 0x19, 0x00, 0x31, 0x00,
+	0x19, 0x31, 0xfe, 0xf4, 0xa4, 0xb8, 0x77, 0xdf, 0xc8, 0xb6, 0x00, 0xdf, 0xc9, 0x3a, 0x31, 0x07,
+	0x00, 0x07, 0x00, 0x07, 0x31, 0x27, 0x0c, 0x34, 0xe0, 0x7b, 0x0c, 0x22, 0xe0, 0x22, 0x0c, 0x22,
+	0xe0, 0x22, 0x0c, 0x22, 0xe0, 0x22, 0x0c, 0x22, 0xe0, 0x22, 0x0c, 0x22, 0xe0, 0x22, 0x0c, 0x22,
+	0xe0, 0x22, 0x0c, 0x22, 0xe0, 0x22, 0x0c, 0x22, 0xe0, 0x22, 0x13, 0xc0, 0x88, 0xdf, 0xe0, 0xc0,
+	0x07, 0x00, 0xc1, 0xfe, 0x28, 0x5d, 0x28, 0x9c, 0xaa, 0x0c, 0x22, 0xe0, 0x22, 0x0c, 0x22, 0xe0,
+	0x22, 0x0c, 0x22, 0xe0, 0x22, 0x0c, 0x22, 0xe0, 0x22, 0x0c, 0x22, 0xe0, 0x22, 0x0c, 0x22, 0x13,
+	0x88, 0xdf, 0xe0, 0x07, 0x00, 0x07, 0x00, 0x07, 0x00, 0x07, 0x00, 0xc0, 0x25, 0xb4, 0x43, 0x0c,
+	0x22, 0xe0, 0x22, 0x0c, 0x22, 0xe0, 0x22, 0x0c, 0x22, 0xe0, 0x22, 0x0c, 0x22, 0xe0, 0x22, 0x0c,
+	0x22, 0xe0, 0x22, 0x0c, 0x22, 0x1a, 0xa6, 0x77, 0x3b, 0x27, 0x00, 0x07, 0xe0, 0x07, 0x00, 0x1b,
+	0x05, 0x13, 0x0c, 0x22, 0x0c, 0x22, 0xe0, 0x22, 0x0c, 0x22, 0xe0, 0x22, 0x0c, 0x22, 0xe0, 0x22,
+	0x0c, 0x22, 0xe0, 0x22, 0x0c, 0x22, 0xe0, 0x22, 0x0c, 0x22, 0xe0, 0x22, 0x0c, 0x22, 0xe0, 0x22,
+	0x0c, 0x22, 0xe0, 0x22, 0x1a, 0x05, 0x15, 0x07, 0x00, 0x07, 0x00, 0x07, 0xe0, 0x00, 0x18, 0xdf,
+	0xc9, 0xba, 0x00, 0xdf, 0xc9, 0x66, 0xfe, 0xe8, 0x41, 0x31, 0x19, 0x00, 0x31, 0x00, 0x19, 0x00,
+	0xc0, 0x1a, 0x22, 0x1a, 0xe0, 0x1a, 0x34, 0x1a, 0xe0, 0x1a, 0x34, 0x1a, 0xe0, 0x1a, 0x34, 0x1a,
+	0xe0, 0x1a, 0x34, 0x1a, 0xe0, 0x1a, 0x34, 0x1a, 0xe0, 0x1a, 0x34, 0x1a, 0xe0, 0x1a, 0x34, 0x1a,
+	0xe0, 0x1a, 0x34, 0x1a, 0x0c, 0x1a, 0xa5, 0x87, 0x1e, 0xe0, 0xc0, 0x19, 0xe0, 0x31, 0x00, 0x0a,
+	0xfe, 0xc9, 0x65, 0x37, 0x1a, 0x34, 0x1a, 0xe0, 0x1a, 0x34, 0x1a, 0xe0, 0x1a, 0x34, 0x1a, 0xe0,
+	0x1a, 0x34, 0x1a, 0xe0, 0x1a, 0x34, 0x1a, 0xe0, 0x1a, 0x05, 0xfe, 0xc4, 0x32, 0xe0, 0xc0, 0x19,
+	0x00, 0x31, 0x00, 0x19, 0x00, 0x31, 0xe0, 0x14, 0x0c, 0xc0, 0x1a, 0x34, 0x1a, 0xe0, 0x1a, 0x34,
+	0x1a, 0xe0, 0x1a, 0x34, 0x1a, 0xe0, 0x1a, 0x34, 0x1a, 0xe0, 0x1a, 0x34, 0x1a, 0xe0, 0x05, 0xe0,
+	0x2a, 0x00, 0xc0, 0x19, 0x00, 0x31, 0x00, 0xfe, 0x69, 0x65, 0x37, 0x0c, 0x1a, 0x34, 0x1a, 0xe0,
+	0x1a, 0x34, 0x1a, 0xe0, 0x1a, 0x34, 0x1a, 0xe0, 0x1a, 0x34, 0x1a, 0xe0, 0x1a, 0x34, 0x1a, 0xe0,
+	0x1a, 0x34, 0x1a, 0xe0, 0x1a, 0x34, 0x1a, 0xe0, 0x1a, 0x34, 0x1a, 0xe0, 0x1a, 0x34, 0x0c, 0xc0,
+	0x00, 0x19, 0x00, 0x31, 0x00, 0x19, 0x00, 0xc0, 0xfe, 0x5d, 0xef, 0xfd, 0xcc, 0xba, 0x00, 0xdf,
+	0xca, 0x34, 0x00, 0xc0, 0x07, 0x00, 0x07, 0x00, 0x07, 0xe0, 0xc0, 0xfe, 0x89, 0x65, 0x13, 0xe0,
+	0x22, 0x0c, 0x22, 0xe0, 0x22, 0x0c, 0x22, 0xe0, 0x22, 0x0c, 0x22, 0xe0, 0x22, 0x0c, 0x22, 0xe0,
+	0x22, 0x0c, 0x22, 0xe0, 0x22, 0x0c, 0x22, 0xe0, 0x22, 0x0c, 0x22, 0xe0, 0x22, 0x0c, 0x22, 0xe0,
+	0x22, 0x0c, 0x13, 0x37, 0x10, 0x00, 0x07, 0x00, 0x07, 0x00, 0xc0, 0xfe, 0xa5, 0x43, 0x05, 0x56,
+	0x22, 0xe0, 0x22, 0x0c, 0x22, 0xe0, 0x22, 0x0c, 0x22, 0xe0, 0x22, 0x0c, 0x22, 0xe0, 0x22, 0x0c,
+	0x22, 0xe0, 0x22, 0x28, 0xfe, 0x43, 0x2a, 0xe0, 0x07, 0x00, 0x07, 0x00, 0x07, 0x00, 0x07, 0x00,
+	0x07, 0x38, 0x05, 0xe0, 0x22, 0x0c, 0x22, 0xe0, 0x22, 0x0c, 0x22, 0xe0, 0x22, 0x0c, 0x22, 0xe0,
+	0x22, 0x0c, 0x22, 0xe0, 0x22, 0x0c, 0x13, 0x05, 0x90, 0xcd, 0x00, 0x07, 0xe0, 0x07, 0x00, 0xc0,
+	0xfe, 0xc6, 0x43, 0xb6, 0x42, 0x0c, 0x22, 0xe0, 0x22, 0x0c, 0x22, 0xe0, 0x22, 0x0c, 0x22, 0xe0,
+	0x22, 0x0c, 0x22, 0xe0, 0x22, 0x0c, 0x22, 0xe0, 0x22, 0x0c, 0x22, 0xe0, 0x22, 0x0c, 0x22, 0xe0,
+	0x22, 0x0c, 0x22, 0xe0, 0x22, 0x0c, 0x22, 0xe0, 0x22, 0x0c, 0x6b, 0x00, 0x07, 0x00, 0x07, 0x00,
+	0x07, 0x00, 0xc0, 0xfe, 0xf7, 0xbd, 0x18, 0xdf, 0xca, 0xb8, 0x00, 0xdf, 0xca, 0x95, 0x99, 0xe0,
+	0x31, 0x00, 0x19, 0x00, 0x31, 0x00, 0x19, 0xe0, 0xc0, 0xfe, 0x88, 0x65, 0x22, 0x1a, 0xe0, 0x1a,
+	0x34, 0x1a, 0xe0, 0x1a, 0x34, 0x1a, 0xe0, 0x1a, 0x34, 0x1a, 0xe0, 0x1a, 0x34, 0x1a, 0xe0, 0x1a,
+	0x34, 0x1a, 0xe0, 0x1a, 0x34, 0x1a, 0xe0, 0x1a, 0x34, 0x1a, 0xe0, 0x1a, 0x34, 0x1a, 0xe0, 0x1a,
+	0x34, 0x37, 0x2c, 0x00, 0xc1, 0x31, 0xe0, 0x31, 0xa6, 0x76, 0xfe, 0x48, 0x65, 0x37, 0x34, 0x1a,
+	0xe0, 0x1a, 0x34, 0x1a, 0xe0, 0x1a, 0x34, 0x1a, 0xe0, 0x1a, 0x34, 0x1a, 0xe0, 0x1a, 0x34, 0x1a,
+	0x08, 0x03, 0x19, 0x00, 0x31, 0x00, 0x19, 0x00, 0x31, 0x00, 0x19, 0x00, 0xae, 0x53, 0xfe, 0xaa,
+	0x76, 0x34, 0x65, 0xe0, 0x1a, 0x34, 0x1a, 0xe0, 0x1a, 0x34, 0x1a, 0xe0, 0x1a, 0x34, 0x1a, 0xe0,
+	0x1a, 0x34, 0x1a, 0x37, 0x1e, 0x00, 0xc0, 0x31, 0x00, 0x19, 0x00, 0x0e, 0x30, 0x37, 0x1a, 0xe0,
+	0x1a, 0x34, 0x1a, 0xe0, 0x1a, 0x34, 0x1a, 0xe0, 0x1a, 0x34, 0x1a, 0xe0, 0x1a, 0x34, 0x1a, 0xe0,
+	0x1a, 0x34, 0x1a, 0xe0, 0x1a, 0x34, 0x1a, 0xe0, 0x1a, 0x34, 0x1a, 0xe0, 0x1a, 0x34, 0x1a, 0xe0,
+	0x1a, 0x34, 0x69, 0x9a, 0xaa, 0x00, 0x19, 0x00, 0x31, 0x00, 0x19, 0x00, 0x31, 0xe0, 0xfe, 0xd7,
+	0xbd, 0xfd, 0xcd, 0xc0, 0x00, 0xdf, 0xca, 0x94, 0x88, 0xe0, 0xc0, 0x07, 0x00, 0x07, 0x00, 0xa9,
+	0x76, 0xa4, 0x66, 0x9b, 0xab, 0x3f, 0xb1, 0x54, 0x13, 0x22, 0xe0, 0x22, 0x59, 0x22, 0xe0, 0x22,
+	0x0c, 0x22, 0xe0, 0x22, 0x0c, 0x22, 0xe0, 0x22, 0x0c, 0x22, 0xe0, 0x22, 0x0c, 0x22, 0xe0, 0x22,
+	0x0c, 0x22, 0xe0, 0x22, 0x0c, 0x22, 0xe0, 0x22, 0x0c, 0x22, 0xe0, 0x22, 0x0c, 0x22, 0x0c, 0x3e,
+	0xfe, 0x25, 0x3b, 0xe0, 0xc0, 0x07, 0x00, 0x07, 0x00, 0xb6, 0x32, 0x13, 0xc0, 0xe0, 0x7b, 0x0c,
+	0x22, 0xe0, 0x22, 0x0c, 0x22, 0xe0, 0x22, 0x0c, 0x22, 0xe0, 0x22, 0x0c, 0x22, 0x51, 0x00, 0xc0,
+	0x07, 0x00, 0x07, 0x00, 0x07, 0x00, 0x07, 0x00, 0x07, 0x00, 0x05, 0x0c, 0x22, 0xe0, 0x22, 0x0c,
+	0x22, 0xe0, 0x22, 0x0c, 0x22, 0xe0, 0x22, 0x0c, 0x22, 0xe0, 0x22, 0x13, 0xc0, 0xfe, 0xc4, 0x32,
+	0x00, 0xc0, 0x07, 0x00, 0x07, 0x00, 0xbd, 0x20, 0x28, 0x22, 0x0c, 0x22, 0xe0, 0x22, 0x0c, 0x22,
+	0xe0, 0x22, 0x0c, 0x22, 0xe0, 0x22, 0x0c, 0x22, 0xe0, 0x22, 0x0c, 0x22, 0xe0, 0x22, 0x0c, 0x22,
+	0xe0, 0x22, 0x0c, 0x22, 0xe0, 0x22, 0x0c, 0x22, 0xe0, 0x22, 0x0c, 0x22, 0xe0, 0x22, 0x0c, 0x37,
+	0x89, 0xef, 0xfe, 0xe2, 0x10, 0x6d, 0xa6, 0x77, 0x99, 0xaa, 0x9a, 0xab, 0x00, 0x07, 0x00, 0x19,
+	0xfe, 0xf3, 0x9c, 0xfd, 0xcd, 0xbd, 0x00, 0xdf, 0xca, 0x97, 0x99, 0xe0, 0x19, 0x00, 0x31, 0x00,
+	0x19, 0xa4, 0x86, 0x37, 0xa2, 0x77, 0x7b, 0x0c, 0xc0, 0x66, 0x34, 0x1a, 0xe0, 0x1a, 0x34, 0x1a,
+	0xe0, 0x1a, 0x34, 0x1a, 0xe0, 0x1a, 0x34, 0x1a, 0xe0, 0x1a, 0x34, 0x1a, 0xe0, 0x1a, 0x34, 0x1a,
+	0xe0, 0x1a, 0x34, 0x1a, 0xe0, 0x1a, 0x34, 0x1a, 0xe0, 0x1a, 0x34, 0x1a, 0xe0, 0x1a, 0x34, 0x1a,
+	0x05, 0x91, 0xbd, 0xe0, 0xc0, 0x31, 0x00, 0x19, 0x00, 0xc0, 0xfe, 0x48, 0x5d, 0x05, 0x1a, 0xe0,
+	0x1a, 0x34, 0x1a, 0xe0, 0x1a, 0x34, 0x1a, 0xe0, 0x1a, 0x34, 0x1a, 0xe0, 0xc0, 0x8c, 0xdf, 0xe0,
+	0x31, 0x00, 0x19, 0x00, 0x31, 0x00, 0x19, 0x00, 0x31, 0x00, 0xc0, 0xfe, 0x06, 0x44, 0xe0, 0x1a,
+	0x34, 0x1a, 0xe0, 0x1a, 0x34, 0x1a, 0xe0, 0x1a, 0x34, 0x1a, 0xe0, 0x1a, 0x34, 0x1d, 0x95, 0xbd,
+	0x00, 0x31, 0xe0, 0x31, 0x00, 0xc1, 0xfe, 0x28, 0x5d, 0x37, 0x34, 0x1a, 0xe0, 0x1a, 0x34, 0x1a,
+	0xe0, 0x1a, 0x34, 0x1a, 0xe0, 0x1a, 0x34, 0x1a, 0xe0, 0x1a, 0x34, 0x1a, 0xe0, 0x1a, 0x34, 0x1a,
+	0xe0, 0x1a, 0x34, 0x1a, 0xe0, 0x1a, 0x34, 0x1a, 0xe0, 0x1a, 0x34, 0x1a, 0xe0, 0x1a, 0x34, 0x1a,
+	0xe0, 0x1a, 0x13, 0xa4, 0x66, 0x37, 0xc0, 0xfe, 0xc1, 0x08, 0x00, 0x31, 0x00, 0x19, 0x00, 0xfe,
+	0x18, 0xc6, 0xfd, 0xcd, 0xb6, 0x00, 0xdf, 0xcb, 0xe0, 0xc0, 0x07, 0x00, 0x07, 0x00, 0x07, 0x00,
+	0xfe, 0xea, 0x6d, 0x13, 0x22, 0xe0, 0x22, 0x0c, 0x22, 0xe0, 0x22, 0x0c, 0x22, 0xe0, 0x22, 0x0c,
+	0x22, 0xe0, 0x22, 0x0c, 0x22, 0xe0, 0x22, 0x0c, 0x22, 0xe0, 0x22, 0x0c, 0x22, 0xe0, 0x22, 0x0c,
+	0x22, 0xe0, 0x22, 0x0c, 0x22, 0xe0, 0x22, 0x0c, 0x22, 0xe0, 0x22, 0x0c, 0x22, 0x0c, 0x13, 0x05,
+	0xfe, 0xe3, 0x21, 0x00, 0x07, 0x00, 0x07, 0xe0, 0xc0, 0xb4, 0x42, 0x37, 0xe0, 0x22, 0x0c, 0x22,
+	0xe0, 0x22, 0x0c, 0x22, 0xe0, 0x22, 0x0c, 0x22, 0xe0, 0x21, 0x00, 0x07, 0x00, 0x07, 0x00, 0x07,
+	0x00, 0x07, 0x00, 0x07, 0x00, 0x07, 0xe0, 0xab, 0x65, 0x08, 0x22, 0x0c, 0x22, 0xe0, 0x22, 0x0c,
+	0x22, 0xe0, 0x22, 0x0c, 0x22, 0xe0, 0x13, 0x37, 0x14, 0x00, 0x07, 0x00, 0x07, 0x00, 0x27, 0xb3,
+	0x41, 0x37, 0x9c, 0x99, 0x22, 0x0c, 0x22, 0xe0, 0x22, 0x0c, 0x22, 0xe0, 0x22, 0x0c, 0x22, 0xe0,
+	0x22, 0x0c, 0x22, 0xe0, 0x22, 0x0c, 0x22, 0xe0, 0x22, 0x0c, 0x22, 0xe0, 0x22, 0x0c, 0x22, 0xe0,
+	0x22, 0x0c, 0x22, 0xe0, 0x22, 0x0c, 0x22, 0xe0, 0x22, 0x0c, 0x22, 0xe0, 0x22, 0x0c, 0x05, 0x1a,
+	0x00, 0xc0, 0x07, 0x00, 0x07, 0x00, 0xc0, 0xfe, 0xfb, 0xde, 0xfd, 0xcd, 0xbf, 0x00, 0xdf, 0xcb,
+	0x8c, 0x88, 0xe0, 0xc0, 0x19, 0x00, 0x31, 0x00, 0x19, 0x00, 0xfe, 0xc8, 0x5c, 0xab, 0x54, 0x67,
+	0x1a, 0xe0, 0x1a, 0x34, 0x1a, 0xe0, 0x1a, 0x34, 0x1a, 0xe0, 0x1a, 0x34, 0x1a, 0xe0, 0x1a, 0x34,
+	0x1a, 0xe0, 0x1a, 0x34, 0x1a, 0xe0, 0x1a, 0x34, 0x1a, 0xe0, 0x1a, 0x34, 0x1a, 0xe0, 0x1a, 0x34,
+	0x1a, 0xe0, 0x1a, 0x34, 0x1a, 0xe0, 0x1a, 0x34, 0x1a, 0x0c, 0x28, 0xfe, 0x66, 0x43, 0x00, 0x31,
+	0x00, 0x19, 0xe0, 0x31, 0x00, 0xfe, 0x48, 0x65, 0x3e, 0xe0, 0x1a, 0x34, 0x1a, 0xe0, 0x1a, 0x34,
+	0x1a, 0xe0, 0x1a, 0x13, 0x87, 0xdf, 0xe0, 0xc0, 0x19, 0x00, 0x31, 0x00, 0x19, 0x00, 0x31, 0x00,
+	0x19, 0x00, 0x31, 0x00, 0xfe, 0x87, 0x54, 0xac, 0x54, 0xc0, 0x1a, 0x34, 0x1a, 0xe0, 0x1a, 0x34,
+	0x1a, 0xe0, 0x1a, 0x05, 0x98, 0x9a, 0x00, 0xc0, 0x19, 0x00, 0x31, 0x00, 0xc0, 0xfe, 0xe6, 0x43,
+	0x08, 0x1a, 0x34, 0x1a, 0xe0, 0x1a, 0x34, 0x1a, 0xe0, 0x1a, 0x34, 0x1a, 0xe0, 0x1a, 0x34, 0x1a,
+	0xe0, 0x1a, 0x34, 0x1a, 0xe0, 0x1a, 0x34, 0x1a, 0xe0, 0x1a, 0x34, 0x1a, 0xe0, 0x1a, 0x34, 0x1a,
+	0xe0, 0x1a, 0x34, 0x1a, 0xe0, 0x1a, 0x34, 0x1a, 0xe0, 0x1a, 0x34, 0x1a, 0x13, 0x95, 0xab, 0x00,
+	0xc0, 0x31, 0x00, 0x19, 0x00, 0x31, 0xaa, 0x99, 0xfe, 0xff, 0xff, 0xdf, 0xcb, 0xb6, 0x00, 0xdf,
+	0xcc, 0xe0, 0x07, 0x00, 0x07, 0x00, 0x07, 0x00, 0x07, 0x00, 0xfe, 0x07, 0x4c, 0x37, 0x9d, 0xaa,
+	0xe0, 0x22, 0x0c, 0x22, 0xe0, 0x22, 0x0c, 0x22, 0xe0, 0x22, 0x0c, 0x22, 0xe0, 0x22, 0x0c, 0x22,
+	0xe0, 0x22, 0x0c, 0x22, 0xe0, 0x22, 0x0c, 0x22, 0xe0, 0x22, 0x0c, 0x22, 0xe0, 0x22, 0x0c, 0x22,
+	0xe0, 0x22, 0x0c, 0x22, 0xe0, 0x22, 0x0c, 0x22, 0xe0, 0x22, 0x37, 0x95, 0xbc, 0x00, 0x07, 0x00,
+	0x07, 0x00, 0x07, 0x00, 0xb7, 0x42, 0x08, 0x22, 0x0c, 0x22, 0xe0, 0x22, 0x0c, 0x22, 0xe0, 0x13,
+	0x9d, 0x99, 0x00, 0xc0, 0x07, 0x00, 0x07, 0x00, 0x07, 0x00, 0x07, 0x00, 0x07, 0x00, 0x07, 0x00,
+	0x07, 0x00, 0x13, 0xe0, 0x22, 0x0c, 0x22, 0xe0, 0x22, 0x0c, 0x22, 0xe0, 0xa4, 0x88, 0xfe, 0xe5,
+	0x32, 0x00, 0xc0, 0x07, 0x00, 0x07, 0x00, 0xa2, 0x88, 0x3b, 0x05, 0x0c, 0x22, 0x0c, 0x22, 0xe0,
+	0x22, 0x0c, 0x22, 0xe0, 0x22, 0x0c, 0x22, 0xe0, 0x22, 0x0c, 0x22, 0xe0, 0x22, 0x0c, 0x22, 0xe0,
+	0x22, 0x0c, 0x22, 0xe0, 0x22, 0x0c, 0x22, 0xe0, 0x22, 0x0c, 0x22, 0xe0, 0x22, 0x0c, 0x22, 0xe0,
+	0x22, 0x0c, 0x22, 0xe0, 0x22, 0x0c, 0x37, 0x1b, 0x00, 0xc0, 0x07, 0x00, 0x07, 0x00, 0x07, 0x00,
+	0xfe, 0x3d, 0xef, 0xfd, 0xce, 0xb1, 0x00, 0xdf, 0xcc, 0x9b, 0x99, 0x31, 0x19, 0x00, 0x19, 0x00,
+	0x31, 0x00, 0x19, 0x00, 0x38, 0x37, 0x22, 0x1a, 0xe0, 0x1a, 0x6f, 0x1a, 0xe0, 0x1a, 0x34, 0x1a,
+	0xe0, 0x1a, 0x34, 0x1a, 0xe0, 0x1a, 0x34, 0x1a, 0xe0, 0x1a, 0x34, 0x1a, 0xe0, 0x1a, 0x34, 0x1a,
+	0xe0, 0x1a, 0x34, 0x1a, 0xe0, 0x1a, 0x34, 0x1a, 0xe0, 0x1a, 0x34, 0x1a, 0xe0, 0x1a, 0x34, 0x1a,
+	0x0c, 0x1a, 0x22, 0xfe, 0xc1, 0x08, 0xe0, 0xc0, 0x19, 0x00, 0x31, 0x00, 0xc0, 0x1d, 0x34, 0x1a,
+	0x34, 0x1a, 0xe0, 0x1a, 0x22, 0x28, 0x00, 0xc0, 0x19, 0x00, 0x31, 0x00, 0x19, 0x00, 0x31, 0x00,
+	0x19, 0x00, 0x31, 0x00, 0x19, 0x00, 0x31, 0xa2, 0x77, 0x16, 0x0c, 0xc0, 0x1a, 0x34, 0x1a, 0xe0,
+	0xc0, 0x37, 0x00, 0x31, 0xe0, 0x19, 0x00, 0x31, 0x00, 0xa9, 0x66, 0x37, 0x1a, 0xc0, 0x34, 0x1a,
+	0xe0, 0x1a, 0x34, 0x1a, 0xe0, 0x1a, 0x34, 0x1a, 0xe0, 0x1a, 0x34, 0x1a, 0xe0, 0x1a, 0x34, 0x1a,
+	0xe0, 0x1a, 0x34, 0x1a, 0xe0, 0x1a, 0x34, 0x1a, 0xe0, 0x1a, 0x34, 0x1a, 0xe0, 0x1a, 0x34, 0x1a,
+	0xe0, 0x1a, 0x34, 0x1a, 0xe0, 0x1a, 0x34, 0x0c, 0x28, 0x38, 0x00, 0xc0, 0x31, 0x00, 0x19, 0x00,
+	0x31, 0x00, 0xfe, 0x9a, 0xd6, 0x18, 0xdf, 0xcc, 0xba, 0x00, 0xdf, 0xcd, 0x51, 0xfe, 0x03, 0x19,
+	0x07, 0x00, 0x07, 0x00, 0x07, 0x00, 0x07, 0x00, 0xc0, 0x17, 0x37, 0xe0, 0x22, 0x0c, 0x22, 0xe0,
+	0x22, 0x0c, 0x22, 0xe0, 0x22, 0x0c, 0x22, 0xe0, 0x22, 0x0c, 0x22, 0xe0, 0x22, 0x0c, 0x22, 0xe0,
+	0x22, 0x0c, 0x22, 0xe0, 0x22, 0x0c, 0x22, 0xe0, 0x22, 0x0c, 0x22, 0xe0, 0x22, 0x0c, 0x22, 0xe0,
+	0x22, 0x0c, 0x22, 0xe0, 0x22, 0x1a, 0xa8, 0x66, 0xfe, 0x23, 0x22, 0x8f, 0xef, 0x00, 0x07, 0x00,
+	0x07, 0xe0, 0xc0, 0xfe, 0x08, 0x5d, 0x05, 0x0c, 0x22, 0xe0, 0x05, 0x97, 0xbb, 0x00, 0xc0, 0x07,
+	0x00, 0x07, 0x00, 0x07, 0x00, 0x07, 0x00, 0x07, 0x00, 0x07, 0x00, 0x07, 0x00, 0x07, 0x00, 0x07,
+	0x00, 0xfe, 0xe9, 0x6d, 0xe0, 0x22, 0x0c, 0x22, 0x5d, 0x99, 0xbc, 0x00, 0x07, 0x00, 0x07, 0x00,
+	0x07, 0x00, 0xb2, 0x53, 0x21, 0x9a, 0x9a, 0x0c, 0x22, 0x0c, 0x22, 0xe0, 0x22, 0x0c, 0x22, 0xe0,
+	0x22, 0x0c, 0x22, 0xe0, 0x22, 0x0c, 0x22, 0xe0, 0x22, 0x0c, 0x22, 0xe0, 0x22, 0x0c, 0x22, 0xe0,
+	0x22, 0x0c, 0x22, 0xe0, 0x22, 0x0c, 0x22, 0xe0, 0x22, 0x0c, 0x22, 0xe0, 0x22, 0x0c, 0x22, 0xe0,
+	0x22, 0x05, 0x9a, 0x9a, 0x00, 0x07, 0xe0, 0x07, 0x00, 0x07, 0x00, 0x07, 0xa2, 0x77, 0xfe, 0xdb,
+	0xde, 0x18, 0xdf, 0xcd, 0xb3, 0x00, 0xdf, 0xce, 0x9c, 0x99, 0x00, 0x6e, 0x00, 0x19, 0x00, 0x31,
+	0x00, 0x19, 0xe0, 0xc0, 0xa6, 0x76, 0x1a, 0xc0, 0xe0, 0x1a, 0x34, 0x1a, 0xe0, 0x1a, 0x34, 0x1a,
+	0xe0, 0x1a, 0x34, 0x1a, 0xe0, 0x1a, 0x34, 0x1a, 0xe0, 0x1a, 0x34, 0x1a, 0xe0, 0x1a, 0x34, 0x1a,
+	0xe0, 0x1a, 0x34, 0x1a, 0xe0, 0x1a, 0x34, 0x1a, 0xe0, 0x1a, 0x34, 0x1a, 0xe0, 0x1a, 0x34, 0x1a,
+	0x0c, 0x1a, 0x37, 0x89, 0xdf, 0xe0, 0xc0, 0x19, 0x00, 0x31, 0xe0, 0xc0, 0x1b, 0x08, 0x0c, 0x30,
+	0xfe, 0x84, 0x2a, 0x00, 0xc0, 0x19, 0x00, 0x31, 0x00, 0x19, 0x00, 0x31, 0x00, 0x19, 0x00, 0x31,
+	0x00, 0x19, 0x00, 0x31, 0x00, 0x19, 0x00, 0x31, 0x00, 0x14, 0xfe, 0xaa, 0x76, 0xe0, 0xa3, 0x88,
+	0xfe, 0x05, 0x3b, 0x00, 0x6e, 0x00, 0x19, 0x00, 0x31, 0x00, 0xbc, 0x20, 0x28, 0x0c, 0x66, 0x34,
+	0x1a, 0xe0, 0x1a, 0x34, 0x1a, 0xe0, 0x1a, 0x34, 0x1a, 0xe0, 0x1a, 0x34, 0x1a, 0xe0, 0x1a, 0x34,
+	0x1a, 0xe0, 0x1a, 0x34, 0x1a, 0xe0, 0x1a, 0x34, 0x1a, 0xe0, 0x1a, 0x34, 0x1a, 0xe0, 0x1a, 0x34,
+	0x1a, 0xe0, 0x1a, 0x34, 0x1a, 0xe0, 0x1a, 0x34, 0x0c, 0x38, 0x00, 0x19, 0x00, 0x31, 0x00, 0x19,
+	0x00, 0x31, 0x00, 0xfe, 0xbb, 0xde, 0x18, 0xdf, 0xce, 0xb8, 0x00, 0xdf, 0xce, 0x9c, 0x88, 0xe0,
+	0xc0, 0x07, 0x00, 0x07, 0x00, 0xa0, 0xaa, 0xfe, 0xc4, 0x32, 0x6b, 0xa7, 0x75, 0xac, 0x65, 0x0c,
+	0x22, 0xe0, 0x22, 0x0c, 0x22, 0xe0, 0x22, 0x0c, 0x22, 0xe0, 0x22, 0x0c, 0x22, 0xe0, 0x22, 0x0c,
+	0x22, 0xe0, 0x22, 0x0c, 0x22, 0xe0, 0x22, 0x0c, 0x22, 0xe0, 0x22, 0x0c, 0x22, 0xe0, 0x22, 0x0c,
+	0x22, 0xe0, 0x22, 0x0c, 0x22, 0xe0, 0x22, 0x0c, 0x22, 0xe0, 0x22, 0x0c, 0x30, 0x89, 0xdf, 0xe0,
+	0xc0, 0x07, 0x00, 0x07, 0xe0, 0x07, 0xaa, 0x43, 0xb9, 0x53, 0x00, 0x07, 0xe0, 0x07, 0x00, 0x07,
+	0x00, 0x07, 0x00, 0x07, 0x00, 0x07, 0x00, 0x07, 0x00, 0x07, 0x00, 0x07, 0x00, 0x07, 0x00, 0x07,
+	0x00, 0x07, 0x00, 0xc0, 0xfe, 0x87, 0x54, 0xfe, 0x62, 0x19, 0x00, 0x07, 0x00, 0x07, 0x00, 0x07,
+	0x00, 0xfe, 0x47, 0x54, 0x05, 0x22, 0xe0, 0x22, 0x0c, 0x22, 0xe0, 0x22, 0x0c, 0x22, 0xe0, 0x22,
+	0x0c, 0x22, 0xe0, 0x22, 0x0c, 0x22, 0xe0, 0x22, 0x0c, 0x22, 0xe0, 0x22, 0x0c, 0x22, 0xe0, 0x22,
+	0x0c, 0x22, 0xe0, 0x22, 0x0c, 0x22, 0xe0, 0x22, 0x0c, 0x22, 0xe0, 0x22, 0x0c, 0x22, 0xe0, 0x22,
+	0x0c, 0x22, 0x93, 0xbc, 0x1f, 0x98, 0xaa, 0x6e, 0x35, 0x07, 0x00, 0x07, 0x00, 0xc0, 0xfe, 0xba,
+	0xd6, 0xfd, 0xd1, 0xac, 0x00, 0xdf, 0xce, 0x66, 0xe0, 0x19, 0x00, 0x31, 0x00, 0x19, 0x00, 0x18,
+	0x28, 0x9c, 0x9a, 0x0c, 0xc0, 0x66, 0x34, 0x1a, 0xe0, 0x1a, 0x34, 0x1a, 0xe0, 0x1a, 0x34, 0x1a,
+	0xe0, 0x1a, 0x34, 0x1a, 0xe0, 0x1a, 0x34, 0x1a, 0xe0, 0x1a, 0x34, 0x1a, 0xe0, 0x1a, 0x34, 0x1a,
+	0xe0, 0x1a, 0x34, 0x1a, 0xe0, 0x1a, 0x34, 0x1a, 0xe0, 0x1a, 0x34, 0x1a, 0xe0, 0x1a, 0x34, 0x1a,
+	0xe0, 0x1a, 0x05, 0x94, 0xab, 0xe0, 0xc0, 0x19, 0x00, 0x31, 0x00, 0x31, 0x00, 0x31, 0x00, 0x19,
+	0x00, 0x31, 0x00, 0x19, 0x00, 0x31, 0x00, 0x19, 0x00, 0x31, 0x00, 0x19, 0x00, 0x31, 0x00, 0x19,
+	0x00, 0x31, 0x00, 0x19, 0x00, 0x31, 0xe0, 0xc1, 0x31, 0x00, 0x19, 0x00, 0x31, 0x00, 0xfe, 0x89,
+	0x65, 0x3e, 0x0c, 0x1a, 0x34, 0x1a, 0xe0, 0x1a, 0x34, 0x1a, 0xe0, 0x1a, 0x34, 0x1a, 0xe0, 0x1a,
+	0x34, 0x1a, 0xe0, 0x1a, 0x34, 0x1a, 0xe0, 0x1a, 0x34, 0x1a, 0xe0, 0x1a, 0x34, 0x1a, 0xe0, 0x1a,
+	0x34, 0x1a, 0xe0, 0x1a, 0x34, 0x1a, 0xe0, 0x1a, 0x34, 0x1a, 0xe0, 0x1a, 0x34, 0x1a, 0xe0, 0x1a,
+	0x34, 0x1a, 0x21, 0xfe, 0xc3, 0x21, 0x00, 0xc0, 0x31, 0x00, 0x19, 0xe0, 0xfe, 0x7e, 0xf7, 0xfd,
+	0xd1, 0xaf, 0x00, 0xdf, 0xcf, 0xfe, 0x0c, 0x63, 0x00, 0x07, 0x00, 0x07, 0x00, 0x07, 0x00, 0xa9,
+	0x76, 0x37, 0x62, 0xe0, 0x22, 0x0c, 0x22, 0xe0, 0x22, 0x0c, 0x22, 0xe0, 0x22, 0x0c, 0x22, 0xe0,
+	0x22, 0x0c, 0x22, 0xe0, 0x22, 0x0c, 0x22, 0xe0, 0x22, 0x0c, 0x22, 0xe0, 0x22, 0x0c, 0x22, 0xe0,
+	0x22, 0x0c, 0x22, 0xe0, 0x22, 0x0c, 0x22, 0xe0, 0x22, 0x0c, 0x22, 0xe0, 0x22, 0x0c, 0x22, 0xe0,
+	0x22, 0x0c, 0x13, 0x99, 0x9a, 0xe0, 0xc0, 0x07, 0x00, 0x07, 0x00, 0x07, 0x00, 0x07, 0x00, 0x07,
+	0x00, 0x07, 0x00, 0x07, 0x00, 0x07, 0x00, 0x07, 0x00, 0x07, 0x00, 0x07, 0x00, 0x07, 0x00, 0x07,
+	0x00, 0x07, 0x00, 0x07, 0x00, 0x07, 0xe0, 0x07, 0x00, 0x07, 0x00, 0x07, 0x00, 0xfe, 0xa9, 0x6d,
+	0x0c, 0x22, 0xe0, 0x22, 0x0c, 0x22, 0xe0, 0x22, 0x0c, 0x22, 0xe0, 0x22, 0x0c, 0x22, 0xe0, 0x22,
+	0x0c, 0x22, 0xe0, 0x22, 0x0c, 0x22, 0xe0, 0x22, 0x0c, 0x22, 0xe0, 0x22, 0x0c, 0x22, 0xe0, 0x22,
+	0x0c, 0x22, 0xe0, 0x22, 0x0c, 0x22, 0xe0, 0x22, 0x0c, 0x22, 0xe0, 0x22, 0x0c, 0x22, 0xe0, 0x22,
+	0x0c, 0xa7, 0x87, 0xfe, 0xc1, 0x10, 0x07, 0xe0, 0x07, 0x00, 0x07, 0x00, 0xc0, 0xfe, 0xff, 0xff,
+	0xdf, 0xcf, 0xaa, 0x00, 0xdf, 0xcf, 0x9d, 0x99, 0xe0, 0xc0, 0x19, 0x00, 0x31, 0x00, 0x19, 0x00,
+	0xc0, 0x30, 0x16, 0x1a, 0xe0, 0x1a, 0x34, 0x1a, 0xe0, 0x1a, 0x34, 0x1a, 0xe0, 0x1a, 0x34, 0x1a,
+	0xe0, 0x1a, 0x34, 0x1a, 0xe0, 0x1a, 0x34, 0x1a, 0xe0, 0x1a, 0x34, 0x1a, 0xe0, 0x1a, 0x34, 0x1a,
+	0xe0, 0x1a, 0x34, 0x1a, 0xe0, 0x1a, 0x34, 0x1a, 0xe0, 0x1a, 0x34, 0x1a, 0xe0, 0x1a, 0x34, 0x1a,
+	0xe0, 0x1a, 0x13, 0x96, 0xaa, 0xe0, 0xc0, 0x19, 0x00, 0x31, 0x00, 0x19, 0x00, 0x31, 0x00, 0x19,
+	0x00, 0x31, 0x00, 0x19, 0x00, 0x31, 0x00, 0x19, 0x00, 0x31, 0x00, 0x19, 0x00, 0x31, 0x00, 0x19,
+	0x00, 0x31, 0x00, 0x19, 0x00, 0x31, 0x00, 0x19, 0x00, 0x31, 0x00, 0xfe, 0x69, 0x65, 0x0c, 0xc0,
+	0x1a, 0x34, 0x1a, 0xe0, 0x1a, 0x34, 0x1a, 0xe0, 0x1a, 0x34, 0x1a, 0xe0, 0x1a, 0x34, 0x1a, 0xe0,
+	0x1a, 0x34, 0x1a, 0xe0, 0x1a, 0x34, 0x1a, 0xe0, 0x1a, 0x34, 0x1a, 0xe0, 0x1a, 0x34, 0x1a, 0xe0,
+	0x1a, 0x34, 0x1a, 0xe0, 0x1a, 0x34, 0x1a, 0xe0, 0x1a, 0x34, 0x1a, 0xe0, 0x1a, 0xc0, 0x28, 0x90,
+	0xcd, 0x00, 0x19, 0x00, 0x31, 0x00, 0x19, 0x00, 0x31, 0xfe, 0x7a, 0xd6, 0xfd, 0xd2, 0xb0, 0x00,
+	0xdf, 0xd0, 0x92, 0x99, 0xfe, 0x41, 0x08, 0x00, 0x07, 0x00, 0x07, 0x00, 0x07, 0xe0, 0xc0, 0xad,
+	0x64, 0xbd, 0x20, 0x28, 0x22, 0x59, 0x22, 0xe0, 0x22, 0x0c, 0x22, 0xe0, 0x22, 0x0c, 0x22, 0xe0,
+	0x22, 0x0c, 0x22, 0xe0, 0x22, 0x0c, 0x22, 0xe0, 0x22, 0x0c, 0x22, 0xe0, 0x22, 0x0c, 0x22, 0xe0,
+	0x22, 0x0c, 0x22, 0xe0, 0x22, 0x0c, 0x22, 0xe0, 0x22, 0x0c, 0x22, 0xe0, 0x22, 0x0c, 0x22, 0xe0,
+	0x22, 0x0c, 0x05, 0x96, 0xab, 0xe0, 0xc0, 0x07, 0x00, 0x07, 0x00, 0x07, 0x00, 0x07, 0x00, 0x07,
+	0x00, 0x07, 0x00, 0x07, 0x00, 0x07, 0x00, 0x07, 0x00, 0x07, 0x00, 0x07, 0x00, 0x07, 0x00, 0x07,
+	0x00, 0x07, 0x00, 0x07, 0x00, 0x07, 0x00, 0x07, 0x00, 0xfe, 0x89, 0x6d, 0x13, 0x22, 0xe0, 0x22,
+	0x0c, 0x22, 0xe0, 0x22, 0x0c, 0x22, 0xe0, 0x22, 0x0c, 0x22, 0xe0, 0x22, 0x0c, 0x22, 0xe0, 0x22,
+	0x0c, 0x22, 0xe0, 0x22, 0x0c, 0x22, 0xe0, 0x22, 0x0c, 0x22, 0xe0, 0x22, 0x0c, 0x22, 0xe0, 0x22,
+	0x0c, 0x22, 0xe0, 0x22, 0x0c, 0x22, 0xe0, 0x22, 0x0c, 0x22, 0x1a, 0xa5, 0x88, 0x99, 0x9a, 0xfe,
+	0xa2, 0x19, 0x00, 0x07, 0x00, 0x07, 0x00, 0x07, 0x00, 0x31, 0x00, 0xfe, 0xff, 0xff, 0xdf, 0xd0,
+	0xa9, 0x00, 0xdf, 0xd1, 0x82, 0x88, 0x07, 0x00, 0x19, 0x00, 0x31, 0x00, 0x19, 0xe0, 0x31, 0x00,
+	0xaf, 0x54, 0xfe, 0x88, 0x65, 0x16, 0x1a, 0x34, 0x1a, 0xe0, 0x1a, 0x34, 0x1a, 0xe0, 0x1a, 0x34,
+	0x1a, 0xe0, 0x1a, 0x34, 0x1a, 0xe0, 0x1a, 0x34, 0x1a, 0xe0, 0x1a, 0x34, 0x1a, 0xe0, 0x1a, 0x34,
+	0x1a, 0xe0, 0x1a, 0x34, 0x1a, 0xe0, 0x1a, 0x34, 0x1a, 0xe0, 0x1a, 0x34, 0x1a, 0xe0, 0x1a, 0x34,
+	0x1a, 0xe0, 0x1a, 0xa4, 0x77, 0xe0, 0x31, 0x00, 0x19, 0x00, 0x31, 0x00, 0x19, 0x00, 0x31, 0x00,
+	0x19, 0x00, 0x31, 0x00, 0x19, 0x00, 0x31, 0x00, 0x19, 0x00, 0x31, 0x00, 0x19, 0x00, 0x31, 0x00,
+	0x19, 0x00, 0x31, 0x00, 0x19, 0x00, 0x31, 0x00, 0x27, 0x1d, 0x0c, 0x1a, 0x34, 0x1a, 0xe0, 0x1a,
+	0x34, 0x1a, 0xe0, 0x1a, 0x34, 0x1a, 0xe0, 0x1a, 0x34, 0x1a, 0xe0, 0x1a, 0x34, 0x1a, 0xe0, 0x1a,
+	0x34, 0x1a, 0xe0, 0x1a, 0x34, 0x1a, 0xe0, 0x1a, 0x34, 0x1a, 0xe0, 0x1a, 0x34, 0x1a, 0xe0, 0x1a,
+	0x34, 0x1a, 0xe0, 0x1a, 0x34, 0x1a, 0xc0, 0x28, 0x99, 0xbb, 0xfe, 0x43, 0x2a, 0x00, 0xc0, 0x19,
+	0x00, 0x31, 0x00, 0x19, 0x00, 0xc1, 0xfe, 0xff, 0xff, 0xdf, 0xd1, 0xa3, 0x00, 0xdf, 0xd2, 0x92,
+	0x88, 0xe0, 0xc0, 0x07, 0x00, 0x07, 0x00, 0x07, 0x00, 0x07, 0x00, 0xc0, 0xb4, 0x32, 0x29, 0xa4,
+	0x77, 0x22, 0xe0, 0x22, 0x0c, 0x22, 0xe0, 0x22, 0x0c, 0x22, 0xe0, 0x22, 0x0c, 0x22, 0xe0, 0x22,
+	0x0c, 0x22, 0xe0, 0x22, 0x0c, 0x22, 0xe0, 0x22, 0x0c, 0x22, 0xe0, 0x22, 0x0c, 0x22, 0xe0, 0x22,
+	0x0c, 0x22, 0xe0, 0x22, 0x0c, 0x22, 0xe0, 0x22, 0x0c, 0x22, 0xe0, 0x22, 0x29, 0xe0, 0xc0, 0x07,
+	0x00, 0x07, 0x00, 0x07, 0x00, 0x07, 0x00, 0x07, 0x00, 0x07, 0x00, 0x07, 0x00, 0x07, 0x00, 0x07,
+	0x00, 0x07, 0x00, 0x07, 0x00, 0x07, 0x00, 0x07, 0x00, 0x07, 0x00, 0x07, 0x00, 0x07, 0x00, 0x07,
+	0x00, 0x22, 0x1a, 0x22, 0x0c, 0x22, 0xe0, 0x22, 0x0c, 0x22, 0xe0, 0x22, 0x0c, 0x22, 0xe0, 0x22,
+	0x0c, 0x22, 0xe0, 0x22, 0x0c, 0x22, 0xe0, 0x22, 0x0c, 0x22, 0xe0, 0x22, 0x0c, 0x22, 0xe0, 0x22,
+	0x0c, 0x22, 0xe0, 0x22, 0x0c, 0x22, 0xe0, 0x22, 0x0c, 0x22, 0xe0, 0x22, 0x1a, 0x16, 0x99, 0x9b,
+	0x14, 0x00, 0x19, 0xe0, 0x07, 0x00, 0x07, 0x00, 0x07, 0x00, 0xc0, 0xb7, 0x99, 0x18, 0xdf, 0xd2,
+	0x9f, 0x00, 0xdf, 0xd3, 0x98, 0x88, 0xe0, 0xc0, 0x19, 0x00, 0x31, 0x00, 0x19, 0x00, 0xc3, 0xfe,
+	0x67, 0x54, 0x0c, 0x6b, 0x1a, 0xe0, 0x1a, 0x34, 0x1a, 0xe0, 0x1a, 0x34, 0x1a, 0xe0, 0x1a, 0x34,
+	0x1a, 0xe0, 0x1a, 0x34, 0x1a, 0xe0, 0x1a, 0x34, 0x1a, 0xe0, 0x1a, 0x34, 0x1a, 0xe0, 0x1a, 0x34,
+	0x1a, 0xe0, 0x1a, 0x34, 0x1a, 0xe0, 0x1a, 0x34, 0x1a, 0xe0, 0x1a, 0x34, 0x1d, 0x8a, 0xdf, 0xe0,
+	0x19, 0x00, 0x31, 0x00, 0x19, 0x00, 0x31, 0x00, 0x19, 0x00, 0x31, 0x00, 0x19, 0x00, 0x31, 0x00,
+	0x19, 0x00, 0x31, 0x00, 0x19, 0x00, 0x31, 0x00, 0x19, 0x00, 0x31, 0x00, 0x19, 0x00, 0x31, 0x00,
+	0x19, 0x00, 0xc0, 0xfe, 0x26, 0x4c, 0x05, 0x1a, 0xe0, 0x1a, 0x6f, 0x1a, 0xe0, 0x1a, 0x34, 0x1a,
+	0xe0, 0x1a, 0x34, 0x1a, 0xe0, 0x1a, 0x34, 0x1a, 0xe0, 0x1a, 0x34, 0x1a, 0xe0, 0x1a, 0x34, 0x1a,
+	0xe0, 0x1a, 0x34, 0x1a, 0xe0, 0x1a, 0x34, 0x1a, 0xe0, 0x1a, 0x34, 0x1a, 0xe0, 0x1a, 0x34, 0x1a,
+	0x05, 0x06, 0x00, 0xc2, 0x19, 0x00, 0x31, 0x00, 0x19, 0x00, 0xc0, 0xfe, 0x38, 0xc6, 0x18, 0xdf,
+	0xd3, 0xa4, 0x00, 0xdf, 0xd5, 0xfe, 0xc7, 0x39, 0x00, 0x07, 0x00, 0x07, 0x00, 0xc0, 0xfe, 0xe6,
+	0x43, 0xaa, 0x75, 0x9c, 0x89, 0x13, 0x05, 0x62, 0x0c, 0x22, 0xe0, 0x22, 0x0c, 0x22, 0xe0, 0x22,
+	0x0c, 0x22, 0xe0, 0x22, 0x0c, 0x22, 0xe0, 0x22, 0x0c, 0x22, 0xe0, 0x22, 0x0c, 0x22, 0xe0, 0x22,
+	0x0c, 0x22, 0xe0, 0x22, 0x0c, 0x22, 0xe0, 0x22, 0x0c, 0x22, 0xe0, 0x22, 0x0c, 0x22, 0xe0, 0x22,
+	0x55, 0x13, 0x00, 0x07, 0x00, 0x07, 0x00, 0x07, 0x00, 0x07, 0x00, 0x07, 0x00, 0x07, 0x00, 0x07,
+	0x00, 0x07, 0x00, 0x07, 0x00, 0x07, 0x00, 0x07, 0x00, 0x07, 0x00, 0x07, 0x00, 0x07, 0x00, 0x07,
+	0x00, 0x07, 0x00, 0x07, 0x00, 0x07, 0xe0, 0xc0, 0xe0, 0x34, 0xe0, 0x22, 0x0c, 0x22, 0xe0, 0x22,
+	0x0c, 0x22, 0xe0, 0x22, 0x0c, 0x22, 0xe0, 0x22, 0x0c, 0x22, 0xe0, 0x22, 0x0c, 0x22, 0xe0, 0x22,
+	0x0c, 0x22, 0xe0, 0x22, 0x0c, 0x22, 0xe0, 0x22, 0x0c, 0x22, 0xe0, 0x22, 0x0c, 0x22, 0xe0, 0x22,
+	0x0c, 0x22, 0x1a, 0x05, 0x0c, 0x96, 0xbc, 0x2c, 0x96, 0xbc, 0x00, 0x07, 0x00, 0x07, 0x00, 0xa8,
+	0x88, 0xfe, 0x1c, 0xe7, 0x18, 0xdf, 0xd4, 0x9f, 0x00, 0xdf, 0xd5, 0x8e, 0x88, 0xe0, 0xc0, 0x19,
+	0x00, 0x31, 0xe0, 0xc0, 0xfe, 0xc5, 0x43, 0x28, 0x9d, 0x99, 0x1a, 0xc0, 0xe0, 0x1a, 0x34, 0x1a,
+	0xe0, 0x1a, 0x34, 0x1a, 0xe0, 0x1a, 0x34, 0x1a, 0xe0, 0x1a, 0x34, 0x1a, 0xe0, 0x1a, 0x34, 0x1a,
+	0xe0, 0x1a, 0x34, 0x1a, 0xe0, 0x1a, 0x34, 0x1a, 0xe0, 0x1a, 0x34, 0x1a, 0xe0, 0x1a, 0x34, 0x1a,
+	0xe0, 0x1a, 0x34, 0x1a, 0xa4, 0x77, 0x8a, 0xde, 0x31, 0x00, 0x31, 0x00, 0x19, 0x00, 0x31, 0x00,
+	0x19, 0x00, 0x31, 0x00, 0x19, 0x00, 0x31, 0x00, 0x19, 0x00, 0x31, 0x00, 0x19, 0x00, 0x31, 0x00,
+	0x19, 0x00, 0x31, 0x00, 0x19, 0x00, 0x31, 0x00, 0x19, 0x00, 0x31, 0x00, 0x19, 0xe0, 0xbd, 0x20,
+	0x05, 0x34, 0x1a, 0xe0, 0x1a, 0x34, 0x1a, 0xe0, 0x1a, 0x34, 0x1a, 0xe0, 0x1a, 0x34, 0x1a, 0xe0,
+	0x1a, 0x34, 0x1a, 0xe0, 0x1a, 0x34, 0x1a, 0xe0, 0x1a, 0x34, 0x1a, 0xe0, 0x1a, 0x34, 0x1a, 0xe0,
+	0x1a, 0x34, 0x1a, 0xe0, 0x1a, 0x34, 0x1a, 0xe0, 0x1a, 0x34, 0x1a, 0x37, 0xc0, 0x3f, 0x00, 0x31,
+	0x00, 0x19, 0x00, 0xc0, 0x32, 0x18, 0xdf, 0xd5, 0x9b, 0x00, 0xdf, 0xd6, 0xe0, 0x07, 0x00, 0x07,
+	0x00, 0x07, 0xe0, 0xc1, 0xfe, 0xe6, 0x4b, 0x29, 0xa6, 0x77, 0xe0, 0x22, 0x0c, 0x22, 0xe0, 0x22,
+	0x0c, 0x22, 0xe0, 0x22, 0x0c, 0x22, 0xe0, 0x22, 0x0c, 0x22, 0xe0, 0x22, 0x0c, 0x22, 0xe0, 0x22,
+	0x0c, 0x22, 0xe0, 0x22, 0x0c, 0x22, 0xe0, 0x22, 0x0c, 0x22, 0xe0, 0x22, 0x0c, 0x22, 0xe0, 0x22,
+	0x0c, 0x22, 0x29, 0x00, 0xc0, 0x07, 0x00, 0x07, 0x00, 0x07, 0x00, 0x07, 0x00, 0x07, 0x00, 0x07,
+	0x00, 0x07, 0x00, 0x07, 0x00, 0x07, 0x00, 0x07, 0x00, 0x07, 0x00, 0x07, 0x00, 0x07, 0x00, 0x07,
+	0x00, 0x07, 0x00, 0x07, 0x00, 0x07, 0x00, 0x07, 0x00, 0x07, 0x00, 0x22, 0x1a, 0x22, 0xe0, 0x22,
+	0x0c, 0x22, 0xe0, 0x22, 0x0c, 0x22, 0xe0, 0x22, 0x0c, 0x22, 0xe0, 0x22, 0x0c, 0x22, 0xe0, 0x22,
+	0x0c, 0x22, 0xe0, 0x22, 0x0c, 0x22, 0xe0, 0x22, 0x0c, 0x22, 0xe0, 0x22, 0x0c, 0x22, 0xe0, 0x22,
+	0x0c, 0x22, 0x1a, 0x13, 0x08, 0x29, 0x8c, 0xce, 0x00, 0x31, 0x07, 0x00, 0x07, 0x00, 0x07, 0xe0,
+	0xfe, 0x7a, 0xd6, 0xfd, 0xd8, 0xa0, 0x00, 0xdf, 0xd6, 0xfe, 0x6d, 0x6b, 0x00, 0x31, 0x00, 0x19,
+	0x00, 0x31, 0xe0, 0x19, 0x00, 0xc0, 0x0a, 0xb6, 0x42, 0xab, 0x54, 0x28, 0x0c, 0x1a, 0xc0, 0xe0,
+	0x1a, 0x34, 0x1a, 0xe0, 0x1a, 0x34, 0x1a, 0xe0, 0x1a, 0x34, 0x1a, 0xe0, 0x1a, 0x34, 0x1a, 0xe0,
+	0x1a, 0x34, 0x1a, 0xe0, 0x1a, 0x34, 0x1a, 0xe0, 0x1a, 0x34, 0x1a, 0xe0, 0x1a, 0x34, 0x1a, 0xc0,
+	0x28, 0x00, 0xc0, 0x31, 0x00, 0x19, 0x00, 0x31, 0x00, 0x19, 0x00, 0x31, 0x00, 0x19, 0x00, 0x31,
+	0x00, 0x19, 0x00, 0x31, 0x00, 0x19, 0x00, 0x31, 0x00, 0x19, 0x00, 0x31, 0x00, 0x19, 0x00, 0x31,
+	0x00, 0x19, 0x00, 0x31, 0x00, 0x19, 0x00, 0x31, 0x00, 0x31, 0x00, 0xfe, 0x8a, 0x7e, 0x1a, 0x34,
+	0x1a, 0xe0, 0x1a, 0x34, 0x1a, 0xe0, 0x1a, 0x34, 0x1a, 0xe0, 0x1a, 0x34, 0x1a, 0xe0, 0x1a, 0x34,
+	0x1a, 0xe0, 0x1a, 0x34, 0x1a, 0xe0, 0x1a, 0x34, 0x1a, 0xe0, 0x1a, 0x34, 0x1a, 0xe0, 0x1a, 0x34,
+	0x1a, 0x13, 0x37, 0x13, 0x02, 0xfe, 0x82, 0x19, 0x00, 0x31, 0xe1, 0x00, 0x19, 0x00, 0x31, 0x00,
+	0xa9, 0x99, 0xfe, 0xff, 0xff, 0xdf, 0xd6, 0x9e, 0x00, 0xdf, 0xd7, 0xfe, 0x25, 0x21, 0x00, 0x07,
+	0x00, 0x07, 0x00, 0x07, 0x00, 0x07, 0xe0, 0x07, 0x00, 0xc0, 0xaf, 0x54, 0xb8, 0x31, 0xe0, 0x05,
+	0xe0, 0x22, 0x0c, 0x22, 0xe0, 0x22, 0x0c, 0x22, 0xe0, 0x22, 0x0c, 0x22, 0xe0, 0x22, 0x0c, 0x22,
+	0xe0, 0x22, 0x0c, 0x22, 0xe0, 0x22, 0x0c, 0x22, 0xe0, 0x22, 0x0c, 0x22, 0xe0, 0x22, 0x0c, 0x34,
+	0x28, 0xfe, 0x84, 0x32, 0x31, 0x07, 0x00, 0x07, 0x00, 0x07, 0x00, 0x07, 0x00, 0x07, 0x00, 0x07,
+	0x00, 0x07, 0x00, 0x07, 0x00, 0x07, 0x00, 0x07, 0x00, 0x07, 0x00, 0x07, 0x00, 0x07, 0x00, 0x07,
+	0x00, 0x07, 0x00, 0x07, 0x00, 0x07, 0x00, 0x07, 0x00, 0x07, 0x00, 0x07, 0x00, 0xa2, 0x88, 0x26,
+	0xfe, 0x8b, 0x7e, 0x1a, 0x22, 0xe0, 0x22, 0x0c, 0x22, 0xe0, 0x22, 0x0c, 0x22, 0xe0, 0x22, 0x0c,
+	0x22, 0xe0, 0x22, 0x0c, 0x22, 0xe0, 0x22, 0x0c, 0x22, 0xe0, 0x22, 0x0c, 0x22, 0xe0, 0x22, 0x0c,
+	0x22, 0xe0, 0x22, 0x13, 0x29, 0x02, 0xfe, 0x02, 0x19, 0x00, 0xc1, 0x07, 0x00, 0x07, 0x00, 0x07,
+	0x00, 0x07, 0x00, 0xc0, 0x3b, 0xfd, 0xd9, 0x9a, 0x00, 0xdf, 0xd8, 0x0e, 0x00, 0x31, 0x00, 0x19,
+	0x00, 0x31, 0x00, 0x19, 0x00, 0x31, 0xe0, 0x19, 0x00, 0xc0, 0xfe, 0x67, 0x54, 0x34, 0x1a, 0xe0,
+	0x1a, 0x34, 0x1a, 0xe0, 0x1a, 0x34, 0x1a, 0xe0, 0x1a, 0x34, 0x1a, 0xe0, 0x1a, 0x34, 0x1a, 0xe0,
+	0x1a, 0x34, 0x1a, 0xe0, 0x1a, 0x34, 0x1a, 0xe0, 0x1a, 0x34, 0x1a, 0xe0, 0x28, 0xfe, 0x64, 0x2a,
+	0x31, 0xc0, 0x00, 0x19, 0x00, 0x31, 0x00, 0x19, 0x00, 0x31, 0x00, 0x19, 0x00, 0x31, 0x00, 0x19,
+	0x00, 0x31, 0x00, 0x19, 0x00, 0x31, 0x00, 0x19, 0x00, 0x31, 0x00, 0x19, 0x00, 0x31, 0x00, 0x19,
+	0x00, 0x31, 0x00, 0x19, 0x00, 0x31, 0x00, 0x19, 0x00, 0x31, 0x00, 0x31, 0x34, 0x16, 0x1a, 0x6f,
+	0x1a, 0xe0, 0x1a, 0x34, 0x1a, 0xe0, 0x1a, 0x34, 0x1a, 0xe0, 0x1a, 0x34, 0x1a, 0xe0, 0x1a, 0x34,
+	0x1a, 0xe0, 0x1a, 0x34, 0x1a, 0xe0, 0x1a, 0x34, 0x1a, 0xe0, 0x1a, 0x34, 0x1a, 0x91, 0xcd, 0x00,
+	0xc1, 0x31, 0xe0, 0x19, 0x00, 0x31, 0x00, 0x19, 0x00, 0x31, 0x00, 0xc0, 0xfe, 0x38, 0xc6, 0xae,
+	0x88, 0xdf, 0xd7, 0x99, 0x00, 0xdf, 0xd9, 0x88, 0x88, 0x00, 0xc1, 0x07, 0x00, 0x07, 0x00, 0x07,
+	0x00, 0x07, 0x69, 0xa9, 0x66, 0xbb, 0x20, 0xae, 0x64, 0x0c, 0x22, 0xe0, 0x22, 0x0c, 0x22, 0xe0,
+	0x22, 0x0c, 0x22, 0xe0, 0x22, 0x0c, 0x22, 0xe0, 0x22, 0x0c, 0x22, 0xe0, 0x22, 0x0c, 0x22, 0xe0,
+	0x22, 0x0c, 0x22, 0xe0, 0x22, 0x0c, 0x05, 0xc0, 0x27, 0xa2, 0x76, 0x07, 0x00, 0x07, 0x00, 0x07,
+	0x00, 0x07, 0x00, 0x07, 0x00, 0x07, 0x00, 0x07, 0x00, 0x07, 0x00, 0x07, 0x00, 0x07, 0x00, 0x07,
+	0x00, 0x07, 0x00, 0x07, 0x00, 0x07, 0x00, 0x07, 0x00, 0x07, 0x00, 0x07, 0x00, 0x07, 0x00, 0x07,
+	0x00, 0x07, 0x00, 0x07, 0x00, 0x07, 0x00, 0x31, 0xac, 0x65, 0x37, 0x51, 0x22, 0xe0, 0x22, 0x0c,
+	0x22, 0xe0, 0x22, 0x0c, 0x22, 0xe0, 0x22, 0x0c, 0x22, 0xe0, 0x22, 0x0c, 0x22, 0xe0, 0x22, 0x0c,
+	0x22, 0xe0, 0x22, 0x0c, 0x22, 0xe0, 0x22, 0x0c, 0x22, 0x05, 0x90, 0xcd, 0x87, 0xdf, 0x07, 0x00,
+	0x07, 0x00, 0x07, 0x00, 0x07, 0x00, 0xc1, 0x3a, 0xfe, 0x9e, 0xf7, 0x18, 0xdf, 0xd8, 0x97, 0x00,
+	0xdf, 0xdb, 0x89, 0x99, 0x8d, 0x99, 0x00, 0x07, 0x00, 0x31, 0x00, 0x19, 0x00, 0xae, 0x54, 0x28,
+	0x05, 0x2f, 0x13, 0x0c, 0x22, 0x1a, 0xe0, 0x1a, 0x34, 0x1a, 0xe0, 0x1a, 0x34, 0x1a, 0xe0, 0x1a,
+	0x34, 0x1a, 0xe0, 0x1a, 0x34, 0x1a, 0xe0, 0x1a, 0x34, 0x1a, 0xe0, 0x1a, 0x34, 0x1a, 0x37, 0x96,
+	0xab, 0x00, 0xc0, 0x31, 0x00, 0x19, 0x00, 0x31, 0x00, 0x19, 0x00, 0x31, 0x00, 0x19, 0x00, 0x31,
+	0x00, 0x19, 0x00, 0x31, 0x00, 0x19, 0x00, 0x31, 0x00, 0x19, 0x00, 0x31, 0x00, 0x19, 0x00, 0x31,
+	0x00, 0x19, 0x00, 0x31, 0x00, 0x19, 0x00, 0x31, 0x00, 0x19, 0x00, 0x31, 0x00, 0x19, 0x00, 0x31,
+	0x00, 0x19, 0x00, 0xfe, 0x28, 0x65, 0x37, 0x34, 0x65, 0xe0, 0x1a, 0x34, 0x1a, 0xe0, 0x1a, 0x34,
+	0x1a, 0xe0, 0x1a, 0x34, 0x1a, 0xe0, 0x1a, 0x34, 0x1a, 0xe0, 0x1a, 0x34, 0x1a, 0xe0, 0x1a, 0x34,
+	0x0c, 0xc1, 0xe0, 0x37, 0xc0, 0xfe, 0xc2, 0x21, 0xe0, 0xc0, 0x31, 0x00, 0x19, 0x00, 0xad, 0x88,
+	0xb5, 0x99, 0xb7, 0x88, 0x18, 0xdf, 0xda, 0x91, 0x00, 0xdf, 0xdd, 0x92, 0x99, 0x00, 0x7f, 0x00,
+	0x07, 0x00, 0x07, 0x00, 0xc1, 0xb0, 0x54, 0x21, 0xa5, 0x78, 0x0c, 0x37, 0xc0, 0x25, 0x05, 0xc0,
+	0x3e, 0x22, 0x0c, 0x22, 0xe0, 0x22, 0x0c, 0x22, 0xe0, 0x22, 0x0c, 0x22, 0xe0, 0x22, 0x0c, 0x22,
+	0x1a, 0x22, 0x05, 0x13, 0xfe, 0xc1, 0x10, 0x00, 0xc0, 0x07, 0x00, 0x07, 0x00, 0x07, 0x00, 0x07,
+	0x00, 0x07, 0x00, 0x07, 0x00, 0x07, 0x00, 0x07, 0x00, 0x07, 0x00, 0x07, 0x00, 0x07, 0x00, 0x07,
+	0x00, 0x07, 0x00, 0x07, 0x00, 0x07, 0x00, 0x07, 0x00, 0x07, 0x00, 0x07, 0x00, 0x07, 0x00, 0x07,
+	0x00, 0x07, 0x00, 0x07, 0x00, 0x07, 0x00, 0x07, 0x00, 0x07, 0x00, 0xa8, 0x77, 0x0c, 0x05, 0xe0,
+	0x22, 0x0c, 0x22, 0xe0, 0x22, 0x0c, 0x22, 0xe0, 0x22, 0x0c, 0x22, 0xe0, 0x22, 0x0c, 0x22, 0xe0,
+	0x13, 0xc0, 0x05, 0x37, 0x7f, 0x05, 0x1a, 0x52, 0x9a, 0xaa, 0x89, 0xdf, 0x00, 0xc0, 0x07, 0xe0,
+	0x07, 0x00, 0x07, 0x00, 0xfe, 0xf4, 0xa4, 0x18, 0xdf, 0xdd, 0x85, 0x00, 0xdf, 0xde, 0xe0, 0xc0,
+	0x19, 0x00, 0x31, 0x00, 0x19, 0xe0, 0x31, 0x00, 0xc5, 0x27, 0xad, 0x54, 0x3b, 0x0c, 0xc0, 0x1a,
+	0x34, 0x1a, 0xe0, 0x1a, 0x34, 0x1a, 0xe0, 0x1a, 0x34, 0x1a, 0xe0, 0x6e, 0xa4, 0x88, 0x98, 0x99,
+	0xfe, 0x02, 0x19, 0x00, 0x19, 0xe0, 0x31, 0x00, 0x19, 0x00, 0x31, 0x00, 0x19, 0x00, 0x31, 0x00,
+	0x19, 0x00, 0x31, 0x00, 0x19, 0x00, 0x31, 0x00, 0x19, 0x00, 0x31, 0x00, 0x19, 0x00, 0x31, 0x00,
+	0x19, 0x00, 0x31, 0x00, 0x19, 0x00, 0x31, 0x00, 0x19, 0x00, 0x31, 0x00, 0x19, 0x00, 0x31, 0x00,
+	0x19, 0x00, 0x31, 0x00, 0x19, 0x00, 0x31, 0x00, 0x19, 0x00, 0xc0, 0xa2, 0x99, 0x1a, 0x37, 0x13,
+	0x0c, 0x34, 0x1a, 0xe0, 0x1a, 0x34, 0x1a, 0xe0, 0x1a, 0x34, 0x1a, 0xe0, 0x1a, 0x22, 0x8c, 0xbd,
+	0x27, 0xc1, 0x00, 0xc5, 0x19, 0x00, 0x31, 0x00, 0x19, 0x00, 0xc0, 0xfe, 0xba, 0xd6, 0xfd, 0xdf,
+	0xc0, 0x8e, 0x00, 0xdf, 0xde, 0x91, 0x99, 0xe0, 0xc0, 0x7f, 0x00, 0x07, 0x00, 0x07, 0x00, 0x07,
+	0xe0, 0x07, 0xe0, 0x07, 0xe0, 0x07, 0x00, 0x07, 0x0e, 0xfe, 0x6a, 0x76, 0xe0, 0x22, 0x0c, 0x22,
+	0xe0, 0x22, 0x0c, 0x22, 0xe0, 0x13, 0x5a, 0x30, 0x1a, 0x8c, 0xdf, 0x00, 0xc1, 0x07, 0x00, 0x07,
+	0x00, 0x07, 0x00, 0x07, 0x00, 0x07, 0x00, 0x07, 0x00, 0x07, 0x00, 0x07, 0x00, 0x07, 0x00, 0x07,
+	0x00, 0x07, 0x00, 0x07, 0x00, 0x07, 0x00, 0x07, 0x00, 0x07, 0x00, 0x07, 0x00, 0x07, 0x00, 0x07,
+	0x00, 0x07, 0x00, 0x07, 0x00, 0x07, 0x00, 0x07, 0x00, 0x07, 0x00, 0x07, 0x00, 0x07, 0x00, 0x07,
+	0x00, 0x07, 0x00, 0x07, 0xe0, 0x07, 0x00, 0xc0, 0xba, 0x20, 0xb5, 0x43, 0x16, 0x13, 0xe0, 0x22,
+	0x0c, 0x22, 0xe0, 0x22, 0x0c, 0x22, 0xe0, 0x22, 0x13, 0xfe, 0xe2, 0x18, 0x31, 0x07, 0x00, 0x07,
+	0xe0, 0x07, 0xe0, 0x07, 0xe0, 0x07, 0x00, 0x07, 0x00, 0x07, 0x00, 0x19, 0xb8, 0x88, 0x18, 0xdf,
+	0xde, 0x8b, 0x00, 0xdf, 0xdf, 0x82, 0x88, 0xe0, 0xc0, 0x19, 0x00, 0x31, 0x00, 0x19, 0x00, 0x31,
+	0x00, 0x19, 0x00, 0x31, 0x00, 0xc0, 0xaf, 0x54, 0x37, 0x1a, 0x22, 0x0c, 0x34, 0x0c, 0x13, 0x1d,
+	0xa3, 0x88, 0x9d, 0x9a, 0x29, 0x93, 0xbc, 0x26, 0x00, 0xc1, 0x31, 0xe0, 0x19, 0x00, 0x31, 0x00,
+	0x19, 0x00, 0x31, 0x00, 0x19, 0x00, 0x31, 0x00, 0x19, 0x00, 0x31, 0x00, 0x19, 0x00, 0x31, 0x00,
+	0x19, 0x00, 0x31, 0x00, 0x19, 0x00, 0x31, 0x00, 0x19, 0x00, 0x31, 0x00, 0x19, 0x00, 0x31, 0x00,
+	0x19, 0x00, 0x31, 0x00, 0x19, 0x00, 0x31, 0x00, 0x19, 0x00, 0x31, 0x00, 0x19, 0x00, 0x31, 0x00,
+	0x19, 0x00, 0x31, 0x00, 0x19, 0x00, 0x31, 0xe0, 0xc2, 0xa5, 0x88, 0xfe, 0x47, 0x54, 0x29, 0x05,
+	0xa3, 0x77, 0x05, 0x3e, 0x67, 0x0c, 0x22, 0x0c, 0xc0, 0x37, 0x35, 0x00, 0x31, 0x00, 0x19, 0x00,
+	0x31, 0x00, 0x19, 0x00, 0x31, 0x00, 0x19, 0x00, 0xc1, 0xfe, 0xff, 0xff, 0xdf, 0xdf, 0x8a, 0x00,
+	0xdf, 0xdf, 0xc0, 0x11, 0xfe, 0x82, 0x10, 0x00, 0x07, 0x00, 0x07, 0x00, 0x07, 0x00, 0x07, 0x00,
+	0x07, 0x00, 0xc0, 0x06, 0xaa, 0x66, 0x1e, 0x7b, 0x9c, 0x88, 0x9d, 0x9a, 0x9c, 0x99, 0x99, 0xab,
+	0x98, 0xaa, 0x97, 0xcd, 0x00, 0xc3, 0x07, 0xe0, 0x07, 0x00, 0x07, 0x00, 0x07, 0x00, 0x07, 0x00,
+	0x07, 0x00, 0x07, 0x00, 0x07, 0x00, 0x07, 0x00, 0x07, 0x00, 0x07, 0x00, 0x07, 0x00, 0x07, 0x00,
+	0x07, 0x00, 0x07, 0x00, 0x19, 0x00, 0xc5, 0x19, 0x00, 0x07, 0x00, 0x07, 0x00, 0x07, 0x00, 0x07,
+	0x00, 0x07, 0x00, 0x07, 0x00, 0x07, 0x00, 0x07, 0x00, 0x07, 0x00, 0x07, 0x00, 0x07, 0x00, 0x07,
+	0x00, 0x07, 0xe0, 0x07, 0xe0, 0x07, 0x00, 0xc2, 0xa1, 0x9a, 0xa8, 0x65, 0xab, 0x54, 0x22, 0x3f,
+	0xa3, 0x88, 0x1e, 0x34, 0x1e, 0x1b, 0xfe, 0x00, 0x00, 0x07, 0x00, 0x07, 0x00, 0x07, 0x00, 0x07,
+	0x00, 0x07, 0x00, 0xc0, 0xb9, 0x99, 0x18, 0xdf, 0xdf, 0xc0, 0x80, 0x00, 0xdf, 0xdf, 0xc2, 0x97,
+	0x99, 0xfe, 0xc3, 0x18, 0x07, 0x00, 0x6e, 0x00, 0x19, 0x00, 0x31, 0x00, 0x19, 0xe0, 0x31, 0x00,
+	0xc5, 0x31, 0x00, 0x19, 0xe0, 0x31, 0xe0, 0x19, 0x00, 0x31, 0x00, 0x19, 0x00, 0x31, 0x00, 0x19,
+	0x00, 0x31, 0x00, 0x19, 0x00, 0x31, 0x00, 0x19, 0x00, 0x31, 0x00, 0x19, 0x00, 0x31, 0x00, 0x19,
+	0x00, 0x31, 0x00, 0x15, 0xa2, 0x66, 0xfe, 0x85, 0x68, 0xa0, 0xb9, 0xa2, 0xb9, 0x7a, 0xc2, 0x55,
+	0xa0, 0x47, 0x9e, 0x47, 0x9f, 0x06, 0x00, 0xc1, 0x19, 0x00, 0x31, 0x00, 0x19, 0x00, 0x31, 0x00,
+	0x19, 0x00, 0x31, 0x00, 0x19, 0x00, 0x31, 0x00, 0x19, 0x00, 0x31, 0x00, 0x19, 0x00, 0x31, 0x00,
+	0x19, 0x00, 0x31, 0xe0, 0x19, 0xe0, 0x31, 0x00, 0xc7, 0x19, 0x00, 0x31, 0x00, 0x19, 0x00, 0x31,
+	0x00, 0xc0, 0x7e, 0xfe, 0xf3, 0x9c, 0xb5, 0x99, 0x18, 0xdf, 0xdf, 0xc1, 0x84, 0x00, 0xdf, 0xdf,
+	0xc5, 0x90, 0x99, 0x00, 0x07, 0x00, 0x07, 0x00, 0x07, 0x00, 0x07, 0x00, 0x07, 0xe0, 0x07, 0xe0,
+	0x07, 0xe0, 0x07, 0x00, 0x07, 0x00, 0x07, 0x00, 0x07, 0x00, 0x07, 0x00, 0x07, 0x00, 0x07, 0x00,
+	0x07, 0x00, 0x07, 0x00, 0x07, 0x00, 0x07, 0x00, 0x07, 0x00, 0x07, 0x00, 0x07, 0x00, 0x07, 0x00,
+	0x07, 0x00, 0xa2, 0xc9, 0x05, 0xfe, 0x0a, 0xd1, 0x7a, 0x05, 0x45, 0x7b, 0x10, 0x25, 0x10, 0x25,
+	0x10, 0x25, 0x10, 0x05, 0x25, 0x33, 0x56, 0x9e, 0x06, 0xfe, 0x41, 0x00, 0xe0, 0xc0, 0x07, 0x00,
+	0x07, 0x00, 0x07, 0x00, 0x07, 0x00, 0x07, 0x00, 0x07, 0x00, 0x07, 0x00, 0x07, 0x00, 0x07, 0x00,
+	0x07, 0x00, 0x07, 0x00, 0x07, 0x00, 0x07, 0x00, 0x07, 0x00, 0x07, 0xe0, 0x07, 0xe0, 0x07, 0xe0,
+	0x07, 0xe0, 0x07, 0x00, 0x07, 0x00, 0x07, 0x00, 0x07, 0x00, 0xbd, 0x99, 0xfe, 0xff, 0xff, 0xdf,
+	0xdf, 0xc5, 0x7d, 0x00, 0xdf, 0xdf, 0xc3, 0x66, 0xfe, 0xe8, 0x39, 0x00, 0x19, 0x00, 0x31, 0x00,
+	0x19, 0x00, 0x31, 0x00, 0x19, 0x00, 0x31, 0x00, 0x19, 0x00, 0x31, 0x00, 0x19, 0x00, 0x31, 0x00,
+	0x19, 0x00, 0x31, 0x00, 0x19, 0x00, 0x31, 0x00, 0x19, 0x00, 0x31, 0x00, 0x19, 0x00, 0x31, 0x00,
+	0x19, 0x00, 0x31, 0x00, 0x19, 0x00, 0x31, 0x00, 0xc0, 0x14, 0xfe, 0x0a, 0xe1, 0x10, 0x7b, 0x10,
+	0xc1, 0x7a, 0x10, 0xc1, 0x3e, 0x10, 0xc1, 0x3e, 0x10, 0xc1, 0x3e, 0x10, 0x05, 0x3e, 0x1b, 0x00,
+	0xc1, 0x19, 0x00, 0x31, 0x00, 0x19, 0x00, 0x31, 0x00, 0x19, 0x00, 0x31, 0x00, 0x19, 0x00, 0x31,
+	0x00, 0x19, 0x00, 0x31, 0x00, 0x19, 0x00, 0x31, 0x00, 0x19, 0x00, 0x31, 0x00, 0x19, 0x00, 0x31,
+	0x00, 0x19, 0x00, 0x31, 0x00, 0x19, 0x00, 0x31, 0x00, 0x19, 0x00, 0xad, 0x88, 0x2d, 0xfd, 0xdf,
+	0xc6, 0x83, 0x00, 0xdf, 0xdf, 0xc2, 0x2c, 0xfe, 0xa3, 0x18, 0x00, 0x7f, 0x00, 0x07, 0x00, 0x07,
+	0x00, 0x07, 0x00, 0x07, 0x00, 0x07, 0x00, 0x07, 0x00, 0x07, 0x00, 0x07, 0x00, 0x07, 0x00, 0x07,
+	0x00, 0x07, 0x00, 0x07, 0x00, 0x07, 0x00, 0x07, 0x00, 0x07, 0x00, 0x07, 0x00, 0x07, 0x00, 0x07,
+	0x00, 0x07, 0x00, 0x07, 0x00, 0xc1, 0xfe, 0xc8, 0xa8, 0x33, 0x25, 0x10, 0x25, 0x10, 0x25, 0xe0,
+	0x25, 0x10, 0x25, 0xe0, 0x25, 0x10, 0x25, 0xe0, 0x25, 0x10, 0x25, 0xe0, 0x25, 0x10, 0x25, 0x10,
+	0x25, 0x3e, 0x05, 0x10, 0x31, 0x00, 0x07, 0x00, 0x07, 0x00, 0x07, 0x00, 0x07, 0x00, 0x07, 0x00,
+	0x07, 0x00, 0x07, 0x00, 0x07, 0x00, 0x07, 0x00, 0x07, 0x00, 0x07, 0x00, 0x07, 0x00, 0x07, 0x00,
+	0x07, 0x00, 0x07, 0x00, 0x07, 0x00, 0x07, 0x00, 0x07, 0x00, 0x07, 0x00, 0x07, 0x00, 0x07, 0x00,
+	0xc0, 0xb8, 0x88, 0xfd, 0xdf, 0xc5, 0x75, 0x00, 0xdf, 0xdf, 0xc0, 0x9a, 0x99, 0xfe, 0x28, 0x42,
+	0x00, 0xc0, 0x19, 0x00, 0x31, 0x00, 0x19, 0x00, 0x31, 0x00, 0x19, 0x00, 0x31, 0x00, 0x19, 0x00,
+	0x31, 0x00, 0xcb, 0x19, 0x00, 0x31, 0x00, 0x19, 0x00, 0x31, 0x00, 0x19, 0x00, 0x31, 0x00, 0x19,
+	0x00, 0xc0, 0x2c, 0x05, 0x10, 0xc1, 0x3e, 0x10, 0xc1, 0x3e, 0x10, 0xc1, 0x3e, 0x10, 0xc1, 0x3e,
+	0x10, 0xc1, 0x3e, 0x10, 0xc1, 0x3e, 0x10, 0xc1, 0x3e, 0xc0, 0x2c, 0x00, 0x7a, 0x00, 0x31, 0x00,
+	0x19, 0x00, 0x31, 0x00, 0x19, 0x00, 0x31, 0x00, 0x19, 0x00, 0x31, 0x00, 0x19, 0x00, 0x31, 0x00,
+	0x19, 0x00, 0x31, 0x00, 0x19, 0x00, 0x31, 0x00, 0x19, 0x00, 0x31, 0x00, 0x19, 0x00, 0x31, 0x00,
+	0x19, 0x00, 0x31, 0x00, 0x19, 0xe0, 0xc0, 0xa8, 0x88, 0x11, 0xfd, 0xdf, 0xc3, 0x8a, 0x00, 0xdf,
+	0xdf, 0x89, 0x99, 0x00, 0x07, 0xe0, 0x07, 0x00, 0x07, 0x00, 0x07, 0x00, 0x07, 0x00, 0x07, 0x00,
+	0x07, 0x00, 0x07, 0x00, 0xe1, 0xfe, 0x64, 0x48, 0xa2, 0xf9, 0xa2, 0xda, 0x10, 0x05, 0x3e, 0x05,
+	0x3e, 0x05, 0x13, 0x10, 0x9e, 0x47, 0x9f, 0x58, 0x11, 0x31, 0x00, 0x07, 0x00, 0x07, 0x00, 0x07,
+	0x00, 0x07, 0x00, 0x07, 0x00, 0xfe, 0x85, 0x68, 0xfe, 0x0a, 0xd9, 0x4a, 0x10, 0x25, 0xe0, 0x25,
+	0x10, 0x25, 0xe0, 0x25, 0x10, 0x25, 0xe0, 0x25, 0x10, 0x25, 0xe0, 0x25, 0x10, 0x25, 0xe0, 0x25,
+	0x10, 0x25, 0xe0, 0x25, 0x10, 0x25, 0xe0, 0x25, 0x10, 0x25, 0x10, 0x05, 0x26, 0xe0, 0xc0, 0x07,
+	0x00, 0x07, 0x00, 0x07, 0x00, 0x07, 0x00, 0x07, 0x00, 0xc3, 0x31, 0xc0, 0x0a, 0xe0, 0x0a, 0xe0,
+	0xc0, 0x00, 0xc3, 0x07, 0x00, 0x07, 0x00, 0x07, 0x00, 0x07, 0x00, 0x07, 0x00, 0x07, 0x00, 0x07,
+	0xe0, 0x07, 0x00, 0xfe, 0x10, 0x84, 0xfd, 0xdf, 0xc2, 0x82, 0x00, 0xdf, 0xde, 0xfe, 0x4d, 0x6b,
+	0x00, 0x31, 0x00, 0x19, 0x00, 0x31, 0x00, 0x19, 0x00, 0x31, 0x00, 0x19, 0x00, 0xc1, 0x31, 0xfe,
+	0x86, 0x88, 0x3e, 0x10, 0x13, 0x3e, 0x25, 0x10, 0x3e, 0x10, 0xc5, 0x25, 0x3e, 0x13, 0x10, 0xe0,
+	0xc0, 0x31, 0x00, 0x19, 0x00, 0x31, 0x00, 0x2e, 0x00, 0xfe, 0xc8, 0xb0, 0x3e, 0x10, 0xc2, 0x3e,
+	0x10, 0xc1, 0x3e, 0x10, 0xc1, 0x3e, 0x10, 0xc1, 0x3e, 0x10, 0xc1, 0x3e, 0x10, 0xc1, 0x3e, 0x10,
+	0xc1, 0x3e, 0x10, 0xc1, 0x3e, 0x10, 0x25, 0x10, 0x31, 0x00, 0x31, 0x00, 0x19, 0x00, 0x31, 0x00,
+	0x19, 0x00, 0x1f, 0xfe, 0xa7, 0x90, 0x13, 0x10, 0x25, 0x3e, 0x25, 0x3e, 0x25, 0x3e, 0x25, 0x3e,
+	0xc2, 0x9e, 0x47, 0x9e, 0x17, 0x31, 0xe0, 0xc0, 0x31, 0x00, 0x19, 0x00, 0x31, 0x00, 0x19, 0x00,
+	0x31, 0x00, 0x19, 0x00, 0x31, 0x00, 0x32, 0xfe, 0x7d, 0xef, 0xfd, 0xdf, 0xc0, 0x99, 0x00, 0xdf,
+	0xdc, 0x9b, 0x99, 0xfe, 0x29, 0x4a, 0x00, 0x07, 0x00, 0x07, 0x00, 0x07, 0x00, 0x07, 0x00, 0x07,
+	0x00, 0x07, 0x00, 0x31, 0xfe, 0xa6, 0x88, 0xa2, 0xfb, 0xc0, 0x05, 0x10, 0x25, 0x10, 0x25, 0x10,
+	0x25, 0x10, 0x25, 0xe0, 0x25, 0xe0, 0x25, 0xe0, 0x25, 0x10, 0x25, 0x10, 0x9f, 0x58, 0xe0, 0x07,
+	0x00, 0x07, 0x00, 0x07, 0x00, 0x07, 0xa0, 0xd9, 0x17, 0x65, 0x25, 0xe0, 0x25, 0xe0, 0x25, 0x10,
+	0x25, 0xe0, 0x25, 0x10, 0x25, 0xe0, 0x25, 0x10, 0x25, 0xe0, 0x25, 0x10, 0x25, 0xe0, 0x25, 0x10,
+	0x25, 0xe0, 0x25, 0x10, 0x25, 0xe0, 0x25, 0x10, 0x25, 0xe0, 0x25, 0x10, 0x25, 0x10, 0x25, 0x13,
+	0xfe, 0x64, 0x50, 0x00, 0x07, 0x00, 0x07, 0x00, 0x07, 0x00, 0x19, 0x3f, 0xfe, 0x0a, 0xd9, 0x10,
+	0x25, 0x10, 0x25, 0x10, 0x25, 0x10, 0x25, 0x10, 0x25, 0x10, 0x25, 0x10, 0x17, 0x13, 0x05, 0x3e,
+	0x2c, 0xfe, 0x42, 0x28, 0xe0, 0xc0, 0x07, 0x00, 0x07, 0x00, 0x07, 0x00, 0x07, 0x00, 0x07, 0x00,
+	0x07, 0x19, 0x00, 0xfe, 0xdb, 0xde, 0xfd, 0xdf, 0x82, 0x00, 0xdf, 0xdb, 0x98, 0x88, 0x00, 0x31,
+	0xc0, 0x00, 0x19, 0x00, 0x31, 0x00, 0x19, 0x00, 0x31, 0x00, 0xc0, 0x31, 0x2c, 0x3e, 0x13, 0x10,
+	0xc1, 0x3e, 0x10, 0xc1, 0x3e, 0x10, 0xc1, 0x3e, 0x10, 0xc1, 0x3e, 0x10, 0xc1, 0x33, 0x14, 0x31,
+	0x00, 0x19, 0x00, 0x31, 0x00, 0x2e, 0xa1, 0xca, 0x33, 0x10, 0xe0, 0x10, 0xc1, 0x3e, 0x10, 0xc1,
+	0x3e, 0x10, 0xc1, 0x3e, 0x10, 0xc1, 0x3e, 0x10, 0xc1, 0x3e, 0x10, 0xc1, 0x3e, 0x10, 0xc1, 0x3e,
+	0x10, 0xc1, 0x3e, 0x10, 0xc1, 0x3e, 0x10, 0xc0, 0x13, 0xfe, 0x85, 0x70, 0x00, 0x31, 0x00, 0x19,
+	0x00, 0x31, 0x00, 0xa2, 0xd9, 0xfe, 0xea, 0xd8, 0xe0, 0xc0, 0x3e, 0x5a, 0xc1, 0x3e, 0x10, 0xc1,
+	0x3e, 0x10, 0xc1, 0x3e, 0x10, 0xc1, 0x05, 0x10, 0x9f, 0x57, 0x00, 0xc1, 0x31, 0x00, 0x19, 0x00,
+	0x31, 0x00, 0x19, 0x00, 0x31, 0xe0, 0xc0, 0xfe, 0xd7, 0xbd, 0xfd, 0xde, 0x95, 0x00, 0xdf, 0xda,
+	0x96, 0x88, 0x00, 0x19, 0x07, 0x00, 0x07, 0x00, 0x07, 0x00, 0x07, 0x00, 0x07, 0x00, 0xc0, 0x2c,
+	0xa2, 0xb9, 0x3e, 0x25, 0x10, 0x25, 0xe0, 0x25, 0x10, 0x25, 0xe0, 0x25, 0x10, 0x25, 0xe0, 0x25,
+	0x10, 0x25, 0xe0, 0x25, 0x10, 0x25, 0xe0, 0x25, 0x9f, 0x36, 0x31, 0x00, 0x07, 0x00, 0x07, 0x00,
+	0x07, 0xfe, 0x44, 0x58, 0x33, 0x10, 0x25, 0x10, 0x25, 0xe0, 0x25, 0x10, 0x25, 0xe0, 0x25, 0x10,
+	0x25, 0xe0, 0x25, 0x10, 0x25, 0xe0, 0x25, 0x10, 0x25, 0xe0, 0x25, 0x10, 0x25, 0xe0, 0x25, 0x10,
+	0x25, 0xe0, 0x25, 0x10, 0x25, 0xe0, 0x25, 0x10, 0x25, 0xe0, 0x25, 0x10, 0x25, 0xe0, 0x25, 0x05,
+	0x9c, 0x06, 0x00, 0x07, 0x00, 0x07, 0x00, 0x07, 0x00, 0xfe, 0xc8, 0xa0, 0xe0, 0x25, 0x10, 0x25,
+	0xe0, 0x25, 0x10, 0x25, 0xe0, 0x25, 0x10, 0x25, 0xe0, 0x25, 0x10, 0x25, 0xe0, 0x25, 0x10, 0x25,
+	0x69, 0x05, 0x2c, 0x19, 0x00, 0x07, 0x00, 0x07, 0x00, 0x07, 0x00, 0x07, 0x00, 0x07, 0xe0, 0xc0,
+	0x1e, 0xfd, 0xdd, 0x84, 0x00, 0xdf, 0xd9, 0x96, 0x88, 0x00, 0xc0, 0x31, 0x00, 0x19, 0x00, 0x31,
+	0x00, 0x19, 0x00, 0x31, 0x00, 0xfe, 0x43, 0x48, 0x3e, 0x25, 0x10, 0xe0, 0x10, 0xc1, 0x3e, 0x10,
+	0xc1, 0x3e, 0x10, 0xc1, 0x3e, 0x10, 0xc1, 0x3e, 0x10, 0xc1, 0x3e, 0x13, 0x00, 0xc0, 0x19, 0x00,
+	0x31, 0x00, 0x07, 0x00, 0x05, 0x10, 0x3e, 0x10, 0xc1, 0x3e, 0x10, 0xc1, 0x3e, 0x10, 0xc1, 0x3e,
+	0x10, 0xc1, 0x3e, 0x10, 0xc1, 0x3e, 0x10, 0xc1, 0x3e, 0x10, 0xc1, 0x3e, 0x10, 0xc1, 0x3e, 0x10,
+	0xc1, 0x3e, 0x10, 0xc1, 0x3e, 0x10, 0xc0, 0x13, 0xfe, 0x64, 0x58, 0x00, 0x31, 0x00, 0x19, 0x00,
+	0x31, 0x1f, 0xfe, 0x0b, 0xe1, 0x10, 0xc1, 0x3e, 0x10, 0xc1, 0x3e, 0x10, 0xc1, 0x3e, 0x10, 0xc1,
+	0x3e, 0x10, 0xc1, 0xe0, 0x10, 0x3e, 0x13, 0x29, 0x00, 0x31, 0x00, 0x19, 0x00, 0x31, 0x00, 0x19,
+	0x00, 0x31, 0xe0, 0xc0, 0xfe, 0x75, 0xad, 0xfd, 0xdc, 0x98, 0x00, 0xdf, 0xd8, 0x98, 0x99, 0xfe,
+	0x25, 0x29, 0x31, 0x07, 0x00, 0x07, 0x00, 0x07, 0x00, 0x07, 0x00, 0x07, 0x00, 0xfe, 0xc8, 0xa0,
+	0x33, 0x10, 0xc0, 0x25, 0x10, 0x25, 0xe0, 0x25, 0x10, 0x25, 0xe0, 0x25, 0x10, 0x25, 0xe0, 0x25,
+	0x10, 0x25, 0xe0, 0x25, 0x10, 0x25, 0xe0, 0x25, 0x33, 0x19, 0xe0, 0x07, 0x00, 0x07, 0x00, 0x07,
+	0x00, 0x05, 0x10, 0x25, 0x10, 0x25, 0xe0, 0x25, 0x10, 0x25, 0xe0, 0x25, 0x10, 0x25, 0xe0, 0x25,
+	0x10, 0x25, 0xe0, 0x25, 0x10, 0x25, 0xe0, 0x25, 0x10, 0x25, 0xe0, 0x25, 0x10, 0x25, 0xe0, 0x25,
+	0x10, 0x25, 0xe0, 0x25, 0x10, 0x25, 0xe0, 0x25, 0x10, 0x25, 0xe0, 0x25, 0x10, 0x25, 0xe0, 0x25,
+	0x13, 0xe0, 0xc0, 0x07, 0x00, 0x07, 0x00, 0x07, 0x06, 0x05, 0xe0, 0x25, 0x10, 0x25, 0xe0, 0x25,
+	0x10, 0x25, 0xe0, 0x25, 0x10, 0x25, 0xe0, 0x25, 0x10, 0x25, 0xe0, 0x25, 0x10, 0x25, 0x10, 0x25,
+	0x69, 0x10, 0x19, 0xc0, 0x00, 0x07, 0x00, 0x07, 0x00, 0x07, 0x00, 0x07, 0xe0, 0xc0, 0xfe, 0x59,
+	0xce, 0xfd, 0xdb, 0x87, 0x00, 0xdf, 0xd8, 0xfe, 0x65, 0x31, 0x00, 0xe0, 0x00, 0x19, 0x00, 0x31,
+	0x00, 0x19, 0x00, 0x1f, 0x00, 0xfe, 0xe9, 0xb8, 0x3e, 0x5a, 0xc0, 0x3e, 0x10, 0xc1, 0x3e, 0x10,
+	0xc1, 0x3e, 0x10, 0xc1, 0x3e, 0x10, 0xc1, 0x3e, 0x10, 0xc1, 0x3e, 0x7a, 0xfe, 0x64, 0x60, 0x00,
+	0x19, 0x00, 0x31, 0x00, 0x19, 0x00, 0xfe, 0xa7, 0x88, 0x3e, 0xc0, 0x10, 0xc1, 0x3e, 0x10, 0xc1,
+	0x3e, 0x10, 0xc1, 0x3e, 0x10, 0xc1, 0x3e, 0x10, 0xc1, 0x3e, 0x10, 0xc1, 0x3e, 0x10, 0xc1, 0x3e,
+	0x10, 0xc1, 0x3e, 0x10, 0xc1, 0x3e, 0x10, 0xc1, 0x3e, 0x10, 0xc1, 0x3e, 0x10, 0x25, 0x9f, 0x57,
+	0xe0, 0xc0, 0x31, 0x00, 0x19, 0x00, 0xc0, 0x14, 0x25, 0x10, 0xc1, 0x3e, 0x10, 0xc1, 0x3e, 0x10,
+	0xc1, 0x3e, 0x10, 0xc1, 0x3e, 0x10, 0xc1, 0x3e, 0x10, 0xc1, 0x08, 0xfe, 0x85, 0x78, 0xe0, 0xc0,
+	0x19, 0x00, 0x31, 0x00, 0x19, 0x00, 0x31, 0xe0, 0xc0, 0x34, 0xfd, 0xda, 0x99, 0x00, 0xdf, 0xd7,
+	0xfe, 0xe8, 0x41, 0x31, 0x07, 0x00, 0x07, 0x00, 0x07, 0x00, 0x07, 0x00, 0x07, 0xa0, 0xb8, 0x25,
+	0x10, 0x25, 0xe0, 0x25, 0x10, 0x25, 0xe0, 0x25, 0x10, 0x25, 0xe0, 0x25, 0x10, 0x25, 0xe0, 0x25,
+	0x10, 0x25, 0xe0, 0x25, 0x10, 0x25, 0xe0, 0x25, 0xc0, 0x9e, 0x05, 0x00, 0x07, 0x00, 0x07, 0x00,
+	0x07, 0x00, 0xc0, 0xfe, 0xe9, 0xc8, 0x25, 0x10, 0x25, 0xe0, 0x25, 0x10, 0x25, 0xe0, 0x25, 0x10,
+	0x25, 0xe0, 0x25, 0x10, 0x25, 0xe0, 0x25, 0x10, 0x25, 0xe0, 0x25, 0x10, 0x25, 0xe0, 0x25, 0x10,
+	0x25, 0xe0, 0x25, 0x10, 0x25, 0xe0, 0x25, 0x10, 0x25, 0xe0, 0x25, 0x10, 0x25, 0xe0, 0x25, 0x10,
+	0x25, 0xe0, 0x25, 0x10, 0x25, 0x10, 0x33, 0x31, 0x07, 0x00, 0x07, 0x00, 0x07, 0xe0, 0xc0, 0x1a,
+	0x25, 0xe0, 0x25, 0x10, 0x25, 0xe0, 0x25, 0x10, 0x25, 0xe0, 0x25, 0x10, 0x25, 0xe0, 0x25, 0x10,
+	0x25, 0xe0, 0x25, 0x10, 0x25, 0xe0, 0x25, 0x10, 0x33, 0x37, 0xe0, 0xc0, 0x07, 0x00, 0x07, 0x00,
+	0x07, 0x00, 0x07, 0x31, 0x23, 0xfd, 0xda, 0x87, 0x00, 0xdf, 0xd6, 0x87, 0x99, 0x00, 0xe0, 0x00,
+	0x19, 0x00, 0x31, 0x00, 0x19, 0x00, 0x1f, 0x00, 0xfe, 0x0a, 0xd1, 0x10, 0xc1, 0x3e, 0x10, 0xc1,
+	0x3e, 0x10, 0xc1, 0x3e, 0x10, 0xc1, 0x3e, 0x10, 0xc1, 0x3e, 0x10, 0xc1, 0x3e, 0xc0, 0x2c, 0x00,
+	0x19, 0x00, 0x31, 0x00, 0x19, 0x00, 0x31, 0xfe, 0x43, 0x40, 0x25, 0x10, 0xc1, 0x3e, 0x10, 0xc1,
+	0x3e, 0x10, 0xc1, 0x3e, 0x10, 0xc1, 0x3e, 0x10, 0xc1, 0x3e, 0x10, 0xc1, 0x3e, 0x10, 0xc1, 0x3e,
+	0x10, 0xc1, 0x3e, 0x10, 0xc1, 0x3e, 0x10, 0xc1, 0x3e, 0x10, 0xc1, 0x3e, 0x10, 0xc1, 0x3e, 0x10,
+	0x9f, 0x58, 0x00, 0x19, 0x00, 0x31, 0x00, 0x19, 0xe0, 0xc0, 0xfe, 0xe9, 0xc8, 0x25, 0x10, 0xc1,
+	0x3e, 0x10, 0xc1, 0x3e, 0x10, 0xc1, 0x3e, 0x10, 0xc1, 0x3e, 0x10, 0xc1, 0x3e, 0x10, 0xc1, 0x05,
+	0x9d, 0x47, 0xe0, 0xc0, 0x19, 0x00, 0x31, 0x00, 0x19, 0x00, 0xe0, 0x00, 0xb0, 0x88, 0xfd, 0xd9,
+	0x9d, 0x00, 0xdf, 0xd5, 0x62, 0x00, 0x7f, 0x00, 0x07, 0x00, 0x07, 0x00, 0x07, 0x00, 0x07, 0x00,
+	0xfe, 0xea, 0xc8, 0x10, 0x25, 0xe0, 0x25, 0x10, 0x25, 0xe0, 0x25, 0x10, 0x25, 0xe0, 0x25, 0x10,
+	0x25, 0xe0, 0x25, 0x10, 0x25, 0xe0, 0x25, 0x10, 0x25, 0xe0, 0x25, 0xe0, 0x10, 0x00, 0x07, 0x00,
+	0x07, 0x00, 0x07, 0x00, 0x07, 0x00, 0xfe, 0x86, 0x78, 0xe0, 0xc0, 0xe0, 0x25, 0x10, 0x25, 0xe0,
+	0x25, 0x10, 0x25, 0xe0, 0x25, 0x10, 0x25, 0xe0, 0x25, 0x10, 0x25, 0xe0, 0x25, 0x10, 0x25, 0xe0,
+	0x25, 0x10, 0x25, 0xe0, 0x25, 0x10, 0x25, 0xe0, 0x25, 0x10, 0x25, 0xe0, 0x25, 0x10, 0x25, 0xe0,
+	0x25, 0x10, 0x25, 0xe0, 0x25, 0x10, 0x25, 0xe0, 0x25, 0x10, 0x25, 0x10, 0xe0, 0xc0, 0x07, 0x00,
+	0x07, 0x00, 0x07, 0xe0, 0xc0, 0x13, 0x25, 0xe0, 0x25, 0x10, 0x25, 0xe0, 0x25, 0x10, 0x25, 0xe0,
+	0x25, 0x10, 0x25, 0xe0, 0x25, 0x10, 0x25, 0xe0, 0x25, 0x10, 0x25, 0xe0, 0x25, 0x10, 0x05, 0x2c,
+	0xe0, 0xc0, 0x07, 0x00, 0x07, 0x00, 0x07, 0x00, 0x07, 0x00, 0xfe, 0xf8, 0xc5, 0xfd, 0xd8, 0x85,
+	0x00, 0xdf, 0xd5, 0xfe, 0xc1, 0x08, 0x31, 0x00, 0x19, 0x00, 0x31, 0x00, 0x19, 0x00, 0x31, 0x00,
+	0xfe, 0xe9, 0xb0, 0x10, 0xc1, 0x3e, 0x10, 0xc1, 0x3e, 0x10, 0xc1, 0x3e, 0x10, 0xc1, 0x3e, 0x10,
+	0xc1, 0x3e, 0x10, 0xc1, 0x3e, 0xc0, 0x22, 0x00, 0x19, 0x00, 0x31, 0x00, 0x19, 0x00, 0x31, 0x00,
+	0x19, 0xa1, 0xfa, 0x13, 0x10, 0x3e, 0x10, 0xc1, 0x3e, 0x10, 0xc1, 0x3e, 0x10, 0xc1, 0x3e, 0x10,
+	0xc1, 0x3e, 0x10, 0xc1, 0x3e, 0x10, 0xc1, 0x3e, 0x10, 0xc1, 0x3e, 0x10, 0xc1, 0x3e, 0x10, 0xc1,
+	0x3e, 0x10, 0xc1, 0x3e, 0x10, 0xc1, 0x3e, 0x10, 0xc1, 0x25, 0xe0, 0x31, 0x00, 0x19, 0x00, 0x31,
+	0x00, 0x19, 0xe0, 0x31, 0x3e, 0xc0, 0x10, 0xc1, 0x3e, 0x10, 0xc1, 0x3e, 0x10, 0xc1, 0x3e, 0x10,
+	0xc1, 0x3e, 0x10, 0xc1, 0x3e, 0x10, 0xc1, 0x05, 0x9d, 0x16, 0xe0, 0xc0, 0x19, 0x00, 0x31, 0x00,
+	0x19, 0x00, 0x31, 0x07, 0xfd, 0xd8, 0x9c, 0x00, 0xdf, 0xd4, 0x02, 0x00, 0xc0, 0x07, 0x00, 0x07,
+	0x00, 0x07, 0x00, 0x07, 0x00, 0x33, 0x13, 0x25, 0xe0, 0x25, 0x10, 0x25, 0xe0, 0x25, 0x10, 0x25,
+	0xe0, 0x25, 0x10, 0x25, 0xe0, 0x25, 0x10, 0x25, 0xe0, 0x25, 0x10, 0x25, 0xe0, 0x25, 0xe0, 0x22,
+	0x00, 0x07, 0x00, 0x07, 0x00, 0x07, 0x00, 0x07, 0x00, 0x07, 0x00, 0x31, 0x3e, 0x25, 0x10, 0x25,
+	0xe0, 0x25, 0x10, 0x25, 0xe0, 0x25, 0x10, 0x25, 0xe0, 0x25, 0x10, 0x25, 0xe0, 0x25, 0x10, 0x25,
+	0xe0, 0x25, 0x10, 0x25, 0xe0, 0x25, 0x10, 0x25, 0xe0, 0x25, 0x10, 0x25, 0xe0, 0x25, 0x10, 0x25,
+	0xe0, 0x25, 0x10, 0x25, 0xe0, 0x25, 0x10, 0x25, 0xe0, 0x25, 0x10, 0x25, 0xe0, 0x25, 0x13, 0xe0,
+	0xc0, 0x07, 0x00, 0x07, 0x00, 0x07, 0x00, 0x07, 0x00, 0x31, 0x13, 0x25, 0xe0, 0x25, 0x10, 0x25,
+	0xe0, 0x25, 0x10, 0x25, 0xe0, 0x25, 0x10, 0x25, 0xe0, 0x25, 0x10, 0x25, 0xe0, 0x25, 0x10, 0x25,
+	0xe0, 0x25, 0x10, 0x05, 0xfe, 0x65, 0x68, 0x19, 0x00, 0x07, 0x00, 0x07, 0x00, 0x07, 0x00, 0xe0,
+	0xb3, 0x88, 0xfd, 0xd7, 0x85, 0x00, 0xdf, 0xd4, 0x00, 0xc0, 0x19, 0x00, 0x31, 0x00, 0x19, 0x00,
+	0x31, 0x00, 0x19, 0x13, 0x10, 0xc0, 0x3e, 0x10, 0xc1, 0x3e, 0x10, 0xc1, 0x3e, 0x10, 0xc1, 0x3e,
+	0x10, 0xc1, 0x3e, 0x10, 0xc1, 0x3e, 0xc0, 0x22, 0x00, 0x19, 0x00, 0x31, 0x00, 0x19, 0x00, 0x31,
+	0x00, 0x19, 0x00, 0x31, 0x00, 0xe0, 0x10, 0xc1, 0x3e, 0x10, 0xc1, 0x3e, 0x10, 0xc1, 0x3e, 0x10,
+	0xc1, 0x3e, 0x10, 0xc1, 0x3e, 0x10, 0xc1, 0x3e, 0x10, 0xc1, 0x3e, 0x10, 0xc1, 0x3e, 0x10, 0xc1,
+	0x3e, 0x10, 0xc1, 0x3e, 0x10, 0xc1, 0x3e, 0x10, 0xc1, 0x3e, 0x10, 0x22, 0xe0, 0x19, 0x00, 0x31,
+	0x00, 0x19, 0x00, 0x31, 0x00, 0x19, 0x00, 0x31, 0x3e, 0xc0, 0x10, 0xc1, 0x3e, 0x10, 0xc1, 0x3e,
+	0x10, 0xc1, 0x3e, 0x10, 0xc1, 0x3e, 0x10, 0xc1, 0x3e, 0x10, 0xc1, 0x05, 0x00, 0x31, 0x00, 0x19,
+	0x00, 0x31, 0x00, 0x19, 0x00, 0x31, 0xfe, 0xdf, 0xff, 0xfd, 0xd6, 0x9d, 0x00, 0xdf, 0xd3, 0x92,
+	0x99, 0xe0, 0x07, 0x00, 0x07, 0x00, 0x07, 0x00, 0x07, 0x00, 0xc0, 0x22, 0x10, 0xc0, 0x25, 0x10,
+	0x25, 0xe0, 0x25, 0x10, 0x25, 0xe0, 0x25, 0x10, 0x25, 0xe0, 0x25, 0x10, 0x25, 0xe0, 0x25, 0x10,
+	0x25, 0xe0, 0x25, 0xe0, 0x34, 0x00, 0x07, 0x00, 0x07, 0x00, 0x07, 0x00, 0x07, 0x00, 0x07, 0x00,
+	0x07, 0x00, 0x07, 0x18, 0x05, 0xe0, 0x25, 0x10, 0x25, 0xe0, 0x25, 0x10, 0x25, 0xe0, 0x25, 0x10,
+	0x25, 0xe0, 0x25, 0x10, 0x25, 0xe0, 0x25, 0x10, 0x25, 0xe0, 0x25, 0x10, 0x25, 0xe0, 0x25, 0x10,
+	0x25, 0xe0, 0x25, 0x10, 0x25, 0xe0, 0x25, 0x10, 0x25, 0xe0, 0x25, 0x10, 0x25, 0xe0, 0x25, 0x10,
+	0x25, 0xe0, 0x25, 0x10, 0x17, 0x33, 0x15, 0x00, 0x07, 0x00, 0x07, 0x00, 0x07, 0x00, 0x07, 0x00,
+	0x07, 0x00, 0x31, 0x13, 0x25, 0xe0, 0x25, 0x10, 0x25, 0xe0, 0x25, 0x10, 0x25, 0xe0, 0x25, 0x10,
+	0x25, 0xe0, 0x25, 0x10, 0x25, 0xe0, 0x25, 0x10, 0x25, 0xe0, 0x25, 0x10, 0x22, 0x00, 0x07, 0x00,
+	0x07, 0x00, 0x07, 0x00, 0x07, 0x00, 0xb5, 0x99, 0xfd, 0xd6, 0x87, 0x00, 0xdf, 0xd3, 0x00, 0x19,
+	0x00, 0x31, 0x00, 0x19, 0x00, 0x31, 0x00, 0x19, 0xfe, 0x64, 0x60, 0x05, 0xe0, 0x3e, 0x10, 0xc1,
+	0x3e, 0x10, 0xc1, 0x3e, 0x10, 0xc1, 0x3e, 0x10, 0xc1, 0x3e, 0x10, 0xc1, 0x3e, 0xc0, 0x9f, 0x48,
+	0x00, 0x19, 0x00, 0x31, 0x00, 0x19, 0x00, 0x31, 0x00, 0x19, 0x00, 0x31, 0x00, 0x19, 0x00, 0xc0,
+	0x2c, 0x25, 0x10, 0xc1, 0x7a, 0x10, 0xc1, 0x3e, 0x10, 0xc1, 0x3e, 0x10, 0xc1, 0x3e, 0x10, 0xc1,
+	0x3e, 0x10, 0xc1, 0x3e, 0x10, 0xc1, 0x3e, 0x10, 0xc1, 0x3e, 0x10, 0xc1, 0x3e, 0x10, 0xc1, 0x3e,
+	0x10, 0xc1, 0x3e, 0x10, 0xc0, 0x13, 0x31, 0x00, 0x31, 0x00, 0x19, 0x00, 0x31, 0x00, 0x19, 0x00,
+	0x31, 0x00, 0x19, 0x00, 0xc0, 0x10, 0xc3, 0x3e, 0x10, 0xc1, 0x3e, 0x10, 0xc1, 0x3e, 0x10, 0xc1,
+	0x3e, 0x10, 0xc1, 0x3e, 0x10, 0xc0, 0x13, 0x30, 0x00, 0x31, 0x00, 0x19, 0x00, 0x31, 0x00, 0x19,
+	0x00, 0xfd, 0xd6, 0xa1, 0x00, 0xdf, 0xd2, 0x26, 0xe0, 0xc0, 0x07, 0x00, 0x07, 0x00, 0x07, 0x00,
+	0x07, 0x00, 0x10, 0xc0, 0x25, 0x10, 0x25, 0xe0, 0x25, 0x10, 0x25, 0xe0, 0x25, 0x10, 0x25, 0xe0,
+	0x25, 0x10, 0x25, 0xe0, 0x25, 0x10, 0x25, 0xe0, 0x25, 0xa0, 0xa8, 0xfe, 0xa6, 0x80, 0x00, 0x07,
+	0x00, 0x07, 0x00, 0x07, 0x00, 0x07, 0x00, 0x07, 0x00, 0x07, 0x00, 0x07, 0x00, 0x07, 0xe0, 0xc0,
+	0x10, 0xc1, 0x25, 0x10, 0x25, 0xe0, 0x25, 0x10, 0x25, 0xe0, 0x25, 0x10, 0x25, 0xe0, 0x25, 0x10,
+	0x25, 0xe0, 0x25, 0x10, 0x25, 0xe0, 0x25, 0x10, 0x25, 0xe0, 0x25, 0x10, 0x25, 0xe0, 0x25, 0x10,
+	0x25, 0xe0, 0x25, 0x10, 0x25, 0xe0, 0x25, 0x10, 0x25, 0xe0, 0x25, 0x10, 0x25, 0xc0, 0x09, 0x00,
+	0x07, 0x00, 0x07, 0x00, 0x07, 0x00, 0x07, 0x00, 0x07, 0x00, 0x07, 0x00, 0x07, 0xe0, 0xc0, 0xe0,
+	0x25, 0xe0, 0x25, 0x10, 0x25, 0xe0, 0x25, 0x10, 0x25, 0xe0, 0x25, 0x10, 0x25, 0xe0, 0x25, 0x10,
+	0x25, 0xe0, 0x25, 0x10, 0x25, 0xe0, 0x25, 0x10, 0xe0, 0xc0, 0x07, 0x00, 0x07, 0x00, 0x07, 0x00,
+	0x07, 0xfe, 0x55, 0xad, 0xfd, 0xd5, 0x93, 0x00, 0xdf, 0xd2, 0xfe, 0xaa, 0x52, 0xe0, 0x31, 0x00,
+	0x19, 0x00, 0x31, 0x00, 0x19, 0x00, 0xfe, 0x65, 0x60, 0x13, 0x3e, 0x10, 0xc1, 0x3e, 0x10, 0xc1,
+	0x3e, 0x10, 0xc1, 0x3e, 0x10, 0xc1, 0x3e, 0x10, 0xc1, 0x3e, 0x13, 0xfe, 0xa6, 0x78, 0x00, 0x19,
+	0x00, 0x31, 0x00, 0x19, 0x00, 0x31, 0x00, 0x19, 0x00, 0x31, 0x00, 0x19, 0x00, 0x31, 0x00, 0x19,
+	0xe0, 0x31, 0x3e, 0xc0, 0x10, 0xc1, 0x3e, 0x10, 0xc1, 0x3e, 0x10, 0xc1, 0x3e, 0x10, 0xc1, 0x3e,
+	0x10, 0xc1, 0x3e, 0x10, 0xc1, 0x3e, 0x10, 0xc1, 0x3e, 0x10, 0xc1, 0x3e, 0x10, 0xc1, 0x3e, 0x10,
+	0xc1, 0x3e, 0x10, 0xc0, 0x3e, 0x9f, 0x69, 0x00, 0x31, 0x00, 0x19, 0x00, 0x31, 0x00, 0x19, 0x00,
+	0x31, 0x00, 0x19, 0x00, 0x31, 0x00, 0x19, 0xe0, 0xc0, 0xfe, 0xc8, 0xa8, 0x25, 0x10, 0xc1, 0x3e,
+	0x10, 0xc1, 0x3e, 0x10, 0xc1, 0x3e, 0x10, 0xc1, 0x3e, 0x10, 0xc1, 0x3e, 0x10, 0xa1, 0xa9, 0x1b,
+	0xe0, 0xc0, 0x31, 0x00, 0x19, 0x00, 0x31, 0x00, 0xc0, 0xfd, 0xd5, 0x9c, 0x00, 0xdf, 0xd2, 0x00,
+	0x07, 0x00, 0x07, 0x00, 0x07, 0x00, 0x07, 0x00, 0xc0, 0x10, 0x25, 0x10, 0x25, 0xe0, 0x25, 0x10,
+	0x25, 0xe0, 0x25, 0x10, 0x25, 0xe0, 0x25, 0x10, 0x25, 0xe0, 0x25, 0x10, 0x25, 0xe0, 0x25, 0x21,
+	0x1c, 0x00, 0x07, 0x00, 0x07, 0x00, 0x07, 0x00, 0x07, 0x00, 0x07, 0x00, 0x07, 0x00, 0x07, 0x00,
+	0x07, 0x00, 0x07, 0x00, 0x07, 0x00, 0xc0, 0x2c, 0x05, 0xe0, 0x25, 0x10, 0x25, 0xe0, 0x25, 0x10,
+	0x25, 0xe0, 0x25, 0x10, 0x25, 0xe0, 0x25, 0x10, 0x25, 0xe0, 0x25, 0x10, 0x25, 0xe0, 0x25, 0x10,
+	0x25, 0xe0, 0x25, 0x10, 0x25, 0xe0, 0x25, 0x10, 0x25, 0xe0, 0x25, 0x10, 0x25, 0xe0, 0x25, 0x10,
+	0x25, 0xc0, 0x34, 0x00, 0x07, 0x00, 0x07, 0x00, 0x07, 0x00, 0x07, 0x00, 0x07, 0x00, 0x07, 0x00,
+	0x07, 0x00, 0x07, 0x00, 0x07, 0xe0, 0xc0, 0x2c, 0x05, 0xe0, 0x25, 0x10, 0x25, 0xe0, 0x25, 0x10,
+	0x25, 0xe0, 0x25, 0x10, 0x25, 0xe0, 0x25, 0x10, 0x25, 0xe0, 0x25, 0x10, 0x25, 0x10, 0x05, 0xe0,
+	0x07, 0x00, 0x07, 0x00, 0x07, 0x00, 0x07, 0xfd, 0xd6, 0x97, 0x00, 0xdf, 0xd1, 0x51, 0xe0, 0xc0,
+	0x19, 0x00, 0x31, 0x00, 0x19, 0x00, 0x31, 0xe0, 0x05, 0x10, 0xc1, 0x3e, 0x10, 0xc1, 0x3e, 0x10,
+	0xc1, 0x3e, 0x10, 0xc1, 0x3e, 0x10, 0xc2, 0x13, 0xfe, 0x21, 0x18, 0x00, 0x19, 0x00, 0x31, 0x00,
+	0x19, 0x00, 0x31, 0x00, 0x19, 0x00, 0x31, 0x00, 0x19, 0x00, 0x31, 0x00, 0x19, 0x00, 0x31, 0x00,
+	0x19, 0xe0, 0xc0, 0xfe, 0x85, 0x68, 0xfe, 0x0a, 0xd9, 0x10, 0xc1, 0x3e, 0x10, 0xc1, 0x3e, 0x10,
+	0xc1, 0x3e, 0x10, 0xc1, 0x3e, 0x10, 0xc1, 0x3e, 0x10, 0xc1, 0x3e, 0x10, 0xc1, 0x3e, 0x10, 0xc1,
+	0x3e, 0x10, 0xc1, 0x3e, 0x10, 0xc0, 0x01, 0xfe, 0x85, 0x70, 0x00, 0x31, 0x00, 0x19, 0x00, 0x31,
+	0x00, 0x19, 0x00, 0x31, 0x00, 0x19, 0x00, 0x31, 0x00, 0x19, 0x00, 0x31, 0x00, 0x19, 0xe0, 0xc0,
+	0xfe, 0x86, 0x78, 0x05, 0x45, 0xc1, 0x3e, 0x10, 0xc1, 0x3e, 0x10, 0xc1, 0x3e, 0x10, 0xc1, 0x3e,
+	0x10, 0xc1, 0x3e, 0x7a, 0x06, 0x00, 0x19, 0x00, 0x31, 0x00, 0x19, 0x00, 0x31, 0xfe, 0x31, 0x84,
+	0xfd, 0xd4, 0xa6, 0x00, 0xdf, 0xd1, 0x82, 0x99, 0xe0, 0x07, 0x00, 0x07, 0x00, 0x07, 0x00, 0x07,
+	0x00, 0xfe, 0xa7, 0x88, 0x25, 0xc0, 0xe0, 0x25, 0x10, 0x25, 0xe0, 0x25, 0x10, 0x25, 0xe0, 0x25,
+	0x10, 0x25, 0xe0, 0x25, 0x10, 0x25, 0xe0, 0x25, 0x3e, 0x19, 0x00, 0x07, 0x00, 0x07, 0x00, 0x07,
+	0x00, 0x07, 0x00, 0x07, 0x00, 0x07, 0x00, 0x07, 0x00, 0x07, 0x00, 0x07, 0x00, 0x07, 0x00, 0x07,
+	0x00, 0x07, 0xe0, 0x19, 0x23, 0xfe, 0xc8, 0x98, 0x33, 0x25, 0x59, 0x25, 0xe0, 0x25, 0x10, 0x25,
+	0xe0, 0x25, 0x10, 0x25, 0xe0, 0x25, 0x10, 0x25, 0xe0, 0x25, 0x10, 0x25, 0xe0, 0x25, 0x10, 0x25,
+	0xe0, 0x25, 0x10, 0x25, 0xe0, 0x25, 0x10, 0x25, 0xe0, 0x25, 0x10, 0x33, 0x1a, 0x18, 0x00, 0x07,
+	0x00, 0x07, 0x00, 0x07, 0x00, 0x07, 0x00, 0x07, 0x00, 0x07, 0x00, 0x07, 0x00, 0x07, 0x00, 0x07,
+	0x00, 0x07, 0x00, 0x07, 0xe0, 0x31, 0xfe, 0x64, 0x60, 0x08, 0xe0, 0x25, 0x10, 0x25, 0xe0, 0x25,
+	0x10, 0x25, 0xe0, 0x25, 0x10, 0x25, 0xe0, 0x25, 0x10, 0x25, 0xe0, 0x25, 0x10, 0x25, 0x1a, 0xe0,
+	0xc0, 0x07, 0x00, 0x07, 0x00, 0x07, 0x00, 0xc0, 0xfd, 0xd4, 0x99, 0x00, 0xdf, 0xd1, 0x00, 0x19,
+	0x00, 0x31, 0x00, 0x19, 0x00, 0x31, 0x00, 0xc0, 0x3e, 0x10, 0xc0, 0x3e, 0x10, 0xc1, 0x3e, 0x10,
+	0xc1, 0x3e, 0x10, 0xc1, 0x3e, 0x10, 0xc1, 0x25, 0x9f, 0x46, 0x00, 0xc0, 0x19, 0x00, 0x31, 0x00,
+	0x19, 0x00, 0x31, 0x00, 0x19, 0x00, 0x31, 0x00, 0x19, 0x00, 0x31, 0x00, 0x19, 0x00, 0x31, 0x00,
+	0x19, 0x00, 0x31, 0x00, 0x19, 0x00, 0x31, 0x00, 0xa1, 0xea, 0xfe, 0xa6, 0x88, 0xfe, 0x0a, 0xd9,
+	0x3e, 0xe0, 0xc2, 0x3e, 0x10, 0xc1, 0x3e, 0x10, 0xc1, 0x3e, 0x10, 0xc1, 0x3e, 0x10, 0xc1, 0x3e,
+	0x10, 0xc1, 0x3e, 0x10, 0xc1, 0x25, 0x01, 0x1a, 0xfe, 0x23, 0x40, 0x00, 0xc0, 0x31, 0x00, 0x19,
+	0x00, 0x31, 0x00, 0x19, 0x00, 0x31, 0x00, 0x19, 0x00, 0x31, 0x00, 0x19, 0x00, 0x31, 0x00, 0x19,
+	0x00, 0x31, 0x00, 0x19, 0x00, 0xc0, 0x18, 0x33, 0x10, 0xc1, 0x3e, 0x10, 0xc1, 0x3e, 0x10, 0xc1,
+	0x3e, 0x10, 0xc1, 0x3e, 0x10, 0xc1, 0x25, 0xe0, 0x31, 0x00, 0x19, 0x00, 0x31, 0x00, 0x19, 0xe0,
+	0xfe, 0xdf, 0xff, 0xfd, 0xd3, 0xaa, 0x00, 0xdf, 0xd0, 0x1f, 0xe0, 0xc0, 0x07, 0x00, 0x07, 0x00,
+	0x07, 0x00, 0x07, 0xe0, 0xfe, 0x0a, 0xc9, 0xe0, 0x25, 0x10, 0x25, 0xe0, 0x25, 0x10, 0x25, 0xe0,
+	0x25, 0x10, 0x25, 0xe0, 0x25, 0x10, 0x25, 0xe0, 0x33, 0x9d, 0x06, 0x00, 0xc0, 0x07, 0x00, 0x07,
+	0x00, 0x07, 0x00, 0x07, 0x00, 0x07, 0x00, 0x07, 0x00, 0x07, 0x00, 0x07, 0x00, 0x07, 0x00, 0x07,
+	0x00, 0x07, 0x00, 0x07, 0x00, 0x07, 0x00, 0x07, 0x00, 0x07, 0x00, 0x31, 0x00, 0xfe, 0x86, 0x70,
+	0xa2, 0xe9, 0x08, 0x13, 0x17, 0x10, 0x25, 0xe0, 0x25, 0x10, 0x25, 0xe0, 0x25, 0x10, 0x25, 0xe0,
+	0x25, 0x10, 0x25, 0xe0, 0x25, 0x10, 0x25, 0xe0, 0x25, 0x10, 0x05, 0x7a, 0x25, 0x9d, 0x06, 0x06,
+	0x00, 0x07, 0xe0, 0x07, 0x00, 0x07, 0x00, 0x07, 0x00, 0x07, 0x00, 0x07, 0x00, 0x07, 0x00, 0x07,
+	0x00, 0x07, 0x00, 0x07, 0x00, 0x07, 0x00, 0x07, 0x00, 0x07, 0x00, 0x07, 0xe0, 0x19, 0x23, 0x17,
+	0xe0, 0x25, 0x10, 0x25, 0xe0, 0x25, 0x10, 0x25, 0xe0, 0x25, 0x10, 0x25, 0xe0, 0x25, 0x10, 0x25,
+	0xe0, 0x25, 0x13, 0xfe, 0x42, 0x20, 0x00, 0x07, 0x00, 0x07, 0x00, 0x07, 0x00, 0xc0, 0x03, 0xfd,
+	0xd3, 0x95, 0x00, 0xdf, 0xd0, 0x9d, 0x99, 0xe0, 0x31, 0x00, 0x19, 0x00, 0x31, 0x00, 0x19, 0x00,
+	0xfe, 0x65, 0x60, 0x3e, 0xe0, 0xce, 0x08, 0xfe, 0x44, 0x58, 0x00, 0xc0, 0x19, 0x00, 0x31, 0x00,
+	0x19, 0x00, 0x31, 0x00, 0x19, 0x00, 0x31, 0x00, 0x19, 0x00, 0x31, 0x00, 0x19, 0x00, 0x31, 0x00,
+	0x19, 0x00, 0x31, 0x00, 0x19, 0x00, 0x31, 0x00, 0x19, 0x00, 0x31, 0x00, 0x19, 0x00, 0xc1, 0xfe,
+	0x84, 0x58, 0xa1, 0xea, 0x2c, 0x01, 0x6e, 0x55, 0x25, 0x3e, 0x25, 0x10, 0xc5, 0x25, 0x3e, 0x05,
+	0x13, 0x08, 0x9e, 0x46, 0x4a, 0x22, 0x9d, 0x27, 0x00, 0xc1, 0x19, 0x00, 0x31, 0x00, 0x19, 0x00,
+	0x31, 0x00, 0x19, 0x00, 0x31, 0x00, 0x19, 0x00, 0x31, 0x00, 0x19, 0x00, 0x31, 0x00, 0x19, 0x00,
+	0x31, 0x00, 0x19, 0x00, 0x31, 0x00, 0x19, 0x00, 0x31, 0x00, 0xfe, 0xc8, 0xa0, 0xa1, 0xd9, 0xe0,
+	0xc0, 0x3e, 0x10, 0xc1, 0x3e, 0x10, 0xc5, 0x3e, 0x10, 0x3e, 0x2c, 0xe0, 0xc0, 0x31, 0x00, 0x19,
+	0x00, 0x31, 0xe0, 0xfe, 0x31, 0x8c, 0xfd, 0xd3, 0xae, 0x00, 0xdf, 0xd0, 0x8e, 0x88, 0xe0, 0xc0,
+	0x07, 0x00, 0x07, 0x00, 0x07, 0x00, 0xc0, 0xfe, 0xc8, 0xa0, 0xa2, 0xc9, 0xe0, 0x25, 0xe0, 0x25,
+	0xe0, 0x25, 0xe0, 0x25, 0xe0, 0x25, 0xe0, 0x25, 0xe0, 0x25, 0xe0, 0x17, 0x14, 0x31, 0xe0, 0x07,
+	0x00, 0x07, 0x00, 0x07, 0x00, 0x07, 0x00, 0x07, 0x00, 0x07, 0x00, 0x07, 0x00, 0x07, 0x00, 0x07,
+	0x00, 0x07, 0x00, 0x07, 0x00, 0x07, 0x00, 0x07, 0x00, 0x07, 0x00, 0x07, 0x00, 0x07, 0x00, 0x07,
+	0x00, 0x07, 0xe0, 0x07, 0x00, 0x31, 0x00, 0x31, 0x11, 0x1b, 0xa1, 0xb9, 0x7f, 0x37, 0x6e, 0x1a,
+	0x34, 0x1a, 0x2c, 0xc0, 0xa0, 0x57, 0x09, 0xa0, 0x57, 0x1b, 0x9f, 0x68, 0x00, 0x31, 0x00, 0x07,
+	0x00, 0x07, 0xe0, 0x07, 0x00, 0x07, 0x00, 0x07, 0x00, 0x07, 0x00, 0x07, 0x00, 0x07, 0x00, 0x07,
+	0x00, 0x07, 0x00, 0x07, 0x00, 0x07, 0x00, 0x07, 0x00, 0x07, 0x00, 0x07, 0x00, 0x07, 0x00, 0x07,
+	0x00, 0x07, 0x00, 0x07, 0x00, 0xfe, 0xa7, 0x88, 0xfe, 0x0a, 0xd1, 0x25, 0x10, 0x25, 0xe0, 0x25,
+	0x10, 0x25, 0xe0, 0x25, 0xe0, 0x25, 0xe0, 0x25, 0x10, 0x25, 0x10, 0x25, 0xe0, 0x07, 0x00, 0x07,
+	0x00, 0x07, 0x00, 0x07, 0xa6, 0x88, 0xfd, 0xd3, 0x80, 0x00, 0xdf, 0xd0, 0x2b, 0xe0, 0x19, 0x00,
+	0x31, 0x00, 0x19, 0x00, 0x31, 0xe0, 0xfe, 0xe9, 0xc8, 0x10, 0xcc, 0x3e, 0x2c, 0x00, 0x31, 0x00,
+	0x19, 0x00, 0x31, 0x00, 0x19, 0x00, 0x31, 0x00, 0x19, 0x00, 0x31, 0x00, 0x19, 0x00, 0x31, 0x00,
+	0x19, 0x00, 0x31, 0x00, 0x19, 0x00, 0x31, 0x00, 0x19, 0x00, 0x31, 0x00, 0x19, 0x00, 0x31, 0x00,
+	0x19, 0x00, 0x31, 0x00, 0x19, 0x00, 0x31, 0x00, 0x19, 0x00, 0x31, 0x00, 0xcd, 0x31, 0x00, 0x19,
+	0x00, 0x31, 0x00, 0x19, 0x00, 0x31, 0x00, 0x19, 0x00, 0x31, 0x00, 0xc1, 0x31, 0x00, 0x1c, 0x06,
+	0x31, 0x00, 0x31, 0x00, 0xc1, 0x19, 0x00, 0x31, 0x00, 0x19, 0x00, 0x31, 0x00, 0x19, 0x00, 0x31,
+	0x00, 0x19, 0x00, 0x31, 0x00, 0xfe, 0x44, 0x58, 0x01, 0xe0, 0xcd, 0x3e, 0xe0, 0xc0, 0x19, 0x00,
+	0x31, 0x00, 0x19, 0x00, 0xc0, 0xfe, 0xdf, 0xff, 0xfd, 0xd2, 0x93, 0x00, 0xdf, 0xd0, 0x00, 0x07,
+	0x00, 0x07, 0x00, 0x07, 0x00, 0x07, 0x00, 0xe1, 0x5b, 0xe0, 0x25, 0xe0, 0x3e, 0xe0, 0x25, 0xe2,
+	0x25, 0xe1, 0x33, 0x1b, 0x00, 0x07, 0x00, 0x07, 0x00, 0x07, 0x00, 0x07, 0x00, 0x07, 0x00, 0x07,
+	0x00, 0x07, 0x00, 0x07, 0x00, 0x07, 0x00, 0x07, 0x00, 0xc9, 0x07, 0x00, 0x07, 0x00, 0x07, 0x00,
+	0x07, 0x00, 0x07, 0x00, 0x07, 0x00, 0x07, 0x00, 0x07, 0x00, 0x07, 0xe0, 0x07, 0xe0, 0x07, 0xe0,
+	0x07, 0xe0, 0x07, 0xe0, 0x07, 0xe0, 0x07, 0xe0, 0x07, 0x00, 0x07, 0x00, 0x07, 0x00, 0x07, 0x00,
+	0x07, 0x00, 0x07, 0x00, 0x31, 0xc0, 0x09, 0x1a, 0x25, 0x3e, 0x33, 0x13, 0x05, 0xc0, 0x33, 0x25,
+	0x6e, 0x1a, 0x1b, 0x0a, 0x31, 0x00, 0x07, 0x00, 0x07, 0x00, 0x07, 0x00, 0x07, 0x00, 0x07, 0x00,
+	0x07, 0x00, 0x07, 0x00, 0x31, 0x3e, 0x17, 0xe0, 0x25, 0xe0, 0x25, 0xe0, 0x3e, 0xe0, 0x25, 0xe0,
+	0x25, 0xe0, 0x25, 0xe0, 0x05, 0x19, 0x07, 0x00, 0x07, 0x00, 0x07, 0x00, 0x07, 0xfd, 0xd4, 0x8f,
+	0x00, 0xdf, 0xcf, 0x26, 0xe0, 0xc0, 0x31, 0x00, 0x19, 0x00, 0x31, 0x00, 0x19, 0xe1, 0x10, 0xc9,
+	0x3e, 0xe0, 0xfe, 0x22, 0x20, 0x00, 0x31, 0x00, 0x19, 0x00, 0x31, 0x00, 0x19, 0x00, 0x31, 0x00,
+	0x19, 0x00, 0x31, 0x00, 0x19, 0x00, 0xc1, 0x31, 0x3b, 0x09, 0xa1, 0xa8, 0x10, 0x08, 0x6f, 0x10,
+	0xc0, 0x08, 0x17, 0x9e, 0x58, 0x9f, 0x47, 0x00, 0xc1, 0x19, 0x00, 0x31, 0x00, 0x19, 0x00, 0x31,
+	0x00, 0x19, 0x00, 0x31, 0x00, 0x19, 0x00, 0x31, 0x00, 0x19, 0x00, 0x31, 0x00, 0x19, 0x00, 0x31,
+	0x00, 0x19, 0x00, 0x31, 0x00, 0x19, 0x00, 0x31, 0x00, 0x19, 0x00, 0x31, 0x00, 0xc1, 0xfe, 0xa6,
+	0x80, 0x10, 0x33, 0x10, 0xca, 0x3e, 0x7f, 0x10, 0x2c, 0xfe, 0x43, 0x48, 0xe0, 0xc0, 0x19, 0x00,
+	0x31, 0x00, 0x19, 0x00, 0x31, 0x00, 0x19, 0x00, 0x31, 0x00, 0xc0, 0x17, 0x33, 0x10, 0xca, 0x3e,
+	0xfe, 0x42, 0x28, 0x00, 0x31, 0x00, 0x19, 0x00, 0x31, 0x00, 0xc0, 0xfe, 0x9e, 0xf7, 0xfd, 0xd2,
+	0x9a, 0x00, 0xdf, 0xf1, 0x07, 0x00, 0x07, 0x00, 0x07, 0x00, 0x07, 0x00, 0xa2, 0x77, 0xe0, 0x25,
+	0xe2, 0x37, 0xe2, 0x37, 0xe0, 0x05, 0x2c, 0x31, 0x00, 0x07, 0x00, 0x07, 0x00, 0x07, 0x00, 0x07,
+	0x00, 0x07, 0x00, 0x07, 0x00, 0x07, 0x00, 0x07, 0x00, 0x1c, 0xfe, 0xa6, 0x90, 0x10, 0x3e, 0x05,
+	0x10, 0x7f, 0xe0, 0xc1, 0x37, 0xe0, 0xc1, 0x25, 0xc0, 0x05, 0x2c, 0x9e, 0x26, 0x00, 0x31, 0x00,
+	0x07, 0x00, 0x07, 0x00, 0x07, 0x00, 0x07, 0x00, 0x07, 0x00, 0x07, 0x00, 0x07, 0x00, 0x07, 0x00,
+	0x07, 0x00, 0x07, 0x00, 0x07, 0x00, 0x07, 0x00, 0x07, 0x00, 0x07, 0x00, 0x07, 0x00, 0x07, 0x00,
+	0x31, 0xfe, 0x86, 0x88, 0x05, 0x3e, 0xe0, 0xc2, 0x37, 0xe2, 0x25, 0xe0, 0x3e, 0xe0, 0x25, 0xe0,
+	0x25, 0x59, 0x25, 0x10, 0x33, 0x10, 0x9d, 0x17, 0x00, 0x19, 0x00, 0x07, 0x00, 0x07, 0x00, 0x07,
+	0x00, 0x07, 0x00, 0x07, 0xe0, 0xc0, 0xfe, 0x44, 0x50, 0x05, 0xe2, 0x25, 0xe2, 0x25, 0xe2, 0x05,
+	0xfe, 0x64, 0x58, 0xe0, 0xc0, 0x07, 0x00, 0x07, 0x00, 0x07, 0xfd, 0xd4, 0xb9, 0x00, 0xd5, 0x66,
+	0xe0, 0x26, 0xe0, 0x26, 0xe0, 0x26, 0xc5, 0xe0, 0x26, 0xe0, 0x26, 0xe0, 0x26, 0xe0, 0x26, 0xe0,
+	0x26, 0xe2, 0x9d, 0x99, 0xe0, 0xc0, 0x19, 0x00, 0x31, 0x00, 0x19, 0x00, 0x31, 0xc0, 0x25, 0x55,
+	0xe0, 0x1e, 0xe0, 0x56, 0xe0, 0x1e, 0xe0, 0xc0, 0x05, 0x38, 0x00, 0xc0, 0x31, 0x00, 0x19, 0x00,
+	0x31, 0x00, 0x19, 0x00, 0x31, 0x00, 0x19, 0x00, 0x31, 0x00, 0xc0, 0xfe, 0x64, 0x60, 0x22, 0xa0,
+	0xb8, 0x3e, 0x22, 0x10, 0xc1, 0x1e, 0xe0, 0x1e, 0xe0, 0x30, 0xe0, 0x30, 0xe0, 0x30, 0x10, 0x30,
+	0x10, 0x3e, 0x10, 0x9c, 0x06, 0xe0, 0xc0, 0x31, 0x00, 0x19, 0x00, 0x31, 0x00, 0x19, 0x00, 0x31,
+	0x00, 0x19, 0x00, 0x31, 0x00, 0x19, 0x00, 0x31, 0x00, 0x19, 0x00, 0x31, 0x00, 0x19, 0x00, 0x31,
+	0x00, 0x19, 0x00, 0x31, 0x00, 0x3b, 0x3e, 0xc0, 0x30, 0x10, 0x30, 0xe0, 0x30, 0xe0, 0x30, 0xe0,
+	0x66, 0xe0, 0xcb, 0x3e, 0x25, 0xfe, 0x65, 0x70, 0xe0, 0xc0, 0x31, 0x00, 0x19, 0x00, 0x31, 0x00,
+	0x19, 0x00, 0x31, 0xe0, 0xc1, 0x22, 0x3e, 0xe0, 0x66, 0xe0, 0x1e, 0xe0, 0x1e, 0xe2, 0xc0, 0x29,
+	0xe0, 0x19, 0x00, 0x31, 0x00, 0x19, 0x00, 0xc0, 0xfe, 0x3c, 0xe7, 0xe4, 0x26, 0xe0, 0x26, 0xe0,
+	0x26, 0xc7, 0xe0, 0x26, 0xe0, 0x26, 0xfa, 0xae, 0x00, 0xd6, 0x26, 0x6e, 0x26, 0xcd, 0x18, 0x26,
+	0x18, 0x26, 0x18, 0xc2, 0x9c, 0x88, 0xe0, 0x07, 0x00, 0x07, 0x00, 0x07, 0x00, 0x07, 0x00, 0xa2,
+	0x78, 0x3e, 0x10, 0xc3, 0x22, 0x10, 0x3e, 0x9f, 0x58, 0x00, 0x07, 0xe0, 0x07, 0x00, 0x07, 0x00,
+	0x07, 0x00, 0x07, 0x00, 0x07, 0x00, 0x07, 0x00, 0x07, 0x00, 0xfe, 0x65, 0x68, 0x22, 0x05, 0x10,
+	0x25, 0x10, 0xc1, 0x37, 0xe0, 0xc4, 0x22, 0x10, 0x22, 0x10, 0x22, 0x10, 0x22, 0x10, 0x22, 0x25,
+	0x10, 0xfe, 0x64, 0x50, 0x00, 0x07, 0x00, 0x07, 0x00, 0x07, 0x00, 0x07, 0x00, 0x07, 0x00, 0x07,
+	0x00, 0x07, 0x00, 0x07, 0x00, 0x07, 0x00, 0x07, 0x00, 0x07, 0x00, 0x07, 0x00, 0x07, 0x00, 0x07,
+	0x00, 0x09, 0x13, 0x10, 0x22, 0x10, 0x22, 0x10, 0x22, 0x10, 0xc6, 0x25, 0xe2, 0x25, 0xe0, 0x25,
+	0xe0, 0x25, 0xe0, 0x25, 0x10, 0x05, 0x22, 0x11, 0x00, 0x07, 0x00, 0x07, 0x00, 0x07, 0x00, 0x07,
+	0x00, 0x07, 0xe0, 0x07, 0x00, 0xfe, 0x86, 0x70, 0x13, 0x10, 0xc4, 0x37, 0xe0, 0x17, 0x09, 0xe0,
+	0xc0, 0x07, 0x00, 0x07, 0x00, 0x07, 0xe0, 0xfe, 0xf8, 0xc5, 0xe3, 0x66, 0x18, 0x26, 0xc4, 0x35,
+	0xe0, 0x35, 0xe2, 0xc2, 0x18, 0x26, 0xf9, 0xd6, 0x00, 0xd1, 0x26, 0xe0, 0x26, 0xc2, 0x55, 0xe0,
+	0x1f, 0x35, 0x1f, 0x35, 0x1f, 0x35, 0x1f, 0x35, 0x1f, 0x35, 0x1f, 0x35, 0x1f, 0xe0, 0x1f, 0xe0,
+	0x1f, 0xe0, 0xc2, 0xe0, 0x9b, 0x99, 0xe0, 0xc0, 0x31, 0x00, 0x19, 0x00, 0x31, 0x00, 0x19, 0x31,
+	0x25, 0x45, 0xe0, 0x08, 0xe0, 0x30, 0x10, 0xc0, 0xfe, 0x43, 0x48, 0x00, 0x19, 0x00, 0x31, 0x00,
+	0x19, 0x00, 0x31, 0x00, 0x19, 0x00, 0x31, 0x00, 0x19, 0x00, 0xc0, 0xa1, 0xea, 0xfe, 0xc9, 0xb0,
+	0x3e, 0x10, 0x1e, 0xe0, 0x1e, 0xe0, 0x1e, 0xe0, 0x30, 0xe0, 0x30, 0xe0, 0x08, 0xe0, 0x30, 0x10,
+	0x08, 0xe0, 0x08, 0xe0, 0x08, 0xe0, 0x08, 0xe0, 0x08, 0x22, 0x3e, 0x9e, 0x16, 0x00, 0xc1, 0x19,
+	0x00, 0x31, 0x00, 0x19, 0x00, 0x31, 0x00, 0x19, 0x00, 0x31, 0x00, 0x19, 0x00, 0x31, 0x00, 0x19,
+	0x00, 0x31, 0x00, 0x19, 0x00, 0x31, 0x00, 0x02, 0x30, 0x22, 0x08, 0xe0, 0x08, 0xe0, 0x08, 0xe0,
+	0x08, 0x22, 0x30, 0xe0, 0x30, 0xe0, 0x30, 0xe0, 0x1e, 0xe2, 0xc6, 0x3e, 0x10, 0xc0, 0xa1, 0xb9,
+	0xfe, 0x86, 0x78, 0x00, 0x31, 0x00, 0x19, 0x00, 0x31, 0x00, 0x19, 0x00, 0x31, 0x00, 0x19, 0x00,
+	0xc0, 0x1a, 0x25, 0x08, 0xe0, 0x30, 0xe0, 0x30, 0xe0, 0x1e, 0x1a, 0xe0, 0x31, 0x00, 0x19, 0x00,
+	0x31, 0x00, 0xc0, 0xfe, 0xf7, 0xbd, 0xe0, 0x66, 0xe0, 0x26, 0xc2, 0x1f, 0xe0, 0x1f, 0x35, 0x1f,
+	0xc0, 0x66, 0xe0, 0x1f, 0x35, 0x1f, 0x35, 0x1f, 0xe0, 0x35, 0xe0, 0xc0, 0xe0, 0x26, 0xf6, 0xc8,
+	0x00, 0xd2, 0x26, 0xc0, 0x35, 0xe0, 0x1f, 0x35, 0x1f, 0x35, 0x2d, 0x35, 0x2d, 0xc3, 0xe0, 0x2d,
+	0x35, 0x2d, 0x35, 0x1f, 0x35, 0x1f, 0x26, 0x35, 0xe2, 0xc0, 0xe1, 0x07, 0x00, 0x07, 0x00, 0x07,
+	0x00, 0x07, 0x00, 0xa2, 0x89, 0x3e, 0x5a, 0x30, 0x10, 0xc0, 0x25, 0x9d, 0x16, 0x00, 0xc0, 0x07,
+	0x00, 0x07, 0x00, 0x07, 0x00, 0x07, 0x00, 0x07, 0x00, 0x07, 0x00, 0x07, 0x00, 0x31, 0xfe, 0x65,
+	0x68, 0x05, 0x22, 0x10, 0xc7, 0x22, 0x10, 0x56, 0x10, 0x30, 0x10, 0x30, 0x22, 0x08, 0x22, 0x30,
+	0x22, 0x08, 0x22, 0x30, 0x22, 0x08, 0x22, 0x30, 0x10, 0xe0, 0x07, 0x00, 0x07, 0x00, 0x07, 0x00,
+	0x07, 0x00, 0x07, 0x00, 0x07, 0x00, 0x07, 0x00, 0x07, 0x00, 0x07, 0x00, 0x07, 0x00, 0x07, 0x00,
+	0x07, 0x00, 0xfe, 0xe9, 0xb0, 0x30, 0x22, 0x08, 0x22, 0x30, 0x22, 0x08, 0x22, 0x30, 0x22, 0x30,
+	0x10, 0x30, 0x10, 0x22, 0x10, 0xc2, 0x37, 0xe2, 0x25, 0xe0, 0x25, 0xe0, 0x25, 0x10, 0x25, 0xe0,
+	0x25, 0xc0, 0x2c, 0x00, 0x07, 0x00, 0x07, 0x00, 0x07, 0x00, 0x07, 0x00, 0x07, 0x00, 0x07, 0xe0,
+	0xc0, 0x38, 0x25, 0xe0, 0xc0, 0x22, 0x10, 0xc0, 0x37, 0xe1, 0xc0, 0x07, 0x00, 0x07, 0x00, 0x07,
+	0xe0, 0x3a, 0xe0, 0xc0, 0x26, 0xc0, 0x35, 0xe0, 0x1f, 0x35, 0x2d, 0x35, 0x2d, 0xc5, 0x35, 0x2d,
+	0x35, 0x1f, 0x26, 0x35, 0xe0, 0xc0, 0x18, 0x26, 0xf5, 0xd1, 0x00, 0xcf, 0x26, 0xe0, 0x26, 0xc0,
+	0x1f, 0xe0, 0x2d, 0xc2, 0x55, 0x7b, 0x26, 0x3c, 0x26, 0x3c, 0x26, 0x3c, 0x26, 0x3c, 0x26, 0xe0,
+	0x26, 0x2d, 0x26, 0x2d, 0xc0, 0x1f, 0xc0, 0x35, 0x1f, 0xe0, 0x9b, 0x88, 0xe0, 0xc0, 0x19, 0x00,
+	0x31, 0x00, 0x19, 0x00, 0x31, 0xc0, 0x10, 0x30, 0x10, 0x30, 0x14, 0x00, 0xc1, 0x19, 0x00, 0x31,
+	0x00, 0x19, 0x00, 0x31, 0x00, 0x19, 0x00, 0x31, 0x00, 0x19, 0x00, 0xc0, 0x1a, 0x25, 0x08, 0x10,
+	0x30, 0xe0, 0x30, 0xe0, 0x30, 0xe0, 0x30, 0xe0, 0x30, 0x10, 0x08, 0x22, 0x08, 0xe0, 0x1a, 0xe0,
+	0x1a, 0x30, 0x1a, 0xc1, 0x02, 0x1a, 0xc1, 0x30, 0x1a, 0xe0, 0x1a, 0x3e, 0x00, 0x31, 0x00, 0x19,
+	0x00, 0x31, 0x00, 0x19, 0x00, 0x31, 0x00, 0x19, 0x00, 0x31, 0x00, 0x19, 0x00, 0x31, 0x00, 0x19,
+	0x00, 0x31, 0x00, 0xfe, 0xa7, 0x98, 0x1a, 0xe0, 0x1a, 0x30, 0x1a, 0xc1, 0x30, 0x1a, 0xe0, 0x1a,
+	0xe0, 0x1a, 0x22, 0x08, 0xe0, 0x08, 0xe0, 0x30, 0xe0, 0x30, 0xe0, 0x1e, 0xe0, 0xca, 0x3e, 0x00,
+	0x31, 0x00, 0x19, 0x00, 0x31, 0x00, 0x19, 0x00, 0x31, 0x00, 0x19, 0xe0, 0xc1, 0xfe, 0x85, 0x70,
+	0x3e, 0x5a, 0x30, 0xe0, 0x30, 0xe1, 0x19, 0x00, 0x31, 0x00, 0x19, 0x00, 0xe1, 0xb8, 0x88, 0xc1,
+	0x1f, 0xe0, 0x55, 0xc0, 0x3c, 0xe0, 0x55, 0x3c, 0x55, 0x3c, 0x34, 0x26, 0x34, 0x3c, 0x26, 0x3c,
+	0x26, 0x2d, 0xc0, 0x1f, 0xc0, 0xe0, 0x1f, 0xe0, 0xc0, 0xe0, 0x66, 0xf2, 0xe2, 0x00, 0xd0, 0x26,
+	0xc0, 0x35, 0xc0, 0x2d, 0xc0, 0x3c, 0xc0, 0x34, 0x3c, 0x34, 0xc0, 0x03, 0x34, 0x03, 0x34, 0x03,
+	0x34, 0xc2, 0x3c, 0x34, 0x3c, 0x59, 0xe0, 0x3c, 0x2d, 0xc0, 0x35, 0x1f, 0x9b, 0x99, 0xe0, 0x07,
+	0x00, 0x07, 0x00, 0x07, 0x00, 0x07, 0x00, 0x15, 0x1c, 0xa1, 0xa9, 0x9f, 0x26, 0x00, 0xc0, 0x07,
+	0xe0, 0x07, 0x00, 0x07, 0x00, 0x07, 0x00, 0x07, 0x00, 0x07, 0x00, 0x07, 0x00, 0x07, 0x00, 0xa1,
+	0xc9, 0x3e, 0x10, 0x30, 0x22, 0x30, 0x10, 0x22, 0x10, 0x22, 0x10, 0x22, 0x10, 0x30, 0x10, 0x30,
+	0x22, 0x08, 0x22, 0x1a, 0x22, 0x1a, 0x02, 0x1a, 0xc0, 0x2c, 0x02, 0x2c, 0xe0, 0x2c, 0x02, 0x1a,
+	0x02, 0x1a, 0x30, 0x1a, 0x3e, 0x00, 0x07, 0x00, 0x07, 0x00, 0x07, 0x00, 0x07, 0x00, 0x07, 0x00,
+	0x07, 0x00, 0x07, 0x00, 0x07, 0x00, 0x07, 0x00, 0x07, 0x00, 0xfe, 0x86, 0x70, 0x30, 0x22, 0x1a,
+	0x02, 0x1a, 0x02, 0xe0, 0x02, 0x1a, 0xc1, 0x02, 0x1a, 0x22, 0x1a, 0x22, 0x30, 0x22, 0x30, 0x10,
+	0x22, 0x10, 0xc0, 0x6b, 0xe2, 0x25, 0xe0, 0x25, 0xe0, 0x25, 0xe0, 0x3e, 0xe0, 0x25, 0x10, 0x33,
+	0x00, 0x07, 0x00, 0x07, 0x00, 0x07, 0x00, 0x07, 0x00, 0x07, 0x00, 0x07, 0xe0, 0x07, 0x00, 0x31,
+	0xfe, 0x85, 0x70, 0x22, 0x3e, 0x33, 0x2a, 0x07, 0x00, 0x07, 0x00, 0x07, 0x00, 0x07, 0xe0, 0xfe,
+	0x92, 0x94, 0xe1, 0x1f, 0x35, 0x2d, 0xc0, 0x55, 0xe0, 0x34, 0xc0, 0x03, 0xe0, 0x03, 0xc0, 0x59,
+	0xe0, 0x03, 0x34, 0xc0, 0x3c, 0x26, 0xe0, 0xc0, 0x35, 0x1f, 0x7f, 0x35, 0xe0, 0xc0, 0x18, 0xd2,
+	0xc7, 0x00, 0xcd, 0x26, 0xc2, 0x1f, 0xc0, 0x3c, 0xc0, 0x34, 0xc0, 0x2d, 0x03, 0x3b, 0xc2, 0x55,
+	0x3b, 0x34, 0x3b, 0x34, 0x3b, 0xc2, 0x2d, 0xc0, 0x7f, 0xc0, 0x6e, 0x34, 0x3c, 0x26, 0x7f, 0x00,
+	0x19, 0x00, 0x31, 0x00, 0x19, 0x00, 0x31, 0x00, 0x19, 0x00, 0x31, 0x00, 0x31, 0xe0, 0x31, 0x00,
+	0xc9, 0x31, 0x00, 0x31, 0x00, 0x06, 0x1e, 0x1a, 0xc0, 0xe0, 0x08, 0x22, 0x08, 0xe0, 0x08, 0x7f,
+	0x08, 0xe0, 0x08, 0x22, 0x1a, 0xe0, 0x1a, 0x02, 0x1a, 0xc0, 0x2c, 0xe0, 0x56, 0x2c, 0x3b, 0xe0,
+	0x55, 0xe0, 0x65, 0xe0, 0x13, 0x2c, 0x3b, 0x2c, 0x3b, 0xe0, 0xc0, 0x2c, 0x00, 0x31, 0x00, 0x19,
+	0x00, 0x31, 0x00, 0x19, 0x00, 0x31, 0x00, 0x19, 0x00, 0x31, 0x00, 0x19, 0x00, 0x31, 0x00, 0xa1,
+	0xda, 0x1e, 0x1a, 0x2c, 0xe0, 0x3b, 0x2c, 0x3b, 0x2c, 0x13, 0x2c, 0x3b, 0x2c, 0x3b, 0xe0, 0x2c,
+	0xe0, 0xc2, 0x22, 0x08, 0xe0, 0x30, 0xe0, 0x30, 0xe0, 0x1e, 0xe0, 0xc9, 0x1e, 0x05, 0x00, 0x31,
+	0x00, 0x19, 0x00, 0x31, 0x00, 0x31, 0x00, 0x31, 0x00, 0x31, 0x00, 0x31, 0x00, 0xc3, 0x2e, 0x00,
+	0x31, 0x00, 0x19, 0x00, 0x31, 0x00, 0x19, 0x00, 0x34, 0x2d, 0xc0, 0x55, 0x3c, 0x34, 0xc0, 0x55,
+	0xc0, 0x66, 0xc0, 0x55, 0x7b, 0x34, 0x0a, 0x34, 0x3b, 0xc0, 0x2d, 0xc0, 0x7f, 0xc0, 0x3c, 0x26,
+	0x7f, 0xc0, 0xe0, 0x1f, 0xe0, 0xc0, 0xe0, 0x66, 0xf0, 0xf2, 0x00, 0xce, 0xe1, 0x1f, 0xc0, 0x3c,
+	0xc0, 0x34, 0xc0, 0x3b, 0xc0, 0x55, 0x0a, 0x55, 0xc0, 0x66, 0x02, 0x11, 0x02, 0x11, 0x02, 0xc2,
+	0x0a, 0x34, 0x3b, 0xc0, 0x6e, 0xc0, 0xe0, 0xc0, 0x3c, 0x99, 0x88, 0xe0, 0xc0, 0x07, 0x00, 0x07,
+	0x00, 0x07, 0x00, 0x07, 0x00, 0x07, 0x00, 0x07, 0x00, 0x19, 0x00, 0x07, 0xe0, 0x19, 0xe0, 0x07,
+	0xe0, 0x19, 0xe0, 0x07, 0xe0, 0x19, 0x00, 0x07, 0x00, 0x2a, 0x30, 0x1a, 0xc0, 0x6b, 0x1a, 0x22,
+	0x1a, 0x22, 0x08, 0x22, 0x30, 0x22, 0x08, 0x22, 0x08, 0x22, 0x1a, 0xa9, 0x57, 0xb2, 0x06, 0xab,
+	0x68, 0xa6, 0x67, 0xa5, 0x89, 0xa3, 0x78, 0x35, 0x6e, 0x18, 0x26, 0x35, 0x50, 0x9c, 0xa9, 0x98,
+	0x98, 0x97, 0xb9, 0x8c, 0xe9, 0x2c, 0x56, 0x2c, 0x66, 0xe0, 0xc0, 0xfe, 0x64, 0x48, 0x9d, 0x16,
+	0x07, 0x00, 0x07, 0x00, 0x07, 0x00, 0x07, 0x00, 0x07, 0x00, 0x07, 0x00, 0x07, 0x00, 0x07, 0x00,
+	0x15, 0x08, 0xfe, 0x6f, 0xc3, 0xb2, 0x27, 0x26, 0x3c, 0x18, 0xc1, 0x9d, 0xa9, 0x9c, 0x98, 0x98,
+	0x98, 0x92, 0xc9, 0xfe, 0xe8, 0xa0, 0x2c, 0x3b, 0xe0, 0xc0, 0xe1, 0x7b, 0x59, 0x7f, 0x08, 0x10,
+	0x22, 0x10, 0xc4, 0x7b, 0xe2, 0x25, 0xe2, 0xc1, 0xa1, 0xb9, 0x00, 0x07, 0x00, 0x07, 0x00, 0x07,
+	0x00, 0x07, 0x00, 0x07, 0x00, 0x07, 0x00, 0x07, 0xe0, 0x07, 0xe0, 0x07, 0x00, 0x07, 0x00, 0x07,
+	0x00, 0x07, 0x00, 0x07, 0x00, 0x31, 0xfe, 0x31, 0x8c, 0xe0, 0x3c, 0xc0, 0x55, 0xc0, 0xa2, 0x88,
+	0xa2, 0x88, 0xc0, 0x18, 0xc1, 0x26, 0xc0, 0x9d, 0x88, 0x9d, 0x99, 0x9d, 0x99, 0x6e, 0xc0, 0x0a,
+	0x3b, 0x03, 0xc0, 0x34, 0x26, 0xe0, 0xc0, 0x35, 0xc0, 0xe0, 0xc0, 0x18, 0xd0, 0xb8, 0x00, 0xcb,
+	0x66, 0xe0, 0x26, 0xc0, 0x55, 0x2d, 0x18, 0xce, 0x26, 0x35, 0x40, 0x03, 0x40, 0x11, 0x59, 0x02,
+	0xc0, 0x0a, 0x34, 0xa2, 0x88, 0xc0, 0x00, 0xc0, 0x31, 0x00, 0x19, 0x00, 0x31, 0x00, 0xb6, 0x88,
+	0x18, 0xcc, 0x66, 0x51, 0x9d, 0x88, 0x11, 0x9a, 0x77, 0x3a, 0x2b, 0x31, 0x08, 0x2c, 0x55, 0x2c,
+	0x66, 0xe0, 0x2c, 0xe0, 0xc0, 0x30, 0x1a, 0xe0, 0x1a, 0x30, 0xa9, 0x45, 0xb6, 0x06, 0xab, 0x59,
+	0xaa, 0x57, 0x18, 0xce, 0x95, 0xb9, 0x8d, 0xd9, 0xfe, 0xa7, 0xa0, 0x0d, 0x25, 0x2c, 0x1e, 0xfe,
+	0x21, 0x20, 0x00, 0x31, 0x00, 0x19, 0x00, 0x31, 0x00, 0x19, 0x00, 0x31, 0x00, 0x19, 0x00, 0x31,
+	0x00, 0x31, 0xbc, 0xa8, 0xba, 0x89, 0x18, 0xc9, 0x3c, 0x8d, 0xd8, 0x0d, 0x25, 0xe0, 0x13, 0x2c,
+	0xc0, 0xe0, 0xc0, 0x30, 0x08, 0xe0, 0x30, 0xe0, 0x30, 0xe0, 0x1e, 0xe0, 0xc3, 0x1e, 0xe0, 0x1e,
+	0xe0, 0x08, 0x6f, 0x30, 0x7e, 0x00, 0x24, 0x26, 0x18, 0xc6, 0x93, 0x99, 0x00, 0xc1, 0x31, 0x00,
+	0x31, 0x00, 0x6f, 0x00, 0x31, 0x00, 0x19, 0x00, 0x31, 0x00, 0xc0, 0x09, 0xa6, 0x88, 0xc0, 0x26,
+	0x18, 0xc9, 0x26, 0x9a, 0x88, 0x09, 0x6e, 0x02, 0xc0, 0xa2, 0x88, 0xc0, 0x34, 0xc0, 0xe0, 0xc0,
+	0xe0, 0x1f, 0xe0, 0xc0, 0xe0, 0x26, 0xee, 0x97, 0x00, 0xcc, 0x26, 0xc0, 0x35, 0xc0, 0x3c, 0xef,
+	0xc5, 0x3c, 0x9a, 0x88, 0x09, 0x6e, 0x02, 0x10, 0x00, 0xc0, 0x07, 0x00, 0x07, 0x00, 0x07, 0x00,
+	0x07, 0xee, 0xc6, 0x9b, 0xa9, 0x92, 0xb9, 0xfe, 0x6b, 0xaa, 0x93, 0xec, 0x25, 0x2c, 0x66, 0xe0,
+	0xc0, 0x7b, 0x1a, 0x02, 0x1a, 0x7f, 0x1a, 0xfe, 0x59, 0xe6, 0x18, 0xd3, 0x96, 0xb9, 0xfe, 0x8c,
+	0xa2, 0x0d, 0x25, 0x2c, 0x45, 0xe0, 0xc0, 0x07, 0x00, 0x07, 0x00, 0x07, 0x00, 0x07, 0x00, 0x07,
+	0x00, 0x07, 0x00, 0x07, 0xfe, 0xd7, 0xbd, 0x18, 0xcd, 0x38, 0xfe, 0x6c, 0xaa, 0x37, 0x3e, 0x0d,
+	0xe0, 0xc0, 0x02, 0x69, 0x22, 0x08, 0x7f, 0x22, 0x10, 0xc4, 0x7b, 0xe0, 0xc4, 0x30, 0x22, 0x30,
+	0x9e, 0x26, 0xfe, 0xfb, 0xde, 0x18, 0xe8, 0x19, 0xe0, 0x07, 0x00, 0x07, 0x00, 0x07, 0x00, 0x07,
+	0x00, 0x07, 0x00, 0x07, 0x00, 0x07, 0xe0, 0xc0, 0xfe, 0xba, 0xd6, 0x18, 0xcd, 0x9d, 0x99, 0x09,
+	0x66, 0xa2, 0x88, 0x6e, 0x0a, 0x6e, 0xe0, 0xc0, 0xe0, 0xc0, 0x35, 0xc0, 0xe0, 0xc0, 0x6e, 0xce,
+	0x94, 0x00, 0xcb, 0x26, 0xc0, 0x1f, 0xc0, 0x3c, 0xf6, 0xc1, 0x9b, 0x99, 0x99, 0x99, 0x8e, 0x77,
+	0x00, 0xc2, 0x31, 0x00, 0x31, 0x00, 0x31, 0x00, 0xf5, 0xc1, 0x26, 0x8f, 0xc9, 0xfe, 0x08, 0xa1,
+	0x9d, 0x99, 0x7a, 0xc0, 0xe0, 0x13, 0x2c, 0xc0, 0xe0, 0x2c, 0xe0, 0xfe, 0x39, 0xe6, 0xf4, 0xc0,
+	0x35, 0x85, 0xd9, 0x37, 0xc0, 0x1a, 0xfe, 0x22, 0x28, 0xe0, 0xc0, 0x31, 0x00, 0x19, 0x00, 0x31,
+	0x00, 0x19, 0x00, 0x31, 0x00, 0xa4, 0x88, 0xfe, 0x79, 0xce, 0xac, 0x88, 0xcf, 0x9c, 0x98, 0xfe,
+	0xed, 0xaa, 0x37, 0x25, 0xc0, 0xe0, 0x66, 0xe0, 0xc0, 0x30, 0x08, 0xe0, 0x30, 0xe0, 0x30, 0xe0,
+	0x66, 0xe0, 0x1e, 0xe0, 0x1e, 0xe0, 0x08, 0x6f, 0x08, 0x22, 0x1a, 0xc0, 0xfe, 0x15, 0xd5, 0x18,
+	0xe9, 0x00, 0xc3, 0x6e, 0x00, 0x31, 0x00, 0x19, 0x00, 0x31, 0x00, 0x19, 0x00, 0xa4, 0x88, 0xfe,
+	0x7a, 0xd6, 0xac, 0x77, 0xcf, 0x1f, 0x02, 0x66, 0x09, 0x6e, 0xa2, 0x88, 0x0a, 0x03, 0x6e, 0x3c,
+	0x2d, 0xe0, 0x1f, 0xe0, 0xc0, 0xee, 0x84, 0x00, 0xcc, 0xe0, 0x35, 0x2d, 0xc0, 0x34, 0xf7, 0xc0,
+	0x9c, 0x88, 0xfe, 0x6a, 0x52, 0xe0, 0x19, 0xe0, 0x07, 0x00, 0x19, 0x00, 0x07, 0x00, 0x07, 0xf7,
+	0xc1, 0x99, 0xa9, 0xfe, 0x4b, 0xa2, 0x37, 0x0d, 0x25, 0x2c, 0x66, 0xe0, 0xc0, 0x1a, 0x2c, 0xfe,
+	0x59, 0xe6, 0xf5, 0xc1, 0x83, 0xfa, 0xe0, 0xc0, 0x5a, 0xe0, 0x19, 0x00, 0x07, 0x00, 0x07, 0x00,
+	0x07, 0x00, 0x07, 0x00, 0x07, 0xfe, 0x38, 0xc6, 0x18, 0xd1, 0x9b, 0xa9, 0xfe, 0x0a, 0x9a, 0x37,
+	0x0d, 0x25, 0x2c, 0xc0, 0x7b, 0x69, 0x7f, 0x65, 0x7f, 0x22, 0x10, 0xc7, 0x30, 0x22, 0x1a, 0x02,
+	0xae, 0x14, 0xfe, 0xdf, 0xff, 0xea, 0x07, 0xe0, 0x19, 0xe0, 0x07, 0x00, 0x07, 0x00, 0x07, 0x00,
+	0x07, 0x00, 0x07, 0x00, 0x07, 0xfe, 0x18, 0xc6, 0x18, 0xd1, 0x1f, 0x94, 0x99, 0xc0, 0xa2, 0x88,
+	0x6e, 0xe0, 0x6e, 0xe0, 0xc0, 0xe0, 0xc0, 0x35, 0xe0, 0x6e, 0x26, 0xed, 0x7e, 0x00, 0xc9, 0x26,
+	0xe0, 0x26, 0xc0, 0x2d, 0xc0, 0x34, 0x03, 0xf8, 0xc0, 0x9a, 0x88, 0xfe, 0xe7, 0x39, 0x91, 0x99,
+	0xc7, 0xf9, 0xc0, 0x03, 0xfe, 0xc9, 0x99, 0x96, 0xca, 0x37, 0xc0, 0x0d, 0x25, 0xe0, 0x13, 0xe0,
+	0xfe, 0x38, 0xde, 0xf7, 0x26, 0xfe, 0xed, 0xa2, 0xe0, 0xa0, 0xa8, 0xfe, 0x00, 0x10, 0x00, 0xc1,
+	0x6e, 0x00, 0x31, 0x00, 0x31, 0x00, 0x31, 0xfe, 0xb2, 0x94, 0x18, 0xd3, 0x94, 0xa9, 0xfe, 0x87,
+	0x90, 0x30, 0x37, 0x25, 0xe0, 0x66, 0xe0, 0xc0, 0x7b, 0x08, 0xe0, 0x30, 0xe0, 0x30, 0xe0, 0x30,
+	0xe0, 0x08, 0x22, 0x08, 0x22, 0x1a, 0xc0, 0x2c, 0xfe, 0x9a, 0xee, 0x18, 0xea, 0x00, 0xc7, 0x31,
+	0x00, 0x31, 0x00, 0x31, 0xfe, 0x92, 0x94, 0x18, 0xd3, 0x2d, 0x96, 0x88, 0x7f, 0xa3, 0x99, 0x09,
+	0xa2, 0x88, 0x7f, 0x03, 0x34, 0xe0, 0xc0, 0x35, 0x59, 0xe0, 0xc0, 0xec, 0x85, 0x00, 0xca, 0x26,
+	0xc0, 0x1f, 0x35, 0x3c, 0xe0, 0x51, 0xf9, 0xc0, 0x8f, 0x99, 0x07, 0xe0, 0x19, 0xe0, 0x07, 0xe0,
+	0x19, 0xe1, 0xb5, 0x99, 0xf9, 0xc0, 0x93, 0xb9, 0xfe, 0xa7, 0x90, 0x65, 0xe0, 0xc0, 0x3e, 0x25,
+	0x7f, 0x25, 0xfe, 0x39, 0xe6, 0xf7, 0xc0, 0x97, 0xba, 0xfe, 0x86, 0x88, 0x37, 0x9d, 0x06, 0x19,
+	0xe0, 0x19, 0x00, 0x07, 0x00, 0x07, 0x00, 0x07, 0xab, 0x88, 0xfe, 0x9e, 0xf7, 0xf4, 0xc0, 0x82,
+	0xd9, 0x09, 0xc0, 0x0d, 0x25, 0x2c, 0xc0, 0x7b, 0x1a, 0x22, 0x66, 0x7e, 0x22, 0x10, 0x22, 0x10,
+	0xc1, 0x30, 0x22, 0x08, 0x22, 0xe0, 0xfe, 0x73, 0xcc, 0xbc, 0x06, 0xeb, 0x31, 0xe0, 0x07, 0xe0,
+	0x19, 0xe0, 0xfe, 0x64, 0x48, 0xfe, 0x86, 0x88, 0x09, 0xe1, 0xc0, 0x07, 0x15, 0x35, 0xf4, 0xc0,
+	0x93, 0x99, 0x9d, 0x99, 0x17, 0xa3, 0x99, 0xa2, 0x77, 0xe0, 0x6e, 0xe0, 0x6e, 0xe0, 0x1f, 0x7f,
+	0xc0, 0x6e, 0xcc, 0x76, 0x00, 0xc9, 0x26, 0xc0, 0x1f, 0x35, 0x2d, 0x55, 0x51, 0xfb, 0x66, 0xfe,
+	0x8a, 0x52, 0xe0, 0xc4, 0x19, 0x25, 0xb1, 0x26, 0xfa, 0xc0, 0xfe, 0xaf, 0xa3, 0xe0, 0xc0, 0xe0,
+	0xc0, 0xe0, 0x37, 0xe0, 0xfe, 0x38, 0xde, 0xf8, 0xc0, 0xfe, 0xd0, 0xa3, 0x02, 0x5a, 0x00, 0xc3,
+	0x31, 0x00, 0xc1, 0xfe, 0xb6, 0xb5, 0x18, 0xd5, 0x03, 0x14, 0xa0, 0xa9, 0x69, 0x37, 0x25, 0xe0,
+	0x66, 0xe0, 0xc0, 0x22, 0x08, 0xe0, 0x66, 0x7e, 0x08, 0x22, 0x08, 0x22, 0x1a, 0xc1, 0xa7, 0x57,
+	0xfe, 0x7d, 0xf7, 0xec, 0x00, 0xc3, 0xfe, 0xa7, 0x88, 0x1a, 0xc1, 0x22, 0xfe, 0x64, 0x60, 0xe0,
+	0xc0, 0xfe, 0xb7, 0xbd, 0x18, 0xd5, 0x9d, 0x99, 0x90, 0x88, 0xa3, 0x88, 0xa2, 0x88, 0xa2, 0x99,
+	0xa2, 0x77, 0x0a, 0x6e, 0x34, 0x6e, 0x2d, 0x1f, 0xe0, 0xc0, 0xec, 0xa9, 0x00, 0xca, 0xe0, 0xc0,
+	0x1f, 0xe0, 0x34, 0x03, 0x40, 0xfa, 0xc0, 0x25, 0xe0, 0x07, 0xe0, 0x19, 0xe0, 0xfe, 0x86, 0x78,
+	0x2c, 0xe0, 0xb1, 0x15, 0xfb, 0x95, 0xba, 0xfe, 0x86, 0x80, 0x7b, 0x79, 0xe0, 0xc0, 0x7a, 0x37,
+	0xfe, 0x39, 0xe6, 0xe3, 0x99, 0xa9, 0x9a, 0x98, 0x99, 0x98, 0x99, 0xaa, 0x96, 0xa8, 0x9b, 0x98,
+	0x97, 0xba, 0x6e, 0xaa, 0x57, 0xae, 0x58, 0xae, 0x67, 0xea, 0x92, 0xa8, 0xe0, 0x37, 0xfe, 0x21,
+	0x10, 0xe0, 0x07, 0xe0, 0x19, 0x00, 0x07, 0xe0, 0xa8, 0x88, 0x2d, 0xe8, 0x95, 0xa9, 0x8b, 0xa9,
+	0x90, 0xb8, 0xab, 0x79, 0xb3, 0x68, 0xb1, 0x78, 0xe7, 0xc0, 0x0f, 0x02, 0x7f, 0xe0, 0x7b, 0xc0,
+	0x7e, 0xe0, 0x22, 0x08, 0x22, 0x66, 0x7e, 0x30, 0x10, 0x30, 0x22, 0x30, 0x22, 0xe1, 0xfe, 0xf8,
+	0xdd, 0xb0, 0x47, 0xec, 0x07, 0xe0, 0x31, 0xe0, 0x38, 0x2c, 0xc0, 0x66, 0xe0, 0x2c, 0xa0, 0xa9,
+	0x2c, 0x23, 0x2d, 0xe8, 0x95, 0x99, 0x95, 0x99, 0x97, 0x88, 0xa5, 0x99, 0xac, 0x77, 0xe8, 0xc0,
+	0x91, 0x99, 0x9c, 0x88, 0xa3, 0x99, 0xa2, 0x88, 0xa3, 0x88, 0xa2, 0x88, 0xe0, 0x7f, 0xa2, 0x88,
+	0xe0, 0x7f, 0xc0, 0xe0, 0xc0, 0xeb, 0xc7, 0x00, 0xc9, 0x66, 0xc0, 0x55, 0xc0, 0x51, 0xe0, 0x51,
+	0xe8, 0x66, 0xfe, 0x2d, 0x6b, 0x40, 0x7b, 0xc0, 0xa3, 0x88, 0xa3, 0x88, 0xa8, 0x88, 0xa8, 0x99,
+	0xad, 0x88, 0xe9, 0x96, 0x99, 0xe0, 0xc1, 0x2e, 0xfe, 0xa7, 0xa0, 0x5a, 0xc0, 0x66, 0xb2, 0x15,
+	0xe7, 0x9c, 0x88, 0x00, 0xc1, 0xa3, 0x88, 0xac, 0x88, 0xa6, 0x88, 0xac, 0x99, 0xaa, 0x87, 0x3b,
+	0xe9, 0x66, 0xfe, 0x88, 0x81, 0x97, 0xdb, 0x7e, 0xc0, 0xe0, 0x05, 0xe0, 0xfe, 0xf8, 0xd5, 0xa8,
+	0x78, 0x95, 0xb9, 0x92, 0xb8, 0x8a, 0xfa, 0x9d, 0xaa, 0x55, 0xc0, 0x55, 0x14, 0x55, 0xc0, 0x5a,
+	0xc0, 0x55, 0x6f, 0xb7, 0x15, 0x34, 0xe8, 0x9b, 0xa9, 0x0c, 0x09, 0xfe, 0x01, 0x30, 0xe0, 0xc5,
+	0xfe, 0x92, 0x94, 0x18, 0xc7, 0x1b, 0xfe, 0x44, 0x58, 0x55, 0x3b, 0x34, 0x6e, 0xbc, 0x16, 0xfe,
+	0xdf, 0xff, 0xe7, 0x94, 0xa8, 0x14, 0x02, 0x09, 0x76, 0x25, 0xc0, 0xe0, 0xc0, 0xe0, 0x1a, 0x7f,
+	0x08, 0x22, 0x08, 0x22, 0x1a, 0xe0, 0x1a, 0xc0, 0xfe, 0x8f, 0xbb, 0x18, 0xed, 0xfe, 0x00, 0x00,
+	0xc2, 0x05, 0x37, 0x25, 0x2c, 0x65, 0xe0, 0x66, 0xe0, 0xfe, 0xb3, 0xcc, 0x18, 0xc7, 0x8e, 0x88,
+	0x00, 0xa8, 0x88, 0xb4, 0x88, 0xc1, 0xaa, 0x88, 0xe8, 0x99, 0x99, 0x92, 0x88, 0x17, 0xa3, 0x99,
+	0xa2, 0x88, 0xa3, 0x88, 0x7f, 0xa3, 0x88, 0x7f, 0x3c, 0x6e, 0xe0, 0xc0, 0xe0, 0xc0, 0xea, 0xc4,
+	0x00, 0xca, 0xe0, 0xc0, 0x2d, 0xc0, 0xe1, 0x02, 0xe7, 0xc0, 0xfe, 0xcb, 0x5a, 0xc0, 0x66, 0x32,
+	0x6e, 0x7f, 0x6e, 0x7f, 0xc0, 0xb5, 0x99, 0xe8, 0x66, 0xe1, 0xa1, 0xea, 0x25, 0x45, 0xe0, 0x09,
+	0x37, 0xb1, 0x15, 0xe7, 0x3c, 0xe2, 0xc2, 0x2e, 0xfe, 0x44, 0x58, 0x55, 0xfe, 0xb3, 0xa4, 0x26,
+	0xe7, 0xc0, 0x82, 0xc9, 0xfe, 0x86, 0x80, 0xc0, 0x09, 0x30, 0x7f, 0xc0, 0x25, 0x37, 0x25, 0x37,
+	0xc0, 0x30, 0x09, 0xe0, 0xc0, 0xe0, 0xc0, 0xe0, 0x6f, 0xe0, 0x0c, 0x5a, 0x5a, 0xb2, 0x15, 0xfe,
+	0xdf, 0xff, 0xe7, 0xc0, 0xfe, 0xe6, 0x78, 0x9d, 0xca, 0x9e, 0x06, 0xe0, 0x19, 0xe0, 0x07, 0xe0,
+	0x19, 0xe0, 0xfe, 0x9a, 0xd6, 0xe7, 0x99, 0x99, 0xfe, 0x44, 0x58, 0x34, 0x3b, 0x34, 0x3b, 0x34,
+	0x3b, 0xfe, 0x76, 0xbd, 0xe7, 0x26, 0xfe, 0x47, 0x81, 0xe0, 0xc0, 0x37, 0xc0, 0xa1, 0xa9, 0xc0,
+	0xe0, 0xc0, 0x7f, 0x66, 0x22, 0x08, 0x22, 0x30, 0x22, 0x1a, 0x6b, 0x5d, 0xfe, 0x3d, 0xf7, 0xee,
+	0xfe, 0x20, 0x00, 0xe0, 0x07, 0xa0, 0xd9, 0x0d, 0xe0, 0x3e, 0x25, 0x2c, 0x66, 0x2c, 0x0d, 0xfe,
+	0xbb, 0xee, 0xe7, 0x99, 0x99, 0x27, 0xe0, 0xc0, 0xaf, 0x88, 0xe0, 0x66, 0x6e, 0xb3, 0x88, 0xe7,
+	0xc0, 0x8a, 0x88, 0xa3, 0x99, 0xa2, 0x88, 0xa3, 0x99, 0xa2, 0x88, 0xe0, 0x3b, 0xe0, 0x6e, 0xe0,
+	0x6e, 0x7f, 0xc0, 0x6e, 0xca, 0xbd, 0x00, 0xc9, 0x26, 0xc0, 0x1f, 0xe0, 0x55, 0xe0, 0x9d, 0x99,
+	0xe8, 0x66, 0x01, 0x55, 0xe0, 0x59, 0xa2, 0x99, 0xe0, 0x7f, 0xe1, 0xc0, 0x09, 0xe7, 0xc0, 0xfe,
+	0x28, 0x42, 0xfe, 0x23, 0x48, 0xfe, 0x87, 0x90, 0x49, 0xe0, 0xc0, 0xe0, 0x65, 0xe8, 0x9b, 0x99,
+	0xe5, 0xa1, 0xd9, 0xa0, 0xda, 0x7f, 0x34, 0xfe, 0x35, 0xb5, 0xe8, 0x8d, 0xba, 0xfe, 0x65, 0x70,
+	0xe0, 0x7a, 0x17, 0x30, 0xe0, 0x05, 0xe0, 0xc1, 0x05, 0x37, 0x30, 0x17, 0xe0, 0xc0, 0xe0, 0xc0,
+	0x65, 0x14, 0xe0, 0xc0, 0x56, 0x5e, 0xfe, 0x96, 0xbd, 0xe8, 0xfe, 0x8b, 0x82, 0x14, 0x3b, 0xe0,
+	0xc4, 0xa4, 0x88, 0x1f, 0xe7, 0x83, 0xb9, 0x34, 0x6e, 0x34, 0x26, 0x34, 0x3b, 0x34, 0xab, 0x57,
+	0xfe, 0x9e, 0xf7, 0xe6, 0xc0, 0x83, 0xda, 0x0c, 0xe0, 0x7a, 0xe0, 0xc0, 0xe0, 0x66, 0xe0, 0xc0,
+	0xe0, 0x1a, 0x7b, 0x1a, 0xe0, 0x1a, 0xc0, 0x3b, 0xfe, 0x56, 0xd5, 0x18, 0xc4, 0x97, 0xa9, 0xe8,
+	0xfe, 0x00, 0x00, 0xc1, 0xfe, 0x64, 0x60, 0xa1, 0xea, 0xe0, 0xc0, 0x0d, 0x69, 0x7f, 0x25, 0xa2,
+	0x78, 0xfe, 0xbe, 0xff, 0xe7, 0x83, 0x99, 0x00, 0xc2, 0xb7, 0x88, 0x1d, 0xc0, 0xa2, 0x88, 0x1f,
+	0xe7, 0x10, 0x9a, 0x88, 0xa4, 0x88, 0x10, 0xa3, 0x99, 0x09, 0x0a, 0x6e, 0xa2, 0x88, 0x6e, 0xe0,
+	0xc0, 0xe0, 0xc0, 0xea, 0xc0, 0x00, 0xca, 0xe0, 0x66, 0xe0, 0x3c, 0x03, 0x3b, 0x9d, 0x99, 0xe7,
+	0xc0, 0xfe, 0x8a, 0x52, 0x01, 0x2b, 0xa2, 0x99, 0x6e, 0xa2, 0x88, 0xc0, 0x1d, 0x66, 0x97, 0x88,
+	0xb1, 0x88, 0xe8, 0xfe, 0x2d, 0x7b, 0x14, 0x0c, 0x02, 0xc0, 0x7f, 0x65, 0x09, 0xb1, 0x15, 0xe7,
+	0x3c, 0xe5, 0xfe, 0x43, 0x58, 0x6b, 0xc1, 0xa4, 0x67, 0xfe, 0xdf, 0xff, 0xe7, 0x93, 0xa9, 0x0c,
+	0xc0, 0xe0, 0xc0, 0x09, 0xe0, 0x7a, 0xe0, 0x25, 0xe0, 0x7b, 0xe0, 0xc0, 0x09, 0x37, 0x30, 0x09,
+	0x02, 0x6b, 0xe0, 0xc0, 0xe0, 0x6f, 0x1e, 0xb7, 0x15, 0xe8, 0xfe, 0xed, 0x8a, 0x0c, 0x4a, 0xe0,
+	0x7f, 0xe0, 0x19, 0xe0, 0x07, 0xbc, 0x77, 0x18, 0xc6, 0x9d, 0xa9, 0xfe, 0x23, 0x50, 0x3b, 0x34,
+	0x3b, 0x34, 0x3b, 0x14, 0x3b, 0x14, 0xfe, 0x39, 0xd6, 0xe7, 0x90, 0xa9, 0x26, 0x7a, 0x09, 0xc0,
+	0xa0, 0xa9, 0x25, 0x1a, 0xc0, 0x6b, 0x1a, 0x22, 0x65, 0x22, 0x1a, 0x02, 0x59, 0xb0, 0x25, 0xfe,
+	0xdf, 0xff, 0xe4, 0x26, 0xfe, 0x0d, 0x8b, 0xe8, 0x27, 0xe1, 0x0c, 0x09, 0xc0, 0x25, 0xc0, 0x2c,
+	0x25, 0x2c, 0xfe, 0xb0, 0xb3, 0x18, 0xc6, 0x2d, 0xfe, 0x00, 0x00, 0xc3, 0xa6, 0x88, 0x0f, 0x16,
+	0x66, 0xb7, 0x88, 0xe7, 0x09, 0x94, 0x88, 0xa3, 0x99, 0xe0, 0xa2, 0x88, 0xe0, 0xa2, 0x88, 0xe1,
+	0x2d, 0xc0, 0x26, 0xc0, 0x18, 0xca, 0xb4, 0x00, 0xc9, 0x26, 0xc0, 0x1f, 0xe0, 0x55, 0xe0, 0x40,
+	0xe8, 0x66, 0xe0, 0xc0, 0x32, 0x6e, 0xa2, 0x99, 0xa2, 0x77, 0x1d, 0xc1, 0x00, 0xb4, 0x88, 0xe8,
+	0x81, 0xd9, 0xfe, 0x44, 0x68, 0xe0, 0x7a, 0xe0, 0xc0, 0xe0, 0x5a, 0xb2, 0x26, 0xe7, 0x9b, 0x99,
+	0xe4, 0xa0, 0xb8, 0x17, 0x49, 0x7b, 0xe0, 0xc0, 0xfe, 0xdb, 0xde, 0xe7, 0x11, 0x17, 0xe0, 0x3a,
+	0xe0, 0x7a, 0xe0, 0xc0, 0x7a, 0x37, 0x25, 0x37, 0x25, 0xe0, 0xc0, 0x05, 0x37, 0x30, 0x6f, 0x55,
+	0xc2, 0x0c, 0xc0, 0xa2, 0x67, 0xe8, 0xfe, 0xa7, 0x71, 0xe0, 0x29, 0xe0, 0xc4, 0xfe, 0x75, 0xad,
+	0xe7, 0x94, 0x98, 0xfe, 0x43, 0x50, 0x66, 0x26, 0x34, 0x3b, 0x65, 0x29, 0xe0, 0x29, 0xfe, 0x72,
+	0xa4, 0xe7, 0x99, 0x99, 0xfe, 0x65, 0x70, 0xe0, 0xc0, 0xe0, 0x37, 0x0d, 0x25, 0x7f, 0x1a, 0x6b,
+	0x1a, 0xc2, 0x2c, 0xc0, 0xfe, 0xba, 0xe6, 0x18, 0xc4, 0x8d, 0xb9, 0x29, 0xe8, 0x00, 0xc1, 0xfe,
+	0x86, 0x90, 0x5a, 0xe0, 0x37, 0xe0, 0xc2, 0xfe, 0x76, 0xd5, 0xe7, 0x94, 0x88, 0xe4, 0xc0, 0xb2,
+	0x88, 0xad, 0x88, 0x7b, 0xac, 0x77, 0xe7, 0x9b, 0x99, 0x8c, 0x88, 0xa4, 0x88, 0xa3, 0x88, 0xa3,
+	0x99, 0x10, 0x11, 0xa2, 0x77, 0x03, 0x6e, 0xe0, 0x6e, 0xe0, 0xc0, 0xea, 0xbf, 0x00, 0xca, 0xe0,
+	0x35, 0xe0, 0x3c, 0xe0, 0x3b, 0x9d, 0x88, 0xe7, 0xc0, 0xe0, 0x7f, 0xe0, 0x33, 0x6e, 0x0f, 0x7b,
+	0xa2, 0x88, 0x23, 0x99, 0x88, 0xa9, 0x99, 0xe8, 0xfe, 0xcf, 0x93, 0xfe, 0x65, 0x70, 0xe0, 0x7f,
+	0xc0, 0xe0, 0xc0, 0x09, 0xb1, 0x15, 0xe7, 0x3c, 0xe4, 0xfe, 0x23, 0x40, 0x29, 0xc1, 0x7b, 0x29,
+	0xfe, 0x7a, 0xde, 0xe7, 0x98, 0x98, 0x1e, 0xe0, 0x14, 0xe0, 0x09, 0xe0, 0x7a, 0xc0, 0x6f, 0xe0,
+	0x3e, 0xe0, 0x3e, 0x25, 0x0d, 0xe0, 0x0d, 0x37, 0xc0, 0x56, 0x09, 0xe0, 0xc0, 0x55, 0xa6, 0x57,
+	0xe7, 0x66, 0xfe, 0x65, 0x68, 0x1e, 0xc0, 0xe0, 0x31, 0xe0, 0x7f, 0xe0, 0x19, 0x10, 0xe7, 0x8b,
+	0xa9, 0xfe, 0x23, 0x50, 0x6f, 0x34, 0x7f, 0xc0, 0x29, 0xc0, 0x30, 0xe0, 0xb0, 0x36, 0xe7, 0x61,
+	0xe0, 0x0c, 0xa1, 0xa9, 0xc0, 0xe0, 0x25, 0x7f, 0xc0, 0x7b, 0x69, 0x02, 0xe0, 0x02, 0xe0, 0xc0,
+	0xfe, 0x93, 0xc4, 0xbb, 0x27, 0xc4, 0x9b, 0xa9, 0xfe, 0xc5, 0x68, 0xeb, 0x19, 0xe0, 0x5b, 0x79,
+	0xe0, 0xc0, 0x3e, 0xe0, 0x6b, 0xfe, 0x59, 0xde, 0xe7, 0x8b, 0x99, 0xe4, 0x27, 0x69, 0xfe, 0x10,
+	0x84, 0xc0, 0xa3, 0x99, 0xe7, 0x26, 0x87, 0x99, 0xa3, 0x88, 0xa4, 0x88, 0xa3, 0x99, 0xe0, 0xa2,
+	0x88, 0xa3, 0x99, 0xa2, 0x77, 0xa2, 0x88, 0x7b, 0x35, 0xc0, 0xe0, 0xc0, 0xe9, 0xbd, 0x00, 0xc9,
+	0x66, 0xc0, 0x1f, 0xe0, 0x51, 0xe0, 0x40, 0x11, 0xe7, 0x26, 0xfe, 0xaa, 0x52, 0xc0, 0xa2, 0x99,
+	0xa2, 0x77, 0xa3, 0x99, 0xe0, 0x08, 0x51, 0x00, 0xc0, 0xb3, 0x99, 0xe8, 0xfe, 0x0d, 0x83, 0xfe,
+	0x44, 0x68, 0xe0, 0xc0, 0xe2, 0xc0, 0xe8, 0x9b, 0x99, 0xe4, 0xfe, 0x44, 0x60, 0xc1, 0x3f, 0x29,
+	0x17, 0xfe, 0x79, 0xd6, 0xe8, 0x17, 0xe0, 0xc0, 0xe0, 0xc0, 0xe0, 0xc0, 0x0d, 0x69, 0x7f, 0x25,
+	0x2c, 0x25, 0x2c, 0x25, 0x0d, 0x25, 0xc0, 0xe0, 0xc0, 0x55, 0x6f, 0xe0, 0xc0, 0xfe, 0x0d, 0x93,
+	0xe7, 0x9a, 0x98, 0x17, 0xe0, 0x29, 0xe0, 0xc4, 0xfe, 0x1c, 0xe7, 0xe7, 0x80, 0xa9, 0xfe, 0x43,
+	0x50, 0x66, 0x7f, 0x65, 0x29, 0xc0, 0x17, 0x29, 0x17, 0x29, 0x35, 0xe6, 0xc0, 0xfe, 0x6a, 0x7a,
+	0xe0, 0x7a, 0xe0, 0x30, 0x37, 0x25, 0xe0, 0x66, 0xe0, 0x2c, 0xe0, 0x2c, 0xc0, 0xa9, 0x46, 0xfe,
+	0x9e, 0xff, 0xe5, 0xfe, 0xaf, 0x93, 0x29, 0x34, 0xea, 0xa0, 0xb8, 0xfe, 0x86, 0x88, 0xc0, 0x09,
+	0x30, 0xe0, 0xc0, 0xe0, 0x37, 0xfe, 0x3c, 0xef, 0xe7, 0x80, 0x99, 0xe4, 0xc1, 0xad, 0x88, 0xb5,
+	0x99, 0x55, 0x35, 0xe6, 0xc0, 0x87, 0x99, 0xe0, 0xa2, 0x88, 0xa4, 0x88, 0xa3, 0x88, 0xe0, 0xa2,
+	0x88, 0xa2, 0x88, 0xa2, 0x88, 0xa2, 0x88, 0xc0, 0xe1, 0x18, 0x66, 0xe8, 0xb4, 0x00, 0xca, 0x35,
+	0xc0, 0xe0, 0x3c, 0x40, 0x3b, 0x9d, 0x88, 0xe7, 0xc0, 0xe0, 0x32, 0xa2, 0x88, 0x24, 0xe0, 0xa2,
+	0x88, 0x7f, 0x2a, 0xe0, 0x6b, 0x10, 0xe8, 0xfe, 0x26, 0x61, 0x9a, 0xda, 0xc0, 0xa1, 0xa9, 0xe2,
+	0x6b, 0xe8, 0x3c, 0xe3, 0x7a, 0x1e, 0x17, 0x1e, 0x17, 0x6f, 0xe0, 0xfe, 0xfc, 0xe6, 0xe7, 0x11,
+	0x30, 0x1e, 0x14, 0xe0, 0x7f, 0xe0, 0x0d, 0x25, 0x7f, 0x66, 0x2c, 0xc3, 0x3b, 0x2c, 0xe0, 0x3e,
+	0x25, 0xc0, 0xe0, 0xc0, 0xe0, 0xfe, 0x55, 0xc5, 0xe7, 0x8f, 0xa9, 0x30, 0xe0, 0x30, 0xe0, 0x7f,
+	0xe0, 0x19, 0xe0, 0x07, 0xfe, 0x9e, 0xf7, 0xe7, 0xfe, 0x8b, 0x72, 0x8d, 0xea, 0x7f, 0xc0, 0x7a,
+	0xc0, 0x30, 0xe0, 0x1e, 0xe0, 0x30, 0xfe, 0x1c, 0xef, 0xe7, 0x80, 0xc9, 0x1e, 0x14, 0xe0, 0x09,
+	0xe0, 0x3e, 0x0d, 0x2c, 0xc0, 0x1a, 0x2c, 0x1a, 0x56, 0xfe, 0x39, 0xe6, 0x18, 0xc4, 0x91, 0xa9,
+	0x30, 0xe0, 0x5a, 0xe8, 0x27, 0xe0, 0xfe, 0x22, 0x40, 0x14, 0x7b, 0x79, 0x37, 0xc0, 0x0d, 0x37,
+	0x25, 0xfe, 0x9e, 0xff, 0xe7, 0x39, 0xe2, 0x27, 0xe2, 0xc0, 0xe0, 0x10, 0xb7, 0x88, 0xe7, 0x8c,
+	0x99, 0x3a, 0xe0, 0xa3, 0x88, 0xa4, 0x99, 0xa2, 0x88, 0xe2, 0x6e, 0xa2, 0x88, 0xc0, 0xe0, 0xc0,
+	0x6e, 0xc8, 0xb5, 0x00, 0xc9, 0x66, 0xc0, 0x1f, 0xe0, 0x51, 0x03, 0x40, 0xe8, 0x26, 0x39, 0x6e,
+	0xe3, 0xc0, 0x00, 0xc1, 0xfe, 0xba, 0xd6, 0xe7, 0x99, 0x99, 0xfe, 0x44, 0x60, 0x7a, 0xe0, 0x7a,
+	0xe0, 0xc0, 0xe0, 0xc0, 0xe8, 0x9b, 0x99, 0xe3, 0xa1, 0xd9, 0x17, 0x6f, 0x17, 0x1e, 0x17, 0xa5,
+	0x68, 0xfe, 0xbe, 0xf7, 0xe7, 0x93, 0xa9, 0x17, 0xe0, 0x0c, 0xe0, 0x7a, 0xe0, 0xc0, 0x7f, 0x75,
+	0x2c, 0x66, 0x1a, 0xe0, 0x1a, 0x3b, 0x2c, 0x3b, 0x2c, 0x25, 0x0d, 0x37, 0xc0, 0x30, 0xc0, 0xfe,
+	0x3c, 0xef, 0xe7, 0x20, 0x17, 0xe0, 0x29, 0xe0, 0xc3, 0xa5, 0x88, 0x18, 0xc7, 0xfe, 0x23, 0x48,
+	0xe0, 0xc0, 0xe1, 0x17, 0xc0, 0x6f, 0x17, 0x1e, 0x17, 0x11, 0xe7, 0x87, 0xb9, 0xe0, 0x0c, 0xe0,
+	0xc0, 0xe0, 0xc0, 0xe0, 0x25, 0xe0, 0x13, 0xe0, 0x13, 0xfe, 0xd0, 0xbb, 0x18, 0xc4, 0x3c, 0xfe,
+	0xa8, 0x79, 0x29, 0xc0, 0x45, 0xe8, 0x00, 0xc0, 0xa1, 0xfa, 0xfe, 0x86, 0x88, 0x14, 0xa0, 0xa9,
+	0x69, 0xe0, 0xc1, 0xa3, 0x77, 0x18, 0xc7, 0xfe, 0x00, 0x10, 0xe2, 0xc4, 0xad, 0x88, 0xb6, 0x88,
+	0xb5, 0x99, 0xe7, 0x8f, 0x99, 0x97, 0x99, 0xa4, 0x77, 0xe0, 0xa2, 0x88, 0xa4, 0x88, 0xa2, 0x88,
+	0xe0, 0x6e, 0xe0, 0x7f, 0x35, 0x1f, 0xe0, 0xc0, 0xe8, 0xbc, 0x00, 0xca, 0x35, 0xc0, 0xe0, 0x3c,
+	0x40, 0x0a, 0xe8, 0xc0, 0xe0, 0x7f, 0xa2, 0x77, 0xe0, 0x7f, 0xe0, 0x8c, 0x88, 0xe1, 0xfe, 0x96,
+	0xb5, 0x18, 0xc7, 0x8d, 0xa9, 0xe0, 0xa1, 0xa9, 0xc0, 0x14, 0xc0, 0x7a, 0xc0, 0x17, 0xe8, 0x3c,
+	0xe3, 0xa1, 0xfa, 0xa2, 0xda, 0x65, 0x1e, 0x17, 0x1e, 0xfe, 0x35, 0xbd, 0x18, 0xc7, 0x13, 0x30,
+	0xe0, 0x14, 0xe0, 0x37, 0xc0, 0x3e, 0x65, 0x1a, 0xe0, 0x1a, 0xc0, 0x6b, 0xe0, 0x02, 0x1a, 0x02,
+	0xe0, 0xc0, 0x25, 0x3e, 0xe0, 0xc0, 0xfe, 0x72, 0xb4, 0x18, 0xc6, 0x99, 0xa9, 0xfe, 0x44, 0x60,
+	0x1e, 0x7a, 0x9f, 0x48, 0xe0, 0x31, 0xe0, 0x7f, 0xe0, 0x2b, 0xe7, 0x9d, 0x99, 0xfe, 0x43, 0x50,
+	0xe0, 0x7f, 0x69, 0xe1, 0x1e, 0xe0, 0x1e, 0xc1, 0xfe, 0x59, 0xd6, 0xe7, 0x8c, 0xa9, 0xfe, 0x45,
+	0x68, 0xa2, 0x98, 0x7a, 0xa1, 0xa9, 0x66, 0x25, 0xc0, 0x7f, 0x66, 0x2c, 0x3b, 0xa4, 0x67, 0xfe,
+	0x3d, 0xf7, 0xe5, 0x84, 0xc9, 0x3f, 0x30, 0x45, 0xc0, 0xea, 0xa2, 0xfa, 0x14, 0x7a, 0x7a, 0x37,
+	0xc2, 0xb0, 0x26, 0xe7, 0x2d, 0x06, 0xe4, 0x07, 0xe0, 0x6e, 0x7f, 0xfe, 0x92, 0x94, 0xb2, 0x88,
+	0xe7, 0x92, 0x99, 0x01, 0xa5, 0x99, 0xa3, 0x88, 0xa4, 0x88, 0xa2, 0x88, 0x11, 0xa2, 0x77, 0x03,
+	0x6e, 0xe0, 0x6e, 0x7f, 0xc0, 0x18, 0xc8, 0xc8, 0x00, 0xc9, 0x26, 0xc0, 0x1f, 0xe0, 0x34, 0x03,
+	0x40, 0xe8, 0x26, 0xfe, 0x69, 0x4a, 0x7b, 0xa3, 0x88, 0xa2, 0x88, 0xe0, 0xa5, 0x88, 0x51, 0xac,
+	0x88, 0xaf, 0x88, 0x18, 0xc7, 0x26, 0xfe, 0x29, 0x6a, 0xe0, 0x7a, 0x0c, 0xc0, 0xa1, 0xa9, 0xc2,
+	0xe8, 0x9b, 0x99, 0xe3, 0xfe, 0x43, 0x50, 0xa0, 0xa9, 0xe0, 0xc0, 0x6f, 0xfe, 0x92, 0xa4, 0x18,
+	0xc8, 0x83, 0xb9, 0x17, 0x0c, 0x7a, 0xe0, 0x7a, 0xe0, 0x7a, 0x7f, 0x66, 0x7e, 0xc0, 0x6b, 0x1a,
+	0xc2, 0x2c, 0x1a, 0x3b, 0x2c, 0x25, 0xc0, 0xaa, 0x25, 0xfe, 0x9e, 0xff, 0xe7, 0x81, 0xb9, 0xfe,
+	0x64, 0x68, 0x77, 0xa1, 0xa9, 0x9e, 0x05, 0xe0, 0xc3, 0xba, 0x88, 0xe7, 0x9c, 0x98, 0xfe, 0x22,
+	0x48, 0xe0, 0xc0, 0x1d, 0x34, 0x18, 0x9d, 0x99, 0x93, 0xa9, 0xfe, 0xc5, 0x70, 0xe0, 0x17, 0x14,
+	0xe7, 0x8f, 0xa9, 0xfe, 0x65, 0x68, 0x7a, 0xe0, 0x7a, 0x7f, 0x76, 0xe0, 0xc0, 0x6b, 0x25, 0xe0,
+	0xfe, 0x96, 0xd5, 0x18, 0xc4, 0x95, 0xa9, 0x1e, 0x30, 0x29, 0xc0, 0x45, 0xea, 0xa1, 0xfa, 0xe0,
+	0xc0, 0xa0, 0xa9, 0x69, 0xe0, 0x05, 0xe0, 0xfe, 0x6e, 0xab, 0xe7, 0x9c, 0x88, 0x34, 0x9f, 0x27,
+	0xe0, 0x01, 0x03, 0x18, 0x2d, 0x93, 0x88, 0x23, 0x00, 0x32, 0xbe, 0x88, 0xe7, 0x93, 0x99, 0xe0,
+	0xa3, 0x88, 0xa4, 0x99, 0xa3, 0x88, 0xe0, 0x09, 0xe0, 0x7f, 0x26, 0xc0, 0xe0, 0xc0, 0xe0, 0xc0,
+	0xe8, 0xbf, 0x00, 0xca, 0x35, 0xc0, 0xe0, 0x3c, 0x40, 0x62, 0x09, 0xe7, 0xd2, 0x89, 0xa9, 0x29,
+	0xc0, 0xa1, 0xa9, 0xe0, 0x7f, 0xe0, 0x17, 0xe0, 0x7f, 0xe8, 0x3c, 0xe2, 0xa3, 0x99, 0xab, 0xd9,
+	0xa8, 0x78, 0xaa, 0x77, 0xac, 0x78, 0x3b, 0x18, 0xc9, 0xfe, 0x67, 0x69, 0x1e, 0xe0, 0xa1, 0xa9,
+	0xc0, 0xa1, 0xa9, 0xc0, 0xa1, 0xa9, 0xc0, 0x1a, 0xc0, 0x7f, 0x1a, 0x22, 0xe0, 0x22, 0xe0, 0x6b,
+	0x2c, 0x1a, 0x56, 0x2c, 0x37, 0xfe, 0x9b, 0xe6, 0x18, 0xc6, 0x94, 0x99, 0xfe, 0x65, 0x68, 0x65,
+	0xa1, 0xa9, 0xa1, 0xa9, 0xfe, 0x21, 0x20, 0xe0, 0x7f, 0xe0, 0x6f, 0xe0, 0x0f, 0xe7, 0x9a, 0x98,
+	0xfe, 0x43, 0x48, 0x06, 0xfe, 0xb3, 0xa4, 0xba, 0x67, 0xc3, 0x94, 0xa9, 0xe0, 0xc0, 0xfe, 0xb7,
+	0xc5, 0xe7, 0x92, 0x99, 0x17, 0x0c, 0xc0, 0xe0, 0x7a, 0x7f, 0xc0, 0x7b, 0x25, 0x6f, 0xb2, 0x14,
+	0x18, 0xc4, 0x66, 0xfe, 0x6b, 0x8a, 0xe0, 0x17, 0x6f, 0xe0, 0x5a, 0xe8, 0x27, 0xe0, 0x38, 0x3a,
+	0x02, 0xc0, 0x37, 0x09, 0x37, 0xc0, 0xfe, 0x11, 0xb4, 0xe7, 0x9a, 0x98, 0x38, 0x55, 0xfe, 0xb2,
+	0x94, 0x18, 0xc3, 0x94, 0x99, 0xe0, 0x2a, 0x10, 0xe7, 0x96, 0x99, 0x8e, 0x77, 0xa4, 0x99, 0xa3,
+	0x88, 0xa5, 0x99, 0xa2, 0x88, 0xa4, 0x77, 0x7f, 0x03, 0x6e, 0xa2, 0x88, 0xc0, 0xa2, 0x88, 0xc0,
+	0x6e, 0xc8, 0xa8, 0x00, 0xc9, 0x26, 0xc0, 0x2d, 0xc0, 0x34, 0x03, 0x40, 0x3b, 0xf9, 0x91, 0x99,
+	0xfe, 0x43, 0x58, 0x6b, 0xa1, 0xa9, 0xe0, 0x7b, 0x7a, 0xe0, 0xc0, 0x7a, 0x5a, 0xe8, 0xd3, 0x95,
+	0x99, 0x29, 0x7a, 0x34, 0x22, 0xa1, 0xa9, 0x05, 0x0d, 0x25, 0xe0, 0xc0, 0xe0, 0xc0, 0x7b, 0x1a,
+	0x30, 0x1a, 0xc2, 0x56, 0x6e, 0x25, 0xfe, 0x97, 0xd5, 0x18, 0xc6, 0x2d, 0xfe, 0x29, 0x7a, 0x91,
+	0xeb, 0x1e, 0xc0, 0xe0, 0xfe, 0x00, 0x10, 0xe0, 0xc3, 0xfe, 0x30, 0x84, 0xe7, 0x99, 0x99, 0xfe,
+	0x22, 0x48, 0x7b, 0xfe, 0x5d, 0xef, 0xe4, 0xc0, 0xfe, 0x8f, 0x93, 0x17, 0x13, 0xe9, 0xc0, 0xe0,
+	0x22, 0xe0, 0xc0, 0xe0, 0xc0, 0xe0, 0x37, 0xfe, 0xdb, 0xee, 0xe5, 0x89, 0xb9, 0xfe, 0x65, 0x70,
+	0x17, 0x6f, 0x29, 0xc0, 0x55, 0xe8, 0xfe, 0x00, 0x00, 0xc0, 0xa1, 0xfa, 0xfe, 0x86, 0x80, 0x65,
+	0xe0, 0x7a, 0x37, 0x30, 0xe0, 0xfe, 0x51, 0xb4, 0xe7, 0x3b, 0xfe, 0x22, 0x48, 0x7f, 0x34, 0xe4,
+	0xc0, 0xfe, 0x8e, 0x73, 0x00, 0xe8, 0x96, 0x88, 0x8d, 0x99, 0xa4, 0x88, 0xe0, 0xa3, 0x88, 0xe0,
+	0x09, 0xe0, 0xa2, 0x88, 0xe0, 0x6e, 0xa2, 0x88, 0xc0, 0xe0, 0xc0, 0xe8, 0x9c, 0x00, 0xca, 0x35,
+	0xc0, 0xe0, 0x3c, 0x40, 0x0a, 0x09, 0xf8, 0x8c, 0x98, 0xfe, 0x43, 0x50, 0xe0, 0x3f, 0xc0, 0xa1,
+	0xa8, 0x7a, 0x7f, 0xc0, 0x7f, 0xe0, 0x09, 0xfc, 0x20, 0xfe, 0x44, 0x68, 0x0c, 0xc0, 0x02, 0x30,
+	0x25, 0xc0, 0x2c, 0xc0, 0x7b, 0xe0, 0x7f, 0x1a, 0x22, 0x65, 0x22, 0xe0, 0x02, 0x2c, 0xc0, 0x25,
+	0xfe, 0xf4, 0xcc, 0x18, 0xc7, 0x81, 0xca, 0x17, 0x7f, 0xc0, 0x14, 0x0c, 0x00, 0xc0, 0x19, 0xe0,
+	0x07, 0xe0, 0xfe, 0x72, 0x94, 0xe7, 0x0a, 0xfe, 0x23, 0x48, 0xb1, 0x36, 0x18, 0xc5, 0x8b, 0xb9,
+	0xfe, 0x65, 0x68, 0xfe, 0x75, 0xbd, 0xe7, 0x94, 0x99, 0x29, 0x1e, 0xe0, 0xa1, 0xa9, 0xc0, 0x09,
+	0xc0, 0xe0, 0xc0, 0xfe, 0xf4, 0xc4, 0xb8, 0x37, 0xc4, 0x98, 0x99, 0x0c, 0xe0, 0xc0, 0x17, 0x30,
+	0xe0, 0xc0, 0xec, 0x02, 0xc0, 0x09, 0x66, 0x37, 0x09, 0xfe, 0x93, 0xbc, 0xe7, 0x0a, 0x06, 0xb1,
+	0x46, 0x18, 0xc5, 0x8b, 0x99, 0xe0, 0xfe, 0x96, 0xb5, 0xe7, 0x97, 0x99, 0xe2, 0xa4, 0x88, 0xa2,
+	0x88, 0xe3, 0xa2, 0x88, 0xc0, 0xa2, 0x88, 0xc0, 0x18, 0xc8, 0x9b, 0x00, 0xc9, 0x26, 0xc0, 0x2d,
+	0xc0, 0x34, 0x03, 0x40, 0x51, 0xf5, 0x3c, 0x94, 0x88, 0x86, 0x98, 0x06, 0x7a, 0x7f, 0x29, 0xa1,
+	0xa9, 0xe0, 0x14, 0xe0, 0x7a, 0xc0, 0x09, 0x55, 0xb2, 0x25, 0xfa, 0x93, 0xa9, 0x29, 0x1e, 0xc0,
+	0x14, 0xe0, 0x37, 0xc0, 0x0d, 0x7a, 0x1a, 0xc2, 0x7b, 0x1a, 0x30, 0x1a, 0x6b, 0x59, 0xc0, 0x65,
+	0xfe, 0x73, 0xc4, 0x18, 0xc7, 0x8a, 0xa9, 0xfe, 0x44, 0x68, 0x1e, 0xc0, 0x0c, 0x7a, 0xa0, 0x37,
+	0xe1, 0xc3, 0xfe, 0x92, 0x94, 0xe8, 0xfe, 0x22, 0x40, 0xb1, 0x48, 0xe7, 0x17, 0xfe, 0x56, 0xbd,
+	0xe7, 0x94, 0x98, 0xe0, 0x17, 0xe0, 0xc0, 0xe0, 0xc0, 0xe0, 0x65, 0xad, 0x46, 0xfe, 0x9e, 0xf7,
+	0xe4, 0x66, 0xfe, 0x2d, 0x93, 0x1e, 0xc0, 0x17, 0xc0, 0x5a, 0xc0, 0x59, 0xea, 0xa0, 0xea, 0xe0,
+	0x3a, 0xe0, 0xc0, 0x09, 0x65, 0xe0, 0xfe, 0x92, 0xbc, 0xe8, 0xfe, 0x22, 0x40, 0xb1, 0x58, 0xe8,
+	0xfe, 0x75, 0xad, 0xe7, 0x11, 0x8c, 0x88, 0x33, 0xa4, 0x99, 0xa4, 0x77, 0xa4, 0x88, 0xa2, 0x88,
+	0xe2, 0x6e, 0xe0, 0x1f, 0xe0, 0xc0, 0xe8, 0xa8, 0x00, 0xca, 0x35, 0xc0, 0xe0, 0x3c, 0x40, 0x0a,
+	0x9d, 0x88, 0xf3, 0x66, 0x8b, 0x88, 0xfe, 0x21, 0x20, 0xa0, 0xb9, 0x30, 0xe0, 0xa1, 0xa9, 0x29,
+	0x7f, 0xe0, 0xa1, 0xa9, 0xc0, 0xa1, 0xa9, 0xe0, 0x37, 0x56, 0x09, 0xb1, 0x15, 0xf9, 0x9b, 0x99,
+	0xfe, 0xa8, 0x69, 0x30, 0xe0, 0x14, 0xc0, 0x09, 0xe0, 0x7f, 0x65, 0x1a, 0xc0, 0x6b, 0xe0, 0x22,
+	0x65, 0x22, 0x1a, 0x22, 0x1a, 0xc0, 0xe0, 0xfe, 0x32, 0xc4, 0x26, 0xe7, 0x8e, 0xa9, 0x30, 0x7a,
+	0xc0, 0x7f, 0x3a, 0x37, 0xfe, 0x01, 0x20, 0xa1, 0x48, 0xe0, 0x07, 0xe0, 0x19, 0xe0, 0x10, 0xe8,
+	0x06, 0xc0, 0x3c, 0xe5, 0xfe, 0x8e, 0x93, 0x30, 0xfe, 0x75, 0xbd, 0xe7, 0x94, 0x99, 0x3b, 0x30,
+	0x1e, 0x14, 0xc0, 0x09, 0x65, 0x09, 0xfe, 0x59, 0xde, 0xad, 0x68, 0xc4, 0x8e, 0xb9, 0x1e, 0xc0,
+	0x3f, 0x6e, 0xe0, 0x30, 0xe0, 0xc0, 0xea, 0xa1, 0xda, 0xfe, 0x65, 0x80, 0x14, 0xe0, 0x7f, 0x65,
+	0x37, 0x17, 0x0f, 0xe8, 0x06, 0xc0, 0x3c, 0xe5, 0x1d, 0xe9, 0x97, 0x99, 0x8b, 0x88, 0xa4, 0x99,
+	0xa4, 0x77, 0xa4, 0x99, 0xa3, 0x88, 0xa4, 0x88, 0xe2, 0xa2, 0x88, 0xc0, 0xa2, 0x88, 0xc0, 0x18,
+	0xc8, 0xaf, 0x00, 0xc9, 0x26, 0xc0, 0x2d, 0xc0, 0x34, 0x03, 0x02, 0x55, 0xf3, 0xc1, 0x93, 0x99,
+	0xfe, 0x22, 0x30, 0x76, 0xe0, 0x7a, 0xe0, 0x7a, 0x0c, 0xc0, 0xa1, 0xa9, 0xc0, 0x7f, 0x30, 0x37,
+	0x30, 0xb2, 0x16, 0xf8, 0x99, 0xa9, 0xfe, 0x49, 0x72, 0x17, 0xc0, 0x0c, 0x3a, 0x02, 0x30, 0xe0,
+	0x7a, 0x7f, 0x66, 0xe0, 0xc0, 0x7b, 0x1a, 0x30, 0x1a, 0x6b, 0x1a, 0xc0, 0x3b, 0xfe, 0xf1, 0xc3,
+	0xbf, 0x07, 0x18, 0xc6, 0x91, 0xa9, 0xfe, 0x45, 0x70, 0x1e, 0xc0, 0x0c, 0xc0, 0xa1, 0xa9, 0x7a,
+	0xfe, 0x00, 0x00, 0xc5, 0x01, 0xe7, 0x99, 0x99, 0xfe, 0x22, 0x40, 0xe0, 0xfe, 0xb2, 0x9c, 0xe4,
+	0x94, 0x98, 0x3f, 0x59, 0xfe, 0x76, 0xbd, 0xe7, 0x92, 0x99, 0xe0, 0x29, 0xe0, 0x0c, 0xe0, 0xc0,
+	0xe0, 0xfe, 0x10, 0xac, 0x18, 0xc4, 0x9b, 0xa9, 0xfe, 0x06, 0x71, 0xe0, 0x17, 0x6e, 0x29, 0xe0,
+	0x29, 0xec, 0x1c, 0xfe, 0x86, 0x80, 0x0c, 0xe0, 0xc0, 0x7b, 0x69, 0x6f, 0x2e, 0xe7, 0x3b, 0xfe,
+	0x22, 0x40, 0xe0, 0xfe, 0xb2, 0xa4, 0xe4, 0x10, 0x00, 0xc0, 0xfe, 0x76, 0xb5, 0xe7, 0x95, 0x99,
+	0xe0, 0x33, 0xa4, 0x99, 0xa3, 0x88, 0xe0, 0xa3, 0x88, 0xe0, 0x6e, 0xe0, 0x6e, 0xe0, 0x6e, 0xe0,
+	0xc0, 0xe8, 0xbd, 0x00, 0xca, 0x62, 0xc0, 0xe0, 0x3c, 0x40, 0x62, 0x09, 0xf5, 0xc0, 0x25, 0xfe,
+	0x23, 0x40, 0xe0, 0xa1, 0xa9, 0xe0, 0x1e, 0xe0, 0xa1, 0xa9, 0xc0, 0x7f, 0x17, 0x37, 0x09, 0x37,
+	0x38, 0xf6, 0x66, 0x90, 0x98, 0xfe, 0x05, 0x61, 0x9b, 0xcb, 0x1e, 0x7a, 0x3a, 0x02, 0x7a, 0x37,
+	0x7a, 0x2c, 0xc0, 0x1a, 0xc0, 0x7f, 0x1a, 0x22, 0x1a, 0x22, 0x1a, 0xc0, 0x2c, 0xb7, 0x05, 0x35,
+	0xa2, 0x77, 0xc6, 0x93, 0xa9, 0x1e, 0x0c, 0xe0, 0x7f, 0xe0, 0x02, 0xc0, 0x9e, 0x16, 0xe0, 0x07,
+	0xe0, 0x19, 0xe0, 0x07, 0xe0, 0xfe, 0x10, 0x84, 0xe7, 0x2d, 0x06, 0xc0, 0x7e, 0xfe, 0x92, 0xa4,
+	0xb6, 0x78, 0xe0, 0x35, 0x91, 0x98, 0xfe, 0x26, 0x71, 0x99, 0xba, 0x6f, 0xfe, 0xb6, 0xc5, 0xe9,
+	0x30, 0xe0, 0x7f, 0x76, 0x02, 0xa6, 0x56, 0x3c, 0xe5, 0xfe, 0xd0, 0x9b, 0x1e, 0x17, 0x30, 0x29,
+	0x30, 0x29, 0x7e, 0xec, 0xa1, 0xa9, 0x3a, 0x6f, 0xc0, 0xa0, 0xa9, 0x02, 0x7f, 0x65, 0xfe, 0x31,
+	0xb4, 0xe7, 0x9a, 0x98, 0xfe, 0x23, 0x40, 0x69, 0xa1, 0xaa, 0xfe, 0x92, 0x9c, 0xb6, 0x78, 0xe0,
+	0x62, 0x91, 0x88, 0xfe, 0x04, 0x21, 0xe0, 0x6b, 0xfe, 0xb6, 0xb5, 0xe9, 0xa4, 0x99, 0xa4, 0x77,
+	0xa4, 0x99, 0xe0, 0xa4, 0x88, 0xe0, 0xa2, 0x88, 0xe0, 0xa2, 0x88, 0xc0, 0xa2, 0x88, 0xc0, 0x6e,
+	0xc8, 0xaf, 0x00, 0xc9, 0x26, 0xc0, 0x2d, 0xc0, 0x34, 0x03, 0x9d, 0x88, 0x55, 0xf6, 0xc0, 0xfe,
+	0xcb, 0x6a, 0xe0, 0xa0, 0xa8, 0xa1, 0xa9, 0x7a, 0xa1, 0x9a, 0x7a, 0xa1, 0xa8, 0xc0, 0x37, 0x66,
+	0x37, 0x30, 0xf5, 0x9b, 0x99, 0x92, 0x98, 0x86, 0xc9, 0x29, 0x7f, 0x17, 0xa1, 0xa9, 0xc0, 0xa1,
+	0xa9, 0xc0, 0x37, 0xc0, 0x7b, 0x69, 0xe0, 0xc0, 0xe0, 0xc2, 0x6b, 0x1a, 0xc0, 0x56, 0xfe, 0x8f,
+	0xbb, 0xfe, 0xbe, 0xff, 0x18, 0xc6, 0x93, 0xb9, 0xfe, 0x65, 0x70, 0xc1, 0x0c, 0xc0, 0x14, 0xe0,
+	0x25, 0x1c, 0xe0, 0xc5, 0xbb, 0x88, 0xe7, 0x9c, 0x98, 0xfe, 0x22, 0x40, 0xe0, 0xc0, 0xa1, 0xa9,
+	0x65, 0x29, 0xc0, 0x7b, 0x17, 0x6f, 0x29, 0xfe, 0xf8, 0xcd, 0xe7, 0x8f, 0x99, 0xe0, 0x29, 0xe0,
+	0xc0, 0xa1, 0xa9, 0x66, 0xfe, 0xd7, 0xd5, 0x18, 0xc4, 0x91, 0xa9, 0xfe, 0x65, 0x70, 0x29, 0xe0,
+	0x29, 0xc4, 0x55, 0xea, 0xc0, 0x0c, 0xc0, 0xe0, 0xc0, 0xe0, 0xc0, 0x7b, 0xfe, 0x6e, 0xa3, 0xe7,
+	0x34, 0xfe, 0x22, 0x40, 0x06, 0xc1, 0x9f, 0x06, 0xc5, 0xfe, 0xf8, 0xc5, 0xe7, 0x92, 0x88, 0x90,
+	0x99, 0xa4, 0x77, 0xe0, 0xa3, 0x99, 0xe0, 0xa3, 0x88, 0xe0, 0x0a, 0xe0, 0x6e, 0xe0, 0x1f, 0xe0,
+	0xc0, 0xe8, 0xbe, 0x00, 0xca, 0x35, 0xc0, 0xe0, 0x3c, 0x40, 0x0a, 0x9d, 0x88, 0xe8, 0x00, 0xc1,
+	0xb5, 0x99, 0xb6, 0x77, 0xb3, 0x99, 0xe8, 0x94, 0x99, 0xe0, 0x29, 0xe0, 0x0c, 0xc0, 0xa1, 0xa9,
+	0xc0, 0x37, 0xc3, 0xef, 0x9d, 0x99, 0x34, 0x9b, 0x99, 0x05, 0x96, 0x98, 0x12, 0x29, 0x7e, 0x66,
+	0x7f, 0xc0, 0x7f, 0x3a, 0x02, 0xc0, 0x37, 0xc0, 0x7f, 0x76, 0x6e, 0xc0, 0x7b, 0xe0, 0x7f, 0xe0,
+	0x22, 0x1a, 0xc0, 0x2c, 0xb5, 0x05, 0x0d, 0xa2, 0x78, 0xc6, 0x94, 0xa9, 0xfe, 0xa5, 0x70, 0x0c,
+	0xe0, 0x26, 0xe0, 0xa1, 0xa9, 0xc0, 0x7f, 0x9e, 0x36, 0x19, 0xe0, 0x19, 0xe0, 0x07, 0xe0, 0x19,
+	0xe0, 0x01, 0xe7, 0x2d, 0xfe, 0x23, 0x48, 0xc0, 0x7f, 0x75, 0x29, 0xc0, 0x7f, 0x17, 0x1e, 0x17,
+	0x30, 0xfe, 0x39, 0xd6, 0xe7, 0x8c, 0xa9, 0xfe, 0x43, 0x58, 0x30, 0x3f, 0x0c, 0xc0, 0x02, 0xfe,
+	0xbe, 0xff, 0xe4, 0x2d, 0xfe, 0xe9, 0x79, 0x17, 0x6e, 0x29, 0xc0, 0x5a, 0xe0, 0x3b, 0xe0, 0x3b,
+	0xc0, 0xeb, 0x17, 0xa1, 0xaa, 0x0c, 0x02, 0xc0, 0x7b, 0x02, 0xb2, 0x15, 0xe7, 0x2d, 0x06, 0xc0,
+	0x7e, 0x66, 0xe3, 0x07, 0xe0, 0x6e, 0xfe, 0x39, 0xce, 0xe7, 0x91, 0x99, 0x91, 0x88, 0xa4, 0x99,
+	0xe0, 0xa4, 0x99, 0xe0, 0xa4, 0x88, 0xe0, 0xa2, 0x88, 0xe0, 0xa2, 0x88, 0xc0, 0xa2, 0x88, 0xc0,
+	0x18, 0xc8, 0xaa, 0x00, 0xc9, 0x26, 0xc0, 0x2d, 0xc0, 0x51, 0x03, 0x40, 0x51, 0xe7, 0x26, 0xe2,
+	0xc1, 0xb8, 0x88, 0x2d, 0xe7, 0xc0, 0xfe, 0x2d, 0x7b, 0xfe, 0x23, 0x58, 0xe0, 0x1e, 0xa1, 0xa9,
+	0xc0, 0xa0, 0xa8, 0xc0, 0xe0, 0x66, 0xe0, 0x56, 0x20, 0xe7, 0x9b, 0x99, 0x00, 0xc2, 0x1c, 0xa1,
+	0xea, 0x06, 0xc0, 0xa1, 0xa9, 0x22, 0x29, 0xc0, 0x7f, 0x65, 0x1e, 0xc0, 0x7f, 0x3a, 0x02, 0xc0,
+	0x7f, 0x05, 0x7f, 0x69, 0x2c, 0x66, 0x1a, 0xc2, 0x6b, 0x1a, 0xc0, 0x3b, 0xb4, 0x04, 0x2d, 0x18,
+	0xc6, 0x95, 0xa9, 0xfe, 0xa5, 0x70, 0x0c, 0x1e, 0x0c, 0xc0, 0x14, 0xc0, 0xa0, 0xa8, 0xa1, 0xb9,
+	0xfe, 0x21, 0x10, 0x00, 0xc6, 0xa7, 0x88, 0xe7, 0xc0, 0xfe, 0x23, 0x50, 0xe0, 0x34, 0x7f, 0xe0,
+	0x17, 0xc0, 0x6f, 0x17, 0x1e, 0x17, 0x11, 0xe7, 0x87, 0xa9, 0x3b, 0x29, 0x30, 0x1e, 0x7b, 0x0c,
+	0xfe, 0xbf, 0xff, 0xe4, 0xd8, 0x91, 0xa9, 0xe0, 0x3a, 0xe0, 0x14, 0xe0, 0xa4, 0x67, 0xe7, 0xc0,
+	0xfe, 0x22, 0x40, 0xe0, 0x7a, 0x3b, 0xe3, 0xc2, 0x11, 0xe7, 0x8d, 0x99, 0x96, 0x88, 0x33, 0xa4,
+	0x99, 0xa4, 0x77, 0xa4, 0x88, 0xa2, 0x88, 0xe2, 0x6e, 0xe0, 0x6e, 0xe0, 0xc0, 0xe8, 0xaf, 0x00,
+	0xca, 0x35, 0xc0, 0xe0, 0x3c, 0x40, 0x62, 0x9d, 0x88, 0xe7, 0xc0, 0xe2, 0xa2, 0x88, 0xe0, 0xc0,
+	0xbc, 0x88, 0xe8, 0x94, 0x98, 0x29, 0xe0, 0x0c, 0xc0, 0xa1, 0xa9, 0xc0, 0xa1, 0xa9, 0xc3, 0xb1,
+	0x15, 0xe7, 0x3c, 0xe3, 0xc0, 0xfe, 0x44, 0x50, 0x34, 0x7f, 0x29, 0x7f, 0x66, 0x1e, 0xc0, 0x7f,
+	0x0c, 0x14, 0xc0, 0xa0, 0xa9, 0x69, 0x37, 0xc0, 0x3e, 0xe0, 0x2c, 0xc0, 0x7b, 0xe0, 0x02, 0xe0,
+	0x7b, 0x1a, 0xc0, 0x2c, 0xb2, 0x15, 0xfe, 0x9e, 0xff, 0x18, 0xc6, 0x95, 0xa9, 0xfe, 0xa5, 0x70,
+	0x0c, 0x1e, 0x0c, 0xc0, 0x14, 0xc0, 0xa1, 0xa9, 0xe0, 0xa0, 0x47, 0x00, 0x19, 0xe0, 0x07, 0xe0,
+	0x19, 0xe0, 0x07, 0xe0, 0x19, 0xfe, 0x9e, 0xf7, 0xe7, 0x39, 0x34, 0x3b, 0xc0, 0x3f, 0xe0, 0x1e,
+	0xc3, 0xfe, 0x1c, 0xef, 0xe7, 0x80, 0xb9, 0xe0, 0xa1, 0xa8, 0x66, 0x0c, 0xc0, 0x14, 0xfe, 0xbe,
+	0xff, 0xfd, 0x92, 0xa9, 0x1e, 0x14, 0xc0, 0x7a, 0xc1, 0x1b, 0xe7, 0xfe, 0x8a, 0x6a, 0xe0, 0x3b,
+	0xe2, 0x07, 0xe0, 0x31, 0xe0, 0x07, 0xfe, 0x1c, 0xe7, 0xe7, 0x89, 0x99, 0xe0, 0xa4, 0x88, 0xa4,
+	0x88, 0xa4, 0x88, 0xa2, 0x88, 0xa4, 0x88, 0xe2, 0x2d, 0xc0, 0xa2, 0x88, 0xc0, 0x18, 0xc8, 0x9d,
+	0x00, 0xc9, 0x26, 0xc0, 0x2d, 0xc0, 0x51, 0x66, 0x40, 0x51, 0xe7, 0x26, 0xfe, 0x45, 0x29, 0x51,
+	0xa3, 0x88, 0xe2, 0xc0, 0xfe, 0xb6, 0xb5, 0xe7, 0xc0, 0xfe, 0x0c, 0x83, 0x3f, 0x7e, 0x14, 0x66,
+	0xa1, 0xa9, 0x69, 0xe0, 0x66, 0xe0, 0x30, 0x20, 0xe7, 0x9b, 0x99, 0xe4, 0xfe, 0x23, 0x50, 0xa1,
+	0xa9, 0xc0, 0x7f, 0x75, 0x0c, 0xc0, 0x14, 0x65, 0x02, 0xc0, 0x17, 0x69, 0x7f, 0xc0, 0x7b, 0x69,
+	0x7f, 0x66, 0x1a, 0xc5, 0x3b, 0xb1, 0x15, 0xfe, 0x7d, 0xf7, 0x18, 0xc6, 0x95, 0xa9, 0xfe, 0xa5,
+	0x70, 0x1e, 0x05, 0x0c, 0xc0, 0x7f, 0x3a, 0x7f, 0xc0, 0x3b, 0x00, 0xc9, 0xfe, 0x1c, 0xe7, 0xe7,
+	0x80, 0x88, 0x06, 0x34, 0x29, 0xc0, 0x7f, 0x65, 0xe2, 0x66, 0xfe, 0xbf, 0xff, 0xe7, 0xfe, 0x6a,
+	0x6a, 0xe0, 0x29, 0x1e, 0xc0, 0xe0, 0xc0, 0x35, 0xfd, 0x91, 0xa9, 0xe0, 0x0c, 0xe0, 0x22, 0xe0,
+	0x3a, 0xfe, 0x3c, 0xef, 0xe7, 0x80, 0xa9, 0x34, 0xc0, 0xe2, 0xc4, 0x1f, 0xe7, 0x83, 0x99, 0xe2,
+	0xa3, 0x88, 0xa4, 0x99, 0xa2, 0x77, 0xe2, 0x6e, 0xa2, 0x88, 0xc0, 0xe0, 0xc0, 0xe8, 0xbb, 0x00,
+	0xca, 0x35, 0xc0, 0xe0, 0x66, 0x40, 0x0a, 0x09, 0xe7, 0xc0, 0xfe, 0xe7, 0x39, 0x7b, 0x6e, 0x91,
+	0x99, 0xe2, 0xac, 0x88, 0xfe, 0x9e, 0xf7, 0xe7, 0x94, 0xa9, 0xfe, 0x44, 0x68, 0xe0, 0x7a, 0xa1,
+	0xa9, 0xc0, 0x7f, 0xc0, 0x7a, 0xc1, 0x38, 0xe7, 0x3c, 0xe4, 0xa1, 0xea, 0x17, 0x1e, 0xc0, 0xa1,
+	0xa9, 0x22, 0x02, 0xc0, 0x09, 0x65, 0x37, 0xc0, 0x25, 0xc0, 0x2c, 0x66, 0x2c, 0xc0, 0x7b, 0xe0,
+	0x02, 0xe0, 0x7b, 0xe1, 0x2c, 0xaf, 0x36, 0xfe, 0x7d, 0xf7, 0x18, 0xc6, 0x95, 0xa9, 0xfe, 0xa5,
+	0x70, 0x1e, 0xc2, 0xa1, 0xa9, 0x22, 0x7e, 0xc0, 0xa1, 0xa9, 0xfe, 0x22, 0x20, 0x19, 0xe0, 0x07,
+	0xe0, 0x19, 0xe0, 0x07, 0xe0, 0x19, 0xe0, 0x07, 0xfe, 0x59, 0xce, 0xe7, 0x8b, 0x99, 0xfe, 0x00,
+	0x00, 0x29, 0xc0, 0x7f, 0x17, 0x1e, 0xc0, 0x0c, 0xe0, 0xaf, 0x37, 0x18, 0xc6, 0x1f, 0xfe, 0x44,
+	0x58, 0xc0, 0x30, 0xe0, 0x0c, 0xc0, 0x14, 0xfe, 0xbe, 0xff, 0xfd, 0x92, 0xa9, 0xe0, 0x7f, 0x0c,
+	0x02, 0x14, 0x02, 0xfe, 0x59, 0xde, 0xe7, 0x8b, 0xa9, 0xe0, 0x3b, 0xe2, 0x31, 0xe0, 0x07, 0xe0,
+	0xb2, 0x88, 0x18, 0xc6, 0x35, 0x83, 0x88, 0xa3, 0x88, 0xa4, 0x99, 0xe0, 0xa4, 0x88, 0xe0, 0xa3,
+	0x88, 0xe0, 0x03, 0xe0, 0x2d, 0xc0, 0xa2, 0x88, 0xc0, 0x18, 0xc8, 0xa6, 0x00, 0xc9, 0x26, 0xc0,
+	0x1f, 0xe0, 0x51, 0x03, 0x40, 0x51, 0xe7, 0x26, 0x00, 0xc0, 0x39, 0x8c, 0x88, 0xc3, 0xfe, 0x76,
+	0xb5, 0xe7, 0xc0, 0xfe, 0x0d, 0x8b, 0xfe, 0x45, 0x70, 0xe0, 0x7a, 0xe0, 0xc0, 0xe0, 0x65, 0xe0,
+	0x30, 0x20, 0xe7, 0x9b, 0x99, 0xe4, 0x7a, 0x14, 0x0c, 0x14, 0x22, 0x7e, 0xc0, 0x7f, 0x30, 0x37,
+	0xc0, 0x25, 0xc0, 0x7f, 0x13, 0x2c, 0x66, 0x7e, 0xc2, 0x6b, 0x1a, 0xc0, 0x3b, 0xaf, 0x25, 0xfe,
+	0x5d, 0xf7, 0x18, 0xc6, 0x06, 0xfe, 0xa5, 0x68, 0x62, 0x17, 0xe0, 0x2d, 0x0c, 0xc0, 0x7f, 0xe0,
+	0x7b, 0x14, 0x00, 0xca, 0xfe, 0x75, 0xad, 0xe7, 0x10, 0xe0, 0xc0, 0xfe, 0x44, 0x68, 0x29, 0x30,
+	0x17, 0xe0, 0xc0, 0x0c, 0xfe, 0x92, 0xac, 0xe7, 0x99, 0x99, 0xfe, 0x23, 0x50, 0x29, 0xc0, 0xe0,
+	0xc0, 0xa0, 0xa9, 0x0c, 0x35, 0xfd, 0x05, 0x30, 0x7a, 0x22, 0x0c, 0xe0, 0x22, 0xfe, 0x76, 0xc5,
+	0xe7, 0x93, 0x99, 0xfe, 0x43, 0x50, 0x34, 0x29, 0xe1, 0xc3, 0xfe, 0x72, 0x94, 0xe7, 0x03, 0xe0,
+	0xa4, 0x88, 0xa3, 0x88, 0xa4, 0x99, 0xe0, 0xa4, 0x88, 0xe0, 0x0a, 0x3b, 0xe0, 0x6e, 0x35, 0x1f,
+	0xe0, 0xc0, 0xe8, 0xb3, 0x00, 0xca, 0x35, 0xc0, 0xe0, 0x3c, 0x40, 0x0a, 0xe8, 0xc0, 0xfe, 0xab,
+	0x5a, 0x6e, 0x2b, 0x90, 0x88, 0xe2, 0x27, 0x15, 0x35, 0xe7, 0x94, 0x98, 0x1e, 0xe0, 0x14, 0xe0,
+	0x09, 0x66, 0x37, 0x17, 0x37, 0xb1, 0x15, 0xe7, 0x3c, 0xe4, 0xc0, 0x29, 0x14, 0x7a, 0x09, 0x17,
+	0x37, 0xc0, 0x7b, 0x25, 0x7f, 0xe0, 0x2c, 0xc0, 0x1a, 0xc0, 0x6b, 0xe0, 0x7f, 0xe0, 0x22, 0x1a,
+	0x02, 0x2c, 0xad, 0x36, 0xfe, 0x5d, 0xf7, 0x18, 0xc6, 0x95, 0xa9, 0xfe, 0xa5, 0x68, 0x62, 0x65,
+	0x30, 0x17, 0x1e, 0xe0, 0x7f, 0xc0, 0x7b, 0xa1, 0xa8, 0x00, 0xc0, 0x07, 0xe0, 0x19, 0xe0, 0x07,
+	0xe0, 0x07, 0xe0, 0x07, 0xe0, 0x19, 0xbc, 0x87, 0xe7, 0x9d, 0x99, 0xe1, 0xa1, 0xea, 0x1e, 0x17,
+	0x1e, 0xc0, 0x0c, 0x1e, 0xfe, 0x39, 0xd6, 0xe7, 0x90, 0x98, 0xfe, 0x44, 0x58, 0xe0, 0x30, 0xe0,
+	0x7f, 0xe0, 0x6e, 0xfe, 0xbe, 0xff, 0xfd, 0x92, 0xa9, 0x17, 0x0c, 0xc0, 0x14, 0xc0, 0x7a, 0xfe,
+	0xaf, 0xa3, 0xe7, 0x2d, 0xfe, 0x23, 0x50, 0x3b, 0xc0, 0xe1, 0x07, 0xe0, 0x6e, 0xe0, 0xfe, 0x39,
+	0xce, 0xe7, 0x94, 0x88, 0x8e, 0x99, 0xe0, 0x33, 0xa4, 0x88, 0xa4, 0x88, 0xe0, 0x11, 0xa2, 0x77,
+	0x03, 0xe0, 0x2d, 0x6e, 0x7f, 0xc0, 0x18, 0xc8, 0xa9, 0x00, 0xc9, 0x26, 0xc0, 0x1f, 0xe0, 0x51,
+	0x03, 0x40, 0x11, 0xe7, 0x26, 0x2b, 0xc0, 0xa3, 0x99, 0x8c, 0x77, 0xe2, 0xc1, 0xfe, 0xb6, 0xb5,
+	0xe7, 0xc0, 0xfe, 0x0c, 0x8b, 0xe0, 0xc0, 0xe0, 0xc0, 0xe0, 0x69, 0x09, 0x30, 0xe8, 0x9b, 0x99,
+	0xe5, 0xa1, 0xb9, 0xfe, 0x87, 0x98, 0x09, 0x30, 0x37, 0xc0, 0x7b, 0x69, 0x7f, 0x66, 0x2c, 0x3b,
+	0x1a, 0xc0, 0x6b, 0x1a, 0x7a, 0x1a, 0x7b, 0x1a, 0xc0, 0x2c, 0xab, 0x46, 0x1b, 0x18, 0xc6, 0x95,
+	0xa9, 0xfe, 0x85, 0x60, 0x61, 0xc2, 0x7f, 0x65, 0xe0, 0xc0, 0xe0, 0xa0, 0xa8, 0x23, 0xe1, 0xca,
+	0xa4, 0x88, 0x1f, 0xe6, 0xc0, 0x83, 0x99, 0xe0, 0xc0, 0xfe, 0x22, 0x48, 0xa2, 0xca, 0x17, 0xe0,
+	0xc0, 0xa9, 0x56, 0x2d, 0xe7, 0x84, 0xa9, 0xfe, 0x23, 0x58, 0x17, 0xc0, 0x0c, 0xc0, 0x14, 0x66,
+	0x35, 0xfd, 0x92, 0x98, 0xfe, 0x65, 0x68, 0x1e, 0xe0, 0x3a, 0xe0, 0x3a, 0xa3, 0x78, 0x35, 0xe6,
+	0xc0, 0x83, 0xb9, 0xfe, 0x23, 0x50, 0xe2, 0xc2, 0x0e, 0x2d, 0xe7, 0x8c, 0x88, 0xe0, 0xa4, 0x88,
+	0xe0, 0xa5, 0x88, 0xa2, 0x88, 0xa4, 0x88, 0xa2, 0x88, 0x0a, 0xa2, 0x77, 0x3c, 0xe0, 0x35, 0xc0,
+	0xe0, 0xc0, 0xe8, 0xc2, 0x00, 0xca, 0xe0, 0x35, 0xe0, 0x3c, 0x2d, 0x66, 0x9d, 0x88, 0xe7, 0xc0,
+	0xfe, 0x4d, 0x6b, 0x1d, 0x7f, 0x93, 0x88, 0xe0, 0x7f, 0xe0, 0x6e, 0xe0, 0xb0, 0x88, 0x26, 0xe7,
+	0x06, 0xfe, 0x65, 0x70, 0x14, 0xc0, 0xe0, 0xc0, 0x7f, 0x65, 0x09, 0xb1, 0x15, 0xe7, 0x3c, 0xe2,
+	0x7f, 0xe0, 0x31, 0x00, 0x1e, 0xa2, 0xc9, 0x7a, 0xc0, 0x2c, 0x66, 0x2c, 0xc0, 0x7b, 0x1a, 0x02,
+	0xe0, 0x7f, 0x65, 0x22, 0x1a, 0x22, 0x1a, 0x22, 0xe0, 0xaa, 0x46, 0xfe, 0x3c, 0xf7, 0x18, 0xc6,
+	0x95, 0xa9, 0xfe, 0xa5, 0x60, 0x29, 0x5a, 0xe0, 0x3b, 0xa0, 0xa9, 0x69, 0x1e, 0xc0, 0x14, 0x7a,
+	0xfe, 0x43, 0x38, 0x00, 0x07, 0xe0, 0x19, 0xe0, 0x07, 0xe0, 0x19, 0xe0, 0x07, 0xe0, 0x19, 0xe0,
+	0x07, 0x00, 0xfe, 0xba, 0xd6, 0xe7, 0x99, 0x99, 0x27, 0xe0, 0xc0, 0xfe, 0x43, 0x50, 0x1e, 0xc1,
+	0xfe, 0x76, 0xbd, 0x18, 0xc6, 0x66, 0xfe, 0x46, 0x61, 0x29, 0xe0, 0x1e, 0xe0, 0x14, 0xc0, 0x02,
+	0xfd, 0xc0, 0x92, 0x99, 0x3f, 0x0c, 0xc0, 0x14, 0xc0, 0x02, 0x14, 0xfe, 0xbb, 0xe6, 0xe7, 0x3b,
+	0xfe, 0x44, 0x58, 0x34, 0xe1, 0x31, 0xe0, 0x07, 0xfe, 0x75, 0xad, 0x18, 0xc7, 0x82, 0x88, 0xa2,
+	0x99, 0xa3, 0x88, 0xa4, 0x88, 0xe0, 0x1f, 0xa2, 0x88, 0xa3, 0x88, 0xa2, 0x88, 0xa2, 0x88, 0x6e,
+	0xa2, 0x88, 0xc0, 0x7f, 0xc0, 0x6e, 0xc8, 0xb2, 0x00, 0xc9, 0x26, 0xc0, 0x1f, 0xe0, 0x34, 0x03,
+	0x40, 0x62, 0xe7, 0x26, 0x1d, 0x0f, 0xa3, 0x99, 0x93, 0x99, 0xe0, 0xc4, 0xfe, 0x18, 0xc6, 0xe7,
+	0xc0, 0x39, 0xfe, 0x65, 0x70, 0xe0, 0x66, 0xe0, 0xc0, 0xe0, 0x5a, 0xe8, 0x9b, 0x99, 0xe2, 0xc3,
+	0x2e, 0x1a, 0xe0, 0x7f, 0x13, 0x2c, 0xc0, 0x1a, 0xc2, 0x7b, 0x1a, 0x30, 0x69, 0x30, 0x1a, 0x30,
+	0x1a, 0xa9, 0x47, 0xfe, 0x1c, 0xef, 0x18, 0xc6, 0x37, 0xfe, 0xc5, 0x60, 0x9c, 0x99, 0x55, 0x7e,
+	0x34, 0xe0, 0x14, 0x7b, 0x7a, 0xe0, 0xa0, 0xa8, 0x9f, 0x37, 0x00, 0xce, 0xfe, 0xb2, 0x94, 0xe7,
+	0xc0, 0x8e, 0x88, 0xe1, 0xc0, 0x34, 0xe0, 0xbb, 0x05, 0xfe, 0xff, 0xff, 0xc7, 0x94, 0x98, 0x3b,
+	0xe0, 0x1e, 0xc0, 0xa1, 0xa9, 0x22, 0x02, 0xc3, 0x14, 0xc0, 0x0c, 0xc0, 0x55, 0x5f, 0x65, 0x29,
+	0x3b, 0xc0, 0x65, 0x3b, 0x45, 0xc0, 0x9f, 0x57, 0xe7, 0x93, 0x99, 0x00, 0xc2, 0xa0, 0xc9, 0x1e,
+	0xc0, 0x14, 0x3a, 0x02, 0xc1, 0xfe, 0xb3, 0xb4, 0xe7, 0xc0, 0x8e, 0x98, 0xfe, 0x22, 0x38, 0xe1,
+	0xc1, 0xbe, 0x88, 0x18, 0xc7, 0x97, 0x99, 0xe0, 0xa2, 0x88, 0xa4, 0x99, 0xe0, 0xa4, 0x88, 0xa3,
+	0x88, 0xa3, 0x99, 0xe2, 0x3c, 0x6e, 0x35, 0x59, 0x18, 0x66, 0xe8, 0xb3, 0x00, 0xca, 0xe0, 0x35,
+	0xe0, 0x3c, 0xe0, 0x55, 0x9d, 0x88, 0xe7, 0xc0, 0x16, 0x0f, 0x7f, 0xc0, 0xe0, 0x31, 0xe0, 0x07,
+	0xe0, 0x31, 0xb3, 0x99, 0xe8, 0x93, 0xa9, 0x0c, 0xc0, 0xa1, 0xa9, 0xc0, 0x6b, 0x02, 0x7f, 0xe8,
+	0x3c, 0xe0, 0x27, 0xe0, 0x31, 0xe0, 0x07, 0xe0, 0x19, 0x07, 0xfe, 0xc9, 0xb8, 0xe0, 0x1a, 0xc0,
+	0x30, 0xe0, 0x7f, 0x08, 0x22, 0xe0, 0x22, 0xe0, 0x22, 0xe0, 0x22, 0x1a, 0x30, 0xfe, 0xd8, 0xdd,
+	0x18, 0xda, 0x16, 0xe0, 0x07, 0xe0, 0x19, 0xe0, 0x07, 0xe0, 0x19, 0xe0, 0xa9, 0x99, 0x2d, 0xe7,
+	0xc0, 0x95, 0x99, 0x8b, 0x99, 0x8f, 0x88, 0x24, 0x05, 0x26, 0xe8, 0x82, 0xb9, 0xfe, 0x44, 0x60,
+	0x7f, 0xe0, 0x7f, 0xe0, 0x7b, 0xe0, 0x7f, 0x65, 0x09, 0x30, 0x09, 0x02, 0xc0, 0x56, 0x26, 0x55,
+	0x0c, 0x1e, 0x5a, 0x65, 0x30, 0x55, 0xc0, 0x34, 0x00, 0xec, 0xc0, 0xfe, 0x65, 0x80, 0x14, 0xc0,
+	0x02, 0xc0, 0x09, 0xe0, 0xa6, 0x67, 0x2d, 0xe7, 0xc0, 0x95, 0x99, 0x8b, 0x99, 0x0e, 0x24, 0xb3,
+	0x88, 0xb1, 0x99, 0xe8, 0x8b, 0x99, 0x98, 0x88, 0xa3, 0x99, 0xa3, 0x88, 0xa4, 0x88, 0xa3, 0x88,
+	0xa3, 0x99, 0xe0, 0xa3, 0x99, 0xa2, 0x77, 0xa2, 0x88, 0xe0, 0x35, 0xc0, 0x6e, 0xc0, 0x18, 0xc8,
+	0x87, 0x00, 0xc9, 0x26, 0xc0, 0x1f, 0xe0, 0x55, 0x66, 0x9d, 0x88, 0x66, 0xe7, 0x66, 0x0f, 0x01,
+	0xa3, 0x99, 0x6e, 0xe0, 0xc5, 0xfe, 0x38, 0xc6, 0xe7, 0xc0, 0xfe, 0xec, 0x8a, 0xe0, 0xc0, 0xe0,
+	0xc2, 0xe8, 0x9b, 0x99, 0xe0, 0xc7, 0xfe, 0x64, 0x60, 0x1a, 0xc0, 0x6b, 0x1a, 0x7b, 0x69, 0x6f,
+	0x08, 0x22, 0x08, 0x22, 0x08, 0x22, 0x1a, 0x30, 0x1a, 0xfe, 0x18, 0xe6, 0xfd, 0xc8, 0xfe, 0xb7,
+	0xbd, 0xe8, 0xcd, 0x03, 0xfe, 0x44, 0x58, 0xa0, 0xa8, 0xc0, 0x0c, 0xc0, 0xa1, 0xa9, 0xc0, 0x7f,
+	0x65, 0x7f, 0x30, 0x37, 0x30, 0x6b, 0xe0, 0xc0, 0x56, 0x14, 0xe0, 0xc0, 0x5a, 0xc0, 0x55, 0x1e,
+	0xe0, 0x00, 0xee, 0x14, 0x0c, 0x02, 0xc0, 0x7b, 0x02, 0x17, 0x02, 0xfe, 0xb7, 0xcd, 0xe8, 0xcd,
+	0x34, 0x86, 0x88, 0xa3, 0x99, 0xa3, 0x88, 0x2c, 0xe0, 0xa4, 0x88, 0xe0, 0x11, 0xa2, 0x77, 0x03,
+	0x6e, 0xa2, 0x88, 0xc0, 0x26, 0xc0, 0x18, 0x26, 0xe8, 0x91, 0x00, 0xca, 0xe0, 0xc0, 0xe0, 0x3c,
+	0x03, 0x55, 0xe8, 0xc0, 0x82, 0x99, 0x10, 0xa2, 0x88, 0xa2, 0x88, 0xe0, 0x07, 0xe0, 0x31, 0xe0,
+	0x07, 0xe0, 0xb8, 0x88, 0xe8, 0x94, 0xa9, 0xe0, 0x14, 0xc0, 0xeb, 0x3c, 0xe0, 0x31, 0xe0, 0x07,
+	0xe0, 0x19, 0xe0, 0x07, 0xe0, 0xc0, 0xfe, 0xa7, 0xa0, 0xa2, 0xa9, 0x08, 0x22, 0xe0, 0x7e, 0x56,
+	0x10, 0x30, 0x10, 0x30, 0x22, 0x08, 0x22, 0x1a, 0x6b, 0xfe, 0x18, 0xde, 0xfd, 0x19, 0xe0, 0x07,
+	0xe0, 0x19, 0xe0, 0x07, 0xe0, 0x19, 0x15, 0x35, 0xf5, 0x82, 0xb9, 0xfe, 0x45, 0x68, 0xe0, 0x0c,
+	0xc0, 0xa1, 0xa9, 0xc0, 0x7f, 0xc0, 0x37, 0xc0, 0x25, 0xe0, 0xc2, 0x55, 0x09, 0x02, 0xc0, 0x14,
+	0xc0, 0x66, 0x14, 0x0c, 0x00, 0xef, 0xfe, 0x43, 0x50, 0x02, 0xc0, 0x09, 0xe0, 0x37, 0x30, 0x09,
+	0xa8, 0x46, 0x35, 0xf5, 0x2c, 0x98, 0x88, 0x01, 0xa4, 0x88, 0xa3, 0x88, 0xa3, 0x99, 0xa3, 0x88,
+	0xa3, 0x99, 0xa2, 0x88, 0x3b, 0x34, 0x3c, 0xe0, 0x35, 0xe0, 0x18, 0xca, 0x80, 0x00, 0xc9, 0x66,
+	0xc0, 0x1f, 0xe0, 0x55, 0x34, 0xe9, 0x66, 0x85, 0x99, 0xa2, 0x77, 0xa2, 0x99, 0xa2, 0x77, 0xe0,
+	0xc6, 0x09, 0xe7, 0xc0, 0xfe, 0x0d, 0x93, 0x0c, 0xe0, 0x22, 0xea, 0x34, 0xe0, 0xc9, 0xfe, 0xa6,
+	0x88, 0xa2, 0xea, 0x55, 0x6f, 0x08, 0x10, 0x56, 0x10, 0x08, 0x22, 0x08, 0x22, 0x1a, 0xc0, 0x5a,
+	0xfe, 0x18, 0xe6, 0xfd, 0xc9, 0x01, 0xf4, 0x94, 0x99, 0xfe, 0x44, 0x60, 0xc0, 0xa1, 0xa9, 0xe0,
+	0x14, 0xe0, 0x7f, 0x66, 0x37, 0xc0, 0x7a, 0xc0, 0x6b, 0xe0, 0x25, 0xe0, 0xc0, 0x55, 0x09, 0x30,
+	0x17, 0x59, 0x09, 0x29, 0x00, 0xf0, 0xa1, 0xfa, 0xe0, 0x09, 0x30, 0x37, 0x66, 0x37, 0x30, 0x09,
+	0xfe, 0xb3, 0xbc, 0xf4, 0x97, 0x99, 0x8a, 0x88, 0xa3, 0x88, 0xa3, 0x99, 0xa3, 0x88, 0xa3, 0x99,
+	0xa3, 0x88, 0xa3, 0x99, 0xe0, 0xa3, 0x88, 0xe1, 0x6e, 0x1f, 0xc0, 0xe0, 0xc0, 0xea, 0xa9, 0x00,
+	0xca, 0xe0, 0xc0, 0xe0, 0xc0, 0xe0, 0x03, 0xe8, 0xc0, 0x86, 0x88, 0xa2, 0x99, 0xa2, 0x77, 0xa2,
+	0x99, 0x94, 0x77, 0xe1, 0x07, 0xe0, 0x19, 0xe0, 0x07, 0xba, 0x88, 0xe8, 0x93, 0xa9, 0x14, 0xc0,
+	0x7a, 0xc0, 0x6b, 0xe8, 0x3c, 0xe0, 0x07, 0xe0, 0x31, 0xe0, 0x07, 0xe0, 0x19, 0xe0, 0x07, 0xe0,
+	0xc0, 0xfe, 0x85, 0x68, 0xfe, 0x0a, 0xd1, 0xe0, 0x7a, 0x5a, 0x10, 0xc1, 0xe0, 0x10, 0x56, 0x22,
+	0xe0, 0x6b, 0x21, 0xfd, 0xa1, 0xc9, 0xa1, 0xa9, 0xa1, 0xda, 0xa1, 0xb9, 0xa1, 0xa9, 0x14, 0x09,
+	0x9f, 0x68, 0x14, 0x2d, 0x1c, 0xfe, 0x38, 0xc6, 0xf2, 0x9b, 0x99, 0xfe, 0x09, 0x72, 0x92, 0xea,
+	0x1e, 0x0c, 0x14, 0x7a, 0x7f, 0xc0, 0x0d, 0x69, 0x7f, 0xe0, 0x2c, 0x66, 0x2c, 0xe0, 0x2c, 0x25,
+	0x0d, 0x37, 0x25, 0x37, 0x0d, 0x00, 0x07, 0xe0, 0x31, 0xe0, 0x07, 0xea, 0x07, 0xe0, 0x31, 0x00,
+	0x3b, 0xe0, 0x37, 0xc0, 0x0d, 0xe0, 0xc0, 0xe0, 0xc0, 0xfe, 0x39, 0xde, 0xf2, 0x9d, 0x99, 0x86,
+	0x88, 0xc0, 0xa3, 0x99, 0xa3, 0x88, 0xa3, 0x99, 0xa3, 0x88, 0xa3, 0x99, 0x18, 0xa3, 0x88, 0x0a,
+	0xa3, 0x88, 0x6e, 0x2d, 0xe0, 0x7f, 0xc0, 0x6e, 0xca, 0xa0, 0x00, 0xc9, 0x26, 0xc0, 0x55, 0xc0,
+	0x51, 0xe0, 0x51, 0x0a, 0xe8, 0x88, 0x99, 0x33, 0xa3, 0x88, 0x7f, 0xa2, 0x88, 0xe1, 0xc5, 0xfe,
+	0xbb, 0xde, 0xe7, 0xc0, 0xfe, 0xec, 0x92, 0xe0, 0x66, 0xe0, 0xc0, 0xe8, 0x26, 0xe0, 0xc6, 0x31,
+	0x00, 0x31, 0xe0, 0xc0, 0x31, 0xfe, 0xea, 0xc8, 0xe0, 0xc0, 0x30, 0xe0, 0x30, 0x7e, 0x55, 0x6f,
+	0x1a, 0x6b, 0x2c, 0xfc, 0xfe, 0xcf, 0x9b, 0xfe, 0xa8, 0xa8, 0x59, 0x2c, 0x25, 0x0d, 0x25, 0x2c,
+	0x25, 0x2c, 0x25, 0xc0, 0x37, 0xa2, 0x77, 0xfe, 0x7a, 0xde, 0xf0, 0x26, 0xfe, 0xcb, 0x6a, 0xfe,
+	0x44, 0x70, 0x6f, 0xc0, 0x14, 0x66, 0xa1, 0xa8, 0xc0, 0x37, 0xc0, 0x7f, 0x25, 0x2c, 0x65, 0x2c,
+	0x3b, 0x2c, 0x25, 0x2c, 0x25, 0x2c, 0x3b, 0xfe, 0x64, 0x58, 0x00, 0xc5, 0xea, 0xc3, 0x1e, 0x37,
+	0xc0, 0x0d, 0x25, 0xc0, 0xe0, 0xc0, 0x30, 0xa2, 0x78, 0xfe, 0x9a, 0xde, 0xf0, 0x9d, 0x99, 0x89,
+	0x88, 0x9c, 0x99, 0xa3, 0x88, 0x3a, 0xa4, 0x88, 0xa2, 0x88, 0xa3, 0x99, 0xa3, 0x88, 0xa2, 0x88,
+	0xe0, 0xa2, 0x88, 0xe0, 0x3c, 0xe0, 0x35, 0x1f, 0xe0, 0xc0, 0xea, 0xaf, 0x00, 0xca, 0xe0, 0xc0,
+	0xe0, 0x2d, 0xe0, 0xc0, 0xe9, 0x8a, 0x88, 0xa2, 0x99, 0x6e, 0xa2, 0x88, 0x26, 0xfe, 0x82, 0x10,
+	0xe0, 0x19, 0xe0, 0x07, 0xe0, 0x19, 0xe0, 0xbf, 0x99, 0xe8, 0x06, 0xe0, 0x29, 0xe0, 0x7f, 0xe8,
+	0x3c, 0xe0, 0x6e, 0xe0, 0x07, 0xe0, 0x19, 0xe0, 0x07, 0x00, 0x07, 0x00, 0x07, 0xe0, 0x07, 0x00,
+	0xfe, 0x86, 0x70, 0xfe, 0xea, 0xd8, 0xa0, 0x57, 0xc1, 0x5a, 0x10, 0x56, 0x22, 0x55, 0xc0, 0xfc,
+	0x80, 0xf9, 0xfe, 0x87, 0x90, 0x7e, 0xc0, 0x3e, 0x65, 0x7f, 0x66, 0x2c, 0x3b, 0x2c, 0xe0, 0x0d,
+	0x37, 0x09, 0xfe, 0xd7, 0xcd, 0xee, 0x98, 0x88, 0xfe, 0x6a, 0x52, 0x00, 0xc0, 0xa1, 0xd9, 0xe0,
+	0x17, 0x37, 0x17, 0x25, 0xc0, 0x2c, 0x3b, 0x1a, 0xe0, 0x1a, 0xc0, 0x02, 0x1a, 0x30, 0x7a, 0x1a,
+	0x1c, 0x00, 0xc0, 0x07, 0xe0, 0x19, 0xe0, 0x07, 0xe0, 0x19, 0xe8, 0x07, 0xe0, 0x31, 0xe0, 0x07,
+	0xe0, 0xa2, 0xfa, 0x25, 0x2c, 0xe0, 0x2c, 0xe0, 0x2c, 0x25, 0xc0, 0x09, 0xc0, 0x3a, 0xee, 0x9a,
+	0x88, 0x8b, 0x99, 0x51, 0x01, 0xa2, 0x88, 0xa3, 0x99, 0xa3, 0x88, 0x26, 0xa2, 0x77, 0xa3, 0x99,
+	0x11, 0xa3, 0x88, 0x7f, 0x3c, 0x6e, 0x35, 0xc0, 0x6e, 0xc0, 0x18, 0xca, 0xa9, 0x00, 0xc9, 0x26,
+	0xc0, 0x1f, 0x35, 0xe0, 0x3c, 0x40, 0x3b, 0xe8, 0x8c, 0x99, 0x25, 0xa2, 0x88, 0x7f, 0xa2, 0x88,
+	0x24, 0xe0, 0xc6, 0x3b, 0xe7, 0xc0, 0xfe, 0xed, 0x9a, 0xfe, 0x86, 0x88, 0x7a, 0x02, 0xb2, 0x26,
+	0xe7, 0x9b, 0x99, 0xe0, 0xc6, 0x31, 0x00, 0x19, 0x00, 0x31, 0x00, 0x19, 0x00, 0xc0, 0xfe, 0x85,
+	0x70, 0xfe, 0xea, 0xd0, 0x59, 0x5a, 0x56, 0x22, 0x1a, 0xc1, 0xfe, 0x19, 0xe6, 0xfb, 0xfe, 0xd0,
+	0xab, 0xfe, 0xa7, 0x90, 0x17, 0xa1, 0xa8, 0xc0, 0x2c, 0x65, 0x2c, 0x13, 0x2c, 0x25, 0x2c, 0x45,
+	0xc0, 0x55, 0x17, 0x0b, 0xba, 0x38, 0xea, 0x3c, 0x8d, 0x88, 0x00, 0xc4, 0x2e, 0xa1, 0xa9, 0xa1,
+	0xfb, 0x02, 0x2c, 0xa0, 0xa8, 0x10, 0x66, 0x3e, 0x46, 0x22, 0x9f, 0x67, 0x9f, 0x58, 0xfe, 0x22,
+	0x28, 0x00, 0xc0, 0x31, 0xe1, 0xc6, 0xe8, 0x00, 0xc5, 0x1a, 0x25, 0x2c, 0x66, 0x2c, 0x25, 0x6f,
+	0xe0, 0x37, 0x55, 0xc0, 0x0b, 0xba, 0x48, 0xea, 0x9d, 0x99, 0x93, 0x88, 0x92, 0x99, 0x6e, 0xa3,
+	0x99, 0x3a, 0xa3, 0x88, 0xa2, 0x88, 0xa3, 0x99, 0xa2, 0x88, 0xa3, 0x88, 0xe0, 0x0a, 0xe0, 0x34,
+	0x6e, 0xe0, 0x6e, 0x7f, 0xc0, 0x18, 0xcb, 0x05, 0x01, 0xca, 0xe0, 0xc0, 0x1f, 0x35, 0xe0, 0x59,
+	0x51, 0x0a, 0x11, 0x55, 0x9d, 0x88, 0x17, 0x1e, 0x66, 0x55, 0x2d, 0xc0, 0xa2, 0x88, 0x17, 0xa2,
+	0x88, 0x02, 0x7f, 0x31, 0x07, 0xe0, 0x19, 0xe0, 0x07, 0xe0, 0x19, 0x00, 0x1b, 0xa1, 0xeb, 0xc0,
+	0x59, 0xc0, 0x14, 0x02, 0xc0, 0x17, 0x02, 0x7f, 0xe0, 0x37, 0x7a, 0xfe, 0x22, 0x28, 0x00, 0x07,
+	0x00, 0x31, 0x00, 0x07, 0x00, 0x31, 0xe0, 0x07, 0xe0, 0x19, 0xe0, 0x07, 0xe0, 0x07, 0x00, 0x07,
+	0x00, 0x07, 0x00, 0x07, 0x00, 0x07, 0xe0, 0x19, 0x00, 0x1c, 0xa2, 0xfa, 0x22, 0xa0, 0xa9, 0x7a,
+	0x49, 0x22, 0x1a, 0xc0, 0x2c, 0xc0, 0x3b, 0x37, 0x9e, 0x47, 0x9f, 0x47, 0x9e, 0x26, 0x00, 0xc0,
+	0x6b, 0x00, 0xc1, 0x27, 0x00, 0xc1, 0x27, 0x00, 0xa1, 0xc9, 0x0c, 0x1e, 0xc0, 0x26, 0x0c, 0x02,
+	0xc0, 0x09, 0x17, 0x37, 0xe0, 0x2c, 0x3b, 0x2c, 0xc0, 0x1a, 0xe0, 0x1a, 0x3b, 0x2c, 0x55, 0x6b,
+	0x09, 0xc0, 0x02, 0xb7, 0x05, 0xb2, 0x48, 0xaa, 0x67, 0x3c, 0xa3, 0x88, 0xe1, 0x9d, 0x99, 0x03,
+	0x97, 0x88, 0x08, 0x81, 0x88, 0x07, 0xe0, 0x31, 0xe0, 0x07, 0xe0, 0x31, 0x66, 0x07, 0x00, 0xc1,
+	0xa1, 0xa9, 0x2e, 0x23, 0x65, 0x35, 0x00, 0xc1, 0x07, 0xe0, 0x07, 0x00, 0x07, 0xe0, 0x07, 0xe0,
+	0x07, 0xe0, 0x19, 0xe0, 0x07, 0x00, 0x19, 0x00, 0x07, 0x00, 0x31, 0x00, 0x07, 0x00, 0x31, 0xe0,
+	0x07, 0xe0, 0x19, 0xe0, 0x19, 0xfe, 0x65, 0x68, 0x2c, 0xc0, 0x1a, 0xe0, 0x1a, 0x3b, 0x2c, 0x25,
+	0xc0, 0x4a, 0xc0, 0x02, 0x04, 0xb2, 0x47, 0xaa, 0x88, 0x3c, 0x26, 0xe1, 0x2d, 0x9d, 0x88, 0x17,
+	0x95, 0x99, 0x08, 0x7f, 0x01, 0x3a, 0x7f, 0xa3, 0x88, 0x7f, 0xa3, 0x88, 0x17, 0xa2, 0x88, 0xa2,
+	0x88, 0xa2, 0x88, 0xa2, 0x88, 0xa2, 0x88, 0x6e, 0x7f, 0x1f, 0x7f, 0xc0, 0x18, 0xcc, 0xb3, 0x00,
+	0xc9, 0x26, 0x18, 0xe0, 0xc0, 0x2d, 0xc0, 0x34, 0xc0, 0x3b, 0x55, 0xe0, 0x66, 0x40, 0x17, 0x55,
+	0x7b, 0x10, 0x17, 0xc0, 0xa2, 0x88, 0x6e, 0xa2, 0x88, 0xc0, 0xfe, 0xe8, 0x41, 0x00, 0xc7, 0x37,
+	0x55, 0x6b, 0xe0, 0xc1, 0x17, 0x59, 0x7f, 0x30, 0x37, 0x30, 0xe0, 0x00, 0xcd, 0x31, 0x00, 0x19,
+	0x00, 0x31, 0x00, 0x19, 0x00, 0x31, 0x00, 0x19, 0x00, 0x31, 0x00, 0xc1, 0x1c, 0xa0, 0xa9, 0xa2,
+	0xa9, 0x7a, 0x38, 0x0a, 0xc0, 0x3f, 0x46, 0x2e, 0x00, 0xcc, 0xfe, 0x64, 0x68, 0x0c, 0xc1, 0x6b,
+	0x0c, 0x14, 0xc0, 0x30, 0xc0, 0x37, 0xe1, 0xc0, 0x7f, 0x66, 0x1a, 0x2c, 0x1a, 0x3b, 0x2c, 0x65,
+	0x2c, 0x37, 0xc0, 0x17, 0x6e, 0x02, 0xc0, 0x0c, 0x34, 0x59, 0xc0, 0x0c, 0x9e, 0x06, 0x00, 0xcd,
+	0x6e, 0x00, 0x31, 0x00, 0x19, 0x00, 0x31, 0xe0, 0x19, 0x00, 0x31, 0x00, 0x19, 0x00, 0x31, 0x00,
+	0x31, 0x00, 0x31, 0x00, 0xd1, 0x3f, 0xfe, 0xc9, 0xc0, 0x1a, 0xc1, 0x2c, 0x1a, 0x13, 0x2c, 0xe0,
+	0x37, 0x30, 0x09, 0x00, 0xc8, 0xfe, 0xb2, 0x94, 0x3a, 0xc0, 0xa2, 0x88, 0xc0, 0xa3, 0x88, 0x25,
+	0xa2, 0x88, 0xa2, 0x88, 0x10, 0xa2, 0x88, 0xa2, 0x88, 0x6e, 0x03, 0xe0, 0x2d, 0xc0, 0x7f, 0xc0,
+	0xe0, 0xc0, 0xec, 0xf3, 0x00, 0xcc, 0xe0, 0x35, 0xe0, 0xc0, 0xe0, 0x03, 0x51, 0x02, 0x09, 0xc0,
+	0x10, 0xc0, 0x66, 0x10, 0xc0, 0x18, 0xc0, 0xa2, 0x88, 0x02, 0x0a, 0x34, 0xe1, 0x07, 0xe0, 0x19,
+	0xe0, 0x07, 0xe0, 0x31, 0x38, 0x2c, 0x37, 0xc0, 0x56, 0x37, 0xe0, 0x37, 0xc2, 0x3e, 0xfe, 0x43,
+	0x40, 0x19, 0xe0, 0x19, 0xe0, 0x07, 0xe0, 0x19, 0xe0, 0x07, 0xe0, 0x19, 0xe0, 0x07, 0xe0, 0x07,
+	0x00, 0x07, 0x00, 0x07, 0x00, 0x07, 0x00, 0x07, 0x00, 0x07, 0x00, 0x07, 0x00, 0x07, 0xe0, 0x07,
+	0x00, 0x07, 0x00, 0x19, 0x00, 0x07, 0x00, 0x19, 0x00, 0x07, 0xe0, 0x31, 0xe0, 0x07, 0xe0, 0x31,
+	0xe0, 0x07, 0xe0, 0x31, 0xe0, 0x7b, 0xa0, 0xa8, 0xfe, 0x86, 0x80, 0x0c, 0x14, 0x66, 0x14, 0xc0,
+	0x7a, 0xc0, 0x7f, 0xe0, 0x37, 0xc0, 0x3e, 0xe0, 0x2c, 0xc0, 0x1a, 0xc0, 0x6b, 0xe0, 0x02, 0x1a,
+	0xc0, 0xe0, 0xc0, 0x55, 0x0d, 0x37, 0x09, 0xe0, 0x29, 0x14, 0xc0, 0x0c, 0x14, 0x65, 0xa0, 0x58,
+	0xe0, 0x07, 0xe0, 0x6e, 0xe0, 0x07, 0xe0, 0x31, 0xe0, 0x07, 0xe0, 0x19, 0xe0, 0x07, 0x00, 0x07,
+	0x00, 0x07, 0x00, 0x07, 0x00, 0x07, 0x00, 0x07, 0x00, 0x07, 0x00, 0x07, 0x00, 0x07, 0x00, 0x07,
+	0x00, 0x07, 0xe0, 0x19, 0xe0, 0x07, 0xe0, 0x19, 0xe0, 0x07, 0xe0, 0x19, 0xe0, 0x07, 0xe0, 0x19,
+	0xe0, 0x07, 0xe0, 0x07, 0x00, 0x09, 0xe0, 0x7f, 0xe0, 0x7b, 0xe0, 0xc0, 0xe0, 0xc0, 0x25, 0x1a,
+	0xfe, 0x23, 0x48, 0x07, 0xe0, 0x31, 0xe0, 0x07, 0xe0, 0x31, 0xe0, 0x27, 0xac, 0x87, 0xbd, 0x88,
+	0xc0, 0x7f, 0xc0, 0xa2, 0x88, 0x7f, 0x26, 0x6e, 0x18, 0x6e, 0xa2, 0x88, 0x7f, 0x03, 0x6e, 0xa2,
+	0x88, 0xc0, 0x35, 0xc0, 0x6e, 0xc0, 0x6e, 0xcc, 0xb7, 0x00, 0xcb, 0x26, 0xc0, 0x55, 0x35, 0x40,
+	0x3c, 0xe0, 0xc0, 0x40, 0x02, 0x55, 0x09, 0x55, 0x09, 0x02, 0x09, 0xc0, 0xa2, 0x88, 0xc0, 0xa2,
+	0x88, 0xc0, 0x03, 0xfe, 0xc6, 0x31, 0x31, 0x00, 0x31, 0x00, 0x31, 0x00, 0xc2, 0xfe, 0x86, 0x88,
+	0xe1, 0xc3, 0x7a, 0xe0, 0x25, 0x13, 0x00, 0xcc, 0x31, 0x00, 0x31, 0x00, 0x31, 0x00, 0x19, 0x00,
+	0x31, 0x00, 0x19, 0x00, 0x31, 0x00, 0x19, 0x00, 0x31, 0x00, 0x19, 0x00, 0x31, 0x00, 0x31, 0x00,
+	0xce, 0x06, 0xfe, 0x86, 0x90, 0x46, 0x02, 0xe0, 0x02, 0xc0, 0x7b, 0xe0, 0x7f, 0x30, 0x37, 0xc0,
+	0x25, 0xc0, 0x7f, 0x66, 0x1a, 0xc0, 0x6b, 0x1a, 0xc1, 0x02, 0x2c, 0x1a, 0x3b, 0x2c, 0x25, 0xc0,
+	0x37, 0xc0, 0x30, 0xc0, 0x5a, 0xc0, 0xe0, 0x02, 0x14, 0x02, 0x00, 0xc9, 0x31, 0x00, 0x31, 0x00,
+	0x19, 0x00, 0x31, 0x00, 0x19, 0x00, 0x31, 0x00, 0x19, 0x00, 0x31, 0x00, 0x19, 0x00, 0x31, 0x00,
+	0x19, 0x00, 0x31, 0x00, 0xcd, 0x31, 0x00, 0x31, 0x9f, 0xc9, 0xfe, 0xea, 0xd0, 0x1a, 0x7b, 0x1a,
+	0xc2, 0x3b, 0x2c, 0x14, 0x00, 0xc8, 0xfe, 0x75, 0xad, 0x7b, 0x6e, 0x6e, 0x7f, 0x6e, 0x7f, 0x6e,
+	0xa2, 0x99, 0x6e, 0xa2, 0x88, 0x6e, 0xa2, 0x88, 0x7f, 0x3c, 0xe0, 0x1f, 0xc0, 0x7f, 0xc0, 0x6e,
+	0xcd, 0xee, 0x00, 0xcc, 0xe0, 0xc0, 0xe0, 0xc0, 0xe0, 0xc0, 0x34, 0x03, 0x55, 0x66, 0x02, 0xc0,
+	0x11, 0x02, 0xc0, 0x0a, 0x59, 0x3b, 0x2d, 0x7f, 0xc0, 0x3b, 0x00, 0x07, 0x00, 0x07, 0x00, 0x07,
+	0xe0, 0x07, 0xe0, 0x31, 0x1a, 0x3e, 0x65, 0x3e, 0x25, 0x2c, 0xe0, 0x2c, 0xc0, 0xfe, 0x43, 0x40,
+	0xe0, 0x19, 0xe0, 0x07, 0xe0, 0x19, 0xe0, 0x07, 0xe0, 0x19, 0xe0, 0x07, 0xe0, 0x07, 0x00, 0x07,
+	0x00, 0x07, 0x00, 0x07, 0x00, 0x07, 0x00, 0x07, 0x00, 0x07, 0x00, 0x07, 0x00, 0x07, 0x00, 0x07,
+	0x00, 0x07, 0x00, 0x07, 0x00, 0x07, 0xe0, 0x07, 0xe0, 0x19, 0xe0, 0x07, 0xe0, 0x19, 0xe0, 0x07,
+	0xe0, 0x31, 0xe1, 0xfe, 0x43, 0x50, 0x37, 0x45, 0x7f, 0x65, 0x09, 0x30, 0x37, 0x09, 0x37, 0xc0,
+	0x0d, 0x25, 0x3e, 0xe0, 0x2c, 0xc0, 0x1a, 0xc0, 0x7f, 0x1a, 0x22, 0x65, 0x22, 0x1a, 0x22, 0xe0,
+	0x6b, 0xe0, 0xc0, 0xe0, 0x3e, 0xe0, 0xc2, 0x56, 0x09, 0x30, 0x09, 0x30, 0x37, 0xe0, 0x07, 0xe0,
+	0x19, 0xe0, 0x07, 0xe0, 0x19, 0xe0, 0x07, 0x00, 0x07, 0x00, 0x07, 0x00, 0x07, 0x00, 0x07, 0x00,
+	0x07, 0x00, 0x07, 0x00, 0x07, 0x00, 0x07, 0x00, 0x07, 0x00, 0x07, 0x00, 0x07, 0x00, 0x07, 0xe0,
+	0x07, 0xe0, 0x07, 0xe0, 0x19, 0xe0, 0x07, 0xe0, 0x19, 0xe0, 0x07, 0xe0, 0x07, 0x00, 0x07, 0x00,
+	0x19, 0xfe, 0x86, 0x78, 0xfe, 0xe9, 0xc0, 0xe0, 0x22, 0x08, 0x22, 0xe0, 0xc0, 0x0d, 0x31, 0xe0,
+	0x19, 0xe0, 0x07, 0xe0, 0x19, 0xe0, 0x07, 0xe0, 0xb4, 0x88, 0xbb, 0x88, 0x7b, 0xc0, 0x6e, 0x6e,
+	0x7f, 0x6e, 0x7f, 0x6e, 0xa2, 0x99, 0x6e, 0x03, 0x34, 0x3c, 0x6e, 0x35, 0xe0, 0x7f, 0xc0, 0x18,
+	0xce, 0xc2, 0x00, 0xcb, 0x26, 0x18, 0xe0, 0xc0, 0x1f, 0x2d, 0x55, 0xc0, 0x34, 0x03, 0x3b, 0xc0,
+	0x55, 0x0a, 0x34, 0x3b, 0xc0, 0x03, 0x59, 0x7f, 0xc0, 0x3c, 0x26, 0x2b, 0x00, 0x19, 0x00, 0x31,
+	0x00, 0x31, 0x00, 0x31, 0x00, 0xa1, 0xda, 0x08, 0x2c, 0x25, 0x2c, 0x25, 0x2c, 0x66, 0x37, 0x00,
+	0xcb, 0x31, 0x00, 0x31, 0x00, 0x31, 0x00, 0x19, 0x00, 0x31, 0x00, 0x19, 0x00, 0x31, 0x00, 0x19,
+	0x00, 0x31, 0x00, 0x19, 0x00, 0x31, 0x00, 0x19, 0x00, 0x31, 0x00, 0x31, 0x00, 0xca, 0xfe, 0x44,
+	0x58, 0x0d, 0x45, 0x37, 0x66, 0x37, 0xc2, 0x25, 0xe0, 0x0d, 0x25, 0x2c, 0x25, 0x2c, 0x66, 0x1a,
+	0xc0, 0x7b, 0x1a, 0x22, 0x08, 0x22, 0x08, 0x22, 0x1a, 0x30, 0x1a, 0xc0, 0x3b, 0x2c, 0x25, 0x3e,
+	0x25, 0xc0, 0xe0, 0xc0, 0x05, 0x37, 0x17, 0x37, 0x05, 0x0d, 0x00, 0xc5, 0x31, 0x00, 0x31, 0x00,
+	0x19, 0x00, 0x31, 0x00, 0x19, 0x00, 0x31, 0x00, 0x19, 0x00, 0x31, 0x00, 0x19, 0x00, 0x31, 0x00,
+	0x19, 0x00, 0x31, 0x00, 0x19, 0x00, 0x31, 0x00, 0x31, 0x00, 0xc7, 0x31, 0x00, 0x19, 0x00, 0x31,
+	0x00, 0xc0, 0x1a, 0x22, 0x08, 0x22, 0x1a, 0xc0, 0x08, 0xfe, 0x21, 0x10, 0x00, 0xc8, 0xfe, 0x38,
+	0xc6, 0x10, 0xc2, 0xa2, 0x88, 0xc0, 0x11, 0x6e, 0x0a, 0x6e, 0x03, 0x34, 0x3c, 0x59, 0x1f, 0xc0,
+	0x7f, 0xc0, 0x18, 0x26, 0xee, 0xee, 0x00, 0xce, 0xe0, 0xc0, 0x1f, 0xc0, 0x66, 0x3c, 0x34, 0xc0,
+	0x03, 0xc0, 0x59, 0x03, 0x2d, 0x34, 0xc0, 0x3c, 0x59, 0x7f, 0xc0, 0x1f, 0x2d, 0x27, 0x00, 0x07,
+	0x00, 0x07, 0x00, 0x07, 0x00, 0x07, 0x00, 0xfe, 0x44, 0x50, 0xfe, 0xc9, 0xc0, 0x1a, 0xe0, 0x1a,
+	0xe0, 0xa1, 0xb9, 0x00, 0x07, 0xe0, 0x07, 0xe0, 0x07, 0xe0, 0x07, 0xe0, 0x07, 0xe0, 0x07, 0xe0,
+	0x07, 0x00, 0x07, 0x00, 0x07, 0x00, 0x07, 0x00, 0x07, 0x00, 0x07, 0x00, 0x07, 0x00, 0x07, 0x00,
+	0x07, 0x00, 0x07, 0x00, 0x07, 0x00, 0x07, 0x00, 0x07, 0x00, 0x07, 0x00, 0x07, 0xe0, 0x07, 0xe0,
+	0x19, 0xe0, 0x07, 0xe0, 0x19, 0xe0, 0x07, 0x38, 0x1a, 0x25, 0x3e, 0x25, 0x3e, 0x25, 0x2c, 0x25,
+	0x2c, 0xe0, 0x2c, 0x66, 0x2c, 0xc0, 0x1a, 0xc0, 0x6b, 0xe0, 0x22, 0xe0, 0x22, 0x30, 0x10, 0x30,
+	0x10, 0x30, 0x22, 0xe0, 0x22, 0xe0, 0x30, 0x1a, 0xc0, 0x2c, 0xc0, 0x3b, 0x2c, 0x25, 0x2c, 0x25,
+	0x3e, 0x25, 0x3e, 0xe0, 0x3e, 0xe0, 0x07, 0xe0, 0x19, 0xe0, 0x07, 0x00, 0x07, 0x00, 0x07, 0x00,
+	0x07, 0x00, 0x07, 0x00, 0x07, 0x00, 0x07, 0x00, 0x07, 0x00, 0x07, 0x00, 0x07, 0x00, 0x07, 0x00,
+	0x07, 0x00, 0x07, 0x00, 0x07, 0x00, 0x07, 0x00, 0xa2, 0xc9, 0xfe, 0x85, 0x70, 0x30, 0x1a, 0x6e,
+	0x1a, 0x02, 0x45, 0x38, 0x00, 0x07, 0x00, 0x07, 0x00, 0x07, 0xe0, 0x31, 0xe0, 0x13, 0x30, 0x22,
+	0x7a, 0xfe, 0x22, 0x28, 0x00, 0x07, 0xe0, 0x07, 0xe0, 0x19, 0xe0, 0x07, 0xe1, 0xfe, 0x51, 0x8c,
+	0x11, 0x09, 0x11, 0x59, 0x7f, 0xc0, 0x0a, 0x59, 0x7f, 0x6e, 0x7f, 0xc0, 0xa2, 0x88, 0xc0, 0x7f,
+	0xe0, 0x7f, 0xc0, 0x6e, 0xd0, 0xe1, 0x00, 0xcd, 0x26, 0xc2, 0xe0, 0xc0, 0x2d, 0xc0, 0x55, 0x3c,
+	0x34, 0x26, 0x34, 0x26, 0xe0, 0x3c, 0x26, 0x2d, 0xc0, 0x1f, 0xc0, 0x35, 0x90, 0x77, 0xe0, 0xc0,
+	0x19, 0x00, 0x31, 0x00, 0x19, 0x00, 0x31, 0x00, 0xfe, 0x43, 0x50, 0x1e, 0x10, 0x1e, 0x3e, 0x00,
+	0x31, 0x00, 0x31, 0x00, 0x31, 0x00, 0x31, 0x00, 0x31, 0x00, 0x31, 0x00, 0x31, 0x00, 0x19, 0x00,
+	0x31, 0x00, 0x19, 0x00, 0x31, 0x00, 0x19, 0x00, 0x31, 0x00, 0x19, 0x00, 0x31, 0x00, 0x19, 0x00,
+	0x31, 0x00, 0x19, 0x00, 0x31, 0x00, 0x19, 0x00, 0x31, 0x00, 0x31, 0x00, 0x31, 0x00, 0x31, 0x00,
+	0xc1, 0x27, 0x00, 0x1a, 0x25, 0x2c, 0x25, 0x2c, 0x65, 0x2c, 0x13, 0x2c, 0x66, 0x2c, 0x3b, 0x1a,
+	0xe0, 0x1a, 0xc2, 0x30, 0x1a, 0x22, 0x65, 0x10, 0x08, 0x10, 0x30, 0x10, 0x08, 0x22, 0x08, 0x30,
+	0x1a, 0xc2, 0xe0, 0xc0, 0x3b, 0x2c, 0x13, 0x2c, 0x13, 0x2c, 0x25, 0x2c, 0x1a, 0x9f, 0x58, 0x00,
+	0x31, 0x00, 0x31, 0x00, 0x31, 0x00, 0x19, 0x00, 0x31, 0x00, 0x19, 0x00, 0x31, 0x00, 0x19, 0x00,
+	0x31, 0x00, 0x19, 0x00, 0x31, 0x00, 0x19, 0x00, 0x31, 0x00, 0x19, 0x00, 0x31, 0x00, 0xc0, 0x26,
+	0x30, 0xc0, 0x10, 0x1a, 0xc1, 0x6b, 0x1a, 0x30, 0x1e, 0x30, 0x00, 0x2e, 0x00, 0x19, 0x00, 0x31,
+	0x00, 0xc0, 0xfe, 0x85, 0x70, 0xa2, 0xd9, 0x45, 0x23, 0x00, 0x31, 0x00, 0x31, 0x00, 0x31, 0x00,
+	0xc1, 0x19, 0x39, 0x0a, 0x55, 0x6e, 0x02, 0x0a, 0x34, 0x7f, 0xc0, 0x03, 0x59, 0x7f, 0x6e, 0x7f,
+	0xc0, 0x1f, 0xc0, 0x7f, 0xc0, 0x18, 0x26, 0xf0, 0xdf, 0x00, 0xd0, 0xe0, 0xc0, 0x35, 0xc0, 0xe0,
+	0xc2, 0x3c, 0x2d, 0x3c, 0x2d, 0xc0, 0x35, 0x1f, 0x26, 0x35, 0x26, 0xc1, 0x24, 0xe0, 0xc0, 0x07,
+	0x00, 0x07, 0x00, 0x07, 0x00, 0x07, 0x00, 0x07, 0xfe, 0x43, 0x50, 0x38, 0x00, 0x07, 0x00, 0x07,
+	0x00, 0x07, 0x00, 0x07, 0x00, 0x07, 0x00, 0x07, 0x00, 0x07, 0x00, 0x07, 0x00, 0x07, 0x00, 0x07,
+	0x00, 0x07, 0x00, 0x07, 0x00, 0x07, 0x00, 0x07, 0x00, 0x07, 0x00, 0x07, 0x00, 0x07, 0x00, 0x07,
+	0x00, 0x07, 0x00, 0x07, 0x00, 0x07, 0x00, 0x07, 0x00, 0x07, 0x00, 0x07, 0x00, 0x07, 0xe0, 0x07,
+	0x00, 0x2c, 0xe0, 0x6b, 0x1a, 0xc0, 0xe0, 0x02, 0x1a, 0xc1, 0x02, 0x1a, 0x02, 0xe0, 0x22, 0xe0,
+	0x22, 0xe0, 0x22, 0xe0, 0x7e, 0x30, 0x10, 0xc1, 0x22, 0x10, 0xc1, 0xe0, 0x10, 0xe0, 0x22, 0x08,
+	0x22, 0xe0, 0x22, 0x1a, 0x02, 0x1a, 0xc0, 0xe0, 0x02, 0x1a, 0xc1, 0x02, 0x1e, 0xfe, 0x64, 0x58,
+	0x00, 0x07, 0x00, 0x07, 0x00, 0x07, 0x00, 0x07, 0x00, 0x07, 0x00, 0x07, 0x00, 0x07, 0x00, 0x07,
+	0x00, 0x07, 0x00, 0x07, 0x00, 0x07, 0x00, 0x07, 0x00, 0x07, 0x00, 0x07, 0x00, 0x2d, 0x10, 0xa1,
+	0xa9, 0xe0, 0x22, 0x30, 0x22, 0x08, 0x22, 0x30, 0x22, 0x08, 0x22, 0xe0, 0x05, 0x31, 0x07, 0x00,
+	0x07, 0x00, 0x07, 0xe0, 0x31, 0x00, 0x31, 0x00, 0x07, 0x00, 0x07, 0x00, 0x07, 0x00, 0x07, 0xe0,
+	0x07, 0x00, 0xfe, 0xdb, 0xde, 0xa3, 0x88, 0x03, 0x2d, 0x03, 0x2d, 0x34, 0x03, 0x34, 0xc0, 0x3c,
+	0xc0, 0x6e, 0xc0, 0x35, 0xc0, 0x6e, 0xc0, 0x18, 0xd2, 0xd9, 0x00, 0xcf, 0x26, 0x18, 0xe0, 0xc0,
+	0x1f, 0x35, 0x1f, 0xc0, 0xe0, 0x1f, 0xe0, 0x1f, 0xe0, 0x35, 0x1f, 0x26, 0x35, 0x26, 0xc3, 0xfe,
+	0xa6, 0x31, 0x94, 0x99, 0x00, 0x19, 0x00, 0x31, 0x00, 0x19, 0x00, 0x31, 0x00, 0x19, 0x00, 0x31,
+	0x00, 0x19, 0x00, 0x31, 0x00, 0x19, 0x00, 0x31, 0x00, 0xc1, 0x31, 0x00, 0xc3, 0x19, 0x00, 0x31,
+	0x00, 0x19, 0x00, 0x31, 0x00, 0x19, 0x00, 0x31, 0x00, 0x19, 0x00, 0x31, 0x00, 0x19, 0x00, 0x31,
+	0x00, 0x19, 0x00, 0x31, 0x00, 0x19, 0x00, 0x31, 0x00, 0x19, 0x00, 0x31, 0x00, 0x31, 0x00, 0xfe,
+	0x85, 0x78, 0x08, 0x5b, 0x1a, 0xc1, 0x02, 0x1a, 0xc1, 0x30, 0x1a, 0x30, 0x1a, 0x30, 0x1a, 0x30,
+	0x08, 0x22, 0x08, 0x22, 0x30, 0x10, 0x30, 0xe0, 0x30, 0x10, 0x30, 0xe0, 0x30, 0x10, 0x08, 0x10,
+	0x08, 0x22, 0x08, 0x22, 0x1a, 0x30, 0x1a, 0xc1, 0x02, 0x1a, 0xc1, 0x30, 0x1a, 0xc0, 0x1e, 0xe0,
+	0xc0, 0x31, 0x00, 0x19, 0x00, 0x31, 0x00, 0x19, 0x00, 0x31, 0x00, 0x19, 0x00, 0x31, 0x00, 0x19,
+	0x00, 0x31, 0x00, 0x19, 0x00, 0x31, 0x00, 0x19, 0x00, 0xc1, 0x1a, 0xa1, 0xc9, 0xe0, 0x30, 0x10,
+	0x08, 0x22, 0x08, 0x22, 0x08, 0x22, 0x08, 0x22, 0x08, 0x10, 0x30, 0xa1, 0xb9, 0x00, 0x31, 0x00,
+	0x19, 0x00, 0x31, 0x00, 0x19, 0x00, 0x31, 0x00, 0x19, 0x00, 0x31, 0x00, 0x19, 0x00, 0x31, 0x00,
+	0xfe, 0xb6, 0xb5, 0x34, 0xc3, 0x6e, 0xe0, 0x3c, 0x26, 0x2d, 0xc0, 0x1f, 0xc0, 0x35, 0x1f, 0x7f,
+	0xc0, 0x18, 0x26, 0xf2, 0xda, 0x00, 0xd2, 0xe0, 0xc2, 0x35, 0x26, 0x35, 0x26, 0x35, 0x26, 0xe0,
+	0x26, 0xc0, 0x18, 0xe0, 0x18, 0xe0, 0x18, 0xe0, 0x34, 0x00, 0x07, 0x00, 0x07, 0x00, 0x07, 0x00,
+	0x07, 0x00, 0x07, 0x00, 0x07, 0x00, 0x07, 0x00, 0x07, 0x00, 0x07, 0x00, 0xc0, 0xfe, 0x23, 0x40,
+	0xfe, 0xc8, 0x98, 0xa0, 0xa8, 0xa1, 0xca, 0x59, 0x25, 0x10, 0x4a, 0x37, 0x9f, 0x37, 0x00, 0xc1,
+	0x07, 0x00, 0x07, 0x00, 0x07, 0x00, 0x07, 0x00, 0x07, 0x00, 0x07, 0x00, 0x07, 0x00, 0x07, 0x00,
+	0x07, 0x00, 0x07, 0x00, 0x07, 0x00, 0x07, 0x00, 0x07, 0x00, 0x07, 0x00, 0x07, 0x00, 0xc0, 0xfe,
+	0xe9, 0xb8, 0xc0, 0x30, 0x22, 0x08, 0x22, 0x30, 0x22, 0x08, 0x22, 0xe0, 0x22, 0x08, 0x22, 0xe0,
+	0x22, 0xe0, 0x10, 0x30, 0x10, 0xe0, 0x10, 0xc2, 0x6b, 0xe0, 0xc4, 0x22, 0x10, 0xe0, 0x10, 0x30,
+	0x10, 0xe0, 0x22, 0x08, 0x22, 0x30, 0x22, 0x08, 0x22, 0xe0, 0x22, 0x08, 0x10, 0x09, 0xe0, 0xc0,
+	0x07, 0x00, 0x07, 0x00, 0x07, 0x00, 0x07, 0x00, 0x07, 0x00, 0x07, 0x00, 0x07, 0x00, 0x07, 0x00,
+	0x07, 0x00, 0x07, 0x00, 0x07, 0x00, 0x31, 0xfe, 0x64, 0x58, 0x05, 0x10, 0xc4, 0xe0, 0x10, 0x30,
+	0x10, 0x30, 0x10, 0xe0, 0x10, 0x22, 0x10, 0x7a, 0x9e, 0x17, 0x00, 0x07, 0x00, 0x07, 0x00, 0x07,
+	0x00, 0x07, 0x00, 0x07, 0x00, 0x07, 0x00, 0x07, 0x00, 0x07, 0x00, 0xfe, 0x31, 0x8c, 0xbb, 0x88,
+	0xc0, 0x3c, 0x2d, 0x3c, 0x2d, 0xc2, 0x1f, 0xc0, 0x35, 0xc0, 0x26, 0xc0, 0x6e, 0xe0, 0x18, 0xd4,
+	0xd5, 0x00, 0xd1, 0x26, 0x18, 0xe2, 0xc2, 0x35, 0x26, 0xc2, 0x18, 0x26, 0x18, 0x26, 0x18, 0x26,
+	0x18, 0x26, 0x96, 0x88, 0x00, 0x31, 0x00, 0x19, 0x00, 0x31, 0x00, 0x19, 0x00, 0x31, 0x00, 0x19,
+	0x00, 0x31, 0x00, 0x19, 0x00, 0xa1, 0xfb, 0x1a, 0x05, 0x30, 0x10, 0x30, 0xe0, 0x30, 0xe0, 0x30,
+	0x10, 0x3e, 0x13, 0x9e, 0x26, 0x38, 0x00, 0xc1, 0x19, 0x00, 0x31, 0x00, 0x19, 0x00, 0x31, 0x00,
+	0x19, 0x00, 0x31, 0x00, 0x19, 0x00, 0x31, 0x00, 0x19, 0x00, 0x31, 0x00, 0x19, 0x00, 0x31, 0x00,
+	0x19, 0x00, 0xc0, 0xfe, 0x86, 0x88, 0x10, 0x08, 0x22, 0x08, 0x22, 0x08, 0x22, 0x08, 0x22, 0x08,
+	0x22, 0x08, 0x22, 0x08, 0x22, 0x30, 0x10, 0x08, 0x10, 0x30, 0x10, 0x30, 0xe0, 0x1e, 0xe0, 0xc3,
+	0x1e, 0xe0, 0x1e, 0x10, 0x30, 0x10, 0x30, 0x10, 0x08, 0x22, 0x08, 0x22, 0x08, 0x22, 0x08, 0x22,
+	0x08, 0x22, 0x08, 0x10, 0x08, 0x25, 0xe0, 0x19, 0x00, 0x31, 0x00, 0x19, 0x00, 0x31, 0x00, 0x19,
+	0x00, 0x31, 0x00, 0x19, 0x00, 0x31, 0x00, 0x19, 0x00, 0x31, 0x00, 0x19, 0x00, 0xc0, 0x37, 0xa3,
+	0xfa, 0x10, 0xc0, 0x1e, 0xe0, 0x30, 0xe0, 0x30, 0x10, 0x30, 0x10, 0x30, 0x10, 0x30, 0x10, 0x30,
+	0x10, 0x30, 0x10, 0x3e, 0xe0, 0xc0, 0x31, 0x00, 0x19, 0x00, 0x31, 0x00, 0x19, 0x00, 0x31, 0x00,
+	0x19, 0x00, 0x31, 0xc0, 0xb8, 0x88, 0x1f, 0xc0, 0xe0, 0x1f, 0xe0, 0x1f, 0xe0, 0x35, 0xe0, 0x35,
+	0xe0, 0x26, 0x1f, 0x26, 0xc2, 0x18, 0xd5, 0xaf, 0x00, 0xd6, 0xe0, 0x18, 0xe0, 0x18, 0xe0, 0x18,
+	0xe0, 0x18, 0xc8, 0xfe, 0xcf, 0x7b, 0x00, 0x07, 0x00, 0x07, 0x00, 0x07, 0x00, 0x07, 0x00, 0x07,
+	0x00, 0x07, 0x00, 0x07, 0x00, 0x31, 0x13, 0x10, 0xca, 0x25, 0x33, 0x10, 0xfe, 0x44, 0x60, 0xe0,
+	0xc0, 0x07, 0x00, 0x07, 0x00, 0x07, 0x00, 0x07, 0x00, 0x07, 0x00, 0x07, 0x00, 0x07, 0x00, 0x07,
+	0x00, 0x07, 0x00, 0x07, 0x00, 0x07, 0x00, 0x07, 0x00, 0x07, 0xe0, 0x25, 0x22, 0x10, 0xe0, 0x10,
+	0xe0, 0x10, 0xe0, 0x10, 0xe0, 0x10, 0xe0, 0x10, 0xc1, 0xe0, 0x10, 0xc6, 0x25, 0xe2, 0x25, 0xe0,
+	0xc1, 0x6b, 0xe0, 0xc4, 0xe0, 0x10, 0xe0, 0x10, 0xe0, 0x10, 0xe0, 0x10, 0xe0, 0x10, 0xc2, 0x9e,
+	0x37, 0x00, 0x07, 0x00, 0x07, 0x00, 0x07, 0x00, 0x07, 0x00, 0x07, 0x00, 0x07, 0x00, 0x07, 0x00,
+	0x07, 0x00, 0x07, 0x00, 0x07, 0x00, 0x23, 0x22, 0xa1, 0xa9, 0x10, 0x3e, 0xe0, 0x25, 0xe0, 0xc1,
+	0x37, 0xe0, 0xc5, 0x37, 0xe0, 0xc1, 0x25, 0xfe, 0x65, 0x60, 0x07, 0x00, 0x07, 0x00, 0x07, 0x00,
+	0x07, 0x00, 0x07, 0x00, 0x07, 0x00, 0x07, 0x00, 0xc0, 0x26, 0xc0, 0x35, 0x26, 0x35, 0x26, 0x35,
+	0x26, 0xe0, 0x26, 0xc2, 0x18, 0xe0, 0x18, 0xd8, 0xaa, 0x00, 0xd5, 0x26, 0x18, 0x26, 0x18, 0x26,
+	0x18, 0x26, 0x18, 0xc9, 0x8d, 0x99, 0xe0, 0xc0, 0x31, 0x00, 0x19, 0x00, 0x31, 0x00, 0x19, 0x00,
+	0x31, 0x00, 0x19, 0x00, 0xc0, 0x13, 0x10, 0x1e, 0xe0, 0x1e, 0xe0, 0x1e, 0xe0, 0x1e, 0xe0, 0x1e,
+	0xe2, 0xc2, 0x33, 0x2c, 0xfe, 0x22, 0x20, 0x00, 0x19, 0x00, 0x31, 0x00, 0x19, 0x00, 0x31, 0x00,
+	0x19, 0x00, 0x31, 0x00, 0x19, 0x00, 0x31, 0x00, 0x19, 0x00, 0x31, 0x00, 0x19, 0x00, 0x31, 0x00,
+	0x02, 0x10, 0xc0, 0x30, 0x10, 0x30, 0x10, 0x30, 0x10, 0x30, 0x10, 0x30, 0x10, 0x30, 0xe0, 0x30,
+	0x10, 0x30, 0xe0, 0x1e, 0xe0, 0x1e, 0xe2, 0xc9, 0x1e, 0xe0, 0x1e, 0xe0, 0x1e, 0x10, 0x30, 0x10,
+	0x30, 0x10, 0x30, 0x10, 0x30, 0x10, 0x30, 0xe0, 0x1e, 0xe0, 0x3e, 0xe0, 0xc0, 0x19, 0x00, 0x31,
+	0x00, 0x19, 0x00, 0x31, 0x00, 0x19, 0x00, 0x31, 0x00, 0x19, 0x00, 0x31, 0x00, 0x19, 0x00, 0xa1,
+	0xea, 0x13, 0x10, 0xc7, 0x1e, 0xe0, 0x1e, 0xe0, 0x1e, 0xe0, 0x1e, 0xe0, 0xc4, 0x3e, 0x00, 0x19,
+	0x00, 0x31, 0x00, 0x19, 0x00, 0x31, 0x00, 0x19, 0x00, 0x31, 0x00, 0x19, 0x39, 0xe1, 0xc9, 0x18,
+	0x26, 0x18, 0x26, 0xf8, 0xaa, 0x00, 0xdf, 0xc7, 0x0a, 0xe0, 0x07, 0x00, 0x07, 0x00, 0x07, 0x00,
+	0x07, 0x00, 0x07, 0x00, 0x07, 0x00, 0x07, 0xfe, 0x85, 0x78, 0xfe, 0xea, 0xc8, 0xe0, 0xc1, 0x25,
+	0xe0, 0xc1, 0x25, 0xe0, 0xc1, 0x25, 0xe0, 0x7a, 0xe0, 0x25, 0x10, 0xc0, 0xa1, 0xc9, 0xfe, 0xa6,
+	0x80, 0x00, 0x07, 0x00, 0x07, 0x00, 0x07, 0x00, 0x07, 0x00, 0x07, 0x00, 0x07, 0x00, 0x07, 0x00,
+	0x07, 0x00, 0x07, 0x00, 0x07, 0x00, 0x07, 0x00, 0xc0, 0x10, 0xc1, 0x37, 0xe0, 0xc5, 0x37, 0xe0,
+	0xc1, 0x37, 0xe0, 0xc1, 0x25, 0xe0, 0xc1, 0x25, 0xe0, 0x3e, 0xe0, 0x25, 0xe0, 0x25, 0xe0, 0x25,
+	0xe0, 0x3e, 0xe0, 0x25, 0xe0, 0xc1, 0x37, 0xe0, 0xc9, 0x37, 0xe0, 0xa1, 0xa9, 0x19, 0x07, 0x00,
+	0x07, 0x00, 0x07, 0x00, 0x07, 0x00, 0x07, 0x00, 0x07, 0x00, 0x07, 0x00, 0x07, 0x00, 0x07, 0x00,
+	0xfe, 0x44, 0x50, 0x33, 0x25, 0xe0, 0x25, 0xe0, 0x25, 0xe0, 0x25, 0xe0, 0x25, 0xe0, 0xc1, 0x25,
+	0xe0, 0xc1, 0x25, 0xe2, 0x25, 0xe0, 0x25, 0x33, 0x31, 0x00, 0x07, 0x00, 0x07, 0x00, 0x07, 0x00,
+	0x07, 0x00, 0x07, 0x00, 0x07, 0x00, 0x01, 0x18, 0xc2, 0xe0, 0x18, 0xe0, 0x18, 0xe0, 0x18, 0xde,
+	0x74, 0x00, 0xdf, 0xc7, 0x26, 0xe0, 0xc0, 0x19, 0x00, 0x31, 0x00, 0x19, 0x00, 0x31, 0x00, 0x19,
+	0x00, 0x31, 0x00, 0x33, 0x10, 0xd1, 0x3e, 0x10, 0xc0, 0x3f, 0xe0, 0xc0, 0x31, 0x00, 0x19, 0x00,
+	0x31, 0x00, 0x19, 0x00, 0x31, 0x00, 0x19, 0x00, 0x31, 0x00, 0x19, 0x00, 0x31, 0x00, 0x19, 0xe0,
+	0x3e, 0xe1, 0xc1, 0x1e, 0xe0, 0x1e, 0xe0, 0x1e, 0xe0, 0xdf, 0x1e, 0xe0, 0x1e, 0xe0, 0x1e, 0xe2,
+	0xc2, 0x9f, 0x58, 0x00, 0x31, 0x00, 0x19, 0x00, 0x31, 0x00, 0x19, 0x00, 0x31, 0x00, 0x19, 0x00,
+	0x31, 0x00, 0x19, 0x00, 0xfe, 0x64, 0x50, 0x21, 0x10, 0xd6, 0x25, 0xfe, 0x64, 0x60, 0x31, 0x00,
+	0x19, 0x00, 0x31, 0x00, 0x19, 0x00, 0x31, 0x00, 0x19, 0x00, 0xc0, 0xfe, 0xd7, 0xbd, 0xe2, 0x26,
+	0x18, 0x26, 0x18, 0x26, 0x18, 0xdf, 0xb1, 0x00, 0xdf, 0xc8, 0x39, 0x07, 0x00, 0x07, 0x00, 0x07,
+	0x00, 0x07, 0x00, 0x07, 0x00, 0x07, 0x00, 0xa2, 0xa9, 0xfe, 0xe9, 0xc8, 0x25, 0xe0, 0x25, 0xe0,
+	0x3e, 0xe0, 0x25, 0xe0, 0x3e, 0xe0, 0x25, 0xe0, 0x25, 0xe0, 0x25, 0xe0, 0x25, 0xe0, 0x25, 0x10,
+	0x25, 0xe0, 0xa2, 0xc9, 0xfe, 0x84, 0x60, 0x31, 0x00, 0x07, 0x00, 0x07, 0x00, 0x07, 0x00, 0x07,
+	0x00, 0x07, 0x00, 0x07, 0x00, 0x07, 0x00, 0x07, 0x00, 0x07, 0x00, 0xfe, 0x64, 0x58, 0x10, 0x25,
+	0xe2, 0x25, 0xe0, 0xc1, 0x25, 0xe2, 0x25, 0xe2, 0x25, 0xe0, 0x3e, 0xe0, 0x25, 0xe0, 0x25, 0xe0,
+	0x25, 0xe0, 0x25, 0xe0, 0x25, 0xe0, 0x25, 0xe0, 0x25, 0xe0, 0x25, 0xe0, 0x25, 0xe2, 0x25, 0xe0,
+	0xc1, 0x25, 0xe0, 0xc1, 0x25, 0xe2, 0x25, 0x3e, 0xe0, 0xc0, 0x07, 0x00, 0x07, 0x00, 0x07, 0x00,
+	0x07, 0x00, 0x07, 0x00, 0x07, 0x00, 0x07, 0x00, 0xfe, 0x85, 0x70, 0x33, 0x25, 0xe0, 0x25, 0xe0,
+	0x25, 0xe0, 0x25, 0xe0, 0x25, 0xe0, 0x25, 0xe0, 0x25, 0xe0, 0x25, 0xe0, 0x25, 0xe0, 0x25, 0xe0,
+	0x25, 0xe0, 0x25, 0xe0, 0x25, 0x59, 0xa0, 0x57, 0x00, 0x07, 0x00, 0x07, 0x00, 0x07, 0x00, 0x07,
+	0x00, 0x07, 0x00, 0x07, 0xe0, 0x3b, 0xe2, 0xdf, 0xc5, 0x6f, 0x00, 0xdf, 0xc8, 0x89, 0x99, 0x00,
+	0x31, 0x00, 0x19, 0x00, 0x31, 0x00, 0x19, 0x00, 0x31, 0x00, 0x19, 0xfe, 0xa6, 0x88, 0xe0, 0x10,
+	0xcf, 0x3e, 0x10, 0xc1, 0x3e, 0x10, 0x05, 0xfe, 0x86, 0x78, 0xe0, 0xc0, 0x31, 0x00, 0x19, 0x00,
+	0x31, 0x00, 0x19, 0x00, 0x31, 0x00, 0x19, 0x00, 0x31, 0x00, 0x19, 0x00, 0x31, 0xfe, 0xa7, 0x98,
+	0x25, 0x10, 0xd5, 0x3e, 0x10, 0xc1, 0x3e, 0x10, 0xc1, 0x3e, 0x10, 0xd3, 0x05, 0xe0, 0x19, 0x00,
+	0x31, 0x00, 0x19, 0x00, 0x31, 0x00, 0x19, 0x00, 0x31, 0x00, 0x19, 0x00, 0x02, 0xfe, 0xea, 0xd8,
+	0x3e, 0x10, 0xc1, 0x3e, 0x10, 0xc1, 0x3e, 0x10, 0xd0, 0x3e, 0xe0, 0xc0, 0x31, 0x00, 0x19, 0x00,
+	0x31, 0x00, 0x19, 0x00, 0x31, 0x00, 0xc0, 0x18, 0xdf, 0xc8, 0xb7, 0x00, 0xdf, 0xc8, 0x0a, 0xe0,
+	0xc0, 0x07, 0x00, 0x07, 0x00, 0x07, 0x00, 0x07, 0x00, 0x07, 0x00, 0x25, 0x10, 0x25, 0xe0, 0x25,
+	0xe0, 0x25, 0xe0, 0x25, 0xe0, 0x25, 0xe0, 0x25, 0xe0, 0x25, 0xe0, 0x25, 0xe0, 0x25, 0x10, 0x25,
+	0xe0, 0x25, 0x10, 0x25, 0x10, 0x05, 0x37, 0xe0, 0xc0, 0x07, 0x00, 0x07, 0x00, 0x07, 0x00, 0x07,
+	0x00, 0x07, 0x00, 0x07, 0x00, 0x07, 0x00, 0x07, 0x00, 0x22, 0x3e, 0x25, 0xe0, 0x25, 0xe0, 0x25,
+	0xe0, 0x25, 0xe0, 0x25, 0xe0, 0x25, 0xe0, 0x25, 0xe0, 0x25, 0xe0, 0x25, 0xe0, 0x25, 0xe0, 0x25,
+	0xe0, 0x25, 0x10, 0x25, 0xe0, 0x25, 0x10, 0x25, 0xe0, 0x25, 0x10, 0x25, 0xe0, 0x25, 0xe0, 0x25,
+	0xe0, 0x25, 0xe0, 0x25, 0xe0, 0x25, 0xe0, 0x25, 0xe0, 0x25, 0xe0, 0x25, 0xe0, 0x25, 0xe0, 0x25,
+	0x3e, 0xfe, 0x42, 0x00, 0x00, 0x07, 0x00, 0x07, 0x00, 0x07, 0x00, 0x07, 0x00, 0x07, 0x00, 0x07,
+	0x00, 0xa2, 0xfa, 0x05, 0x25, 0x10, 0x25, 0xe0, 0x25, 0x10, 0x25, 0xe0, 0x25, 0x10, 0x25, 0xe0,
+	0x25, 0xe0, 0x25, 0xe0, 0x25, 0xe0, 0x25, 0xe0, 0x25, 0xe0, 0x25, 0xe0, 0x25, 0xe0, 0x25, 0xe0,
+	0xa1, 0xba, 0xe0, 0x07, 0x00, 0x07, 0x00, 0x07, 0x00, 0x07, 0x00, 0x07, 0x00, 0xc0, 0xfe, 0x55,
+	0xad, 0xfd, 0xcb, 0x7c, 0x00, 0xdf, 0xc9, 0xe0, 0x19, 0x00, 0x31, 0x00, 0x19, 0x00, 0x31, 0x00,
+	0x19, 0x00, 0xc0, 0x01, 0x3e, 0x10, 0xc1, 0x3e, 0x10, 0xc5, 0x3e, 0x10, 0xc1, 0x3e, 0x10, 0xc1,
+	0x3e, 0x10, 0xc1, 0x3e, 0x10, 0x3e, 0x9f, 0x68, 0x31, 0x00, 0x31, 0x00, 0x19, 0x00, 0x31, 0x00,
+	0x19, 0x00, 0x31, 0x00, 0x19, 0x00, 0x31, 0x00, 0xc0, 0xfe, 0xe9, 0xd0, 0x10, 0xd4, 0x3e, 0x10,
+	0xc1, 0x3e, 0x10, 0xc1, 0x3e, 0x10, 0xc1, 0x3e, 0x10, 0xd1, 0x25, 0xfe, 0x63, 0x48, 0x31, 0x00,
+	0x19, 0x00, 0x31, 0x00, 0x19, 0x00, 0x31, 0x00, 0x19, 0x00, 0x1c, 0x01, 0x3e, 0x10, 0xc1, 0x3e,
+	0x10, 0xc1, 0x3e, 0x10, 0xc1, 0x3e, 0x10, 0xc1, 0x3e, 0x10, 0xc5, 0x3e, 0x10, 0xc1, 0x3e, 0x13,
+	0xe0, 0xc0, 0x19, 0x00, 0x31, 0x00, 0x19, 0x00, 0x31, 0x00, 0x19, 0xe0, 0xfe, 0x39, 0xce, 0xfd,
+	0xcb, 0xba, 0x00, 0xdf, 0xc9, 0x8b, 0x99, 0x00, 0x07, 0x00, 0x07, 0x00, 0x07, 0x00, 0x07, 0x00,
+	0x07, 0xe0, 0xfe, 0x0a, 0xd9, 0x10, 0x25, 0xe0, 0x25, 0x10, 0x25, 0xe0, 0x25, 0xe0, 0x25, 0xe0,
+	0x25, 0x10, 0x25, 0xe0, 0x25, 0x10, 0x25, 0xe0, 0x25, 0x10, 0x25, 0xe0, 0x25, 0x10, 0x25, 0x10,
+	0x25, 0x10, 0x31, 0x00, 0x07, 0x00, 0x07, 0x00, 0x07, 0x00, 0x07, 0x00, 0x07, 0x00, 0x07, 0x00,
+	0x07, 0xe0, 0x33, 0xe0, 0x25, 0xe0, 0x25, 0xe0, 0x25, 0xe0, 0x25, 0xe0, 0x25, 0xe0, 0x25, 0xe0,
+	0x25, 0xe0, 0x25, 0xe0, 0x25, 0xe0, 0x25, 0xe0, 0x25, 0x10, 0x25, 0xe0, 0x25, 0x10, 0x25, 0xe0,
+	0x25, 0x10, 0x25, 0xe0, 0x25, 0x10, 0x25, 0xe0, 0x25, 0xe0, 0x25, 0xe0, 0x25, 0xe0, 0x25, 0xe0,
+	0x25, 0xe0, 0x25, 0xe0, 0x25, 0xe0, 0x25, 0xe0, 0x25, 0x3e, 0x9e, 0x06, 0x00, 0x07, 0x00, 0x07,
+	0x00, 0x07, 0x00, 0x07, 0x00, 0x07, 0x00, 0x1c, 0xfe, 0x0a, 0xd1, 0x25, 0x10, 0x25, 0xe0, 0x25,
+	0x10, 0x25, 0xe0, 0x25, 0x10, 0x25, 0xe0, 0x25, 0x10, 0x25, 0xe0, 0x25, 0x10, 0x25, 0xe0, 0x25,
+	0xe0, 0x25, 0xe0, 0x25, 0x10, 0x25, 0xe0, 0x25, 0x10, 0x17, 0xfe, 0x42, 0x28, 0x07, 0x00, 0x07,
+	0x00, 0x07, 0x00, 0x07, 0x00, 0x07, 0x00, 0xc0, 0xfe, 0xff, 0xff, 0xdf, 0xc9, 0x99, 0x00, 0xdf,
+	0xc9, 0x94, 0x88, 0xe0, 0xc0, 0x19, 0x00, 0x31, 0x00, 0x19, 0x00, 0x31, 0x00, 0xa2, 0x98, 0x3e,
+	0xe0, 0xc0, 0x3e, 0x10, 0xc1, 0x3e, 0x10, 0xc1, 0x3e, 0x10, 0xc1, 0x3e, 0x10, 0xc1, 0x3e, 0x10,
+	0xc1, 0x3e, 0x10, 0xc1, 0x3e, 0x10, 0xc0, 0x1a, 0xe0, 0xc0, 0x31, 0x00, 0x19, 0x00, 0x31, 0x00,
+	0x19, 0x00, 0x31, 0x00, 0x19, 0x00, 0xc0, 0x3e, 0xc0, 0x10, 0xc1, 0x3e, 0x10, 0xc1, 0x3e, 0x10,
+	0xc1, 0x3e, 0x10, 0xc1, 0x3e, 0x10, 0xc1, 0x3e, 0x10, 0xc1, 0x3e, 0x10, 0xc1, 0x3e, 0x10, 0xc1,
+	0x3e, 0x10, 0xc1, 0x3e, 0x10, 0xc1, 0x3e, 0x10, 0xc1, 0x3e, 0x10, 0xc1, 0x3e, 0x10, 0xc1, 0x3e,
+	0x10, 0x25, 0x9d, 0x06, 0xe0, 0xc0, 0x31, 0x00, 0x19, 0x00, 0x31, 0x00, 0x19, 0x00, 0x31, 0x13,
+	0x10, 0xc2, 0x3e, 0x10, 0xc1, 0x3e, 0x10, 0xc1, 0x3e, 0x10, 0xc1, 0x3e, 0x10, 0xc1, 0x3e, 0x10,
+	0xc1, 0x3e, 0x10, 0xc1, 0x3e, 0x10, 0xc1, 0xfe, 0x42, 0x20, 0x00, 0x31, 0x00, 0x19, 0x00, 0x31,
+	0x00, 0x19, 0x00, 0x31, 0xbc, 0x88, 0xfd, 0xcc, 0xb1, 0x00, 0xdf, 0xca, 0xe0, 0x07, 0x00, 0x07,
+	0x00, 0x07, 0x00, 0x07, 0x00, 0x07, 0xe0, 0x05, 0xe0, 0x25, 0x10, 0x25, 0xe0, 0x25, 0x10, 0x25,
+	0xe0, 0x25, 0x10, 0x25, 0xe0, 0x25, 0x10, 0x25, 0xe0, 0x25, 0x10, 0x25, 0xe0, 0x25, 0x10, 0x25,
+	0xe0, 0x25, 0x10, 0x25, 0xe0, 0x17, 0x30, 0xe0, 0xc0, 0x07, 0x00, 0x07, 0x00, 0x07, 0x00, 0x07,
+	0x00, 0x07, 0x00, 0x07, 0xe0, 0x05, 0x10, 0x25, 0xe0, 0x25, 0x10, 0x25, 0xe0, 0x25, 0x10, 0x25,
+	0xe0, 0x25, 0x10, 0x25, 0xe0, 0x25, 0x10, 0x25, 0xe0, 0x25, 0x10, 0x25, 0xe0, 0x25, 0x10, 0x25,
+	0xe0, 0x25, 0x10, 0x25, 0xe0, 0x25, 0x10, 0x25, 0xe0, 0x25, 0x10, 0x25, 0xe0, 0x25, 0x10, 0x25,
+	0xe0, 0x25, 0x10, 0x25, 0xe0, 0x25, 0x10, 0x25, 0xe0, 0x25, 0x10, 0x25, 0x3e, 0x9e, 0x06, 0xe0,
+	0x07, 0x00, 0x07, 0x00, 0x07, 0x00, 0x07, 0x00, 0xc0, 0x3e, 0x25, 0xe0, 0x25, 0xe0, 0x25, 0x10,
+	0x25, 0xe0, 0x25, 0x10, 0x25, 0xe0, 0x25, 0x10, 0x25, 0xe0, 0x25, 0x10, 0x25, 0xe0, 0x25, 0x10,
+	0x25, 0xe0, 0x25, 0x10, 0x25, 0xe0, 0x25, 0x10, 0x25, 0xe0, 0x25, 0x2d, 0x07, 0x00, 0x07, 0x00,
+	0x07, 0x00, 0x07, 0x00, 0x07, 0x00, 0xfe, 0x7a, 0xd6, 0xfd, 0xcc, 0x9a, 0x00, 0xdf, 0xca, 0x2c,
+	0x00, 0x31, 0x00, 0x19, 0x00, 0x31, 0x00, 0x19, 0x00, 0xa2, 0x88, 0x3e, 0xc0, 0x10, 0xc1, 0x3e,
+	0x10, 0xc1, 0x3e, 0x10, 0xc1, 0x3e, 0x10, 0xc1, 0x3e, 0x10, 0xc1, 0x3e, 0x10, 0xc1, 0x3e, 0x10,
+	0xc1, 0x3e, 0x10, 0x3e, 0x08, 0xe0, 0xc0, 0x31, 0x00, 0x19, 0x00, 0x31, 0x00, 0x19, 0x00, 0x31,
+	0x00, 0xc0, 0x3e, 0xe0, 0xc0, 0x3e, 0x10, 0xc1, 0x3e, 0x10, 0xc1, 0x3e, 0x10, 0xc1, 0x3e, 0x10,
+	0xc1, 0x3e, 0x10, 0xc1, 0x3e, 0x10, 0xc1, 0x3e, 0x10, 0xc1, 0x3e, 0x10, 0xc1, 0x3e, 0x10, 0xc1,
+	0x3e, 0x10, 0xc1, 0x3e, 0x10, 0xc1, 0x3e, 0x10, 0xc1, 0x3e, 0x10, 0xc1, 0x25, 0x26, 0xe0, 0xc0,
+	0x19, 0x00, 0x31, 0x00, 0x19, 0x00, 0xc0, 0xfe, 0xa7, 0xa0, 0xa2, 0xca, 0x10, 0xc1, 0x3e, 0x10,
+	0xc1, 0x3e, 0x10, 0xc1, 0x3e, 0x10, 0xc1, 0x3e, 0x10, 0xc1, 0x3e, 0x10, 0xc1, 0x3e, 0x10, 0xc1,
+	0x3e, 0x10, 0xc1, 0x3e, 0x10, 0xfe, 0x84, 0x58, 0x00, 0x19, 0x00, 0x31, 0x00, 0x19, 0x00, 0x31,
+	0x00, 0xc0, 0xfe, 0xff, 0xff, 0xdf, 0xca, 0xb4, 0x00, 0xdf, 0xca, 0x98, 0x99, 0xe0, 0xc0, 0x07,
+	0x00, 0x07, 0x00, 0x07, 0x00, 0x07, 0x31, 0xfe, 0x0a, 0xd1, 0x10, 0x25, 0xe0, 0x25, 0x10, 0x25,
+	0xe0, 0x25, 0x10, 0x25, 0xe0, 0x25, 0x10, 0x25, 0xe0, 0x25, 0x10, 0x25, 0xe0, 0x25, 0x10, 0x25,
+	0xe0, 0x25, 0x10, 0x25, 0xe0, 0x25, 0x10, 0x25, 0x10, 0x05, 0x9e, 0x37, 0xe0, 0xc0, 0x07, 0x00,
+	0x07, 0x00, 0x07, 0x00, 0x07, 0x00, 0x07, 0xe0, 0x33, 0xe0, 0x25, 0x10, 0x25, 0xe0, 0x25, 0x10,
+	0x25, 0xe0, 0x25, 0x10, 0x25, 0xe0, 0x25, 0x10, 0x25, 0xe0, 0x25, 0x10, 0x25, 0xe0, 0x25, 0x10,
+	0x25, 0xe0, 0x25, 0x10, 0x25, 0xe0, 0x25, 0x10, 0x25, 0xe0, 0x25, 0x10, 0x25, 0xe0, 0x25, 0x10,
+	0x25, 0xe0, 0x25, 0x10, 0x25, 0xe0, 0x25, 0x10, 0x25, 0xe0, 0x25, 0x10, 0x25, 0xe0, 0x25, 0x69,
+	0x3f, 0xe0, 0x07, 0x00, 0x07, 0x00, 0x07, 0x00, 0x07, 0x2a, 0x33, 0x10, 0x25, 0xe0, 0x25, 0x10,
+	0x25, 0xe0, 0x25, 0x10, 0x25, 0xe0, 0x25, 0x10, 0x25, 0xe0, 0x25, 0x10, 0x25, 0xe0, 0x25, 0x10,
+	0x25, 0xe0, 0x25, 0x10, 0x25, 0xe0, 0x25, 0x10, 0x25, 0xe0, 0x25, 0x10, 0x25, 0x9e, 0x05, 0xe0,
+	0xc0, 0x07, 0x00, 0x07, 0x00, 0x07, 0x00, 0x19, 0xfe, 0x75, 0xad, 0xfd, 0xcd, 0x98, 0x00, 0xdf,
+	0xcb, 0xe0, 0x19, 0x00, 0x31, 0x00, 0x19, 0x00, 0x31, 0x00, 0x19, 0x3e, 0xe0, 0xc0, 0x3e, 0x10,
+	0xc1, 0x3e, 0x10, 0xc1, 0x3e, 0x10, 0xc1, 0x3e, 0x10, 0xc1, 0x3e, 0x10, 0xc1, 0x3e, 0x10, 0xc1,
+	0x3e, 0x10, 0xc1, 0x3e, 0x10, 0xa1, 0xa9, 0xfe, 0x85, 0x78, 0x2e, 0x00, 0x31, 0x00, 0x19, 0x00,
+	0x31, 0x00, 0x19, 0x00, 0xc0, 0x10, 0x7a, 0x10, 0xc1, 0x3e, 0x10, 0xc1, 0x3e, 0x10, 0xc1, 0x3e,
+	0x10, 0xc1, 0x3e, 0x10, 0xc1, 0x3e, 0x10, 0xc1, 0x3e, 0x10, 0xc1, 0x3e, 0x10, 0xc1, 0x3e, 0x10,
+	0xc1, 0x3e, 0x10, 0xc1, 0x3e, 0x10, 0xc1, 0x3e, 0x10, 0xc1, 0x3e, 0x10, 0xc1, 0x3e, 0x10, 0x25,
+	0xfe, 0x22, 0x18, 0x19, 0x00, 0x31, 0x00, 0x19, 0x00, 0x31, 0x00, 0x13, 0x10, 0xc1, 0x3e, 0x10,
+	0xc1, 0x3e, 0x10, 0xc1, 0x3e, 0x10, 0xc1, 0x3e, 0x10, 0xc1, 0x3e, 0x10, 0xc1, 0x3e, 0x10, 0xc1,
+	0x3e, 0x10, 0xc1, 0x3e, 0x10, 0xc1, 0xfe, 0x85, 0x58, 0xe0, 0x31, 0x00, 0x19, 0x00, 0x31, 0x00,
+	0x19, 0x00, 0xfe, 0xdb, 0xde, 0xfd, 0xcd, 0xb3, 0x00, 0xdf, 0xcb, 0x91, 0x99, 0x00, 0x07, 0x00,
+	0x07, 0x00, 0x07, 0x00, 0x07, 0x00, 0x05, 0xe0, 0x25, 0x10, 0x25, 0xe0, 0x25, 0x10, 0x25, 0xe0,
+	0x25, 0x10, 0x25, 0xe0, 0x25, 0x10, 0x25, 0xe0, 0x25, 0x10, 0x25, 0xe0, 0x25, 0x10, 0x25, 0xe0,
+	0x25, 0x10, 0x25, 0xe0, 0x25, 0x10, 0x25, 0x10, 0x7f, 0x00, 0x07, 0x00, 0x07, 0x00, 0x07, 0x00,
+	0x07, 0x00, 0x07, 0xe0, 0xfe, 0xc8, 0xa8, 0xe0, 0x25, 0xe0, 0x25, 0x10, 0x25, 0xe0, 0x25, 0x10,
+	0x25, 0xe0, 0x25, 0x10, 0x25, 0xe0, 0x25, 0x10, 0x25, 0xe0, 0x25, 0x10, 0x25, 0xe0, 0x25, 0x10,
+	0x25, 0xe0, 0x25, 0x10, 0x25, 0xe0, 0x25, 0x10, 0x25, 0xe0, 0x25, 0x10, 0x25, 0xe0, 0x25, 0x10,
+	0x25, 0xe0, 0x25, 0x10, 0x25, 0xe0, 0x25, 0x10, 0x25, 0xe0, 0x25, 0x10, 0x25, 0x13, 0xfe, 0x41,
+	0x00, 0x00, 0x07, 0x00, 0x07, 0x00, 0x07, 0x00, 0xfe, 0xa6, 0x80, 0x25, 0xc0, 0xe0, 0x25, 0x10,
+	0x25, 0xe0, 0x25, 0x10, 0x25, 0xe0, 0x25, 0x10, 0x25, 0xe0, 0x25, 0x10, 0x25, 0xe0, 0x25, 0x10,
+	0x25, 0xe0, 0x25, 0x10, 0x25, 0xe0, 0x25, 0x10, 0x25, 0xe0, 0x25, 0x10, 0x25, 0xe0, 0x25, 0x2d,
+	0x07, 0x00, 0x07, 0x00, 0x07, 0x00, 0x07, 0x00, 0xc0, 0x18, 0xdf, 0xcb, 0x95, 0x00, 0xdf, 0xcb,
+	0x9b, 0x99, 0xe0, 0xc0, 0x19, 0x00, 0x31, 0x00, 0x19, 0x00, 0xc0, 0x01, 0x3e, 0x10, 0xc1, 0x3e,
+	0x10, 0xc1, 0x3e, 0x10, 0xc1, 0x3e, 0x10, 0xc1, 0x3e, 0x10, 0xc1, 0x3e, 0x10, 0xc1, 0x3e, 0x10,
+	0xc1, 0x3e, 0x10, 0xc1, 0x3e, 0x10, 0xc0, 0x00, 0x19, 0x00, 0x31, 0x00, 0x19, 0x00, 0x31, 0x00,
+	0x19, 0x2d, 0x25, 0x10, 0x3e, 0x10, 0xc1, 0x3e, 0x10, 0xc1, 0x3e, 0x10, 0xc1, 0x3e, 0x10, 0xc1,
+	0x3e, 0x10, 0xc1, 0x3e, 0x10, 0xc1, 0x3e, 0x10, 0xc1, 0x3e, 0x10, 0xc1, 0x3e, 0x10, 0xc1, 0x3e,
+	0x10, 0xc1, 0x3e, 0x10, 0xc1, 0x3e, 0x10, 0xc1, 0x3e, 0x10, 0xc1, 0x25, 0x00, 0x31, 0x00, 0x19,
+	0x00, 0x31, 0x00, 0x31, 0xfe, 0xe9, 0xd0, 0x10, 0xc0, 0x3e, 0x10, 0xc1, 0x3e, 0x10, 0xc1, 0x3e,
+	0x10, 0xc1, 0x3e, 0x10, 0xc1, 0x3e, 0x10, 0xc1, 0x3e, 0x10, 0xc1, 0x3e, 0x10, 0xc1, 0x3e, 0x10,
+	0xc1, 0x3e, 0x10, 0xfe, 0x63, 0x38, 0x00, 0x19, 0x00, 0x31, 0x00, 0x19, 0x00, 0xc0, 0xfe, 0x59,
+	0xce, 0xfd, 0xce, 0xb4, 0x00, 0xdf, 0xcc, 0xfe, 0xa6, 0x31, 0x94, 0x99, 0x00, 0x07, 0x00, 0x07,
+	0x00, 0x07, 0xe0, 0x22, 0x7a, 0x25, 0xe0, 0x25, 0x10, 0x25, 0xe0, 0x25, 0x10, 0x25, 0xe0, 0x25,
+	0x10, 0x25, 0xe0, 0x25, 0x10, 0x25, 0xe0, 0x25, 0x10, 0x25, 0xe0, 0x25, 0x10, 0x25, 0xe0, 0x25,
+	0x10, 0x25, 0xe0, 0x25, 0x10, 0x25, 0x13, 0x3f, 0x00, 0x07, 0x00, 0x07, 0x00, 0x07, 0x00, 0x07,
+	0x00, 0xa2, 0x77, 0x3e, 0x25, 0x10, 0x25, 0xe0, 0x25, 0x10, 0x25, 0xe0, 0x25, 0x10, 0x25, 0xe0,
+	0x25, 0x10, 0x25, 0xe0, 0x25, 0x10, 0x25, 0xe0, 0x25, 0x10, 0x25, 0xe0, 0x25, 0x10, 0x25, 0xe0,
+	0x25, 0x10, 0x25, 0xe0, 0x25, 0x10, 0x25, 0xe0, 0x25, 0x10, 0x25, 0xe0, 0x25, 0x10, 0x25, 0xe0,
+	0x25, 0x10, 0x25, 0xe0, 0x25, 0x10, 0x25, 0xe0, 0x25, 0x22, 0xe0, 0xc0, 0x07, 0x00, 0x07, 0x00,
+	0x07, 0xfe, 0xc8, 0xa8, 0x25, 0xe0, 0x25, 0x10, 0x25, 0xe0, 0x25, 0x10, 0x25, 0xe0, 0x25, 0x10,
+	0x25, 0xe0, 0x25, 0x10, 0x25, 0xe0, 0x25, 0x10, 0x25, 0xe0, 0x25, 0x10, 0x25, 0xe0, 0x25, 0x10,
+	0x25, 0xe0, 0x25, 0x10, 0x25, 0xe0, 0x25, 0x10, 0x17, 0xfe, 0x42, 0x28, 0x07, 0x00, 0x07, 0x00,
+	0x07, 0x00, 0x07, 0xe0, 0xfe, 0x7e, 0xf7, 0xfd, 0xce, 0x96, 0x00, 0xdf, 0xcc, 0x8f, 0x99, 0x00,
+	0x31, 0x00, 0x19, 0x00, 0x31, 0x00, 0x19, 0xfe, 0x86, 0x80, 0x3e, 0x10, 0x3e, 0x10, 0xc1, 0x3e,
+	0x10, 0xc1, 0x3e, 0x10, 0xc1, 0x3e, 0x10, 0xc1, 0x3e, 0x10, 0xc1, 0x3e, 0x10, 0xc1, 0x3e, 0x10,
+	0xc1, 0x3e, 0x10, 0xc1, 0x3e, 0xc0, 0xe0, 0xc0, 0x19, 0x00, 0x31, 0x00, 0x19, 0x00, 0x31, 0x00,
+	0x13, 0x10, 0xc1, 0x3e, 0x10, 0xc1, 0x3e, 0x10, 0xc1, 0x3e, 0x10, 0xc1, 0x3e, 0x10, 0xc1, 0x3e,
+	0x10, 0xc1, 0x3e, 0x10, 0xc1, 0x3e, 0x10, 0xc1, 0x3e, 0x10, 0xc1, 0x3e, 0x10, 0xc1, 0x3e, 0x10,
+	0xc1, 0x3e, 0x10, 0xc1, 0x3e, 0x10, 0xc1, 0x3e, 0xc0, 0xfe, 0x65, 0x60, 0xe0, 0x19, 0x00, 0x31,
+	0x00, 0x19, 0x00, 0xfe, 0x0a, 0xd1, 0x10, 0x3e, 0x10, 0xc1, 0x3e, 0x10, 0xc1, 0x3e, 0x10, 0xc1,
+	0x3e, 0x10, 0xc1, 0x3e, 0x10, 0xc1, 0x3e, 0x10, 0xc1, 0x3e, 0x10, 0xc1, 0x3e, 0x10, 0xc1, 0x3e,
+	0x10, 0xc0, 0x13, 0x00, 0xc0, 0x31, 0x00, 0x19, 0x00, 0x31, 0x00, 0xc0, 0xfe, 0xff, 0xff, 0xdf,
+	0xcc, 0xa9, 0x00, 0xdf, 0xcc, 0x3b, 0xe0, 0xc0, 0x07, 0x00, 0x07, 0x00, 0x07, 0x00, 0x0d, 0xe0,
+	0x25, 0x10, 0x25, 0xe0, 0x25, 0x10, 0x25, 0xe0, 0x25, 0x10, 0x25, 0xe0, 0x25, 0x10, 0x25, 0xe0,
+	0x25, 0x10, 0x25, 0xe0, 0x25, 0x10, 0x25, 0xe0, 0x25, 0x10, 0x25, 0xe0, 0x25, 0x10, 0x25, 0xe0,
+	0x25, 0x10, 0x05, 0x29, 0x07, 0x00, 0x07, 0x00, 0x07, 0x00, 0x07, 0x00, 0x07, 0x09, 0x17, 0xe0,
+	0x25, 0x10, 0x25, 0xe0, 0x25, 0x10, 0x25, 0xe0, 0x25, 0x10, 0x25, 0xe0, 0x25, 0x10, 0x25, 0xe0,
+	0x25, 0x10, 0x25, 0xe0, 0x25, 0x10, 0x25, 0xe0, 0x25, 0x10, 0x25, 0xe0, 0x25, 0x10, 0x25, 0xe0,
+	0x25, 0x10, 0x25, 0xe0, 0x25, 0x10, 0x25, 0xe0, 0x25, 0x10, 0x25, 0xe0, 0x25, 0x10, 0x25, 0xe0,
+	0x25, 0x10, 0x05, 0x00, 0x07, 0x00, 0x07, 0x00, 0x07, 0x00, 0x2c, 0x10, 0x25, 0x10, 0x25, 0xe0,
+	0x25, 0x10, 0x25, 0xe0, 0x25, 0x10, 0x25, 0xe0, 0x25, 0x10, 0x25, 0xe0, 0x25, 0x10, 0x25, 0xe0,
+	0x25, 0x10, 0x25, 0xe0, 0x25, 0x10, 0x25, 0xe0, 0x25, 0x10, 0x25, 0xe0, 0x25, 0x10, 0x25, 0xe0,
+	0x33, 0xe0, 0x07, 0x00, 0x07, 0x00, 0x07, 0x00, 0x07, 0x16, 0xfd, 0xcf, 0x8e, 0x00, 0xdf, 0xcc,
+	0x9c, 0x88, 0xe0, 0x19, 0x00, 0x31, 0x00, 0x19, 0x00, 0x31, 0xc0, 0x05, 0x10, 0xc1, 0x3e, 0x10,
+	0xc1, 0x3e, 0x10, 0xc1, 0x3e, 0x10, 0xc1, 0x3e, 0x10, 0xc1, 0x3e, 0x10, 0xc1, 0x3e, 0x10, 0xc1,
+	0x3e, 0x10, 0xc1, 0x3e, 0x10, 0xc1, 0x05, 0x00, 0x31, 0x00, 0x19, 0x00, 0x31, 0x00, 0x19, 0x00,
+	0xc0, 0x3e, 0xc0, 0x10, 0xc1, 0x3e, 0x10, 0xc1, 0x3e, 0x10, 0xc1, 0x3e, 0x10, 0xc1, 0x3e, 0x10,
+	0xc1, 0x3e, 0x10, 0xc1, 0x3e, 0x10, 0xc1, 0x3e, 0x10, 0xc1, 0x3e, 0x10, 0xc1, 0x3e, 0x10, 0xc1,
+	0x3e, 0x10, 0xc1, 0x3e, 0x10, 0xc1, 0x3e, 0x10, 0x3e, 0x2c, 0xe0, 0xc0, 0x31, 0x00, 0x19, 0x00,
+	0xc0, 0x01, 0x3e, 0x10, 0xc1, 0x3e, 0x10, 0xc1, 0x3e, 0x10, 0xc1, 0x3e, 0x10, 0xc1, 0x3e, 0x10,
+	0xc1, 0x3e, 0x10, 0xc1, 0x3e, 0x10, 0xc1, 0x3e, 0x10, 0xc1, 0x3e, 0x10, 0xc1, 0x3e, 0x10, 0xe0,
+	0xc0, 0x19, 0x00, 0x31, 0x00, 0x19, 0x00, 0xfe, 0x59, 0xce, 0xfd, 0xcf, 0xb2, 0x00, 0xdf, 0xcc,
+	0x66, 0xe0, 0xc0, 0x07, 0x00, 0x07, 0x00, 0x07, 0x00, 0xc0, 0x13, 0x25, 0xe0, 0x25, 0x59, 0x25,
+	0xe0, 0x25, 0x10, 0x25, 0xe0, 0x25, 0x10, 0x25, 0xe0, 0x25, 0x10, 0x25, 0xe0, 0x25, 0x10, 0x25,
+	0xe0, 0x25, 0x10, 0x25, 0xe0, 0x25, 0x10, 0x25, 0xe0, 0x25, 0x10, 0x25, 0xe0, 0x25, 0x3e, 0xfe,
+	0x64, 0x48, 0x00, 0x07, 0x00, 0x07, 0x00, 0x07, 0x00, 0x07, 0xe0, 0xfe, 0xe9, 0xb0, 0xe0, 0x25,
+	0xe0, 0x25, 0x10, 0x25, 0xe0, 0x25, 0x10, 0x25, 0xe0, 0x25, 0x10, 0x25, 0xe0, 0x25, 0x10, 0x25,
+	0xe0, 0x25, 0x10, 0x25, 0xe0, 0x25, 0x10, 0x25, 0xe0, 0x25, 0x10, 0x25, 0xe0, 0x25, 0x10, 0x25,
+	0xe0, 0x25, 0x10, 0x25, 0xe0, 0x25, 0x10, 0x25, 0xe0, 0x25, 0x10, 0x25, 0xe0, 0x25, 0x10, 0x25,
+	0x13, 0xfe, 0x42, 0x08, 0xe0, 0x07, 0x00, 0x07, 0x00, 0x19, 0xfe, 0x85, 0x68, 0x17, 0x10, 0x25,
+	0xe0, 0x25, 0x10, 0x25, 0xe0, 0x25, 0x10, 0x25, 0xe0, 0x25, 0x10, 0x25, 0xe0, 0x25, 0x10, 0x25,
+	0xe0, 0x25, 0x10, 0x25, 0xe0, 0x25, 0x10, 0x25, 0xe0, 0x25, 0x10, 0x25, 0xe0, 0x25, 0x10, 0x25,
+	0xe0, 0x25, 0xe0, 0x9f, 0x37, 0xe0, 0x07, 0x00, 0x07, 0x00, 0x07, 0x00, 0xc0, 0x3b, 0xfd, 0xcf,
+	0x92, 0x00, 0xdf, 0xcd, 0xfe, 0xcb, 0x5a, 0x31, 0x00, 0x19, 0x00, 0x31, 0x00, 0x19, 0xe0, 0xfe,
+	0x85, 0x70, 0x3e, 0xc0, 0x5a, 0xc1, 0x3e, 0x10, 0xc1, 0x3e, 0x10, 0xc1, 0x3e, 0x10, 0xc1, 0x3e,
+	0x10, 0xc1, 0x3e, 0x10, 0xc1, 0x3e, 0x10, 0xc1, 0x3e, 0x10, 0xc1, 0x3e, 0x10, 0xe0, 0xc0, 0xe0,
+	0xc0, 0x31, 0x00, 0x19, 0x00, 0x31, 0x00, 0x19, 0xa0, 0xa8, 0x17, 0x10, 0x3e, 0x10, 0xc1, 0x3e,
+	0x10, 0xc1, 0x3e, 0x10, 0xc1, 0x3e, 0x10, 0xc1, 0x3e, 0x10, 0xc1, 0x3e, 0x10, 0xc1, 0x3e, 0x10,
+	0xc1, 0x3e, 0x10, 0xc1, 0x3e, 0x10, 0xc1, 0x3e, 0x10, 0xc1, 0x3e, 0x10, 0xc1, 0x3e, 0x10, 0xc1,
+	0x5a, 0x00, 0x31, 0x00, 0x19, 0x00, 0x31, 0x00, 0x05, 0x10, 0xc1, 0x3e, 0x10, 0xc1, 0x3e, 0x10,
+	0xc1, 0x3e, 0x10, 0xc1, 0x3e, 0x10, 0xc1, 0x3e, 0x10, 0xc1, 0x3e, 0x10, 0xc1, 0x3e, 0x10, 0xc1,
+	0x3e, 0x10, 0xc1, 0x3e, 0x10, 0x25, 0x1c, 0x19, 0x00, 0x31, 0x00, 0x19, 0x00, 0x31, 0xe0, 0xfe,
+	0xbf, 0xff, 0xfd, 0xcf, 0xab, 0x00, 0xdf, 0xcd, 0x91, 0x99, 0x00, 0x07, 0x00, 0x07, 0x00, 0x07,
+	0x00, 0x07, 0x19, 0x05, 0x10, 0x25, 0xe0, 0x25, 0x10, 0x25, 0xe0, 0x25, 0x10, 0x25, 0xe0, 0x25,
+	0x10, 0x25, 0xe0, 0x25, 0x10, 0x25, 0xe0, 0x25, 0x10, 0x25, 0xe0, 0x25, 0x10, 0x25, 0xe0, 0x25,
+	0x10, 0x25, 0xe0, 0x25, 0x10, 0x25, 0x10, 0x05, 0x31, 0x07, 0x00, 0x07, 0x00, 0x07, 0x00, 0x07,
+	0x00, 0x7e, 0x2c, 0xa2, 0xb9, 0x10, 0x25, 0xe0, 0x25, 0x10, 0x25, 0xe0, 0x25, 0x10, 0x25, 0xe0,
+	0x25, 0x10, 0x25, 0xe0, 0x25, 0x10, 0x25, 0xe0, 0x25, 0x10, 0x25, 0xe0, 0x25, 0x10, 0x25, 0xe0,
+	0x25, 0x10, 0x25, 0xe0, 0x25, 0x10, 0x25, 0xe0, 0x25, 0x10, 0x25, 0xe0, 0x25, 0x10, 0x25, 0xe0,
+	0x25, 0x10, 0x25, 0xe0, 0x33, 0x00, 0x07, 0x00, 0x07, 0x00, 0x07, 0x00, 0x0d, 0x25, 0xc0, 0xe0,
+	0x25, 0x10, 0x25, 0xe0, 0x25, 0x10, 0x25, 0xe0, 0x25, 0x10, 0x25, 0xe0, 0x25, 0x10, 0x25, 0xe0,
+	0x25, 0x10, 0x25, 0xe0, 0x25, 0x10, 0x25, 0xe0, 0x25, 0x10, 0x25, 0xe0, 0x25, 0x10, 0x25, 0xe0,
+	0x25, 0x10, 0x25, 0x33, 0x00, 0xc0, 0x07, 0x00, 0x07, 0x00, 0x07, 0x00, 0xa5, 0x99, 0x18, 0xdf,
+	0xcd, 0x91, 0x00, 0xdf, 0xcd, 0x9b, 0x99, 0xe0, 0xc0, 0x31, 0x00, 0x19, 0x00, 0x31, 0x00, 0xc0,
+	0x3e, 0xe0, 0xc0, 0x3e, 0x10, 0xc1, 0x3e, 0x10, 0xc1, 0x3e, 0x10, 0xc1, 0x3e, 0x10, 0xc1, 0x3e,
+	0x10, 0xc1, 0x3e, 0x10, 0xc1, 0x3e, 0x10, 0xc1, 0x3e, 0x10, 0xc1, 0x3e, 0x10, 0x37, 0x00, 0x19,
+	0x00, 0x31, 0x00, 0x19, 0x00, 0x31, 0x00, 0x31, 0x3e, 0xe0, 0xc0, 0x3e, 0x10, 0xc1, 0x3e, 0x10,
+	0xc1, 0x3e, 0x10, 0xc1, 0x3e, 0x10, 0xc1, 0x3e, 0x10, 0xc1, 0x3e, 0x10, 0xc1, 0x3e, 0x10, 0xc1,
+	0x3e, 0x10, 0xc1, 0x3e, 0x10, 0xc1, 0x3e, 0x10, 0xc1, 0x3e, 0x10, 0xc1, 0x13, 0x9e, 0x05, 0x2e,
+	0x00, 0x19, 0x00, 0x31, 0x00, 0x19, 0xfe, 0x85, 0x70, 0x3e, 0x5a, 0x3e, 0x10, 0xc1, 0x3e, 0x10,
+	0xc1, 0x3e, 0x10, 0xc1, 0x3e, 0x10, 0xc1, 0x3e, 0x10, 0xc1, 0x3e, 0x10, 0xc1, 0x3e, 0x10, 0xc1,
+	0x3e, 0x10, 0xc1, 0x3e, 0x10, 0xc1, 0x22, 0xe0, 0x31, 0x00, 0x19, 0x00, 0x31, 0x00, 0xc0, 0xfe,
+	0x38, 0xc6, 0xfd, 0xd0, 0xaa, 0x00, 0xdf, 0xce, 0xe0, 0x07, 0x00, 0x07, 0x00, 0x07, 0x00, 0x07,
+	0xe0, 0xfe, 0x85, 0x70, 0x3e, 0x25, 0x59, 0x25, 0xe0, 0x25, 0x10, 0x25, 0xe0, 0x25, 0x10, 0x25,
+	0xe0, 0x25, 0x10, 0x25, 0xe0, 0x25, 0x10, 0x25, 0xe0, 0x25, 0x10, 0x25, 0xe0, 0x25, 0x10, 0x25,
+	0xe0, 0x25, 0x10, 0x25, 0xe0, 0x25, 0x10, 0x25, 0x13, 0xe0, 0xc0, 0x07, 0x00, 0x07, 0x00, 0x07,
+	0x00, 0x07, 0x00, 0x3f, 0x13, 0x25, 0x10, 0x25, 0xe0, 0x25, 0x10, 0x25, 0xe0, 0x25, 0x10, 0x25,
+	0xe0, 0x25, 0x10, 0x25, 0xe0, 0x25, 0x10, 0x25, 0xe0, 0x25, 0x10, 0x25, 0xe0, 0x25, 0x10, 0x25,
+	0xe0, 0x25, 0x10, 0x25, 0xe0, 0x25, 0x10, 0x25, 0xe0, 0x25, 0x10, 0x25, 0xe0, 0x25, 0x10, 0x25,
+	0xe0, 0x25, 0x10, 0x00, 0xc0, 0x07, 0x00, 0x07, 0x00, 0x07, 0x00, 0xfe, 0x0b, 0xd9, 0x10, 0x25,
+	0x10, 0x25, 0xe0, 0x25, 0x10, 0x25, 0xe0, 0x25, 0x10, 0x25, 0xe0, 0x25, 0x10, 0x25, 0xe0, 0x25,
+	0x10, 0x25, 0xe0, 0x25, 0x10, 0x25, 0xe0, 0x25, 0x10, 0x25, 0xe0, 0x25, 0x10, 0x25, 0xe0, 0x25,
+	0x10, 0x25, 0xe0, 0x05, 0x1c, 0x07, 0x00, 0x07, 0x00, 0x07, 0x00, 0x07, 0xe0, 0x34, 0xfd, 0xd0,
+	0x8e, 0x00, 0xdf, 0xce, 0x8a, 0x99, 0x00, 0x19, 0x00, 0x31, 0x00, 0x19, 0x00, 0x31, 0x00, 0x05,
+	0x10, 0xc1, 0x3e, 0x10, 0xc1, 0x3e, 0x10, 0xc1, 0x3e, 0x10, 0xc1, 0x3e, 0x10, 0xc1, 0x3e, 0x10,
+	0xc1, 0x3e, 0x10, 0xc1, 0x3e, 0x10, 0xc1, 0x3e, 0x10, 0xc1, 0x05, 0x31, 0xc0, 0x00, 0x19, 0x00,
+	0x31, 0x00, 0x19, 0x00, 0x31, 0x00, 0xfe, 0xa7, 0x90, 0x3e, 0xe0, 0xc0, 0x3e, 0x10, 0xc1, 0x3e,
+	0x10, 0xc1, 0x3e, 0x10, 0xc1, 0x3e, 0x10, 0xc1, 0x3e, 0x10, 0xc1, 0x3e, 0x10, 0xc1, 0x3e, 0x10,
+	0xc1, 0x3e, 0x10, 0xc1, 0x3e, 0x10, 0xc1, 0x3e, 0x10, 0xc2, 0xa0, 0xa8, 0x00, 0xc0, 0x19, 0x00,
+	0x31, 0x00, 0x19, 0x00, 0xa1, 0xb9, 0x13, 0x3e, 0x10, 0xc1, 0x3e, 0x10, 0xc1, 0x3e, 0x10, 0xc1,
+	0x3e, 0x10, 0xc1, 0x3e, 0x10, 0xc1, 0x3e, 0x10, 0xc1, 0x3e, 0x10, 0xc1, 0x3e, 0x10, 0xc1, 0x3e,
+	0x10, 0xc1, 0x3e, 0xc0, 0x00, 0xc0, 0x19, 0x00, 0x31, 0x00, 0x19, 0x00, 0xc0, 0x18, 0xdf, 0xce,
+	0xaf, 0x00, 0xdf, 0xce, 0x9c, 0x88, 0xe0, 0xc0, 0x07, 0x00, 0x07, 0x00, 0x07, 0x00, 0x7b, 0x09,
+	0x17, 0xe0, 0x25, 0x10, 0x25, 0xe0, 0x25, 0x10, 0x25, 0xe0, 0x25, 0x10, 0x25, 0xe0, 0x25, 0x10,
+	0x25, 0xe0, 0x25, 0x10, 0x25, 0xe0, 0x25, 0x10, 0x25, 0xe0, 0x25, 0x10, 0x25, 0xe0, 0x25, 0x10,
+	0x25, 0xe0, 0x25, 0x3e, 0xfe, 0x85, 0x68, 0x00, 0x07, 0x00, 0x07, 0x00, 0x07, 0x00, 0x07, 0x00,
+	0x07, 0x00, 0xfe, 0xc8, 0xb0, 0x3e, 0x25, 0x10, 0x25, 0xe0, 0x25, 0x10, 0x25, 0xe0, 0x25, 0x10,
+	0x25, 0xe0, 0x25, 0x10, 0x25, 0xe0, 0x25, 0x10, 0x25, 0xe0, 0x25, 0x10, 0x25, 0xe0, 0x25, 0x10,
+	0x25, 0xe0, 0x25, 0x10, 0x25, 0xe0, 0x25, 0x10, 0x25, 0xe0, 0x25, 0x10, 0x25, 0xe0, 0x25, 0xa1,
+	0xa8, 0x19, 0xe0, 0x07, 0x00, 0x07, 0x00, 0x07, 0x00, 0x19, 0x22, 0x25, 0x10, 0x25, 0xe0, 0x25,
+	0x10, 0x25, 0xe0, 0x25, 0x10, 0x25, 0xe0, 0x25, 0x10, 0x25, 0xe0, 0x25, 0x10, 0x25, 0xe0, 0x25,
+	0x10, 0x25, 0xe0, 0x25, 0x10, 0x25, 0xe0, 0x25, 0x10, 0x25, 0xe0, 0x25, 0x10, 0x25, 0xe0, 0x25,
+	0xc0, 0xfe, 0x85, 0x70, 0xe0, 0x07, 0x00, 0x07, 0x00, 0x07, 0x00, 0xc0, 0xfe, 0x18, 0xc6, 0xfd,
+	0xd1, 0x90, 0x00, 0xdf, 0xcf, 0xe0, 0x31, 0x00, 0x19, 0x00, 0x31, 0x00, 0x19, 0x00, 0x31, 0x3e,
+	0xc0, 0x5a, 0xc1, 0x3e, 0x10, 0xc1, 0x3e, 0x10, 0xc1, 0x3e, 0x10, 0xc1, 0x3e, 0x10, 0xc1, 0x3e,
+	0x10, 0xc1, 0x3e, 0x10, 0xc1, 0x3e, 0x10, 0xc1, 0x3e, 0x10, 0xe0, 0x9f, 0x58, 0xe0, 0xc0, 0x31,
+	0x00, 0x19, 0x00, 0x31, 0x00, 0x19, 0x00, 0x31, 0x00, 0x2c, 0x10, 0xc1, 0x3e, 0x10, 0xc1, 0x3e,
+	0x10, 0xc1, 0x3e, 0x10, 0xc1, 0x3e, 0x10, 0xc1, 0x3e, 0x10, 0xc1, 0x3e, 0x10, 0xc1, 0x3e, 0x10,
+	0xc1, 0x3e, 0x10, 0xc1, 0x3e, 0x10, 0xc1, 0x3e, 0x13, 0xfe, 0x44, 0x50, 0x00, 0x19, 0x00, 0x31,
+	0x00, 0x19, 0x00, 0x31, 0x00, 0xfe, 0xe9, 0xb0, 0x10, 0xc1, 0x3e, 0x10, 0xc1, 0x3e, 0x10, 0xc1,
+	0x3e, 0x10, 0xc1, 0x3e, 0x10, 0xc1, 0x3e, 0x10, 0xc1, 0x3e, 0x10, 0xc1, 0x3e, 0x10, 0xc1, 0x3e,
+	0x10, 0xc1, 0x3e, 0x10, 0x13, 0x00, 0x19, 0x00, 0x31, 0x00, 0x19, 0x00, 0x31, 0xe0, 0xfe, 0x9e,
+	0xf7, 0xfd, 0xd1, 0xa9, 0x00, 0xdf, 0xcf, 0x2d, 0x00, 0x07, 0x00, 0x07, 0x00, 0x07, 0x00, 0x07,
+	0x00, 0x29, 0x25, 0xc0, 0xe0, 0x25, 0x10, 0x25, 0xe0, 0x25, 0x10, 0x25, 0xe0, 0x25, 0x10, 0x25,
+	0xe0, 0x25, 0x10, 0x25, 0xe0, 0x25, 0x10, 0x25, 0xe0, 0x25, 0x10, 0x25, 0xe0, 0x25, 0x10, 0x25,
+	0xe0, 0x25, 0x10, 0x25, 0x10, 0x33, 0xe0, 0x07, 0x00, 0x07, 0x00, 0x07, 0x00, 0x07, 0x00, 0x07,
+	0x00, 0x07, 0x00, 0xfe, 0xc8, 0xa0, 0xa1, 0xd9, 0x25, 0x10, 0x25, 0xe0, 0x25, 0x10, 0x25, 0xe0,
+	0x25, 0x10, 0x25, 0xe0, 0x25, 0x10, 0x25, 0xe0, 0x25, 0x10, 0x25, 0xe0, 0x25, 0x10, 0x25, 0xe0,
+	0x25, 0x10, 0x25, 0xe0, 0x25, 0x10, 0x25, 0xe0, 0x25, 0x10, 0x25, 0xe0, 0x25, 0x33, 0xfe, 0x42,
+	0x18, 0x00, 0x07, 0x00, 0x07, 0x00, 0x07, 0x00, 0x07, 0x00, 0xc0, 0x21, 0x25, 0xe0, 0x25, 0x10,
+	0x25, 0xe0, 0x25, 0x10, 0x25, 0xe0, 0x25, 0x10, 0x25, 0xe0, 0x25, 0x10, 0x25, 0xe0, 0x25, 0x10,
+	0x25, 0xe0, 0x25, 0x10, 0x25, 0xe0, 0x25, 0x10, 0x25, 0xe0, 0x25, 0x10, 0x25, 0xe0, 0x25, 0x10,
+	0x05, 0x1c, 0x07, 0x00, 0x07, 0x00, 0x07, 0x00, 0x07, 0x00, 0x16, 0x18, 0xdf, 0xcf, 0x8e, 0x00,
+	0xdf, 0xd0, 0xe0, 0xc0, 0x31, 0x00, 0x19, 0x00, 0x31, 0x00, 0x19, 0x00, 0x05, 0x10, 0x3e, 0x10,
+	0xc1, 0x3e, 0x10, 0xc1, 0x3e, 0x10, 0xc1, 0x3e, 0x10, 0xc1, 0x3e, 0x10, 0xc1, 0x3e, 0x10, 0xc1,
+	0x3e, 0x10, 0xc1, 0x3e, 0x10, 0xc1, 0x3e, 0x13, 0x31, 0x00, 0x19, 0x00, 0x31, 0x00, 0x19, 0x00,
+	0x31, 0x00, 0x19, 0x00, 0x31, 0x00, 0xfe, 0xa6, 0x80, 0xfe, 0xe9, 0xd0, 0xe0, 0xc0, 0x3e, 0x10,
+	0xc1, 0x3e, 0x10, 0xc1, 0x3e, 0x10, 0xc1, 0x3e, 0x10, 0xc1, 0x3e, 0x10, 0xc1, 0x3e, 0x10, 0xc1,
+	0x3e, 0x10, 0xc1, 0x3e, 0x10, 0xc2, 0x13, 0x31, 0x00, 0x19, 0x00, 0x31, 0x00, 0x19, 0x00, 0x31,
+	0x00, 0x19, 0x9f, 0xc8, 0x33, 0x10, 0x3e, 0x10, 0xc1, 0x3e, 0x10, 0xc1, 0x3e, 0x10, 0xc1, 0x3e,
+	0x10, 0xc1, 0x3e, 0x10, 0xc1, 0x3e, 0x10, 0xc1, 0x3e, 0x10, 0xc1, 0x3e, 0x10, 0xc1, 0x3e, 0x10,
+	0x3e, 0x1a, 0x00, 0xc0, 0x31, 0x00, 0x19, 0x00, 0x31, 0x00, 0xc0, 0x2d, 0xfd, 0xd2, 0xae, 0x00,
+	0xdf, 0xd0, 0x9c, 0x99, 0xe0, 0xc0, 0x07, 0x00, 0x07, 0x00, 0x07, 0x00, 0x07, 0xfe, 0x43, 0x48,
+	0x33, 0x10, 0x25, 0xe0, 0x25, 0x10, 0x25, 0xe0, 0x25, 0x10, 0x25, 0xe0, 0x25, 0x10, 0x25, 0xe0,
+	0x25, 0x10, 0x25, 0xe0, 0x25, 0x10, 0x25, 0xe0, 0x25, 0x10, 0x25, 0xe0, 0x25, 0x10, 0x25, 0xe0,
+	0x25, 0x10, 0x7f, 0xfe, 0x41, 0x00, 0x07, 0x00, 0x07, 0x00, 0x07, 0x00, 0x07, 0x00, 0x07, 0x00,
+	0x07, 0x00, 0x07, 0x00, 0xfe, 0x84, 0x50, 0x13, 0x25, 0x10, 0x25, 0xe0, 0x25, 0x10, 0x25, 0xe0,
+	0x25, 0x10, 0x25, 0xe0, 0x25, 0x10, 0x25, 0xe0, 0x25, 0x10, 0x25, 0xe0, 0x25, 0x10, 0x25, 0xe0,
+	0x25, 0x10, 0x25, 0xe0, 0x25, 0x10, 0x25, 0xe0, 0x33, 0x9e, 0x37, 0x00, 0xc0, 0x07, 0x00, 0x07,
+	0x00, 0x07, 0x00, 0x07, 0x00, 0x07, 0x00, 0xa3, 0xc9, 0xfe, 0x0a, 0xd1, 0x25, 0x10, 0x25, 0xe0,
+	0x25, 0x10, 0x25, 0xe0, 0x25, 0x10, 0x25, 0xe0, 0x25, 0x10, 0x25, 0xe0, 0x25, 0x10, 0x25, 0xe0,
+	0x25, 0x10, 0x25, 0xe0, 0x25, 0x10, 0x25, 0xe0, 0x25, 0x10, 0x25, 0xe0, 0x25, 0x10, 0xc0, 0x13,
+	0x00, 0xc0, 0x07, 0x00, 0x07, 0x00, 0x07, 0x00, 0x07, 0xae, 0x88, 0x18, 0xdf, 0xd0, 0x95, 0x00,
+	0xdf, 0xd1, 0xe0, 0x19, 0x00, 0x6e, 0x00, 0x19, 0x00, 0x31, 0x00, 0xc0, 0x09, 0x13, 0x10, 0x3e,
+	0x10, 0xc1, 0x3e, 0x10, 0xc1, 0x3e, 0x10, 0xc1, 0x3e, 0x10, 0xc1, 0x3e, 0x10, 0xc1, 0x3e, 0x10,
+	0xc1, 0x3e, 0x10, 0xc1, 0x3e, 0x10, 0xc1, 0xfe, 0x85, 0x60, 0x00, 0x31, 0x00, 0x19, 0x00, 0x31,
+	0x00, 0x19, 0x00, 0x31, 0x00, 0x19, 0x00, 0x31, 0x00, 0x31, 0xfe, 0xa7, 0xa0, 0x33, 0x10, 0x3e,
+	0x10, 0xc1, 0x3e, 0x10, 0xc1, 0x3e, 0x10, 0xc1, 0x3e, 0x10, 0xc1, 0x3e, 0x10, 0xc1, 0x3e, 0x10,
+	0xc1, 0x3e, 0x10, 0xc1, 0x33, 0xfe, 0x63, 0x40, 0x00, 0xc0, 0x19, 0x00, 0x31, 0x00, 0x19, 0x00,
+	0x31, 0x00, 0x19, 0x00, 0x31, 0xfe, 0x43, 0x40, 0xfe, 0xea, 0xc8, 0x10, 0xc1, 0x3e, 0x10, 0xc1,
+	0x3e, 0x10, 0xc1, 0x3e, 0x10, 0xc1, 0x3e, 0x10, 0xc1, 0x3e, 0x10, 0xc1, 0x3e, 0x10, 0xc1, 0x3e,
+	0x10, 0xc1, 0x3e, 0x10, 0xc0, 0x13, 0x19, 0xe0, 0x31, 0x00, 0x19, 0x00, 0x31, 0x00, 0x19, 0x00,
+	0xfe, 0xdf, 0xff, 0xfd, 0xd3, 0xab, 0x00, 0xdf, 0xd1, 0x2d, 0x00, 0x07, 0x00, 0x07, 0x00, 0x07,
+	0x00, 0x07, 0xe0, 0xc0, 0x10, 0x25, 0x10, 0x25, 0xe0, 0x25, 0x10, 0x25, 0xe0, 0x25, 0x10, 0x25,
+	0xe0, 0x25, 0x10, 0x25, 0xe0, 0x25, 0x10, 0x25, 0xe0, 0x25, 0x10, 0x25, 0xe0, 0x25, 0x10, 0x25,
+	0xe0, 0x25, 0x10, 0x25, 0xe0, 0x25, 0xfe, 0x64, 0x58, 0x07, 0x00, 0x07, 0x00, 0x07, 0x00, 0x07,
+	0x00, 0x07, 0x00, 0x07, 0x00, 0x07, 0x00, 0x07, 0x00, 0x31, 0xa0, 0xfa, 0xe0, 0x33, 0x25, 0xe0,
+	0x25, 0x10, 0x25, 0xe0, 0x25, 0x10, 0x25, 0xe0, 0x25, 0x10, 0x25, 0xe0, 0x25, 0x10, 0x25, 0xe0,
+	0x25, 0x10, 0x25, 0xe0, 0x25, 0x10, 0x17, 0x33, 0xfe, 0x85, 0x70, 0x00, 0x19, 0xe0, 0x07, 0x00,
+	0x07, 0x00, 0x07, 0x00, 0x07, 0x00, 0x07, 0x00, 0x07, 0x00, 0xfe, 0x86, 0x70, 0xfe, 0xe9, 0xc0,
+	0x25, 0xe0, 0x25, 0x10, 0x25, 0xe0, 0x25, 0x10, 0x25, 0xe0, 0x25, 0x10, 0x25, 0xe0, 0x25, 0x10,
+	0x25, 0xe0, 0x25, 0x10, 0x25, 0xe0, 0x25, 0x10, 0x25, 0xe0, 0x25, 0x10, 0x25, 0xe0, 0x25, 0x10,
+	0x25, 0x13, 0x3f, 0x00, 0x07, 0x00, 0x07, 0x00, 0x07, 0x00, 0x07, 0x00, 0xfe, 0xd3, 0x9c, 0x18,
+	0xdf, 0xd1, 0x95, 0x00, 0xdf, 0xd2, 0xfe, 0x2d, 0x6b, 0x00, 0x19, 0x00, 0x31, 0x00, 0x19, 0x00,
+	0x31, 0xe0, 0xc0, 0x3e, 0xe0, 0xc0, 0x3e, 0x10, 0xc1, 0x3e, 0x10, 0xc1, 0x3e, 0x10, 0xc1, 0x3e,
+	0x10, 0xc1, 0x3e, 0x10, 0xc1, 0x3e, 0x10, 0xc1, 0x3e, 0x10, 0xc1, 0x3e, 0x10, 0x9e, 0x27, 0x00,
+	0x19, 0x00, 0x31, 0x00, 0x19, 0x00, 0x31, 0x00, 0x19, 0x00, 0x31, 0x00, 0x19, 0x00, 0x31, 0x00,
+	0x19, 0x00, 0xfe, 0x23, 0x40, 0x37, 0xa3, 0xfa, 0x3e, 0xe0, 0xc0, 0x3e, 0x10, 0xc1, 0x3e, 0x10,
+	0xc1, 0x3e, 0x10, 0xc1, 0x3e, 0x10, 0xc2, 0x01, 0x25, 0xfe, 0x64, 0x60, 0x00, 0xc0, 0x31, 0x00,
+	0x19, 0x00, 0x31, 0x00, 0x19, 0x00, 0x31, 0x00, 0x19, 0x00, 0x31, 0x00, 0x31, 0x22, 0xe0, 0xc0,
+	0x3e, 0x10, 0xc1, 0x3e, 0x10, 0xc1, 0x3e, 0x10, 0xc1, 0x3e, 0x10, 0xc1, 0x3e, 0x10, 0xc1, 0x3e,
+	0x10, 0xc1, 0x3e, 0x10, 0xc1, 0x3e, 0x10, 0xc0, 0x3e, 0x29, 0x00, 0x31, 0x00, 0x19, 0x00, 0x31,
+	0x00, 0x19, 0x00, 0xc0, 0xfe, 0xff, 0xff, 0xdf, 0xd2, 0xa3, 0x00, 0xdf, 0xd3, 0xe0, 0xc0, 0x07,
+	0x00, 0x07, 0x00, 0x07, 0x00, 0x07, 0xe0, 0x23, 0x25, 0xc0, 0x10, 0x25, 0xe0, 0x25, 0x10, 0x25,
+	0xe0, 0x25, 0x10, 0x25, 0xe0, 0x25, 0x10, 0x25, 0xe0, 0x25, 0x10, 0x25, 0xe0, 0x25, 0x10, 0x25,
+	0xe0, 0x25, 0x10, 0x25, 0xe0, 0x25, 0x10, 0x25, 0x9e, 0x15, 0x07, 0x00, 0x07, 0x00, 0x07, 0x00,
+	0x07, 0x00, 0x07, 0x00, 0x07, 0x00, 0x07, 0x00, 0x07, 0x00, 0x07, 0x00, 0x07, 0x00, 0xc0, 0xa0,
+	0xb9, 0x22, 0x29, 0x05, 0x7a, 0x17, 0xe0, 0x25, 0x10, 0x25, 0xe0, 0x25, 0x10, 0x25, 0xe0, 0x25,
+	0x10, 0x33, 0x05, 0x17, 0x9d, 0x26, 0x02, 0x00, 0x19, 0xe0, 0x07, 0x00, 0x07, 0x00, 0x07, 0x00,
+	0x07, 0x00, 0x07, 0x00, 0x07, 0x00, 0x07, 0x00, 0x07, 0x00, 0xfe, 0xc7, 0x90, 0xe0, 0x25, 0x10,
+	0x25, 0xe0, 0x25, 0x10, 0x25, 0xe0, 0x25, 0x10, 0x25, 0xe0, 0x25, 0x10, 0x25, 0xe0, 0x25, 0x10,
+	0x25, 0xe0, 0x25, 0x10, 0x25, 0xe0, 0x25, 0x10, 0x25, 0xe0, 0x25, 0x10, 0x25, 0x3e, 0x2c, 0x00,
+	0x07, 0x00, 0x07, 0x00, 0x07, 0x00, 0x07, 0x00, 0xc0, 0xfe, 0x7d, 0xef, 0xfd, 0xd5, 0x99, 0x00,
+	0xdf, 0xd3, 0x9b, 0x99, 0xe0, 0xc0, 0x19, 0x00, 0x6e, 0x00, 0x19, 0x00, 0x31, 0x00, 0xa2, 0xc9,
+	0x10, 0xc1, 0x3e, 0x10, 0xc1, 0x3e, 0x10, 0xc1, 0x3e, 0x10, 0xc1, 0x3e, 0x10, 0xc1, 0x3e, 0x10,
+	0xc1, 0x3e, 0x10, 0xc1, 0x3e, 0x10, 0xc1, 0xfe, 0x85, 0x60, 0x00, 0x31, 0x00, 0x19, 0x00, 0x31,
+	0x00, 0x19, 0x00, 0x31, 0x00, 0x19, 0x00, 0x31, 0x00, 0x19, 0x00, 0x31, 0x00, 0x19, 0xe0, 0x31,
+	0x00, 0xc0, 0xa0, 0xb9, 0xa2, 0xe9, 0xa2, 0xb9, 0x09, 0x37, 0x3e, 0xc0, 0x25, 0x3e, 0x13, 0xa0,
+	0x57, 0x5a, 0x37, 0x9f, 0x58, 0x9f, 0x46, 0x02, 0x00, 0xc1, 0x19, 0x00, 0x6e, 0x00, 0x19, 0x00,
+	0x31, 0x00, 0x19, 0x00, 0x31, 0x00, 0x19, 0x00, 0x31, 0x00, 0x19, 0x00, 0x31, 0x10, 0x3e, 0x5a,
+	0xc1, 0x3e, 0x10, 0xc1, 0x3e, 0x10, 0xc1, 0x3e, 0x10, 0xc1, 0x3e, 0x10, 0xc1, 0x3e, 0x10, 0xc1,
+	0x3e, 0x10, 0xc1, 0x3e, 0x10, 0xc0, 0x3e, 0x1a, 0x00, 0x31, 0x00, 0x19, 0x00, 0x31, 0x00, 0x19,
+	0x00, 0xc0, 0xfe, 0x92, 0x94, 0xbb, 0x88, 0xdf, 0xd3, 0x9b, 0x00, 0xdf, 0xd4, 0x84, 0x98, 0xe0,
+	0xc0, 0x07, 0x00, 0x07, 0x00, 0x07, 0x00, 0x07, 0x00, 0xa1, 0xda, 0x13, 0x25, 0x10, 0x25, 0xe0,
+	0x25, 0x10, 0x25, 0xe0, 0x25, 0x10, 0x25, 0xe0, 0x25, 0x10, 0x25, 0xe0, 0x25, 0x10, 0x25, 0xe0,
+	0x25, 0x10, 0x25, 0xe0, 0x25, 0x10, 0x25, 0xe0, 0x25, 0x0a, 0x07, 0x00, 0x07, 0x00, 0x07, 0x00,
+	0x07, 0x00, 0x07, 0x00, 0x07, 0x00, 0x07, 0x00, 0x07, 0x00, 0x07, 0x00, 0x07, 0x00, 0x07, 0x00,
+	0x07, 0xe0, 0x07, 0x00, 0x19, 0x00, 0x31, 0x00, 0x31, 0x00, 0x31, 0x00, 0xc3, 0x07, 0x00, 0x07,
+	0xe0, 0x07, 0x00, 0x07, 0x00, 0x07, 0x00, 0x07, 0x00, 0x07, 0x00, 0x07, 0x00, 0x07, 0x00, 0x07,
+	0x00, 0x07, 0x00, 0x07, 0x00, 0xfe, 0xa6, 0x70, 0x10, 0x25, 0xe0, 0x25, 0x10, 0x25, 0xe0, 0x25,
+	0x10, 0x25, 0xe0, 0x25, 0x10, 0x25, 0xe0, 0x25, 0x10, 0x25, 0xe0, 0x25, 0x10, 0x25, 0xe0, 0x25,
+	0x10, 0x25, 0xe0, 0x25, 0x10, 0x25, 0xc0, 0x2c, 0x00, 0x07, 0x00, 0x07, 0x00, 0x07, 0x00, 0x07,
+	0x00, 0x07, 0xe0, 0x18, 0xdf, 0xd4, 0x94, 0x00, 0xdf, 0xd5, 0xfe, 0xa6, 0x31, 0xe0, 0xc0, 0x19,
+	0x00, 0x31, 0x00, 0x19, 0x00, 0x31, 0x00, 0xa1, 0xa9, 0x08, 0x3e, 0x10, 0x3e, 0x10, 0xc1, 0x3e,
+	0x10, 0xc1, 0x3e, 0x10, 0xc1, 0x3e, 0x10, 0xc1, 0x3e, 0x10, 0xc1, 0x3e, 0x10, 0xc1, 0x3e, 0xc0,
+	0xfe, 0x42, 0x18, 0x00, 0x19, 0x00, 0x31, 0x00, 0x19, 0x00, 0x31, 0x00, 0x19, 0x00, 0x31, 0x00,
+	0x19, 0x00, 0x31, 0x00, 0x19, 0x00, 0x31, 0x00, 0x19, 0x00, 0x31, 0x00, 0x19, 0x00, 0x31, 0x00,
+	0x19, 0x00, 0x31, 0x00, 0x19, 0xe0, 0x31, 0xe0, 0x19, 0x00, 0x31, 0x00, 0x19, 0x00, 0x31, 0x00,
+	0x19, 0x00, 0x31, 0x00, 0x19, 0x00, 0x31, 0x00, 0x19, 0x00, 0x31, 0x00, 0x19, 0x00, 0x31, 0x00,
+	0x19, 0x0a, 0x25, 0x10, 0x3e, 0x10, 0xc1, 0x3e, 0x10, 0xc1, 0x3e, 0x10, 0xc1, 0x3e, 0x10, 0xc1,
+	0x3e, 0x10, 0xc1, 0x3e, 0x10, 0xc1, 0x3e, 0x10, 0xc0, 0x13, 0x9f, 0x26, 0x00, 0x31, 0x00, 0x19,
+	0x00, 0x31, 0x00, 0x19, 0x00, 0x19, 0x00, 0xfe, 0xbf, 0xff, 0xfd, 0xd7, 0xa1, 0x00, 0xdf, 0xd6,
+	0xfe, 0x24, 0x21, 0x98, 0x99, 0x00, 0x07, 0x00, 0x07, 0x00, 0x07, 0x00, 0x07, 0x00, 0xc0, 0xfe,
+	0xc7, 0xa0, 0xa2, 0xeb, 0x10, 0x25, 0xe0, 0x25, 0x10, 0x25, 0xe0, 0x25, 0x10, 0x25, 0xe0, 0x25,
+	0x10, 0x25, 0xe0, 0x25, 0x10, 0x25, 0xe0, 0x25, 0x10, 0x25, 0xe0, 0x25, 0x10, 0xa1, 0xca, 0x00,
+	0x07, 0x00, 0x07, 0x00, 0x07, 0x00, 0x07, 0x00, 0x07, 0x00, 0x07, 0x00, 0x07, 0x00, 0x07, 0x00,
+	0x07, 0x00, 0x07, 0x00, 0x07, 0x00, 0x07, 0x00, 0x07, 0x00, 0x07, 0x00, 0x07, 0x00, 0x07, 0x00,
+	0x07, 0x00, 0x07, 0x00, 0x07, 0x00, 0x07, 0x00, 0x07, 0x00, 0x07, 0x00, 0x07, 0x00, 0x07, 0x00,
+	0x07, 0x00, 0x07, 0x00, 0x07, 0x00, 0x07, 0x00, 0x07, 0x00, 0x07, 0x00, 0x07, 0x00, 0xa1, 0xc9,
+	0x05, 0x25, 0x10, 0x25, 0xe0, 0x25, 0x10, 0x25, 0xe0, 0x25, 0x10, 0x25, 0xe0, 0x25, 0x10, 0x25,
+	0xe0, 0x25, 0x10, 0x25, 0xe0, 0x25, 0x10, 0x25, 0xe0, 0x25, 0x10, 0xc0, 0xa1, 0xb9, 0x9d, 0x07,
+	0x00, 0x07, 0x00, 0x07, 0x00, 0x07, 0x00, 0x07, 0x00, 0x07, 0x00, 0x03, 0x18, 0xdf, 0xd5, 0x8f,
+	0x00, 0xdf, 0xd6, 0x35, 0x00, 0x07, 0x00, 0x19, 0x00, 0x31, 0x00, 0x19, 0x00, 0x31, 0xe0, 0xc0,
+	0xfe, 0x64, 0x68, 0x33, 0x10, 0x3e, 0x10, 0xc1, 0x3e, 0x10, 0xc1, 0x3e, 0x10, 0xc1, 0x3e, 0x10,
+	0xc1, 0x3e, 0x10, 0xc1, 0x3e, 0x10, 0x3e, 0x2c, 0xe0, 0xc0, 0x31, 0x00, 0x19, 0x00, 0x31, 0x00,
+	0x19, 0x00, 0x31, 0x00, 0x19, 0x00, 0x31, 0x00, 0x19, 0x00, 0x31, 0x00, 0x19, 0x00, 0x31, 0x00,
+	0x19, 0x00, 0x31, 0x00, 0x19, 0x00, 0x31, 0x00, 0x19, 0x00, 0x31, 0x00, 0x19, 0x00, 0x31, 0x00,
+	0x19, 0x00, 0x31, 0x00, 0x19, 0x00, 0x31, 0x00, 0x19, 0x00, 0x31, 0x00, 0x19, 0x00, 0x31, 0x00,
+	0x19, 0x00, 0x31, 0x00, 0x19, 0x00, 0x31, 0x00, 0xe0, 0x10, 0xc1, 0x3e, 0x10, 0xc1, 0x3e, 0x10,
+	0xc1, 0x3e, 0x10, 0xc1, 0x3e, 0x10, 0xc1, 0x3e, 0x10, 0xc1, 0x3e, 0x10, 0xc0, 0x25, 0x0d, 0x00,
+	0x31, 0x00, 0x19, 0x00, 0x31, 0x00, 0x19, 0x00, 0x19, 0x00, 0xfe, 0xdb, 0xde, 0x18, 0xdf, 0xd6,
+	0x97, 0x00, 0xdf, 0xd7, 0x35, 0x00, 0x07, 0x00, 0x07, 0x00, 0x07, 0x00, 0x07, 0x00, 0x07, 0xe0,
+	0x07, 0x31, 0x22, 0x13, 0xe1, 0x25, 0x10, 0x25, 0xe0, 0x25, 0x10, 0x25, 0xe0, 0x25, 0x10, 0x25,
+	0xe0, 0x25, 0x10, 0x25, 0xe0, 0x25, 0x10, 0x25, 0xc0, 0x1c, 0xe0, 0x07, 0x00, 0x07, 0x00, 0x07,
+	0x00, 0x07, 0x00, 0x07, 0x00, 0x07, 0x00, 0x07, 0x00, 0x07, 0x00, 0x07, 0x00, 0x07, 0x00, 0x07,
+	0x00, 0x07, 0x00, 0x07, 0x00, 0x07, 0x00, 0x07, 0x00, 0x07, 0x00, 0x07, 0x00, 0x07, 0x00, 0x07,
+	0x00, 0x07, 0x00, 0x07, 0x00, 0x07, 0x00, 0x07, 0x00, 0x07, 0x00, 0x07, 0x00, 0x07, 0x00, 0x07,
+	0x00, 0x07, 0x00, 0x07, 0x00, 0x07, 0x00, 0x07, 0x00, 0x07, 0xfe, 0x86, 0x78, 0x25, 0xe0, 0x25,
+	0x10, 0x25, 0xe0, 0x25, 0x10, 0x25, 0xe0, 0x25, 0x10, 0x25, 0xe0, 0x25, 0x10, 0x25, 0xe0, 0x25,
+	0x10, 0x25, 0xe0, 0x25, 0x10, 0x33, 0x2c, 0x31, 0x00, 0x07, 0x00, 0x07, 0x00, 0x07, 0x00, 0x07,
+	0x00, 0x07, 0x00, 0xfe, 0x9a, 0xd6, 0x18, 0xdf, 0xd7, 0x93, 0x00, 0xdf, 0xd8, 0x03, 0xfe, 0x80,
+	0x08, 0x07, 0x00, 0x19, 0x00, 0x31, 0x00, 0x19, 0x00, 0x31, 0x00, 0x07, 0x00, 0xfe, 0x43, 0x48,
+	0xfe, 0xc8, 0xb8, 0x05, 0x10, 0xc1, 0x3e, 0x10, 0xc1, 0x3e, 0x10, 0xc1, 0x3e, 0x10, 0xc1, 0x3e,
+	0x10, 0xc1, 0x45, 0x00, 0x31, 0x00, 0x19, 0x00, 0x31, 0x00, 0x19, 0x00, 0x31, 0x00, 0x19, 0x00,
+	0x31, 0x00, 0x19, 0x00, 0x31, 0x00, 0x19, 0x00, 0x31, 0x00, 0x19, 0x00, 0x31, 0x00, 0x19, 0x00,
+	0x31, 0x00, 0x19, 0x00, 0x31, 0x00, 0x19, 0x00, 0x31, 0x00, 0x19, 0x00, 0x31, 0x00, 0x19, 0x00,
+	0x31, 0x00, 0x19, 0x00, 0x31, 0x00, 0x19, 0x00, 0x31, 0x00, 0x19, 0x00, 0x31, 0x00, 0x19, 0x00,
+	0x31, 0x00, 0x19, 0x00, 0xc0, 0xfe, 0xea, 0xd8, 0x3e, 0x10, 0xc1, 0x3e, 0x10, 0xc1, 0x3e, 0x10,
+	0xc1, 0x3e, 0x10, 0xc1, 0x3e, 0x10, 0xc2, 0xa0, 0xa8, 0x05, 0x38, 0x00, 0xc0, 0x31, 0x00, 0x19,
+	0x00, 0x31, 0x00, 0x19, 0x00, 0x19, 0x00, 0xfe, 0x7a, 0xd6, 0xac, 0x77, 0xdf, 0xd8, 0x93, 0x00,
+	0xdf, 0xda, 0xfe, 0x29, 0x4a, 0x07, 0x00, 0x07, 0x00, 0x07, 0x00, 0x07, 0x00, 0x07, 0x00, 0x07,
+	0x00, 0xc0, 0x1c, 0xe0, 0x05, 0xc0, 0x10, 0x25, 0xe0, 0x25, 0x10, 0x25, 0xe0, 0x25, 0x10, 0x25,
+	0xe0, 0x25, 0x10, 0x25, 0x3e, 0xe0, 0x31, 0x07, 0x00, 0x07, 0x00, 0x07, 0x00, 0x07, 0x00, 0x07,
+	0x00, 0x07, 0x00, 0x07, 0x00, 0x07, 0x00, 0x07, 0x00, 0x07, 0x00, 0x07, 0x00, 0x07, 0x00, 0x07,
+	0x00, 0x07, 0x00, 0x07, 0x00, 0x07, 0x00, 0x07, 0x00, 0x07, 0x00, 0x07, 0x00, 0x07, 0x00, 0x07,
+	0x00, 0x07, 0x00, 0x07, 0x00, 0x07, 0x00, 0x07, 0x00, 0x07, 0x00, 0x07, 0x00, 0x07, 0x00, 0x07,
+	0x00, 0x07, 0x00, 0x07, 0x00, 0x07, 0x00, 0x07, 0xe0, 0x1c, 0x33, 0x25, 0xe0, 0x25, 0x10, 0x25,
+	0xe0, 0x25, 0x10, 0x25, 0xe0, 0x25, 0x10, 0x25, 0xe0, 0x25, 0x10, 0x25, 0xe0, 0x05, 0x3e, 0x1b,
+	0x00, 0x07, 0xe0, 0x07, 0x00, 0x07, 0x00, 0x07, 0x00, 0x07, 0x00, 0x07, 0x00, 0xfe, 0xbb, 0xde,
+	0x18, 0xdf, 0xd9, 0x7c, 0x00, 0xdf, 0xdb, 0x2b, 0xe0, 0xc0, 0x19, 0x00, 0x31, 0x00, 0x19, 0x00,
+	0x31, 0x00, 0x19, 0xe0, 0x31, 0x00, 0x31, 0xfe, 0xa7, 0xa0, 0x3e, 0xc0, 0x05, 0x10, 0xc6, 0x3e,
+	0x13, 0x3e, 0x37, 0x00, 0xe0, 0x00, 0x19, 0x00, 0x31, 0x00, 0x19, 0x00, 0x31, 0x00, 0x19, 0x00,
+	0x31, 0x00, 0x19, 0x00, 0x31, 0x00, 0x19, 0x00, 0x31, 0x00, 0x19, 0x00, 0x31, 0x00, 0x19, 0x00,
+	0xc5, 0x31, 0x00, 0xc1, 0x31, 0x00, 0xc7, 0x31, 0x00, 0x19, 0x00, 0x31, 0x00, 0x19, 0x00, 0x31,
+	0x00, 0x19, 0x00, 0x31, 0x00, 0x19, 0x00, 0x31, 0x00, 0x19, 0x00, 0xa2, 0xc9, 0x3e, 0x13, 0x10,
+	0xc1, 0x3e, 0x10, 0xc1, 0x3e, 0x10, 0xc3, 0x7b, 0x3e, 0xe0, 0xfe, 0x64, 0x60, 0x00, 0xc0, 0x19,
+	0x00, 0x31, 0x00, 0x19, 0x00, 0x31, 0x00, 0x19, 0x00, 0x19, 0xac, 0x87, 0x02, 0xa9, 0x88, 0xdf,
+	0xda, 0x96, 0x00, 0xdf, 0xdc, 0x86, 0x99, 0xe0, 0x31, 0x7b, 0x00, 0x07, 0x00, 0x07, 0x00, 0x07,
+	0x00, 0x07, 0x00, 0x07, 0x00, 0xc1, 0x31, 0xfe, 0x65, 0x60, 0xfe, 0xc8, 0xa8, 0xe0, 0x25, 0x3e,
+	0x6f, 0xe0, 0x17, 0x3e, 0x9f, 0x48, 0x2d, 0x31, 0x00, 0x07, 0x00, 0x07, 0x00, 0x07, 0x00, 0x07,
+	0x00, 0x07, 0x00, 0x07, 0x00, 0x07, 0x00, 0x07, 0x00, 0x07, 0x00, 0x07, 0x00, 0x07, 0x00, 0x07,
+	0x00, 0x31, 0x00, 0xa1, 0xda, 0xa0, 0xb8, 0xa3, 0xca, 0x14, 0xa1, 0xa9, 0x3e, 0x17, 0x65, 0x05,
+	0x10, 0x17, 0x13, 0x05, 0x25, 0x17, 0x3e, 0x10, 0x5a, 0x2c, 0x09, 0x49, 0x2d, 0x26, 0x00, 0xc1,
+	0x19, 0x00, 0x07, 0x00, 0x07, 0x00, 0x07, 0x00, 0x07, 0x00, 0x07, 0x00, 0x07, 0x00, 0x07, 0x00,
+	0x07, 0x00, 0xc0, 0xfe, 0x86, 0x88, 0x25, 0x3e, 0x7f, 0x25, 0x17, 0xe0, 0x17, 0xe0, 0x17, 0x3e,
+	0x05, 0x3e, 0x05, 0x9d, 0x16, 0x31, 0x00, 0x07, 0xe0, 0x07, 0x00, 0x07, 0x00, 0x07, 0x00, 0x07,
+	0x00, 0x07, 0x00, 0xc0, 0x32, 0x35, 0x18, 0xdf, 0xdb, 0x7f, 0x00, 0xdf, 0xdd, 0x98, 0x88, 0xfe,
+	0x82, 0x10, 0x00, 0x19, 0x00, 0x6e, 0x00, 0x19, 0x00, 0x31, 0x00, 0x19, 0x00, 0x31, 0xe0, 0x19,
+	0x00, 0x31, 0x00, 0xc7, 0x19, 0x00, 0x31, 0x00, 0x19, 0x00, 0x31, 0x00, 0x19, 0x00, 0x31, 0x00,
+	0x19, 0x00, 0x31, 0x00, 0x19, 0x00, 0x31, 0x00, 0x19, 0x00, 0xc2, 0xa1, 0xfa, 0xa3, 0xfb, 0x33,
+	0x25, 0x3e, 0xa1, 0xa9, 0x3e, 0x10, 0xc6, 0x3e, 0x10, 0xc1, 0xe1, 0xc3, 0x33, 0x01, 0x05, 0x9f,
+	0x67, 0x26, 0x9e, 0x46, 0xe0, 0xc2, 0x19, 0x00, 0x31, 0x00, 0x19, 0x00, 0x31, 0x00, 0x19, 0x00,
+	0x31, 0x00, 0x19, 0xe0, 0xc1, 0x31, 0xa1, 0xea, 0x09, 0xc0, 0xa1, 0xca, 0x2c, 0x1a, 0x9e, 0x47,
+	0xa0, 0x47, 0x9e, 0x36, 0x31, 0x00, 0xc1, 0x31, 0x00, 0x19, 0x00, 0x31, 0x00, 0x19, 0x00, 0x31,
+	0x00, 0x19, 0x00, 0xc0, 0xfe, 0xf4, 0xa4, 0x18, 0xdf, 0xdd, 0x87, 0x00, 0xdf, 0xdf, 0x24, 0x00,
+	0x07, 0x00, 0x07, 0x00, 0x07, 0x00, 0x07, 0x00, 0x07, 0x00, 0x07, 0x00, 0x07, 0x00, 0x07, 0xe0,
+	0x07, 0xe0, 0x07, 0xe0, 0x07, 0xe0, 0x07, 0x00, 0x07, 0x00, 0x07, 0x00, 0x07, 0x00, 0x07, 0x00,
+	0x07, 0x00, 0x07, 0x00, 0x07, 0x00, 0x07, 0x00, 0x07, 0x00, 0x07, 0x00, 0xa1, 0xd9, 0xa2, 0xca,
+	0x3b, 0x25, 0xa1, 0xb9, 0x10, 0x25, 0x10, 0x25, 0x10, 0x25, 0xe0, 0x25, 0xe0, 0x25, 0xe0, 0x25,
+	0xe0, 0x25, 0x10, 0x25, 0xe0, 0x25, 0x10, 0x25, 0xe0, 0x25, 0xe0, 0x25, 0x10, 0x25, 0x10, 0x25,
+	0x10, 0x33, 0x13, 0xa0, 0x47, 0x1b, 0x9e, 0x16, 0x00, 0x07, 0x00, 0x07, 0x00, 0x07, 0x00, 0x07,
+	0x00, 0x07, 0x00, 0x07, 0x00, 0x07, 0xe0, 0x07, 0x00, 0x07, 0x00, 0xc5, 0x07, 0x00, 0x07, 0xe0,
+	0x07, 0x00, 0x07, 0x00, 0x07, 0x00, 0x07, 0x00, 0x07, 0x00, 0x07, 0x00, 0x0f, 0xfe, 0x1c, 0xe7,
+	0x18, 0xdf, 0xde, 0x82, 0x00, 0xdf, 0xdf, 0xc0, 0x98, 0x99, 0xfe, 0xa6, 0x31, 0xe0, 0xc0, 0x31,
+	0x00, 0x19, 0x00, 0x31, 0x00, 0x19, 0x00, 0x31, 0x00, 0x19, 0x00, 0x31, 0x00, 0x19, 0x00, 0x31,
+	0x00, 0x19, 0x00, 0x31, 0x00, 0x19, 0x00, 0x31, 0x00, 0x19, 0x00, 0x31, 0x00, 0x19, 0x00, 0x31,
+	0x00, 0x19, 0x00, 0x31, 0x00, 0xc0, 0xa2, 0xfa, 0x1a, 0x01, 0x05, 0x10, 0xc1, 0x3e, 0x10, 0xc1,
+	0x3e, 0x10, 0xc1, 0x3e, 0x10, 0xc1, 0x3e, 0x10, 0xc1, 0x3e, 0x10, 0xc1, 0x3e, 0x10, 0xc1, 0x3e,
+	0x10, 0xc1, 0x3e, 0x10, 0xc1, 0x25, 0x13, 0x29, 0xfe, 0x42, 0x38, 0xe0, 0xc0, 0x31, 0x00, 0x19,
+	0x00, 0x31, 0x00, 0x19, 0x00, 0x31, 0x00, 0x19, 0x00, 0x31, 0x00, 0x19, 0xe0, 0x31, 0xe0, 0x19,
+	0xe0, 0x31, 0x00, 0x19, 0x00, 0x31, 0x00, 0x19, 0x00, 0x31, 0x00, 0x19, 0x00, 0x31, 0x00, 0xc0,
+	0xa4, 0x88, 0x02, 0x18, 0xdf, 0xdf, 0xc0, 0x86, 0x00, 0xdf, 0xdf, 0xc2, 0x90, 0x99, 0xfe, 0x66,
+	0x31, 0x00, 0x7f, 0x00, 0x07, 0x00, 0x07, 0x00, 0x07, 0x00, 0x07, 0x00, 0x07, 0x00, 0x07, 0x00,
+	0x07, 0x00, 0x07, 0x00, 0x07, 0x00, 0x07, 0x00, 0x07, 0x00, 0x07, 0x00, 0x07, 0x00, 0x07, 0x00,
+	0x07, 0x00, 0x07, 0x00, 0x19, 0x2e, 0xfe, 0xa6, 0x78, 0x10, 0x05, 0x10, 0x25, 0x10, 0x25, 0xe0,
+	0x25, 0x10, 0x25, 0xe0, 0x25, 0x10, 0x25, 0xe0, 0x25, 0x10, 0x25, 0xe0, 0x25, 0x10, 0x25, 0xe0,
+	0x25, 0x10, 0x25, 0xe0, 0x25, 0x10, 0x25, 0xe0, 0x25, 0x10, 0x25, 0xe0, 0x25, 0x10, 0x25, 0xe0,
+	0x25, 0x10, 0x25, 0x10, 0x33, 0x1a, 0x23, 0x00, 0x07, 0x00, 0x07, 0x00, 0x07, 0x00, 0x07, 0x00,
+	0x07, 0x00, 0x07, 0x00, 0x07, 0x00, 0x07, 0x00, 0x07, 0x00, 0x07, 0x00, 0x07, 0x00, 0x07, 0x00,
+	0x07, 0x00, 0x07, 0x00, 0x07, 0x00, 0x07, 0x00, 0xc0, 0xb7, 0x99, 0x18, 0xdf, 0xdf, 0xc2, 0x76,
+	0x00, 0xdf, 0xdf, 0xc4, 0x92, 0x99, 0x81, 0x88, 0x39, 0x9b, 0x88, 0x19, 0x00, 0x6e, 0x00, 0x19,
+	0x00, 0x31, 0x00, 0x19, 0x00, 0x31, 0x00, 0x19, 0x00, 0x31, 0x00, 0x19, 0x00, 0x31, 0x00, 0x19,
+	0x00, 0x31, 0x00, 0x19, 0x00, 0x31, 0x00, 0x19, 0x00, 0xc0, 0x38, 0x21, 0x10, 0xc1, 0x3e, 0x10,
+	0xc1, 0x3e, 0x10, 0xc1, 0x3e, 0x10, 0xc1, 0x3e, 0x10, 0xc1, 0x3e, 0x10, 0xc1, 0x3e, 0x10, 0xc1,
+	0x3e, 0x10, 0xc1, 0x3e, 0x10, 0xc1, 0x3e, 0x10, 0xc1, 0x3e, 0x10, 0xc1, 0x3e, 0x10, 0xc0, 0x33,
+	0x3f, 0x00, 0x31, 0x00, 0x19, 0x00, 0x31, 0x00, 0x19, 0x00, 0x31, 0x00, 0x19, 0x00, 0x31, 0x00,
+	0x19, 0x00, 0x31, 0x00, 0x19, 0x00, 0x31, 0x00, 0x19, 0x00, 0x31, 0x00, 0x19, 0x00, 0xc0, 0xa9,
+	0x99, 0xb7, 0x88, 0x18, 0xdf, 0xdf, 0xc4, 0x7e, 0x00, 0xdf, 0xdf, 0xc6, 0x66, 0xfe, 0xc1, 0x10,
+	0x00, 0x07, 0x00, 0x07, 0x00, 0x07, 0x00, 0x07, 0x00, 0x07, 0x00, 0x07, 0x00, 0x07, 0x00, 0x07,
+	0x00, 0x07, 0x00, 0x07, 0x00, 0x07, 0x00, 0x07, 0x00, 0x07, 0x00, 0x07, 0x00, 0xc0, 0xfe, 0xe9,
+	0xb8, 0x05, 0x10, 0x25, 0xe0, 0x25, 0x10, 0x25, 0xe0, 0x25, 0x10, 0x25, 0xe0, 0x25, 0x10, 0x25,
+	0xe0, 0x25, 0x10, 0x25, 0xe0, 0x25, 0x10, 0x25, 0xe0, 0x25, 0x10, 0x25, 0xe0, 0x25, 0x10, 0x25,
+	0xe0, 0x25, 0x10, 0x25, 0xe0, 0x25, 0x10, 0x25, 0xe0, 0x25, 0x10, 0x25, 0xe0, 0x25, 0x10, 0x25,
+	0xe0, 0x25, 0xc0, 0x9d, 0x06, 0x00, 0x07, 0x00, 0x07, 0x00, 0x07, 0x00, 0x07, 0x00, 0x07, 0x00,
+	0x07, 0x00, 0x07, 0x00, 0x07, 0x00, 0x07, 0x00, 0x07, 0x00, 0x07, 0x00, 0x07, 0x00, 0x07, 0x00,
+	0xa2, 0x88, 0x3b, 0x18, 0xdf, 0xdf, 0xc6, 0x6b, 0x00, 0xdf, 0xdf, 0xc8, 0x8b, 0x99, 0x00, 0x19,
+	0x00, 0x31, 0x00, 0x19, 0x00, 0x31, 0x00, 0x19, 0x00, 0x31, 0x00, 0x19, 0x00, 0x31, 0x00, 0x19,
+	0x00, 0x31, 0x00, 0x19, 0x00, 0x31, 0x00, 0x19, 0x00, 0xc0, 0xfe, 0xe9, 0xd0, 0x3e, 0x10, 0xc1,
+	0x3e, 0x10, 0xc1, 0x3e, 0x10, 0xc1, 0x3e, 0x10, 0xc1, 0x3e, 0x10, 0xc1, 0x3e, 0x10, 0xc1, 0x3e,
+	0x10, 0xc1, 0x3e, 0x10, 0xc1, 0x3e, 0x10, 0xc1, 0x3e, 0x10, 0xc1, 0x3e, 0x10, 0xc1, 0x3e, 0x10,
+	0xc1, 0x3e, 0x10, 0xc0, 0x13, 0x19, 0x00, 0x31, 0x00, 0x19, 0x00, 0x31, 0x00, 0x19, 0x00, 0x31,
+	0x00, 0x19, 0x00, 0x31, 0x00, 0x19, 0x00, 0x31, 0x00, 0x19, 0x00, 0x31, 0x00, 0x19, 0x00, 0x31,
+	0x18, 0xdf, 0xdf, 0xc8, 0x75, 0x00, 0xdf, 0xdf, 0xca, 0x00, 0xc1, 0x07, 0x00, 0x07, 0x00, 0x07,
+	0x00, 0x07, 0x00, 0x07, 0x00, 0x07, 0x00, 0x07, 0x00, 0x07, 0x00, 0x07, 0x00, 0x07, 0x00, 0x07,
+	0x00, 0xc0, 0xfe, 0xc8, 0xb8, 0xa2, 0x99, 0x10, 0x25, 0xe0, 0x25, 0x10, 0x25, 0xe0, 0x25, 0x10,
+	0x25, 0xe0, 0x25, 0x10, 0x25, 0xe0, 0x25, 0x10, 0x25, 0xe0, 0x25, 0x10, 0x25, 0xe0, 0x25, 0x10,
+	0x25, 0xe0, 0x25, 0x10, 0x25, 0xe0, 0x25, 0x10, 0x25, 0xe0, 0x25, 0x10, 0x25, 0xe0, 0x25, 0x10,
+	0x25, 0xe0, 0x25, 0x10, 0x25, 0xe0, 0x25, 0x10, 0x25, 0xe0, 0x17, 0x37, 0xe0, 0xc0, 0x07, 0x00,
+	0x07, 0x00, 0x07, 0x00, 0x07, 0x00, 0x07, 0x00, 0x07, 0x00, 0x07, 0x00, 0x07, 0x00, 0x07, 0x00,
+	0x07, 0x00, 0x07, 0x00, 0xfe, 0x76, 0xb5, 0x18, 0xdf, 0xdf, 0xc9, 0x60, 0x00, 0xdf, 0xdf, 0xcb,
+	0x32, 0xe0, 0xc0, 0x31, 0x00, 0x19, 0x00, 0x31, 0x00, 0x19, 0x00, 0x31, 0x00, 0x19, 0x00, 0x31,
+	0x00, 0x19, 0x00, 0x31, 0x00, 0x19, 0x00, 0x31, 0xc0, 0x25, 0x10, 0xc1, 0x3e, 0x10, 0xc1, 0x3e,
+	0x10, 0xc1, 0x3e, 0x10, 0xc1, 0x3e, 0x10, 0xc1, 0x3e, 0x10, 0xc1, 0x3e, 0x10, 0xc1, 0x3e, 0x10,
+	0xc1, 0x3e, 0x10, 0xc1, 0x3e, 0x10, 0xc1, 0x3e, 0x10, 0xc1, 0x3e, 0x10, 0xc1, 0x3e, 0x10, 0xc1,
+	0x3e, 0x10, 0xc0, 0xe0, 0x19, 0x00, 0x31, 0x00, 0x19, 0x00, 0x31, 0x00, 0x19, 0x00, 0x31, 0x00,
+	0x19, 0x00, 0x31, 0x00, 0x19, 0x00, 0x31, 0x00, 0xc1, 0x18, 0xdf, 0xdf, 0xcb, 0x72, 0x00, 0xdf,
+	0xdf, 0xcc, 0x93, 0x99, 0xe0, 0xc0, 0x07, 0x00, 0x07, 0x00, 0x07, 0x00, 0x07, 0x00, 0x07, 0x00,
+	0x07, 0x00, 0x07, 0x00, 0x07, 0x00, 0x07, 0x00, 0x07, 0x00, 0xa2, 0x78, 0x3e, 0x25, 0xe0, 0x25,
+	0x59, 0x25, 0xe0, 0x25, 0x10, 0x25, 0xe0, 0x25, 0x10, 0x25, 0xe0, 0x25, 0x10, 0x25, 0xe0, 0x25,
+	0x10, 0x25, 0xe0, 0x25, 0x10, 0x25, 0xe0, 0x25, 0x10, 0x25, 0xe0, 0x25, 0x10, 0x25, 0xe0, 0x25,
+	0x10, 0x25, 0xe0, 0x25, 0x10, 0x25, 0xe0, 0x25, 0x10, 0x25, 0xe0, 0x25, 0x10, 0x25, 0xe0, 0x25,
+	0x10, 0x05, 0xfe, 0x64, 0x58, 0x07, 0x00, 0x07, 0x00, 0x07, 0x00, 0x07, 0x00, 0x07, 0x00, 0x07,
+	0x00, 0x07, 0x00, 0x07, 0x00, 0x07, 0x00, 0x07, 0x00, 0xc0, 0xfe, 0x92, 0x94, 0x18, 0xdf, 0xdf,
+	0xcc, 0x60, 0x00, 0xdf, 0xdf, 0xcd, 0x51, 0xfe, 0x29, 0x4a, 0x00, 0x31, 0x00, 0x19, 0x00, 0x31,
+	0x00, 0x19, 0x00, 0x31, 0x00, 0x19, 0x00, 0x31, 0x00, 0x19, 0x00, 0x31, 0x00, 0x19, 0x00, 0x05,
+	0x10, 0x3e, 0x10, 0xc1, 0x3e, 0x10, 0xc1, 0x3e, 0x10, 0xc1, 0x3e, 0x10, 0xc1, 0x3e, 0x10, 0xc1,
+	0x3e, 0x10, 0xc1, 0x3e, 0x10, 0xc1, 0x3e, 0x10, 0xc1, 0x3e, 0x10, 0xc1, 0x3e, 0x10, 0xc1, 0x3e,
+	0x10, 0xc1, 0x3e, 0x10, 0xc1, 0x3e, 0x10, 0xc0, 0x13, 0x00, 0xc0, 0x31, 0x00, 0x19, 0x00, 0x31,
+	0x00, 0x19, 0x00, 0x31, 0x00, 0x19, 0x00, 0x31, 0x00, 0x19, 0x00, 0x31, 0x00, 0xc0, 0x1f, 0x18,
+	0xdf, 0xdf, 0xcd, 0x6a, 0x00, 0xdf, 0xdf, 0xcf, 0x3b, 0x00, 0x07, 0x00, 0x07, 0x00, 0x07, 0x00,
+	0x07, 0x00, 0x07, 0x00, 0x07, 0x00, 0x07, 0x00, 0x07, 0x00, 0x07, 0x00, 0x07, 0xfe, 0xc8, 0xa8,
+	0x17, 0x10, 0x25, 0xe0, 0x25, 0x10, 0x25, 0xe0, 0x25, 0x10, 0x25, 0xe0, 0x25, 0x10, 0x25, 0xe0,
+	0x25, 0x10, 0x25, 0xe0, 0x25, 0x10, 0x25, 0xe0, 0x25, 0x10, 0x25, 0xe0, 0x25, 0x10, 0x25, 0xe0,
+	0x25, 0x10, 0x25, 0xe0, 0x25, 0x10, 0x25, 0xe0, 0x25, 0x10, 0x25, 0xe0, 0x25, 0x10, 0x25, 0xe0,
+	0x25, 0x10, 0x25, 0x13, 0xfe, 0x85, 0x68, 0xe0, 0x07, 0x00, 0x07, 0x00, 0x07, 0x00, 0x07, 0x00,
+	0x07, 0x00, 0x07, 0x00, 0x07, 0x00, 0x07, 0x00, 0x07, 0x00, 0x02, 0x18, 0xdf, 0xdf, 0xcf, 0x5a,
+	0x00, 0xdf, 0xdf, 0xd1, 0x88, 0x88, 0xe0, 0x31, 0x19, 0x00, 0x31, 0x00, 0x19, 0x00, 0x31, 0x00,
+	0x19, 0x00, 0x31, 0x00, 0x19, 0x00, 0x31, 0x00, 0xc0, 0x3e, 0xe0, 0xc0, 0x3e, 0x10, 0xc1, 0x3e,
+	0x10, 0xc1, 0x3e, 0x10, 0xc1, 0x3e, 0x10, 0xc1, 0x3e, 0x10, 0xc1, 0x3e, 0x10, 0xc1, 0x3e, 0x10,
+	0xc1, 0x3e, 0x10, 0xc1, 0x3e, 0x10, 0xc1, 0x3e, 0x10, 0xc1, 0x3e, 0x10, 0xc1, 0x3e, 0x10, 0xc2,
+	0x00, 0x31, 0x00, 0x19, 0x00, 0x31, 0x00, 0x19, 0x00, 0x31, 0x00, 0x19, 0x00, 0x31, 0x00, 0x19,
+	0x00, 0xc0, 0xb0, 0x88, 0xfe, 0x9e, 0xf7, 0x18, 0xdf, 0xdf, 0xd0, 0x61, 0x00, 0xdf, 0xdf, 0xd2,
+	0x2d, 0x81, 0x99, 0x00, 0x7f, 0x00, 0x07, 0x00, 0x07, 0x00, 0x07, 0x00, 0x07, 0x00, 0x07, 0x00,
+	0x07, 0x00, 0x07, 0xe0, 0x2a, 0x13, 0x5a, 0x10, 0x25, 0xe0, 0x25, 0x10, 0x25, 0xe0, 0x25, 0x10,
+	0x25, 0xe0, 0x25, 0x10, 0x25, 0xe0, 0x25, 0x10, 0x25, 0xe0, 0x25, 0x10, 0x25, 0xe0, 0x25, 0x10,
+	0x25, 0xe0, 0x25, 0x10, 0x25, 0xe0, 0x25, 0x10, 0x25, 0xe0, 0x25, 0x10, 0x25, 0xe0, 0x25, 0x10,
+	0x25, 0xe0, 0x25, 0x10, 0x25, 0xe0, 0x17, 0x00, 0x07, 0x00, 0x07, 0x00, 0x07, 0x00, 0x07, 0x00,
+	0x07, 0x00, 0x07, 0x00, 0x07, 0x00, 0x07, 0x00, 0xc0, 0x3b, 0x18, 0xdf, 0xdf, 0xd2, 0x55, 0x00,
+	0xdf, 0xdf, 0xd4, 0x3b, 0xfe, 0x8a, 0x52, 0xe0, 0xc0, 0x31, 0x00, 0x19, 0x00, 0x31, 0x00, 0x19,
+	0x00, 0x31, 0x00, 0x19, 0x00, 0x31, 0x00, 0xa3, 0xfa, 0xfe, 0xea, 0xd8, 0xe0, 0xc0, 0x3e, 0x10,
+	0xc1, 0x3e, 0x10, 0xc1, 0x3e, 0x10, 0xc1, 0x3e, 0x10, 0xc1, 0x3e, 0x10, 0xc1, 0x3e, 0x10, 0xc1,
+	0x3e, 0x10, 0xc1, 0x3e, 0x10, 0xc1, 0x3e, 0x10, 0xc1, 0x3e, 0x10, 0xc1, 0x3e, 0x10, 0xc1, 0x25,
+	0x00, 0x31, 0x00, 0x19, 0x00, 0x31, 0x00, 0x19, 0x00, 0x31, 0x00, 0x19, 0x00, 0x31, 0x00, 0xc1,
+	0x1e, 0x18, 0xdf, 0xdf, 0xd4, 0x5c, 0x00, 0xdf, 0xdf, 0xd6, 0x97, 0x99, 0x32, 0x00, 0x07, 0x00,
+	0x07, 0x00, 0x07, 0x00, 0x07, 0x00, 0x07, 0x00, 0x07, 0x00, 0x07, 0x2e, 0xa3, 0xfa, 0x13, 0x25,
+	0x10, 0x25, 0xe0, 0x25, 0x10, 0x25, 0xe0, 0x25, 0x10, 0x25, 0xe0, 0x25, 0x10, 0x25, 0xe0, 0x25,
+	0x10, 0x25, 0xe0, 0x25, 0x10, 0x25, 0xe0, 0x25, 0x10, 0x25, 0xe0, 0x25, 0x10, 0x25, 0xe0, 0x25,
+	0x10, 0x25, 0xe0, 0x25, 0x10, 0x25, 0xe0, 0x25, 0x10, 0x25, 0xe0, 0x05, 0x00, 0x07, 0x00, 0x07,
+	0x00, 0x07, 0x00, 0x07, 0x00, 0x07, 0x00, 0x07, 0x00, 0x19, 0x00, 0xc0, 0xfe, 0x18, 0xc6, 0x18,
+	0xdf, 0xdf, 0xd6, 0x52, 0x00, 0xdf, 0xdf, 0xd8, 0x02, 0x82, 0x88, 0xe0, 0xc0, 0x19, 0x00, 0x31,
+	0x00, 0x19, 0x00, 0x31, 0x00, 0x19, 0x00, 0x31, 0x00, 0xa1, 0xda, 0xfe, 0xe9, 0xd0, 0x3e, 0x10,
+	0x3e, 0x10, 0xc1, 0x3e, 0x10, 0xc1, 0x3e, 0x10, 0xc1, 0x3e, 0x10, 0xc1, 0x3e, 0x10, 0xc1, 0x3e,
+	0x10, 0xc1, 0x3e, 0x10, 0xc1, 0x3e, 0x10, 0xc1, 0x3e, 0x10, 0xc1, 0x3e, 0x10, 0xc0, 0x3e, 0xe0,
+	0x00, 0x31, 0x00, 0x19, 0x00, 0x31, 0x00, 0x19, 0x00, 0x31, 0x00, 0x19, 0x00, 0xc0, 0xad, 0x88,
+	0xfe, 0x59, 0xce, 0x18, 0xdf, 0xdf, 0xd8, 0x52, 0x00, 0xdf, 0xdf, 0xda, 0x2d, 0x8b, 0x99, 0x00,
+	0xc1, 0x7f, 0x00, 0x07, 0x00, 0x07, 0x00, 0x07, 0x00, 0x07, 0x2e, 0x31, 0x1a, 0x05, 0x45, 0x25,
+	0xe0, 0x25, 0x10, 0x25, 0xe0, 0x25, 0x10, 0x25, 0xe0, 0x25, 0x10, 0x25, 0xe0, 0x25, 0x10, 0x25,
+	0xe0, 0x25, 0x10, 0x25, 0xe0, 0x25, 0x10, 0x25, 0xe0, 0x25, 0x10, 0x25, 0xe0, 0x25, 0x10, 0x25,
+	0xe0, 0x25, 0x10, 0xc0, 0x05, 0x09, 0x00, 0x07, 0x00, 0x07, 0x00, 0x07, 0x00, 0x07, 0x00, 0x07,
+	0x00, 0xc1, 0xfe, 0x31, 0x8c, 0xb4, 0x88, 0x18, 0xdf, 0xdf, 0xda, 0x49, 0x00, 0xdf, 0xdf, 0xdd,
+	0x91, 0x99, 0x8a, 0x88, 0x00, 0xc1, 0x19, 0x00, 0x31, 0x00, 0x19, 0x00, 0x31, 0x00, 0xc0, 0x14,
+	0x33, 0x10, 0x3e, 0x10, 0xc1, 0x3e, 0x10, 0xc1, 0x3e, 0x10, 0xc1, 0x3e, 0x10, 0xc1, 0x3e, 0x10,
+	0xc1, 0x3e, 0x10, 0xc1, 0x3e, 0x10, 0xc1, 0x3e, 0x10, 0xc1, 0x3e, 0x10, 0x25, 0x3e, 0xfe, 0x64,
+	0x58, 0x00, 0x31, 0x00, 0x19, 0x00, 0x31, 0x00, 0x19, 0x00, 0x31, 0x00, 0xb2, 0x88, 0xb9, 0x88,
+	0xaf, 0x99, 0x18, 0xdf, 0xdf, 0xdc, 0x49, 0x00, 0xdf, 0xdf, 0xdf, 0x66, 0x15, 0xe0, 0xc0, 0x07,
+	0x55, 0x07, 0x00, 0x07, 0x00, 0x07, 0xe0, 0x2e, 0x7f, 0xe0, 0x13, 0x25, 0xe0, 0x25, 0x10, 0x25,
+	0xe0, 0x25, 0x10, 0x25, 0xe0, 0x25, 0x10, 0x25, 0xe0, 0x25, 0x10, 0x25, 0xe0, 0x25, 0x10, 0x25,
+	0xe0, 0x25, 0x10, 0x25, 0xe0, 0x25, 0x10, 0x25, 0xe0, 0x25, 0x10, 0x05, 0x9e, 0x36, 0x00, 0xc0,
+	0x07, 0x00, 0x07, 0x00, 0x07, 0x00, 0x07, 0x00, 0x07, 0x00, 0xfe, 0x39, 0xce, 0x18, 0xdf, 0xdf,
+	0xdf, 0x44, 0x00, 0xdf, 0xdf, 0xdf, 0xc1, 0xfe, 0x65, 0x29, 0xe0, 0xc0, 0x19, 0x00, 0x31, 0x00,
+	0x19, 0x00, 0x31, 0x00, 0x07, 0x00, 0xfe, 0x85, 0x60, 0x10, 0x13, 0x10, 0xc1, 0x3e, 0x10, 0xc1,
+	0x3e, 0x10, 0xc1, 0x3e, 0x10, 0xc1, 0x3e, 0x10, 0xc1, 0x3e, 0x10, 0xc1, 0x3e, 0x10, 0xc1, 0x3e,
+	0xc0, 0xe0, 0x23, 0x00, 0xc0, 0x31, 0x00, 0x19, 0x00, 0x31, 0x00, 0x19, 0x00, 0x19, 0x00, 0xfe,
+	0xdb, 0xde, 0x18, 0xdf, 0xdf, 0xdf, 0xc0, 0x49, 0x00, 0xdf, 0xdf, 0xdf, 0xc2, 0x39, 0xe0, 0xc0,
+	0x07, 0x00, 0x07, 0x00, 0x07, 0x00, 0x07, 0x00, 0x07, 0x00, 0xc0, 0x14, 0xa4, 0xfa, 0x3e, 0x25,
+	0x10, 0x25, 0xe0, 0x25, 0x10, 0x25, 0xe0, 0x25, 0x10, 0x25, 0xe0, 0x25, 0x10, 0x25, 0xe0, 0x25,
+	0x10, 0x25, 0xe0, 0x25, 0x10, 0x25, 0xe0, 0x05, 0x10, 0xfe, 0x42, 0x28, 0x00, 0x07, 0xe0, 0x07,
+	0x00, 0x07, 0x00, 0x07, 0x00, 0x07, 0x00, 0x07, 0x00, 0xfe, 0x7e, 0xf7, 0xa4, 0x77, 0xdf, 0xdf,
+	0xdf, 0xc1, 0x43, 0x00, 0xdf, 0xdf, 0xdf, 0xc3, 0xfe, 0xae, 0x73, 0xe0, 0xc0, 0x19, 0x00, 0x31,
+	0x00, 0x19, 0x00, 0x31, 0x00, 0x19, 0xe0, 0x31, 0x00, 0x3f, 0x08, 0x05, 0x3e, 0xc0, 0x10, 0xc1,
+	0x3e, 0x10, 0xc1, 0x3e, 0x10, 0xc1, 0x3e, 0x10, 0xc1, 0x3e, 0x10, 0x25, 0x13, 0xa0, 0x57, 0x19,
+	0x00, 0xc0, 0x19, 0x00, 0x31, 0x00, 0x19, 0x00, 0x31, 0x00, 0x19, 0x00, 0xc0, 0xab, 0x99, 0xfe,
+	0x5d, 0xef, 0x18, 0xdf, 0xdf, 0xdf, 0xc2, 0x44, 0x00, 0xdf, 0xdf, 0xdf, 0xc4, 0x8b, 0x99, 0xe0,
+	0xc0, 0x07, 0x00, 0x07, 0x00, 0x07, 0x00, 0x07, 0x00, 0x07, 0x00, 0x07, 0x00, 0xc0, 0x31, 0xfe,
+	0xa6, 0x78, 0x22, 0xa1, 0xca, 0x3e, 0x25, 0xe0, 0x25, 0xe0, 0x25, 0x10, 0x25, 0xe0, 0x25, 0x10,
+	0x25, 0x3e, 0x6f, 0x13, 0xe0, 0x29, 0x9f, 0x06, 0x00, 0x07, 0xe0, 0x07, 0x00, 0x07, 0x00, 0x07,
+	0x00, 0x07, 0x00, 0x07, 0x00, 0xc0, 0xba, 0x88, 0x18, 0xdf, 0xdf, 0xdf, 0xc4, 0x3e, 0x00, 0xdf,
+	0xdf, 0xdf, 0xc5, 0x96, 0x88, 0xfe, 0x25, 0x29, 0x00, 0x19, 0x00, 0x31, 0x00, 0x19, 0x00, 0x31,
+	0x00, 0x19, 0x00, 0x31, 0xe0, 0x19, 0x00, 0xc1, 0x0a, 0x09, 0x22, 0x66, 0x05, 0x13, 0x05, 0x13,
+	0x33, 0x3e, 0xe0, 0x9e, 0x57, 0x9f, 0x48, 0x31, 0x00, 0xc2, 0x31, 0x00, 0x19, 0x00, 0x31, 0x00,
+	0x19, 0x00, 0x31, 0x00, 0x19, 0x00, 0xc0, 0x1e, 0x18, 0xdf, 0xdf, 0xdf, 0xc5, 0x35, 0x00, 0xdf,
+	0xdf, 0xdf, 0xc7, 0xfe, 0xcc, 0x62, 0x00, 0x07, 0x00, 0x07, 0x00, 0x07, 0x00, 0x07, 0x00, 0x07,
+	0x00, 0x07, 0x00, 0x07, 0xe0, 0x07, 0x00, 0x31, 0x00, 0xc9, 0x07, 0xe0, 0x07, 0xe0, 0x07, 0x00,
+	0x07, 0x00, 0x07, 0x00, 0x07, 0x00, 0x07, 0x00, 0x07, 0x00, 0xac, 0x88, 0xfe, 0xfb, 0xde, 0x18,
+	0xdf, 0xdf, 0xdf, 0xc6, 0x38, 0x00, 0xdf, 0xdf, 0xdf, 0xc8, 0x98, 0x99, 0x00, 0xc1, 0x31, 0x00,
+	0x19, 0x00, 0x31, 0x00, 0x19, 0x00, 0x31, 0x00, 0x19, 0x00, 0x31, 0x00, 0x19, 0xe0, 0x31, 0xe0,
+	0x19, 0xe0, 0x31, 0xe0, 0x19, 0xe0, 0x31, 0x00, 0x19, 0x00, 0x31, 0x00, 0x19, 0x00, 0x31, 0x00,
+	0x19, 0x00, 0x31, 0x00, 0x19, 0x00, 0xfe, 0xf3, 0x9c, 0x18, 0xdf, 0xdf, 0xdf, 0xc8, 0x32, 0x00,
+	0xdf, 0xdf, 0xdf, 0xca, 0x2c, 0xe0, 0xc0, 0x07, 0x00, 0x07, 0x00, 0x07, 0x00, 0x07, 0x00, 0x07,
+	0x00, 0x07, 0x00, 0x07, 0x00, 0x07, 0x00, 0x07, 0x00, 0x07, 0x00, 0x07, 0x00, 0x07, 0x00, 0x07,
+	0x00, 0x07, 0x00, 0x07, 0x00, 0x07, 0x00, 0x07, 0x00, 0x07, 0x00, 0xc0, 0x2b, 0x18, 0xdf, 0xdf,
+	0xdf, 0xca, 0x32, 0x00, 0xdf, 0xdf, 0xdf, 0xcc, 0x82, 0x99, 0x00, 0xc1, 0x19, 0x00, 0x31, 0x00,
+	0x19, 0x00, 0x31, 0x00, 0x19, 0x00, 0x31, 0x00, 0x19, 0x00, 0x31, 0x00, 0x19, 0x00, 0x31, 0x00,
+	0x19, 0x00, 0x31, 0x00, 0x19, 0x00, 0x31, 0x00, 0x19, 0x00, 0x31, 0x00, 0xab, 0x99, 0xfe, 0x7d,
+	0xef, 0x18, 0xdf, 0xdf, 0xdf, 0xcb, 0x2e, 0x00, 0xdf, 0xdf, 0xdf, 0xce, 0x1e, 0xe0, 0xc0, 0x07,
+	0x00, 0x07, 0x00, 0x07, 0x00, 0x07, 0x00, 0x07, 0x00, 0x07, 0x00, 0x07, 0x00, 0x07, 0x00, 0x07,
+	0x00, 0x07, 0x00, 0x07, 0x00, 0x07, 0x00, 0x07, 0x00, 0x07, 0x00, 0xc0, 0xaa, 0x88, 0xfe, 0x9e,
+	0xf7, 0x18, 0xdf, 0xdf, 0xdf, 0xcd, 0x29, 0x00, 0xdf, 0xdf, 0xdf, 0xcf, 0x66, 0x2d, 0xfe, 0x4d,
+	0x6b, 0xe0, 0xc2, 0x19, 0x00, 0x31, 0x00, 0x19, 0x00, 0x31, 0x00, 0x19, 0x00, 0x31, 0x00, 0x19,
+	0x00, 0x31, 0x00, 0x19, 0x00, 0x31, 0x00, 0xc0, 0xae, 0x88, 0x02, 0x26, 0x18, 0xdf, 0xdf, 0xdf,
+	0xcf, 0x1a, 0x00, 0xdf, 0xdf, 0xdf, 0xd2, 0x26, 0x2d, 0x2c, 0xe0, 0xc4, 0x07, 0x00, 0x07, 0x00,
+	0x07, 0x00, 0x07, 0x00, 0xc4, 0x2c, 0x2d, 0xc0, 0x18, 0xdf, 0xdf, 0xdf, 0xd2, 0x23, 0x00, 0xdf,
+	0xdf, 0xdf, 0xd6, 0x26, 0x3c, 0x59, 0x93, 0x99, 0x9a, 0x88, 0x9a, 0x88, 0x24, 0x99, 0x89, 0x9a,
+	0x87, 0x39, 0x24, 0x08, 0xa4, 0x88, 0xa9, 0x99, 0xac, 0x77, 0xc0, 0xa2, 0x99, 0x18, 0xdf, 0xdf,
+	0xdf, 0xd6, 0x08, 0x00, 0xdf, 0xdf, 0xdf, 0xdf, 0xdf, 0xdf, 0xdf, 0xdf, 0x08, 0x00, 0xdf, 0xdf,
+	0xdf, 0xdf, 0xdf, 0xdf, 0xdf, 0xdf, 0x08, 0x00, 0xdf, 0xdf, 0xdf, 0xdf, 0xdf, 0xdf, 0xdf, 0xdf,
+	0x08, 0x00, 0xdf, 0xdf, 0xdf, 0xdf, 0xdf, 0xdf, 0xdf, 0xdf, 0x08, 0x00, 0xdf, 0xdf, 0xdf, 0xdf,
+	0xdf, 0xdf, 0xdf, 0xdf,
+};
@@ -0,0 +1,83 @@
+/**
+ * Copyright (c) 2022 Raspberry Pi (Trading) Ltd.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+#include <string.h>
+#include "rgb565_codec.h"
+
+static inline uint cache_slot(uint32_t px) {
+    return ((px * 0x9e37u) & 0xffff) >> 10;
+}
+
+bool rgb565_decoder_init(rgb565_decoder_t *d, const uint8_t *header) {
+    uint32_t magic = header[0] | header[1] << 8 | header[2] << 16 | (uint32_t) header[3] << 24;
+    d->width = (uint16_t) (header[4] | header[5] << 8);
+    d->height = (uint16_t) (header[6] | header[7] << 8);
+    d->last = 0;
+    memset(d->cache, 0, sizeof(d->cache));
+    return magic == RGB565_MAGIC && d->width && d->width <= RGB565_MAX_WIDTH;
+}
+
+bool __time_critical_func(rgb565_decode_line)(rgb565_decoder_t *d, const uint8_t *src, uint len,
+                                              uint16_t *dst, const uint16_t *up) {
+    const uint8_t *end = src + len;
+    uint16_t *line = dst;
+    uint16_t *dst_end = dst + d->width;
+    uint32_t px = d->last;
+    while (src < end && dst < dst_end) {
+        uint op = *src++;
+        if (op < 0x40) {
+            px = d->cache[op];
+            *dst++ = (uint16_t) px;
+            continue;
+        }
+        if (op >= 0xc0 && op < 0xfe) {
+            uint n = (op & 0x1f) + 1;
+            if (n > (uint) (dst_end - dst))
+                return false;
+            if (op < 0xe0) {
+                while (n--)
+                    *dst++ = (uint16_t) px;
+            } else {
+                if (!up)
+                    return false;
+                memcpy(dst, up + (dst - line), n * 2);
+                dst += n;
+                px = dst[-1];
+            }
+            continue;
+        }
+        if (op < 0x80) {
+            // Each field changes by -2 to 1; a change in one field which
+            // carries into the next is put right by the mask
+            uint32_t r = (px >> 11) + ((op >> 4) & 3) - 2;
+            uint32_t g = (px >> 5) + ((op >> 2) & 3) - 2;
+            uint32_t b = px + (op & 3) - 2;
+            px = (r & 0x1f) << 11 | (g & 0x3f) << 5 | (b & 0x1f);
+        } else if (op < 0xc0) {
+            if (src == end)
+                return false;
+            int dg = (int) (op & 0x3f) - 32;
+            uint rb = *src++;
+            int dr = (dg >> 1) + (int) (rb >> 4) - 8;
+            int db = (dg >> 1) + (int) (rb & 0xf) - 8;
+            uint32_t r = (px >> 11) + dr;
+            uint32_t g = (px >> 5) + dg;
+            uint32_t b = px + db;
+            px = (r & 0x1f) << 11 | (g & 0x3f) << 5 | (b & 0x1f);
+        } else if (op == 0xfe) {
+            if (end - src < 2)
+                return false;
+            px = src[0] | src[1] << 8;
+            src += 2;
+        } else {
+            return false;
+        }
+        d->cache[cache_slot(px)] = (uint16_t) px;
+        *dst++ = (uint16_t) px;
+    }
+    d->last = (uint16_t) px;
+    return src == end && dst == dst_end;
+}
@@ -0,0 +1,56 @@
+/**
+ * Copyright (c) 2022 Raspberry Pi (Trading) Ltd.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+#ifndef _RGB565_CODEC_H
+#define _RGB565_CODEC_H
+
+#include "pico.h"
+
+// ----------------------------------------------------------------------------
+// A lossless format for RGB565 images, which decodes a scanline at a time
+// into a line buffer, fast enough to keep up with a display.
+//
+// An image starts with "R565" and its width and height, 16 bits each, low
+// byte first. Then each line is a 16 bit length followed by that many bytes
+// of ops, each of which gives one or more pixels:
+//
+//   00iiiiii             the pixel in slot i of a cache of recent colours
+//   01rrggbb             the last pixel plus a small difference in each
+//                        field, -2 to 1
+//   10gggggg rrrrbbbb    the last pixel plus a difference of -32 to 31 in
+//                        green, and in red and blue of half that, plus -8 to 7
+//   110nnnnn             the last pixel, n + 1 times
+//   111nnnnn             n + 1 pixels the same as the ones above (n < 30)
+//   11111110 lo hi       a pixel as it is
+//
+// The last pixel and the cache carry on from one line to the next, so lines
+// must be decoded in order. The data is padded to a multiple of 4 bytes.
+// pack_rgb565.py makes images in this format.
+
+#define RGB565_MAGIC 0x35363552u // "R565"
+#define RGB565_HEADER_LEN 8
+
+// Lines are no longer than this, so a packed line takes at most
+// RGB565_MAX_LINE_BYTES
+#define RGB565_MAX_WIDTH 320
+#define RGB565_MAX_LINE_BYTES (2 + 3 * RGB565_MAX_WIDTH)
+
+typedef struct {
+    uint16_t width;
+    uint16_t height;
+    uint16_t last;
+    uint16_t cache[64];
+} rgb565_decoder_t;
+
+// Check the header, and get ready to decode the first line. Returns false if
+// it isn't an image this decoder can handle.
+bool rgb565_decoder_init(rgb565_decoder_t *d, const uint8_t *header);
+
+// Decode one line's ops (without its length) into dst, which has room for
+// the width of the image. up is the line above, or NULL for the first line.
+// Returns false if the ops were not a line of the right width.
+bool rgb565_decode_line(rgb565_decoder_t *d, const uint8_t *src, uint len, uint16_t *dst, const uint16_t *up);
+
+#endif
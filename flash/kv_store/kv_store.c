@@ -0,0 +1,554 @@
+/**
+ * Copyright (c) 2022 Raspberry Pi (Trading) Ltd.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+#include <string.h>
+#include "kv_store.h"
+
+// Each sector in use starts with a header:
+//
+//   magic, sequence number, erase count, CRC-32 of the other three
+//
+// and is followed by records, each padded to a multiple of 4 bytes:
+//
+//   key length, flags, value length (16 bits), CRC-32, key, value
+//
+// A key length of 0xff is where the flash is still erased: the end of the
+// log in that sector. The CRC covers the first four bytes, the key and the
+// value, so a record which was only partly programmed when the power went
+// is seen as such. Records never straddle sectors.
+//
+// A sector is retired by programming its magic to 0 before erasing it, so
+// that a half erased sector, which may still have a valid looking header,
+// is never read back as part of the log.
+
+#define SECTOR_MAGIC 0x474c564bu // "KVLG"
+#define SECTOR_HEADER_LEN 16
+#define RECORD_HEADER_LEN 8
+
+#define FLAG_VALUE 0x01
+#define FLAG_DELETE 0x00
+#define END_OF_LOG 0xff
+
+#define RECORD_LEN(key_len, value_len) ((RECORD_HEADER_LEN + (key_len) + (value_len) + 3) & ~3u)
+#define MAX_RECORD_LEN RECORD_LEN(KV_MAX_KEY, KV_MAX_VALUE)
+
+// Room for records in a sector
+#define SECTOR_SPACE (KV_SECTOR_SIZE - SECTOR_HEADER_LEN)
+
+// Puts keep at least this many sectors free, once the head is full
+#define MIN_FREE 2
+
+#define NO_LOC 0xffffffffu
+
+// ----------------------------------------------------------------------------
+// Checksums and hashes
+
+static uint32_t crc32_update(uint32_t crc, const uint8_t *p, uint32_t len) {
+    // Half a byte at a time, so as not to need a 1 KB table
+    static const uint32_t table[16] = {
+            0x00000000, 0x1db71064, 0x3b6e20c8, 0x26d930ac, 0x76dc4190, 0x6b6b51f4, 0x4db26158, 0x5005713c,
+            0xedb88320, 0xf00f9344, 0xd6d6a3e8, 0xcb61b38c, 0x9b64c2b0, 0x86d3d2d4, 0xa00ae278, 0xbdbdf21c,
+    };
+    crc = ~crc;
+    while (len--) {
+        crc ^= *p++;
+        crc = (crc >> 4) ^ table[crc & 15];
+        crc = (crc >> 4) ^ table[crc & 15];
+    }
+    return ~crc;
+}
+
+static uint32_t hash_key(const char *key, uint key_len) {
+    // FNV-1a
+    uint32_t h = 2166136261u;
+    for (uint i = 0; i < key_len; ++i)
+        h = (h ^ (uint8_t) key[i]) * 16777619u;
+    return h;
+}
+
+static uint32_t get32(const uint8_t *p) {
+    return p[0] | p[1] << 8 | p[2] << 16 | (uint32_t) p[3] << 24;
+}
+
+static void put32(uint8_t *p, uint32_t v) {
+    p[0] = (uint8_t) v;
+    p[1] = (uint8_t) (v >> 8);
+    p[2] = (uint8_t) (v >> 16);
+    p[3] = (uint8_t) (v >> 24);
+}
+
+// ----------------------------------------------------------------------------
+// Reading the log
+
+// Read from the region, with the records still in the page buffer on top
+static void read_bytes(const kv_store_t *kv, uint32_t off, void *dst, uint32_t len) {
+    uint8_t *d = dst;
+    while (len) {
+        uint32_t page = off & ~(KV_PAGE_SIZE - 1);
+        uint32_t n = MIN(len, page + KV_PAGE_SIZE - off);
+        const uint8_t *src = page == kv->page_addr ? kv->page_buf + (off - page) : kv->flash.base + off;
+        memcpy(d, src, n);
+        d += n;
+        off += n;
+        len -= n;
+    }
+}
+
+static uint32_t sector_end(uint32_t off) {
+    return (off & ~(KV_SECTOR_SIZE - 1)) + KV_SECTOR_SIZE;
+}
+
+typedef enum {
+    REC_OK,
+    REC_END,
+    REC_BAD,
+} rec_status_t;
+
+typedef struct {
+    uint key_len;
+    uint flags;
+    uint value_len;
+    uint32_t len;
+    // Key and value, one after the other
+    uint8_t data[KV_MAX_KEY + KV_MAX_VALUE];
+} record_t;
+
+static rec_status_t read_record(const kv_store_t *kv, uint32_t off, record_t *r) {
+    uint32_t end = sector_end(off);
+    if (off + RECORD_HEADER_LEN > end)
+        return REC_END;
+    uint8_t header[RECORD_HEADER_LEN];
+    read_bytes(kv, off, header, RECORD_HEADER_LEN);
+    if (header[0] == END_OF_LOG)
+        return REC_END;
+    r->key_len = header[0];
+    r->flags = header[1];
+    r->value_len = header[2] | header[3] << 8;
+    if (r->key_len > KV_MAX_KEY || r->value_len > KV_MAX_VALUE ||
+        (r->flags != FLAG_VALUE && r->flags != FLAG_DELETE))
+        return REC_BAD;
+    r->len = RECORD_LEN(r->key_len, r->value_len);
+    if (off + r->len > end)
+        return REC_BAD;
+    read_bytes(kv, off + RECORD_HEADER_LEN, r->data, r->key_len + r->value_len);
+    uint32_t crc = crc32_update(0, header, 4);
+    crc = crc32_update(crc, r->data, r->key_len + r->value_len);
+    return crc == get32(header + 4) ? REC_OK : REC_BAD;
+}
+
+static bool is_blank(const kv_store_t *kv, uint32_t off, uint32_t end) {
+    for (; off < end; ++off) {
+        if (kv->flash.base[off] != 0xff)
+            return false;
+    }
+    return true;
+}
+
+// ----------------------------------------------------------------------------
+// The index: open addressing, with linear probing
+
+#define INDEX_MASK (KV_INDEX_SIZE - 1)
+
+static bool key_matches(const kv_store_t *kv, uint32_t loc, const char *key, uint key_len) {
+    uint8_t header[RECORD_HEADER_LEN];
+    uint8_t stored[KV_MAX_KEY];
+    read_bytes(kv, loc, header, RECORD_HEADER_LEN);
+    if (header[0] != key_len)
+        return false;
+    read_bytes(kv, loc + RECORD_HEADER_LEN, stored, key_len);
+    return !memcmp(stored, key, key_len);
+}
+
+// Returns the slot holding key, or the empty slot where it would go
+static uint index_find(const kv_store_t *kv, const char *key, uint key_len, uint32_t hash, bool *found) {
+    uint slot = hash & INDEX_MASK;
+    while (kv->index[slot].loc != NO_LOC) {
+        if (kv->index[slot].hash == hash && key_matches(kv, kv->index[slot].loc, key, key_len)) {
+            *found = true;
+            return slot;
+        }
+        slot = (slot + 1) & INDEX_MASK;
+    }
+    *found = false;
+    return slot;
+}
+
+static void index_remove(kv_store_t *kv, uint slot) {
+    // Shift back any entries further along the chain which could no longer
+    // be found past the gap
+    uint next = slot;
+    for (;;) {
+        next = (next + 1) & INDEX_MASK;
+        if (kv->index[next].loc == NO_LOC)
+            break;
+        uint home = kv->index[next].hash & INDEX_MASK;
+        if (((next - home) & INDEX_MASK) >= ((next - slot) & INDEX_MASK)) {
+            kv->index[slot] = kv->index[next];
+            slot = next;
+        }
+    }
+    kv->index[slot].loc = NO_LOC;
+    --kv->n_keys;
+}
+
+// Point the index at a record: the latest for its key
+static void index_apply(kv_store_t *kv, const record_t *r, uint32_t loc) {
+    const char *key = (const char *) r->data;
+    uint32_t hash = hash_key(key, r->key_len);
+    bool found;
+    uint slot = index_find(kv, key, r->key_len, hash, &found);
+    if (found)
+        kv->live_bytes -= kv->index[slot].len;
+    if (r->flags == FLAG_DELETE) {
+        if (found)
+            index_remove(kv, slot);
+        return;
+    }
+    if (!found) {
+        if (kv->n_keys >= KV_INDEX_SIZE * 3 / 4)
+            return;
+        ++kv->n_keys;
+        kv->index[slot].hash = hash;
+    }
+    kv->index[slot].loc = loc;
+    kv->index[slot].len = r->len;
+    kv->live_bytes += r->len;
+}
+
+// ----------------------------------------------------------------------------
+// Writing the log
+
+static void program_page(kv_store_t *kv) {
+    kv->flash.program(kv->flash.ctx, kv->page_addr, kv->page_buf);
+    ++kv->stats.programs;
+    kv->page_dirty = false;
+}
+
+static void erase_sector(kv_store_t *kv, uint s) {
+    kv->flash.erase(kv->flash.ctx, s * KV_SECTOR_SIZE);
+    ++kv->stats.erases;
+    ++kv->erase_count[s];
+}
+
+static void start_page(kv_store_t *kv, uint32_t page) {
+    kv->page_addr = page;
+    memset(kv->page_buf, 0xff, KV_PAGE_SIZE);
+}
+
+static void append_bytes(kv_store_t *kv, const uint8_t *data, uint32_t len) {
+    while (len) {
+        uint32_t in_page = kv->head_pos % KV_PAGE_SIZE;
+        uint32_t n = MIN(len, KV_PAGE_SIZE - in_page);
+        memcpy(kv->page_buf + in_page, data, n);
+        kv->page_dirty = true;
+        kv->head_pos += n;
+        data += n;
+        len -= n;
+        if (kv->head_pos % KV_PAGE_SIZE == 0) {
+            program_page(kv);
+            if (kv->head_pos < sector_end(kv->page_addr))
+                start_page(kv, kv->head_pos);
+            else
+                kv->page_addr = NO_LOC;
+        }
+    }
+}
+
+static bool head_fits(const kv_store_t *kv, uint32_t len) {
+    return kv->page_addr != NO_LOC && kv->head_pos + len <= (kv->head + 1) * KV_SECTOR_SIZE;
+}
+
+// Start writing the next free sector; there must be one
+static void open_head(kv_store_t *kv) {
+    if (kv->page_dirty)
+        program_page(kv);
+    uint s = kv->head;
+    do {
+        s = (s + 1) % kv->n_sectors;
+    } while (kv->used[s]);
+    hard_assert(kv->n_free);
+    --kv->n_free;
+    kv->used[s] = true;
+    kv->seq[s] = kv->next_seq++;
+    kv->head = s;
+    start_page(kv, s * KV_SECTOR_SIZE);
+    put32(kv->page_buf, SECTOR_MAGIC);
+    put32(kv->page_buf + 4, kv->seq[s]);
+    put32(kv->page_buf + 8, kv->erase_count[s]);
+    put32(kv->page_buf + 12, crc32_update(0, kv->page_buf, 12));
+    kv->page_dirty = true;
+    kv->head_pos = s * KV_SECTOR_SIZE + SECTOR_HEADER_LEN;
+}
+
+static uint32_t append_record(kv_store_t *kv, const char *key, uint key_len, uint flags,
+                              const void *value, uint value_len) {
+    uint8_t buf[MAX_RECORD_LEN];
+    uint32_t len = RECORD_LEN(key_len, value_len);
+    if (!head_fits(kv, len))
+        open_head(kv);
+    buf[0] = (uint8_t) key_len;
+    buf[1] = (uint8_t) flags;
+    buf[2] = (uint8_t) value_len;
+    buf[3] = (uint8_t) (value_len >> 8);
+    memcpy(buf + RECORD_HEADER_LEN, key, key_len);
+    // A delete has no value, and may have no pointer to one
+    if (value_len)
+        memcpy(buf + RECORD_HEADER_LEN + key_len, value, value_len);
+    uint32_t crc = crc32_update(0, buf, 4);
+    put32(buf + 4, crc32_update(crc, buf + RECORD_HEADER_LEN, key_len + value_len));
+    // Padding is left erased
+    memset(buf + RECORD_HEADER_LEN + key_len + value_len, 0xff, len - RECORD_HEADER_LEN - key_len - value_len);
+    uint32_t loc = kv->head_pos;
+    append_bytes(kv, buf, len);
+    kv->stats.bytes_written += len;
+    return loc;
+}
+
+void kv_sync(kv_store_t *kv) {
+    if (kv->page_dirty)
+        program_page(kv);
+    ++kv->stats.syncs;
+}
+
+// ----------------------------------------------------------------------------
+// Compaction
+
+static bool seq_before(uint32_t a, uint32_t b) {
+    return (int32_t) (a - b) < 0;
+}
+
+static bool start_compaction(kv_store_t *kv) {
+    uint tail = kv->n_sectors;
+    for (uint s = 0; s < kv->n_sectors; ++s) {
+        if (kv->used[s] && s != kv->head && (tail == kv->n_sectors || seq_before(kv->seq[s], kv->seq[tail])))
+            tail = s;
+    }
+    if (tail == kv->n_sectors)
+        return false;
+    kv->compacting = true;
+    kv->compact_sector = tail;
+    kv->compact_pos = tail * KV_SECTOR_SIZE + SECTOR_HEADER_LEN;
+    return true;
+}
+
+static void finish_compaction(kv_store_t *kv) {
+    uint s = kv->compact_sector;
+    // The copies must be in flash before the originals go
+    kv_sync(kv);
+    uint8_t page[KV_PAGE_SIZE];
+    memcpy(page, kv->flash.base + s * KV_SECTOR_SIZE, KV_PAGE_SIZE);
+    put32(page, 0);
+    kv->flash.program(kv->flash.ctx, s * KV_SECTOR_SIZE, page);
+    ++kv->stats.programs;
+    erase_sector(kv, s);
+    kv->used[s] = false;
+    ++kv->n_free;
+    ++kv->stats.compactions;
+    kv->compacting = false;
+}
+
+// Copy the records still in use from budget bytes of the sector being
+// compacted, and retire it if that was the last of them
+static void compact_some(kv_store_t *kv, uint32_t budget) {
+    record_t r;
+    uint32_t end = (kv->compact_sector + 1) * KV_SECTOR_SIZE;
+    uint32_t start = kv->compact_pos;
+    while (kv->compact_pos < end && kv->compact_pos - start < budget) {
+        if (read_record(kv, kv->compact_pos, &r) != REC_OK) {
+            kv->compact_pos = end;
+            break;
+        }
+        // Deletes are dropped: there is nothing older left for them to hide
+        if (r.flags == FLAG_VALUE) {
+            const char *key = (const char *) r.data;
+            bool found;
+            uint slot = index_find(kv, key, r.key_len, hash_key(key, r.key_len), &found);
+            if (found && kv->index[slot].loc == kv->compact_pos) {
+                kv->index[slot].loc = append_record(kv, key, r.key_len, FLAG_VALUE, r.data + r.key_len, r.value_len);
+                ++kv->stats.records_copied;
+            }
+        }
+        kv->compact_pos += r.len;
+    }
+    if (kv->compact_pos >= end)
+        finish_compaction(kv);
+}
+
+static bool compact_sector(kv_store_t *kv) {
+    if (!kv->compacting && !start_compaction(kv))
+        return false;
+    while (kv->compacting)
+        compact_some(kv, KV_SECTOR_SIZE);
+    return true;
+}
+
+bool kv_compact_step(kv_store_t *kv) {
+    if (!kv->compacting && (kv->n_free >= KV_BACKGROUND_FREE || !start_compaction(kv)))
+        return false;
+    compact_some(kv, KV_PAGE_SIZE);
+    return true;
+}
+
+// Make sure a record of len bytes can be appended, leaving at least MIN_FREE
+// sectors free for compaction
+static bool make_room(kv_store_t *kv, uint32_t len) {
+    for (uint i = 0; !head_fits(kv, len) && kv->n_free <= MIN_FREE; ++i) {
+        if (i == kv->n_sectors || !compact_sector(kv))
+            return false;
+    }
+    return true;
+}
+
+uint32_t kv_capacity(const kv_store_t *kv) {
+    // Besides the free sectors kept back, any sector can have up to a record's
+    // worth of space at the end which nothing fitted into
+    return (kv->n_sectors - MIN_FREE - 1) * (SECTOR_SPACE - MAX_RECORD_LEN);
+}
+
+// ----------------------------------------------------------------------------
+
+static_assert(KV_MIN_SECTORS >= MIN_FREE + 2, "compaction needs free sectors besides the head and the tail");
+
+int kv_mount(kv_store_t *kv, const kv_flash_t *flash) {
+    if (flash->size % KV_SECTOR_SIZE || flash->size / KV_SECTOR_SIZE < KV_MIN_SECTORS)
+        return KV_ERR_REGION;
+    memset(kv, 0, sizeof(*kv));
+    kv->flash = *flash;
+    kv->n_sectors = MIN(flash->size / KV_SECTOR_SIZE, KV_MAX_SECTORS);
+    kv->page_addr = NO_LOC;
+    for (uint i = 0; i < KV_INDEX_SIZE; ++i)
+        kv->index[i].loc = NO_LOC;
+
+    // Find the sectors in use, and put them in order
+    uint order[KV_MAX_SECTORS];
+    uint n_used = 0;
+    uint32_t max_erase_count = 0;
+    for (uint s = 0; s < kv->n_sectors; ++s) {
+        const uint8_t *header = flash->base + s * KV_SECTOR_SIZE;
+        if (get32(header) == SECTOR_MAGIC && get32(header + 12) == crc32_update(0, header, 12)) {
+            kv->used[s] = true;
+            kv->seq[s] = get32(header + 4);
+            kv->erase_count[s] = get32(header + 8);
+            max_erase_count = MAX(max_erase_count, kv->erase_count[s]);
+            uint i = n_used++;
+            for (; i && seq_before(kv->seq[s], kv->seq[order[i - 1]]); --i)
+                order[i] = order[i - 1];
+            order[i] = s;
+        }
+    }
+    // The rest should be erased. Those which aren't were being programmed or
+    // erased when the power went.
+    for (uint s = 0; s < kv->n_sectors; ++s) {
+        if (kv->used[s])
+            continue;
+        // Erase counts are only kept in the headers, so this is a guess
+        kv->erase_count[s] = max_erase_count;
+        if (!is_blank(kv, s * KV_SECTOR_SIZE, (s + 1) * KV_SECTOR_SIZE)) {
+            erase_sector(kv, s);
+            ++kv->stats.sectors_recovered;
+        }
+        ++kv->n_free;
+    }
+    if (!n_used) {
+        kv->head = kv->n_sectors - 1;
+        kv->next_seq = 1;
+        open_head(kv);
+        return KV_OK;
+    }
+
+    // Replay the records, oldest first
+    record_t r;
+    for (uint i = 0; i < n_used; ++i) {
+        uint s = order[i];
+        uint32_t pos = s * KV_SECTOR_SIZE + SECTOR_HEADER_LEN;
+        rec_status_t status;
+        while ((status = read_record(kv, pos, &r)) == REC_OK) {
+            index_apply(kv, &r, pos);
+            ++kv->stats.records_replayed;
+            pos += r.len;
+        }
+        if (i == n_used - 1) {
+            kv->head = s;
+            kv->head_pos = pos;
+            kv->next_seq = kv->seq[s] + 1;
+            uint32_t end = sector_end(s * KV_SECTOR_SIZE);
+            // Carry on writing the head, unless the last write to it didn't
+            // finish, in which case leave the rest of it alone
+            if (status == REC_END && is_blank(kv, pos, end) && pos < end) {
+                start_page(kv, pos & ~(KV_PAGE_SIZE - 1));
+                memcpy(kv->page_buf, flash->base + kv->page_addr, pos - kv->page_addr);
+            }
+        }
+    }
+    return KV_OK;
+}
+
+// ----------------------------------------------------------------------------
+
+int kv_put(kv_store_t *kv, const char *key, const void *value, uint len) {
+    uint key_len = strlen(key);
+    if (key_len > KV_MAX_KEY || len > KV_MAX_VALUE)
+        return KV_ERR_TOO_BIG;
+    uint32_t hash = hash_key(key, key_len);
+    uint32_t rec_len = RECORD_LEN(key_len, len);
+    bool found;
+    uint slot = index_find(kv, key, key_len, hash, &found);
+    uint32_t old_len = found ? kv->index[slot].len : 0;
+    if (!found && kv->n_keys >= KV_INDEX_SIZE * 3 / 4)
+        return KV_ERR_FULL;
+    if (kv->live_bytes - old_len + rec_len > kv_capacity(kv) || !make_room(kv, rec_len))
+        return KV_ERR_FULL;
+    uint32_t loc = append_record(kv, key, key_len, FLAG_VALUE, value, len);
+    if (!found) {
+        ++kv->n_keys;
+        kv->index[slot].hash = hash;
+    }
+    kv->index[slot].loc = loc;
+    kv->index[slot].len = rec_len;
+    kv->live_bytes += rec_len - old_len;
+    ++kv->stats.puts;
+    kv->stats.bytes_stored += rec_len;
+    return KV_OK;
+}
+
+int kv_get(kv_store_t *kv, const char *key, void *value, uint max_len) {
+    uint key_len = strlen(key);
+    if (key_len > KV_MAX_KEY)
+        return KV_ERR_NOT_FOUND;
+    ++kv->stats.gets;
+    bool found;
+    uint slot = index_find(kv, key, key_len, hash_key(key, key_len), &found);
+    if (!found)
+        return KV_ERR_NOT_FOUND;
+    uint8_t header[RECORD_HEADER_LEN];
+    uint32_t loc = kv->index[slot].loc;
+    read_bytes(kv, loc, header, RECORD_HEADER_LEN);
+    uint value_len = header[2] | header[3] << 8;
+    if (value_len > max_len)
+        return KV_ERR_TOO_BIG;
+    read_bytes(kv, loc + RECORD_HEADER_LEN + key_len, value, value_len);
+    return (int) value_len;
+}
+
+int kv_delete(kv_store_t *kv, const char *key) {
+    uint key_len = strlen(key);
+    if (key_len > KV_MAX_KEY)
+        return KV_ERR_NOT_FOUND;
+    uint32_t hash = hash_key(key, key_len);
+    bool found;
+    uint slot = index_find(kv, key, key_len, hash, &found);
+    if (!found)
+        return KV_ERR_NOT_FOUND;
+    uint32_t rec_len = RECORD_LEN(key_len, 0);
+    if (!make_room(kv, rec_len))
+        return KV_ERR_FULL;
+    append_record(kv, key, key_len, FLAG_DELETE, NULL, 0);
+    kv->live_bytes -= kv->index[slot].len;
+    index_remove(kv, slot);
+    ++kv->stats.deletes;
+    kv->stats.bytes_stored += rec_len;
+    return KV_OK;
+}
@@ -0,0 +1,164 @@
+/**
+ * Copyright (c) 2022 Raspberry Pi (Trading) Ltd.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+#ifndef _KV_STORE_H
+#define _KV_STORE_H
+
+#include "pico.h"
+
+// ----------------------------------------------------------------------------
+// A key/value store kept as a log in a region of flash.
+//
+// Every put or delete appends a record to the sector being written (the
+// head). When it fills up, the next free sector in the region becomes the
+// head, so the sectors are used in turn and wear evenly. Nothing is ever
+// overwritten: an index in RAM, rebuilt by reading the log back at mount,
+// says where the latest record for each key is.
+//
+// Space taken by records which have since been replaced is reclaimed by
+// compaction: the records still in use are copied out of the oldest sector
+// (the tail) to the head, and the tail is erased. kv_compact_step() does a
+// little of this at a time, from the main loop, so that it is rarely left to
+// a put to do while the caller waits.
+//
+// Records are gathered into a page buffer, and a page is only programmed once
+// it is full, or on kv_sync(). A record is safe from a loss of power once it
+// has been synced; after a loss of power, the store comes back as it was after
+// the latest sync or some later put or delete, never with a half written
+// record, and never with an older value than it had at the sync.
+//
+// The store only reads the flash through a pointer, and writes it through the
+// functions in kv_flash_t, so the same code runs against the Pico's flash
+// (flash_kv.c) or a simulated one on the host (kv_store_test.c).
+
+#define KV_PAGE_SIZE 256
+#define KV_SECTOR_SIZE 4096
+
+#define KV_MAX_KEY 32
+#define KV_MAX_VALUE 256
+
+#ifndef KV_MAX_SECTORS
+#define KV_MAX_SECTORS 64
+#endif
+
+// Slots in the index; the store holds at most three quarters as many keys.
+// Must be a power of 2.
+#ifndef KV_INDEX_SIZE
+#define KV_INDEX_SIZE 256
+#endif
+
+// kv_compact_step() starts on the tail when fewer sectors than this are free.
+// Puts compact for themselves rather than leave fewer than 2, so that a
+// compaction, even one cut short by a loss of power, always has a free sector
+// to copy into.
+// The smallest region: the head, a sector of records, and the 2 free sectors
+// that compaction needs
+#define KV_MIN_SECTORS 4
+
+#ifndef KV_BACKGROUND_FREE
+#define KV_BACKGROUND_FREE 4
+#endif
+
+enum {
+    KV_OK = 0,
+    KV_ERR_NOT_FOUND = -1,
+    KV_ERR_TOO_BIG = -2,  // key or value too long, or the value didn't fit
+    KV_ERR_FULL = -3,     // no room for the record, or no slot in the index
+    KV_ERR_REGION = -4,   // the region is too small, or not whole sectors
+};
+
+typedef struct {
+    // The region, as it can be read (through XIP on the device)
+    const uint8_t *base;
+    // A multiple of the sector size, of at least KV_MIN_SECTORS sectors; only
+    // the first KV_MAX_SECTORS are used
+    uint32_t size;
+    // Erase the sector at offset, within the region
+    void (*erase)(void *ctx, uint32_t offset);
+    // Program the page at offset, within the region
+    void (*program)(void *ctx, uint32_t offset, const uint8_t *data);
+    void *ctx;
+} kv_flash_t;
+
+typedef struct {
+    uint32_t puts;
+    uint32_t deletes;
+    uint32_t gets;
+    uint32_t syncs;
+    uint32_t programs;
+    uint32_t erases;
+    uint32_t compactions;     // sectors compacted
+    uint32_t records_copied;  // by compaction
+    uint32_t bytes_written;   // records appended, copies included
+    uint32_t bytes_stored;    // records appended for puts and deletes
+    // Found at mount
+    uint32_t records_replayed;
+    uint32_t sectors_recovered; // erased because they were half written or half erased
+} kv_stats_t;
+
+typedef struct {
+    uint32_t hash;
+    // Offset of the record in the region, and its length
+    uint32_t loc;
+    uint32_t len;
+} kv_index_entry_t;
+
+typedef struct {
+    kv_flash_t flash;
+    uint n_sectors;
+    // Per sector: whether it is in use, its place in the log, and its erase
+    // count as far as is known
+    bool used[KV_MAX_SECTORS];
+    uint32_t seq[KV_MAX_SECTORS];
+    uint32_t erase_count[KV_MAX_SECTORS];
+    uint n_free;
+    uint32_t next_seq;
+    // Where the next record goes
+    uint head;
+    uint32_t head_pos;
+    // The page which holds head_pos, as it will be once programmed
+    uint32_t page_addr;
+    bool page_dirty;
+    uint8_t page_buf[KV_PAGE_SIZE];
+    // Compaction in progress: sector, and the position of the next record
+    bool compacting;
+    uint compact_sector;
+    uint32_t compact_pos;
+    uint n_keys;
+    uint32_t live_bytes;
+    kv_index_entry_t index[KV_INDEX_SIZE];
+    kv_stats_t stats;
+} kv_store_t;
+
+// Read back the log in the region, and set up the index. Sectors which were
+// being written or erased when the power went are erased again, and an empty
+// region is formatted. Returns KV_OK, or KV_ERR_REGION if the region is the
+// wrong size, in which case the store can't be used.
+int kv_mount(kv_store_t *kv, const kv_flash_t *flash);
+
+// Store value under key, a string of at most KV_MAX_KEY characters; len may
+// be 0. Returns KV_OK or an error.
+int kv_put(kv_store_t *kv, const char *key, const void *value, uint len);
+
+// Copy the value for key into value, which has room for max_len bytes, and
+// return its length, or KV_ERR_NOT_FOUND or KV_ERR_TOO_BIG
+int kv_get(kv_store_t *kv, const char *key, void *value, uint max_len);
+
+// Returns KV_OK, KV_ERR_NOT_FOUND, or KV_ERR_FULL if there was no room to
+// record the delete
+int kv_delete(kv_store_t *kv, const char *key);
+
+// Program any records still in the page buffer
+void kv_sync(kv_store_t *kv);
+
+// Do a little compaction if free sectors are running low: copy the records
+// still in use from one page of the tail, or erase it once they have all been
+// copied. Returns false if there was nothing to do.
+bool kv_compact_step(kv_store_t *kv);
+
+// Bytes of records the store can hold at once, whatever the order of puts
+uint32_t kv_capacity(const kv_store_t *kv);
+
+#endif
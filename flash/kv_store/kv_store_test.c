@@ -0,0 +1,439 @@
+/**
+ * Copyright (c) 2022 Raspberry Pi (Trading) Ltd.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+#include <stdio.h>
+#include <string.h>
+#include <setjmp.h>
+#include "pico/stdlib.h"
+#include "kv_store.h"
+#include "test_rand.h"
+
+// Runs the store against a simulated flash: checks it against a model of what
+// it should hold, cuts the power at every write a run of operations makes,
+// and counts the programs and erases a settings workload costs, next to
+// rewriting a whole sector for every change as flash_program.c does. The
+// flash is an array in RAM, so the real one is never touched, even on the
+// device.
+
+// ----------------------------------------------------------------------------
+// The flash. Programming can only clear bits. The power can be made to go
+// during a given write, which then only partly happens: some of the bits
+// being cleared are, and some of the bytes being erased are.
+
+#define SIM_MAX_SECTORS 16
+
+static uint8_t sim_flash[SIM_MAX_SECTORS * KV_SECTOR_SIZE];
+static uint32_t sim_writes;
+static uint32_t sim_fail_at;
+static jmp_buf power_lost;
+
+static void sim_erase(__unused void *ctx, uint32_t offset) {
+    uint8_t *p = sim_flash + offset;
+    if (++sim_writes == sim_fail_at) {
+        for (uint i = 0; i < KV_SECTOR_SIZE; ++i) {
+            if (next_rand() & 1)
+                p[i] = 0xff;
+        }
+        longjmp(power_lost, 1);
+    }
+    memset(p, 0xff, KV_SECTOR_SIZE);
+}
+
+static void sim_program(__unused void *ctx, uint32_t offset, const uint8_t *data) {
+    uint8_t *p = sim_flash + offset;
+    bool torn = ++sim_writes == sim_fail_at;
+    for (uint i = 0; i < KV_PAGE_SIZE; ++i) {
+        uint8_t d = data[i];
+        if (torn)
+            d |= (uint8_t) next_rand();
+        p[i] &= d;
+    }
+    if (torn)
+        longjmp(power_lost, 1);
+}
+
+static kv_flash_t sim_region(uint n_sectors) {
+    kv_flash_t f = {
+            .base = sim_flash,
+            .size = n_sectors * KV_SECTOR_SIZE,
+            .erase = sim_erase,
+            .program = sim_program,
+    };
+    return f;
+}
+
+static void sim_wipe(void) {
+    memset(sim_flash, 0xff, sizeof(sim_flash));
+    sim_writes = sim_fail_at = 0;
+}
+
+// ----------------------------------------------------------------------------
+// The model, and the operations run against it
+
+#define N_KEYS 24
+
+typedef struct {
+    bool present[N_KEYS];
+    uint16_t len[N_KEYS];
+    uint8_t data[N_KEYS][KV_MAX_VALUE];
+} model_t;
+
+enum {
+    OP_PUT,
+    OP_DELETE,
+    OP_SYNC,
+    OP_COMPACT,
+};
+
+typedef struct {
+    uint8_t type;
+    uint8_t key;
+    uint16_t len;
+    uint32_t seed;
+} op_t;
+
+static void key_name(char *name, uint key) {
+    // Long and short keys
+    snprintf(name, KV_MAX_KEY + 1, key & 1 ? "k%u" : "a/longer/key/name/%u", key);
+}
+
+static void fill_value(uint8_t *data, uint32_t seed, uint len) {
+    for (uint i = 0; i < len; ++i) {
+        seed = seed * 1103515245 + 12345;
+        data[i] = (uint8_t) (seed >> 16);
+    }
+}
+
+static op_t random_op(void) {
+    // Most changes are to a few keys; the rest stay put for long enough that
+    // compaction has to copy them
+    uint key = next_rand() % 8 ? next_rand() % (N_KEYS / 4) : next_rand() % N_KEYS;
+    op_t op = {.key = (uint8_t) key, .seed = next_rand()};
+    uint r = next_rand() % 20;
+    if (r < 12) {
+        op.type = OP_PUT;
+        op.len = (uint16_t) (next_rand() % 8 ? next_rand() % 48 : next_rand() % (KV_MAX_VALUE + 1));
+    } else if (r < 15) {
+        op.type = OP_DELETE;
+    } else if (r < 18) {
+        op.type = OP_SYNC;
+    } else {
+        op.type = OP_COMPACT;
+    }
+    return op;
+}
+
+static void model_apply(model_t *m, const op_t *op) {
+    if (op->type == OP_PUT) {
+        m->present[op->key] = true;
+        m->len[op->key] = op->len;
+        fill_value(m->data[op->key], op->seed, op->len);
+    } else if (op->type == OP_DELETE) {
+        m->present[op->key] = false;
+    }
+}
+
+// Returns false if the store didn't do as it should
+static bool store_apply(kv_store_t *kv, const model_t *m, const op_t *op) {
+    char name[KV_MAX_KEY + 1];
+    uint8_t value[KV_MAX_VALUE];
+    key_name(name, op->key);
+    switch (op->type) {
+        case OP_PUT:
+            fill_value(value, op->seed, op->len);
+            return kv_put(kv, name, value, op->len) == KV_OK;
+        case OP_DELETE:
+            return kv_delete(kv, name) == (m->present[op->key] ? KV_OK : KV_ERR_NOT_FOUND);
+        case OP_SYNC:
+            kv_sync(kv);
+            return true;
+        default:
+            kv_compact_step(kv);
+            return true;
+    }
+}
+
+static bool key_matches(kv_store_t *kv, const model_t *m, uint key) {
+    char name[KV_MAX_KEY + 1];
+    uint8_t value[KV_MAX_VALUE];
+    key_name(name, key);
+    int len = kv_get(kv, name, value, sizeof(value));
+    if (!m->present[key])
+        return len == KV_ERR_NOT_FOUND;
+    return len == m->len[key] && !memcmp(value, m->data[key], len);
+}
+
+static bool store_matches(kv_store_t *kv, const model_t *m) {
+    for (uint key = 0; key < N_KEYS; ++key) {
+        if (!key_matches(kv, m, key))
+            return false;
+    }
+    return true;
+}
+
+// ----------------------------------------------------------------------------
+
+static uint failures;
+
+static void result(const char *name, bool ok) {
+    printf("%-40s %s\n", name, ok ? "ok" : "FAILED");
+    if (!ok)
+        ++failures;
+}
+
+static kv_store_t kv;
+
+static void test_model(void) {
+    static model_t m;
+    memset(&m, 0, sizeof(m));
+    sim_wipe();
+    kv_flash_t flash = sim_region(8);
+    kv_mount(&kv, &flash);
+    bool ops_ok = true, values_ok = true, remount_ok = true;
+    for (uint i = 0; i < 50000; ++i) {
+        op_t op = random_op();
+        ops_ok &= store_apply(&kv, &m, &op);
+        model_apply(&m, &op);
+        values_ok &= key_matches(&kv, &m, op.key);
+        if (i % 1000 == 999) {
+            kv_sync(&kv);
+            kv_mount(&kv, &flash);
+            remount_ok &= store_matches(&kv, &m);
+        }
+    }
+    result("random operations", ops_ok);
+    result("random operations: values", values_ok);
+    result("random operations: remount", remount_ok);
+}
+
+static void test_limits(void) {
+    sim_wipe();
+    kv_flash_t flash = sim_region(8);
+    kv_mount(&kv, &flash);
+    static uint8_t value[KV_MAX_VALUE + 1];
+    char long_key[KV_MAX_KEY + 2];
+    memset(long_key, 'x', sizeof(long_key));
+    long_key[KV_MAX_KEY + 1] = 0;
+    bool ok = kv_put(&kv, long_key, value, 1) == KV_ERR_TOO_BIG;
+    long_key[KV_MAX_KEY] = 0;
+    ok &= kv_put(&kv, long_key, value, 1) == KV_OK;
+    ok &= kv_put(&kv, "v", value, KV_MAX_VALUE + 1) == KV_ERR_TOO_BIG;
+    ok &= kv_put(&kv, "v", value, KV_MAX_VALUE) == KV_OK;
+    ok &= kv_get(&kv, "v", value, KV_MAX_VALUE - 1) == KV_ERR_TOO_BIG;
+    ok &= kv_get(&kv, "w", value, KV_MAX_VALUE) == KV_ERR_NOT_FOUND;
+    ok &= kv_delete(&kv, "w") == KV_ERR_NOT_FOUND;
+    ok &= kv_put(&kv, "empty", value, 0) == KV_OK && kv_get(&kv, "empty", value, 0) == 0;
+    result("key and value sizes", ok);
+
+    // Too small for compaction to have anywhere to copy to, or not whole sectors
+    kv_flash_t small = sim_region(KV_MIN_SECTORS - 1);
+    ok = kv_mount(&kv, &small) == KV_ERR_REGION;
+    small = sim_region(KV_MIN_SECTORS);
+    small.size += KV_PAGE_SIZE;
+    ok &= kv_mount(&kv, &small) == KV_ERR_REGION;
+    small.size -= KV_PAGE_SIZE;
+    ok &= kv_mount(&kv, &small) == KV_OK && kv_put(&kv, "v", value, 1) == KV_OK;
+    result("region size checked", ok);
+    kv_mount(&kv, &flash);
+
+    // Fill it up with big values, then make room again
+    char name[16];
+    uint n = 0;
+    while (n < 1000) {
+        snprintf(name, sizeof(name), "big%u", n);
+        if (kv_put(&kv, name, value, KV_MAX_VALUE) != KV_OK)
+            break;
+        ++n;
+    }
+    ok = n < 1000 && kv.live_bytes + 268 > kv_capacity(&kv) - 268;
+    for (uint i = 0; i < n; i += 2) {
+        snprintf(name, sizeof(name), "big%u", i);
+        ok &= kv_delete(&kv, name) == KV_OK;
+    }
+    for (uint i = 0; i < n / 2; ++i) {
+        snprintf(name, sizeof(name), "new%u", i);
+        ok &= kv_put(&kv, name, value, KV_MAX_VALUE) == KV_OK;
+    }
+    kv_mount(&kv, &flash);
+    for (uint i = 1; i < n; i += 2) {
+        snprintf(name, sizeof(name), "big%u", i);
+        ok &= kv_get(&kv, name, value, KV_MAX_VALUE) == KV_MAX_VALUE;
+    }
+    result("full store", ok);
+
+    // Run out of index slots
+    sim_wipe();
+    kv_mount(&kv, &flash);
+    n = 0;
+    while (n < KV_INDEX_SIZE) {
+        snprintf(name, sizeof(name), "%u", n);
+        if (kv_put(&kv, name, value, 1) != KV_OK)
+            break;
+        ++n;
+    }
+    ok = n == KV_INDEX_SIZE * 3 / 4 && kv_put(&kv, "0", value, 2) == KV_OK;
+    ok &= kv_delete(&kv, "5") == KV_OK && kv_put(&kv, "another", value, 1) == KV_OK;
+    result("full index", ok);
+}
+
+// ----------------------------------------------------------------------------
+// Cut the power at each write a run of operations makes in turn, from the
+// same starting point: then, on remount (which may itself lose power, while
+// it tidies up) the store must hold what it held after the last sync before
+// the cut, or after some operation since.
+
+#define SCRIPT_LEN 1500
+
+static op_t script[SCRIPT_LEN];
+static uint8_t start_image[8 * KV_SECTOR_SIZE];
+static model_t start_model, synced, m;
+
+static void test_power_loss(void) {
+    // Get to a store which has been running a while, so compaction happens
+    sim_wipe();
+    kv_flash_t flash = sim_region(8);
+    kv_mount(&kv, &flash);
+    memset(&start_model, 0, sizeof(start_model));
+    for (uint i = 0; i < 3000; ++i) {
+        op_t op = random_op();
+        store_apply(&kv, &start_model, &op);
+        model_apply(&start_model, &op);
+    }
+    kv_sync(&kv);
+    memcpy(start_image, sim_flash, sizeof(start_image));
+    for (uint i = 0; i < SCRIPT_LEN; ++i)
+        script[i] = random_op();
+
+    // Count the writes
+    kv_mount(&kv, &flash);
+    sim_writes = 0;
+    for (uint i = 0; i < SCRIPT_LEN; ++i)
+        store_apply(&kv, &start_model, &script[i]);
+    uint32_t n_writes = sim_writes;
+
+    bool state_ok = true, usable_ok = true;
+    uint32_t recovered = 0;
+    for (uint32_t w = 1; w <= n_writes; ++w) {
+        memcpy(sim_flash, start_image, sizeof(start_image));
+        m = synced = start_model;
+        sim_writes = 0;
+        sim_fail_at = w;
+        volatile uint since_sync = 0, at = 0;
+        if (!setjmp(power_lost)) {
+            kv_mount(&kv, &flash);
+            for (at = 0; at < SCRIPT_LEN; ++at) {
+                store_apply(&kv, &m, &script[at]);
+                model_apply(&m, &script[at]);
+                if (script[at].type == OP_SYNC) {
+                    synced = m;
+                    since_sync = at + 1;
+                }
+            }
+        }
+        // Power cut; the next write it makes on coming back fails too
+        sim_fail_at = sim_writes + 1;
+        if (!setjmp(power_lost))
+            kv_mount(&kv, &flash);
+        sim_fail_at = 0;
+        kv_mount(&kv, &flash);
+        recovered += kv.stats.sectors_recovered;
+
+        // Which operation did it get to?
+        m = synced;
+        bool found = store_matches(&kv, &m);
+        for (uint i = since_sync; !found && i <= at && i < SCRIPT_LEN; ++i) {
+            model_apply(&m, &script[i]);
+            found = store_matches(&kv, &m);
+        }
+        state_ok &= found;
+
+        // Carry on from there
+        for (uint i = 0; i < 50; ++i) {
+            op_t op = random_op();
+            usable_ok &= store_apply(&kv, &m, &op);
+            model_apply(&m, &op);
+        }
+        kv_sync(&kv);
+        kv_mount(&kv, &flash);
+        usable_ok &= store_matches(&kv, &m);
+    }
+    printf("Cut the power at each of %u writes; %u sectors tidied up after\n", n_writes, recovered);
+    result("power loss: contents", state_ok);
+    result("power loss: carrying on", usable_ok);
+}
+
+// ----------------------------------------------------------------------------
+// A settings workload: 32 small values, in a 64 KB region as flash_kv.c uses,
+// synced after every change or every few
+
+#define BENCH_SECTORS 16
+#define BENCH_KEYS 32
+#define BENCH_PUTS 100000
+
+static void bench(uint sync_every) {
+    sim_wipe();
+    kv_flash_t flash = sim_region(BENCH_SECTORS);
+    kv_mount(&kv, &flash);
+    char names[BENCH_KEYS][16];
+    uint8_t value[32];
+    uint32_t settings_bytes = 0;
+    for (uint i = 0; i < BENCH_KEYS; ++i) {
+        snprintf(names[i], sizeof(names[i]), "cfg/%u", i);
+        settings_bytes += strlen(names[i]) + 1 + 4 + (i % 8) * 4;
+    }
+    memset(&kv.stats, 0, sizeof(kv.stats));
+    memset(kv.erase_count, 0, sizeof(kv.erase_count));
+    uint64_t t0 = time_us_64();
+    for (uint i = 0; i < BENCH_PUTS; ++i) {
+        // A few values, like counters, change all the time; the rest hardly
+        uint key = next_rand() % 8 ? next_rand() % 4 : next_rand() % BENCH_KEYS;
+        fill_value(value, i, 4 + (key % 8) * 4);
+        kv_put(&kv, names[key], value, 4 + (key % 8) * 4);
+        if (i % sync_every == sync_every - 1)
+            kv_sync(&kv);
+        kv_compact_step(&kv);
+    }
+    uint64_t t1 = time_us_64();
+    for (uint i = 0; i < BENCH_PUTS; ++i)
+        kv_get(&kv, names[i % BENCH_KEYS], value, sizeof(value));
+    uint64_t t2 = time_us_64();
+
+    uint32_t min_erases = UINT32_MAX, max_erases = 0;
+    for (uint s = 0; s < BENCH_SECTORS; ++s) {
+        min_erases = MIN(min_erases, kv.erase_count[s]);
+        max_erases = MAX(max_erases, kv.erase_count[s]);
+    }
+    const kv_stats_t *st = &kv.stats;
+    printf("\n%u puts of %u keys, synced every %u:\n", BENCH_PUTS, BENCH_KEYS, sync_every);
+    printf("  put %u ns, get %u ns on this machine, flash time not included\n",
+           (uint) ((t1 - t0) * 1000 / BENCH_PUTS), (uint) ((t2 - t1) * 1000 / BENCH_PUTS));
+    printf("  %u page programs, %u sector erases (%u per 1000 puts)\n",
+           st->programs, st->erases, st->erases * 1000 / BENCH_PUTS);
+    printf("  erases per sector: %u to %u\n", min_erases, max_erases);
+    printf("  records copied by compaction: %u; bytes written / bytes put: %u.%02u\n", st->records_copied,
+           st->bytes_written / st->bytes_stored, st->bytes_written * 100 / st->bytes_stored % 100);
+
+    // Keeping the settings in one sector, erased and rewritten on each change
+    uint32_t pages = (settings_bytes + KV_PAGE_SIZE - 1) / KV_PAGE_SIZE;
+    printf("  rewriting a sector instead: %u page programs, %u erases, all to the one sector\n",
+           BENCH_PUTS * pages, BENCH_PUTS);
+    printf("  so the most worn sector lasts %u times as long\n", BENCH_PUTS / MAX(max_erases, 1));
+    result("erases spread over the sectors", max_erases - min_erases <= 1);
+}
+
+int main() {
+    stdio_init_all();
+    printf("Flash key/value store test\n");
+
+    test_model();
+    test_limits();
+    test_power_loss();
+    bench(1);
+    bench(16);
+
+    printf(failures ? "FAILED\n" : "All good\n");
+    return failures ? 1 : 0;
+}
@@ -12,6 +12,8 @@
 
 // We're going to erase and reprogram a region 256k from the start of flash.
 // Once done, we can access this at XIP_BASE + 256k.
+// (Erasing the same sector for every change soon wears it out; see
+// flash/kv_store for a way to keep data which changes often.)
 #define FLASH_TARGET_OFFSET (256 * 1024)
 
 const uint8_t *flash_target_contents = (const uint8_t *) (XIP_BASE + FLASH_TARGET_OFFSET);
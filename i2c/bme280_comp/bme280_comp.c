@@ -0,0 +1,168 @@
+/**
+ * Copyright (c) 2022 Raspberry Pi (Trading) Ltd.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+#include <string.h>
+#include "bme280_comp.h"
+
+static inline uint16_t get_u16(const uint8_t *b) {
+    return (uint16_t) (b[0] | (b[1] << 8));
+}
+
+static inline int16_t get_s16(const uint8_t *b) {
+    return (int16_t) get_u16(b);
+}
+
+void bme280_comp_init(bme280_comp_t *c, const uint8_t calib_tp[BME280_CALIB_TP_LEN],
+                      const uint8_t calib_h[BME280_CALIB_H_LEN]) {
+    memset(c, 0, sizeof(*c));
+    c->t1 = get_u16(calib_tp + 0);
+    c->t2 = get_s16(calib_tp + 2);
+    c->t3 = get_s16(calib_tp + 4);
+
+    c->p1 = get_u16(calib_tp + 6);
+    c->p2 = get_s16(calib_tp + 8);
+    c->p3 = get_s16(calib_tp + 10);
+    c->p4 = get_s16(calib_tp + 12);
+    c->p5 = get_s16(calib_tp + 14);
+    c->p6 = get_s16(calib_tp + 16);
+    c->p7 = get_s16(calib_tp + 18);
+    c->p8 = get_s16(calib_tp + 20);
+    c->p9 = get_s16(calib_tp + 22);
+
+    if (calib_h) {
+        // h4 and h5 are signed 12-bit values, sharing the nibbles of 0xe5
+        c->humidity = true;
+        c->h1 = calib_h[0];
+        c->h2 = get_s16(calib_h + 1);
+        c->h3 = calib_h[3];
+        c->h4 = (int8_t) calib_h[4] * 16 | (calib_h[5] & 0xf);
+        c->h5 = (int8_t) calib_h[6] * 16 | (calib_h[5] >> 4);
+        c->h6 = (int8_t) calib_h[7];
+    }
+}
+
+void bme280_unpack_raw(const uint8_t *regs, bool humidity, bme280_raw_t *raw) {
+    raw->adc_p = (int32_t) ((uint32_t) regs[0] << 12 | (uint32_t) regs[1] << 4 | regs[2] >> 4);
+    raw->adc_t = (int32_t) ((uint32_t) regs[3] << 12 | (uint32_t) regs[4] << 4 | regs[5] >> 4);
+    raw->adc_h = humidity ? (int32_t) (regs[6] << 8 | regs[7]) : 0;
+}
+
+static inline int32_t t_fine_from_adc(const bme280_comp_t *c, int32_t adc_t) {
+    int32_t var1 = (((adc_t >> 3) - (c->t1 << 1)) * c->t2) >> 11;
+    int32_t d = (adc_t >> 4) - c->t1;
+    int32_t var2 = (((d * d) >> 12) * c->t3) >> 14;
+    return var1 + var2;
+}
+
+// The parts of the humidity formula which depend only on the temperature
+typedef struct {
+    uint32_t offset;
+    int32_t scale;
+} humidity_terms_t;
+
+static void humidity_terms(const bme280_comp_t *c, int32_t t_fine, humidity_terms_t *h) {
+    int32_t v = t_fine - 76800;
+    // The datasheet subtracts h4 << 20 and h5 * v from adc_h << 14 then adds
+    // 16384; unsigned, so that taking them all at once wraps the same way
+    h->offset = ((uint32_t) c->h4 << 20) + (uint32_t) (c->h5 * v) - 16384u;
+    h->scale = (((((((v * c->h6) >> 10) * (((v * c->h3) >> 11) + 32768)) >> 10) + 2097152) * c->h2 + 8192) >> 14);
+}
+
+static inline uint32_t humidity(const bme280_comp_t *c, const humidity_terms_t *h, int32_t adc_h) {
+    int32_t v = (int32_t) (((uint32_t) adc_h << 14) - h->offset) >> 15;
+    v *= h->scale;
+    v -= (((((v >> 15) * (v >> 15)) >> 7) * c->h1) >> 4);
+    v = v < 0 ? 0 : v;
+    v = v > 419430400 ? 419430400 : v;
+    return (uint32_t) (v >> 12);
+}
+
+void bme280_comp_convert32(const bme280_comp_t *c, const bme280_raw_t *raw, bme280_sample_t *out, uint n) {
+    int32_t last_adc_t = 0;
+    int32_t temperature = 0;
+    uint32_t p_offset = 0;
+    uint32_t p_divisor = 0;
+    humidity_terms_t h = {0};
+    for (uint i = 0; i < n; ++i) {
+        if (!i || raw[i].adc_t != last_adc_t) {
+            last_adc_t = raw[i].adc_t;
+            int32_t t_fine = t_fine_from_adc(c, last_adc_t);
+            temperature = (t_fine * 5 + 128) >> 8;
+
+            int32_t var1 = (t_fine >> 1) - 64000;
+            int32_t var2 = (((var1 >> 2) * (var1 >> 2)) >> 11) * c->p6;
+            var2 += (var1 * c->p5) << 1;
+            var2 = (var2 >> 2) + (c->p4 << 16);
+            var1 = (((c->p3 * (((var1 >> 2) * (var1 >> 2)) >> 13)) >> 3) + ((c->p2 * var1) >> 1)) >> 18;
+            var1 = ((32768 + var1) * c->p1) >> 15;
+            p_offset = (uint32_t) (var2 >> 12);
+            p_divisor = (uint32_t) var1;
+
+            if (c->humidity)
+                humidity_terms(c, t_fine, &h);
+        }
+
+        out[i].temperature = temperature;
+
+        // A zero divisor means the calibration is nonsense; the datasheet
+        // returns 0 to avoid the division
+        uint32_t p = 0;
+        if (p_divisor) {
+            p = ((uint32_t) (1048576 - raw[i].adc_p) - p_offset) * 3125;
+            if (p < 0x80000000)
+                p = (p << 1) / p_divisor;
+            else
+                p = (p / p_divisor) * 2;
+            int32_t var1 = (c->p9 * (int32_t) (((p >> 3) * (p >> 3)) >> 13)) >> 12;
+            int32_t var2 = ((int32_t) (p >> 2) * c->p8) >> 13;
+            p = (uint32_t) ((int32_t) p + ((var1 + var2 + c->p7) >> 4));
+        }
+        out[i].pressure = p;
+
+        out[i].humidity = c->humidity ? humidity(c, &h, raw[i].adc_h) : 0;
+    }
+}
+
+void bme280_comp_convert64(const bme280_comp_t *c, const bme280_raw_t *raw, bme280_sample_t *out, uint n) {
+    int32_t last_adc_t = 0;
+    int32_t temperature = 0;
+    int64_t p_offset = 0;
+    int64_t p_divisor = 0;
+    humidity_terms_t h = {0};
+    for (uint i = 0; i < n; ++i) {
+        if (!i || raw[i].adc_t != last_adc_t) {
+            last_adc_t = raw[i].adc_t;
+            int32_t t_fine = t_fine_from_adc(c, last_adc_t);
+            temperature = (t_fine * 5 + 128) >> 8;
+
+            int64_t var1 = (int64_t) t_fine - 128000;
+            int64_t var2 = var1 * var1 * c->p6;
+            var2 += (var1 * c->p5) << 17;
+            var2 += (int64_t) c->p4 << 35;
+            var1 = ((var1 * var1 * c->p3) >> 8) + ((var1 * c->p2) << 12);
+            var1 = (((int64_t) 1 << 47) + var1) * c->p1 >> 33;
+            p_offset = var2;
+            p_divisor = var1;
+
+            if (c->humidity)
+                humidity_terms(c, t_fine, &h);
+        }
+
+        out[i].temperature = temperature;
+
+        int64_t p = 0;
+        if (p_divisor) {
+            p = 1048576 - raw[i].adc_p;
+            p = (((p << 31) - p_offset) * 3125) / p_divisor;
+            int64_t var1 = ((int64_t) c->p9 * (p >> 13) * (p >> 13)) >> 25;
+            int64_t var2 = ((int64_t) c->p8 * p) >> 19;
+            p = ((p + var1 + var2) >> 8) + ((int64_t) c->p7 << 4);
+        }
+        out[i].pressure = (uint32_t) p;
+
+        out[i].humidity = c->humidity ? humidity(c, &h, raw[i].adc_h) : 0;
+    }
+}
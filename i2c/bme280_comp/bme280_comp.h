@@ -0,0 +1,78 @@
+/**
+ * Copyright (c) 2022 Raspberry Pi (Trading) Ltd.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+#ifndef _BME280_COMP_H
+#define _BME280_COMP_H
+
+#include "pico.h"
+
+// ----------------------------------------------------------------------------
+// Compensation of raw BMP280/BME280 readings, shared by i2c/bmp280_i2c and
+// spi/bme280_spi, using the integer formulas from the Bosch datasheets:
+//
+// https://www.bosch-sensortec.com/media/boschsensortec/downloads/datasheets/bst-bmp280-ds001.pdf
+// https://www.bosch-sensortec.com/media/boschsensortec/downloads/datasheets/bst-bme280-ds002.pdf
+//
+// The calibration words are unpacked once into a bme280_comp_t, already
+// sign extended and widened to 32 bits. Samples are converted
+// in batches: everything in the pressure and humidity formulas that depends
+// only on the temperature is worked out once per temperature reading, and
+// reused for the following samples while it doesn't change, which it seldom
+// does between one sample and the next.
+//
+// There are two pressure formulas:
+//
+// - bme280_comp_convert32() uses only 32-bit arithmetic and gives pressure in
+//   whole Pa. It matches the conversions the examples used before, bit for
+//   bit, and suits cores without a fast 64-bit multiply (such as the M0+).
+//
+// - bme280_comp_convert64() uses the datasheet's 64-bit formula, which gives
+//   pressure in 1/256 Pa (Q24.8).
+//
+// Temperature (in 0.01 degrees C) and humidity (in 1/1024 %RH, Q22.10) are
+// the same either way.
+
+// Number of calibration bytes starting at register 0x88 (0x88 to 0x9f), which
+// is all a BMP280 has
+#define BME280_CALIB_TP_LEN 24
+// The BME280's humidity calibration: register 0xa1, then 0xe1 to 0xe7
+#define BME280_CALIB_H_LEN 8
+
+// Raw readings, as unpacked by bme280_unpack_raw()
+typedef struct {
+    int32_t adc_t;
+    int32_t adc_p;
+    int32_t adc_h;
+} bme280_raw_t;
+
+typedef struct {
+    int32_t temperature; // 0.01 degrees C
+    uint32_t pressure;   // Pa, or 1/256 Pa from bme280_comp_convert64()
+    uint32_t humidity;   // 1/1024 %RH; 0 without humidity calibration
+} bme280_sample_t;
+
+typedef struct {
+    bool humidity;
+    int32_t t1, t2, t3;
+    int32_t p1, p2, p3, p4, p5, p6, p7, p8, p9;
+    int32_t h1, h2, h3, h4, h5, h6;
+} bme280_comp_t;
+
+// Unpack the calibration registers. calib_h may be NULL for a BMP280, or to
+// skip humidity; otherwise it holds register 0xa1 followed by 0xe1 to 0xe7.
+void bme280_comp_init(bme280_comp_t *c, const uint8_t calib_tp[BME280_CALIB_TP_LEN],
+                      const uint8_t calib_h[BME280_CALIB_H_LEN]);
+
+// Unpack a burst read of the data registers from 0xf7: 6 bytes, or 8 with
+// humidity (adc_h is then 0 without).
+void bme280_unpack_raw(const uint8_t *regs, bool humidity, bme280_raw_t *raw);
+
+// Convert n raw readings, with 32-bit arithmetic only
+void bme280_comp_convert32(const bme280_comp_t *c, const bme280_raw_t *raw, bme280_sample_t *out, uint n);
+
+// Convert n raw readings, with pressure from the 64-bit formula
+void bme280_comp_convert64(const bme280_comp_t *c, const bme280_raw_t *raw, bme280_sample_t *out, uint n);
+
+#endif
@@ -0,0 +1,320 @@
+/**
+ * Copyright (c) 2022 Raspberry Pi (Trading) Ltd.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+#include <stdio.h>
+#include "pico/stdlib.h"
+#include "bme280_comp.h"
+#include "test_rand.h"
+
+// Checks the compensation library against the worked example in the BMP280
+// datasheet, the per-sample functions the examples used to have, and the
+// datasheet's floating point formulas, then times them. The calibrations
+// compared are the datasheet's, with each word scaled at random by up to 10%,
+// as no two parts are trimmed the same.
+
+// ----------------------------------------------------------------------------
+// The per-sample functions from bmp280_i2c.c and bme280_spi.c, as they were
+
+typedef struct {
+    uint16_t dig_t1;
+    int16_t dig_t2, dig_t3;
+    uint16_t dig_p1;
+    int16_t dig_p2, dig_p3, dig_p4, dig_p5, dig_p6, dig_p7, dig_p8, dig_p9;
+    uint8_t dig_h1, dig_h3;
+    int8_t dig_h6;
+    int16_t dig_h2, dig_h4, dig_h5;
+} ref_calib_t;
+
+static __noinline int32_t ref_t_fine(int32_t temp, const ref_calib_t *params) {
+    int32_t var1, var2;
+    var1 = ((((temp >> 3) - ((int32_t)params->dig_t1 << 1))) * ((int32_t)params->dig_t2)) >> 11;
+    var2 = (((((temp >> 4) - ((int32_t)params->dig_t1)) * ((temp >> 4) - ((int32_t)params->dig_t1))) >> 12) * ((int32_t)params->dig_t3)) >> 14;
+    return var1 + var2;
+}
+
+static __noinline int32_t ref_convert_temp(int32_t temp, const ref_calib_t *params) {
+    int32_t t_fine = ref_t_fine(temp, params);
+    return (t_fine * 5 + 128) >> 8;
+}
+
+static __noinline uint32_t ref_convert_pressure(int32_t pressure, int32_t temp, const ref_calib_t *params) {
+    int32_t t_fine = ref_t_fine(temp, params);
+
+    int32_t var1, var2;
+    uint32_t converted = 0.0;
+    var1 = (((int32_t)t_fine) >> 1) - (int32_t)64000;
+    var2 = (((var1 >> 2) * (var1 >> 2)) >> 11) * ((int32_t)params->dig_p6);
+    var2 += ((var1 * ((int32_t)params->dig_p5)) << 1);
+    var2 = (var2 >> 2) + (((int32_t)params->dig_p4) << 16);
+    var1 = (((params->dig_p3 * (((var1 >> 2) * (var1 >> 2)) >> 13)) >> 3) + ((((int32_t)params->dig_p2) * var1) >> 1)) >> 18;
+    var1 = ((((32768 + var1)) * ((int32_t)params->dig_p1)) >> 15);
+    if (var1 == 0) {
+        return 0;  // avoid exception caused by division by zero
+    }
+    converted = (((uint32_t)(((int32_t)1048576) - pressure) - (var2 >> 12))) * 3125;
+    if (converted < 0x80000000) {
+        converted = (converted << 1) / ((uint32_t)var1);
+    } else {
+        converted = (converted / (uint32_t)var1) * 2;
+    }
+    var1 = (((int32_t)params->dig_p9) * ((int32_t)(((converted >> 3) * (converted >> 3)) >> 13))) >> 12;
+    var2 = (((int32_t)(converted >> 2)) * ((int32_t)params->dig_p8)) >> 13;
+    converted = (uint32_t)((int32_t)converted + ((var1 + var2 + params->dig_p7) >> 4));
+    return converted;
+}
+
+static __noinline uint32_t ref_compensate_humidity(int32_t adc_H, int32_t t_fine, const ref_calib_t *p) {
+    int32_t v_x1_u32r;
+    v_x1_u32r = (t_fine - ((int32_t) 76800));
+    v_x1_u32r = (((((adc_H << 14) - (((int32_t) p->dig_h4) << 20) - (((int32_t) p->dig_h5) * v_x1_u32r)) +
+                   ((int32_t) 16384)) >> 15) * (((((((v_x1_u32r * ((int32_t) p->dig_h6)) >> 10) * (((v_x1_u32r *
+                                                                                                  ((int32_t) p->dig_h3))
+            >> 11) + ((int32_t) 32768))) >> 10) + ((int32_t) 2097152)) *
+                                                 ((int32_t) p->dig_h2) + 8192) >> 14));
+    v_x1_u32r = (v_x1_u32r - (((((v_x1_u32r >> 15) * (v_x1_u32r >> 15)) >> 7) * ((int32_t) p->dig_h1)) >> 4));
+    v_x1_u32r = (v_x1_u32r < 0 ? 0 : v_x1_u32r);
+    v_x1_u32r = (v_x1_u32r > 419430400 ? 419430400 : v_x1_u32r);
+
+    return (uint32_t) (v_x1_u32r >> 12);
+}
+
+// ----------------------------------------------------------------------------
+// The datasheets' floating point formulas
+
+static double float_t_fine(const ref_calib_t *p, int32_t adc_t) {
+    double var1 = (adc_t / 16384.0 - p->dig_t1 / 1024.0) * p->dig_t2;
+    double d = adc_t / 131072.0 - p->dig_t1 / 8192.0;
+    double var2 = d * d * p->dig_t3;
+    return var1 + var2;
+}
+
+static double float_pressure(const ref_calib_t *p, int32_t adc_p, double t_fine) {
+    double var1 = t_fine / 2.0 - 64000.0;
+    double var2 = var1 * var1 * p->dig_p6 / 32768.0;
+    var2 = var2 + var1 * p->dig_p5 * 2.0;
+    var2 = var2 / 4.0 + p->dig_p4 * 65536.0;
+    var1 = (p->dig_p3 * var1 * var1 / 524288.0 + p->dig_p2 * var1) / 524288.0;
+    var1 = (1.0 + var1 / 32768.0) * p->dig_p1;
+    double pa = 1048576.0 - adc_p;
+    pa = (pa - var2 / 4096.0) * 6250.0 / var1;
+    var1 = p->dig_p9 * pa * pa / 2147483648.0;
+    var2 = pa * p->dig_p8 / 32768.0;
+    return pa + (var1 + var2 + p->dig_p7) / 16.0;
+}
+
+static double float_humidity(const ref_calib_t *p, int32_t adc_h, double t_fine) {
+    double h = t_fine - 76800.0;
+    h = (adc_h - (p->dig_h4 * 64.0 + p->dig_h5 / 16384.0 * h)) *
+        (p->dig_h2 / 65536.0 * (1.0 + p->dig_h6 / 67108864.0 * h * (1.0 + p->dig_h3 / 67108864.0 * h)));
+    h = h * (1.0 - p->dig_h1 * h / 524288.0);
+    return h < 0 ? 0 : h > 100 ? 100 : h;
+}
+
+// ----------------------------------------------------------------------------
+
+// The compensation example from the BMP280 datasheet, with typical humidity
+// parameters from a BME280
+static const ref_calib_t datasheet = {
+    .dig_t1 = 27504, .dig_t2 = 26435, .dig_t3 = -1000,
+    .dig_p1 = 36477, .dig_p2 = -10685, .dig_p3 = 3024, .dig_p4 = 2855, .dig_p5 = 140,
+    .dig_p6 = -7, .dig_p7 = 15500, .dig_p8 = -14600, .dig_p9 = 6000,
+    .dig_h1 = 75, .dig_h2 = 362, .dig_h3 = 0, .dig_h4 = 313, .dig_h5 = 50, .dig_h6 = 30,
+};
+
+// Lay the calibration out as the registers hold it, and load it
+static void comp_init(bme280_comp_t *c, const ref_calib_t *p, bool humidity) {
+    uint8_t tp[BME280_CALIB_TP_LEN];
+    const uint16_t words[12] = {
+        p->dig_t1, (uint16_t) p->dig_t2, (uint16_t) p->dig_t3,
+        p->dig_p1, (uint16_t) p->dig_p2, (uint16_t) p->dig_p3, (uint16_t) p->dig_p4, (uint16_t) p->dig_p5,
+        (uint16_t) p->dig_p6, (uint16_t) p->dig_p7, (uint16_t) p->dig_p8, (uint16_t) p->dig_p9,
+    };
+    for (uint i = 0; i < 12; ++i) {
+        tp[i * 2] = (uint8_t) words[i];
+        tp[i * 2 + 1] = (uint8_t) (words[i] >> 8);
+    }
+    const uint8_t h[BME280_CALIB_H_LEN] = {
+        p->dig_h1,
+        (uint8_t) p->dig_h2, (uint8_t) (p->dig_h2 >> 8),
+        p->dig_h3,
+        (uint8_t) (p->dig_h4 >> 4), (uint8_t) ((p->dig_h4 & 0xf) | (p->dig_h5 << 4)), (uint8_t) (p->dig_h5 >> 4),
+        (uint8_t) p->dig_h6,
+    };
+    bme280_comp_init(c, tp, humidity ? h : NULL);
+}
+
+// Scale a calibration word by up to +/-10%
+static int32_t jiggle(int32_t v) {
+    return v + (int32_t) ((int64_t) v * ((int32_t) (next_rand() % 201) - 100) / 1000);
+}
+
+static void random_calib(ref_calib_t *p) {
+    *p = datasheet;
+    p->dig_t1 = (uint16_t) jiggle(p->dig_t1);
+    p->dig_t2 = (int16_t) jiggle(p->dig_t2);
+    p->dig_t3 = (int16_t) jiggle(p->dig_t3);
+    p->dig_p1 = (uint16_t) jiggle(p->dig_p1);
+    p->dig_p2 = (int16_t) jiggle(p->dig_p2);
+    p->dig_p3 = (int16_t) jiggle(p->dig_p3);
+    p->dig_p4 = (int16_t) jiggle(p->dig_p4);
+    p->dig_p5 = (int16_t) jiggle(p->dig_p5);
+    p->dig_p7 = (int16_t) jiggle(p->dig_p7);
+    p->dig_p8 = (int16_t) jiggle(p->dig_p8);
+    p->dig_p9 = (int16_t) jiggle(p->dig_p9);
+    p->dig_h2 = (int16_t) jiggle(p->dig_h2);
+    p->dig_h4 = (int16_t) jiggle(p->dig_h4);
+    p->dig_h5 = (int16_t) jiggle(p->dig_h5);
+}
+
+// Raw readings from about -20 to 60 C, 300 to 1100 hPa, and any humidity,
+// with each temperature repeated up to 4 times
+static void random_raw(bme280_raw_t *raw, uint n) {
+    int32_t adc_t = 0;
+    for (uint i = 0; i < n; ++i) {
+        if (!i || !(next_rand() & 3))
+            adc_t = 420000 + (int32_t) (next_rand() % 220000);
+        raw[i].adc_t = adc_t;
+        raw[i].adc_p = 250000 + (int32_t) (next_rand() % 450000);
+        raw[i].adc_h = 20000 + (int32_t) (next_rand() % 40000);
+    }
+}
+
+#define N_SAMPLES 256
+
+static bme280_raw_t raw[N_SAMPLES];
+static bme280_sample_t out32[N_SAMPLES];
+static bme280_sample_t out64[N_SAMPLES];
+static uint failures;
+
+static void result(const char *name, bool ok) {
+    printf("%-40s %s\n", name, ok ? "ok" : "FAILED");
+    if (!ok)
+        ++failures;
+}
+
+static void test_datasheet_example(void) {
+    bme280_comp_t c;
+    comp_init(&c, &datasheet, true);
+    bme280_raw_t r = {.adc_t = 519888, .adc_p = 415148, .adc_h = 0};
+    bme280_sample_t s32, s64;
+    bme280_comp_convert32(&c, &r, &s32, 1);
+    bme280_comp_convert64(&c, &r, &s64, 1);
+    // The datasheet gives 25.08 C and 100653.27 Pa (from the floating point
+    // formula); the 32-bit formula is only good to a few Pa
+    printf("datasheet example: %d, %u Pa, %u / 256 Pa\n", s32.temperature, s32.pressure, s64.pressure);
+    result("datasheet example: temperature", s32.temperature == 2508 && s64.temperature == 2508);
+    result("datasheet example: 32-bit pressure", s32.pressure >= 100650 && s32.pressure <= 100657);
+    result("datasheet example: 64-bit pressure", s64.pressure >= 25767220 && s64.pressure <= 25767240);
+}
+
+static void test_unpack(void) {
+    const uint8_t regs[8] = {0x65, 0x5a, 0xc0, 0x7e, 0xed, 0x00, 0x6e, 0x1c};
+    bme280_raw_t r;
+    bme280_unpack_raw(regs, true, &r);
+    bool ok = r.adc_p == 415148 && r.adc_t == 519888 && r.adc_h == 0x6e1c;
+    bme280_unpack_raw(regs, false, &r);
+    ok &= r.adc_h == 0;
+    result("unpack", ok);
+}
+
+static void test_against_reference(void) {
+    uint mismatches = 0;
+    double worst_p32 = 0, worst_p64 = 0, worst_h = 0;
+    for (uint round = 0; round < 200; ++round) {
+        ref_calib_t p;
+        random_calib(&p);
+        bme280_comp_t c;
+        comp_init(&c, &p, true);
+        random_raw(raw, N_SAMPLES);
+        bme280_comp_convert32(&c, raw, out32, N_SAMPLES);
+        bme280_comp_convert64(&c, raw, out64, N_SAMPLES);
+        for (uint i = 0; i < N_SAMPLES; ++i) {
+            int32_t t_fine = ref_t_fine(raw[i].adc_t, &p);
+            if (out32[i].temperature != ref_convert_temp(raw[i].adc_t, &p) ||
+                out32[i].pressure != ref_convert_pressure(raw[i].adc_p, raw[i].adc_t, &p) ||
+                out32[i].humidity != ref_compensate_humidity(raw[i].adc_h, t_fine, &p) ||
+                out64[i].temperature != out32[i].temperature || out64[i].humidity != out32[i].humidity)
+                ++mismatches;
+
+            double ft = float_t_fine(&p, raw[i].adc_t);
+            double fp = float_pressure(&p, raw[i].adc_p, ft);
+            double fh = float_humidity(&p, raw[i].adc_h, ft);
+            double e = out32[i].pressure - fp;
+            worst_p32 = MAX(worst_p32, e < 0 ? -e : e);
+            e = out64[i].pressure / 256.0 - fp;
+            worst_p64 = MAX(worst_p64, e < 0 ? -e : e);
+            e = out32[i].humidity / 1024.0 - fh;
+            worst_h = MAX(worst_h, e < 0 ? -e : e);
+        }
+    }
+    printf("worst error against floating point: 32-bit %.3f Pa, 64-bit %.3f Pa, humidity %.4f %%RH\n",
+           worst_p32, worst_p64, worst_h);
+    result("bit exact with the old functions", !mismatches);
+    result("32-bit pressure within 10 Pa", worst_p32 < 10.0);
+    result("64-bit pressure within 1 Pa", worst_p64 < 1.0);
+    result("humidity within 0.02 %RH", worst_h < 0.02);
+}
+
+static void benchmark(void) {
+    ref_calib_t p = datasheet;
+    // A BMP280, as the old functions don't do humidity
+    bme280_comp_t c;
+    comp_init(&c, &p, false);
+    static int32_t temperature[N_SAMPLES];
+    static uint32_t pressure[N_SAMPLES];
+    const uint rounds = 200;
+
+    for (uint steady = 0; steady < 2; ++steady) {
+        random_raw(raw, N_SAMPLES);
+        if (steady) {
+            for (uint i = 0; i < N_SAMPLES; ++i)
+                raw[i].adc_t = raw[0].adc_t;
+        } else {
+            for (uint i = 0; i < N_SAMPLES; ++i)
+                raw[i].adc_t += i;
+        }
+
+        uint64_t t0 = time_us_64();
+        for (uint r = 0; r < rounds; ++r) {
+            for (uint i = 0; i < N_SAMPLES; ++i) {
+                temperature[i] = ref_convert_temp(raw[i].adc_t, &p);
+                pressure[i] = ref_convert_pressure(raw[i].adc_p, raw[i].adc_t, &p);
+            }
+        }
+        uint64_t t1 = time_us_64();
+        for (uint r = 0; r < rounds; ++r)
+            bme280_comp_convert32(&c, raw, out32, N_SAMPLES);
+        uint64_t t2 = time_us_64();
+        for (uint r = 0; r < rounds; ++r)
+            bme280_comp_convert64(&c, raw, out64, N_SAMPLES);
+        uint64_t t3 = time_us_64();
+
+        // Temperature and pressure, as the examples convert them
+        double samples = (double) rounds * N_SAMPLES;
+        printf("%s temperature:\n", steady ? "steady" : "changing");
+        printf("  old functions   %10.0f samples/s\n", samples * 1e6 / (double) MAX(t1 - t0, 1));
+        printf("  convert32       %10.0f samples/s\n", samples * 1e6 / (double) MAX(t2 - t1, 1));
+        printf("  convert64       %10.0f samples/s\n", samples * 1e6 / (double) MAX(t3 - t2, 1));
+        // Keep the old results alive
+        if (temperature[N_SAMPLES - 1] != out32[N_SAMPLES - 1].temperature ||
+            pressure[N_SAMPLES - 1] != out32[N_SAMPLES - 1].pressure)
+            ++failures;
+    }
+}
+
+int main() {
+    stdio_init_all();
+    printf("BMP280/BME280 compensation test\n");
+    seed_rand(0x2545f491);
+
+    test_datasheet_example();
+    test_unpack();
+    test_against_reference();
+    benchmark();
+
+    printf(failures ? "FAILED\n" : "All good\n");
+    return failures ? 1 : 0;
+}
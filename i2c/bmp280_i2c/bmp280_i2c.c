@@ -9,6 +9,7 @@
 #include "hardware/i2c.h"
 #include "pico/binary_info.h"
 #include "pico/stdlib.h"
+#include "bme280_comp.h"
 
  /* Example code to talk to a BMP280 temperature and pressure sensor
 
@@ -71,25 +72,7 @@
 #define REG_DIG_P9_MSB _u(0x9F)
 
 // number of calibration registers to be read
-#define NUM_CALIB_PARAMS 24
-
-struct bmp280_calib_param {
-    // temperature params
-    uint16_t dig_t1;
-    int16_t dig_t2;
-    int16_t dig_t3;
-
-    // pressure params
-    uint16_t dig_p1;
-    int16_t dig_p2;
-    int16_t dig_p3;
-    int16_t dig_p4;
-    int16_t dig_p5;
-    int16_t dig_p6;
-    int16_t dig_p7;
-    int16_t dig_p8;
-    int16_t dig_p9;
-};
+#define NUM_CALIB_PARAMS BME280_CALIB_TP_LEN
 
 #ifdef i2c_default
 void bmp280_init() {
@@ -111,7 +94,7 @@ void bmp280_init() {
     i2c_write_blocking(i2c_default, ADDR, buf, 2, false);
 }
 
-void bmp280_read_raw(int32_t* temp, int32_t* pressure) {
+void bmp280_read_raw(bme280_raw_t* raw) {
     // BMP280 data registers are auto-incrementing and we have 3 temperature and
     // pressure registers each, so we start at 0xF7 and read 6 bytes to 0xFC
     // note: normal mode does not require further ctrl_meas and config register writes
@@ -121,9 +104,8 @@ void bmp280_read_raw(int32_t* temp, int32_t* pressure) {
     i2c_write_blocking(i2c_default, ADDR, &reg, 1, true);  // true to keep master control of bus
     i2c_read_blocking(i2c_default, ADDR, buf, 6, false);  // false - finished with bus
 
-    // store the 20 bit read in a 32 bit signed integer for conversion
-    *pressure = (buf[0] << 12) | (buf[1] << 4) | (buf[2] >> 4);
-    *temp = (buf[3] << 12) | (buf[4] << 4) | (buf[5] >> 4);
+    // store the 20 bit reads in 32 bit signed integers for conversion
+    bme280_unpack_raw(buf, false, raw);
 }
 
 void bmp280_reset() {
@@ -132,53 +114,7 @@ void bmp280_reset() {
     i2c_write_blocking(i2c_default, ADDR, buf, 2, false);
 }
 
-// intermediate function that calculates the fine resolution temperature
-// used for both pressure and temperature conversions
-int32_t bmp280_convert(int32_t temp, struct bmp280_calib_param* params) {
-    // use the 32-bit fixed point compensation implementation given in the
-    // datasheet
-    
-    int32_t var1, var2;
-    var1 = ((((temp >> 3) - ((int32_t)params->dig_t1 << 1))) * ((int32_t)params->dig_t2)) >> 11;
-    var2 = (((((temp >> 4) - ((int32_t)params->dig_t1)) * ((temp >> 4) - ((int32_t)params->dig_t1))) >> 12) * ((int32_t)params->dig_t3)) >> 14;
-    return var1 + var2;
-}
-
-int32_t bmp280_convert_temp(int32_t temp, struct bmp280_calib_param* params) {
-    // uses the BMP280 calibration parameters to compensate the temperature value read from its registers
-    int32_t t_fine = bmp280_convert(temp, params);
-    return (t_fine * 5 + 128) >> 8;
-}
-
-int32_t bmp280_convert_pressure(int32_t pressure, int32_t temp, struct bmp280_calib_param* params) {
-    // uses the BMP280 calibration parameters to compensate the pressure value read from its registers
-
-    int32_t t_fine = bmp280_convert(temp, params);
-
-    int32_t var1, var2;
-    uint32_t converted = 0.0;
-    var1 = (((int32_t)t_fine) >> 1) - (int32_t)64000;
-    var2 = (((var1 >> 2) * (var1 >> 2)) >> 11) * ((int32_t)params->dig_p6);
-    var2 += ((var1 * ((int32_t)params->dig_p5)) << 1);
-    var2 = (var2 >> 2) + (((int32_t)params->dig_p4) << 16);
-    var1 = (((params->dig_p3 * (((var1 >> 2) * (var1 >> 2)) >> 13)) >> 3) + ((((int32_t)params->dig_p2) * var1) >> 1)) >> 18;
-    var1 = ((((32768 + var1)) * ((int32_t)params->dig_p1)) >> 15);
-    if (var1 == 0) {
-        return 0;  // avoid exception caused by division by zero
-    }
-    converted = (((uint32_t)(((int32_t)1048576) - pressure) - (var2 >> 12))) * 3125;
-    if (converted < 0x80000000) {
-        converted = (converted << 1) / ((uint32_t)var1);
-    } else {
-        converted = (converted / (uint32_t)var1) * 2;
-    }
-    var1 = (((int32_t)params->dig_p9) * ((int32_t)(((converted >> 3) * (converted >> 3)) >> 13))) >> 12;
-    var2 = (((int32_t)(converted >> 2)) * ((int32_t)params->dig_p8)) >> 13;
-    converted = (uint32_t)((int32_t)converted + ((var1 + var2 + params->dig_p7) >> 4));
-    return converted;
-}
-
-void bmp280_get_calib_params(struct bmp280_calib_param* params) {
+void bmp280_get_calib_params(bme280_comp_t* comp) {
     // raw temp and pressure values need to be calibrated according to
     // parameters generated during the manufacturing of the sensor
     // there are 3 temperature params, and 9 pressure params, each with a LSB
@@ -190,20 +126,9 @@ void bmp280_get_calib_params(struct bmp280_calib_param* params) {
     // read in one go as register addresses auto-increment
     i2c_read_blocking(i2c_default, ADDR, buf, NUM_CALIB_PARAMS, false);  // false, we're done reading
 
-    // store these in a struct for later use
-    params->dig_t1 = (uint16_t)(buf[1] << 8) | buf[0];
-    params->dig_t2 = (int16_t)(buf[3] << 8) | buf[2];
-    params->dig_t3 = (int16_t)(buf[5] << 8) | buf[4];
-
-    params->dig_p1 = (uint16_t)(buf[7] << 8) | buf[6];
-    params->dig_p2 = (int16_t)(buf[9] << 8) | buf[8];
-    params->dig_p3 = (int16_t)(buf[11] << 8) | buf[10];
-    params->dig_p4 = (int16_t)(buf[13] << 8) | buf[12];
-    params->dig_p5 = (int16_t)(buf[15] << 8) | buf[14];
-    params->dig_p6 = (int16_t)(buf[17] << 8) | buf[16];
-    params->dig_p7 = (int16_t)(buf[19] << 8) | buf[18];
-    params->dig_p8 = (int16_t)(buf[21] << 8) | buf[20];
-    params->dig_p9 = (int16_t)(buf[23] << 8) | buf[22];
+    // unpack these into a struct for later use, ready for the compensation
+    // formulas (see bme280_comp.h), which are shared with spi/bme280_spi
+    bme280_comp_init(comp, buf, NULL);
 }
 
 #endif
@@ -232,19 +157,20 @@ int main() {
     bmp280_init();
 
     // retrieve fixed compensation params
-    struct bmp280_calib_param params;
-    bmp280_get_calib_params(&params);
+    bme280_comp_t comp;
+    bmp280_get_calib_params(&comp);
 
-    int32_t raw_temperature;
-    int32_t raw_pressure;
+    bme280_raw_t raw;
+    bme280_sample_t sample;
 
     sleep_ms(250); // sleep so that data polling and register update don't collide
     while (1) {
-        bmp280_read_raw(&raw_temperature, &raw_pressure);
-        int32_t temperature = bmp280_convert_temp(raw_temperature, &params);
-        int32_t pressure = bmp280_convert_pressure(raw_pressure, raw_temperature, &params);
-        printf("Pressure = %.3f kPa\n", pressure / 1000.f);
-        printf("Temp. = %.2f C\n", temperature / 100.f);
+        bmp280_read_raw(&raw);
+        // use the 32-bit fixed point compensation implementation given in the
+        // datasheet
+        bme280_comp_convert32(&comp, &raw, &sample, 1);
+        printf("Pressure = %.3f kPa\n", sample.pressure / 1000.f);
+        printf("Temp. = %.2f C\n", sample.temperature / 100.f);
         // poll every 500ms
         sleep_ms(500);
     }
@@ -0,0 +1,145 @@
+/**
+ * Copyright (c) 2022 Raspberry Pi (Trading) Ltd.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+#include <string.h>
+#include "imu_fusion.h"
+
+#define ONE_Q30 (1 << 30)
+
+uint imu_fifo_unpack(const uint8_t *fifo, uint len, uint64_t newest_us, uint32_t period_us, imu_sample_t *out) {
+    uint n = len / IMU_FIFO_FRAME_LEN;
+    for (uint i = 0; i < n; ++i, fifo += IMU_FIFO_FRAME_LEN) {
+        for (uint j = 0; j < 3; ++j) {
+            out[i].accel[j] = (int16_t) (fifo[j * 2] << 8 | fifo[j * 2 + 1]);
+            out[i].gyro[j] = (int16_t) (fifo[8 + j * 2] << 8 | fifo[8 + j * 2 + 1]);
+        }
+        out[i].temp = (int16_t) (fifo[6] << 8 | fifo[7]);
+        out[i].timestamp_us = newest_us - (uint64_t) (n - 1 - i) * period_us;
+    }
+    return n;
+}
+
+static inline int32_t mul_q30(int32_t a, int32_t b) {
+    return (int32_t) (((int64_t) a * b) >> 30);
+}
+
+static inline int64_t mul_q30_wide(int32_t a, int32_t b) {
+    return ((int64_t) a * b) >> 30;
+}
+
+// 2^30 / sqrt(x) for x in [1, 4), at the middle of each of 96 steps of 1/32
+static const uint32_t inv_sqrt_seed[96] = {
+    0x3f817b11, 0x3e8cfe50, 0x3da336ec, 0x3cc36272, 0x3becd137, 0x3b1ee412,
+    0x3a590a6a, 0x399ac08c, 0x38e38e39, 0x38330566, 0x3788c126, 0x36e464b7,
+    0x36459aae, 0x35ac143a, 0x35178883, 0x3487b416, 0x33fc5863, 0x33753b4e,
+    0x32f226c6, 0x3272e86d, 0x31f75143, 0x317f3561, 0x310a6bb2, 0x3098cdbe,
+    0x302a3771, 0x2fbe86eb, 0x2f559c56, 0x2eef59bd, 0x2e8ba2e9, 0x2e2a5d3f,
+    0x2dcb6fa3, 0x2d6ec25e, 0x2d143f02, 0x2cbbd056, 0x2c656240, 0x2c10e1b2,
+    0x2bbe3c98, 0x2b6d61c7, 0x2b1e40f0, 0x2ad0ca91, 0x2a84efe8, 0x2a3aa2e8,
+    0x29f1d62d, 0x29aa7cf3, 0x29648b0c, 0x291ff4d6, 0x28dcaf36, 0x289aaf8d,
+    0x2859ebb4, 0x281a59f3, 0x27dbf0fd, 0x279ea7e7, 0x27627627, 0x2727538c,
+    0x26ed3839, 0x26b41ca4, 0x267bf98e, 0x2644c800, 0x260e814a, 0x25d91efd,
+    0x25a49ae7, 0x2570ef15, 0x253e15c9, 0x250c097d, 0x24dac4de, 0x24aa42c9,
+    0x247a7e4b, 0x244b729e, 0x241d1b26, 0x23ef7370, 0x23c27730, 0x2396223e,
+    0x236a7098, 0x233f5e5d, 0x2314e7cc, 0x22eb0945, 0x22c1bf44, 0x22990664,
+    0x2270db5a, 0x22493af6, 0x22222222, 0x21fb8ddf, 0x21d57b48, 0x21afe78a,
+    0x218acfee, 0x216631cc, 0x21420a94, 0x211e57c6, 0x20fb16f9, 0x20d845d1,
+    0x20b5e207, 0x2093e962, 0x207259ba, 0x205130f8, 0x20306d11, 0x20100c0a,
+};
+
+bool imu_fusion_normalize(int32_t *v, uint n) {
+    uint64_t x = 0;
+    for (uint i = 0; i < n; ++i)
+        x += (uint64_t) ((int64_t) v[i] * v[i]);
+    if (!x)
+        return false;
+
+    // Shift the sum of squares left by an even number of bits, into [2^62,
+    // 2^64), so that as a Q62 number m it is in [1, 4), then find 1/sqrt(m)
+    uint e = (uint) __builtin_clzll(x) & ~1u;
+    uint64_t m = x << e;
+    int64_t m_q30 = (int64_t) (m >> 32);
+    int64_t y = inv_sqrt_seed[(m >> 57) - 32];
+    for (uint i = 0; i < 2; ++i) {
+        int64_t t = (((m_q30 * y) >> 30) * y) >> 30;
+        y = (y * ((3ll << 30) - t)) >> 31;
+    }
+
+    // 1/sqrt(x) is y / 2^30 * 2^(e/2) / 2^31
+    uint shift = 31 - e / 2;
+    for (uint i = 0; i < n; ++i)
+        v[i] = (int32_t) (((int64_t) v[i] * y) >> shift);
+    return true;
+}
+
+void imu_fusion_init(imu_fusion_t *f, float sample_hz, float gyro_range_dps, float beta) {
+    memset(f, 0, sizeof(*f));
+    f->q[0] = ONE_Q30;
+    // The gyro is +/-32768 LSB full scale
+    const float pi = 3.14159265f;
+    f->gyro_k = (int32_t) (gyro_range_dps / 32768.0f * pi / 180.0f / sample_hz / 2.0f * 68719476736.0f + 0.5f);
+    f->beta_dt = (int32_t) (beta / sample_hz * (float) ONE_Q30 + 0.5f);
+}
+
+void imu_fusion_align(imu_fusion_t *f, const int16_t accel[3]) {
+    int32_t a[3] = {accel[0], accel[1], accel[2]};
+    if (!imu_fusion_normalize(a, 3))
+        return;
+    // The shortest rotation from level, which has gravity along +z, to a.
+    // Upside down, any rotation of half a turn about a horizontal axis will do.
+    // That is (1 + a.z, a.y, -a.x, 0), halved to keep the first in range.
+    int32_t q[4] = {(ONE_Q30 >> 1) + (a[2] >> 1), a[1] >> 1, -a[0] >> 1, 0};
+    if (q[0] < (ONE_Q30 >> 16)) {
+        q[0] = 0;
+        q[1] = ONE_Q30;
+        q[2] = 0;
+    }
+    imu_fusion_normalize(q, 4);
+    memcpy(f->q, q, sizeof(q));
+}
+
+void imu_fusion_update(imu_fusion_t *f, const imu_sample_t *s, uint n) {
+    int32_t q[4] = {f->q[0], f->q[1], f->q[2], f->q[3]};
+    for (uint i = 0; i < n; ++i, ++s) {
+        // Half the rotation since the last sample, in Q30 radians
+        int32_t h[3];
+        for (uint j = 0; j < 3; ++j)
+            h[j] = (int32_t) (((int64_t) (s->gyro[j] - f->gyro_bias[j]) * f->gyro_k) >> 6);
+
+        // The change from the gyro, q * (0, h)
+        int32_t d[4] = {
+            -mul_q30(q[1], h[0]) - mul_q30(q[2], h[1]) - mul_q30(q[3], h[2]),
+            mul_q30(q[0], h[0]) + mul_q30(q[2], h[2]) - mul_q30(q[3], h[1]),
+            mul_q30(q[0], h[1]) - mul_q30(q[1], h[2]) + mul_q30(q[3], h[0]),
+            mul_q30(q[0], h[2]) + mul_q30(q[1], h[1]) - mul_q30(q[2], h[0]),
+        };
+
+        // Then a step of gradient descent towards the orientation in which
+        // gravity is where the accelerometer says it is. Half of the gradient
+        // from the report, which simplifies a little when q is a unit
+        // quaternion; its elements are within +/-6.
+        int32_t a[3] = {s->accel[0], s->accel[1], s->accel[2]};
+        if (imu_fusion_normalize(a, 3)) {
+            int32_t k = mul_q30(q[1], q[1]) + mul_q30(q[2], q[2]);
+            int64_t g0 = 2 * mul_q30_wide(q[0], k) + mul_q30_wide(q[2], a[0]) - mul_q30_wide(q[1], a[1]);
+            int64_t g1 = 2 * (mul_q30_wide(q[1], k) + mul_q30_wide(q[1], a[2])) - mul_q30_wide(q[3], a[0]) -
+                         mul_q30_wide(q[0], a[1]);
+            int64_t g2 = 2 * (mul_q30_wide(q[2], k) + mul_q30_wide(q[2], a[2])) + mul_q30_wide(q[0], a[0]) -
+                         mul_q30_wide(q[3], a[1]);
+            int64_t g3 = 2 * mul_q30_wide(q[3], k) - mul_q30_wide(q[1], a[0]) - mul_q30_wide(q[2], a[1]);
+            int32_t g[4] = {(int32_t) (g0 >> 3), (int32_t) (g1 >> 3), (int32_t) (g2 >> 3), (int32_t) (g3 >> 3)};
+            if (imu_fusion_normalize(g, 4)) {
+                for (uint j = 0; j < 4; ++j)
+                    d[j] -= mul_q30(f->beta_dt, g[j]);
+            }
+        }
+
+        for (uint j = 0; j < 4; ++j)
+            q[j] += d[j];
+        imu_fusion_normalize(q, 4);
+    }
+    memcpy(f->q, q, sizeof(q));
+}
@@ -0,0 +1,73 @@
+/**
+ * Copyright (c) 2022 Raspberry Pi (Trading) Ltd.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+#ifndef _IMU_FUSION_H
+#define _IMU_FUSION_H
+
+#include "pico.h"
+
+// ----------------------------------------------------------------------------
+// Unpacking of MPU6050/MPU9250 FIFO data, and a fixed-point Madgwick filter to
+// turn the samples into an orientation, shared by i2c/mpu6050_i2c and
+// spi/mpu9250_spi.
+//
+// With FIFO_EN set to IMU_FIFO_EN_ACCEL_TEMP_GYRO, both parts push a 14 byte
+// frame into their FIFO every sample: the accelerometer, the temperature and
+// the gyro, big endian, in the same order as registers 0x3b to 0x48.
+//
+// The filter is the IMU (no magnetometer) form of the one in Sebastian
+// Madgwick's report, "An efficient orientation filter for inertial and
+// inertial/magnetic sensor arrays". Everything in imu_fusion_update() is
+// 32-bit integers with 64-bit products: the quaternion and the unit vectors
+// are Q30, and the square roots are a table lookup and two Newton-Raphson
+// steps, so there is no floating point (which is all in software on the M0+)
+// anywhere on the way.
+
+// FIFO_EN (register 0x23): temperature, gyro X, Y and Z, and accelerometer
+#define IMU_FIFO_EN_ACCEL_TEMP_GYRO 0xf8
+#define IMU_FIFO_FRAME_LEN 14
+
+typedef struct {
+    int16_t accel[3];
+    int16_t temp;
+    int16_t gyro[3];
+    uint64_t timestamp_us;
+} imu_sample_t;
+
+// Unpack the whole frames in len bytes read from FIFO_R_W (register 0x74), and
+// return how many there were. The last frame is the newest, and is stamped
+// newest_us; the others are stamped period_us apart before it.
+uint imu_fifo_unpack(const uint8_t *fifo, uint len, uint64_t newest_us, uint32_t period_us, imu_sample_t *out);
+
+typedef struct {
+    // Orientation of the earth relative to the sensor: w, x, y, z in Q30
+    int32_t q[4];
+    // Half the rotation in one sample per gyro LSB, in Q36 radians
+    int32_t gyro_k;
+    // Filter gain times the sample period, Q30
+    int32_t beta_dt;
+    // Subtracted from every gyro reading; zero after imu_fusion_init()
+    int16_t gyro_bias[3];
+} imu_fusion_t;
+
+// Set up for samples at sample_hz, with the gyro at +/-gyro_range_dps full
+// scale. beta is the gain in rad/s, 0.1 or so: bigger settles faster after a
+// disturbance, and lets more accelerometer noise through. The orientation
+// starts out level.
+void imu_fusion_init(imu_fusion_t *f, float sample_hz, float gyro_range_dps, float beta);
+
+// Start from the orientation a reading from the accelerometer, at rest, says
+// the sensor is in (with no yaw), rather than waiting for the filter to settle
+void imu_fusion_align(imu_fusion_t *f, const int16_t accel[3]);
+
+// Run n samples through the filter, in order
+void imu_fusion_update(imu_fusion_t *f, const imu_sample_t *s, uint n);
+
+// Scale the n (at most 4) elements of v to a unit vector in Q30, and return
+// false if they are all zero. The sum of their squares must fit in 64 bits:
+// elements within +/-2^30, or a little beyond, always do.
+bool imu_fusion_normalize(int32_t *v, uint n);
+
+#endif
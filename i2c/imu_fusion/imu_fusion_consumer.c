@@ -0,0 +1,152 @@
+/**
+ * Copyright (c) 2022 Raspberry Pi (Trading) Ltd.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+#include <stdio.h>
+#include <math.h>
+#include "pico/stdlib.h"
+#include "hardware/clocks.h"
+#include "hardware/dma.h"
+#include "hardware/irq.h"
+#include "imu_fusion_consumer.h"
+
+void imu_fusion_run_consumer(const imu_consumer_t *c) {
+    imu_fusion_t fusion;
+    imu_fusion_init(&fusion, c->sample_hz, c->gyro_range_dps, 0.1f);
+    uint32_t const period_us = (uint32_t) (1000000 / c->sample_hz);
+
+    bool calibrated = false;
+    int32_t gyro_sum[3] = {0};
+    uint32_t count = 0;
+    uint64_t fusion_us = 0;
+    uint64_t next_print_us = 0;
+
+    while (true) {
+        imu_burst_t b;
+        queue_remove_blocking(c->full_queue, &b);
+        uint n = imu_fifo_unpack(c->buffers + b.index * c->buffer_size, b.len, b.newest_us, period_us, c->samples);
+        queue_add_blocking(c->free_queue, &b.index);
+        const imu_sample_t *samples = c->samples;
+
+        if (!calibrated) {
+            // Still measuring the gyro's offset
+            for (uint i = 0; i < n; ++i) {
+                for (uint j = 0; j < 3; ++j)
+                    gyro_sum[j] += samples[i].gyro[j];
+            }
+            count += n;
+            if (count >= c->calibration_samples) {
+                for (uint j = 0; j < 3; ++j)
+                    fusion.gyro_bias[j] = (int16_t) (gyro_sum[j] / (int32_t) count);
+                imu_fusion_align(&fusion, samples[n - 1].accel);
+                printf("Gyro offset %d, %d, %d\n", fusion.gyro_bias[0], fusion.gyro_bias[1], fusion.gyro_bias[2]);
+                calibrated = true;
+                count = 0;
+                next_print_us = b.newest_us;
+            }
+            continue;
+        }
+
+        uint64_t start = time_us_64();
+        imu_fusion_update(&fusion, samples, n);
+        uint64_t end = time_us_64();
+        fusion_us += end - start;
+        count += n;
+
+        if (b.newest_us >= next_print_us) {
+            next_print_us += 100000;
+            float q0 = fusion.q[0] / 1073741824.0f, q1 = fusion.q[1] / 1073741824.0f;
+            float q2 = fusion.q[2] / 1073741824.0f, q3 = fusion.q[3] / 1073741824.0f;
+            const float deg = 180.0f / 3.14159265f;
+            float roll = atan2f(q0 * q1 + q2 * q3, 0.5f - q1 * q1 - q2 * q2) * deg;
+            float pitch = asinf(-2.0f * (q1 * q3 - q0 * q2)) * deg;
+            float yaw = atan2f(q1 * q2 + q0 * q3, 0.5f - q2 * q2 - q3 * q3) * deg;
+            printf("Roll %7.2f  Pitch %7.2f  Yaw %7.2f   %u samples in %u bursts, %u FIFO resets, %u cycles/sample, %u us latency\n",
+                   roll, pitch, yaw, count, *c->bursts, *c->fifo_resets,
+                   (uint) (fusion_us * (clock_get_hz(clk_sys) / 1000000) / count), (uint) (end - b.newest_us));
+        }
+    }
+}
+
+// The drain, and the read in progress, for the DMA interrupt
+static const imu_drain_t *drain;
+static imu_burst_t drain_burst;
+static volatile bool drain_reading;
+
+static void __isr imu_fusion_drain_dma_irq(void) {
+    uint rx = drain->bus->dma_rx;
+    if (!(dma_hw->ints1 & (1u << rx)))
+        return;
+    dma_hw->ints1 = 1u << rx;
+    drain->bus->end_read(drain->bus->ctx);
+    // There is always room, as each burst's buffer came off the free queue
+    queue_try_add(drain->full_queue, &drain_burst);
+    ++*drain->bursts;
+    drain_reading = false;
+}
+
+void imu_fusion_run_drain(const imu_drain_t *d) {
+    const imu_fifo_bus_t *bus = d->bus;
+    drain = d;
+    dma_channel_set_irq1_enabled(bus->dma_rx, true);
+    irq_add_shared_handler(DMA_IRQ_1, imu_fusion_drain_dma_irq, PICO_SHARED_IRQ_HANDLER_DEFAULT_ORDER_PRIORITY);
+    irq_set_enabled(DMA_IRQ_1, true);
+
+    uint late = 0;
+    absolute_time_t next = get_absolute_time();
+    while (true) {
+        next = delayed_by_ms(next, d->interval_ms);
+        sleep_until(next);
+
+        if (drain_reading) {
+            // A nearly full FIFO can take longer than interval_ms to read
+            // over I2C, but never twice as long
+            if (++late < 2)
+                continue;
+            late = 0;
+            // An abort can raise a spurious completion interrupt (RP2040-E13),
+            // so mask it whilst cancelling
+            dma_channel_set_irq1_enabled(bus->dma_rx, false);
+            if (drain_reading) {
+                bus->cancel_read(bus->ctx);
+                dma_hw->ints1 = 1u << bus->dma_rx;
+                queue_add_blocking(d->free_queue, &drain_burst.index);
+                drain_reading = false;
+                // Whatever was being read is lost, so the timestamps of what
+                // is left would be wrong
+                bus->reset(bus->ctx);
+                ++*d->fifo_resets;
+            }
+            dma_channel_set_irq1_enabled(bus->dma_rx, true);
+            continue;
+        }
+        late = 0;
+
+        uint len = bus->count(bus->ctx);
+        uint64_t now = time_us_64();
+
+        // The FIFO should only ever hold whole frames. If it is nearly full,
+        // samples may have been lost, so the timestamps would be wrong.
+        if (len % IMU_FIFO_FRAME_LEN || len > d->buffer_size - IMU_FIFO_FRAME_LEN) {
+            bus->reset(bus->ctx);
+            ++*d->fifo_resets;
+            continue;
+        }
+        if (!len)
+            continue;
+
+        // If core 1 has fallen behind, leave the samples in the FIFO until it
+        // catches up
+        uint8_t index;
+        if (!queue_try_remove(d->free_queue, &index))
+            continue;
+
+        // The newest sample is the one taken last, at most a sample period
+        // before the count was read
+        drain_burst = (imu_burst_t) {index, (uint16_t) len, now};
+        drain_reading = true;
+        bus->start_read(bus->ctx, d->buffers + index * d->buffer_size, len);
+    }
+}
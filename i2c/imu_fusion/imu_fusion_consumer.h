@@ -0,0 +1,86 @@
+/**
+ * Copyright (c) 2022 Raspberry Pi (Trading) Ltd.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+#ifndef _IMU_FUSION_CONSUMER_H
+#define _IMU_FUSION_CONSUMER_H
+
+#include "pico/util/queue.h"
+#include "imu_fusion.h"
+
+// ----------------------------------------------------------------------------
+// Both sides of mpu6050_i2c_fifo and mpu9250_spi_fifo. On core 0,
+// imu_fusion_run_drain() empties the sensor's FIFO into a set of buffers by
+// DMA, and passes them over a queue; on core 1, imu_fusion_run_consumer()
+// unpacks them, measures the gyro's offset from the first
+// calibration_samples samples (so the sensor must be kept still for that
+// long), then runs the rest through the filter, and prints the orientation
+// ten times a second.
+
+// A burst read from the FIFO into buffer `index`, whose last frame was taken
+// at newest_us
+typedef struct {
+    uint8_t index;
+    uint16_t len;
+    uint64_t newest_us;
+} imu_burst_t;
+
+typedef struct {
+    // Bursts to unpack (imu_burst_t), and buffers free to read into (uint8_t
+    // indices); each buffer goes back onto free_queue once it is unpacked
+    queue_t *full_queue;
+    queue_t *free_queue;
+    // Buffer i is buffer_size bytes at buffers + i * buffer_size
+    uint8_t *buffers;
+    uint buffer_size;
+    // Room for the frames in one buffer: buffer_size / IMU_FIFO_FRAME_LEN
+    imu_sample_t *samples;
+    float sample_hz;
+    float gyro_range_dps;
+    uint calibration_samples;
+    // Counted by core 0, and printed
+    const volatile uint32_t *bursts;
+    const volatile uint32_t *fifo_resets;
+} imu_consumer_t;
+
+// Never returns
+void imu_fusion_run_consumer(const imu_consumer_t *c);
+
+// How to get at the sensor's FIFO over its bus
+typedef struct {
+    // Read the number of bytes waiting in the FIFO
+    uint (*count)(void *ctx);
+    // Empty the FIFO, and start filling it again
+    void (*reset)(void *ctx);
+    // Start reading len bytes from the FIFO into dst, without waiting; the
+    // read is over once DMA channel dma_rx has finished
+    void (*start_read)(void *ctx, uint8_t *dst, uint len);
+    // Tidy up after the read, from the DMA interrupt: e.g. deselect the chip
+    void (*end_read)(void *ctx);
+    // Stop a read which still hasn't finished two intervals later, e.g.
+    // because the device has stopped answering
+    void (*cancel_read)(void *ctx);
+    void *ctx;
+    uint dma_rx;
+} imu_fifo_bus_t;
+
+typedef struct {
+    const imu_fifo_bus_t *bus;
+    // As for imu_consumer_t; each buffer is the size of the sensor's FIFO
+    queue_t *full_queue;
+    queue_t *free_queue;
+    uint8_t *buffers;
+    uint buffer_size;
+    uint interval_ms;
+    volatile uint32_t *bursts;
+    volatile uint32_t *fifo_resets;
+} imu_drain_t;
+
+// Empty the FIFO every interval_ms, by DMA, and pass each burst on to the
+// consumer from the DMA_IRQ_1 interrupt when it is done. The core is asleep
+// in between, or free for anything else the application adds. Only one drain
+// can be run. Never returns.
+void imu_fusion_run_drain(const imu_drain_t *d);
+
+#endif
@@ -0,0 +1,420 @@
+/**
+ * Copyright (c) 2022 Raspberry Pi (Trading) Ltd.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+#include <stdio.h>
+#include <string.h>
+#include "pico/stdlib.h"
+#include "imu_fusion.h"
+#include "test_rand.h"
+#if PICO_ON_DEVICE
+#include "hardware/clocks.h"
+#endif
+
+// Checks the fixed-point filter against the floating point one from
+// Madgwick's report, and against the true orientation of a simulated sensor,
+// then times them both. The device times fewer samples, but also gives
+// cycles per sample, which are what to compare with the sample rate.
+//
+// The samples are a recording of a simulated MPU6050 at 1 kHz (+/-4 g, +/-2000
+// degrees/s, with noise and a gyro offset), packed into FIFO frames: a second
+// at rest, then tumbling about all three axes at up to 150 degrees/s.
+
+#define SAMPLE_HZ 1000
+#define GYRO_RANGE_DPS 2000.0
+#define ACCEL_LSB_PER_G 8192
+#define BETA 0.1f
+#define RECORDING_LEN (20 * SAMPLE_HZ)
+#define REST_LEN SAMPLE_HZ
+
+static const double pi = 3.14159265358979;
+
+// Uniform in [-range, range]
+static int32_t rand_range(int32_t range) {
+    return (int32_t) (next_rand() % (uint32_t) (2 * range + 1)) - range;
+}
+
+static double dsqrt(double x) {
+    if (x <= 0)
+        return 0;
+    double r = x < 1 ? 1 : x;
+    for (uint i = 0; i < 64; ++i) {
+        double next = (r + x / r) / 2;
+        if (next == r)
+            break;
+        r = next;
+    }
+    return r;
+}
+
+static void quat_normalize(double q[4]) {
+    double n = dsqrt(q[0] * q[0] + q[1] * q[1] + q[2] * q[2] + q[3] * q[3]);
+    for (uint i = 0; i < 4; ++i)
+        q[i] /= n;
+}
+
+// Angle between two orientations, in degrees
+static double angle_between(const double a[4], const double b[4]) {
+    double dot = a[0] * b[0] + a[1] * b[1] + a[2] * b[2] + a[3] * b[3];
+    double s = dsqrt(1 - dot * dot);
+    // 2 asin(s), from the first terms of its series, which is plenty for the
+    // few degrees these tests care about
+    return 2 * (s + s * s * s / 6 + 3 * s * s * s * s * s / 40) * 180 / pi;
+}
+
+static void fixed_to_double(const int32_t q[4], double out[4]) {
+    for (uint i = 0; i < 4; ++i)
+        out[i] = q[i] / (double) (1 << 30);
+}
+
+// ----------------------------------------------------------------------------
+// The simulated sensor, and the true orientation at each sample
+
+static uint8_t recording[RECORDING_LEN * IMU_FIFO_FRAME_LEN];
+static double truth[RECORDING_LEN][4];
+static imu_sample_t samples[RECORDING_LEN];
+static const int16_t gyro_offset[3] = {-21, 37, 8};
+
+static void put_be16(uint8_t *b, int32_t v) {
+    v = v < INT16_MIN ? INT16_MIN : v > INT16_MAX ? INT16_MAX : v;
+    b[0] = (uint8_t) ((uint16_t) v >> 8);
+    b[1] = (uint8_t) v;
+}
+
+static int32_t round_to_int(double x) {
+    return (int32_t) (x < 0 ? x - 0.5 : x + 0.5);
+}
+
+static void record(const double start[4]) {
+    double q[4];
+    memcpy(q, start, sizeof(q));
+    double w[3] = {0}, target[3] = {0};
+    const double lsb_per_rad = 32768 / GYRO_RANGE_DPS * 180 / pi;
+    const uint substeps = 8;
+    const double dt = 1.0 / SAMPLE_HZ / substeps;
+
+    for (uint i = 0; i < RECORDING_LEN; ++i) {
+        if (i >= REST_LEN) {
+            // A new angular velocity to head for every half second
+            if (i % (SAMPLE_HZ / 2) == 0) {
+                for (uint j = 0; j < 3; ++j)
+                    target[j] = rand_range(150) * pi / 180;
+            }
+            for (uint j = 0; j < 3; ++j)
+                w[j] += (target[j] - w[j]) / 100;
+        }
+        for (uint k = 0; k < substeps; ++k) {
+            double d[4] = {
+                -q[1] * w[0] - q[2] * w[1] - q[3] * w[2],
+                q[0] * w[0] + q[2] * w[2] - q[3] * w[1],
+                q[0] * w[1] - q[1] * w[2] + q[3] * w[0],
+                q[0] * w[2] + q[1] * w[1] - q[2] * w[0],
+            };
+            for (uint j = 0; j < 4; ++j)
+                q[j] += d[j] * dt / 2;
+            quat_normalize(q);
+        }
+        memcpy(truth[i], q, sizeof(q));
+
+        // Gravity, as the sensor sees it
+        double g[3] = {
+            2 * (q[1] * q[3] - q[0] * q[2]),
+            2 * (q[0] * q[1] + q[2] * q[3]),
+            q[0] * q[0] - q[1] * q[1] - q[2] * q[2] + q[3] * q[3],
+        };
+        uint8_t *frame = recording + i * IMU_FIFO_FRAME_LEN;
+        for (uint j = 0; j < 3; ++j) {
+            put_be16(frame + j * 2, round_to_int(g[j] * ACCEL_LSB_PER_G) + rand_range(40));
+            put_be16(frame + 8 + j * 2, round_to_int(w[j] * lsb_per_rad) + gyro_offset[j] + rand_range(3));
+        }
+        put_be16(frame + 6, 1500 + rand_range(2));
+    }
+}
+
+// ----------------------------------------------------------------------------
+// The floating point filter, as in the report's MadgwickAHRSupdateIMU()
+
+typedef struct {
+    float q0, q1, q2, q3;
+    float beta;
+    float sample_hz;
+    float rad_per_lsb;
+    float gyro_bias[3];
+} ref_filter_t;
+
+static float ref_inv_sqrt(float x) {
+    float halfx = 0.5f * x;
+    float y = x;
+    int32_t i;
+    memcpy(&i, &y, sizeof(i));
+    i = 0x5f3759df - (i >> 1);
+    memcpy(&y, &i, sizeof(y));
+    y = y * (1.5f - (halfx * y * y));
+    y = y * (1.5f - (halfx * y * y));
+    return y;
+}
+
+static __noinline void ref_update(ref_filter_t *r, const imu_sample_t *s, uint n) {
+    for (uint i = 0; i < n; ++i, ++s) {
+        float q0 = r->q0, q1 = r->q1, q2 = r->q2, q3 = r->q3;
+        float gx = (s->gyro[0] - r->gyro_bias[0]) * r->rad_per_lsb;
+        float gy = (s->gyro[1] - r->gyro_bias[1]) * r->rad_per_lsb;
+        float gz = (s->gyro[2] - r->gyro_bias[2]) * r->rad_per_lsb;
+        float ax = s->accel[0], ay = s->accel[1], az = s->accel[2];
+
+        float qDot1 = 0.5f * (-q1 * gx - q2 * gy - q3 * gz);
+        float qDot2 = 0.5f * (q0 * gx + q2 * gz - q3 * gy);
+        float qDot3 = 0.5f * (q0 * gy - q1 * gz + q3 * gx);
+        float qDot4 = 0.5f * (q0 * gz + q1 * gy - q2 * gx);
+
+        if (!((ax == 0.0f) && (ay == 0.0f) && (az == 0.0f))) {
+            float recipNorm = ref_inv_sqrt(ax * ax + ay * ay + az * az);
+            ax *= recipNorm;
+            ay *= recipNorm;
+            az *= recipNorm;
+
+            float _2q0 = 2.0f * q0, _2q1 = 2.0f * q1, _2q2 = 2.0f * q2, _2q3 = 2.0f * q3;
+            float _4q0 = 4.0f * q0, _4q1 = 4.0f * q1, _4q2 = 4.0f * q2;
+            float _8q1 = 8.0f * q1, _8q2 = 8.0f * q2;
+            float q0q0 = q0 * q0, q1q1 = q1 * q1, q2q2 = q2 * q2, q3q3 = q3 * q3;
+
+            float s0 = _4q0 * q2q2 + _2q2 * ax + _4q0 * q1q1 - _2q1 * ay;
+            float s1 = _4q1 * q3q3 - _2q3 * ax + 4.0f * q0q0 * q1 - _2q0 * ay - _4q1 + _8q1 * q1q1 + _8q1 * q2q2 + _4q1 * az;
+            float s2 = 4.0f * q0q0 * q2 + _2q0 * ax + _4q2 * q3q3 - _2q3 * ay - _4q2 + _8q2 * q1q1 + _8q2 * q2q2 + _4q2 * az;
+            float s3 = 4.0f * q1q1 * q3 - _2q1 * ax + 4.0f * q2q2 * q3 - _2q2 * ay;
+            recipNorm = ref_inv_sqrt(s0 * s0 + s1 * s1 + s2 * s2 + s3 * s3);
+            s0 *= recipNorm;
+            s1 *= recipNorm;
+            s2 *= recipNorm;
+            s3 *= recipNorm;
+
+            qDot1 -= r->beta * s0;
+            qDot2 -= r->beta * s1;
+            qDot3 -= r->beta * s2;
+            qDot4 -= r->beta * s3;
+        }
+
+        q0 += qDot1 * (1.0f / r->sample_hz);
+        q1 += qDot2 * (1.0f / r->sample_hz);
+        q2 += qDot3 * (1.0f / r->sample_hz);
+        q3 += qDot4 * (1.0f / r->sample_hz);
+
+        float recipNorm = ref_inv_sqrt(q0 * q0 + q1 * q1 + q2 * q2 + q3 * q3);
+        r->q0 = q0 * recipNorm;
+        r->q1 = q1 * recipNorm;
+        r->q2 = q2 * recipNorm;
+        r->q3 = q3 * recipNorm;
+    }
+}
+
+static void ref_init(ref_filter_t *r, const imu_fusion_t *f) {
+    r->q0 = 1.0f;
+    r->q1 = r->q2 = r->q3 = 0.0f;
+    r->beta = BETA;
+    r->sample_hz = SAMPLE_HZ;
+    r->rad_per_lsb = (float) (GYRO_RANGE_DPS / 32768 * pi / 180);
+    for (uint i = 0; i < 3; ++i)
+        r->gyro_bias[i] = f->gyro_bias[i];
+}
+
+// ----------------------------------------------------------------------------
+
+static uint failures;
+
+static void result(const char *name, bool ok) {
+    printf("%-40s %s\n", name, ok ? "ok" : "FAILED");
+    if (!ok)
+        ++failures;
+}
+
+// As the examples do: average the gyro while the sensor is at rest
+static void calibrate(imu_fusion_t *f) {
+    for (uint j = 0; j < 3; ++j) {
+        int32_t sum = 0;
+        for (uint i = 0; i < REST_LEN; ++i)
+            sum += samples[i].gyro[j];
+        f->gyro_bias[j] = (int16_t) ((sum + (sum < 0 ? -REST_LEN / 2 : REST_LEN / 2)) / REST_LEN);
+    }
+}
+
+static void test_unpack(void) {
+    const uint8_t fifo[] = {
+        0x01, 0x02, 0xff, 0xfe, 0x20, 0x00, 0x0b, 0xb8, 0x80, 0x00, 0x7f, 0xff, 0x00, 0x10,
+        0xfe, 0x0c, 0x00, 0x00, 0xe0, 0x00, 0xf4, 0x48, 0x00, 0x01, 0xff, 0xff, 0x12, 0x34,
+        // Half a frame, still in flight
+        0x55, 0x55, 0x55,
+    };
+    imu_sample_t s[3];
+    uint n = imu_fifo_unpack(fifo, sizeof(fifo), 5000, 1000, s);
+    bool ok = n == 2;
+    ok &= s[0].accel[0] == 0x0102 && s[0].accel[1] == -2 && s[0].accel[2] == 8192 && s[0].temp == 3000;
+    ok &= s[0].gyro[0] == INT16_MIN && s[0].gyro[1] == INT16_MAX && s[0].gyro[2] == 16;
+    ok &= s[1].accel[0] == -500 && s[1].accel[1] == 0 && s[1].accel[2] == -8192 && s[1].temp == -3000;
+    ok &= s[1].gyro[0] == 1 && s[1].gyro[1] == -1 && s[1].gyro[2] == 0x1234;
+    ok &= s[0].timestamp_us == 4000 && s[1].timestamp_us == 5000;
+    result("fifo unpack", ok);
+}
+
+static void test_normalize(void) {
+    double worst = 0;
+    bool ok = true;
+    for (uint i = 0; i < 100000; ++i) {
+        uint n = 3 + (i & 1);
+        int32_t v[4];
+        uint bits = 1 + next_rand() % 30;
+        for (uint j = 0; j < n; ++j)
+            v[j] = rand_range((1 << bits) - 1) + (int32_t) (j ? 0 : 1);
+        double len = 0;
+        for (uint j = 0; j < n; ++j)
+            len += (double) v[j] * v[j];
+        len = dsqrt(len);
+        int32_t u[4];
+        memcpy(u, v, sizeof(u));
+        if (!len) {
+            ok &= !imu_fusion_normalize(u, n);
+            continue;
+        }
+        ok &= imu_fusion_normalize(u, n);
+        for (uint j = 0; j < n; ++j) {
+            double err = u[j] / (double) (1 << 30) - v[j] / len;
+            err = err < 0 ? -err : err;
+            worst = err > worst ? err : worst;
+        }
+    }
+    int32_t zero[4] = {0};
+    ok &= !imu_fusion_normalize(zero, 4);
+    printf("  worst error %.2g\n", worst);
+    result("normalize", ok && worst < 1e-7);
+}
+
+static void test_against_reference(void) {
+    imu_fusion_t f;
+    imu_fusion_init(&f, SAMPLE_HZ, GYRO_RANGE_DPS, BETA);
+    calibrate(&f);
+    ref_filter_t r;
+    ref_init(&r, &f);
+
+    double worst = 0;
+    for (uint i = 0; i < RECORDING_LEN; ++i) {
+        imu_fusion_update(&f, samples + i, 1);
+        ref_update(&r, samples + i, 1);
+        double a[4], b[4] = {r.q0, r.q1, r.q2, r.q3};
+        fixed_to_double(f.q, a);
+        double err = angle_between(a, b);
+        worst = err > worst ? err : worst;
+    }
+    printf("  worst difference %.4f degrees\n", worst);
+    // Most of the difference is the reference's: single precision can't hold
+    // the gyro's smallest steps next to a q0 of nearly 1, while Q30 has seven
+    // more bits to do it with, and that leaves it a third of a degree out
+    result("same as floating point", worst < 0.5);
+}
+
+static void test_tracking(void) {
+    imu_fusion_t f;
+    imu_fusion_init(&f, SAMPLE_HZ, GYRO_RANGE_DPS, BETA);
+    calibrate(&f);
+
+    // A batch at a time, as the examples do
+    double worst = 0, sum = 0;
+    for (uint i = 0; i < RECORDING_LEN; i += 10) {
+        imu_fusion_update(&f, samples + i, 10);
+        double q[4];
+        fixed_to_double(f.q, q);
+        double err = angle_between(q, truth[i + 9]);
+        worst = err > worst ? err : worst;
+        sum += err;
+    }
+    printf("  error %.2f degrees on average, %.2f at worst\n", sum / (RECORDING_LEN / 10), worst);
+    result("tracks the true orientation", worst < 2.0);
+
+    // Without taking out the gyro's offset, the filter still holds it
+    // to a few degrees
+    imu_fusion_init(&f, SAMPLE_HZ, GYRO_RANGE_DPS, BETA);
+    imu_fusion_update(&f, samples, RECORDING_LEN);
+    double q[4];
+    fixed_to_double(f.q, q);
+    printf("  uncalibrated gyro: %.2f degrees at the end\n", angle_between(q, truth[RECORDING_LEN - 1]));
+}
+
+static void test_align(void) {
+    // The same motion starting from upside down and a third of a turn about x
+    static const double starts[][4] = {
+        {0.5, 0.8660254, 0, 0},
+        {0, 1, 0, 0},
+        {0.8, 0, -0.6, 0},
+    };
+    bool ok = true;
+    for (uint k = 0; k < count_of(starts); ++k) {
+        seed_rand(2 + k);
+        record(starts[k]);
+        imu_fifo_unpack(recording, sizeof(recording), 0, 1000, samples);
+
+        imu_fusion_t f;
+        imu_fusion_init(&f, SAMPLE_HZ, GYRO_RANGE_DPS, BETA);
+        calibrate(&f);
+        imu_fusion_align(&f, samples[0].accel);
+        double q[4];
+        fixed_to_double(f.q, q);
+        double at_start = angle_between(q, starts[k]);
+        imu_fusion_update(&f, samples, RECORDING_LEN);
+        fixed_to_double(f.q, q);
+        double at_end = angle_between(q, truth[RECORDING_LEN - 1]);
+        printf("  start %u: %.2f degrees out aligned, %.2f at the end\n", k, at_start, at_end);
+        ok &= at_start < 1.0 && at_end < 2.0;
+    }
+    result("align to gravity", ok);
+}
+
+static void benchmark(void) {
+    imu_fusion_t f;
+    imu_fusion_init(&f, SAMPLE_HZ, GYRO_RANGE_DPS, BETA);
+    calibrate(&f);
+    ref_filter_t r;
+    ref_init(&r, &f);
+    const uint n = PICO_ON_DEVICE ? 2000 : RECORDING_LEN;
+    const uint rounds = PICO_ON_DEVICE ? 1 : 20;
+
+    uint64_t t0 = time_us_64();
+    for (uint i = 0; i < rounds; ++i)
+        imu_fusion_update(&f, samples, n);
+    uint64_t t1 = time_us_64();
+    for (uint i = 0; i < rounds; ++i)
+        ref_update(&r, samples, n);
+    uint64_t t2 = time_us_64();
+
+    double count = (double) n * rounds;
+    printf("fixed point     %8.3f us/sample", (double) (t1 - t0) / count);
+#if PICO_ON_DEVICE
+    printf(", %6.0f cycles/sample", (double) (t1 - t0) * clock_get_hz(clk_sys) / 1e6 / count);
+#endif
+    printf("\nfloating point  %8.3f us/sample", (double) (t2 - t1) / count);
+#if PICO_ON_DEVICE
+    printf(", %6.0f cycles/sample", (double) (t2 - t1) * clock_get_hz(clk_sys) / 1e6 / count);
+#endif
+    printf("\n");
+    // Keep the results alive
+    if (!f.q[0] && r.q0 == 2.0f)
+        ++failures;
+}
+
+int main() {
+    stdio_init_all();
+    printf("IMU fusion test\n");
+
+    static const double level[4] = {1, 0, 0, 0};
+    record(level);
+    imu_fifo_unpack(recording, sizeof(recording), 0, 1000, samples);
+
+    test_unpack();
+    test_normalize();
+    test_against_reference();
+    test_tracking();
+    benchmark();
+    test_align();
+
+    printf(failures ? "FAILED\n" : "All good\n");
+    return failures ? 1 : 0;
+}
@@ -14,7 +14,7 @@
 
    This is taking to simple approach of simply reading registers. It's perfectly
    possible to link up an interrupt line and set things up to read from the
-   inbuilt FIFO to make it more useful.
+   inbuilt FIFO to make it more useful, as mpu6050_i2c_fifo.c does.
 
    NOTE: Ensure the device is capable of being driven at 3.3v NOT 5v. The Pico
    GPIO (and therefor I2C) cannot be used at 5v.
@@ -0,0 +1,246 @@
+/**
+ * Copyright (c) 2022 Raspberry Pi (Trading) Ltd.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+#include <stdio.h>
+#include "pico/stdlib.h"
+#include "pico/binary_info.h"
+#include "pico/multicore.h"
+#include "pico/util/queue.h"
+#include "hardware/i2c.h"
+#include "hardware/dma.h"
+#include "imu_fusion_consumer.h"
+
+/* Example code to read a MPU6050 MEMS accelerometer and gyroscope at its full
+   1 kHz sample rate, and work out which way up it is.
+
+   Rather than reading the data registers one sample at a time, as mpu6050_i2c
+   does, the MPU6050 is set to push every sample into its 1 KB FIFO, and
+   core 0 empties that every 20 ms, about 20 samples at a time, in a single
+   400 kHz I2C read. One DMA channel feeds the I2C block the read commands,
+   and another takes the data out, so core 0 is free for the 6 ms or so that
+   the read takes. Core 1 unpacks the samples, stamps them with the time
+   they were taken, and runs them through a fixed-point Madgwick filter (see
+   i2c/imu_fusion) to give an orientation, which it prints ten times a second.
+
+   Keep the sensor still for the first second, while the gyro's offset is
+   measured.
+
+   Connections are the same as for mpu6050_i2c:
+
+   GPIO PICO_DEFAULT_I2C_SDA_PIN (On Pico this is GP4 (pin 6)) -> SDA on MPU6050 board
+   GPIO PICO_DEFAULT_I2C_SCL_PIN (On Pico this is GP5 (pin 7)) -> SCL on MPU6050 board
+   3.3v (pin 36) -> VCC on MPU6050 board
+   GND (pin 38)  -> GND on MPU6050 board
+*/
+
+// By default these devices  are on bus address 0x68
+static int addr = 0x68;
+
+#define REG_SMPLRT_DIV    0x19
+#define REG_CONFIG        0x1a
+#define REG_GYRO_CONFIG   0x1b
+#define REG_ACCEL_CONFIG  0x1c
+#define REG_FIFO_EN       0x23
+#define REG_USER_CTRL     0x6a
+#define REG_PWR_MGMT_1    0x6b
+#define REG_FIFO_COUNTH   0x72
+#define REG_FIFO_R_W      0x74
+
+#define USER_CTRL_FIFO_EN     0x40
+#define USER_CTRL_FIFO_RST    0x04
+
+#define FIFO_SIZE 1024
+#define SAMPLE_HZ 1000
+#define GYRO_RANGE_DPS 2000
+#define DRAIN_INTERVAL_MS 20
+#define CALIBRATION_SAMPLES SAMPLE_HZ
+
+// Bursts read by core 0, waiting for core 1
+#define NUM_BUFFERS 4
+static uint8_t buffers[NUM_BUFFERS][FIFO_SIZE];
+
+static queue_t full_queue;
+static queue_t free_queue;
+
+// Counted by core 0 and printed by core 1
+static volatile uint32_t fifo_resets;
+static volatile uint32_t bursts;
+
+static uint dma_tx;
+static uint dma_rx;
+// The register number, then a read command for every byte of the FIFO
+static uint32_t fifo_cmds[FIFO_SIZE + 1];
+
+#ifdef i2c_default
+static void write_register(uint8_t reg, uint8_t data) {
+    uint8_t buf[] = {reg, data};
+    i2c_write_blocking(i2c_default, addr, buf, 2, false);
+}
+
+static void read_registers(uint8_t reg, uint8_t *buf, uint len) {
+    // The register is auto incrementing
+    i2c_write_blocking(i2c_default, addr, &reg, 1, true); // true to keep master control of bus
+    i2c_read_blocking(i2c_default, addr, buf, len, false);
+}
+
+static void fifo_reset() {
+    write_register(REG_USER_CTRL, USER_CTRL_FIFO_RST);
+    write_register(REG_USER_CTRL, USER_CTRL_FIFO_EN);
+}
+
+static void dma_init() {
+    i2c_hw_t *hw = i2c_get_hw(i2c_default);
+    // Ask for more commands before the TX FIFO runs dry, and for every byte
+    // that arrives in the RX FIFO
+    hw->dma_tdlr = 4;
+    hw->dma_rdlr = 0;
+    hw->dma_cr = I2C_IC_DMA_CR_TDMAE_BITS | I2C_IC_DMA_CR_RDMAE_BITS;
+
+    dma_tx = dma_claim_unused_channel(true);
+    dma_rx = dma_claim_unused_channel(true);
+
+    dma_channel_config c = dma_channel_get_default_config(dma_tx);
+    channel_config_set_transfer_data_size(&c, DMA_SIZE_32);
+    channel_config_set_dreq(&c, i2c_get_dreq(i2c_default, true));
+    dma_channel_configure(dma_tx, &c, &hw->data_cmd, fifo_cmds, 0, false);
+
+    c = dma_channel_get_default_config(dma_rx);
+    channel_config_set_transfer_data_size(&c, DMA_SIZE_8);
+    channel_config_set_dreq(&c, i2c_get_dreq(i2c_default, false));
+    channel_config_set_read_increment(&c, false);
+    channel_config_set_write_increment(&c, true);
+    dma_channel_configure(dma_rx, &c, NULL, &hw->data_cmd, 0, false);
+}
+
+// The FIFO, as seen by imu_fusion_run_drain()
+
+static uint fifo_count(void *ctx) {
+    uint8_t buf[2];
+    read_registers(REG_FIFO_COUNTH, buf, 2);
+    return buf[0] << 8 | buf[1];
+}
+
+static void fifo_reset_cb(void *ctx) {
+    fifo_reset();
+}
+
+static void fifo_start_read(void *ctx, uint8_t *dst, uint len) {
+    i2c_hw_t *hw = i2c_get_hw(i2c_default);
+    hw->enable = 0;
+    hw->tar = addr;
+    hw->enable = 1;
+
+    // The first read command has a repeated start, and the last a stop
+    fifo_cmds[0] = REG_FIFO_R_W;
+    for (uint i = 0; i < len; ++i) {
+        fifo_cmds[i + 1] = I2C_IC_DATA_CMD_CMD_BITS |
+                           (i == 0 ? I2C_IC_DATA_CMD_RESTART_BITS : 0) |
+                           (i == len - 1 ? I2C_IC_DATA_CMD_STOP_BITS : 0);
+    }
+    dma_channel_transfer_to_buffer_now(dma_rx, dst, len);
+    dma_channel_transfer_from_buffer_now(dma_tx, fifo_cmds, len + 1);
+}
+
+static void fifo_end_read(void *ctx) {
+    // The stop was sent with the last read command
+}
+
+static void fifo_cancel_read(void *ctx) {
+    i2c_hw_t *hw = i2c_get_hw(i2c_default);
+    dma_channel_abort(dma_tx);
+    dma_channel_abort(dma_rx);
+    // If the device NAK'd, the TX FIFO has been flushed, and is held until the
+    // abort is cleared
+    (void) hw->clr_tx_abrt;
+    while (hw->rxflr)
+        (void) hw->data_cmd;
+}
+
+static void mpu6050_init_fifo() {
+    // Reset everything, and wait for it to come back
+    write_register(REG_PWR_MGMT_1, 0x80);
+    sleep_ms(100);
+    // Clock from the gyro's PLL
+    write_register(REG_PWR_MGMT_1, 0x01);
+    // 1 kHz samples, with the low pass filter at 184 Hz
+    write_register(REG_CONFIG, 0x01);
+    write_register(REG_SMPLRT_DIV, 0);
+    // +/-2000 degrees/s and +/-4 g
+    write_register(REG_GYRO_CONFIG, 0x18);
+    write_register(REG_ACCEL_CONFIG, 0x08);
+    // Everything into the FIFO, in 14 byte frames
+    write_register(REG_FIFO_EN, IMU_FIFO_EN_ACCEL_TEMP_GYRO);
+    fifo_reset();
+}
+
+// Core 1 turns bursts into samples, and samples into an orientation
+static void core1_entry() {
+    static imu_sample_t samples[FIFO_SIZE / IMU_FIFO_FRAME_LEN];
+    const imu_consumer_t consumer = {
+        .full_queue = &full_queue,
+        .free_queue = &free_queue,
+        .buffers = &buffers[0][0],
+        .buffer_size = FIFO_SIZE,
+        .samples = samples,
+        .sample_hz = SAMPLE_HZ,
+        .gyro_range_dps = GYRO_RANGE_DPS,
+        .calibration_samples = CALIBRATION_SAMPLES,
+        .bursts = &bursts,
+        .fifo_resets = &fifo_resets,
+    };
+    imu_fusion_run_consumer(&consumer);
+}
+
+#endif
+
+int main() {
+    stdio_init_all();
+#if !defined(i2c_default) || !defined(PICO_DEFAULT_I2C_SDA_PIN) || !defined(PICO_DEFAULT_I2C_SCL_PIN)
+    #warning i2c/mpu6050_i2c_fifo example requires a board with I2C pins
+    puts("Default I2C pins were not defined");
+#else
+    printf("Hello, MPU6050! Reading the FIFO...\n");
+
+    // This example will use I2C0 on the default SDA and SCL pins (4, 5 on a Pico)
+    i2c_init(i2c_default, 400 * 1000);
+    gpio_set_function(PICO_DEFAULT_I2C_SDA_PIN, GPIO_FUNC_I2C);
+    gpio_set_function(PICO_DEFAULT_I2C_SCL_PIN, GPIO_FUNC_I2C);
+    gpio_pull_up(PICO_DEFAULT_I2C_SDA_PIN);
+    gpio_pull_up(PICO_DEFAULT_I2C_SCL_PIN);
+    // Make the I2C pins available to picotool
+    bi_decl(bi_2pins_with_func(PICO_DEFAULT_I2C_SDA_PIN, PICO_DEFAULT_I2C_SCL_PIN, GPIO_FUNC_I2C));
+
+    queue_init(&full_queue, sizeof(imu_burst_t), NUM_BUFFERS);
+    queue_init(&free_queue, sizeof(uint8_t), NUM_BUFFERS);
+    for (uint8_t i = 0; i < NUM_BUFFERS; ++i)
+        queue_add_blocking(&free_queue, &i);
+    multicore_launch_core1(core1_entry);
+
+    mpu6050_init_fifo();
+    dma_init();
+
+    const imu_fifo_bus_t bus = {
+        .count = fifo_count,
+        .reset = fifo_reset_cb,
+        .start_read = fifo_start_read,
+        .end_read = fifo_end_read,
+        .cancel_read = fifo_cancel_read,
+        .dma_rx = dma_rx,
+    };
+    const imu_drain_t drain = {
+        .bus = &bus,
+        .full_queue = &full_queue,
+        .free_queue = &free_queue,
+        .buffers = &buffers[0][0],
+        .buffer_size = FIFO_SIZE,
+        .interval_ms = DRAIN_INTERVAL_MS,
+        .bursts = &bursts,
+        .fifo_resets = &fifo_resets,
+    };
+    imu_fusion_run_drain(&drain);
+#endif
+    return 0;
+}
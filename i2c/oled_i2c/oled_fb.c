@@ -0,0 +1,200 @@
+/**
+ * Copyright (c) 2022 Raspberry Pi (Trading) Ltd.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+#include <string.h>
+#include "oled_fb.h"
+
+// Bytes a rectangle costs beyond its pixels: the command write with its
+// address byte, and the data write's address and control bytes
+#define RECT_OVERHEAD (1 + OLED_FB_RECT_CMD_LEN + 2)
+
+static void mark_clean(oled_fb_t *fb) {
+    memset(fb->dirty_min, 0xff, sizeof(fb->dirty_min));
+    memset(fb->dirty_max, 0, sizeof(fb->dirty_max));
+}
+
+void oled_fb_init(oled_fb_t *fb, uint width, uint height) {
+    hard_assert(width <= OLED_FB_MAX_WIDTH && height <= OLED_FB_MAX_PAGES * OLED_FB_PAGE_HEIGHT);
+    fb->width = width;
+    fb->pages = (height + OLED_FB_PAGE_HEIGHT - 1) / OLED_FB_PAGE_HEIGHT;
+    memset(fb->buf, 0, sizeof(fb->buf));
+    mark_clean(fb);
+    oled_fb_invalidate(fb);
+}
+
+void oled_fb_invalidate(oled_fb_t *fb) {
+    // Any pattern will do, as long as the whole display is marked dirty and
+    // the trimming can't find a column which matches
+    for (uint i = 0; i < fb->pages * fb->width; ++i)
+        fb->shown[i] = (uint8_t) ~fb->buf[i];
+    oled_fb_mark_dirty(fb, 0, fb->width - 1, 0, fb->pages - 1);
+}
+
+void oled_fb_mark_dirty(oled_fb_t *fb, uint x0, uint x1, uint page0, uint page1) {
+    for (uint page = page0; page <= page1 && page < fb->pages; ++page) {
+        if (x0 < fb->dirty_min[page])
+            fb->dirty_min[page] = (uint8_t) x0;
+        if (x1 > fb->dirty_max[page])
+            fb->dirty_max[page] = (uint8_t) MIN(x1, fb->width - 1);
+    }
+}
+
+void oled_fb_fill(oled_fb_t *fb, uint8_t value) {
+    memset(fb->buf, value, fb->pages * fb->width);
+    oled_fb_mark_dirty(fb, 0, fb->width - 1, 0, fb->pages - 1);
+}
+
+void oled_fb_set_pixel(oled_fb_t *fb, uint x, uint y, bool on) {
+    uint page = y / OLED_FB_PAGE_HEIGHT;
+    if (x >= fb->width || page >= fb->pages)
+        return;
+    uint8_t bit = (uint8_t) (1u << (y % OLED_FB_PAGE_HEIGHT));
+    uint8_t *b = &fb->buf[page * fb->width + x];
+    *b = on ? *b | bit : *b & ~bit;
+    oled_fb_mark_dirty(fb, x, x, page, page);
+}
+
+void oled_fb_fill_rect(oled_fb_t *fb, uint x, uint y, uint w, uint h, bool on) {
+    uint height = fb->pages * OLED_FB_PAGE_HEIGHT;
+    if (x >= fb->width || y >= height || !w || !h)
+        return;
+    w = MIN(w, fb->width - x);
+    h = MIN(h, height - y);
+    uint page0 = y / OLED_FB_PAGE_HEIGHT;
+    uint page1 = (y + h - 1) / OLED_FB_PAGE_HEIGHT;
+    for (uint page = page0; page <= page1; ++page) {
+        // The rows of this page inside the rectangle
+        uint top = MAX(y, page * OLED_FB_PAGE_HEIGHT) - page * OLED_FB_PAGE_HEIGHT;
+        uint bottom = MIN(y + h, (page + 1) * OLED_FB_PAGE_HEIGHT) - page * OLED_FB_PAGE_HEIGHT;
+        uint8_t mask = (uint8_t) ((0xffu << top) & (0xffu >> (OLED_FB_PAGE_HEIGHT - bottom)));
+        uint8_t *b = &fb->buf[page * fb->width + x];
+        for (uint i = 0; i < w; ++i)
+            b[i] = on ? b[i] | mask : b[i] & ~mask;
+    }
+    oled_fb_mark_dirty(fb, x, x + w - 1, page0, page1);
+}
+
+void oled_fb_blit(oled_fb_t *fb, const uint8_t *img, uint x, uint page, uint w, uint pages) {
+    if (x >= fb->width || page >= fb->pages || !w || !pages)
+        return;
+    uint cols = MIN(w, fb->width - x);
+    pages = MIN(pages, fb->pages - page);
+    for (uint i = 0; i < pages; ++i)
+        memcpy(&fb->buf[(page + i) * fb->width + x], img + i * w, cols);
+    oled_fb_mark_dirty(fb, x, x + cols - 1, page, page + pages - 1);
+}
+
+// The dirty columns on a page which really have changed, if any
+static bool changed_cols(const oled_fb_t *fb, uint page, int *lo, int *hi) {
+    const uint8_t *buf = fb->buf + page * fb->width;
+    const uint8_t *shown = fb->shown + page * fb->width;
+    int l = fb->dirty_min[page];
+    int h = fb->dirty_max[page];
+    while (l <= h && buf[l] == shown[l])
+        ++l;
+    while (h >= l && buf[h] == shown[h])
+        --h;
+    *lo = l;
+    *hi = h;
+    return l <= h;
+}
+
+uint oled_fb_plan(const oled_fb_t *fb, oled_fb_rect_t *rects) {
+    int lo[OLED_FB_MAX_PAGES], hi[OLED_FB_MAX_PAGES];
+    bool dirty[OLED_FB_MAX_PAGES];
+    for (uint page = 0; page < fb->pages; ++page)
+        dirty[page] = changed_cols(fb, page, &lo[page], &hi[page]);
+
+    // best[i] is the fewest bytes which bring pages 0 to i - 1 up to date,
+    // with the last rectangle starting at page start[i] (or i if page i - 1
+    // is left alone). Rectangles need only start and end on dirty pages.
+    uint best[OLED_FB_MAX_PAGES + 1];
+    uint start[OLED_FB_MAX_PAGES + 1];
+    best[0] = 0;
+    for (uint i = 1; i <= fb->pages; ++i) {
+        if (!dirty[i - 1]) {
+            best[i] = best[i - 1];
+            start[i] = i;
+            continue;
+        }
+        best[i] = UINT32_MAX;
+        int l = lo[i - 1], h = hi[i - 1];
+        for (int j = (int) i - 1; j >= 0; --j) {
+            if (!dirty[j])
+                continue;
+            l = MIN(l, lo[j]);
+            h = MAX(h, hi[j]);
+            uint cost = best[j] + RECT_OVERHEAD + (i - (uint) j) * (uint) (h - l + 1);
+            if (cost < best[i]) {
+                best[i] = cost;
+                start[i] = (uint) j;
+            }
+        }
+    }
+
+    // Walk back through the choices, which finds the rectangles bottom up
+    uint n = 0;
+    oled_fb_rect_t found[OLED_FB_MAX_PAGES];
+    for (uint i = fb->pages; i > 0;) {
+        if (start[i] == i) {
+            --i;
+            continue;
+        }
+        int l = lo[i - 1], h = hi[i - 1];
+        for (uint j = start[i]; j < i; ++j) {
+            if (dirty[j]) {
+                l = MIN(l, lo[j]);
+                h = MAX(h, hi[j]);
+            }
+        }
+        found[n++] = (oled_fb_rect_t) {(uint8_t) l, (uint8_t) h, (uint8_t) start[i], (uint8_t) (i - 1)};
+        i = start[i];
+    }
+    if (rects) {
+        for (uint k = 0; k < n; ++k)
+            rects[k] = found[n - 1 - k];
+    }
+    return n;
+}
+
+uint oled_fb_encode(oled_fb_t *fb, uint16_t *words) {
+    oled_fb_rect_t rects[OLED_FB_MAX_PAGES];
+    uint n = oled_fb_plan(fb, rects);
+    uint k = 0;
+    for (uint r = 0; r < n; ++r) {
+        const oled_fb_rect_t *rect = &rects[r];
+        words[k++] = OLED_FB_CONTROL_CMDS;
+        words[k++] = OLED_FB_SET_COL_ADDR;
+        words[k++] = rect->start_col;
+        words[k++] = rect->end_col;
+        words[k++] = OLED_FB_SET_PAGE_ADDR;
+        words[k++] = rect->start_page;
+        words[k++] = rect->end_page | OLED_FB_DATA_CMD_STOP;
+
+        words[k++] = OLED_FB_CONTROL_DATA;
+        for (uint page = rect->start_page; page <= rect->end_page; ++page) {
+            const uint8_t *src = fb->buf + page * fb->width;
+            uint8_t *shown = fb->shown + page * fb->width;
+            for (uint col = rect->start_col; col <= rect->end_col; ++col) {
+                words[k++] = src[col];
+                shown[col] = src[col];
+            }
+        }
+        words[k - 1] |= OLED_FB_DATA_CMD_STOP;
+    }
+    // Whatever wasn't sent was the same already
+    mark_clean(fb);
+    return k;
+}
+
+uint oled_fb_bus_bytes(const uint16_t *words, uint n) {
+    uint bytes = n;
+    for (uint i = 0; i < n; ++i) {
+        if (words[i] & OLED_FB_DATA_CMD_STOP)
+            ++bytes;
+    }
+    return bytes;
+}
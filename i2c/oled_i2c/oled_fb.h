@@ -0,0 +1,110 @@
+/**
+ * Copyright (c) 2022 Raspberry Pi (Trading) Ltd.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+#ifndef _OLED_FB_H
+#define _OLED_FB_H
+
+#include "pico.h"
+
+// ----------------------------------------------------------------------------
+// A framebuffer for an SSD1306 display which only sends what has changed.
+//
+// Drawing goes into buf, and marks the columns it touched on each page as
+// dirty. oled_fb_encode() then trims the dirty columns down to the ones which
+// differ from what the display was last sent, picks the cheapest set of
+// rectangles to cover them, and encodes each one as two I2C writes: one to
+// set the display's column and page window, and one with the data. Merging
+// the rectangles on neighbouring pages saves the window and address bytes at
+// the cost of resending some unchanged columns; the choice is made page by
+// page to send the fewest bytes.
+//
+// The writes are encoded as words for the I2C block's DATA_CMD register, with
+// the STOP bit set on the last byte of each, so they can all be sent by one
+// DMA transfer; oled_fb_bus_bytes() says how many bytes they put on the bus.
+//
+// The display must be in horizontal addressing mode, as oled_init() sets it.
+
+#define OLED_FB_MAX_WIDTH 128
+#define OLED_FB_MAX_PAGES 8
+#define OLED_FB_PAGE_HEIGHT 8
+
+// Control bytes which start each write: a run of commands, or of data
+#define OLED_FB_CONTROL_CMDS 0x00
+#define OLED_FB_CONTROL_DATA 0x40
+
+// SSD1306 commands to set the column and page window
+#define OLED_FB_SET_COL_ADDR 0x21
+#define OLED_FB_SET_PAGE_ADDR 0x22
+
+// The command write for each rectangle is the control byte and six commands;
+// the data write is the control byte and the pixels
+#define OLED_FB_RECT_CMD_LEN 7
+
+// Bits in a DATA_CMD word, as in hardware/regs/i2c.h
+#define OLED_FB_DATA_CMD_STOP 0x200
+
+// Room for the words oled_fb_encode() may produce: at worst a rectangle for
+// each page, all of it
+#define OLED_FB_MAX_WORDS (OLED_FB_MAX_PAGES * (OLED_FB_RECT_CMD_LEN + 1 + OLED_FB_MAX_WIDTH))
+
+typedef struct {
+    uint8_t start_col;
+    uint8_t end_col;
+    uint8_t start_page;
+    uint8_t end_page;
+} oled_fb_rect_t;
+
+typedef struct {
+    uint width;
+    uint pages;
+    // What should be shown, a byte per column per page, with the top row in
+    // bit 0, as for the display's own memory
+    uint8_t buf[OLED_FB_MAX_PAGES * OLED_FB_MAX_WIDTH];
+    // What the display was last sent
+    uint8_t shown[OLED_FB_MAX_PAGES * OLED_FB_MAX_WIDTH];
+    // The columns on each page which may differ; empty when min > max
+    uint8_t dirty_min[OLED_FB_MAX_PAGES];
+    uint8_t dirty_max[OLED_FB_MAX_PAGES];
+} oled_fb_t;
+
+// Set up a blank framebuffer for a display of width by height pixels. The
+// display's contents are unknown, so the whole of it is dirty.
+void oled_fb_init(oled_fb_t *fb, uint width, uint height);
+
+// Forget what the display was sent, after it has been reset or a write to it
+// has failed, so that the next update sends everything
+void oled_fb_invalidate(oled_fb_t *fb);
+
+void oled_fb_fill(oled_fb_t *fb, uint8_t value);
+
+void oled_fb_set_pixel(oled_fb_t *fb, uint x, uint y, bool on);
+
+// Set or clear a rectangle of pixels, clipped to the display
+void oled_fb_fill_rect(oled_fb_t *fb, uint x, uint y, uint w, uint h, bool on);
+
+// Copy in an image laid out like the display's memory (as oled_i2c's images
+// are), w columns by pages pages, with its top left at column x of page page,
+// clipped to the display
+void oled_fb_blit(oled_fb_t *fb, const uint8_t *img, uint x, uint page, uint w, uint pages);
+
+// Mark columns x0 to x1 of pages page0 to page1 as dirty, after writing to
+// buf directly
+void oled_fb_mark_dirty(oled_fb_t *fb, uint x0, uint x1, uint page0, uint page1);
+
+// Work out the rectangles to send, and return how many there are, at most one
+// per page. If rects is not NULL they are stored there. This doesn't change
+// anything, so it can be used to see what an update would cost.
+uint oled_fb_plan(const oled_fb_t *fb, oled_fb_rect_t *rects);
+
+// Encode the writes to bring the display up to date into words (which must
+// have room for OLED_FB_MAX_WORDS), return how many words there are, and
+// treat them as sent: the framebuffer is clean afterwards.
+uint oled_fb_encode(oled_fb_t *fb, uint16_t *words);
+
+// Bytes an encoded update puts on the bus, counting the address byte which
+// starts each write
+uint oled_fb_bus_bytes(const uint16_t *words, uint n);
+
+#endif
@@ -0,0 +1,337 @@
+/**
+ * Copyright (c) 2022 Raspberry Pi (Trading) Ltd.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+#include <stdio.h>
+#include <string.h>
+#include "pico/stdlib.h"
+#include "oled_fb.h"
+#include "raspberry26x32.h"
+#include "test_rand.h"
+
+// Renders sequences of frames through the framebuffer into a simulated
+// SSD1306, checks the display ends up showing each frame, and compares the
+// bytes each frame puts on the bus with sending the whole frame the way
+// oled_i2c's render() does. Times on the bus are worked out from the bytes
+// and writes at 400 kHz, as no display is attached.
+
+#define WIDTH 128
+#define HEIGHT 32
+#define PAGES (HEIGHT / OLED_FB_PAGE_HEIGHT)
+#define FRAMES 200
+#define BUS_HZ 400000
+
+// render() sends six commands, each as a write of its own with a control
+// byte, then the data: an address byte, a control byte and the pixels
+#define FULL_REFRESH_BYTES (6 * 3 + 2 + WIDTH * PAGES)
+
+// ----------------------------------------------------------------------------
+// The display: its memory, and the column and page window in horizontal
+// addressing mode
+
+typedef struct {
+    uint8_t ram[PAGES * WIDTH];
+    uint start_col, end_col, start_page, end_page;
+    uint col, page;
+    uint writes;
+} display_t;
+
+static void display_reset(display_t *d) {
+    memset(d, 0, sizeof(*d));
+    // Whatever was left in it
+    for (uint i = 0; i < sizeof(d->ram); ++i)
+        d->ram[i] = (uint8_t) next_rand();
+    d->end_col = WIDTH - 1;
+    d->end_page = PAGES - 1;
+}
+
+static bool display_command(display_t *d, const uint8_t *cmd, uint len) {
+    if (cmd[0] == OLED_FB_SET_COL_ADDR && len == 3) {
+        d->start_col = d->col = cmd[1];
+        d->end_col = cmd[2];
+    } else if (cmd[0] == OLED_FB_SET_PAGE_ADDR && len == 3) {
+        d->start_page = d->page = cmd[1];
+        d->end_page = cmd[2];
+    } else {
+        return false;
+    }
+    return d->end_col < WIDTH && d->end_page < PAGES;
+}
+
+// One I2C write: a control byte, then commands or data
+static bool display_write(display_t *d, const uint8_t *b, uint len) {
+    ++d->writes;
+    if (len < 2)
+        return false;
+    if (b[0] == OLED_FB_CONTROL_CMDS) {
+        // Each command and its arguments
+        for (uint i = 1; i < len; i += 3) {
+            if (i + 3 > len || !display_command(d, b + i, 3))
+                return false;
+        }
+        return true;
+    }
+    if (b[0] != OLED_FB_CONTROL_DATA)
+        return false;
+    for (uint i = 1; i < len; ++i) {
+        d->ram[d->page * WIDTH + d->col] = b[i];
+        if (++d->col > d->end_col) {
+            d->col = d->start_col;
+            if (++d->page > d->end_page)
+                d->page = d->start_page;
+        }
+    }
+    return true;
+}
+
+// Split the DATA_CMD words into writes at each STOP
+static bool display_receive(display_t *d, const uint16_t *words, uint n) {
+    uint8_t write[1 + PAGES * WIDTH + 8];
+    uint len = 0;
+    for (uint i = 0; i < n; ++i) {
+        if (words[i] & ~(0xffu | OLED_FB_DATA_CMD_STOP) || len == sizeof(write))
+            return false;
+        write[len++] = (uint8_t) words[i];
+        if (words[i] & OLED_FB_DATA_CMD_STOP) {
+            if (!display_write(d, write, len))
+                return false;
+            len = 0;
+        }
+    }
+    return !len;
+}
+
+// ----------------------------------------------------------------------------
+
+static oled_fb_t fb;
+static display_t display;
+static uint16_t words[OLED_FB_MAX_WORDS];
+static uint failures;
+
+static void result(const char *name, bool ok) {
+    printf("%-40s %s\n", name, ok ? "ok" : "FAILED");
+    if (!ok)
+        ++failures;
+}
+
+typedef struct {
+    uint frames;
+    uint bytes;
+    uint max_bytes;
+    uint writes;
+    bool mismatch;
+} scene_stats_t;
+
+static void update(scene_stats_t *s) {
+    uint n = oled_fb_encode(&fb, words);
+    uint writes = display.writes;
+    if (!display_receive(&display, words, n) || memcmp(display.ram, fb.buf, sizeof(display.ram)))
+        s->mismatch = true;
+    uint bytes = oled_fb_bus_bytes(words, n);
+    ++s->frames;
+    s->bytes += bytes;
+    s->max_bytes = MAX(s->max_bytes, bytes);
+    s->writes += display.writes - writes;
+}
+
+static void report(const char *name, const scene_stats_t *s) {
+    uint avg = s->bytes / s->frames;
+    // Each byte is nine bits, and each write adds a start and a stop
+    uint us = (uint) (((uint64_t) s->bytes * 9 + s->writes * 2) * 1000000 / BUS_HZ / s->frames);
+    printf("  %-20s %4u bytes/frame (max %3u), %5u us at 400 kHz, %3u%% of full refresh\n",
+           name, avg, s->max_bytes, us, avg * 100 / FULL_REFRESH_BYTES);
+    char check[48];
+    snprintf(check, sizeof(check), "%s: display matches", name);
+    result(check, !s->mismatch);
+}
+
+static void start_scene(void) {
+    // A cleared display, as oled_i2c leaves it
+    oled_fb_fill(&fb, 0);
+    scene_stats_t s = {0};
+    update(&s);
+}
+
+// A three digit counter, drawn as seven segment digits 6 pixels wide
+static void draw_digit(uint x, uint y, uint digit) {
+    static const uint8_t segments[10] = {0x3f, 0x06, 0x5b, 0x4f, 0x66, 0x6d, 0x7d, 0x07, 0x7f, 0x6f};
+    static const uint8_t seg_rect[7][4] = {
+        {1, 0, 4, 1}, {5, 1, 1, 5}, {5, 7, 1, 5}, {1, 12, 4, 1}, {0, 7, 1, 5}, {0, 1, 1, 5}, {1, 6, 4, 1},
+    };
+    oled_fb_fill_rect(&fb, x, y, 6, 13, false);
+    for (uint i = 0; i < 7; ++i) {
+        if (segments[digit] & (1u << i))
+            oled_fb_fill_rect(&fb, x + seg_rect[i][0], y + seg_rect[i][1], seg_rect[i][2], seg_rect[i][3], true);
+    }
+}
+
+static void scene_counter(void) {
+    start_scene();
+    scene_stats_t s = {0};
+    for (uint f = 0; f < FRAMES; ++f) {
+        uint v = f % 1000;
+        draw_digit(100, 10, v / 100);
+        draw_digit(108, 10, v / 10 % 10);
+        draw_digit(116, 10, v % 10);
+        update(&s);
+    }
+    report("counter", &s);
+}
+
+static void scene_unchanged(void) {
+    start_scene();
+    oled_fb_blit(&fb, raspberry26x32, 10, 0, IMG_WIDTH, PAGES);
+    scene_stats_t s = {0};
+    update(&s);
+    s = (scene_stats_t) {0};
+    for (uint f = 0; f < FRAMES; ++f) {
+        // Redrawn every frame, but the same each time
+        oled_fb_blit(&fb, raspberry26x32, 10, 0, IMG_WIDTH, PAGES);
+        update(&s);
+    }
+    report("redrawn, unchanged", &s);
+    result("unchanged: nothing sent", !s.bytes);
+}
+
+static void scene_sprite(void) {
+    start_scene();
+    scene_stats_t s = {0};
+    uint x = 0;
+    int dx = 1;
+    for (uint f = 0; f < FRAMES; ++f) {
+        oled_fb_fill_rect(&fb, x, 0, IMG_WIDTH, HEIGHT, false);
+        if (x + dx + IMG_WIDTH > WIDTH || (int) x + dx < 0)
+            dx = -dx;
+        x += dx;
+        oled_fb_blit(&fb, raspberry26x32, x, 0, IMG_WIDTH, PAGES);
+        update(&s);
+    }
+    report("moving raspberry", &s);
+}
+
+static void scene_bars(void) {
+    start_scene();
+    scene_stats_t s = {0};
+    uint heights[16] = {0};
+    for (uint f = 0; f < FRAMES; ++f) {
+        for (uint i = 0; i < 16; ++i) {
+            int h = (int) heights[i] + (int) (next_rand() % 5) - 2;
+            heights[i] = (uint) (h < 0 ? 0 : h > HEIGHT ? HEIGHT : h);
+            oled_fb_fill_rect(&fb, i * 8, 0, 6, HEIGHT - heights[i], false);
+            oled_fb_fill_rect(&fb, i * 8, HEIGHT - heights[i], 6, heights[i], true);
+        }
+        update(&s);
+    }
+    report("bar graph", &s);
+}
+
+static void scene_pixels(void) {
+    start_scene();
+    scene_stats_t s = {0};
+    for (uint f = 0; f < FRAMES; ++f) {
+        for (uint i = 0; i < 4; ++i)
+            oled_fb_set_pixel(&fb, next_rand() % WIDTH, next_rand() % HEIGHT, next_rand() & 1);
+        update(&s);
+    }
+    report("scattered pixels", &s);
+}
+
+static void scene_noise(void) {
+    start_scene();
+    scene_stats_t s = {0};
+    for (uint f = 0; f < FRAMES; ++f) {
+        for (uint i = 0; i < PAGES * WIDTH; ++i)
+            fb.buf[i] = (uint8_t) next_rand();
+        oled_fb_mark_dirty(&fb, 0, WIDTH - 1, 0, PAGES - 1);
+        update(&s);
+    }
+    report("every pixel changing", &s);
+    result("worst case no more than full refresh", s.max_bytes <= FULL_REFRESH_BYTES);
+}
+
+static void test_first_frame(void) {
+    scene_stats_t s = {0};
+    update(&s);
+    report("first frame", &s);
+    result("first frame sends everything", s.bytes == 1 + OLED_FB_RECT_CMD_LEN + 2 + PAGES * WIDTH);
+}
+
+// ----------------------------------------------------------------------------
+// Check the plan is the cheapest, by trying every way of grouping the pages
+
+static uint rect_cost(const oled_fb_rect_t *r) {
+    return 1 + OLED_FB_RECT_CMD_LEN + 2 + (r->end_col - r->start_col + 1u) * (r->end_page - r->start_page + 1u);
+}
+
+static uint brute_force(const int *lo, const int *hi, uint page) {
+    if (page == PAGES)
+        return 0;
+    if (lo[page] > hi[page])
+        return brute_force(lo, hi, page + 1);
+    uint best = UINT32_MAX;
+    int l = lo[page], h = hi[page];
+    for (uint end = page; end < PAGES; ++end) {
+        if (lo[end] <= hi[end]) {
+            l = MIN(l, lo[end]);
+            h = MAX(h, hi[end]);
+        }
+        uint cost = 1 + OLED_FB_RECT_CMD_LEN + 2 + (uint) (h - l + 1) * (end - page + 1) + brute_force(lo, hi, end + 1);
+        best = MIN(best, cost);
+    }
+    return best;
+}
+
+static void test_plan_is_cheapest(void) {
+    bool ok = true;
+    for (uint t = 0; t < 20000; ++t) {
+        oled_fb_fill(&fb, 0);
+        oled_fb_encode(&fb, words);
+        int lo[PAGES], hi[PAGES];
+        for (uint page = 0; page < PAGES; ++page) {
+            lo[page] = 1;
+            hi[page] = 0;
+            if (next_rand() % 3 == 0)
+                continue;
+            uint a = next_rand() % WIDTH, b = next_rand() % WIDTH;
+            lo[page] = (int) MIN(a, b);
+            hi[page] = (int) MAX(a, b);
+            // Change just the ends, so the trimmed range is exactly [lo, hi]
+            oled_fb_set_pixel(&fb, (uint) lo[page], page * OLED_FB_PAGE_HEIGHT, true);
+            oled_fb_set_pixel(&fb, (uint) hi[page], page * OLED_FB_PAGE_HEIGHT + 1, true);
+        }
+        oled_fb_rect_t rects[OLED_FB_MAX_PAGES];
+        uint n = oled_fb_plan(&fb, rects);
+        uint cost = 0;
+        for (uint i = 0; i < n; ++i) {
+            cost += rect_cost(&rects[i]);
+            ok &= i == 0 || rects[i].start_page > rects[i - 1].end_page;
+        }
+        ok &= cost == brute_force(lo, hi, 0);
+        ok &= oled_fb_bus_bytes(words, oled_fb_encode(&fb, words)) == cost;
+    }
+    result("plan is the cheapest", ok);
+}
+
+int main() {
+    stdio_init_all();
+    printf("OLED framebuffer test\n");
+
+    oled_fb_init(&fb, WIDTH, HEIGHT);
+    display_reset(&display);
+    printf("Full refresh is %u bytes/frame, %u us at 400 kHz\n", FULL_REFRESH_BYTES,
+           (uint) (((uint64_t) FULL_REFRESH_BYTES * 9 + 7 * 2) * 1000000 / BUS_HZ));
+
+    test_first_frame();
+    scene_unchanged();
+    scene_counter();
+    scene_sprite();
+    scene_bars();
+    scene_pixels();
+    scene_noise();
+    test_plan_is_cheapest();
+
+    printf(failures ? "FAILED\n" : "All good\n");
+    return failures ? 1 : 0;
+}
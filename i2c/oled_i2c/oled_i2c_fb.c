@@ -0,0 +1,191 @@
+/**
+ * Copyright (c) 2022 Raspberry Pi (Trading) Ltd.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+#include <stdio.h>
+#include "pico/stdlib.h"
+#include "pico/binary_info.h"
+#include "hardware/i2c.h"
+#include "hardware/dma.h"
+#include "oled_fb.h"
+#include "raspberry26x32.h"
+
+/* Example code to animate an SSD1306-based OLED display, sending only what
+   changes from one frame to the next, by DMA.
+
+   oled_i2c sends the whole of an area every time it is drawn, and waits for
+   it to go. Here the frames are drawn into a framebuffer (see oled_fb.h),
+   which works out the smallest rectangles that bring the display up to date,
+   and they are queued to the I2C block by DMA. The CPU carries on while they
+   go: the next frame is drawn, and encoded into a second buffer, while the
+   last one is still being sent, and only then does it wait for the bus. The
+   time spent waiting is counted as idle.
+
+   Connections are the same as for oled_i2c:
+
+   GPIO PICO_DEFAULT_I2C_SDA_PIN (on Pico this is GP4 (pin 6)) -> SDA on display
+   board
+   GPIO PICO_DEFAULT_I2C_SCK_PIN (on Pico this is GP5 (pin 7)) -> SCL on
+   display board
+   3.3v (pin 36) -> VCC on display board
+   GND (pin 38)  -> GND on display board
+*/
+
+#define OLED_ADDR _u(0x3C)
+#define OLED_HEIGHT _u(32)
+#define OLED_WIDTH _u(128)
+
+#ifdef i2c_default
+
+// The same set up as oled_init() in oled_i2c.c, as one write of commands
+static const uint8_t oled_init_cmds[] = {
+    OLED_FB_CONTROL_CMDS,
+    0xAE,             // set display off
+    0x20, 0x00,       // horizontal addressing mode
+    0x40,             // set display start line to 0
+    0xA1,             // column address 127 is mapped to SEG0
+    0xA8, OLED_HEIGHT - 1, // multiplex ratio: our display is only 32 pixels high
+    0xC8,             // scan from bottom up, COM[N-1] to COM0
+    0xD3, 0x00,       // no display offset
+    0xDA, 0x02,       // COM pins hardware configuration
+    0xD5, 0x80,       // div ratio of 1, standard freq
+    0xD9, 0xF1,       // pre-charge period
+    0xDB, 0x30,       // VCOMH deselect level 0.83xVcc
+    0x81, 0xFF,       // contrast
+    0xA4,             // follow RAM content
+    0xA6,             // normal (not inverted) display
+    0x8D, 0x14,       // charge pump on
+    0x2E,             // deactivate horizontal scrolling
+    0xAF,             // turn display on
+};
+
+static oled_fb_t fb;
+// Encoded updates: one being sent by the DMA, and one being made ready
+static uint16_t words[2][OLED_FB_MAX_WORDS];
+static uint dma_chan;
+
+static void oled_dma_init() {
+    i2c_hw_t *hw = i2c_get_hw(i2c_default);
+    hw->enable = 0;
+    hw->tar = OLED_ADDR;
+    hw->enable = 1;
+    // Ask for more before the TX FIFO runs dry. If the DMA can't keep up, the
+    // I2C block holds the clock low until it does, rather than ending the write.
+    hw->dma_tdlr = 4;
+    hw->dma_cr = I2C_IC_DMA_CR_TDMAE_BITS;
+
+    dma_chan = dma_claim_unused_channel(true);
+    dma_channel_config c = dma_channel_get_default_config(dma_chan);
+    channel_config_set_transfer_data_size(&c, DMA_SIZE_16);
+    channel_config_set_dreq(&c, i2c_get_dreq(i2c_default, true));
+    dma_channel_configure(dma_chan, &c, &hw->data_cmd, NULL, 0, false);
+}
+
+// True while an update is still going out; sees to it if the display didn't
+// answer, so that the next update sends everything again
+static bool oled_dma_busy() {
+    i2c_hw_t *hw = i2c_get_hw(i2c_default);
+    if (hw->raw_intr_stat & I2C_IC_RAW_INTR_STAT_TX_ABRT_BITS) {
+        dma_channel_abort(dma_chan);
+        (void) hw->clr_tx_abrt;
+        oled_fb_invalidate(&fb);
+        return false;
+    }
+    return dma_channel_is_busy(dma_chan) || !(hw->status & I2C_IC_STATUS_TFE_BITS) ||
+           (hw->status & I2C_IC_STATUS_MST_ACTIVITY_BITS);
+}
+
+// Encode whatever has changed into the buffer the DMA isn't sending from, wait
+// for the last update to finish, and start this one without waiting for it.
+// Returns the number of bytes it takes on the bus, and counts the loops spent
+// waiting in *idle_loops.
+static uint oled_update(uint64_t *idle_loops) {
+    static uint back;
+    uint n = oled_fb_encode(&fb, words[back]);
+    // If the last update fails now, the display is in an unknown state and
+    // this one may not put it right, but the one after sends everything
+    while (oled_dma_busy())
+        ++*idle_loops;
+    if (n)
+        dma_channel_transfer_from_buffer_now(dma_chan, words[back], n);
+    uint bytes = oled_fb_bus_bytes(words[back], n);
+    back ^= 1;
+    return bytes;
+}
+
+// A seven segment digit, 6 pixels wide and 13 high
+static void draw_digit(uint x, uint y, uint digit) {
+    static const uint8_t segments[10] = {0x3f, 0x06, 0x5b, 0x4f, 0x66, 0x6d, 0x7d, 0x07, 0x7f, 0x6f};
+    static const uint8_t seg_rect[7][4] = {
+        {1, 0, 4, 1}, {5, 1, 1, 5}, {5, 7, 1, 5}, {1, 12, 4, 1}, {0, 7, 1, 5}, {0, 1, 1, 5}, {1, 6, 4, 1},
+    };
+    oled_fb_fill_rect(&fb, x, y, 6, 13, false);
+    for (uint i = 0; i < 7; ++i) {
+        if (segments[digit] & (1u << i))
+            oled_fb_fill_rect(&fb, x + seg_rect[i][0], y + seg_rect[i][1], seg_rect[i][2], seg_rect[i][3], true);
+    }
+}
+
+#endif
+
+int main() {
+    stdio_init_all();
+
+#if !defined(i2c_default) || !defined(PICO_DEFAULT_I2C_SDA_PIN) || !defined(PICO_DEFAULT_I2C_SCL_PIN)
+#warning i2c / oled_i2c_fb example requires a board with I2C pins
+    puts("Default I2C pins were not defined");
+#else
+    // useful information for picotool
+    bi_decl(bi_2pins_with_func(PICO_DEFAULT_I2C_SDA_PIN, PICO_DEFAULT_I2C_SCL_PIN, GPIO_FUNC_I2C));
+    bi_decl(bi_program_description("OLED I2C framebuffer example for the Raspberry Pi Pico"));
+
+    printf("Hello, OLED display! Watch my raspberry bounce..\n");
+
+    i2c_init(i2c_default, 400 * 1000);
+    gpio_set_function(PICO_DEFAULT_I2C_SDA_PIN, GPIO_FUNC_I2C);
+    gpio_set_function(PICO_DEFAULT_I2C_SCL_PIN, GPIO_FUNC_I2C);
+    gpio_pull_up(PICO_DEFAULT_I2C_SDA_PIN);
+    gpio_pull_up(PICO_DEFAULT_I2C_SCL_PIN);
+
+    i2c_write_blocking(i2c_default, OLED_ADDR, oled_init_cmds, sizeof(oled_init_cmds), false);
+    oled_dma_init();
+
+    // The first update clears the whole display
+    oled_fb_init(&fb, OLED_WIDTH, OLED_HEIGHT);
+
+    uint x = 0;
+    int dx = 1;
+    uint frame = 0;
+    uint frames = 0, bytes = 0;
+    uint64_t idle_loops = 0;
+    absolute_time_t next_report = make_timeout_time_ms(1000);
+    while (true) {
+        // Draw the next frame while the last one goes out; the DMA sends from
+        // the encoded words, not from the framebuffer. Move the raspberry
+        // along, and count the frames in the corner.
+        oled_fb_fill_rect(&fb, x, 0, IMG_WIDTH, OLED_HEIGHT, false);
+        if (x + dx + IMG_WIDTH > OLED_WIDTH - 3 * 8 || (int) x + dx < 0)
+            dx = -dx;
+        x += dx;
+        oled_fb_blit(&fb, raspberry26x32, x, 0, IMG_WIDTH, OLED_HEIGHT / OLED_FB_PAGE_HEIGHT);
+        draw_digit(OLED_WIDTH - 23, 10, frame / 100 % 10);
+        draw_digit(OLED_WIDTH - 15, 10, frame / 10 % 10);
+        draw_digit(OLED_WIDTH - 7, 10, frame % 10);
+        ++frame;
+
+        bytes += oled_update(&idle_loops);
+        ++frames;
+
+        if (time_reached(next_report)) {
+            printf("%u frames/s, %u bytes/frame (a full refresh is %u), %llu idle loops\n",
+                   frames, frames ? bytes / frames : 0, 6 * 3 + 2 + OLED_WIDTH * OLED_HEIGHT / 8, idle_loops);
+            frames = bytes = 0;
+            idle_loops = 0;
+            next_report = delayed_by_ms(next_report, 1000);
+        }
+    }
+#endif
+    return 0;
+}
@@ -0,0 +1,135 @@
+/**
+ * Copyright (c) 2022 Raspberry Pi (Trading) Ltd.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+#include "i2c_dma.h"
+#include "hardware/dma.h"
+#include "hardware/irq.h"
+#include "hardware/timer.h"
+
+static i2c_dma_bus_t *buses[NUM_I2CS];
+static bool dma_irq_installed;
+
+static void i2c_dma_bus_start_read(void *ctx, uint8_t addr, uint8_t reg, uint8_t *dst, uint len) {
+    i2c_dma_bus_t *bus = (i2c_dma_bus_t *) ctx;
+    i2c_hw_t *hw = i2c_get_hw(bus->i2c);
+    hw->enable = 0;
+    hw->tar = addr;
+    hw->enable = 1;
+
+    // The register number, then a read command for each byte: the first with
+    // a repeated start, and the last with a stop
+    bus->cmds[0] = reg;
+    for (uint i = 0; i < len; ++i) {
+        bus->cmds[i + 1] = I2C_IC_DATA_CMD_CMD_BITS |
+                           (i == 0 ? I2C_IC_DATA_CMD_RESTART_BITS : 0) |
+                           (i == len - 1 ? I2C_IC_DATA_CMD_STOP_BITS : 0);
+    }
+    dma_channel_transfer_to_buffer_now(bus->dma_rx, dst, len);
+    dma_channel_transfer_from_buffer_now(bus->dma_tx, bus->cmds, len + 1);
+}
+
+static void i2c_dma_bus_set_alarm(void *ctx, uint64_t at_us) {
+    i2c_dma_bus_t *bus = (i2c_dma_bus_t *) ctx;
+    // If the time has already gone, try again a little later
+    absolute_time_t t = from_us_since_boot(at_us);
+    while (hardware_alarm_set_target(bus->alarm, t))
+        t = make_timeout_time_us(10);
+}
+
+static void i2c_dma_bus_alarm_callback(uint alarm_num) {
+    for (uint i = 0; i < count_of(buses); ++i) {
+        if (buses[i] && buses[i]->alarm == alarm_num)
+            sensor_hub_poll(buses[i]->hub, time_us_64());
+    }
+}
+
+static void __isr i2c_dma_bus_dma_irq(void) {
+    for (uint i = 0; i < count_of(buses); ++i) {
+        i2c_dma_bus_t *bus = buses[i];
+        if (bus && (dma_hw->ints0 & (1u << bus->dma_rx))) {
+            dma_hw->ints0 = 1u << bus->dma_rx;
+            sensor_hub_read_done(bus->hub, 0, time_us_64());
+        }
+    }
+}
+
+static void __isr i2c_dma_bus_i2c_irq(void) {
+    for (uint i = 0; i < count_of(buses); ++i) {
+        i2c_dma_bus_t *bus = buses[i];
+        if (!bus)
+            continue;
+        i2c_hw_t *hw = i2c_get_hw(bus->i2c);
+        if (!(hw->intr_stat & I2C_IC_INTR_STAT_R_TX_ABRT_BITS))
+            continue;
+        bus->abort_source = hw->tx_abrt_source;
+        ++bus->aborts;
+        // An abort can raise a spurious completion interrupt (RP2040-E13), so
+        // mask it whilst aborting
+        dma_channel_abort(bus->dma_tx);
+        dma_channel_set_irq0_enabled(bus->dma_rx, false);
+        dma_channel_abort(bus->dma_rx);
+        dma_hw->ints0 = 1u << bus->dma_rx;
+        dma_channel_set_irq0_enabled(bus->dma_rx, true);
+        // The TX FIFO has been flushed, and is held until the abort is cleared
+        (void) hw->clr_tx_abrt;
+        while (hw->rxflr)
+            (void) hw->data_cmd;
+        sensor_hub_read_done(bus->hub, -1, time_us_64());
+    }
+}
+
+sensor_hub_bus_t i2c_dma_bus_init(i2c_dma_bus_t *bus, i2c_inst_t *i2c, sensor_hub_t *hub) {
+    bus->i2c = i2c;
+    bus->hub = hub;
+    bus->abort_source = 0;
+    bus->aborts = 0;
+    i2c_hw_t *hw = i2c_get_hw(i2c);
+    uint index = i2c_hw_index(i2c);
+    hard_assert(!buses[index]);
+    buses[index] = bus;
+
+    // Ask for more commands before the TX FIFO runs dry, and for every byte
+    // that arrives in the RX FIFO
+    hw->dma_tdlr = 4;
+    hw->dma_rdlr = 0;
+    hw->dma_cr = I2C_IC_DMA_CR_TDMAE_BITS | I2C_IC_DMA_CR_RDMAE_BITS;
+
+    bus->dma_tx = dma_claim_unused_channel(true);
+    dma_channel_config c = dma_channel_get_default_config(bus->dma_tx);
+    channel_config_set_transfer_data_size(&c, DMA_SIZE_32);
+    channel_config_set_dreq(&c, i2c_get_dreq(i2c, true));
+    dma_channel_configure(bus->dma_tx, &c, &hw->data_cmd, NULL, 0, false);
+
+    bus->dma_rx = dma_claim_unused_channel(true);
+    c = dma_channel_get_default_config(bus->dma_rx);
+    channel_config_set_transfer_data_size(&c, DMA_SIZE_8);
+    channel_config_set_read_increment(&c, false);
+    channel_config_set_write_increment(&c, true);
+    channel_config_set_dreq(&c, i2c_get_dreq(i2c, false));
+    dma_channel_configure(bus->dma_rx, &c, NULL, &hw->data_cmd, 0, false);
+    dma_channel_set_irq0_enabled(bus->dma_rx, true);
+    if (!dma_irq_installed) {
+        irq_add_shared_handler(DMA_IRQ_0, i2c_dma_bus_dma_irq, PICO_SHARED_IRQ_HANDLER_DEFAULT_ORDER_PRIORITY);
+        irq_set_enabled(DMA_IRQ_0, true);
+        dma_irq_installed = true;
+    }
+
+    // Only the abort needs an interrupt; the blocking functions poll the raw
+    // status, so they still work when the hub isn't running
+    hw->intr_mask = I2C_IC_INTR_MASK_M_TX_ABRT_BITS;
+    uint irq = index ? I2C1_IRQ : I2C0_IRQ;
+    irq_set_exclusive_handler(irq, i2c_dma_bus_i2c_irq);
+    irq_set_enabled(irq, true);
+
+    bus->alarm = (uint) hardware_alarm_claim_unused(true);
+    hardware_alarm_set_callback(bus->alarm, i2c_dma_bus_alarm_callback);
+
+    return (sensor_hub_bus_t) {
+        .start_read = i2c_dma_bus_start_read,
+        .set_alarm = i2c_dma_bus_set_alarm,
+        .ctx = bus,
+    };
+}
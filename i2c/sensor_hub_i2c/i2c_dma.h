@@ -0,0 +1,40 @@
+/**
+ * Copyright (c) 2022 Raspberry Pi (Trading) Ltd.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+#ifndef _I2C_DMA_H
+#define _I2C_DMA_H
+
+#include "hardware/i2c.h"
+#include "sensor_hub.h"
+
+// ----------------------------------------------------------------------------
+// Sensor hub backend for the I2C hardware. The register number and the read
+// commands for a whole burst are queued by one DMA channel, and the data is
+// taken out of the RX FIFO by another. The RX channel's completion interrupt
+// ends the read; the I2C block's TX abort interrupt ends it early if the
+// device NAKs. A hardware alarm wakes the hub up when the next read is due.
+//
+// The DMA, I2C and timer interrupts are all left at the default priority, so
+// none of them can interrupt the others part way through the hub's code.
+
+typedef struct {
+    i2c_inst_t *i2c;
+    uint dma_tx;
+    uint dma_rx;
+    uint alarm;
+    sensor_hub_t *hub;
+    // Abort reason from the I2C block (IC_TX_ABRT_SOURCE) for the last failed
+    // read, and how many reads have failed, for the application to report
+    volatile uint32_t abort_source;
+    volatile uint32_t aborts;
+    uint32_t cmds[SENSOR_HUB_MAX_BURST + 1];
+} i2c_dma_bus_t;
+
+// Set up the backend for an I2C instance which has already been initialised
+// with i2c_init() and had its pins assigned. Claims two DMA channels and a
+// hardware alarm. Returns the interface to pass to sensor_hub_init().
+sensor_hub_bus_t i2c_dma_bus_init(i2c_dma_bus_t *bus, i2c_inst_t *i2c, sensor_hub_t *hub);
+
+#endif
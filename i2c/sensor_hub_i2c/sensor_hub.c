@@ -0,0 +1,166 @@
+/**
+ * Copyright (c) 2022 Raspberry Pi (Trading) Ltd.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+#include <string.h>
+#include "sensor_hub.h"
+
+static_assert(SENSOR_HUB_MAX_SCHEDULES <= 32, "batches are a 32-bit mask of schedules");
+static_assert((SENSOR_HUB_RING_SIZE & (SENSOR_HUB_RING_SIZE - 1)) == 0, "ring size must be a power of 2");
+static_assert(SENSOR_HUB_MAX_READING <= SENSOR_HUB_MAX_BURST, "a single reading must fit in a burst");
+
+void sensor_hub_init(sensor_hub_t *hub, const sensor_hub_bus_t *bus, uint32_t coalesce_us) {
+    memset(hub, 0, sizeof(*hub));
+    hub->bus = *bus;
+    hub->coalesce_us = coalesce_us;
+}
+
+int sensor_hub_add(sensor_hub_t *hub, uint8_t id, uint8_t addr, uint8_t reg, uint len, uint32_t period_us,
+                   uint flags) {
+    if (hub->n_schedules == SENSOR_HUB_MAX_SCHEDULES || !len || len > SENSOR_HUB_MAX_READING || !period_us)
+        return -1;
+    sensor_hub_schedule_t *s = &hub->schedules[hub->n_schedules];
+    s->id = id;
+    s->addr = addr;
+    s->reg = reg;
+    s->len = (uint8_t) len;
+    s->flags = (uint8_t) flags;
+    s->period_us = period_us;
+    s->due_us = 0;
+    return (int) hub->n_schedules++;
+}
+
+void sensor_hub_start(sensor_hub_t *hub, uint64_t now_us) {
+    for (uint i = 0; i < hub->n_schedules; ++i)
+        hub->schedules[i].due_us = now_us;
+    sensor_hub_poll(hub, now_us);
+}
+
+uint64_t sensor_hub_next_due(const sensor_hub_t *hub) {
+    uint64_t next = UINT64_MAX;
+    for (uint i = 0; i < hub->n_schedules; ++i)
+        next = MIN(next, hub->schedules[i].due_us);
+    return next;
+}
+
+// Whether reading registers lo to hi of addr would read any which must be
+// read on their own
+static bool sensor_hub_covers_no_coalesce(const sensor_hub_t *hub, uint8_t addr, uint lo, uint hi) {
+    for (uint i = 0; i < hub->n_schedules; ++i) {
+        const sensor_hub_schedule_t *t = &hub->schedules[i];
+        if ((t->flags & SENSOR_HUB_NO_COALESCE) && t->addr == addr && t->reg < hi && t->reg + t->len > lo)
+            return true;
+    }
+    return false;
+}
+
+void sensor_hub_poll(sensor_hub_t *hub, uint64_t now_us) {
+    if (hub->busy || !hub->n_schedules)
+        return;
+    uint first = 0;
+    for (uint i = 1; i < hub->n_schedules; ++i) {
+        if (hub->schedules[i].due_us < hub->schedules[first].due_us)
+            first = i;
+    }
+    const sensor_hub_schedule_t *s = &hub->schedules[first];
+    if (s->due_us > now_us) {
+        hub->bus.set_alarm(hub->bus.ctx, s->due_us);
+        return;
+    }
+
+    // Take along any other reads of the same device which are nearly due, as
+    // long as the burst stays short enough and reads few registers nobody
+    // asked for. Every extra byte costs 9 clocks, but another transaction
+    // costs about 4 bytes' worth.
+    uint lo = s->reg;
+    uint hi = s->reg + s->len;
+    uint32_t batch = 1u << first;
+    for (uint i = 0; i < hub->n_schedules && !(s->flags & SENSOR_HUB_NO_COALESCE); ++i) {
+        const sensor_hub_schedule_t *t = &hub->schedules[i];
+        if (i == first || t->addr != s->addr || (t->flags & SENSOR_HUB_NO_COALESCE) ||
+            t->due_us > now_us + hub->coalesce_us)
+            continue;
+        uint t_hi = (uint) t->reg + t->len;
+        uint gap = t->reg >= hi ? t->reg - hi : (t_hi <= lo ? lo - t_hi : 0);
+        uint new_lo = MIN(lo, t->reg);
+        uint new_hi = MAX(hi, t_hi);
+        if (gap <= SENSOR_HUB_MAX_GAP && new_hi - new_lo <= SENSOR_HUB_MAX_BURST &&
+            !sensor_hub_covers_no_coalesce(hub, s->addr, new_lo, new_hi)) {
+            lo = new_lo;
+            hi = new_hi;
+            batch |= 1u << i;
+        }
+    }
+
+    hub->busy = true;
+    hub->batch = batch;
+    hub->batch_reg = (uint8_t) lo;
+    hub->batch_start_us = now_us;
+    hub->bus.start_read(hub->bus.ctx, s->addr, (uint8_t) lo, hub->burst, hi - lo);
+}
+
+static void sensor_hub_push(sensor_hub_t *hub, const sensor_hub_schedule_t *s, int result, int32_t lateness_us,
+                            uint64_t now_us) {
+    uint32_t head = atomic_load_explicit(&hub->ring_head, memory_order_relaxed);
+    if (head - atomic_load_explicit(&hub->ring_tail, memory_order_acquire) == SENSOR_HUB_RING_SIZE) {
+        ++hub->stats.dropped;
+        return;
+    }
+    sensor_hub_reading_t *r = &hub->ring[head & (SENSOR_HUB_RING_SIZE - 1)];
+    r->timestamp_us = now_us;
+    r->lateness_us = lateness_us;
+    r->id = s->id;
+    r->len = s->len;
+    r->result = (int8_t) (result < 0 ? -1 : 0);
+    if (result < 0)
+        memset(r->data, 0, s->len);
+    else
+        memcpy(r->data, hub->burst + (s->reg - hub->batch_reg), s->len);
+    // The reading must be complete before the consumer can see it
+    atomic_store_explicit(&hub->ring_head, head + 1, memory_order_release);
+}
+
+void sensor_hub_read_done(sensor_hub_t *hub, int result, uint64_t now_us) {
+    sensor_hub_stats_t *stats = &hub->stats;
+    ++stats->reads;
+    stats->busy_us += now_us - hub->batch_start_us;
+    if (result < 0)
+        ++stats->errors;
+    bool shared = hub->batch & (hub->batch - 1);
+
+    for (uint i = 0; i < hub->n_schedules; ++i) {
+        if (!(hub->batch & (1u << i)))
+            continue;
+        sensor_hub_schedule_t *s = &hub->schedules[i];
+        int32_t lateness_us = (int32_t) ((int64_t) hub->batch_start_us - (int64_t) s->due_us);
+        stats->max_lateness_us = MAX(stats->max_lateness_us, lateness_us);
+        ++stats->readings;
+        if (shared)
+            ++stats->coalesced;
+        sensor_hub_push(hub, s, result, lateness_us, now_us);
+
+        // The next period counts from when this one was due, not when it
+        // ran, so the rate doesn't drift. If a whole period has been missed,
+        // skip it rather than firing off reads back to back to catch up.
+        s->due_us += s->period_us;
+        if (now_us >= s->due_us + s->period_us) {
+            uint64_t missed = (now_us - s->due_us) / s->period_us;
+            s->due_us += missed * s->period_us;
+            stats->overruns += (uint32_t) missed;
+        }
+    }
+
+    hub->busy = false;
+    sensor_hub_poll(hub, now_us);
+}
+
+bool sensor_hub_get_reading(sensor_hub_t *hub, sensor_hub_reading_t *reading) {
+    uint32_t tail = atomic_load_explicit(&hub->ring_tail, memory_order_relaxed);
+    if (tail == atomic_load_explicit(&hub->ring_head, memory_order_acquire))
+        return false;
+    *reading = hub->ring[tail & (SENSOR_HUB_RING_SIZE - 1)];
+    atomic_store_explicit(&hub->ring_tail, tail + 1, memory_order_release);
+    return true;
+}
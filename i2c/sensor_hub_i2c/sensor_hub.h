@@ -0,0 +1,161 @@
+/**
+ * Copyright (c) 2022 Raspberry Pi (Trading) Ltd.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+#ifndef _SENSOR_HUB_H
+#define _SENSOR_HUB_H
+
+#include <stdatomic.h>
+#include "pico.h"
+
+// ----------------------------------------------------------------------------
+// Sensor hub: polls the register blocks of several devices on one I2C bus,
+// each at its own rate, and hands the results to the application through a
+// ring of timestamped readings.
+//
+// The hub itself knows nothing about the hardware. It asks a bus backend to
+// start one register read at a time, and the backend reports back through
+// sensor_hub_read_done(), typically from an interrupt; the next read due is
+// started from there, so the bus is kept busy without the main loop's help.
+// Reads of the same device which are due at about the same time are merged
+// into a single burst when their registers are close enough together; a
+// schedule can opt out of this if reading its registers has side effects.
+//
+// Times are in microseconds, passed in by the caller, so the same code runs
+// against the real bus (i2c_dma.c) or a simulated one on the host
+// (sensor_hub_test.c).
+
+#ifndef SENSOR_HUB_MAX_SCHEDULES
+#define SENSOR_HUB_MAX_SCHEDULES 16
+#endif
+
+// Longest register read a schedule can ask for
+#ifndef SENSOR_HUB_MAX_READING
+#define SENSOR_HUB_MAX_READING 16
+#endif
+
+// Longest burst two or more schedules can be merged into
+#ifndef SENSOR_HUB_MAX_BURST
+#define SENSOR_HUB_MAX_BURST 32
+#endif
+
+// Most registers between two schedules which a merged burst may read without
+// anyone having asked for them. Each costs 9 clocks, and starting another
+// transaction instead costs 30 (start, address, register, repeated start,
+// address, stop) plus the interrupt to start it, so about 4 bytes' worth.
+#ifndef SENSOR_HUB_MAX_GAP
+#define SENSOR_HUB_MAX_GAP 4
+#endif
+
+// Number of readings the ring holds; must be a power of 2
+#ifndef SENSOR_HUB_RING_SIZE
+#define SENSOR_HUB_RING_SIZE 64
+#endif
+
+typedef struct {
+    // Start reading len bytes from device addr, starting at register reg: the
+    // register number is written, then the data read after a repeated start.
+    // The backend must call sensor_hub_read_done() once it has finished, but
+    // not from within start_read itself.
+    void (*start_read)(void *ctx, uint8_t addr, uint8_t reg, uint8_t *dst, uint len);
+    // Call sensor_hub_poll() at, or as soon as possible after, at_us. Replaces
+    // any earlier request.
+    void (*set_alarm)(void *ctx, uint64_t at_us);
+    void *ctx;
+} sensor_hub_bus_t;
+
+// Flags for sensor_hub_add()
+enum {
+    // Read these registers on their own: never merge them into a burst with
+    // another schedule, nor read them as part of the gap between two. For
+    // registers which change when read, such as FIFOs and status registers
+    // which clear on read.
+    SENSOR_HUB_NO_COALESCE = 1,
+};
+
+typedef struct {
+    uint8_t id;
+    uint8_t addr;
+    uint8_t reg;
+    uint8_t len;
+    uint8_t flags;
+    uint32_t period_us;
+    uint64_t due_us;
+} sensor_hub_schedule_t;
+
+typedef struct {
+    // When the read finished
+    uint64_t timestamp_us;
+    // When the read started, relative to when it was due. This is negative
+    // for a read which was brought forward to share a burst with another.
+    int32_t lateness_us;
+    uint8_t id;
+    uint8_t len;
+    // 0, or -1 if the device didn't respond (data is then all zero)
+    int8_t result;
+    uint8_t data[SENSOR_HUB_MAX_READING];
+} sensor_hub_reading_t;
+
+typedef struct {
+    uint32_t reads;       // bus transactions
+    uint32_t readings;    // readings produced (including failed ones)
+    uint32_t coalesced;   // readings which shared a transaction
+    uint32_t errors;      // failed transactions
+    uint32_t overruns;    // periods skipped because the bus couldn't keep up
+    uint32_t dropped;     // readings lost because the ring was full
+    int32_t max_lateness_us;
+    uint64_t busy_us;     // total time spent on transactions
+} sensor_hub_stats_t;
+
+typedef struct {
+    sensor_hub_bus_t bus;
+    sensor_hub_schedule_t schedules[SENSOR_HUB_MAX_SCHEDULES];
+    uint n_schedules;
+    uint32_t coalesce_us;
+    // The transaction in progress
+    volatile bool busy;
+    uint32_t batch;
+    uint8_t batch_reg;
+    uint64_t batch_start_us;
+    uint8_t burst[SENSOR_HUB_MAX_BURST];
+    // Written by the producer (sensor_hub_read_done()) and consumer
+    // (sensor_hub_get_reading()) respectively
+    _Atomic uint32_t ring_head;
+    _Atomic uint32_t ring_tail;
+    sensor_hub_reading_t ring[SENSOR_HUB_RING_SIZE];
+    sensor_hub_stats_t stats;
+} sensor_hub_t;
+
+// A read due within coalesce_us of one which is being started is brought
+// forward to share its transaction, if it is for the same device, its
+// registers are no more than SENSOR_HUB_MAX_GAP from the burst's, and the
+// combined burst is no longer than SENSOR_HUB_MAX_BURST.
+void sensor_hub_init(sensor_hub_t *hub, const sensor_hub_bus_t *bus, uint32_t coalesce_us);
+
+// Read len bytes from register reg of device addr every period_us, returning
+// readings tagged with id; flags is 0 or SENSOR_HUB_NO_COALESCE. Returns the
+// schedule's index, or -1 if there are too many. Add all the schedules before
+// calling sensor_hub_start().
+int sensor_hub_add(sensor_hub_t *hub, uint8_t id, uint8_t addr, uint8_t reg, uint len, uint32_t period_us,
+                   uint flags);
+
+// Make every schedule due now, and start the first read
+void sensor_hub_start(sensor_hub_t *hub, uint64_t now_us);
+
+// Start the next read if the bus is free and one is due, otherwise ask for an
+// alarm when one will be. Called by the backend's alarm.
+void sensor_hub_poll(sensor_hub_t *hub, uint64_t now_us);
+
+// Called by the backend when the read it was asked for has finished; result
+// is 0 on success or negative if it failed. Starts the next read if one is
+// due.
+void sensor_hub_read_done(sensor_hub_t *hub, int result, uint64_t now_us);
+
+// Take the oldest reading out of the ring. Returns false if it is empty.
+bool sensor_hub_get_reading(sensor_hub_t *hub, sensor_hub_reading_t *reading);
+
+// The earliest time a schedule is next due, or UINT64_MAX if there are none
+uint64_t sensor_hub_next_due(const sensor_hub_t *hub);
+
+#endif
@@ -0,0 +1,158 @@
+/**
+ * Copyright (c) 2022 Raspberry Pi (Trading) Ltd.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+#include <stdio.h>
+#include "pico/stdlib.h"
+#include "pico/binary_info.h"
+#include "hardware/i2c.h"
+#include "hardware/sync.h"
+#include "sensor_hub.h"
+#include "i2c_dma.h"
+
+/* Example code to share one I2C bus between several of the sensors from the
+   other examples in this directory, each read at its own rate.
+
+   Rather than each device being read with blocking calls from the main loop,
+   the sensor hub works through the reads in the background using DMA, and the
+   main loop just picks up the readings. The MPU6050's accelerometer, gyro and
+   temperature registers are scheduled separately, but are read in one burst
+   when they fall due together.
+
+   Any of the devices can be left off the bus; their readings just come back
+   marked as failed.
+
+   Connections on Raspberry Pi Pico board, other boards may vary.
+
+   GPIO PICO_DEFAULT_I2C_SDA_PIN (On Pico this is GP4 (pin 6)) -> SDA on each board
+   GPIO PICO_DEFAULT_I2C_SCL_PIN (On Pico this is GP5 (pin 7)) -> SCL on each board
+   3.3v (pin 36) -> VCC on each board
+   GND (pin 38)  -> GND on each board
+
+   The LIS3DH and MCP9808 both default to address 0x18, so the LIS3DH's SDO
+   pin must be tied high to move it to 0x19.
+*/
+
+#define BMP280_ADDR   0x76
+#define MPU6050_ADDR  0x68
+#define LIS3DH_ADDR   0x19
+#define MCP9808_ADDR  0x18
+#define MPL3115_ADDR  0x60
+
+enum {
+    BMP280_RAW = 0,
+    MPU6050_ACCEL,
+    MPU6050_TEMP,
+    MPU6050_GYRO,
+    LIS3DH_ACCEL,
+    MCP9808_TEMP,
+    MPL3115_RAW,
+    N_SENSORS
+};
+
+static const char *sensor_names[N_SENSORS] = {
+    "bmp280 press/temp",
+    "mpu6050 accel",
+    "mpu6050 temp",
+    "mpu6050 gyro",
+    "lis3dh accel",
+    "mcp9808 temp",
+    "mpl3115a2 press/temp",
+};
+
+#ifdef i2c_default
+static sensor_hub_t hub;
+static i2c_dma_bus_t bus;
+
+static void write_reg(uint8_t addr, uint8_t reg, uint8_t value) {
+    uint8_t buf[] = {reg, value};
+    i2c_write_blocking(i2c_default, addr, buf, 2, false);
+}
+
+static void sensors_init(void) {
+    // The same set up as the individual examples, less the calibration reads
+    write_reg(BMP280_ADDR, 0xf5, (0x04 << 5) | (0x05 << 2)); // 500 ms standby, filter x16
+    write_reg(BMP280_ADDR, 0xf4, (0x01 << 5) | (0x03 << 2) | 0x03); // normal mode
+    write_reg(MPU6050_ADDR, 0x6b, 0x00); // out of sleep
+    write_reg(LIS3DH_ADDR, 0x20, 0x77); // 400 Hz, all axes
+    write_reg(MPL3115_ADDR, 0x13, 0x07); // data ready flags
+    write_reg(MPL3115_ADDR, 0x26, 0xb9); // altimeter, 128x oversampling, active
+}
+#endif
+
+int main() {
+    stdio_init_all();
+#if !defined(i2c_default) || !defined(PICO_DEFAULT_I2C_SDA_PIN) || !defined(PICO_DEFAULT_I2C_SCL_PIN)
+    #warning i2c/sensor_hub_i2c example requires a board with I2C pins
+    puts("Default I2C pins were not defined");
+#else
+    printf("Hello, sensor hub!\n");
+
+    i2c_init(i2c_default, 400 * 1000);
+    gpio_set_function(PICO_DEFAULT_I2C_SDA_PIN, GPIO_FUNC_I2C);
+    gpio_set_function(PICO_DEFAULT_I2C_SCL_PIN, GPIO_FUNC_I2C);
+    gpio_pull_up(PICO_DEFAULT_I2C_SDA_PIN);
+    gpio_pull_up(PICO_DEFAULT_I2C_SCL_PIN);
+    // Make the I2C pins available to picotool
+    bi_decl(bi_2pins_with_func(PICO_DEFAULT_I2C_SDA_PIN, PICO_DEFAULT_I2C_SCL_PIN, GPIO_FUNC_I2C));
+
+    sensors_init();
+
+    // Bring reads forward by up to 1 ms to share a burst
+    sensor_hub_bus_t hub_bus = i2c_dma_bus_init(&bus, i2c_default, &hub);
+    sensor_hub_init(&hub, &hub_bus, 1000);
+
+    sensor_hub_add(&hub, BMP280_RAW, BMP280_ADDR, 0xf7, 6, 20000, 0);      // 50 Hz
+    sensor_hub_add(&hub, MPU6050_ACCEL, MPU6050_ADDR, 0x3b, 6, 5000, 0);   // 200 Hz
+    sensor_hub_add(&hub, MPU6050_TEMP, MPU6050_ADDR, 0x41, 2, 100000, 0);  // 10 Hz
+    sensor_hub_add(&hub, MPU6050_GYRO, MPU6050_ADDR, 0x43, 6, 5000, 0);    // 200 Hz
+    // Setting the top bit of the register number makes the LIS3DH auto increment
+    sensor_hub_add(&hub, LIS3DH_ACCEL, LIS3DH_ADDR, 0x80 | 0x28, 6, 10000, 0); // 100 Hz
+    sensor_hub_add(&hub, MCP9808_TEMP, MCP9808_ADDR, 0x05, 2, 250000, 0);  // 4 Hz
+    sensor_hub_add(&hub, MPL3115_RAW, MPL3115_ADDR, 0x01, 5, 100000, 0);   // 10 Hz
+
+    uint64_t start_us = time_us_64();
+    sensor_hub_start(&hub, start_us);
+
+    uint32_t counts[N_SENSORS] = {0};
+    uint32_t failures[N_SENSORS] = {0};
+    sensor_hub_reading_t last[N_SENSORS] = {0};
+    uint64_t next_report = start_us + 1000000;
+    while (1) {
+        sensor_hub_reading_t r;
+        while (sensor_hub_get_reading(&hub, &r)) {
+            ++counts[r.id];
+            if (r.result < 0)
+                ++failures[r.id];
+            else
+                last[r.id] = r;
+        }
+        if (time_us_64() < next_report) {
+            // Sleep until the next interrupt
+            __wfi();
+            continue;
+        }
+        next_report += 1000000;
+
+        // These are the raw register values; see the individual examples for
+        // how to convert them
+        for (uint i = 0; i < N_SENSORS; ++i) {
+            printf("%-22s %3u/s %3u failed, last:", sensor_names[i], counts[i], failures[i]);
+            for (uint j = 0; j < last[i].len; ++j)
+                printf(" %02x", last[i].data[j]);
+            printf("\n");
+            counts[i] = failures[i] = 0;
+        }
+        sensor_hub_stats_t *s = &hub.stats;
+        printf("bus %2u%% busy, %u reads, %u coalesced, max lateness %d us, %u overruns, %u dropped\n",
+               (uint) (s->busy_us * 100 / (time_us_64() - start_us)), s->reads, s->coalesced, s->max_lateness_us,
+               s->overruns, s->dropped);
+        // Bit 0 of the abort source is set if a device didn't answer to its
+        // address; see the datasheet's IC_TX_ABRT_SOURCE for the rest
+        printf("%u aborted, last abort source %08x\n\n", bus.aborts, bus.abort_source);
+    }
+#endif
+    return 0;
+}
@@ -0,0 +1,324 @@
+/**
+ * Copyright (c) 2022 Raspberry Pi (Trading) Ltd.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+#include <stdio.h>
+#include <string.h>
+#include "pico/stdlib.h"
+#include "sensor_hub.h"
+
+// Runs the sensor hub against a simulated I2C bus, in simulated time, to
+// check the readings it produces and measure how late they are and how busy
+// the bus is. The hub only reaches the bus and the clock through its
+// start_read and set_alarm callbacks, so no I2C hardware is used.
+
+// ----------------------------------------------------------------------------
+// Mock bus: every device is a 256 byte register file. A read takes as long as
+// its bits would at bus_hz, and finishes when the simulation gets there.
+
+typedef struct {
+    uint32_t bus_hz;
+    bool present[128];
+    uint8_t regs[128][256];
+    sensor_hub_t *hub;
+    uint64_t now_us;
+    // The read in progress
+    bool pending;
+    uint64_t done_us;
+    int result;
+    // Requested by the hub, or UINT64_MAX
+    uint64_t alarm_us;
+} mock_bus_t;
+
+static uint64_t mock_duration_us(const mock_bus_t *m, uint bits) {
+    return ((uint64_t) bits * 1000000 + m->bus_hz - 1) / m->bus_hz;
+}
+
+static void mock_start_read(void *ctx, uint8_t addr, uint8_t reg, uint8_t *dst, uint len) {
+    mock_bus_t *m = (mock_bus_t *) ctx;
+    hard_assert(!m->pending);
+    uint bits;
+    if (m->present[addr]) {
+        // Start, address, register, repeated start, address, data, stop
+        bits = 1 + 9 + 9 + 1 + 9 + 9 * len + 1;
+        for (uint i = 0; i < len; ++i)
+            dst[i] = m->regs[addr][(uint8_t) (reg + i)];
+        m->result = 0;
+    } else {
+        // Start, address NAK'd, stop
+        bits = 1 + 9 + 1;
+        m->result = -1;
+    }
+    m->pending = true;
+    m->done_us = m->now_us + mock_duration_us(m, bits);
+}
+
+static void mock_set_alarm(void *ctx, uint64_t at_us) {
+    mock_bus_t *m = (mock_bus_t *) ctx;
+    m->alarm_us = at_us;
+}
+
+static void mock_init(mock_bus_t *m, sensor_hub_t *hub, uint32_t bus_hz, uint32_t coalesce_us) {
+    memset(m, 0, sizeof(*m));
+    m->bus_hz = bus_hz;
+    m->hub = hub;
+    m->alarm_us = UINT64_MAX;
+    // Every device is there unless a test says otherwise, and each register's
+    // contents depend on its device and number
+    for (uint addr = 0; addr < 128; ++addr) {
+        m->present[addr] = true;
+        for (uint reg = 0; reg < 256; ++reg)
+            m->regs[addr][reg] = (uint8_t) (addr * 7 + reg);
+    }
+    sensor_hub_bus_t bus = {
+        .start_read = mock_start_read,
+        .set_alarm = mock_set_alarm,
+        .ctx = m,
+    };
+    sensor_hub_init(hub, &bus, coalesce_us);
+}
+
+// ----------------------------------------------------------------------------
+// Consumer: checks every reading's data against the register files
+
+#define MAX_IDS 16
+
+typedef struct {
+    uint32_t readings[MAX_IDS];
+    uint32_t failed[MAX_IDS];
+    uint32_t bad_data;
+    // Schedule each id came from, to check the data
+    uint8_t addr[MAX_IDS];
+    uint8_t reg[MAX_IDS];
+    uint64_t last_timestamp_us[MAX_IDS];
+    bool out_of_order;
+} consumer_t;
+
+static void consume(consumer_t *c, mock_bus_t *m) {
+    sensor_hub_reading_t r;
+    while (sensor_hub_get_reading(m->hub, &r)) {
+        hard_assert(r.id < MAX_IDS);
+        ++c->readings[r.id];
+        if (r.timestamp_us < c->last_timestamp_us[r.id])
+            c->out_of_order = true;
+        c->last_timestamp_us[r.id] = r.timestamp_us;
+        if (r.result < 0) {
+            ++c->failed[r.id];
+            continue;
+        }
+        for (uint i = 0; i < r.len; ++i) {
+            if (r.data[i] != m->regs[c->addr[r.id]][(uint8_t) (c->reg[r.id] + i)]) {
+                ++c->bad_data;
+                break;
+            }
+        }
+    }
+}
+
+static void add(consumer_t *c, sensor_hub_t *hub, uint8_t id, uint8_t addr, uint8_t reg, uint len, uint32_t period_us,
+                uint flags) {
+    int index = sensor_hub_add(hub, id, addr, reg, len, period_us, flags);
+    hard_assert(index >= 0);
+    c->addr[id] = addr;
+    c->reg[id] = reg;
+}
+
+// Deliver completions and alarms in time order until end_us. The consumer
+// runs after every event if given, otherwise the ring is left to fill up.
+static void run(mock_bus_t *m, consumer_t *c, uint64_t end_us) {
+    sensor_hub_start(m->hub, m->now_us);
+    while (true) {
+        uint64_t next = m->pending ? m->done_us : m->alarm_us;
+        if (next > end_us)
+            break;
+        m->now_us = next;
+        if (m->pending) {
+            m->pending = false;
+            sensor_hub_read_done(m->hub, m->result, m->now_us);
+        } else {
+            m->alarm_us = UINT64_MAX;
+            sensor_hub_poll(m->hub, m->now_us);
+        }
+        if (c)
+            consume(c, m);
+    }
+}
+
+// ----------------------------------------------------------------------------
+
+static sensor_hub_t hub;
+static mock_bus_t mock;
+static uint failures;
+
+static void result(const char *name, bool ok) {
+    printf("%-40s %s\n", name, ok ? "ok" : "FAILED");
+    if (!ok)
+        ++failures;
+}
+
+static bool near(uint32_t count, uint32_t expected) {
+    return count + 1 >= expected && count <= expected + 1;
+}
+
+static void print_stats(const sensor_hub_t *h, uint64_t run_us) {
+    const sensor_hub_stats_t *s = &h->stats;
+    printf("  %u reads, %u readings (%u coalesced), bus %u.%u%% busy, max lateness %d us, %u overruns, %u dropped\n",
+           s->reads, s->readings, s->coalesced, (uint) (s->busy_us * 100 / run_us),
+           (uint) (s->busy_us * 1000 / run_us % 10), s->max_lateness_us, s->overruns, s->dropped);
+}
+
+static void test_coalescing(void) {
+    // The MPU6050's accelerometer and gyro, either side of its temperature
+    static consumer_t c;
+    memset(&c, 0, sizeof(c));
+    mock_init(&mock, &hub, 400000, 500);
+    add(&c, &hub, 0, 0x68, 0x3b, 6, 5000, 0);
+    add(&c, &hub, 1, 0x68, 0x43, 6, 5000, 0);
+    add(&c, &hub, 2, 0x68, 0x41, 2, 100000, 0);
+    run(&mock, &c, 1000000 - 1);
+    const sensor_hub_stats_t *s = &hub.stats;
+    result("coalescing: readings", c.readings[0] == 200 && c.readings[1] == 200 && c.readings[2] == 10);
+    result("coalescing: one read per period", s->reads == 200 && s->coalesced == 410);
+    result("coalescing: data", !c.bad_data && !c.out_of_order);
+    print_stats(&hub, 1000000);
+    sensor_hub_stats_t merged = *s;
+
+    // The same again, with no window
+    memset(&c, 0, sizeof(c));
+    mock_init(&mock, &hub, 400000, 0);
+    add(&c, &hub, 0, 0x68, 0x3b, 6, 5000, 0);
+    add(&c, &hub, 1, 0x68, 0x43, 6, 5000, 0);
+    add(&c, &hub, 2, 0x68, 0x41, 2, 100000, 0);
+    run(&mock, &c, 1000000 - 1);
+    // The bursts are all due at exactly the same time, so they are still
+    // merged with no window at all
+    result("coalescing: due together with no window", s->reads == merged.reads);
+}
+
+static void test_no_coalescing(void) {
+    static consumer_t c;
+    memset(&c, 0, sizeof(c));
+    mock_init(&mock, &hub, 400000, 500);
+    // Too far apart to read in one burst, and on different devices
+    add(&c, &hub, 0, 0x68, 0x00, 16, 10000, 0);
+    add(&c, &hub, 1, 0x68, 0x20, 16, 10000, 0);
+    add(&c, &hub, 2, 0x69, 0x10, 4, 10000, 0);
+    run(&mock, &c, 1000000 - 1);
+    const sensor_hub_stats_t *s = &hub.stats;
+    result("no coalescing: a read per reading", s->reads == 300 && !s->coalesced);
+    result("no coalescing: data", !c.bad_data && c.readings[0] == 100 && c.readings[2] == 100);
+
+    // Close enough to fit in a burst, but with more registers between them
+    // than it's worth reading; then with as many as it is
+    memset(&c, 0, sizeof(c));
+    mock_init(&mock, &hub, 400000, 500);
+    add(&c, &hub, 0, 0x68, 0x00, 6, 10000, 0);
+    add(&c, &hub, 1, 0x68, 0x06 + SENSOR_HUB_MAX_GAP + 1, 6, 10000, 0);
+    run(&mock, &c, 1000000 - 1);
+    result("gaps: too wide to merge", s->reads == 200 && !s->coalesced);
+    memset(&c, 0, sizeof(c));
+    mock_init(&mock, &hub, 400000, 500);
+    add(&c, &hub, 0, 0x68, 0x00, 6, 10000, 0);
+    add(&c, &hub, 1, 0x68, 0x06 + SENSOR_HUB_MAX_GAP, 6, 10000, 0);
+    run(&mock, &c, 1000000 - 1);
+    result("gaps: narrow enough to merge", s->reads == 100 && s->coalesced == 200 && !c.bad_data);
+
+    // The same as the MPU6050 test above, but the temperature registers,
+    // between the other two, must be read on their own, so the other two
+    // can't be read together either
+    memset(&c, 0, sizeof(c));
+    mock_init(&mock, &hub, 400000, 500);
+    add(&c, &hub, 0, 0x68, 0x3b, 6, 5000, 0);
+    add(&c, &hub, 1, 0x68, 0x43, 6, 5000, 0);
+    add(&c, &hub, 2, 0x68, 0x41, 2, 100000, SENSOR_HUB_NO_COALESCE);
+    run(&mock, &c, 1000000 - 1);
+    result("no coalescing: flagged registers", s->reads == 410 && !s->coalesced && !c.bad_data &&
+                                               c.readings[0] == 200 && c.readings[2] == 10);
+}
+
+static void test_mixed_bus(void) {
+    // The devices from sensor_hub_i2c.c
+    static consumer_t c;
+    memset(&c, 0, sizeof(c));
+    mock_init(&mock, &hub, 400000, 1000);
+    add(&c, &hub, 0, 0x76, 0xf7, 6, 20000, 0);
+    add(&c, &hub, 1, 0x68, 0x3b, 6, 5000, 0);
+    add(&c, &hub, 2, 0x68, 0x41, 2, 100000, 0);
+    add(&c, &hub, 3, 0x68, 0x43, 6, 5000, 0);
+    add(&c, &hub, 4, 0x19, 0xa8, 6, 10000, 0);
+    add(&c, &hub, 5, 0x18, 0x05, 2, 250000, 0);
+    add(&c, &hub, 6, 0x60, 0x01, 5, 100000, 0);
+    const uint64_t run_us = 10000000;
+    run(&mock, &c, run_us - 1);
+    static const uint32_t rates[] = {50, 200, 10, 200, 100, 4, 10};
+    bool ok = true;
+    for (uint i = 0; i < count_of(rates); ++i)
+        ok &= near(c.readings[i], rates[i] * (uint32_t) (run_us / 1000000)) && !c.failed[i];
+    result("mixed bus: rates", ok);
+    result("mixed bus: data", !c.bad_data && !c.out_of_order);
+    const sensor_hub_stats_t *s = &hub.stats;
+    // The longest wait is behind one read of each other device
+    result("mixed bus: lateness", s->max_lateness_us < 2000 && !s->overruns && !s->dropped);
+    print_stats(&hub, run_us);
+}
+
+static void test_missing_device(void) {
+    static consumer_t c;
+    memset(&c, 0, sizeof(c));
+    mock_init(&mock, &hub, 400000, 0);
+    mock.present[0x77] = false;
+    add(&c, &hub, 0, 0x76, 0xf7, 6, 10000, 0);
+    add(&c, &hub, 1, 0x77, 0xf7, 6, 10000, 0);
+    run(&mock, &c, 1000000 - 1);
+    result("missing device", c.readings[0] == 100 && !c.failed[0] && c.readings[1] == 100 &&
+                             c.failed[1] == 100 && hub.stats.errors == 100 && !c.bad_data);
+}
+
+static void test_overrun(void) {
+    // Ask for more than a 100 kHz bus can do: each read is 32 + 9 * 16 bits,
+    // 1.8 ms, and eight of them are wanted every millisecond
+    static consumer_t c;
+    memset(&c, 0, sizeof(c));
+    mock_init(&mock, &hub, 100000, 0);
+    for (uint i = 0; i < 8; ++i) {
+        add(&c, &hub, i, 0x10 + i, 0, 16, 1000, 0);
+    }
+    const uint64_t run_us = 1000000;
+    run(&mock, &c, run_us - 1);
+    const sensor_hub_stats_t *s = &hub.stats;
+    bool ok = s->overruns && s->busy_us > run_us * 99 / 100;
+    // Everyone still gets a fair share
+    for (uint i = 0; i < 8; ++i)
+        ok &= near(c.readings[i] * 8, s->readings) || near(c.readings[i], s->readings / 8);
+    result("overrun: bus saturated, shared fairly", ok && !c.bad_data);
+    print_stats(&hub, run_us);
+}
+
+static void test_ring_full(void) {
+    mock_init(&mock, &hub, 400000, 0);
+    sensor_hub_add(&hub, 0, 0x68, 0x3b, 6, 1000, 0);
+    run(&mock, NULL, 1000000 - 1);
+    const sensor_hub_stats_t *s = &hub.stats;
+    bool ok = s->readings == 1000 && s->dropped == 1000 - SENSOR_HUB_RING_SIZE;
+    // The oldest readings are the ones kept
+    sensor_hub_reading_t r;
+    ok &= sensor_hub_get_reading(&hub, &r) && r.timestamp_us < 1000;
+    result("ring full: newest readings dropped", ok);
+}
+
+int main() {
+    stdio_init_all();
+    printf("Sensor hub test\n");
+
+    test_coalescing();
+    test_no_coalescing();
+    test_mixed_bus();
+    test_missing_device();
+    test_overrun();
+    test_ring_full();
+
+    printf(failures ? "FAILED\n" : "All good\n");
+    return failures ? 1 : 0;
+}
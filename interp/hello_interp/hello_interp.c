@@ -8,6 +8,10 @@
 #include "pico/stdlib.h"
 #include "hardware/interp.h"
 
+// Everything here goes through the hardware_interp functions rather than the
+// registers, so that it also runs on the host (PICO_PLATFORM=host), on the
+// software interpolator in ../interp_emu.
+
 void times_table() {
     puts("9 times table:");
 
@@ -15,25 +19,25 @@ void times_table() {
     interp_config cfg = interp_default_config();
     interp_set_config(interp0, 0, &cfg);
 
-    interp0->accum[0] = 0;
-    interp0->base[0] = 9;
+    interp_set_accumulator(interp0, 0, 0);
+    interp_set_base(interp0, 0, 9);
 
     for (int i = 0; i < 10; ++i)
-        printf("%d\n", interp0->pop[0]);
+        printf("%d\n", (int) interp_pop_lane_result(interp0, 0));
 }
 
 void moving_mask() {
     interp_config cfg = interp_default_config();
-    interp0->accum[0] = 0x1234abcd;
+    interp_set_accumulator(interp0, 0, 0x1234abcd);
 
     puts("Masking:");
-    printf("ACCUM0 = %08x\n", interp0->accum[0]);
+    printf("ACCUM0 = %08x\n", interp_get_accumulator(interp0, 0));
     for (int i = 0; i < 8; ++i) {
         // LSB, then MSB. These are inclusive, so 0,31 means "the entire 32 bit register"
         interp_config_set_mask(&cfg, i * 4, i * 4 + 3);
         interp_set_config(interp0, 0, &cfg);
         // Reading from ACCUMx_ADD returns the raw lane shift and mask value, without BASEx added
-        printf("Nibble %d: %08x\n", i, interp0->add_raw[0]);
+        printf("Nibble %d: %08x\n", i, interp_get_raw(interp0, 0));
     }
 
     puts("Masking with sign extension:");
@@ -41,7 +45,7 @@ void moving_mask() {
     for (int i = 0; i < 8; ++i) {
         interp_config_set_mask(&cfg, i * 4, i * 4 + 3);
         interp_set_config(interp0, 0, &cfg);
-        printf("Nibble %d: %08x\n", i, interp0->add_raw[0]);
+        printf("Nibble %d: %08x\n", i, interp_get_raw(interp0, 0));
     }
 }
 
@@ -53,13 +57,17 @@ void cross_lanes() {
     // ACCUM1 gets lane 0 result:
     interp_set_config(interp0, 1, &cfg);
 
-    interp0->accum[0] = 123;
-    interp0->accum[1] = 456;
-    interp0->base[0] = 1;
-    interp0->base[1] = 0;
+    interp_set_accumulator(interp0, 0, 123);
+    interp_set_accumulator(interp0, 1, 456);
+    interp_set_base(interp0, 0, 1);
+    interp_set_base(interp0, 1, 0);
     puts("Lane result crossover:");
-    for (int i = 0; i < 10; ++i)
-        printf("PEEK0, POP1: %d, %d\n", interp0->peek[0], interp0->pop[1]);
+    for (int i = 0; i < 10; ++i) {
+        // Peek before popping (the order of evaluation of printf's arguments is unspecified)
+        int peek0 = (int) interp_peek_lane_result(interp0, 0);
+        int pop1 = (int) interp_pop_lane_result(interp0, 1);
+        printf("PEEK0, POP1: %d, %d\n", peek0, pop1);
+    }
 }
 
 void simple_blend1() {
@@ -72,14 +80,14 @@ void simple_blend1() {
     cfg = interp_default_config();
     interp_set_config(interp0, 1, &cfg);
 
-    interp0->base[0] = 500;
-    interp0->base[1] = 1000;
+    interp_set_base(interp0, 0, 500);
+    interp_set_base(interp0, 1, 1000);
 
     for (int i = 0; i <= 6; i++) {
         // set fraction to value between 0 and 255
-        interp0->accum[1] = 255 * i / 6;
+        interp_set_accumulator(interp0, 1, 255 * i / 6);
         // ≈ 500 + (1000 - 500) * i / 6;
-        printf("%d\n", (int) interp0->peek[1]);
+        printf("%d\n", (int) interp_peek_lane_result(interp0, 1));
     }
 }
 
@@ -91,11 +99,11 @@ void print_simple_blend2_results(bool is_signed) {
     interp_set_config(interp0, 1, &cfg);
 
     for (int i = 0; i <= 6; i++) {
-        interp0->accum[1] = 255 * i / 6;
+        interp_set_accumulator(interp0, 1, 255 * i / 6);
         if (is_signed) {
-            printf("%d\n", (int) interp0->peek[1]);
+            printf("%d\n", (int) interp_peek_lane_result(interp0, 1));
         } else {
-            printf("0x%08x\n", (uint) interp0->peek[1]);
+            printf("0x%08x\n", (uint) interp_peek_lane_result(interp0, 1));
         }
     }
 }
@@ -107,8 +115,8 @@ void simple_blend2() {
     interp_config_set_blend(&cfg, true);
     interp_set_config(interp0, 0, &cfg);
 
-    interp0->base[0] = -1000;
-    interp0->base[1] = 1000;
+    interp_set_base(interp0, 0, -1000);
+    interp_set_base(interp0, 1, 1000);
 
     puts("signed:");
     print_simple_blend2_results(true);
@@ -128,17 +136,17 @@ void simple_blend3() {
     cfg = interp_default_config();
     interp_set_config(interp0, 1, &cfg);
 
-    interp0->accum[1] = 128;
-    interp0->base01 = 0x30005000;
-    printf("0x%08x\n", (int) interp0->peek[1]);
-    interp0->base01 = 0xe000f000;
-    printf("0x%08x\n", (int) interp0->peek[1]);
+    interp_set_accumulator(interp0, 1, 128);
+    interp_set_base_both(interp0, 0x30005000);
+    printf("0x%08x\n", (int) interp_peek_lane_result(interp0, 1));
+    interp_set_base_both(interp0, 0xe000f000);
+    printf("0x%08x\n", (int) interp_peek_lane_result(interp0, 1));
 
     interp_config_set_signed(&cfg, true);
     interp_set_config(interp0, 1, &cfg);
 
-    interp0->base01 = 0xe000f000;
-    printf("0x%08x\n", (int) interp0->peek[1]);
+    interp_set_base_both(interp0, 0xe000f000);
+    printf("0x%08x\n", (int) interp_peek_lane_result(interp0, 1));
 }
 
 void linear_interpolation() {
@@ -170,18 +178,18 @@ void linear_interpolation() {
     // step is 1/4 in our fractional representation
     uint step = (1 << uv_fractional_bits) / 4;
 
-    interp0->accum[0] = 0; // initial sample_offset;
-    interp0->base[2] = (uintptr_t) samples;
+    interp_set_accumulator(interp0, 0, 0); // initial sample_offset;
+    interp_set_base(interp0, 2, (uintptr_t) samples);
     for (int i = 0; i < 16; i++) {
         // result2 = samples + (lane0 raw result)
         // i.e. ptr to the first of two samples to blend between
-        int16_t *sample_pair = (int16_t *) interp0->peek[2];
-        interp0->base[0] = sample_pair[0];
-        interp0->base[1] = sample_pair[1];
-        printf("%d\t(%d%% between %d and %d)\n", (int) interp0->peek[1],
-               100 * (interp0->add_raw[1] & 0xff) / 0xff,
+        int16_t *sample_pair = (int16_t *) interp_peek_full_result(interp0);
+        interp_set_base(interp0, 0, sample_pair[0]);
+        interp_set_base(interp0, 1, sample_pair[1]);
+        printf("%d\t(%d%% between %d and %d)\n", (int) interp_peek_lane_result(interp0, 1),
+               100 * (interp_get_raw(interp0, 1) & 0xff) / 0xff,
                sample_pair[0], sample_pair[1]);
-        interp0->add_raw[0] = step;
+        interp_add_accumulater(interp0, 0, step);
     }
 }
 
@@ -196,12 +204,12 @@ void clamp() {
     interp_config_set_signed(&cfg, true);
     interp_set_config(interp1, 0, &cfg);
 
-    interp1->base[0] = 0;
-    interp1->base[1] = 255;
+    interp_set_base(interp1, 0, 0);
+    interp_set_base(interp1, 1, 255);
 
     for (int i = -1024; i <= 1024; i += 256) {
-        interp1->accum[0] = i;
-        printf("%d\t%d\n", i, (int) interp1->peek[0]);
+        interp_set_accumulator(interp1, 0, i);
+        printf("%d\t%d\n", i, (int) interp_peek_lane_result(interp1, 0));
     }
 }
 
@@ -220,16 +228,16 @@ void texture_mapping_setup(uint8_t *texture, uint texture_width_bits, uint textu
     interp_config_set_mask(&cfg, texture_width_bits, texture_width_bits + texture_height_bits - 1);
     interp_set_config(interp0, 1, &cfg);
 
-    interp0->base[2] = (uintptr_t) texture;
+    interp_set_base(interp0, 2, (uintptr_t) texture);
 }
 
 void texture_mapped_span(uint8_t *output, uint32_t u, uint32_t v, uint32_t du, uint32_t dv, uint count) {
     // u, v are texture coordinates in fixed point with uv_fractional_bits fractional bits
     // du, dv are texture coordinate steps across the span in same fixed point.
-    interp0->accum[0] = u;
-    interp0->base[0] = du;
-    interp0->accum[1] = v;
-    interp0->base[1] = dv;
+    interp_set_accumulator(interp0, 0, u);
+    interp_set_base(interp0, 0, du);
+    interp_set_accumulator(interp0, 1, v);
+    interp_set_base(interp0, 1, dv);
     for (uint i = 0; i < count; i++) {
         // equivalent to
         // uint32_t sm_result0 = (accum0 >> uv_fractional_bits) & (1 << (texture_width_bits - 1);
@@ -241,7 +249,7 @@ void texture_mapped_span(uint8_t *output, uint32_t u, uint32_t v, uint32_t du, u
 
         // result2 is the texture address for the current pixel;
         // popping the result advances to the next iteration
-        output[i] = *(uint8_t *) interp0->pop[2];
+        output[i] = *(uint8_t *) interp_pop_full_result(interp0);
     }
 }
 
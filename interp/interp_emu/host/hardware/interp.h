@@ -0,0 +1,205 @@
+/**
+ * Copyright (c) 2022 Raspberry Pi (Trading) Ltd.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+#ifndef _HARDWARE_INTERP_H
+#define _HARDWARE_INTERP_H
+
+#include "interp_emu.h"
+
+// The hardware_interp API for PICO_PLATFORM=host builds, running on the
+// software interpolators in interp_emu.c.
+//
+// Only the function API is available: register accesses such as
+// interp0->pop[2] have side effects that plain C structs can't reproduce, so
+// use interp_pop_full_result(interp0) etc. instead (which compile to the same
+// code on the device). BASE2 and the full result are pointer sized here, so
+// (uintptr_t) casts of pointers work as they do on the device.
+
+typedef interp_emu_t interp_hw_t;
+
+extern interp_emu_t interp_emu_hw[2];
+
+#define interp0 (&interp_emu_hw[0])
+#define interp1 (&interp_emu_hw[1])
+
+typedef struct {
+    uint32_t ctrl;
+} interp_config;
+
+typedef struct {
+    uint32_t accum[2];
+    uint32_t base[3];
+    uint32_t ctrl[2];
+} interp_hw_save_t;
+
+static inline uint interp_index(interp_hw_t *interp) {
+    return interp->num;
+}
+
+// One bit per lane, interp0 lane 0 first. There is only one set of
+// interpolators on the host, not one per core.
+extern uint8_t interp_emu_claimed;
+
+static inline void interp_claim_lane(interp_hw_t *interp, uint lane) {
+    uint bit = 1u << (interp_index(interp) * 2 + lane);
+    hard_assert(!(interp_emu_claimed & bit));
+    interp_emu_claimed |= bit;
+}
+
+static inline void interp_claim_lane_mask(interp_hw_t *interp, uint lane_mask) {
+    for (uint lane = 0; lane < 2; ++lane)
+        if (lane_mask & (1u << lane))
+            interp_claim_lane(interp, lane);
+}
+
+static inline void interp_unclaim_lane(interp_hw_t *interp, uint lane) {
+    interp_emu_claimed &= ~(1u << (interp_index(interp) * 2 + lane));
+}
+
+static inline bool interp_lane_is_claimed(interp_hw_t *interp, uint lane) {
+    return interp_emu_claimed & (1u << (interp_index(interp) * 2 + lane));
+}
+
+static inline void interp_unclaim_lane_mask(interp_hw_t *interp, uint lane_mask) {
+    for (uint lane = 0; lane < 2; ++lane)
+        if (lane_mask & (1u << lane))
+            interp_unclaim_lane(interp, lane);
+}
+
+static inline void interp_config_set_shift(interp_config *c, uint shift) {
+    hard_assert(shift < 32);
+    c->ctrl = (c->ctrl & ~INTERP_EMU_CTRL_SHIFT_BITS) | (shift << INTERP_EMU_CTRL_SHIFT_LSB);
+}
+
+static inline void interp_config_set_mask(interp_config *c, uint mask_lsb, uint mask_msb) {
+    hard_assert(mask_msb < 32 && mask_lsb <= mask_msb);
+    c->ctrl = (c->ctrl & ~(INTERP_EMU_CTRL_MASK_LSB_BITS | INTERP_EMU_CTRL_MASK_MSB_BITS)) |
+              (mask_lsb << INTERP_EMU_CTRL_MASK_LSB_LSB) | (mask_msb << INTERP_EMU_CTRL_MASK_MSB_LSB);
+}
+
+static inline void interp_config_set_flag(interp_config *c, uint32_t bits, bool value) {
+    c->ctrl = value ? c->ctrl | bits : c->ctrl & ~bits;
+}
+
+static inline void interp_config_set_cross_input(interp_config *c, bool cross_input) {
+    interp_config_set_flag(c, INTERP_EMU_CTRL_CROSS_INPUT_BITS, cross_input);
+}
+
+static inline void interp_config_set_cross_result(interp_config *c, bool cross_result) {
+    interp_config_set_flag(c, INTERP_EMU_CTRL_CROSS_RESULT_BITS, cross_result);
+}
+
+static inline void interp_config_set_signed(interp_config *c, bool _signed) {
+    interp_config_set_flag(c, INTERP_EMU_CTRL_SIGNED_BITS, _signed);
+}
+
+static inline void interp_config_set_add_raw(interp_config *c, bool add_raw) {
+    interp_config_set_flag(c, INTERP_EMU_CTRL_ADD_RAW_BITS, add_raw);
+}
+
+static inline void interp_config_set_blend(interp_config *c, bool blend) {
+    interp_config_set_flag(c, INTERP_EMU_CTRL_BLEND_BITS, blend);
+}
+
+static inline void interp_config_set_clamp(interp_config *c, bool clamp) {
+    interp_config_set_flag(c, INTERP_EMU_CTRL_CLAMP_BITS, clamp);
+}
+
+static inline void interp_config_set_force_bits(interp_config *c, uint bits) {
+    hard_assert(bits <= 3);
+    c->ctrl = (c->ctrl & ~INTERP_EMU_CTRL_FORCE_MSB_BITS) | (bits << INTERP_EMU_CTRL_FORCE_MSB_LSB);
+}
+
+static inline interp_config interp_default_config(void) {
+    interp_config c = {0};
+    // Just pass through everything
+    interp_config_set_mask(&c, 0, 31);
+    return c;
+}
+
+static inline void interp_set_config(interp_hw_t *interp, uint lane, interp_config *config) {
+    hard_assert(lane < 2);
+    // As on the device: blend is lane 0 of interp0 only, and clamp is lane 0
+    // of interp1 only
+    hard_assert(!(config->ctrl & INTERP_EMU_CTRL_BLEND_BITS) || (lane == 0 && interp_index(interp) == 0));
+    hard_assert(!(config->ctrl & INTERP_EMU_CTRL_CLAMP_BITS) || (lane == 0 && interp_index(interp) == 1));
+    interp_emu_set_ctrl(interp, lane, config->ctrl);
+}
+
+static inline void interp_set_force_bits(interp_hw_t *interp, uint lane, uint bits) {
+    interp_emu_set_ctrl(interp, lane, (interp->ctrl[lane] & ~INTERP_EMU_CTRL_FORCE_MSB_BITS) |
+                                      (bits << INTERP_EMU_CTRL_FORCE_MSB_LSB));
+}
+
+static inline void interp_save(interp_hw_t *interp, interp_hw_save_t *saver) {
+    saver->accum[0] = interp->accum[0];
+    saver->accum[1] = interp->accum[1];
+    saver->base[0] = interp->base[0];
+    saver->base[1] = interp->base[1];
+    saver->base[2] = (uint32_t) interp->base2;
+    saver->ctrl[0] = interp->ctrl[0];
+    saver->ctrl[1] = interp->ctrl[1];
+}
+
+static inline void interp_restore(interp_hw_t *interp, interp_hw_save_t *saver) {
+    interp->accum[0] = saver->accum[0];
+    interp->accum[1] = saver->accum[1];
+    interp->base[0] = saver->base[0];
+    interp->base[1] = saver->base[1];
+    interp->base2 = saver->base[2];
+    interp->ctrl[0] = saver->ctrl[0];
+    interp->ctrl[1] = saver->ctrl[1];
+}
+
+static inline void interp_set_base(interp_hw_t *interp, uint lane, uintptr_t val) {
+    if (lane == 2)
+        interp->base2 = val;
+    else
+        interp->base[lane] = (uint32_t) val;
+}
+
+static inline uintptr_t interp_get_base(interp_hw_t *interp, uint lane) {
+    return lane == 2 ? interp->base2 : interp->base[lane];
+}
+
+static inline void interp_set_base_both(interp_hw_t *interp, uint32_t val) {
+    interp_emu_set_base_both(interp, val);
+}
+
+static inline void interp_set_accumulator(interp_hw_t *interp, uint lane, uint32_t val) {
+    interp->accum[lane] = val;
+}
+
+static inline uint32_t interp_get_accumulator(interp_hw_t *interp, uint lane) {
+    return interp->accum[lane];
+}
+
+static inline uintptr_t interp_pop_lane_result(interp_hw_t *interp, uint lane) {
+    return lane == 2 ? interp_emu_pop_full(interp) : interp_emu_pop_lane(interp, lane);
+}
+
+static inline uintptr_t interp_peek_lane_result(interp_hw_t *interp, uint lane) {
+    return lane == 2 ? interp_emu_peek_full(interp) : interp_emu_peek_lane(interp, lane);
+}
+
+static inline uintptr_t interp_pop_full_result(interp_hw_t *interp) {
+    return interp_emu_pop_full(interp);
+}
+
+static inline uintptr_t interp_peek_full_result(interp_hw_t *interp) {
+    return interp_emu_peek_full(interp);
+}
+
+// (sic) as in the SDK
+static inline void interp_add_accumulater(interp_hw_t *interp, uint lane, uint32_t val) {
+    interp_emu_add_accumulator(interp, lane, val);
+}
+
+static inline uint32_t interp_get_raw(interp_hw_t *interp, uint lane) {
+    return interp_emu_get_raw(interp, lane);
+}
+
+#endif
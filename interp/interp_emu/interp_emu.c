@@ -0,0 +1,163 @@
+/**
+ * Copyright (c) 2022 Raspberry Pi (Trading) Ltd.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+#include "interp_emu.h"
+
+#if !PICO_ON_DEVICE
+#include "hardware/interp.h"
+
+// interp0 and interp1 on the host. There is only one set, not one per core.
+interp_emu_t interp_emu_hw[2] = {
+    {.num = 0},
+    {.num = 1},
+};
+
+uint8_t interp_emu_claimed;
+#endif
+
+typedef struct {
+    uint32_t lane[2];
+    uintptr_t full;
+} interp_emu_results_t;
+
+void interp_emu_init(interp_emu_t *e, uint num) {
+    e->accum[0] = e->accum[1] = 0;
+    e->base[0] = e->base[1] = 0;
+    e->base2 = 0;
+    e->ctrl[0] = e->ctrl[1] = 0;
+    e->num = num;
+}
+
+void interp_emu_set_ctrl(interp_emu_t *e, uint lane, uint32_t ctrl) {
+    uint32_t mode_bits = 0;
+    if (lane == 0)
+        mode_bits = e->num == 0 ? INTERP_EMU_CTRL_BLEND_BITS : INTERP_EMU_CTRL_CLAMP_BITS;
+    e->ctrl[lane] = ctrl & (INTERP_EMU_CTRL_SHIFT_BITS | INTERP_EMU_CTRL_MASK_LSB_BITS |
+                            INTERP_EMU_CTRL_MASK_MSB_BITS | INTERP_EMU_CTRL_SIGNED_BITS |
+                            INTERP_EMU_CTRL_CROSS_INPUT_BITS | INTERP_EMU_CTRL_CROSS_RESULT_BITS |
+                            INTERP_EMU_CTRL_ADD_RAW_BITS | INTERP_EMU_CTRL_FORCE_MSB_BITS | mode_bits);
+}
+
+static inline uint32_t lane_input(const interp_emu_t *e, uint lane) {
+    return e->accum[e->ctrl[lane] & INTERP_EMU_CTRL_CROSS_INPUT_BITS ? 1 - lane : lane];
+}
+
+// Logical right shift, then mask, then sign extend from the top of the mask
+static uint32_t lane_shift_mask(const interp_emu_t *e, uint lane) {
+    uint32_t ctrl = e->ctrl[lane];
+    uint shift = (ctrl & INTERP_EMU_CTRL_SHIFT_BITS) >> INTERP_EMU_CTRL_SHIFT_LSB;
+    uint lsb = (ctrl & INTERP_EMU_CTRL_MASK_LSB_BITS) >> INTERP_EMU_CTRL_MASK_LSB_LSB;
+    uint msb = (ctrl & INTERP_EMU_CTRL_MASK_MSB_BITS) >> INTERP_EMU_CTRL_MASK_MSB_LSB;
+    uint32_t upto_msb = 0xffffffffu >> (31 - msb);
+    uint32_t val = (lane_input(e, lane) >> shift) & upto_msb & (0xffffffffu << lsb);
+    if ((ctrl & INTERP_EMU_CTRL_SIGNED_BITS) && (val >> msb & 1u))
+        val |= ~upto_msb;
+    return val;
+}
+
+static inline bool lane_signed(const interp_emu_t *e, uint lane) {
+    return e->ctrl[lane] & INTERP_EMU_CTRL_SIGNED_BITS;
+}
+
+static void evaluate(const interp_emu_t *e, interp_emu_results_t *r) {
+    uint32_t sm[2];
+    for (uint lane = 0; lane < 2; ++lane) {
+        sm[lane] = lane_shift_mask(e, lane);
+        uint32_t addend = e->ctrl[lane] & INTERP_EMU_CTRL_ADD_RAW_BITS ? lane_input(e, lane) : sm[lane];
+        r->lane[lane] = addend + e->base[lane];
+    }
+    // ADD_RAW doesn't affect the full result. The 32-bit sum is sign extended
+    // so that a pointer in BASE2 can be offset in either direction.
+    uint32_t full_offset = sm[0] + sm[1];
+
+    if (e->ctrl[0] & INTERP_EMU_CTRL_BLEND_BITS) {
+        // Lane 1 interpolates between BASE0 and BASE1 by the low 8 bits of its
+        // shift and mask value, signed or unsigned according to lane 1.
+        // Lane 0 gives just those 8 bits, and the full result leaves them out.
+        uint32_t alpha = sm[1] & 0xffu;
+        int64_t b0, b1;
+        if (lane_signed(e, 1)) {
+            b0 = (int32_t) e->base[0];
+            b1 = (int32_t) e->base[1];
+        } else {
+            b0 = e->base[0];
+            b1 = e->base[1];
+        }
+        // Arithmetic shift, i.e. rounding towards minus infinity
+        r->lane[1] = (uint32_t) (b0 + (((b1 - b0) * (int64_t) alpha) >> 8));
+        r->lane[0] = alpha;
+        full_offset = sm[0];
+    } else if (e->ctrl[0] & INTERP_EMU_CTRL_CLAMP_BITS) {
+        // Lane 0 is its shift and mask value, clamped to BASE0 .. BASE1
+        if (lane_signed(e, 0)) {
+            int32_t v = (int32_t) sm[0];
+            if (v < (int32_t) e->base[0])
+                v = (int32_t) e->base[0];
+            if (v > (int32_t) e->base[1])
+                v = (int32_t) e->base[1];
+            r->lane[0] = (uint32_t) v;
+        } else {
+            uint32_t v = sm[0];
+            if (v < e->base[0])
+                v = e->base[0];
+            if (v > e->base[1])
+                v = e->base[1];
+            r->lane[0] = v;
+        }
+    }
+    r->full = e->base2 + (uintptr_t) (intptr_t) (int32_t) full_offset;
+}
+
+static inline uint32_t force_bits(const interp_emu_t *e, uint lane, uint32_t val) {
+    // FORCE_MSB only affects what the processor sees, not the writeback
+    return val | (e->ctrl[lane] & INTERP_EMU_CTRL_FORCE_MSB_BITS) << (28 - INTERP_EMU_CTRL_FORCE_MSB_LSB);
+}
+
+static void write_back(interp_emu_t *e, const interp_emu_results_t *r) {
+    e->accum[0] = r->lane[e->ctrl[0] & INTERP_EMU_CTRL_CROSS_RESULT_BITS ? 1 : 0];
+    e->accum[1] = r->lane[e->ctrl[1] & INTERP_EMU_CTRL_CROSS_RESULT_BITS ? 0 : 1];
+}
+
+uint32_t interp_emu_peek_lane(interp_emu_t *e, uint lane) {
+    interp_emu_results_t r;
+    evaluate(e, &r);
+    return force_bits(e, lane, r.lane[lane]);
+}
+
+uint32_t interp_emu_pop_lane(interp_emu_t *e, uint lane) {
+    interp_emu_results_t r;
+    evaluate(e, &r);
+    write_back(e, &r);
+    return force_bits(e, lane, r.lane[lane]);
+}
+
+uintptr_t interp_emu_peek_full(interp_emu_t *e) {
+    interp_emu_results_t r;
+    evaluate(e, &r);
+    return r.full;
+}
+
+uintptr_t interp_emu_pop_full(interp_emu_t *e) {
+    interp_emu_results_t r;
+    evaluate(e, &r);
+    write_back(e, &r);
+    return r.full;
+}
+
+uint32_t interp_emu_get_raw(interp_emu_t *e, uint lane) {
+    return lane_shift_mask(e, lane);
+}
+
+void interp_emu_set_base_both(interp_emu_t *e, uint32_t val) {
+    uint32_t lo = val & 0xffffu;
+    uint32_t hi = val >> 16;
+    if (lane_signed(e, 0) && (lo & 0x8000u))
+        lo |= 0xffff0000u;
+    if (lane_signed(e, 1) && (hi & 0x8000u))
+        hi |= 0xffff0000u;
+    e->base[0] = lo;
+    e->base[1] = hi;
+}
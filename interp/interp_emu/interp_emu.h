@@ -0,0 +1,80 @@
+/**
+ * Copyright (c) 2022 Raspberry Pi (Trading) Ltd.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+#ifndef _INTERP_EMU_H
+#define _INTERP_EMU_H
+
+#include "pico.h"
+
+// A software model of one RP2040 interpolator, for running (and testing)
+// interp-based code where there is no interpolator, i.e. on the host.
+//
+// The model covers the lane datapath from the datasheet: shift, mask and sign
+// extension, cross input and cross result, ADD_RAW, FORCE_MSB, blend mode
+// (interpolator 0 only) and clamp mode (interpolator 1 only), with PEEK, POP,
+// ACCUMx_ADD and BASE_1AND0 behaving as the registers do. The read-only
+// overflow flags in CTRL are not modelled.
+//
+// CTRL words use the hardware bit layout, so a config built with the SDK's
+// interp_config functions can be passed straight in. On a PICO_PLATFORM=host
+// build, host/hardware/interp.h puts the SDK's hardware_interp API on top of
+// this, so the same source runs on both.
+
+#define INTERP_EMU_CTRL_SHIFT_LSB 0
+#define INTERP_EMU_CTRL_SHIFT_BITS 0x0000001fu
+#define INTERP_EMU_CTRL_MASK_LSB_LSB 5
+#define INTERP_EMU_CTRL_MASK_LSB_BITS 0x000003e0u
+#define INTERP_EMU_CTRL_MASK_MSB_LSB 10
+#define INTERP_EMU_CTRL_MASK_MSB_BITS 0x00007c00u
+#define INTERP_EMU_CTRL_SIGNED_BITS 0x00008000u
+#define INTERP_EMU_CTRL_CROSS_INPUT_BITS 0x00010000u
+#define INTERP_EMU_CTRL_CROSS_RESULT_BITS 0x00020000u
+#define INTERP_EMU_CTRL_ADD_RAW_BITS 0x00040000u
+#define INTERP_EMU_CTRL_FORCE_MSB_LSB 19
+#define INTERP_EMU_CTRL_FORCE_MSB_BITS 0x00180000u
+#define INTERP_EMU_CTRL_BLEND_BITS 0x00200000u // lane 0 of interpolator 0 only
+#define INTERP_EMU_CTRL_CLAMP_BITS 0x00400000u // lane 0 of interpolator 1 only
+
+typedef struct {
+    uint32_t accum[2];
+    uint32_t base[2];
+    // BASE2 is pointer sized, so that on a 64-bit host the full result can
+    // still be a pointer. The low 32 bits of the full result always match the
+    // hardware.
+    uintptr_t base2;
+    uint32_t ctrl[2];
+    // 0 or 1, which decides whether blend or clamp mode is present
+    uint num;
+} interp_emu_t;
+
+void interp_emu_init(interp_emu_t *e, uint num);
+
+// Write a lane's CTRL register. Bits for modes this lane doesn't have are
+// dropped, as the hardware does.
+void interp_emu_set_ctrl(interp_emu_t *e, uint lane, uint32_t ctrl);
+
+// Read PEEKx / POPx for lane 0 or 1. POP writes both lane results back to the
+// accumulators.
+uint32_t interp_emu_peek_lane(interp_emu_t *e, uint lane);
+uint32_t interp_emu_pop_lane(interp_emu_t *e, uint lane);
+
+// Read PEEK2 / POP2 (the full result)
+uintptr_t interp_emu_peek_full(interp_emu_t *e);
+uintptr_t interp_emu_pop_full(interp_emu_t *e);
+
+// Read ACCUMx_ADD: the lane's shift and mask value, without BASEx added
+uint32_t interp_emu_get_raw(interp_emu_t *e, uint lane);
+
+// Write ACCUMx_ADD
+static inline void interp_emu_add_accumulator(interp_emu_t *e, uint lane, uint32_t val) {
+    e->accum[lane] += val;
+}
+
+// Write BASE_1AND0: the low half to BASE0 and the high half to BASE1, each
+// sign extended if that lane is signed
+void interp_emu_set_base_both(interp_emu_t *e, uint32_t val);
+
+#endif
@@ -0,0 +1,263 @@
+/**
+ * Copyright (c) 2022 Raspberry Pi (Trading) Ltd.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+#include <stdio.h>
+#include "pico/stdlib.h"
+#include "hardware/interp.h"
+#include "interp_emu.h"
+#include "test_rand.h"
+
+// Two things:
+//
+// - Check the software interpolator in interp_emu.c. On the device, random
+//   configurations and values are run through the real interp0 and interp1
+//   and through the model, and every result compared. On the host (where
+//   hardware/interp.h is the model) a few results from hello_interp are
+//   checked instead.
+//
+// - Time texture_mapped_span() from hello_interp against a plain C version,
+//   to see what the interpolator buys. On the host the interpolator version
+//   runs on the model, so only the device numbers mean anything.
+
+#define TEXTURE_BITS 8
+#define UV_FRACTIONAL_BITS 16
+#define SPAN_LENGTH 1024
+#define SPANS 64
+
+static uint8_t texture[1u << (2 * TEXTURE_BITS)];
+static uint8_t span[SPAN_LENGTH];
+static uint8_t ref_span[SPAN_LENGTH];
+
+// ----------------------------------------------------------------------------
+// Model checks
+
+#if PICO_ON_DEVICE
+static uint32_t random_ctrl(uint lane, uint num) {
+    uint lsb = next_rand() % 32;
+    uint msb = lsb + next_rand() % (32 - lsb);
+    uint32_t ctrl = (next_rand() % 32) << INTERP_EMU_CTRL_SHIFT_LSB |
+                    lsb << INTERP_EMU_CTRL_MASK_LSB_LSB |
+                    msb << INTERP_EMU_CTRL_MASK_MSB_LSB;
+    ctrl |= next_rand() & (INTERP_EMU_CTRL_SIGNED_BITS | INTERP_EMU_CTRL_CROSS_INPUT_BITS |
+                           INTERP_EMU_CTRL_CROSS_RESULT_BITS | INTERP_EMU_CTRL_ADD_RAW_BITS |
+                           INTERP_EMU_CTRL_FORCE_MSB_BITS);
+    // Blend or clamp on a quarter of lane 0 configs
+    if (lane == 0 && !(next_rand() & 3))
+        ctrl |= num ? INTERP_EMU_CTRL_CLAMP_BITS : INTERP_EMU_CTRL_BLEND_BITS;
+    return ctrl;
+}
+
+static uint check_against_hardware(interp_hw_t *interp, uint num, uint iterations) {
+    interp_emu_t emu;
+    interp_emu_init(&emu, num);
+    uint errors = 0;
+    for (uint i = 0; i < iterations; ++i) {
+        for (uint lane = 0; lane < 2; ++lane) {
+            uint32_t ctrl = random_ctrl(lane, num);
+            interp->ctrl[lane] = ctrl;
+            interp_emu_set_ctrl(&emu, lane, ctrl);
+            emu.accum[lane] = interp->accum[lane] = next_rand();
+            emu.base[lane] = interp->base[lane] = next_rand();
+        }
+        emu.base2 = interp->base[2] = next_rand();
+        if (next_rand() & 1) {
+            uint32_t both = next_rand();
+            interp->base01 = both;
+            interp_emu_set_base_both(&emu, both);
+        }
+        // A few pops in a row, to check the writeback too
+        for (uint step = 0; step < 4; ++step) {
+            uint32_t hw[7] = {
+                interp->peek[0], interp->peek[1], interp->peek[2], interp->add_raw[0], interp->add_raw[1],
+            };
+            uint32_t sw[7] = {
+                interp_emu_peek_lane(&emu, 0), interp_emu_peek_lane(&emu, 1), (uint32_t) interp_emu_peek_full(&emu),
+                interp_emu_get_raw(&emu, 0), interp_emu_get_raw(&emu, 1),
+            };
+            uint pop_lane = next_rand() % 3;
+            hw[5] = interp->pop[pop_lane];
+            sw[5] = pop_lane == 2 ? (uint32_t) interp_emu_pop_full(&emu) : interp_emu_pop_lane(&emu, pop_lane);
+            hw[6] = interp->accum[0] ^ interp->accum[1] << 1;
+            sw[6] = emu.accum[0] ^ emu.accum[1] << 1;
+            for (uint j = 0; j < count_of(hw); ++j) {
+                if (hw[j] != sw[j]) {
+                    if (errors < 8)
+                        printf("  interp%u ctrl %08x %08x, value %u: hardware %08x, model %08x\n", num,
+                               emu.ctrl[0], emu.ctrl[1], j, hw[j], sw[j]);
+                    ++errors;
+                }
+            }
+        }
+    }
+    printf("interp%u: %u random configurations, %u mismatches\n", num, iterations, errors);
+    return errors;
+}
+
+static uint check_model(void) {
+    seed_rand(0x12345678);
+    return check_against_hardware(interp0, 0, 20000) + check_against_hardware(interp1, 1, 20000);
+}
+#else
+static uint expect(const char *what, uint32_t value, uint32_t expected) {
+    if (value == expected)
+        return 0;
+    printf("  %s: %08x, expected %08x\n", what, value, expected);
+    return 1;
+}
+
+// Results from hello_interp
+static uint check_model(void) {
+    uint errors = 0;
+    interp_config cfg = interp_default_config();
+    interp_set_config(interp0, 0, &cfg);
+    interp_set_accumulator(interp0, 0, 0);
+    interp_set_base(interp0, 0, 9);
+    for (uint i = 1; i <= 10; ++i)
+        errors += expect("times table", interp_pop_lane_result(interp0, 0), 9 * i);
+
+    interp_set_accumulator(interp0, 0, 0x1234abcd);
+    interp_config_set_mask(&cfg, 12, 15);
+    interp_set_config(interp0, 0, &cfg);
+    errors += expect("nibble 3", interp_get_raw(interp0, 0), 0x0000a000);
+    interp_config_set_signed(&cfg, true);
+    interp_set_config(interp0, 0, &cfg);
+    errors += expect("signed nibble 3", interp_get_raw(interp0, 0), 0xffffa000);
+    interp_config_set_mask(&cfg, 28, 31);
+    interp_set_config(interp0, 0, &cfg);
+    errors += expect("signed nibble 7", interp_get_raw(interp0, 0), 0x10000000);
+
+    cfg = interp_default_config();
+    interp_config_set_cross_result(&cfg, true);
+    interp_set_config(interp0, 0, &cfg);
+    interp_set_config(interp0, 1, &cfg);
+    interp_set_accumulator(interp0, 0, 123);
+    interp_set_accumulator(interp0, 1, 456);
+    interp_set_base(interp0, 0, 1);
+    interp_set_base(interp0, 1, 0);
+    static const uint32_t cross[][2] = {{124, 456}, {457, 124}, {125, 457}};
+    for (uint i = 0; i < count_of(cross); ++i) {
+        errors += expect("cross lanes peek 0", interp_peek_lane_result(interp0, 0), cross[i][0]);
+        errors += expect("cross lanes pop 1", interp_pop_lane_result(interp0, 1), cross[i][1]);
+    }
+
+    cfg = interp_default_config();
+    interp_config_set_blend(&cfg, true);
+    interp_set_config(interp0, 0, &cfg);
+    cfg = interp_default_config();
+    interp_set_config(interp0, 1, &cfg);
+    interp_set_base(interp0, 0, 500);
+    interp_set_base(interp0, 1, 1000);
+    static const uint32_t blend1[] = {500, 582, 666, 748, 832, 914, 998};
+    for (uint i = 0; i < count_of(blend1); ++i) {
+        interp_set_accumulator(interp0, 1, 255 * i / 6);
+        errors += expect("blend 1", interp_peek_lane_result(interp0, 1), blend1[i]);
+    }
+    interp_config_set_signed(&cfg, true);
+    interp_set_config(interp0, 1, &cfg);
+    interp_set_base(interp0, 0, (uint32_t) -1000);
+    interp_set_base(interp0, 1, 1000);
+    static const int32_t blend2[] = {-1000, -672, -336, -8, 328, 656, 992};
+    for (uint i = 0; i < count_of(blend2); ++i) {
+        interp_set_accumulator(interp0, 1, 255 * i / 6);
+        errors += expect("signed blend 2", interp_peek_lane_result(interp0, 1), (uint32_t) blend2[i]);
+    }
+
+    cfg = interp_default_config();
+    interp_config_set_clamp(&cfg, true);
+    interp_config_set_shift(&cfg, 2);
+    interp_config_set_mask(&cfg, 0, 29);
+    interp_config_set_signed(&cfg, true);
+    interp_set_config(interp1, 0, &cfg);
+    interp_set_base(interp1, 0, 0);
+    interp_set_base(interp1, 1, 255);
+    static const uint32_t clamped[] = {0, 0, 0, 0, 0, 64, 128, 192, 255};
+    for (uint i = 0; i < count_of(clamped); ++i) {
+        interp_set_accumulator(interp1, 0, (uint32_t) (-1024 + 256 * (int) i));
+        errors += expect("clamp", interp_peek_lane_result(interp1, 0), clamped[i]);
+    }
+
+    printf("Model: %s\n", errors ? "FAILED" : "ok");
+    return errors;
+}
+#endif
+
+// ----------------------------------------------------------------------------
+// Texture mapping, from hello_interp
+
+static void texture_mapping_setup(uint8_t *tex, uint texture_width_bits, uint texture_height_bits,
+                                  uint uv_fractional_bits) {
+    interp_config cfg = interp_default_config();
+    interp_config_set_add_raw(&cfg, true);
+    interp_config_set_shift(&cfg, uv_fractional_bits);
+    interp_config_set_mask(&cfg, 0, texture_width_bits - 1);
+    interp_set_config(interp0, 0, &cfg);
+
+    interp_config_set_shift(&cfg, uv_fractional_bits - texture_width_bits);
+    interp_config_set_mask(&cfg, texture_width_bits, texture_width_bits + texture_height_bits - 1);
+    interp_set_config(interp0, 1, &cfg);
+
+    interp_set_base(interp0, 2, (uintptr_t) tex);
+}
+
+static __noinline void texture_mapped_span(uint8_t *output, uint32_t u, uint32_t v, uint32_t du, uint32_t dv,
+                                           uint count) {
+    interp_set_accumulator(interp0, 0, u);
+    interp_set_base(interp0, 0, du);
+    interp_set_accumulator(interp0, 1, v);
+    interp_set_base(interp0, 1, dv);
+    for (uint i = 0; i < count; i++)
+        output[i] = *(uint8_t *) interp_pop_full_result(interp0);
+}
+
+static __noinline void texture_mapped_span_c(uint8_t *output, uint32_t u, uint32_t v, uint32_t du, uint32_t dv,
+                                             uint count) {
+    const uint32_t mask = (1u << TEXTURE_BITS) - 1;
+    for (uint i = 0; i < count; i++) {
+        output[i] = texture[((v >> UV_FRACTIONAL_BITS) & mask) << TEXTURE_BITS |
+                            ((u >> UV_FRACTIONAL_BITS) & mask)];
+        u += du;
+        v += dv;
+    }
+}
+
+static uint bench_texture_mapping(void) {
+    for (uint i = 0; i < count_of(texture); ++i)
+        texture[i] = (uint8_t) (i * 2654435761u >> 24);
+    texture_mapping_setup(texture, TEXTURE_BITS, TEXTURE_BITS, UV_FRACTIONAL_BITS);
+
+    uint errors = 0;
+    uint64_t interp_us = 0, c_us = 0;
+    for (uint s = 0; s < SPANS; ++s) {
+        // Assorted directions and scales, with wrapping
+        uint32_t u = s * 0x12345u, v = s * 0x54321u;
+        uint32_t du = 0x8000u + s * 0x1357u, dv = (uint32_t) (s * 0x2468u) - 0x40000u;
+        uint64_t t0 = time_us_64();
+        texture_mapped_span(span, u, v, du, dv, SPAN_LENGTH);
+        uint64_t t1 = time_us_64();
+        texture_mapped_span_c(ref_span, u, v, du, dv, SPAN_LENGTH);
+        uint64_t t2 = time_us_64();
+        interp_us += t1 - t0;
+        c_us += t2 - t1;
+        for (uint i = 0; i < SPAN_LENGTH; ++i)
+            errors += span[i] != ref_span[i];
+    }
+    double pixels = (double) SPANS * SPAN_LENGTH;
+    printf("texture_mapped_span: interp%s %.2f ns/pixel, plain C %.2f ns/pixel, %.2fx %s\n",
+           PICO_ON_DEVICE ? "" : " (model)", interp_us * 1000.0 / pixels, c_us * 1000.0 / pixels,
+           interp_us ? (double) c_us / (double) interp_us : 0.0, errors ? "MISMATCH" : "");
+    return errors;
+}
+
+int main() {
+    stdio_init_all();
+    printf("Interpolator model check and benchmark\n");
+
+    uint errors = check_model();
+    errors += bench_texture_mapping();
+
+    printf(errors ? "FAILED\n" : "All good\n");
+    return errors ? 1 : 0;
+}
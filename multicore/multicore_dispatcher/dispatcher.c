@@ -0,0 +1,231 @@
+/**
+ * Copyright (c) 2022 Raspberry Pi (Trading) Ltd.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+#include "dispatcher.h"
+
+// The worker takes jobs from the head and the helper takes them from the tail,
+// following the "THE" protocol from the Cilk-5 work-stealing scheduler: each
+// side moves its own index first, then fences and looks at the other one. If
+// they have crossed, both went for the same (last) job, and the worker settles
+// it under the lock, which the helper always holds whilst taking a job. Both
+// sides check for an empty ring before any of this, so the lock is only ever
+// contended when the ring is down to its last job.
+//
+// Indices are free-running 32-bit counters; compare them by signed difference.
+
+#define RING_MASK (DISPATCHER_RING_SIZE - 1)
+
+// ----------------------------------------------------------------------------
+// Platform glue: hardware spin lock and SEV/WFE on the device, mutexes and
+// condition variables for the host build (where the "worker core" is a pthread).
+
+static inline void dispatcher_lock(dispatcher_t *d) {
+#if PICO_ON_DEVICE
+    // Neither side touches the ring from an IRQ, so no need to disable them
+    spin_lock_unsafe_blocking(d->lock);
+#else
+    pthread_mutex_lock(&d->lock);
+#endif
+}
+
+static inline void dispatcher_unlock(dispatcher_t *d) {
+#if PICO_ON_DEVICE
+    spin_unlock_unsafe(d->lock);
+#else
+    pthread_mutex_unlock(&d->lock);
+#endif
+}
+
+static inline bool ring_empty(dispatcher_t *d) {
+    return (int32_t) (atomic_load_explicit(&d->tail, memory_order_acquire) -
+                      atomic_load_explicit(&d->head, memory_order_relaxed)) <= 0;
+}
+
+static inline void dispatcher_doorbell_ring(dispatcher_t *d) {
+#if PICO_ON_DEVICE
+    __sev();
+#else
+    pthread_mutex_lock(&d->wait_mutex);
+    pthread_cond_signal(&d->doorbell);
+    pthread_mutex_unlock(&d->wait_mutex);
+#endif
+}
+
+// Called by the worker when the ring is empty
+static inline void dispatcher_doorbell_wait(dispatcher_t *d) {
+#if PICO_ON_DEVICE
+    // Any SEV since we last looked at the ring makes this return immediately,
+    // so a batch can't slip in unnoticed between the check and the wait
+    __wfe();
+#else
+    pthread_mutex_lock(&d->wait_mutex);
+    while (ring_empty(d) && !atomic_load_explicit(&d->stop, memory_order_relaxed))
+        pthread_cond_wait(&d->doorbell, &d->wait_mutex);
+    pthread_mutex_unlock(&d->wait_mutex);
+#endif
+}
+
+static inline void dispatcher_notify_done(__unused dispatcher_t *d) {
+#if !PICO_ON_DEVICE
+    pthread_mutex_lock(&d->wait_mutex);
+    pthread_cond_broadcast(&d->job_done);
+    pthread_mutex_unlock(&d->wait_mutex);
+#endif
+}
+
+// Called when the only thing left to do is wait for the worker to finish a job
+static inline void dispatcher_wait_done(__unused dispatcher_t *d, dispatcher_future_t *future) {
+#if PICO_ON_DEVICE
+    while (!dispatcher_future_done(future))
+        tight_loop_contents();
+#else
+    pthread_mutex_lock(&d->wait_mutex);
+    while (!dispatcher_future_done(future))
+        pthread_cond_wait(&d->job_done, &d->wait_mutex);
+    pthread_mutex_unlock(&d->wait_mutex);
+#endif
+}
+
+// ----------------------------------------------------------------------------
+
+void dispatcher_init(dispatcher_t *d) {
+    atomic_store_explicit(&d->head, 0, memory_order_relaxed);
+    atomic_store_explicit(&d->tail, 0, memory_order_relaxed);
+    atomic_store_explicit(&d->stop, false, memory_order_relaxed);
+    d->worker_jobs = 0;
+    d->helper_jobs = 0;
+#if PICO_ON_DEVICE
+    d->lock = spin_lock_instance(spin_lock_claim_unused(true));
+#else
+    pthread_mutex_init(&d->lock, NULL);
+    pthread_mutex_init(&d->wait_mutex, NULL);
+    pthread_cond_init(&d->doorbell, NULL);
+    pthread_cond_init(&d->job_done, NULL);
+#endif
+}
+
+static inline void run_job(const dispatcher_job_t *job) {
+    int32_t result = job->func(job->data);
+    if (job->future) {
+        job->future->result = result;
+        atomic_store_explicit(&job->future->done, true, memory_order_release);
+    }
+}
+
+static bool worker_take(dispatcher_t *d, dispatcher_job_t *job) {
+    uint32_t h = atomic_load_explicit(&d->head, memory_order_relaxed);
+    // Cheap look first, so an idle worker doesn't keep taking the lock
+    if (ring_empty(d))
+        return false;
+    atomic_store_explicit(&d->head, h + 1, memory_order_relaxed);
+    atomic_thread_fence(memory_order_seq_cst);
+    if ((int32_t) (atomic_load_explicit(&d->tail, memory_order_acquire) - (h + 1)) < 0) {
+        // Empty, or racing the helper for the last job: back off, then try
+        // again holding the lock so the helper can't move the tail under us
+        atomic_store_explicit(&d->head, h, memory_order_relaxed);
+        dispatcher_lock(d);
+        h = atomic_load_explicit(&d->head, memory_order_relaxed);
+        atomic_store_explicit(&d->head, h + 1, memory_order_relaxed);
+        atomic_thread_fence(memory_order_seq_cst);
+        if ((int32_t) (atomic_load_explicit(&d->tail, memory_order_acquire) - (h + 1)) < 0) {
+            atomic_store_explicit(&d->head, h, memory_order_relaxed);
+            dispatcher_unlock(d);
+            return false;
+        }
+        dispatcher_unlock(d);
+    }
+    // The submitter always leaves one free slot behind the head (see
+    // dispatcher_submit), so this slot can't be reused until we move on
+    *job = d->jobs[h & RING_MASK];
+    return true;
+}
+
+void dispatcher_worker_run(dispatcher_t *d) {
+    while (!atomic_load_explicit(&d->stop, memory_order_relaxed)) {
+        dispatcher_job_t job;
+        if (worker_take(d, &job)) {
+            run_job(&job);
+            d->worker_jobs++;
+            dispatcher_notify_done(d);
+        } else {
+            dispatcher_doorbell_wait(d);
+        }
+    }
+}
+
+void dispatcher_stop(dispatcher_t *d) {
+    atomic_store_explicit(&d->stop, true, memory_order_relaxed);
+    dispatcher_doorbell_ring(d);
+}
+
+uint dispatcher_submit(dispatcher_t *d, const dispatcher_job_t *jobs, uint n) {
+    uint32_t t = atomic_load_explicit(&d->tail, memory_order_relaxed);
+    uint32_t h = atomic_load_explicit(&d->head, memory_order_acquire);
+    // The worker's head can briefly run one past the tail whilst it finds the
+    // ring empty
+    uint32_t used = (int32_t) (t - h) > 0 ? t - h : 0;
+    // Keep one slot spare, as the worker copies its job out after moving the head
+    uint32_t space = DISPATCHER_RING_SIZE - 1 - used;
+    if (n > space)
+        n = space;
+    for (uint i = 0; i < n; ++i) {
+        if (jobs[i].future)
+            atomic_store_explicit(&jobs[i].future->done, false, memory_order_relaxed);
+        d->jobs[(t + i) & RING_MASK] = jobs[i];
+    }
+    if (n) {
+        // Publish the whole batch at once, then one doorbell for all of it
+        atomic_store_explicit(&d->tail, t + n, memory_order_release);
+        dispatcher_doorbell_ring(d);
+    }
+    return n;
+}
+
+void dispatcher_submit_blocking(dispatcher_t *d, const dispatcher_job_t *jobs, uint n) {
+    while (n) {
+        uint queued = dispatcher_submit(d, jobs, n);
+        jobs += queued;
+        n -= queued;
+        if (n && !queued)
+            dispatcher_help(d);
+    }
+}
+
+bool dispatcher_help(dispatcher_t *d) {
+    if (ring_empty(d))
+        return false;
+    dispatcher_lock(d);
+    uint32_t t = atomic_load_explicit(&d->tail, memory_order_relaxed) - 1;
+    atomic_store_explicit(&d->tail, t, memory_order_relaxed);
+    atomic_thread_fence(memory_order_seq_cst);
+    if ((int32_t) (t - atomic_load_explicit(&d->head, memory_order_relaxed)) < 0) {
+        // The worker got there first
+        atomic_store_explicit(&d->tail, t + 1, memory_order_relaxed);
+        dispatcher_unlock(d);
+        return false;
+    }
+    dispatcher_unlock(d);
+    run_job(&d->jobs[t & RING_MASK]);
+    d->helper_jobs++;
+    return true;
+}
+
+int32_t dispatcher_wait(dispatcher_t *d, dispatcher_future_t *future) {
+    // Once there is nothing left to help with, the job must be on the worker
+    while (!dispatcher_future_done(future) && dispatcher_help(d))
+        ;
+    dispatcher_wait_done(d, future);
+    return future->result;
+}
+
+void dispatcher_wait_all(dispatcher_t *d, dispatcher_future_t *futures, uint n) {
+    // Help from the tail first; the newest jobs are the ones the worker
+    // would get to last
+    while (dispatcher_help(d))
+        ;
+    for (uint i = 0; i < n; ++i)
+        dispatcher_wait(d, &futures[i]);
+}
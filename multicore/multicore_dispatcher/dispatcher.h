@@ -0,0 +1,104 @@
+/**
+ * Copyright (c) 2022 Raspberry Pi (Trading) Ltd.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+#ifndef _DISPATCHER_H
+#define _DISPATCHER_H
+
+#include <stdatomic.h>
+#include "pico.h"
+
+#if PICO_ON_DEVICE
+#include "hardware/sync.h"
+#else
+#include <pthread.h>
+#endif
+
+// A job dispatcher for running many short functions on the second core.
+//
+// - Jobs are pushed in batches into a ring owned by the worker core. Only the
+//   submitting core writes the tail, and only the worker moves the head, so
+//   the common path needs no locks and no interrupt disabling. One doorbell
+//   (SEV) is rung per batch, not per job.
+//
+// - Each job carries a pointer to a future, which the worker fills in and
+//   marks done. There is no shared results queue to drain in order.
+//
+// - Whilst the submitting core waits for a future it takes jobs back off the
+//   tail of the ring and runs them itself, so both cores drain a batch. The
+//   worker and the helper only contend for the very last job in the ring, and
+//   only then do they fall back to a hardware spin lock.
+//
+// Only one core (or thread, on the host) may submit jobs and wait for them.
+
+#ifndef DISPATCHER_RING_SIZE
+#define DISPATCHER_RING_SIZE 64
+#endif
+
+static_assert(!(DISPATCHER_RING_SIZE & (DISPATCHER_RING_SIZE - 1)), "DISPATCHER_RING_SIZE must be a power of two");
+
+typedef int32_t (*dispatcher_func_t)(int32_t);
+
+typedef struct {
+    _Atomic bool done;
+    int32_t result;
+} dispatcher_future_t;
+
+typedef struct {
+    dispatcher_func_t func;
+    int32_t data;
+    dispatcher_future_t *future;
+} dispatcher_job_t;
+
+typedef struct {
+    dispatcher_job_t jobs[DISPATCHER_RING_SIZE];
+    // Next job for the worker. Moved by the worker; moved back only when it
+    // loses a race for the last job.
+    _Atomic uint32_t head;
+    // One past the newest job. Moved by the submitting core, which also takes
+    // jobs back from this end when it is idle.
+    _Atomic uint32_t tail;
+    _Atomic bool stop;
+    // Jobs run by the worker, and by the submitting core (for statistics only)
+    uint32_t worker_jobs;
+    uint32_t helper_jobs;
+#if PICO_ON_DEVICE
+    spin_lock_t *lock;
+#else
+    pthread_mutex_t lock;
+    // The host has no SEV/WFE, and may have fewer CPUs than we have threads,
+    // so idle threads sleep on these rather than spinning
+    pthread_mutex_t wait_mutex;
+    pthread_cond_t doorbell;
+    pthread_cond_t job_done;
+#endif
+} dispatcher_t;
+
+void dispatcher_init(dispatcher_t *d);
+
+// Worker loop, for the second core. Runs jobs until dispatcher_stop() is called.
+void dispatcher_worker_run(dispatcher_t *d);
+void dispatcher_stop(dispatcher_t *d);
+
+// Queue up to n jobs, and ring the doorbell once. Returns the number of jobs
+// queued, which is less than n if the ring fills up.
+uint dispatcher_submit(dispatcher_t *d, const dispatcher_job_t *jobs, uint n);
+
+// Queue all n jobs, running some of them on this core if the ring is full
+void dispatcher_submit_blocking(dispatcher_t *d, const dispatcher_job_t *jobs, uint n);
+
+// Take the newest queued job back and run it on this core. Returns false if
+// there was nothing left to take.
+bool dispatcher_help(dispatcher_t *d);
+
+// Wait for a job to finish, helping out with queued work meanwhile
+int32_t dispatcher_wait(dispatcher_t *d, dispatcher_future_t *future);
+void dispatcher_wait_all(dispatcher_t *d, dispatcher_future_t *futures, uint n);
+
+static inline bool dispatcher_future_done(dispatcher_future_t *future) {
+    return atomic_load_explicit(&future->done, memory_order_acquire);
+}
+
+#endif
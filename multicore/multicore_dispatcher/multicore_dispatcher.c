@@ -0,0 +1,258 @@
+/**
+ * Copyright (c) 2022 Raspberry Pi (Trading) Ltd.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+#include <stdio.h>
+#include "pico/stdlib.h"
+#include "dispatcher.h"
+
+#if PICO_ON_DEVICE
+#include "pico/multicore.h"
+#include "pico/util/queue.h"
+#endif
+
+// This example compares two ways of farming out short jobs to the second core:
+//
+// - The multicore_runner_queue way: one {func, data} entry at a time through a
+//   depth-2 queue_t, then block on a results queue_t for the answer.
+//
+// - The dispatcher in dispatcher.c: batches of jobs through a lock-free ring,
+//   a future per job, and core 0 helping to run the batch whilst it waits.
+//
+// On the host build (PICO_PLATFORM=host) a pthread stands in for core 1, and
+// a mutex/condition variable queue stands in for queue_t.
+
+typedef struct {
+    dispatcher_func_t func;
+    int32_t data;
+} queue_entry_t;
+
+int32_t add_one(int32_t n) {
+    return n + 1;
+}
+
+int32_t fibonacci(int32_t n) {
+    if (n == 0) return 0;
+    if (n == 1) return 1;
+
+    int n1 = 0, n2 = 1, n3 = 0;
+
+    for (int i = 2; i <= n; i++) {
+        n3 = n1 + n2;
+        n1 = n2;
+        n2 = n3;
+    }
+    return n3;
+}
+
+#define N_JOBS 20000
+#define BATCH_SIZE 32 // N_JOBS must be a multiple of this
+
+static dispatcher_t dispatcher;
+
+// ----------------------------------------------------------------------------
+// The baseline: a blocking queue round trip per job
+
+#if PICO_ON_DEVICE
+static queue_t call_queue;
+static queue_t results_queue;
+
+static void baseline_init(void) {
+    queue_init(&call_queue, sizeof(queue_entry_t), 2);
+    queue_init(&results_queue, sizeof(int32_t), 2);
+}
+
+static void baseline_send(queue_t *q, const void *data) {
+    queue_add_blocking(q, data);
+}
+
+static void baseline_receive(queue_t *q, void *data) {
+    queue_remove_blocking(q, data);
+}
+#else
+#include <pthread.h>
+#include <string.h>
+
+// Just enough of a single slot blocking queue to do the same round trip
+typedef struct {
+    pthread_mutex_t mutex;
+    pthread_cond_t cond;
+    uint element_size;
+    bool full;
+    uint8_t data[sizeof(queue_entry_t)];
+} queue_t;
+
+static queue_t call_queue;
+static queue_t results_queue;
+
+static void queue_init(queue_t *q, uint element_size) {
+    pthread_mutex_init(&q->mutex, NULL);
+    pthread_cond_init(&q->cond, NULL);
+    q->element_size = element_size;
+    q->full = false;
+}
+
+static void baseline_init(void) {
+    queue_init(&call_queue, sizeof(queue_entry_t));
+    queue_init(&results_queue, sizeof(int32_t));
+}
+
+static void baseline_send(queue_t *q, const void *data) {
+    pthread_mutex_lock(&q->mutex);
+    while (q->full)
+        pthread_cond_wait(&q->cond, &q->mutex);
+    memcpy(q->data, data, q->element_size);
+    q->full = true;
+    pthread_cond_broadcast(&q->cond);
+    pthread_mutex_unlock(&q->mutex);
+}
+
+static void baseline_receive(queue_t *q, void *data) {
+    pthread_mutex_lock(&q->mutex);
+    while (!q->full)
+        pthread_cond_wait(&q->cond, &q->mutex);
+    memcpy(data, q->data, q->element_size);
+    q->full = false;
+    pthread_cond_broadcast(&q->cond);
+    pthread_mutex_unlock(&q->mutex);
+}
+#endif
+
+// ----------------------------------------------------------------------------
+// The second core: serve the baseline queue until told to switch over, then
+// become a dispatcher worker
+
+static void core1_entry(void) {
+    while (true) {
+        queue_entry_t entry;
+        baseline_receive(&call_queue, &entry);
+        if (!entry.func)
+            break;
+        int32_t result = entry.func(entry.data);
+        baseline_send(&results_queue, &result);
+    }
+    dispatcher_worker_run(&dispatcher);
+}
+
+#if !PICO_ON_DEVICE
+static void *core1_thread(__unused void *arg) {
+    core1_entry();
+    return NULL;
+}
+#endif
+
+// ----------------------------------------------------------------------------
+
+static void report(const char *name, uint64_t elapsed_us, int64_t sum, int64_t expected) {
+    printf("  %-28s %8.3f us/job %10.0f jobs/s %s\n", name, elapsed_us / (double) N_JOBS,
+           N_JOBS * 1e6 / (double) elapsed_us, sum == expected ? "" : "WRONG ANSWER");
+}
+
+static int64_t expected_sum(dispatcher_func_t func) {
+    int64_t expected = 0;
+    for (int i = 0; i < N_JOBS; ++i)
+        expected += func(i & 31);
+    return expected;
+}
+
+// One job at a time through the queues, waiting for each result
+static void run_queue(dispatcher_func_t func) {
+    int64_t sum = 0;
+    uint64_t start = time_us_64();
+    for (int i = 0; i < N_JOBS; ++i) {
+        queue_entry_t entry = {func, i & 31};
+        int32_t result;
+        baseline_send(&call_queue, &entry);
+        baseline_receive(&results_queue, &result);
+        sum += result;
+    }
+    report("queue round trip", time_us_64() - start, sum, expected_sum(func));
+}
+
+// One job at a time through the dispatcher. Don't help out, so that this
+// measures the cross-core latency.
+static void run_dispatcher_single(dispatcher_func_t func) {
+    dispatcher_future_t future;
+    int64_t sum = 0;
+    uint64_t start = time_us_64();
+    for (int i = 0; i < N_JOBS; ++i) {
+        dispatcher_job_t job = {func, i & 31, &future};
+        dispatcher_submit_blocking(&dispatcher, &job, 1);
+        while (!dispatcher_future_done(&future))
+            tight_loop_contents();
+        sum += future.result;
+    }
+    report("dispatcher, single job", time_us_64() - start, sum, expected_sum(func));
+}
+
+// Batches of jobs, with core 0 helping to drain each batch
+static void run_dispatcher_batched(dispatcher_func_t func) {
+    static dispatcher_job_t jobs[BATCH_SIZE];
+    static dispatcher_future_t futures[BATCH_SIZE];
+    uint32_t worker_jobs = dispatcher.worker_jobs;
+    uint32_t helper_jobs = dispatcher.helper_jobs;
+    int64_t sum = 0;
+    uint64_t start = time_us_64();
+    for (int i = 0; i < N_JOBS; i += BATCH_SIZE) {
+        for (int j = 0; j < BATCH_SIZE; ++j) {
+            jobs[j].func = func;
+            jobs[j].data = (i + j) & 31;
+            jobs[j].future = &futures[j];
+        }
+        dispatcher_submit_blocking(&dispatcher, jobs, BATCH_SIZE);
+        dispatcher_wait_all(&dispatcher, futures, BATCH_SIZE);
+        for (int j = 0; j < BATCH_SIZE; ++j)
+            sum += futures[j].result;
+    }
+    report("dispatcher, batched", time_us_64() - start, sum, expected_sum(func));
+    printf("  %-28s %u on core 1, %u on core 0\n", "jobs run", dispatcher.worker_jobs - worker_jobs,
+           dispatcher.helper_jobs - helper_jobs);
+}
+
+static const struct {
+    dispatcher_func_t func;
+    const char *name;
+} tests[] = {
+    {add_one, "add_one"},
+    {fibonacci, "fibonacci"},
+};
+
+int main() {
+    stdio_init_all();
+    printf("Hello, multicore_dispatcher!\n");
+
+    baseline_init();
+    dispatcher_init(&dispatcher);
+
+#if PICO_ON_DEVICE
+    multicore_launch_core1(core1_entry);
+#else
+    pthread_t core1;
+    pthread_create(&core1, NULL, core1_thread, NULL);
+#endif
+
+    // Baseline numbers first, whilst core 1 is serving the queues
+    for (uint i = 0; i < count_of(tests); ++i) {
+        printf("%s:\n", tests[i].name);
+        run_queue(tests[i].func);
+    }
+
+    // A NULL function moves core 1 over to the dispatcher
+    queue_entry_t entry = {NULL, 0};
+    baseline_send(&call_queue, &entry);
+
+    for (uint i = 0; i < count_of(tests); ++i) {
+        printf("%s:\n", tests[i].name);
+        run_dispatcher_single(tests[i].func);
+        run_dispatcher_batched(tests[i].func);
+    }
+
+#if !PICO_ON_DEVICE
+    dispatcher_stop(&dispatcher);
+    pthread_join(core1, NULL);
+#endif
+    printf("Done\n");
+    return 0;
+}
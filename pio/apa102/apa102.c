@@ -9,7 +9,9 @@
 
 #include "pico/stdlib.h"
 #include "hardware/pio.h"
+#include "hardware/dma.h"
 #include "apa102.pio.h"
+#include "apa102_frame.h"
 
 #define PIN_CLK 2
 #define PIN_DIN 3
@@ -17,25 +19,30 @@
 #define N_LEDS 150
 #define SERIAL_FREQ (5 * 1000 * 1000)
 
-// Global brightness value 0->31
-#define BRIGHTNESS 16
+// Two whole frames (see apa102_frame.h): the DMA sends one to the state
+// machine whilst we draw the next into the other
+static uint32_t frame_words[2][APA102_FRAME_WORDS(N_LEDS)];
+static apa102_frame_t frames[2];
 
-void put_start_frame(PIO pio, uint sm) {
-    pio_sm_put_blocking(pio, sm, 0u);
-}
+static uint dma_chan;
 
-void put_end_frame(PIO pio, uint sm) {
-    pio_sm_put_blocking(pio, sm, ~0u);
+void apa102_dma_init(PIO pio, uint sm) {
+    dma_chan = dma_claim_unused_channel(true);
+    dma_channel_config c = dma_channel_get_default_config(dma_chan);
+    channel_config_set_dreq(&c, pio_get_dreq(pio, sm, true));
+    dma_channel_configure(dma_chan, &c,
+                          &pio->txf[sm],
+                          NULL, // set by apa102_show()
+                          0,
+                          false);
 }
 
-void put_rgb888(PIO pio, uint sm, uint8_t r, uint8_t g, uint8_t b) {
-    pio_sm_put_blocking(pio, sm,
-                        0x7 << 29 |                   // magic
-                        (BRIGHTNESS & 0x1f) << 24 |   // global brightness parameter
-                        (uint32_t) b << 16 |
-                        (uint32_t) g << 8 |
-                        (uint32_t) r << 0
-    );
+// Start sending a frame, once the previous one has gone. The DMA reads the
+// frame in place, so it must be left alone until the next apa102_show() call
+// has returned.
+void apa102_show(const apa102_frame_t *frame) {
+    dma_channel_wait_for_finish_blocking(dma_chan);
+    dma_channel_transfer_from_buffer_now(dma_chan, frame->words, apa102_frame_word_count(frame));
 }
 
 #define TABLE_SIZE (1 << 8)
@@ -48,21 +55,30 @@ int main() {
     uint sm = 0;
     uint offset = pio_add_program(pio, &apa102_mini_program);
     apa102_mini_program_init(pio, sm, offset, SERIAL_FREQ, PIN_CLK, PIN_DIN);
+    apa102_dma_init(pio, sm);
+
+    apa102_brightness_init();
+    for (int i = 0; i < 2; ++i)
+        apa102_frame_init(&frames[i], frame_words[i], N_LEDS);
 
     for (int i = 0; i < TABLE_SIZE; ++i)
         wave_table[i] = powf(sinf(i * M_PI / TABLE_SIZE), 5.f) * 255;
 
     uint t = 0;
+    uint back = 0;
     while (true) {
-        put_start_frame(pio, sm);
+        // The strip fades out towards the far end, using the per-LED
+        // brightness, which keeps the colours intact as it gets dimmer
         for (int i = 0; i < N_LEDS; ++i) {
-            put_rgb888(pio, sm,
-                       wave_table[(i + t) % TABLE_SIZE],
-                       wave_table[(2 * i + 3 * 2) % TABLE_SIZE],
-                       wave_table[(3 * i + 4 * t) % TABLE_SIZE]
+            apa102_frame_set_rgb888_level(&frames[back], i,
+                                          wave_table[(i + t) % TABLE_SIZE],
+                                          wave_table[(2 * i + 3 * 2) % TABLE_SIZE],
+                                          wave_table[(3 * i + 4 * t) % TABLE_SIZE],
+                                          255 - i * 224 / N_LEDS
             );
         }
-        put_end_frame(pio, sm);
+        apa102_show(&frames[back]);
+        back ^= 1;
         sleep_ms(10);
         ++t;
     }
@@ -0,0 +1,29 @@
+/**
+ * Copyright (c) 2022 Raspberry Pi (Trading) Ltd.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+#include "apa102_frame.h"
+
+apa102_brightness_t apa102_brightness_lut[256];
+
+void apa102_frame_init(apa102_frame_t *frame, uint32_t *words, uint n_leds) {
+    frame->words = words;
+    frame->n_leds = n_leds;
+    words[0] = APA102_START_FRAME;
+    for (uint i = 0; i < n_leds; ++i)
+        words[1 + i] = apa102_led_word(0, 0, 0, 0);
+    words[1 + n_leds] = APA102_END_FRAME;
+}
+
+void apa102_brightness_init(void) {
+    for (uint level = 0; level < 256; ++level) {
+        // The overall output is (global / 31) * (scale / 256), which should
+        // come to level / 255
+        uint global = (level * 31 + 254) / 255;
+        uint scale = global ? (level * 31 * 256 + global * 255 / 2) / (global * 255) : 0;
+        apa102_brightness_lut[level].header = apa102_led_word(global, 0, 0, 0);
+        apa102_brightness_lut[level].scale = (uint16_t) MIN(scale, 256u);
+    }
+}
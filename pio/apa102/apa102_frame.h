@@ -0,0 +1,76 @@
+/**
+ * Copyright (c) 2022 Raspberry Pi (Trading) Ltd.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+#ifndef _APA102_FRAME_H
+#define _APA102_FRAME_H
+
+#include "pico.h"
+
+// Whole-strip frames for APA102 LEDs
+//
+// A frame holds every word apa102_mini needs to send for one update of the
+// strip: the start frame, one word per LED, and the end frame. The words are
+// stored as they go into the TX FIFO, so a frame can be handed straight to
+// the DMA, with no copying.
+//
+// Each LED word is, MSB first on the wire:
+//   111bbbbb BBBBBBBB GGGGGGGG RRRRRRRR
+// where bbbbb is the LED's own 5-bit global brightness (driver current).
+
+#define APA102_FRAME_WORDS(n_leds) ((n_leds) + 2)
+
+#define APA102_START_FRAME 0u
+#define APA102_END_FRAME (~0u)
+#define APA102_LED_MAGIC (0x7u << 29)
+
+typedef struct {
+    uint32_t *words; // APA102_FRAME_WORDS(n_leds) of them
+    uint n_leds;
+} apa102_frame_t;
+
+// Set up a frame in the given storage, with all LEDs off
+void apa102_frame_init(apa102_frame_t *frame, uint32_t *words, uint n_leds);
+
+static inline uint apa102_frame_word_count(const apa102_frame_t *frame) {
+    return APA102_FRAME_WORDS(frame->n_leds);
+}
+
+static inline uint32_t apa102_led_word(uint brightness, uint8_t r, uint8_t g, uint8_t b) {
+    return APA102_LED_MAGIC | (brightness & 0x1fu) << 24 | (uint32_t) b << 16 | (uint32_t) g << 8 | r;
+}
+
+// Set LED i to a colour at one of the 32 global brightness levels
+static inline void apa102_frame_set_rgb888(apa102_frame_t *frame, uint i, uint8_t r, uint8_t g, uint8_t b,
+                                           uint brightness) {
+    frame->words[1 + i] = apa102_led_word(brightness, r, g, b);
+}
+
+// Per-LED brightness, 0 to 255
+//
+// Dimming an APA102 by scaling its 8-bit colour throws away colour depth. The
+// 5-bit global brightness dims it too, by lowering the driver current, so for
+// each of the 256 brightness levels this table holds the smallest global
+// brightness which can reach it, and the colour scale (out of 256) that makes
+// up the rest. The colour therefore keeps as many bits as it can.
+typedef struct {
+    uint32_t header; // Magic and 5-bit global brightness, ready to OR in
+    uint16_t scale;  // Colour scale, 0 to 256
+} apa102_brightness_t;
+
+extern apa102_brightness_t apa102_brightness_lut[256];
+
+// Fill in apa102_brightness_lut; call once before apa102_frame_set_rgb888_level()
+void apa102_brightness_init(void);
+
+// Set LED i to a colour at brightness level 0 to 255
+static inline void apa102_frame_set_rgb888_level(apa102_frame_t *frame, uint i, uint8_t r, uint8_t g, uint8_t b,
+                                                 uint8_t level) {
+    const apa102_brightness_t *l = &apa102_brightness_lut[level];
+    uint scale = l->scale;
+    frame->words[1 + i] = l->header | (b * scale >> 8) << 16 | (g * scale >> 8) << 8 | (r * scale >> 8);
+}
+
+#endif
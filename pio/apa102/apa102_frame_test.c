@@ -0,0 +1,140 @@
+/**
+ * Copyright (c) 2022 Raspberry Pi (Trading) Ltd.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+#include <stdio.h>
+#include <string.h>
+#include "pico/stdlib.h"
+#include "apa102_frame.h"
+#include "test_rand.h"
+
+// Check that a frame built with apa102_frame.h sends exactly the same bytes
+// down the wire as the original put_start_frame(), put_rgb888() and
+// put_end_frame() from apa102.c, and check the per-LED brightness table.
+// Both ways get the same random colours, from the same seed, for strips of
+// none up to MAX_LEDS.
+
+#define MAX_LEDS 150
+#define BRIGHTNESS 16
+
+// Stand-in for the TX FIFO
+static uint32_t fifo[APA102_FRAME_WORDS(MAX_LEDS)];
+static uint fifo_len;
+
+static void put_word(uint32_t x) {
+    hard_assert(fifo_len < count_of(fifo));
+    fifo[fifo_len++] = x;
+}
+
+// --- The original functions, with pio_sm_put_blocking() replaced ---
+
+static void put_start_frame(void) {
+    put_word(0u);
+}
+
+static void put_end_frame(void) {
+    put_word(~0u);
+}
+
+static void put_rgb888(uint8_t r, uint8_t g, uint8_t b) {
+    put_word(0x7 << 29 |                   // magic
+             (BRIGHTNESS & 0x1f) << 24 |   // global brightness parameter
+             (uint32_t) b << 16 |
+             (uint32_t) g << 8 |
+             (uint32_t) r << 0
+    );
+}
+
+// ---
+
+// apa102_mini shifts each word out MSB first
+static uint serialise(uint8_t *out, const uint32_t *words, uint n) {
+    for (uint i = 0; i < n; ++i) {
+        *out++ = words[i] >> 24;
+        *out++ = words[i] >> 16;
+        *out++ = words[i] >> 8;
+        *out++ = words[i];
+    }
+    return n * 4;
+}
+
+static uint32_t frame_words[APA102_FRAME_WORDS(MAX_LEDS)];
+static uint8_t expected_bytes[sizeof(fifo)];
+static uint8_t frame_bytes[sizeof(frame_words)];
+
+static uint check_stream(uint n_leds, uint seed) {
+    apa102_frame_t frame;
+    apa102_frame_init(&frame, frame_words, n_leds);
+
+    fifo_len = 0;
+    put_start_frame();
+    seed_rand(seed);
+    for (uint i = 0; i < n_leds; ++i) {
+        uint32_t c = next_rand();
+        put_rgb888(c, c >> 8, c >> 16);
+    }
+    put_end_frame();
+
+    seed_rand(seed);
+    for (uint i = 0; i < n_leds; ++i) {
+        uint32_t c = next_rand();
+        apa102_frame_set_rgb888(&frame, i, c, c >> 8, c >> 16, BRIGHTNESS);
+    }
+
+    uint expected_len = serialise(expected_bytes, fifo, fifo_len);
+    uint frame_len = serialise(frame_bytes, frame.words, apa102_frame_word_count(&frame));
+    bool ok = frame_len == expected_len && !memcmp(frame_bytes, expected_bytes, frame_len);
+    if (!ok)
+        printf("%3u LEDs: byte stream differs\n", n_leds);
+    return ok ? 0 : 1;
+}
+
+static uint check_brightness(void) {
+    apa102_brightness_init();
+    uint errors = 0;
+    double worst = 0;
+    for (uint level = 0; level < 256; ++level) {
+        const apa102_brightness_t *l = &apa102_brightness_lut[level];
+        uint global = (l->header >> 24) & 0x1f;
+        if ((l->header & ~(0x1fu << 24)) != APA102_LED_MAGIC || l->scale > 256)
+            ++errors;
+        double actual = global / 31.0 * l->scale / 256.0;
+        double error = actual > level / 255.0 ? actual - level / 255.0 : level / 255.0 - actual;
+        if (error > worst)
+            worst = error;
+        // At most half a step of the colour scale out
+        if (error > 0.5 / 256)
+            ++errors;
+        // And never a smaller global brightness (more colour depth) available
+        if (global && (global - 1) * 255 >= level * 31)
+            ++errors;
+    }
+    // Full brightness is the plain colour, and 0 is off
+    apa102_frame_t frame;
+    apa102_frame_init(&frame, frame_words, 2);
+    apa102_frame_set_rgb888_level(&frame, 0, 0x12, 0x34, 0x56, 255);
+    apa102_frame_set_rgb888_level(&frame, 1, 0x12, 0x34, 0x56, 0);
+    if (frame.words[1] != apa102_led_word(31, 0x12, 0x34, 0x56) || frame.words[2] != apa102_led_word(0, 0, 0, 0))
+        ++errors;
+    printf("Brightness table: worst error %.5f, %s\n", worst, errors ? "FAILED" : "ok");
+    return errors;
+}
+
+int main() {
+    stdio_init_all();
+    printf("APA102 frame test\n");
+
+    uint errors = 0;
+    static const uint led_counts[] = {0, 1, 2, 17, 64, MAX_LEDS};
+    for (uint i = 0; i < count_of(led_counts); ++i)
+        for (uint seed = 1; seed <= 8; ++seed)
+            errors += check_stream(led_counts[i], seed * 7919);
+    printf("Byte stream: %s\n", errors ? "FAILED" : "ok");
+
+    errors += check_brightness();
+
+    printf(errors ? "FAILED\n" : "All good\n");
+    return errors ? 1 : 0;
+}
@@ -10,6 +10,7 @@
 #include "hardware/gpio.h"
 #include "hardware/pio.h"
 #include "hub75.pio.h"
+#include "pixel_format.h"
 
 #include "mountains_128x64_rgb565.h"
 
@@ -24,18 +25,9 @@
 #define WIDTH 128
 #define HEIGHT 64
 
-static inline uint32_t gamma_correct_565_888(uint16_t pix) {
-    uint32_t r_gamma = pix & 0xf800u;
-    r_gamma *= r_gamma;
-    uint32_t g_gamma = pix & 0x07e0u;
-    g_gamma *= g_gamma;
-    uint32_t b_gamma = pix & 0x001fu;
-    b_gamma *= b_gamma;
-    return (b_gamma >> 2 << 16) | (g_gamma >> 14 << 8) | (r_gamma >> 24 << 0);
-}
-
 int main() {
     stdio_init_all();
+    pixel_format_init();
 
     PIO pio = pio0;
     uint sm_data = 0;
@@ -51,10 +43,8 @@ int main() {
 
     while (1) {
         for (int rowsel = 0; rowsel < (1 << ROWSEL_N_PINS); ++rowsel) {
-            for (int x = 0; x < WIDTH; ++x) {
-                gc_row[0][x] = gamma_correct_565_888(img[rowsel * WIDTH + x]);
-                gc_row[1][x] = gamma_correct_565_888(img[((1u << ROWSEL_N_PINS) + rowsel) * WIDTH + x]);
-            }
+            pixel_span_565_to_888_gamma(gc_row[0], &img[rowsel * WIDTH], WIDTH);
+            pixel_span_565_to_888_gamma(gc_row[1], &img[((1u << ROWSEL_N_PINS) + rowsel) * WIDTH], WIDTH);
             for (int bit = 0; bit < 8; ++bit) {
                 hub75_data_rgb888_set_shift(pio, sm_data, data_prog_offs, bit);
                 for (int x = 0; x < WIDTH; ++x) {
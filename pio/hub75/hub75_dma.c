@@ -0,0 +1,99 @@
+/**
+ * Copyright (c) 2022 Raspberry Pi (Trading) Ltd.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+#include "hub75_dma.h"
+#include "hardware/dma.h"
+#include "hub75.pio.h"
+
+// Chain `chan` to a control channel which, each time `chan` finishes, copies
+// the address at `read_addr_src` into its READ_ADDR trigger alias, restarting
+// it. The transfer count doesn't need reloading: each trigger restarts the
+// channel with the count it was configured with.
+static void configure_chained_pair(uint chan, uint ctrl_chan, const volatile void *read_addr_src, uint count,
+                                   volatile void *txf, uint dreq) {
+    dma_channel_config c = dma_channel_get_default_config(ctrl_chan);
+    channel_config_set_transfer_data_size(&c, DMA_SIZE_32);
+    // One word each time, from and to the same place, so neither address
+    // has to be put back
+    channel_config_set_read_increment(&c, false);
+    channel_config_set_write_increment(&c, false);
+    dma_channel_configure(ctrl_chan, &c,
+        &dma_hw->ch[chan].al3_read_addr_trig, // dst
+        read_addr_src,                        // src
+        1,                                    // count
+        false                                 // don't start yet
+    );
+
+    c = dma_channel_get_default_config(chan);
+    channel_config_set_transfer_data_size(&c, DMA_SIZE_32);
+    channel_config_set_read_increment(&c, true);
+    channel_config_set_write_increment(&c, false);
+    channel_config_set_dreq(&c, dreq);
+    channel_config_set_chain_to(&c, ctrl_chan);
+    dma_channel_configure(chan, &c,
+        txf,   // dst
+        NULL,  // src is loaded by the control channel
+        count,
+        false
+    );
+}
+
+void hub75_dma_init(hub75_dma_t *h, PIO pio, uint rgb_base_pin, uint clk_pin, uint rowsel_base_pin,
+                    uint strobe_pin, uint32_t *buffer0, uint32_t *buffer1) {
+    h->pio = pio;
+    h->buffers[0] = buffer0;
+    h->buffers[1] = buffer1;
+    h->back = 1;
+    hub75_planes_row_words(h->row_words);
+    h->frame_read_addr = buffer0;
+    h->row_read_addr = h->row_words;
+
+    h->sm_data = pio_claim_unused_sm(pio, true);
+    h->sm_row = pio_claim_unused_sm(pio, true);
+    uint data_prog_offs = pio_add_program(pio, &hub75_data_planes_program);
+    uint row_prog_offs = pio_add_program(pio, &hub75_row_sync_program);
+    // The data SM spends 4 cycles per pixel, so this gives a 12.5 MHz panel
+    // clock from a 125 MHz system clock
+    hub75_data_planes_program_init(pio, h->sm_data, data_prog_offs, rgb_base_pin, clk_pin, 2.5f);
+    hub75_row_sync_program_init(pio, h->sm_row, row_prog_offs, rowsel_base_pin, 5, strobe_pin);
+    // Make sure neither SM sees a stale handshake when they start
+    pio_interrupt_clear(pio, 4);
+    pio_interrupt_clear(pio, 5);
+
+    h->data_chan = dma_claim_unused_channel(true);
+    h->data_ctrl_chan = dma_claim_unused_channel(true);
+    h->row_chan = dma_claim_unused_channel(true);
+    h->row_ctrl_chan = dma_claim_unused_channel(true);
+    configure_chained_pair(h->data_chan, h->data_ctrl_chan, &h->frame_read_addr, HUB75_FRAME_WORDS,
+                           &pio->txf[h->sm_data], pio_get_dreq(pio, h->sm_data, true));
+    configure_chained_pair(h->row_chan, h->row_ctrl_chan, &h->row_read_addr, count_of(h->row_words),
+                           &pio->txf[h->sm_row], pio_get_dreq(pio, h->sm_row, true));
+
+    // Load the first read addresses, which starts both streams. The SMs sit
+    // on their full FIFOs until they are enabled, together.
+    dma_start_channel_mask((1u << h->data_ctrl_chan) | (1u << h->row_ctrl_chan));
+    pio_set_sm_mask_enabled(pio, (1u << h->sm_data) | (1u << h->sm_row), true);
+}
+
+bool hub75_dma_swap_done(hub75_dma_t *h) {
+    // Once the control channel has picked up the new address, the data
+    // channel's read address will be somewhere inside the new front buffer
+    const uint32_t *front = h->buffers[h->back ^ 1];
+    uintptr_t read_addr = dma_hw->ch[h->data_chan].read_addr;
+    return read_addr >= (uintptr_t) front && read_addr < (uintptr_t) (front + HUB75_FRAME_WORDS);
+}
+
+void hub75_dma_swap_buffers(hub75_dma_t *h, bool wait_vsync) {
+    // A single word write; the control channel picks up either the old or the
+    // new address at the next frame boundary
+    h->frame_read_addr = h->buffers[h->back];
+    __compiler_memory_barrier();
+    h->back ^= 1;
+    if (wait_vsync) {
+        while (!hub75_dma_swap_done(h))
+            tight_loop_contents();
+    }
+}
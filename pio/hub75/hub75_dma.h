@@ -0,0 +1,65 @@
+/**
+ * Copyright (c) 2022 Raspberry Pi (Trading) Ltd.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+#ifndef _HUB75_DMA_H
+#define _HUB75_DMA_H
+
+#include "hardware/pio.h"
+#include "hub75_planes.h"
+
+// Refresh a HUB75 panel continuously from a bit-plane frame buffer (see
+// hub75_planes.h), using four DMA channels and two state machines, and no
+// processor time at all once started.
+//
+// - A data channel streams the frame buffer into hub75_data_planes. When it
+//   reaches the end of the frame, it chains to a control channel, which
+//   copies `frame_read_addr`, i.e. the front buffer, into its read address,
+//   restarting it.
+//
+// - A row channel and its own control channel do the same with the fixed
+//   table of row select/OEn pulse words, for hub75_row_sync.
+//
+// The two state machines keep each other in step, so the two DMA streams
+// never drift apart. Swapping buffers just means writing a new address into
+// `frame_read_addr`, which takes effect at the start of the next frame.
+
+typedef struct {
+    PIO pio;
+    uint sm_data;
+    uint sm_row;
+    uint data_chan;
+    uint data_ctrl_chan;
+    uint row_chan;
+    uint row_ctrl_chan;
+    uint32_t *buffers[2];
+    uint back;
+    // Where the data channels start each time round, read by the control
+    // channels
+    const uint32_t *volatile frame_read_addr;
+    const uint32_t *row_read_addr;
+    uint32_t row_words[HUB75_ROWS * HUB75_BITS];
+} hub75_dma_t;
+
+// Pins are as in hub75.c: 6 data pins from rgb_base_pin, 5 row select pins
+// from rowsel_base_pin, and STROBE then OEn from strobe_pin. buffer0 (which
+// must already be filled in) is displayed first; buffer1 becomes the back
+// buffer. Both are HUB75_FRAME_WORDS long.
+void hub75_dma_init(hub75_dma_t *h, PIO pio, uint rgb_base_pin, uint clk_pin, uint rowsel_base_pin,
+                    uint strobe_pin, uint32_t *buffer0, uint32_t *buffer1);
+
+// The buffer which is not being displayed, for drawing into
+static inline uint32_t *hub75_dma_get_back_buffer(hub75_dma_t *h) {
+    return h->buffers[h->back];
+}
+
+// Display the back buffer from the start of the next frame. If wait_vsync is
+// true, block until the new frame has started, after which the old front
+// buffer (now the back buffer) is free to draw into. Otherwise the caller
+// must not touch the back buffer until hub75_dma_swap_done() returns true.
+void hub75_dma_swap_buffers(hub75_dma_t *h, bool wait_vsync);
+bool hub75_dma_swap_done(hub75_dma_t *h);
+
+#endif
@@ -0,0 +1,63 @@
+/**
+ * Copyright (c) 2022 Raspberry Pi (Trading) Ltd.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+#include <stdio.h>
+
+#include "pico/stdlib.h"
+#include "hub75_dma.h"
+
+#include "mountains_128x64_rgb565.h"
+
+// Same panel and wiring as hub75.c, but the refresh is done entirely by DMA
+// (see hub75_dma.h). The processor is only needed to draw new frames: here we
+// scroll the image sideways, converting each frame into the back buffer and
+// swapping it in at the next vsync.
+
+#define DATA_BASE_PIN 0
+#define ROWSEL_BASE_PIN 6
+#define CLK_PIN 11
+#define STROBE_PIN 12
+
+static uint32_t frame_buffers[2][HUB75_FRAME_WORDS];
+static uint16_t scrolled[HUB75_HEIGHT * HUB75_WIDTH];
+static hub75_dma_t hub75;
+
+int main() {
+    stdio_init_all();
+    pixel_format_init();
+
+    const uint16_t *img = (const uint16_t*)mountains_128x64;
+    hub75_planes_from_rgb565(frame_buffers[0], img);
+    hub75_dma_init(&hub75, pio0, DATA_BASE_PIN, CLK_PIN, ROWSEL_BASE_PIN, STROBE_PIN,
+                   frame_buffers[0], frame_buffers[1]);
+
+    uint scroll = 0;
+    uint frames = 0;
+    uint64_t busy_us = 0;
+    absolute_time_t next_report = make_timeout_time_ms(1000);
+    while (true) {
+        uint64_t start = time_us_64();
+        scroll = (scroll + 1) % HUB75_WIDTH;
+        for (uint y = 0; y < HUB75_HEIGHT; ++y)
+            for (uint x = 0; x < HUB75_WIDTH; ++x)
+                scrolled[y * HUB75_WIDTH + x] = img[y * HUB75_WIDTH + (x + scroll) % HUB75_WIDTH];
+        hub75_planes_from_rgb565(hub75_dma_get_back_buffer(&hub75), scrolled);
+        busy_us += time_us_64() - start;
+
+        hub75_dma_swap_buffers(&hub75, true);
+        ++frames;
+
+        // Slow the scroll down a bit; the panel keeps refreshing regardless
+        sleep_ms(20);
+
+        if (time_reached(next_report)) {
+            next_report = delayed_by_ms(next_report, 1000);
+            printf("%u frames drawn, %llu us per frame spent drawing\n", frames, busy_us / frames);
+            frames = 0;
+            busy_us = 0;
+        }
+    }
+}
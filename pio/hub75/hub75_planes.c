@@ -0,0 +1,30 @@
+/**
+ * Copyright (c) 2022 Raspberry Pi (Trading) Ltd.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+#include "hub75_planes.h"
+
+// OEn is asserted for (1 << bit) times this many cycles, for binary-coded
+// modulation of each bit plane
+#define HUB75_PULSE_UNIT 100u
+
+void hub75_planes_from_rgb565(uint32_t *frame, const uint16_t *img) {
+    uint32_t gc_row[2][HUB75_WIDTH];
+    for (uint row = 0; row < HUB75_ROWS; ++row) {
+        pixel_span_565_to_888_gamma(gc_row[0], img + row * HUB75_WIDTH, HUB75_WIDTH);
+        pixel_span_565_to_888_gamma(gc_row[1], img + (HUB75_ROWS + row) * HUB75_WIDTH, HUB75_WIDTH);
+        // Loop count for the data program at the start of each plane
+        for (uint bit = 0; bit < HUB75_BITS; ++bit)
+            frame[(row * HUB75_BITS + bit) * HUB75_PLANE_WORDS] = HUB75_WIDTH - 1;
+        pixel_span_888_to_planes(hub75_plane_pixels(frame, row, 0), HUB75_PLANE_WORDS * 4,
+                                 gc_row[0], gc_row[1], HUB75_WIDTH);
+    }
+}
+
+void hub75_planes_row_words(uint32_t *row_words) {
+    for (uint row = 0; row < HUB75_ROWS; ++row)
+        for (uint bit = 0; bit < HUB75_BITS; ++bit)
+            row_words[row * HUB75_BITS + bit] = row | (HUB75_PULSE_UNIT * (1u << bit) << 5);
+}
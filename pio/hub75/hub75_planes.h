@@ -0,0 +1,50 @@
+/**
+ * Copyright (c) 2022 Raspberry Pi (Trading) Ltd.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+#ifndef _HUB75_PLANES_H
+#define _HUB75_PLANES_H
+
+#include "pico.h"
+#include "pixel_format.h"
+
+// Conversion of an RGB565 image into the bit-plane ordered frame buffer which
+// the DMA refresh engine (hub75_dma.c) streams into the hub75_data_planes
+// program. This file has no hardware dependencies, so it also builds on the
+// host, where it can be checked against the original per-pixel path.
+
+#ifndef HUB75_WIDTH
+#define HUB75_WIDTH 128
+#endif
+#ifndef HUB75_HEIGHT
+#define HUB75_HEIGHT 64
+#endif
+
+// Upper and lower halves of the panel are scanned at the same time
+#define HUB75_ROWS (HUB75_HEIGHT / 2)
+#define HUB75_BITS 8
+
+// Each bit plane of each row is one pixel count word (for the PIO program's
+// loop counter), then one byte per column holding that bit of both halves:
+// bits 0..5 are R0, G0, B0, R1, G1, B1, in the same order as the data pins.
+#define HUB75_PLANE_WORDS (1 + HUB75_WIDTH / 4)
+#define HUB75_FRAME_WORDS (HUB75_ROWS * HUB75_BITS * HUB75_PLANE_WORDS)
+
+static_assert(!(HUB75_WIDTH & 3), "HUB75_WIDTH must be a multiple of 4");
+
+// Pointer to the pixel bytes of one plane in a frame buffer
+static inline uint8_t *hub75_plane_pixels(uint32_t *frame, uint row, uint bit) {
+    return (uint8_t *) (frame + (row * HUB75_BITS + bit) * HUB75_PLANE_WORDS + 1);
+}
+
+// Gamma correct a HUB75_WIDTH x HUB75_HEIGHT RGB565 image into a frame buffer
+// of HUB75_FRAME_WORDS words. pixel_format_init() must have been called.
+void hub75_planes_from_rgb565(uint32_t *frame, const uint16_t *img);
+
+// The OEn pulse width word for each row and bit, for the hub75_row_sync
+// program. These are the same for every frame.
+void hub75_planes_row_words(uint32_t *row_words);
+
+#endif
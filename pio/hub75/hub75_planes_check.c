@@ -0,0 +1,83 @@
+/**
+ * Copyright (c) 2022 Raspberry Pi (Trading) Ltd.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+#include <stdio.h>
+#include "pico/stdlib.h"
+#include "hub75_planes.h"
+
+#include "mountains_128x64_rgb565.h"
+
+// Check hub75_planes_from_rgb565() against the original per-pixel path in
+// hub75.c, for the mountains image and for every RGB565 value, then time it.
+//
+// hub75.c gamma corrects one row from each half of the panel, then for each
+// bit plane pushes the pair of RGB888 words for every column, and the
+// hub75_data_rgb888 program puts bits n, n + 8 and n + 16 of each onto
+// R0, G0, B0 (first word) and R1, G1, B1 (second word). Work out those pin
+// values here the slow way, and compare them with the frame buffer.
+
+static uint32_t frame[HUB75_FRAME_WORDS];
+
+static uint8_t reference_pins(uint32_t top, uint32_t bot, uint bit) {
+    uint8_t pins = 0;
+    for (uint lane = 0; lane < 2; ++lane) {
+        uint32_t pix = lane ? bot : top;
+        for (uint channel = 0; channel < 3; ++channel)
+            pins |= (pix >> (bit + 8 * channel) & 1u) << (3 * lane + channel);
+    }
+    return pins;
+}
+
+static uint check_image(const char *name, const uint16_t *img) {
+    uint errors = 0;
+    hub75_planes_from_rgb565(frame, img);
+    for (uint row = 0; row < HUB75_ROWS; ++row) {
+        for (uint bit = 0; bit < HUB75_BITS; ++bit) {
+            uint32_t count = frame[(row * HUB75_BITS + bit) * HUB75_PLANE_WORDS];
+            if (count != HUB75_WIDTH - 1)
+                ++errors;
+            const uint8_t *pixels = hub75_plane_pixels(frame, row, bit);
+            for (uint x = 0; x < HUB75_WIDTH; ++x) {
+                uint8_t expected = reference_pins(gamma_correct_565_888(img[row * HUB75_WIDTH + x]),
+                                                  gamma_correct_565_888(img[(HUB75_ROWS + row) * HUB75_WIDTH + x]),
+                                                  bit);
+                if (pixels[x] != expected) {
+                    if (!errors)
+                        printf("  first mismatch: row %d bit %d column %d: %02x != %02x\n", row, bit, x,
+                               pixels[x], expected);
+                    ++errors;
+                }
+            }
+        }
+    }
+    printf("%-10s %s (%u mismatches)\n", name, errors ? "FAILED" : "ok", errors);
+    return errors;
+}
+
+int main() {
+    stdio_init_all();
+    pixel_format_init();
+    static uint16_t test_img[HUB75_HEIGHT * HUB75_WIDTH];
+    uint errors = 0;
+
+    errors += check_image("mountains", (const uint16_t *) mountains_128x64);
+
+    // Every RGB565 value, to cover all the bits of every channel
+    static_assert(count_of(test_img) * 8 == 0x10000, "");
+    for (uint pass = 0; pass < 8; ++pass) {
+        for (uint i = 0; i < count_of(test_img); ++i)
+            test_img[i] = (uint16_t) (i * 8 + pass);
+        errors += check_image("all values", test_img);
+    }
+
+    uint64_t start = time_us_64();
+    for (int i = 0; i < 100; ++i)
+        hub75_planes_from_rgb565(frame, (const uint16_t *) mountains_128x64);
+    printf("conversion takes %llu us per frame\n", (time_us_64() - start) / 100);
+
+    printf(errors ? "Something went wrong\n" : "All good\n");
+    return errors ? 1 : 0;
+}
@@ -0,0 +1,67 @@
+/**
+ * Copyright (c) 2022 Raspberry Pi (Trading) Ltd.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+#include <stdio.h>
+
+#include "pico/stdlib.h"
+#include "pio_i2c.h"
+#include "pio_i2c_queue.h"
+
+// The same scan as i2c_bus_scan.c, but every probe goes into one list which
+// the DMA works through without the processor. The NAKs from the empty
+// addresses are picked up by the queue's interrupt handler, which marks that
+// probe as failed and moves on to the next.
+
+#define PIN_SDA 2
+#define PIN_SCL 3
+
+static bool reserved_addr(uint8_t addr) {
+    return (addr & 0x78) == 0 || (addr & 0x78) == 0x78;
+}
+
+static pio_i2c_queue_t queue;
+static pio_i2c_txn_t probes[1 << 7];
+
+int main() {
+    stdio_init_all();
+
+    PIO pio = pio0;
+    uint sm = 0;
+    uint offset = pio_add_program(pio, &i2c_program);
+    i2c_program_init(pio, sm, offset, PIN_SDA, PIN_SCL);
+    pio_i2c_queue_init(&queue, pio, sm);
+
+    printf("\nPIO I2C Bus Scan (DMA)\n");
+
+    // A 0-byte read from each address that isn't reserved
+    uint n_probes = 0;
+    for (uint addr = 0; addr < (1 << 7); ++addr) {
+        if (!reserved_addr(addr))
+            probes[n_probes++] = pio_i2c_txn_read(addr, NULL, 0);
+    }
+
+    absolute_time_t t0 = get_absolute_time();
+    if (pio_i2c_queue_submit(&queue, probes, n_probes, NULL, NULL) < 0)
+        panic("Scan list too long for the queue\n");
+    pio_i2c_queue_wait(&queue);
+    int64_t us = absolute_time_diff_us(t0, get_absolute_time());
+
+    printf("   0  1  2  3  4  5  6  7  8  9  A  B  C  D  E  F\n");
+    uint probe = 0;
+    for (uint addr = 0; addr < (1 << 7); ++addr) {
+        if (addr % 16 == 0) {
+            printf("%02x ", addr);
+        }
+        int result = -1;
+        if (!reserved_addr(addr))
+            result = probes[probe++].result;
+
+        printf(result < 0 ? "." : "@");
+        printf(addr % 16 == 15 ? "\n" : "  ");
+    }
+    printf("Done, %u addresses in %lld us.\n", n_probes, us);
+    return 0;
+}
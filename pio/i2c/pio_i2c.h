@@ -18,6 +18,9 @@ void pio_i2c_repstart(PIO pio, uint sm);
 bool pio_i2c_check_error(PIO pio, uint sm);
 void pio_i2c_resume_after_error(PIO pio, uint sm);
 
+// Enable/disable pushing the bytes seen on the bus to the RX FIFO
+void pio_i2c_rx_enable(PIO pio, uint sm, bool en);
+
 // If I2C is ok, block and push data. Otherwise fall straight through.
 void pio_i2c_put_or_err(PIO pio, uint sm, uint16_t data);
 uint8_t pio_i2c_get(PIO pio, uint sm);
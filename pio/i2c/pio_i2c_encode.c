@@ -0,0 +1,106 @@
+/**
+ * Copyright (c) 2022 Raspberry Pi (Trading) Ltd.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+#include "pio_i2c_encode.h"
+#include "hardware/pio_instructions.h"
+
+// As in pio_i2c.c
+static const int PIO_I2C_ICOUNT_LSB = 10;
+static const int PIO_I2C_FINAL_LSB  = 9;
+static const int PIO_I2C_DATA_LSB   = 1;
+static const int PIO_I2C_NAK_LSB    = 0;
+
+// Order of the set_scl_sda instruction table (I2C_SC0_SD0 etc. in i2c.pio.h,
+// which isn't available on the host)
+enum {
+    SC0_SD0 = 0,
+    SC0_SD1,
+    SC1_SD0,
+    SC1_SD1
+};
+
+typedef struct {
+    uint16_t *words;
+    uint n;
+    uint max;
+} word_stream_t;
+
+static inline void put16(word_stream_t *s, uint data) {
+    // Keep counting when full, so the caller can tell
+    if (s->n < s->max)
+        s->words[s->n] = (uint16_t) data;
+    ++s->n;
+}
+
+// The same sequences as pio_i2c_start(), pio_i2c_stop() and pio_i2c_repstart()
+static void put_start(word_stream_t *s, const uint16_t *scl_sda) {
+    put16(s, 1u << PIO_I2C_ICOUNT_LSB);
+    put16(s, scl_sda[SC1_SD0]);
+    put16(s, scl_sda[SC0_SD0]);
+}
+
+static void put_stop(word_stream_t *s, const uint16_t *scl_sda) {
+    put16(s, 2u << PIO_I2C_ICOUNT_LSB);
+    put16(s, scl_sda[SC0_SD0]);
+    put16(s, scl_sda[SC1_SD0]);
+    put16(s, scl_sda[SC1_SD1]);
+}
+
+static void put_repstart(word_stream_t *s, const uint16_t *scl_sda) {
+    put16(s, 3u << PIO_I2C_ICOUNT_LSB);
+    put16(s, scl_sda[SC0_SD1]);
+    put16(s, scl_sda[SC1_SD1]);
+    put16(s, scl_sda[SC1_SD0]);
+    put16(s, scl_sda[SC0_SD0]);
+}
+
+int pio_i2c_encode(pio_i2c_txn_t *txns, uint n_txns, const uint16_t *scl_sda, uint16_t *words, uint max_words,
+                   bool end_marker, uint *rx_count) {
+    if (n_txns && txns[n_txns - 1].nostop)
+        return -1;
+    word_stream_t s = {.words = words, .n = 0, .max = max_words};
+    uint rx = 0;
+    bool in_sequence = false;
+    for (uint i = 0; i < n_txns; ++i) {
+        pio_i2c_txn_t *t = &txns[i];
+        t->word_offset = (uint16_t) s.n;
+        t->rx_offset = (uint16_t) rx;
+        if (in_sequence)
+            put_repstart(&s, scl_sda);
+        else
+            put_start(&s, scl_sda);
+        if (t->read) {
+            // Address, then 0xff bytes to clock the data in, ACKing all but
+            // the last
+            put16(&s, (t->addr << 2) | 3u);
+            for (uint j = 0; j < t->len; ++j) {
+                bool last = j == t->len - 1;
+                put16(&s, (0xffu << PIO_I2C_DATA_LSB) |
+                          (last ? (1u << PIO_I2C_FINAL_LSB) | (1u << PIO_I2C_NAK_LSB) : 0));
+            }
+        } else {
+            put16(&s, (t->addr << 2) | 1u);
+            for (uint j = 0; j < t->len; ++j) {
+                bool last = j == t->len - 1;
+                put16(&s, (t->buf[j] << PIO_I2C_DATA_LSB) | (last << PIO_I2C_FINAL_LSB) | 1u);
+            }
+        }
+        rx += 1 + t->len;
+        in_sequence = t->nostop;
+        if (!in_sequence)
+            put_stop(&s, scl_sda);
+    }
+    if (end_marker) {
+        // Two instructions: push a byte, and pad to the minimum count
+        put16(&s, 1u << PIO_I2C_ICOUNT_LSB);
+        put16(&s, pio_encode_in(pio_null, 8));
+        put16(&s, pio_encode_nop());
+    }
+    if (s.n > max_words || s.n > 0xffff || rx > 0xffff)
+        return -1;
+    *rx_count = rx;
+    return (int) s.n;
+}
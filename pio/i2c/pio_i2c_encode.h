@@ -0,0 +1,56 @@
+/**
+ * Copyright (c) 2022 Raspberry Pi (Trading) Ltd.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+#ifndef _PIO_I2C_ENCODE_H
+#define _PIO_I2C_ENCODE_H
+
+#include "pico.h"
+
+// ----------------------------------------------------------------------------
+// Transaction descriptors, and their encoding as a TX FIFO word stream for
+// the i2c program (see i2c.pio), for pio_i2c_queue.c to DMA into the state
+// machine. The encoding is the same word for word as pio_i2c_write_blocking()
+// and pio_i2c_read_blocking() put into the FIFO one at a time.
+
+typedef struct {
+    uint8_t addr;
+    bool read;
+    // Follow this with a repeated start and the next descriptor, rather than
+    // a stop, e.g. to write a register number and then read the register
+    bool nostop;
+    uint8_t *buf;
+    uint len;
+    // Filled in: 0 on success, or -1 if the transfer was NAK'd (including the
+    // rest of a nostop sequence after the NAK)
+    int result;
+    // Filled in by the encoder: where this descriptor's words start in the TX
+    // stream, and its address byte in the RX stream (the state machine
+    // pushes one byte for every byte on the bus, in either direction)
+    uint16_t word_offset;
+    uint16_t rx_offset;
+} pio_i2c_txn_t;
+
+static inline pio_i2c_txn_t pio_i2c_txn_write(uint8_t addr, const uint8_t *src, uint len, bool nostop) {
+    return (pio_i2c_txn_t) {.addr = addr, .read = false, .nostop = nostop, .buf = (uint8_t *) src, .len = len};
+}
+
+static inline pio_i2c_txn_t pio_i2c_txn_read(uint8_t addr, uint8_t *dst, uint len) {
+    return (pio_i2c_txn_t) {.addr = addr, .read = true, .buf = dst, .len = len};
+}
+
+// Number of 16-bit words pio_i2c_encode() adds after the transactions when
+// asked for an end marker. The marker makes the state machine push one extra
+// RX byte, once everything before it has gone out on the bus.
+#define PIO_I2C_END_MARKER_WORDS 3
+
+// Encode n_txns descriptors into words. scl_sda is the instruction table from
+// the set_scl_sda program. Returns the number of words, or -1 if they don't
+// fit in max_words, or the last descriptor has nostop set. *rx_count is set to
+// the number of bytes the state machine will push, not counting the end
+// marker's.
+int pio_i2c_encode(pio_i2c_txn_t *txns, uint n_txns, const uint16_t *scl_sda, uint16_t *words, uint max_words,
+                   bool end_marker, uint *rx_count);
+
+#endif
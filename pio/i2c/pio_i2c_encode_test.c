@@ -0,0 +1,219 @@
+/**
+ * Copyright (c) 2022 Raspberry Pi (Trading) Ltd.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+#include <stdio.h>
+#include <string.h>
+#include "pico/stdlib.h"
+#include "pio_i2c_encode.h"
+
+// Check that pio_i2c_encode() produces exactly the words the blocking
+// functions in pio_i2c.c put into the TX FIFO, for the same transactions.
+// The test doesn't depend on pioasm, so the instructions it needs from
+// i2c.pio are written out here.
+
+// set_scl_sda from i2c.pio, as pioasm assembles it
+static const uint16_t scl_sda[4] = {
+    0xf780, // set pindirs, 0 side 0 [7]
+    0xf781, // set pindirs, 1 side 0 [7]
+    0xff80, // set pindirs, 0 side 1 [7]
+    0xff81, // set pindirs, 1 side 1 [7]
+};
+
+enum {
+    I2C_SC0_SD0 = 0,
+    I2C_SC0_SD1,
+    I2C_SC1_SD0,
+    I2C_SC1_SD1
+};
+
+#define set_scl_sda_program_instructions scl_sda
+
+const int PIO_I2C_ICOUNT_LSB = 10;
+const int PIO_I2C_FINAL_LSB  = 9;
+const int PIO_I2C_DATA_LSB   = 1;
+const int PIO_I2C_NAK_LSB    = 0;
+
+// Stand-in for the TX FIFO
+static uint16_t fifo[1024];
+static uint fifo_len;
+
+static void put16(uint16_t data) {
+    hard_assert(fifo_len < count_of(fifo));
+    fifo[fifo_len++] = data;
+}
+
+// --- The blocking path from pio_i2c.c, as it goes when all bytes are ACK'd ---
+
+static void pio_i2c_start(void) {
+    put16(1u << PIO_I2C_ICOUNT_LSB); // Escape code for 2 instruction sequence
+    put16(set_scl_sda_program_instructions[I2C_SC1_SD0]);    // We are already in idle state, just pull SDA low
+    put16(set_scl_sda_program_instructions[I2C_SC0_SD0]);    // Also pull clock low so we can present data
+}
+
+static void pio_i2c_stop(void) {
+    put16(2u << PIO_I2C_ICOUNT_LSB);
+    put16(set_scl_sda_program_instructions[I2C_SC0_SD0]);    // SDA is unknown; pull it down
+    put16(set_scl_sda_program_instructions[I2C_SC1_SD0]);    // Release clock
+    put16(set_scl_sda_program_instructions[I2C_SC1_SD1]);    // Release SDA to return to idle state
+}
+
+static void pio_i2c_repstart(void) {
+    put16(3u << PIO_I2C_ICOUNT_LSB);
+    put16(set_scl_sda_program_instructions[I2C_SC0_SD1]);
+    put16(set_scl_sda_program_instructions[I2C_SC1_SD1]);
+    put16(set_scl_sda_program_instructions[I2C_SC1_SD0]);
+    put16(set_scl_sda_program_instructions[I2C_SC0_SD0]);
+}
+
+// pio_i2c_write_blocking() and pio_i2c_read_blocking(), less the start and
+// stop, so that repeated start sequences can be put together from them too
+static void put_write(uint8_t addr, const uint8_t *txbuf, uint len) {
+    put16((addr << 2) | 1u);
+    while (len) {
+        --len;
+        put16((*txbuf++ << PIO_I2C_DATA_LSB) | ((len == 0) << PIO_I2C_FINAL_LSB) | 1u);
+    }
+}
+
+static void put_read(uint8_t addr, uint len) {
+    put16((addr << 2) | 3u);
+    uint32_t tx_remain = len;
+    while (tx_remain) {
+        --tx_remain;
+        put16((0xffu << 1) | (tx_remain ? 0 : (1u << PIO_I2C_FINAL_LSB) | (1u << PIO_I2C_NAK_LSB)));
+    }
+}
+
+static void write_blocking(uint8_t addr, const uint8_t *txbuf, uint len) {
+    pio_i2c_start();
+    put_write(addr, txbuf, len);
+    pio_i2c_stop();
+}
+
+static void read_blocking(uint8_t addr, uint len) {
+    pio_i2c_start();
+    put_read(addr, len);
+    pio_i2c_stop();
+}
+
+// ---
+
+static uint16_t words[1024];
+static uint failures;
+
+static void check(const char *name, pio_i2c_txn_t *txns, uint n_txns, uint expected_rx_count) {
+    uint rx_count = 0;
+    int n = pio_i2c_encode(txns, n_txns, scl_sda, words, count_of(words), false, &rx_count);
+    bool ok = n == (int) fifo_len && !memcmp(words, fifo, fifo_len * sizeof(uint16_t)) &&
+              rx_count == expected_rx_count;
+    // The offsets should point at each descriptor's start or repeated start
+    uint rx = 0;
+    for (uint i = 0; ok && i < n_txns; ++i) {
+        uint16_t first = words[txns[i].word_offset];
+        uint16_t expected_first = (i && txns[i - 1].nostop ? 3u : 1u) << PIO_I2C_ICOUNT_LSB;
+        if (first != expected_first || txns[i].rx_offset != rx)
+            ok = false;
+        rx += 1 + txns[i].len;
+    }
+    printf("%-32s %s\n", name, ok ? "ok" : "FAILED");
+    if (!ok) {
+        ++failures;
+        printf("  %d words, expected %u\n", n, fifo_len);
+    }
+    fifo_len = 0;
+}
+
+static void check_rejected(const char *name, pio_i2c_txn_t *txns, uint n_txns, uint max_words) {
+    uint rx_count;
+    bool ok = pio_i2c_encode(txns, n_txns, scl_sda, words, max_words, true, &rx_count) < 0;
+    printf("%-32s %s\n", name, ok ? "ok" : "FAILED");
+    if (!ok)
+        ++failures;
+}
+
+int main() {
+    stdio_init_all();
+    printf("PIO I2C transaction encoder test\n");
+
+    static const uint8_t data[] = {0x12, 0x34, 0x56, 0x78, 0x9a};
+    uint8_t rxbuf[16];
+
+    for (uint len = 0; len <= 3; ++len) {
+        write_blocking(0x3c, data, len);
+        pio_i2c_txn_t t[] = {pio_i2c_txn_write(0x3c, data, len, false)};
+        char name[32];
+        snprintf(name, sizeof(name), "write %u bytes", len);
+        check(name, t, count_of(t), 1 + len);
+    }
+    for (uint len = 0; len <= 3; ++len) {
+        read_blocking(0x68, len);
+        pio_i2c_txn_t t[] = {pio_i2c_txn_read(0x68, rxbuf, len)};
+        char name[32];
+        snprintf(name, sizeof(name), "read %u bytes", len);
+        check(name, t, count_of(t), 1 + len);
+    }
+    {
+        // Register read: write the register number, repeated start, read
+        pio_i2c_start();
+        put_write(0x76, data, 1);
+        pio_i2c_repstart();
+        put_read(0x76, 6);
+        pio_i2c_stop();
+        pio_i2c_txn_t t[] = {
+            pio_i2c_txn_write(0x76, data, 1, true),
+            pio_i2c_txn_read(0x76, rxbuf, 6),
+        };
+        check("write, repstart, read", t, count_of(t), 2 + 7);
+    }
+    {
+        // A mixture, including two repeated starts in a row
+        write_blocking(0x10, data, 5);
+        pio_i2c_start();
+        put_write(0x20, data + 1, 2);
+        pio_i2c_repstart();
+        put_write(0x20, data + 3, 1);
+        pio_i2c_repstart();
+        put_read(0x21, 4);
+        pio_i2c_stop();
+        read_blocking(0x30, 1);
+        pio_i2c_txn_t t[] = {
+            pio_i2c_txn_write(0x10, data, 5, false),
+            pio_i2c_txn_write(0x20, data + 1, 2, true),
+            pio_i2c_txn_write(0x20, data + 3, 1, true),
+            pio_i2c_txn_read(0x21, rxbuf, 4),
+            pio_i2c_txn_read(0x30, rxbuf, 1),
+        };
+        check("mixed list", t, count_of(t), 6 + 3 + 2 + 5 + 2);
+    }
+    {
+        // i2c_bus_scan: a 0 byte read of every address
+        static pio_i2c_txn_t t[128];
+        for (uint addr = 0; addr < 128; ++addr) {
+            read_blocking(addr, 0);
+            t[addr] = pio_i2c_txn_read(addr, NULL, 0);
+        }
+        check("bus scan", t, count_of(t), 128);
+    }
+
+    {
+        pio_i2c_txn_t t[] = {pio_i2c_txn_write(0x3c, data, 5, true)};
+        check_rejected("rejects nostop at the end", t, count_of(t), count_of(words));
+    }
+    {
+        // 3 + 1 + 5 + 4 words, plus the end marker
+        pio_i2c_txn_t t[] = {pio_i2c_txn_write(0x3c, data, 5, false)};
+        check_rejected("rejects too many words", t, count_of(t), 13 + PIO_I2C_END_MARKER_WORDS - 1);
+        uint rx_count;
+        bool ok = pio_i2c_encode(t, count_of(t), scl_sda, words, 13 + PIO_I2C_END_MARKER_WORDS, true, &rx_count) ==
+                  13 + PIO_I2C_END_MARKER_WORDS;
+        printf("%-32s %s\n", "fits exactly, with end marker", ok ? "ok" : "FAILED");
+        if (!ok)
+            ++failures;
+    }
+
+    printf(failures ? "FAILED\n" : "All good\n");
+    return failures ? 1 : 0;
+}
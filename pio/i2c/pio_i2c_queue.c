@@ -0,0 +1,165 @@
+/**
+ * Copyright (c) 2022 Raspberry Pi (Trading) Ltd.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+#include <string.h>
+#include "pio_i2c_queue.h"
+#include "hardware/dma.h"
+#include "hardware/irq.h"
+
+static pio_i2c_queue_t *queues[PIO_I2C_QUEUE_MAX_QUEUES];
+static bool pio_irq_installed[2];
+static bool dma_irq_installed;
+
+static void pio_i2c_queue_finish(pio_i2c_queue_t *q) {
+    pio_set_irq0_source_enabled(q->pio, pis_interrupt0 + q->sm, false);
+    // Everything the state machine pushed is in q->rx, address bytes and all
+    for (uint i = 0; i < q->n_txns; ++i) {
+        pio_i2c_txn_t *t = &q->txns[i];
+        if (t->read && !t->result)
+            memcpy(t->buf, q->rx + t->rx_offset + 1, t->len);
+    }
+    q->busy = false;
+    if (q->callback)
+        q->callback(q, q->user_data);
+}
+
+static void pio_i2c_queue_handle_nak(pio_i2c_queue_t *q) {
+    // Stop both channels where they are. An abort can raise a spurious
+    // completion interrupt (RP2040-E13), so mask it whilst aborting.
+    dma_channel_abort(q->dma_tx);
+    dma_channel_set_irq0_enabled(q->dma_rx, false);
+    dma_channel_abort(q->dma_rx);
+    dma_hw->ints0 = 1u << q->dma_rx;
+    dma_channel_set_irq0_enabled(q->dma_rx, true);
+
+    // Each byte is pushed before its ACK bit, so the last byte pushed is the
+    // one which was NAK'd
+    uint pushed = (uint8_t *) (uintptr_t) dma_channel_hw_addr(q->dma_rx)->write_addr - q->rx;
+    pushed += pio_sm_get_rx_fifo_level(q->pio, q->sm);
+    while (!pio_sm_is_rx_fifo_empty(q->pio, q->sm))
+        (void) pio_sm_get(q->pio, q->sm);
+
+    // Fail that transaction, and the rest of its repeated start sequence
+    uint i = 0;
+    while (i < q->n_txns - 1 && q->txns[i].rx_offset + 1u + q->txns[i].len < pushed)
+        ++i;
+    while (true) {
+        q->txns[i].result = -1;
+        if (!q->txns[i].nostop)
+            break;
+        ++i;
+    }
+
+    // Finish it off as the blocking functions do, then carry on from the next
+    // transaction (or just the end marker)
+    pio_i2c_resume_after_error(q->pio, q->sm);
+    pio_i2c_stop(q->pio, q->sm);
+    uint next = i + 1;
+    uint word_offset = next < q->n_txns ? q->txns[next].word_offset : q->n_words - PIO_I2C_END_MARKER_WORDS;
+    uint rx_offset = next < q->n_txns ? q->txns[next].rx_offset : q->rx_count;
+    dma_channel_transfer_to_buffer_now(q->dma_rx, q->rx + rx_offset, q->rx_count + 1 - rx_offset);
+    dma_channel_transfer_from_buffer_now(q->dma_tx, q->words + word_offset, q->n_words - word_offset);
+}
+
+static void __isr pio_i2c_queue_pio_irq(void) {
+    for (uint i = 0; i < count_of(queues); ++i) {
+        pio_i2c_queue_t *q = queues[i];
+        if (q && q->busy && pio_i2c_check_error(q->pio, q->sm))
+            pio_i2c_queue_handle_nak(q);
+    }
+}
+
+static void __isr pio_i2c_queue_dma_irq(void) {
+    for (uint i = 0; i < count_of(queues); ++i) {
+        pio_i2c_queue_t *q = queues[i];
+        if (q && (dma_hw->ints0 & (1u << q->dma_rx))) {
+            dma_hw->ints0 = 1u << q->dma_rx;
+            // The end marker is only pushed once the last stop has gone out
+            if (q->busy)
+                pio_i2c_queue_finish(q);
+        }
+    }
+}
+
+void pio_i2c_queue_init(pio_i2c_queue_t *q, PIO pio, uint sm) {
+    q->pio = pio;
+    q->sm = sm;
+    q->busy = false;
+
+    // TX: halfword writes, as the i2c program expects (see pio_i2c_put16())
+    q->dma_tx = dma_claim_unused_channel(true);
+    dma_channel_config c = dma_channel_get_default_config(q->dma_tx);
+    channel_config_set_transfer_data_size(&c, DMA_SIZE_16);
+    channel_config_set_dreq(&c, pio_get_dreq(pio, sm, true));
+    dma_channel_configure(q->dma_tx, &c, &pio->txf[sm], NULL, 0, false);
+
+    // RX: one byte per FIFO entry, into q->rx
+    q->dma_rx = dma_claim_unused_channel(true);
+    c = dma_channel_get_default_config(q->dma_rx);
+    channel_config_set_transfer_data_size(&c, DMA_SIZE_8);
+    channel_config_set_read_increment(&c, false);
+    channel_config_set_write_increment(&c, true);
+    channel_config_set_dreq(&c, pio_get_dreq(pio, sm, false));
+    dma_channel_configure(q->dma_rx, &c, q->rx, &pio->rxf[sm], 0, false);
+    dma_channel_set_irq0_enabled(q->dma_rx, true);
+
+    uint slot = 0;
+    while (slot < count_of(queues) && queues[slot])
+        ++slot;
+    hard_assert(slot < count_of(queues));
+    queues[slot] = q;
+
+    // The NAK flag only raises an interrupt whilst a list is being worked
+    // on, so the blocking functions can still be used in between
+    uint pio_index = pio_get_index(pio);
+    if (!pio_irq_installed[pio_index]) {
+        uint irq = pio_index ? PIO1_IRQ_0 : PIO0_IRQ_0;
+        irq_add_shared_handler(irq, pio_i2c_queue_pio_irq, PICO_SHARED_IRQ_HANDLER_DEFAULT_ORDER_PRIORITY);
+        irq_set_enabled(irq, true);
+        pio_irq_installed[pio_index] = true;
+    }
+    if (!dma_irq_installed) {
+        irq_add_shared_handler(DMA_IRQ_0, pio_i2c_queue_dma_irq, PICO_SHARED_IRQ_HANDLER_DEFAULT_ORDER_PRIORITY);
+        irq_set_enabled(DMA_IRQ_0, true);
+        dma_irq_installed = true;
+    }
+}
+
+int pio_i2c_queue_submit(pio_i2c_queue_t *q, pio_i2c_txn_t *txns, uint n_txns, pio_i2c_queue_callback_t callback,
+                         void *user_data) {
+    if (q->busy)
+        return -1;
+    uint rx_count;
+    int n_words = pio_i2c_encode(txns, n_txns, set_scl_sda_program_instructions, q->words, count_of(q->words), true,
+                                 &rx_count);
+    if (n_words < 0 || rx_count > PIO_I2C_QUEUE_MAX_RX)
+        return -1;
+    for (uint i = 0; i < n_txns; ++i)
+        txns[i].result = 0;
+    q->txns = txns;
+    q->n_txns = n_txns;
+    q->n_words = (uint) n_words;
+    q->rx_count = rx_count;
+    q->callback = callback;
+    q->user_data = user_data;
+    q->busy = true;
+
+    // Every byte is pushed, including writes, so the RX stream lines up with
+    // the descriptors' rx_offset
+    pio_i2c_rx_enable(q->pio, q->sm, true);
+    while (!pio_sm_is_rx_fifo_empty(q->pio, q->sm))
+        (void) pio_sm_get(q->pio, q->sm);
+    pio_set_irq0_source_enabled(q->pio, pis_interrupt0 + q->sm, true);
+    dma_channel_transfer_to_buffer_now(q->dma_rx, q->rx, rx_count + 1);
+    dma_channel_transfer_from_buffer_now(q->dma_tx, q->words, q->n_words);
+    return 0;
+}
+
+void pio_i2c_queue_wait(const pio_i2c_queue_t *q) {
+    // The completion interrupt is an event, so this wakes up in time
+    while (q->busy)
+        __wfe();
+}
@@ -0,0 +1,77 @@
+/**
+ * Copyright (c) 2022 Raspberry Pi (Trading) Ltd.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+#ifndef _PIO_I2C_QUEUE_H
+#define _PIO_I2C_QUEUE_H
+
+#include "pio_i2c.h"
+#include "pio_i2c_encode.h"
+
+// ----------------------------------------------------------------------------
+// DMA-driven transaction queues
+//
+// Instead of the processor feeding the state machine a word at a time, a
+// whole list of transactions is encoded up front (see pio_i2c_encode.h), and
+// one DMA channel streams the words into the TX FIFO whilst another takes
+// every byte out of the RX FIFO. A callback runs, from an interrupt, once the
+// last transaction has finished on the bus.
+//
+// A NAK stops the state machine as usual. The interrupt handler marks the
+// transaction it happened in as failed, sends a stop, and carries on with the
+// next one, so one missing device doesn't hold up the rest of the list.
+//
+// Each state machine running the i2c program can have its own queue, so
+// several buses can run at once.
+
+#ifndef PIO_I2C_QUEUE_MAX_WORDS
+#define PIO_I2C_QUEUE_MAX_WORDS 1024
+#endif
+
+#ifndef PIO_I2C_QUEUE_MAX_RX
+#define PIO_I2C_QUEUE_MAX_RX 256
+#endif
+
+#define PIO_I2C_QUEUE_MAX_QUEUES 8
+
+typedef struct pio_i2c_queue pio_i2c_queue_t;
+
+typedef void (*pio_i2c_queue_callback_t)(pio_i2c_queue_t *q, void *user_data);
+
+struct pio_i2c_queue {
+    PIO pio;
+    uint sm;
+    uint dma_tx;
+    uint dma_rx;
+    volatile bool busy;
+    // The list being worked on
+    pio_i2c_txn_t *txns;
+    uint n_txns;
+    uint n_words;
+    uint rx_count;
+    pio_i2c_queue_callback_t callback;
+    void *user_data;
+    uint16_t words[PIO_I2C_QUEUE_MAX_WORDS];
+    uint8_t rx[PIO_I2C_QUEUE_MAX_RX + 1]; // +1 for the end marker
+};
+
+// Set up a queue for a state machine which is already running the i2c
+// program (see i2c_program_init()). Claims two DMA channels.
+void pio_i2c_queue_init(pio_i2c_queue_t *q, PIO pio, uint sm);
+
+// Start working through a list of transactions. The list, and the buffers it
+// points to, must be left alone until the callback (which may be NULL) has
+// been called. Returns 0, or -1 if the queue is still busy or the list is too
+// long.
+int pio_i2c_queue_submit(pio_i2c_queue_t *q, pio_i2c_txn_t *txns, uint n_txns, pio_i2c_queue_callback_t callback,
+                         void *user_data);
+
+static inline bool pio_i2c_queue_is_busy(const pio_i2c_queue_t *q) {
+    return q->busy;
+}
+
+// Sleep until the queue has finished its current list
+void pio_i2c_queue_wait(const pio_i2c_queue_t *q);
+
+#endif
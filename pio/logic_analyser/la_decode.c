@@ -0,0 +1,83 @@
+/**
+ * Copyright (c) 2022 Raspberry Pi (Trading) Ltd.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+// Host tool: read the output of logic_analyser_stream (e.g. from the serial
+// port), and expand the run-length encoded capture in it to raw samples, one
+// to four bytes per sample, which sigrok-cli and PulseView can import with
+// the "binary" input format:
+//
+//   la_decode capture.bin < /dev/ttyACM0
+//   sigrok-cli -I binary:numchannels=2:samplerate=125000000 -i capture.bin ...
+//
+// Any text before the stream (the example's start-up messages) is skipped.
+
+#include <stdio.h>
+#include <string.h>
+#include "la_rle.h"
+
+int main(int argc, char **argv) {
+    if (argc != 2) {
+        fprintf(stderr, "Usage: %s <output file>  (stream on stdin)\n", argv[0]);
+        return 1;
+    }
+    FILE *out = fopen(argv[1], "wb");
+    if (!out) {
+        perror(argv[1]);
+        return 1;
+    }
+
+    // Look for the header
+    uint8_t header_bytes[LA_RLE_HEADER_BYTES];
+    la_rle_header_t header;
+    uint have = 0;
+    int c;
+    while (true) {
+        if ((c = getchar()) == EOF) {
+            fprintf(stderr, "No logic analyser stream found\n");
+            return 1;
+        }
+        if (have < LA_RLE_HEADER_BYTES) {
+            header_bytes[have++] = (uint8_t) c;
+        } else {
+            memmove(header_bytes, header_bytes + 1, LA_RLE_HEADER_BYTES - 1);
+            header_bytes[LA_RLE_HEADER_BYTES - 1] = (uint8_t) c;
+        }
+        if (have == LA_RLE_HEADER_BYTES && la_rle_parse_header(header_bytes, &header))
+            break;
+    }
+    fprintf(stderr, "%u pins from GPIO %u, %u samples/s, trigger after %u samples\n", header.pin_count,
+            header.pin_base, header.sample_rate_hz, header.pre_trigger);
+
+    la_rle_decoder_t d;
+    la_rle_decoder_init(&d, header.pin_count);
+    uint bytes_per_sample = la_bytes_per_sample(header.pin_count);
+    uint64_t total = 0;
+    uint32_t flags = 0;
+    bool ended = false;
+    while (!ended && (c = getchar()) != EOF) {
+        uint32_t value, run;
+        int r = la_rle_decode_byte(&d, (uint8_t) c, &value, &run);
+        if (r > 0) {
+            uint8_t sample[4];
+            for (uint i = 0; i < bytes_per_sample; ++i)
+                sample[i] = (uint8_t) (value >> (8 * i));
+            for (uint32_t i = 0; i < run; ++i)
+                fwrite(sample, bytes_per_sample, 1, out);
+            total += run;
+        } else if (r < 0) {
+            ended = true;
+            flags = value;
+        }
+    }
+    fclose(out);
+
+    fprintf(stderr, "%llu samples written%s%s\n", (unsigned long long) total,
+            flags & LA_RLE_END_OVERRUN ? ", stopped early: capture overran" : "",
+            ended ? "" : ", stream ended without an end record");
+    fprintf(stderr, "sigrok-cli -I binary:numchannels=%u:samplerate=%u -i %s\n", header.pin_count,
+            header.sample_rate_hz, argv[1]);
+    return ended ? 0 : 1;
+}
@@ -0,0 +1,147 @@
+/**
+ * Copyright (c) 2022 Raspberry Pi (Trading) Ltd.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+#include <string.h>
+#include "la_rle.h"
+
+static void put_u32(uint8_t *p, uint32_t x) {
+    for (uint i = 0; i < 4; ++i)
+        p[i] = (uint8_t) (x >> (8 * i));
+}
+
+static uint32_t get_u32(const uint8_t *p) {
+    return p[0] | p[1] << 8 | p[2] << 16 | (uint32_t) p[3] << 24;
+}
+
+void la_rle_write_header(uint8_t *out, const la_rle_header_t *header) {
+    memcpy(out, LA_RLE_MAGIC, 4);
+    out[4] = LA_RLE_VERSION;
+    out[5] = header->pin_count;
+    out[6] = header->pin_base;
+    out[7] = 0;
+    put_u32(out + 8, header->sample_rate_hz);
+    put_u32(out + 12, header->pre_trigger);
+}
+
+bool la_rle_parse_header(const uint8_t *in, la_rle_header_t *header) {
+    if (memcmp(in, LA_RLE_MAGIC, 4) || in[4] != LA_RLE_VERSION || in[5] < 1 || in[5] > 32)
+        return false;
+    header->pin_count = in[5];
+    header->pin_base = in[6];
+    header->sample_rate_hz = get_u32(in + 8);
+    header->pre_trigger = get_u32(in + 12);
+    return true;
+}
+
+void la_rle_encoder_init(la_rle_encoder_t *e, uint pin_count) {
+    e->pin_count = pin_count;
+    e->samples_per_word = la_samples_per_word(pin_count);
+    e->unused_bits = 32 - la_bits_packed_per_word(pin_count);
+    e->bytes_per_sample = la_bytes_per_sample(pin_count);
+    e->sample_mask = pin_count == 32 ? 0xffffffffu : (1u << pin_count) - 1;
+    // The LSB of every sample in a word, so that multiplying a sample value
+    // by this gives a word full of that value
+    e->replicate = 0;
+    for (uint i = 0; i < e->samples_per_word; ++i)
+        e->replicate |= 1u << (i * pin_count);
+    e->value = 0;
+    e->run = 0;
+}
+
+static inline uint8_t *put_record(uint8_t *p, uint bytes_per_sample, uint32_t value, uint32_t run) {
+    for (uint i = 0; i < bytes_per_sample; ++i) {
+        *p++ = (uint8_t) value;
+        value >>= 8;
+    }
+    while (run >= 0x80) {
+        *p++ = (uint8_t) (run | 0x80);
+        run >>= 7;
+    }
+    *p++ = (uint8_t) run;
+    return p;
+}
+
+uint __not_in_flash_func(la_rle_encode)(la_rle_encoder_t *e, const uint32_t *words, uint first, uint n,
+                                        uint8_t *out, uint *out_len, uint out_size) {
+    const uint spw = e->samples_per_word;
+    const uint pin_count = e->pin_count;
+    const uint space_needed = spw * LA_RLE_MAX_RECORD_BYTES;
+    uint8_t *p = out + *out_len;
+    uint8_t *end = out + out_size;
+    uint32_t value = e->value;
+    uint32_t run = e->run;
+    uint32_t pattern = value * e->replicate;
+    uint w = first / spw;
+    uint k = first % spw;
+    uint remaining = n;
+    while (remaining && (uint) (end - p) >= space_needed) {
+        uint32_t x = words[w++] >> e->unused_bits;
+        if (!k && remaining >= spw && x == pattern && run <= 0xffffffffu - spw) {
+            // The whole word continues the current run, which is the usual
+            // case for a logic trace
+            run += spw;
+            remaining -= spw;
+            continue;
+        }
+        uint take = spw - k;
+        if (take > remaining)
+            take = remaining;
+        for (uint i = k; i < k + take; ++i) {
+            uint32_t s = (x >> (i * pin_count)) & e->sample_mask;
+            if (s == value && run != 0xffffffffu) {
+                ++run;
+            } else {
+                if (run)
+                    p = put_record(p, e->bytes_per_sample, value, run);
+                value = s;
+                run = 1;
+            }
+        }
+        pattern = value * e->replicate;
+        remaining -= take;
+        k = 0;
+    }
+    e->value = value;
+    e->run = run;
+    *out_len = p - out;
+    return n - remaining;
+}
+
+uint la_rle_encode_end(la_rle_encoder_t *e, uint32_t flags, uint8_t *out) {
+    uint8_t *p = out;
+    if (e->run)
+        p = put_record(p, e->bytes_per_sample, e->value, e->run);
+    p = put_record(p, e->bytes_per_sample, flags, 0);
+    e->run = 0;
+    return p - out;
+}
+
+void la_rle_decoder_init(la_rle_decoder_t *d, uint pin_count) {
+    d->bytes_per_sample = la_bytes_per_sample(pin_count);
+    d->state = 0;
+    d->value = 0;
+    d->run = 0;
+    d->shift = 0;
+}
+
+int la_rle_decode_byte(la_rle_decoder_t *d, uint8_t byte, uint32_t *value, uint32_t *run) {
+    if (d->state < d->bytes_per_sample) {
+        d->value |= (uint32_t) byte << (8 * d->state++);
+        return 0;
+    }
+    if (d->shift < 32)
+        d->run |= (uint32_t) (byte & 0x7fu) << d->shift;
+    d->shift += 7;
+    if (byte & 0x80)
+        return 0;
+    *value = d->value;
+    *run = d->run;
+    d->state = 0;
+    d->value = 0;
+    d->run = 0;
+    d->shift = 0;
+    return *run ? 1 : -1;
+}
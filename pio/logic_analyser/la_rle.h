@@ -0,0 +1,102 @@
+/**
+ * Copyright (c) 2022 Raspberry Pi (Trading) Ltd.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+#ifndef _LA_RLE_H
+#define _LA_RLE_H
+
+#include "pico.h"
+
+// Run-length encoding of logic analyser captures, straight from the words the
+// capture state machine pushes (see logic_analyser.c): each word holds as
+// many pin_count-bit samples as fit, left-justified, oldest sample lowest.
+//
+// The encoded stream is a header followed by records, each record being one
+// sample value (1 to 4 bytes, little-endian, bit 0 = first captured pin)
+// followed by how many times it repeats (an unsigned LEB128 varint). A record
+// with a repeat count of 0 ends the stream; its value holds LA_RLE_END_*
+// flags. la_decode.c expands a stream to raw samples for sigrok-cli.
+
+#define LA_RLE_HEADER_BYTES 16
+#define LA_RLE_MAGIC "LARL"
+#define LA_RLE_VERSION 1
+
+// Worst case size of a single record
+#define LA_RLE_MAX_RECORD_BYTES 9
+
+// Flags in the end record
+#define LA_RLE_END_OVERRUN 1u // Samples were lost, so the stream stops early
+
+typedef struct {
+    uint8_t pin_count;
+    uint8_t pin_base;
+    uint32_t sample_rate_hz;
+    // Samples in the stream before the trigger
+    uint32_t pre_trigger;
+} la_rle_header_t;
+
+// Samples per FIFO word for a given pin count, as the capture program packs them
+static inline uint la_bits_packed_per_word(uint pin_count) {
+    // If the number of pins to be sampled divides the shift register size, we
+    // can use the full SR and FIFO width, and push when the input shift count
+    // exactly reaches 32. If not, we have to push earlier, so we use the FIFO
+    // a little less efficiently.
+    const uint SHIFT_REG_WIDTH = 32;
+    return SHIFT_REG_WIDTH - (SHIFT_REG_WIDTH % pin_count);
+}
+
+static inline uint la_samples_per_word(uint pin_count) {
+    return la_bits_packed_per_word(pin_count) / pin_count;
+}
+
+static inline uint la_bytes_per_sample(uint pin_count) {
+    return (pin_count + 7) / 8;
+}
+
+void la_rle_write_header(uint8_t *out, const la_rle_header_t *header);
+bool la_rle_parse_header(const uint8_t *in, la_rle_header_t *header);
+
+typedef struct {
+    uint pin_count;
+    uint samples_per_word;
+    uint unused_bits; // LSBs of each word with no samples in
+    uint bytes_per_sample;
+    uint32_t sample_mask;
+    uint32_t replicate;
+    // Current run
+    uint32_t value;
+    uint32_t run;
+} la_rle_encoder_t;
+
+void la_rle_encoder_init(la_rle_encoder_t *e, uint pin_count);
+
+// Encode n samples, starting with sample `first` of words[], into out. Stops
+// early, at the end of a word, once fewer than
+// la_samples_per_word() * LA_RLE_MAX_RECORD_BYTES bytes of space remain.
+// Returns the number of samples consumed, and adds the bytes written to
+// *out_len. The last run is held back until la_rle_encode_end().
+uint la_rle_encode(la_rle_encoder_t *e, const uint32_t *words, uint first, uint n, uint8_t *out, uint *out_len,
+                   uint out_size);
+
+// Write out the last run and the end record. Needs 2 * LA_RLE_MAX_RECORD_BYTES
+// of space; returns the number of bytes written.
+uint la_rle_encode_end(la_rle_encoder_t *e, uint32_t flags, uint8_t *out);
+
+typedef struct {
+    uint bytes_per_sample;
+    uint state; // Bytes of value read, then LEB128 bytes read
+    uint32_t value;
+    uint32_t run;
+    uint shift;
+} la_rle_decoder_t;
+
+void la_rle_decoder_init(la_rle_decoder_t *d, uint pin_count);
+
+// Feed the decoder one byte. Returns 1 when a record is complete, with the
+// sample value and repeat count in *value and *run, 0 if more bytes are
+// needed, or -1 at the end record (and *value holds its flags).
+int la_rle_decode_byte(la_rle_decoder_t *d, uint8_t byte, uint32_t *value, uint32_t *run);
+
+#endif
@@ -0,0 +1,170 @@
+/**
+ * Copyright (c) 2022 Raspberry Pi (Trading) Ltd.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+#include <stdio.h>
+#include <string.h>
+#include "pico/stdlib.h"
+#include "la_rle.h"
+#include "test_rand.h"
+
+// Round trip synthetic captures through the encoder and decoder in la_rle.c,
+// for a range of pin counts and signals, and measure how many samples per
+// second the encoder gets through. The pin counts include ones which leave
+// unused bits at the top of each word, and 32, where none do.
+
+#define TEST_SAMPLES 8192
+#define BENCH_WORDS 8192
+#define BENCH_PASSES 16
+
+static uint32_t samples[TEST_SAMPLES];
+static uint32_t words[BENCH_WORDS];
+static uint8_t encoded[TEST_SAMPLES * LA_RLE_MAX_RECORD_BYTES + 2 * LA_RLE_MAX_RECORD_BYTES];
+
+typedef enum {
+    SIGNAL_IDLE_WITH_BURSTS,
+    SIGNAL_CLOCK,
+    SIGNAL_RANDOM,
+    SIGNAL_COUNT
+} signal_t;
+
+static const char *signal_names[SIGNAL_COUNT] = {
+    "idle with bursts",
+    "clock and counter",
+    "random",
+};
+
+// Samples first .. first + n - 1 of a signal
+static void make_signal(uint32_t *dst, uint first, uint n, signal_t signal, uint32_t mask) {
+    uint32_t value = next_rand() & mask;
+    for (uint i = first; i < first + n; ++i) {
+        switch (signal) {
+            case SIGNAL_IDLE_WITH_BURSTS:
+                // Mostly constant, with the odd burst of activity
+                if ((i & 1023) >= 1000 || !(next_rand() & 2047))
+                    value = next_rand() & mask;
+                break;
+            case SIGNAL_CLOCK:
+                // Pin 0 toggles every 4 samples, and the others count
+                value = (i >> 2) & mask;
+                break;
+            default:
+                value = next_rand() & mask;
+                break;
+        }
+        dst[i - first] = value;
+    }
+}
+
+// Pack samples the way the capture state machine does
+static void pack_samples(uint32_t *dst, const uint32_t *src, uint n, uint pin_count) {
+    uint spw = la_samples_per_word(pin_count);
+    uint unused_bits = 32 - la_bits_packed_per_word(pin_count);
+    memset(dst, 0, (n + spw - 1) / spw * sizeof(uint32_t));
+    for (uint i = 0; i < n; ++i)
+        dst[i / spw] |= src[i] << (unused_bits + (i % spw) * pin_count);
+}
+
+static uint round_trip(uint pin_count, signal_t signal) {
+    uint32_t mask = pin_count == 32 ? 0xffffffffu : (1u << pin_count) - 1;
+    make_signal(samples, 0, TEST_SAMPLES, signal, mask);
+    pack_samples(words, samples, TEST_SAMPLES, pin_count);
+
+    // Start part way into a word, and feed the encoder in random sized pieces
+    // with a small output window, as logic_analyser_stream.c does
+    la_rle_encoder_t e;
+    la_rle_encoder_init(&e, pin_count);
+    uint first = next_rand() % la_samples_per_word(pin_count);
+    uint len = 0;
+    uint done = first;
+    while (done < TEST_SAMPLES) {
+        uint n = 1 + next_rand() % 300;
+        if (n > TEST_SAMPLES - done)
+            n = TEST_SAMPLES - done;
+        uint window = len + la_samples_per_word(pin_count) * LA_RLE_MAX_RECORD_BYTES + next_rand() % 64;
+        done += la_rle_encode(&e, words, done, n, encoded, &len, window);
+    }
+    len += la_rle_encode_end(&e, LA_RLE_END_OVERRUN, encoded + len);
+
+    la_rle_decoder_t d;
+    la_rle_decoder_init(&d, pin_count);
+    uint pos = first;
+    uint errors = 0;
+    bool ended = false;
+    for (uint i = 0; i < len && !ended; ++i) {
+        uint32_t value, run;
+        int r = la_rle_decode_byte(&d, encoded[i], &value, &run);
+        if (r > 0) {
+            for (uint32_t j = 0; j < run; ++j, ++pos) {
+                if (pos >= TEST_SAMPLES || samples[pos] != value) {
+                    if (!errors)
+                        printf("  first mismatch at sample %u\n", pos);
+                    ++errors;
+                }
+            }
+        } else if (r < 0) {
+            ended = true;
+            if (value != LA_RLE_END_OVERRUN || i != len - 1)
+                ++errors;
+        }
+    }
+    if (!ended || pos != TEST_SAMPLES)
+        ++errors;
+    if (errors)
+        printf("%2u pins, %-18s FAILED\n", pin_count, signal_names[signal]);
+    return errors;
+}
+
+static void bench(uint pin_count, signal_t signal) {
+    uint32_t mask = pin_count == 32 ? 0xffffffffu : (1u << pin_count) - 1;
+    uint spw = la_samples_per_word(pin_count);
+    uint n_samples = BENCH_WORDS * spw;
+    // Make the signal a chunk at a time, as there isn't room for all of it
+    for (uint i = 0; i < n_samples; i += TEST_SAMPLES) {
+        uint n = MIN(TEST_SAMPLES, n_samples - i);
+        make_signal(samples, i, n, signal, mask);
+        pack_samples(words + i / spw, samples, n, pin_count);
+    }
+
+    static uint8_t out[4096];
+    la_rle_encoder_t e;
+    la_rle_encoder_init(&e, pin_count);
+    uint64_t total_bytes = 0;
+    uint64_t start = time_us_64();
+    for (uint pass = 0; pass < BENCH_PASSES; ++pass) {
+        uint done = 0;
+        while (done < n_samples) {
+            uint len = 0;
+            done += la_rle_encode(&e, words, done, n_samples - done, out, &len, sizeof(out));
+            total_bytes += len;
+        }
+    }
+    uint64_t elapsed = time_us_64() - start;
+    double total_samples = (double) n_samples * BENCH_PASSES;
+    printf("%2u pins, %-18s %8.2f Msamples/s, %6.1f%% of raw size\n", pin_count, signal_names[signal],
+           total_samples / (double) elapsed, 100.0 * total_bytes / (BENCH_PASSES * BENCH_WORDS * 4.0));
+}
+
+int main() {
+    stdio_init_all();
+    printf("Logic analyser RLE test\n");
+
+    static const uint pin_counts[] = {1, 2, 3, 4, 5, 7, 8, 9, 12, 16, 17, 31, 32};
+    uint errors = 0;
+    for (uint i = 0; i < count_of(pin_counts); ++i)
+        for (signal_t s = 0; s < SIGNAL_COUNT; ++s)
+            for (uint rep = 0; rep < 4; ++rep)
+                errors += round_trip(pin_counts[i], s);
+    printf("Round trip: %s\n", errors ? "FAILED" : "ok");
+
+    printf("Encoder throughput:\n");
+    static const uint bench_pin_counts[] = {1, 2, 8};
+    for (uint i = 0; i < count_of(bench_pin_counts); ++i)
+        for (signal_t s = 0; s < SIGNAL_COUNT; ++s)
+            bench(bench_pin_counts[i], s);
+
+    printf(errors ? "FAILED\n" : "All good\n");
+    return errors ? 1 : 0;
+}
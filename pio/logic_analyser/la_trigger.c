@@ -0,0 +1,131 @@
+/**
+ * Copyright (c) 2022 Raspberry Pi (Trading) Ltd.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+#include "la_trigger.h"
+#include "hardware/pio_instructions.h"
+
+static void emit(la_trigger_program_t *prog, uint instr) {
+    // Keep counting past the end, so the caller can see it didn't fit
+    if (prog->length < LA_TRIGGER_MAX_INSTRUCTIONS)
+        prog->instructions[prog->length] = (uint16_t) instr;
+    ++prog->length;
+}
+
+// Get `count` pins, from `first` pins above the IN base, into dest, via the OSR:
+//   mov osr, pins
+//   out null, first
+//   out dest, count
+static void emit_read_pins(la_trigger_program_t *prog, enum pio_src_dest dest, uint first, uint count) {
+    emit(prog, pio_encode_mov(pio_osr, pio_pins));
+    if (first)
+        emit(prog, pio_encode_out(pio_null, first));
+    emit(prog, pio_encode_out(dest, count));
+}
+
+// With the OSR already loaded, jump back to `top` unless every bit set in
+// `bits` is clear in the OSR. Each run of adjacent bits is shifted out into X
+// in one go:
+//   out null, gap
+//   out x, run
+//   jmp x--, top
+static void emit_check_clear(la_trigger_program_t *prog, uint32_t bits, uint top) {
+    uint shifted = 0;
+    uint i = 0;
+    while (i < 32) {
+        if (!(bits & (1u << i))) {
+            ++i;
+            continue;
+        }
+        uint start = i;
+        while (i < 32 && (bits & (1u << i)))
+            ++i;
+        if (start > shifted)
+            emit(prog, pio_encode_out(pio_null, start - shifted));
+        emit(prog, pio_encode_out(pio_x, i - start));
+        emit(prog, pio_encode_jmp_x_dec(top));
+        shifted = i;
+    }
+}
+
+static bool emit_stage(la_trigger_program_t *prog, const la_trigger_t *stage, uint pin_base, uint pin_count) {
+    switch (stage->type) {
+        case LA_TRIGGER_LEVEL:
+            if (stage->pin >= 32)
+                return false;
+            emit(prog, pio_encode_wait_gpio(stage->level, stage->pin));
+            return true;
+        case LA_TRIGGER_EDGE:
+            if (stage->pin >= 32)
+                return false;
+            emit(prog, pio_encode_wait_gpio(!stage->level, stage->pin));
+            emit(prog, pio_encode_wait_gpio(stage->level, stage->pin));
+            return true;
+        case LA_TRIGGER_ANY_EDGE: {
+            // Take a reference copy of the pins in Y, then read them into X
+            // until they differ
+            if (stage->pin < pin_base || !stage->count || stage->pin - pin_base + stage->count > 32)
+                return false;
+            uint first = stage->pin - pin_base;
+            uint top;
+            if (stage->count == 32) {
+                emit(prog, pio_encode_mov(pio_y, pio_pins));
+                top = prog->length;
+                emit(prog, pio_encode_mov(pio_x, pio_pins));
+            } else {
+                emit_read_pins(prog, pio_y, first, stage->count);
+                top = prog->length;
+                emit_read_pins(prog, pio_x, first, stage->count);
+            }
+            emit(prog, pio_encode_jmp_x_ne_y(prog->length + 2));
+            emit(prog, pio_encode_jmp(top));
+            return true;
+        }
+        case LA_TRIGGER_PATTERN: {
+            // Check the pins which should be low, then the inverse of the ones
+            // which should be high. Both checks must use the same sample, so if
+            // there are both, keep it in Y. The mask must only cover captured
+            // pins.
+            if (pin_count < 32 && (stage->mask >> pin_count))
+                return false;
+            uint32_t want_low = stage->mask & ~stage->value;
+            uint32_t want_high = stage->mask & stage->value;
+            uint top = prog->length;
+            if (want_low && want_high) {
+                emit(prog, pio_encode_mov(pio_y, pio_pins));
+                emit(prog, pio_encode_mov(pio_osr, pio_y));
+                emit_check_clear(prog, want_low, top);
+                emit(prog, pio_encode_mov_not(pio_osr, pio_y));
+                emit_check_clear(prog, want_high, top);
+            } else if (want_low) {
+                emit(prog, pio_encode_mov(pio_osr, pio_pins));
+                emit_check_clear(prog, want_low, top);
+            } else if (want_high) {
+                emit(prog, pio_encode_mov_not(pio_osr, pio_pins));
+                emit_check_clear(prog, want_high, top);
+            }
+            return true;
+        }
+        default:
+            return false;
+    }
+}
+
+bool la_trigger_compile(la_trigger_program_t *prog, const la_trigger_t *stages, uint n_stages, uint pin_base,
+                        uint pin_count) {
+    if (!pin_count || pin_count > 32)
+        return false;
+    prog->length = 0;
+    for (uint i = 0; i < n_stages; ++i) {
+        if (!emit_stage(prog, &stages[i], pin_base, pin_count))
+            return false;
+        // Jump targets are only 5 bits, so stop as soon as it's too long
+        if (prog->length >= LA_TRIGGER_MAX_INSTRUCTIONS)
+            return false;
+    }
+    prog->capture_offset = prog->length;
+    emit(prog, pio_encode_in(pio_pins, pin_count));
+    return true;
+}
@@ -0,0 +1,76 @@
+/**
+ * Copyright (c) 2022 Raspberry Pi (Trading) Ltd.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+#ifndef _LA_TRIGGER_H
+#define _LA_TRIGGER_H
+
+#include "pico.h"
+
+// Trigger compiler for the PIO logic analyser
+//
+// A trigger is a sequence of one or more stages, each waiting for a condition
+// on the pins. la_trigger_compile() turns a trigger into one PIO program:
+// the code for each stage in turn, followed by the `in pins, n` capture loop
+// from logic_analyser_init(). The state machine starts at the first stage,
+// and starts capturing the sample after the last stage is satisfied, so no
+// capture memory is spent waiting.
+//
+// The stages only use X, Y and the OSR, leaving the ISR empty for capture.
+// Stage conditions are checked once per state machine clock, so they see the
+// pins at the same rate as the capture does, though a stage takes a few
+// clocks to go round its loop.
+
+#define LA_TRIGGER_MAX_INSTRUCTIONS 32
+
+typedef enum {
+    LA_TRIGGER_LEVEL,    // `pin` is at `level`
+    LA_TRIGGER_EDGE,     // `pin` goes to `level`, having been at the other level
+    LA_TRIGGER_ANY_EDGE, // Any of the `count` pins from `pin` up changes
+    LA_TRIGGER_PATTERN,  // The pins masked by `mask` match `value`
+} la_trigger_type_t;
+
+typedef struct {
+    la_trigger_type_t type;
+    uint pin;   // GPIO number (LEVEL, EDGE, ANY_EDGE)
+    uint count; // ANY_EDGE
+    bool level; // LEVEL, EDGE
+    // PATTERN: bit 0 is the first captured pin, as in the capture buffer;
+    // only captured pins can be in the mask
+    uint32_t mask;
+    uint32_t value;
+} la_trigger_t;
+
+static inline la_trigger_t la_trigger_level(uint pin, bool level) {
+    return (la_trigger_t) {.type = LA_TRIGGER_LEVEL, .pin = pin, .level = level};
+}
+
+static inline la_trigger_t la_trigger_edge(uint pin, bool rising) {
+    return (la_trigger_t) {.type = LA_TRIGGER_EDGE, .pin = pin, .level = rising};
+}
+
+static inline la_trigger_t la_trigger_any_edge(uint first_pin, uint count) {
+    return (la_trigger_t) {.type = LA_TRIGGER_ANY_EDGE, .pin = first_pin, .count = count};
+}
+
+static inline la_trigger_t la_trigger_pattern(uint32_t mask, uint32_t value) {
+    return (la_trigger_t) {.type = LA_TRIGGER_PATTERN, .mask = mask, .value = value};
+}
+
+typedef struct {
+    uint16_t instructions[LA_TRIGGER_MAX_INSTRUCTIONS];
+    uint length;
+    // The `in pins, n` instruction, which is both wrap target and wrap
+    uint capture_offset;
+} la_trigger_program_t;
+
+// Compile the stages, in order, for capturing pin_count pins from pin_base.
+// Jump targets are relative to the start of the program, which is what
+// pio_add_program() expects. Returns false if the stages are invalid, or the
+// program won't fit in PIO instruction memory.
+bool la_trigger_compile(la_trigger_program_t *prog, const la_trigger_t *stages, uint n_stages, uint pin_base,
+                        uint pin_count);
+
+#endif
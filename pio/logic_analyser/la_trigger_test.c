@@ -0,0 +1,210 @@
+/**
+ * Copyright (c) 2022 Raspberry Pi (Trading) Ltd.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+#include <stdio.h>
+#include "pico/stdlib.h"
+#include "hardware/pio_instructions.h"
+#include "la_trigger.h"
+
+// Check the programs la_trigger.c generates, instruction by instruction.
+// Nothing is loaded into a PIO; only the encoders in pio_instructions.h are
+// used, so on the host pio_instructions_host stands in for hardware_pio.
+
+static uint failures;
+
+static void check_program(const char *name, const la_trigger_t *stages, uint n_stages, uint pin_base, uint pin_count,
+                          const uint16_t *expected, uint expected_length, uint expected_capture_offset) {
+    la_trigger_program_t prog;
+    bool ok = la_trigger_compile(&prog, stages, n_stages, pin_base, pin_count);
+    if (ok && prog.length == expected_length && prog.capture_offset == expected_capture_offset) {
+        for (uint i = 0; i < prog.length; ++i)
+            if (prog.instructions[i] != expected[i])
+                ok = false;
+    } else {
+        ok = false;
+    }
+    printf("%-36s %s\n", name, ok ? "ok" : "FAILED");
+    if (!ok) {
+        ++failures;
+        printf("  expected:");
+        for (uint i = 0; i < expected_length; ++i)
+            printf(" %04x", expected[i]);
+        printf("\n  got:     ");
+        for (uint i = 0; i < MIN(prog.length, LA_TRIGGER_MAX_INSTRUCTIONS); ++i)
+            printf(" %04x", prog.instructions[i]);
+        printf("\n");
+    }
+}
+
+static void check_rejected(const char *name, const la_trigger_t *stages, uint n_stages, uint pin_base,
+                           uint pin_count) {
+    la_trigger_program_t prog;
+    bool ok = !la_trigger_compile(&prog, stages, n_stages, pin_base, pin_count);
+    printf("%-36s %s\n", name, ok ? "ok" : "FAILED");
+    if (!ok)
+        ++failures;
+}
+
+#define CHECK_PROGRAM(name, stages, pin_base, pin_count, capture_offset, ...) do { \
+    const uint16_t expected[] = { __VA_ARGS__ }; \
+    check_program(name, stages, count_of(stages), pin_base, pin_count, expected, count_of(expected), capture_offset); \
+} while (0)
+
+int main() {
+    stdio_init_all();
+    printf("Logic analyser trigger compiler test\n");
+
+    {
+        // What logic_analyser_arm() used to do, as pioasm assembles it:
+        //   wait 1 gpio 16
+        //   in pins, 2
+        const la_trigger_t t[] = {la_trigger_level(16, true)};
+        CHECK_PROGRAM("level", t, 16, 2, 1, 0x2090, 0x4002);
+    }
+    {
+        const la_trigger_t t[] = {la_trigger_edge(17, false)};
+        CHECK_PROGRAM("falling edge", t, 16, 2, 2,
+                      pio_encode_wait_gpio(true, 17),
+                      pio_encode_wait_gpio(false, 17),
+                      pio_encode_in(pio_pins, 2));
+    }
+    {
+        //   mov osr, pins
+        //   out y, 2
+        // top:
+        //   mov osr, pins
+        //   out x, 2
+        //   jmp x!=y, capture
+        //   jmp top
+        // capture:
+        //   in pins, 2
+        const la_trigger_t t[] = {la_trigger_any_edge(16, 2)};
+        CHECK_PROGRAM("any edge", t, 16, 2, 6, 0xa0e0, 0x6042, 0xa0e0, 0x6022, 0x00a6, 0x0002, 0x4002);
+    }
+    {
+        const la_trigger_t t[] = {la_trigger_any_edge(19, 4)};
+        CHECK_PROGRAM("any edge, part of the pins", t, 16, 8, 8,
+                      pio_encode_mov(pio_osr, pio_pins),
+                      pio_encode_out(pio_null, 3),
+                      pio_encode_out(pio_y, 4),
+                      pio_encode_mov(pio_osr, pio_pins),
+                      pio_encode_out(pio_null, 3),
+                      pio_encode_out(pio_x, 4),
+                      pio_encode_jmp_x_ne_y(8),
+                      pio_encode_jmp(3),
+                      pio_encode_in(pio_pins, 8));
+    }
+    {
+        const la_trigger_t t[] = {la_trigger_any_edge(0, 32)};
+        CHECK_PROGRAM("any edge, all 32 pins", t, 0, 32, 4,
+                      pio_encode_mov(pio_y, pio_pins),
+                      pio_encode_mov(pio_x, pio_pins),
+                      pio_encode_jmp_x_ne_y(4),
+                      pio_encode_jmp(1),
+                      pio_encode_in(pio_pins, 32));
+    }
+    {
+        // Pins 4-7 low
+        const la_trigger_t t[] = {la_trigger_pattern(0xf0, 0x00)};
+        CHECK_PROGRAM("pattern, all low", t, 0, 8, 4,
+                      pio_encode_mov(pio_osr, pio_pins),
+                      pio_encode_out(pio_null, 4),
+                      pio_encode_out(pio_x, 4),
+                      pio_encode_jmp_x_dec(0),
+                      pio_encode_in(pio_pins, 8));
+    }
+    {
+        // Value bits outside the mask are ignored
+        const la_trigger_t t[] = {la_trigger_pattern(0x3, 0xf)};
+        CHECK_PROGRAM("pattern, all high", t, 16, 2, 3,
+                      pio_encode_mov_not(pio_osr, pio_pins),
+                      pio_encode_out(pio_x, 2),
+                      pio_encode_jmp_x_dec(0),
+                      pio_encode_in(pio_pins, 2));
+    }
+    {
+        //   mov y, pins
+        //   mov osr, y
+        //   out null, 1
+        //   out x, 2
+        //   jmp x--, 0
+        //   mov osr, ~y
+        //   out x, 1
+        //   jmp x--, 0
+        //   out null, 2
+        //   out x, 1
+        //   jmp x--, 0
+        //   in pins, 4
+        const la_trigger_t t[] = {la_trigger_pattern(0xf, 0x9)};
+        CHECK_PROGRAM("pattern, mixed", t, 16, 4, 11,
+                      0xa040, 0xa0e2, 0x6061, 0x6022, 0x0040, 0xa0ea, 0x6021, 0x0040, 0x6062, 0x6021, 0x0040,
+                      0x4004);
+    }
+    {
+        // A sequence: B goes high whilst A is low, then any change on either.
+        // The second stage's jumps are relative to the start of the program.
+        const la_trigger_t t[] = {
+            la_trigger_pattern(0x1, 0x0),
+            la_trigger_edge(17, true),
+            la_trigger_any_edge(16, 2),
+        };
+        CHECK_PROGRAM("sequence", t, 16, 2, 11,
+                      pio_encode_mov(pio_osr, pio_pins),
+                      pio_encode_out(pio_x, 1),
+                      pio_encode_jmp_x_dec(0),
+                      pio_encode_wait_gpio(false, 17),
+                      pio_encode_wait_gpio(true, 17),
+                      pio_encode_mov(pio_osr, pio_pins),
+                      pio_encode_out(pio_y, 2),
+                      pio_encode_mov(pio_osr, pio_pins),
+                      pio_encode_out(pio_x, 2),
+                      pio_encode_jmp_x_ne_y(11),
+                      pio_encode_jmp(7),
+                      pio_encode_in(pio_pins, 2));
+    }
+    {
+        // No stages: capture straight away
+        check_program("no stages", NULL, 0, 16, 2, (const uint16_t[]) {0x4002}, 1, 0);
+    }
+
+    {
+        const la_trigger_t t[] = {la_trigger_any_edge(12, 2)};
+        check_rejected("rejects pins below the base", t, count_of(t), 16, 2);
+    }
+    {
+        const la_trigger_t t[] = {la_trigger_any_edge(20, 29)};
+        check_rejected("rejects pins past 32", t, count_of(t), 0, 8);
+    }
+    {
+        const la_trigger_t t[] = {la_trigger_level(16, true)};
+        check_rejected("rejects 0 pins", t, count_of(t), 16, 0);
+    }
+    {
+        // Pin 8 isn't captured, so the pattern could never match
+        const la_trigger_t t[] = {la_trigger_pattern(0x101, 0x001)};
+        check_rejected("rejects pattern past captured pins", t, count_of(t), 0, 8);
+    }
+    {
+        // Every other pin alternating needs 3 instructions per pin
+        const la_trigger_t t[] = {la_trigger_pattern(0x55555555, 0x11111111)};
+        check_rejected("rejects too long", t, count_of(t), 0, 32);
+    }
+    {
+        // 32 stages of trigger leave no room for the capture loop, but 31 fit
+        la_trigger_t t[32];
+        uint16_t expected[32];
+        for (uint i = 0; i < count_of(t); ++i) {
+            t[i] = la_trigger_level(0, i & 1);
+            expected[i] = pio_encode_wait_gpio(i & 1, 0);
+        }
+        expected[31] = pio_encode_in(pio_pins, 1);
+        check_rejected("rejects no room for capture", t, count_of(t), 0, 1);
+        check_program("fits exactly", t, count_of(t) - 1, 0, 1, expected, count_of(expected), 31);
+    }
+
+    printf(failures ? "FAILED\n" : "All good\n");
+    return failures ? 1 : 0;
+}
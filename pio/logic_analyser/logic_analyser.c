@@ -7,8 +7,12 @@
 // PIO logic analyser example
 //
 // This program captures samples from a group of pins, at a fixed rate, once a
-// trigger condition is detected (level condition on one pin). The samples are
-// transferred to a capture buffer using the system DMA.
+// trigger condition is detected. The samples are transferred to a capture
+// buffer using the system DMA.
+//
+// The trigger can be a sequence of conditions (levels, edges, and patterns on
+// several pins), which la_trigger.c compiles into PIO code that runs ahead of
+// the capture loop, so no capture memory is used up waiting.
 //
 // 1 to 32 pins can be captured, at a sample rate no greater than system clock
 // frequency.
@@ -20,6 +24,7 @@
 #include "hardware/pio.h"
 #include "hardware/dma.h"
 #include "hardware/structs/bus_ctrl.h"
+#include "la_trigger.h"
 
 // Some logic to analyse:
 #include "hardware/structs/pwm.h"
@@ -37,22 +42,23 @@ static inline uint bits_packed_per_word(uint pin_count) {
     return SHIFT_REG_WIDTH - (SHIFT_REG_WIDTH % pin_count);
 }
 
-void logic_analyser_init(PIO pio, uint sm, uint pin_base, uint pin_count, float div) {
-    // Load a program to capture n pins. This is just a single `in pins, n`
-    // instruction with a wrap.
-    uint16_t capture_prog_instr = pio_encode_in(pio_pins, pin_count);
+uint logic_analyser_init(PIO pio, uint sm, uint pin_base, uint pin_count, float div,
+                         const la_trigger_program_t *trigger) {
+    // Load a program to wait for the trigger then capture n pins. The capture
+    // is just a single `in pins, n` instruction with a wrap, at the end of the
+    // trigger code.
     struct pio_program capture_prog = {
-            .instructions = &capture_prog_instr,
-            .length = 1,
+            .instructions = trigger->instructions,
+            .length = trigger->length,
             .origin = -1
     };
     uint offset = pio_add_program(pio, &capture_prog);
 
     // Configure state machine to loop over this `in` instruction forever,
-    // with autopush enabled.
+    // with autopush enabled, once it gets there.
     pio_sm_config c = pio_get_default_sm_config();
     sm_config_set_in_pins(&c, pin_base);
-    sm_config_set_wrap(&c, offset, offset);
+    sm_config_set_wrap(&c, offset + trigger->capture_offset, offset + trigger->capture_offset);
     sm_config_set_clkdiv(&c, div);
     // Note that we may push at a < 32 bit threshold if pin_count does not
     // divide 32. We are using shift-to-right, so the sample data ends up
@@ -60,10 +66,11 @@ void logic_analyser_init(PIO pio, uint sm, uint pin_base, uint pin_count, float
     sm_config_set_in_shift(&c, true, true, bits_packed_per_word(pin_count));
     sm_config_set_fifo_join(&c, PIO_FIFO_JOIN_RX);
     pio_sm_init(pio, sm, offset, &c);
+    return offset;
 }
 
-void logic_analyser_arm(PIO pio, uint sm, uint dma_chan, uint32_t *capture_buf, size_t capture_size_words,
-                        uint trigger_pin, bool trigger_level) {
+void logic_analyser_arm(PIO pio, uint sm, uint offset, uint dma_chan, uint32_t *capture_buf,
+                        size_t capture_size_words) {
     pio_sm_set_enabled(pio, sm, false);
     // Need to clear _input shift counter_, as well as FIFO, because there may be
     // partial ISR contents left over from a previous run. sm_restart does this.
@@ -82,7 +89,8 @@ void logic_analyser_arm(PIO pio, uint sm, uint dma_chan, uint32_t *capture_buf,
         true                // Start immediately
     );
 
-    pio_sm_exec(pio, sm, pio_encode_wait_gpio(trigger_level, trigger_pin));
+    // Start from the top of the trigger code
+    pio_sm_exec(pio, sm, pio_encode_jmp(offset));
     pio_sm_set_enabled(pio, sm, true);
 }
 
@@ -129,10 +137,21 @@ int main() {
     uint sm = 0;
     uint dma_chan = 0;
 
-    logic_analyser_init(pio, sm, CAPTURE_PIN_BASE, CAPTURE_PIN_COUNT, 1.f);
+    // Trigger on a rising edge on the first pin, but only once the second
+    // pin has been seen high whilst the first is low
+    const la_trigger_t trigger[] = {
+        la_trigger_pattern(0x3, 0x2),
+        la_trigger_edge(CAPTURE_PIN_BASE, true),
+    };
+    la_trigger_program_t trigger_prog;
+    bool trigger_ok = la_trigger_compile(&trigger_prog, trigger, count_of(trigger), CAPTURE_PIN_BASE,
+                                         CAPTURE_PIN_COUNT);
+    hard_assert(trigger_ok);
+
+    uint offset = logic_analyser_init(pio, sm, CAPTURE_PIN_BASE, CAPTURE_PIN_COUNT, 1.f, &trigger_prog);
 
     printf("Arming trigger\n");
-    logic_analyser_arm(pio, sm, dma_chan, capture_buf, buf_size_words, CAPTURE_PIN_BASE, true);
+    logic_analyser_arm(pio, sm, offset, dma_chan, capture_buf, buf_size_words);
 
     printf("Starting PWM example\n");
     // PWM example: -----------------------------------------------------------
@@ -0,0 +1,304 @@
+/**
+ * Copyright (c) 2022 Raspberry Pi (Trading) Ltd.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+// PIO logic analyser, streaming version
+//
+// Like logic_analyser.c, this samples a group of pins with a one-instruction
+// PIO program, but instead of filling one buffer after a trigger it captures
+// continuously:
+//
+// - Two DMA channels take turns to fill blocks of a ring of capture blocks,
+//   each one chaining to the other, so no samples are lost between blocks.
+//   The completion IRQ points the channel that just finished at the block
+//   after next.
+//
+// - Core 1 looks through each block for the trigger (a rising or falling
+//   edge on one pin). Once found, it run-length encodes the capture from
+//   PRE_TRIGGER_SAMPLES before the trigger onwards (see la_rle.h), whilst
+//   capture carries on.
+//
+// - Core 0 sends the encoded stream out over stdio, as binary. la_decode.c
+//   turns it into raw samples for sigrok-cli or PulseView.
+//
+// If the encoder or the output can't keep up, the capture stops with an
+// overrun flag in the stream, rather than sending a trace with a gap in it.
+
+#include <stdio.h>
+
+#include "pico/stdlib.h"
+#include "pico/multicore.h"
+#include "hardware/pio.h"
+#include "hardware/dma.h"
+#include "hardware/irq.h"
+#include "hardware/clocks.h"
+#include "hardware/structs/bus_ctrl.h"
+#include "la_rle.h"
+
+// Some logic to analyse:
+#include "hardware/structs/pwm.h"
+
+#define CAPTURE_PIN_BASE 16
+#define CAPTURE_PIN_COUNT 2
+// 1 MHz sampling at the default 125 MHz system clock
+#define SAMPLE_CLK_DIV 125.f
+
+#define TRIGGER_PIN CAPTURE_PIN_BASE
+#define TRIGGER_LEVEL true // Rising edge
+
+#define PRE_TRIGGER_SAMPLES 5000
+// Samples after the trigger, or 0 to keep streaming until an overrun
+#define POST_TRIGGER_SAMPLES 1000000
+
+#define BLOCK_WORDS 1024
+#define N_BLOCKS 8
+#define SAMPLES_PER_BLOCK (BLOCK_WORDS * (32 / CAPTURE_PIN_COUNT))
+
+// The block being filled, and the one after it, are off limits, and there
+// needs to be one more block in hand for the encoder to be working on
+static_assert(PRE_TRIGGER_SAMPLES <= (N_BLOCKS - 3) * SAMPLES_PER_BLOCK, "");
+static_assert(!(32 % CAPTURE_PIN_COUNT), "SAMPLES_PER_BLOCK assumes the pin count divides 32");
+
+#define OUT_BUF_SIZE 2048
+#define N_OUT_BUFS 4
+#define OUT_DONE 0xffffffffu
+
+static uint32_t capture_buf[N_BLOCKS][BLOCK_WORDS];
+static uint8_t out_buf[N_OUT_BUFS][OUT_BUF_SIZE];
+
+static uint dma_chan[2];
+// Blocks filled so far. Written only by the DMA IRQ.
+static volatile uint32_t blocks_done;
+
+void logic_analyser_init(PIO pio, uint sm, uint pin_base, uint pin_count, float div) {
+    // The same free-running `in pins, n` program as logic_analyser.c, but
+    // started straight away rather than waiting for the trigger
+    uint16_t capture_prog_instr = pio_encode_in(pio_pins, pin_count);
+    struct pio_program capture_prog = {
+            .instructions = &capture_prog_instr,
+            .length = 1,
+            .origin = -1
+    };
+    uint offset = pio_add_program(pio, &capture_prog);
+
+    pio_sm_config c = pio_get_default_sm_config();
+    sm_config_set_in_pins(&c, pin_base);
+    sm_config_set_wrap(&c, offset, offset);
+    sm_config_set_clkdiv(&c, div);
+    sm_config_set_in_shift(&c, true, true, la_bits_packed_per_word(pin_count));
+    sm_config_set_fifo_join(&c, PIO_FIFO_JOIN_RX);
+    pio_sm_init(pio, sm, offset, &c);
+}
+
+static void __isr dma_handler(void) {
+    // Blocks are filled alternately by the two channels, so the next one to
+    // finish is always known
+    while (true) {
+        uint32_t b = blocks_done;
+        uint chan = dma_chan[b & 1];
+        if (!(dma_hw->ints0 & (1u << chan)))
+            break;
+        dma_hw->ints0 = 1u << chan;
+        // The other channel is now filling block b + 1; this one goes next
+        dma_channel_set_write_addr(chan, capture_buf[(b + 2) % N_BLOCKS], false);
+        blocks_done = b + 1;
+    }
+}
+
+static void capture_start(PIO pio, uint sm) {
+    for (uint i = 0; i < 2; ++i)
+        dma_chan[i] = dma_claim_unused_channel(true);
+    for (uint i = 0; i < 2; ++i) {
+        dma_channel_config c = dma_channel_get_default_config(dma_chan[i]);
+        channel_config_set_read_increment(&c, false);
+        channel_config_set_write_increment(&c, true);
+        channel_config_set_dreq(&c, pio_get_dreq(pio, sm, false));
+        channel_config_set_chain_to(&c, dma_chan[i ^ 1]);
+        dma_channel_configure(dma_chan[i], &c, capture_buf[i], &pio->rxf[sm], BLOCK_WORDS, false);
+    }
+    dma_hw->ints0 = (1u << dma_chan[0]) | (1u << dma_chan[1]);
+    dma_set_irq0_channel_mask_enabled((1u << dma_chan[0]) | (1u << dma_chan[1]), true);
+    irq_set_exclusive_handler(DMA_IRQ_0, dma_handler);
+    irq_set_enabled(DMA_IRQ_0, true);
+
+    dma_channel_start(dma_chan[0]);
+    pio_sm_set_enabled(pio, sm, true);
+}
+
+// ----------------------------------------------------------------------------
+// Core 1: trigger search and encoding
+
+// Find the first sample in a block where the trigger pin goes to
+// TRIGGER_LEVEL, having been at the other level first. Returns -1 if there
+// isn't one.
+static int find_trigger(const uint32_t *words, bool *armed) {
+    const uint spw = 32 / CAPTURE_PIN_COUNT;
+    const uint trigger_bit = TRIGGER_PIN - CAPTURE_PIN_BASE;
+    uint32_t trigger_mask = 0;
+    for (uint i = 0; i < spw; ++i)
+        trigger_mask |= 1u << (i * CAPTURE_PIN_COUNT + trigger_bit);
+    for (uint w = 0; w < BLOCK_WORDS; ++w) {
+        uint32_t x = words[w];
+        uint32_t at_level = (TRIGGER_LEVEL ? x : ~x) & trigger_mask;
+        if (!*armed) {
+            uint32_t not_at_level = ~at_level & trigger_mask;
+            if (!not_at_level)
+                continue;
+            *armed = true;
+            // Only samples after the first one not at the level count
+            uint32_t lowest = not_at_level & -not_at_level;
+            at_level &= ~((lowest << 1) - 1);
+        }
+        if (at_level)
+            return (int) (w * spw + ((uint) __builtin_ctz(at_level) - trigger_bit) / CAPTURE_PIN_COUNT);
+    }
+    return -1;
+}
+
+static uint out_index;
+static uint out_len;
+
+static void send_out_buf(void) {
+    multicore_fifo_push_blocking(out_index << 16 | out_len);
+    out_index = multicore_fifo_pop_blocking();
+    out_len = 0;
+}
+
+// Whether the DMA may have started writing over a block. While blocks_done
+// is d, block d is being filled, and so may block d + 1 be: the other channel
+// starts on it the moment block d is full, before the interrupt counts it.
+static bool block_overrun(uint32_t block) {
+    return blocks_done - block >= N_BLOCKS - 1;
+}
+
+static void core1_entry(void) {
+    // Wait for the trigger
+    uint32_t b = 0;
+    bool armed = false;
+    int trigger;
+    while (true) {
+        while (blocks_done <= b)
+            tight_loop_contents();
+        trigger = find_trigger(capture_buf[b % N_BLOCKS], &armed);
+        if (trigger >= 0)
+            break;
+        ++b;
+    }
+
+    // Back up to the start of the pre-trigger samples, or the start of the
+    // capture if it hasn't been running that long
+    int32_t start = trigger - PRE_TRIGGER_SAMPLES;
+    uint32_t block = b;
+    while (start < 0 && block > 0) {
+        start += SAMPLES_PER_BLOCK;
+        --block;
+    }
+    if (start < 0)
+        start = 0;
+    uint32_t pre_trigger = (b - block) * SAMPLES_PER_BLOCK + trigger - start;
+
+    la_rle_header_t header = {
+        .pin_count = CAPTURE_PIN_COUNT,
+        .pin_base = CAPTURE_PIN_BASE,
+        .sample_rate_hz = (uint32_t) ((float) clock_get_hz(clk_sys) / SAMPLE_CLK_DIV),
+        .pre_trigger = pre_trigger,
+    };
+    la_rle_write_header(out_buf[out_index], &header);
+    out_len = LA_RLE_HEADER_BYTES;
+
+    la_rle_encoder_t e;
+    la_rle_encoder_init(&e, CAPTURE_PIN_COUNT);
+    uint32_t remaining = POST_TRIGGER_SAMPLES ? pre_trigger + POST_TRIGGER_SAMPLES : 0xffffffffu;
+    uint32_t flags = 0;
+    while (remaining) {
+        while (blocks_done <= block)
+            tight_loop_contents();
+        uint n = MIN(SAMPLES_PER_BLOCK - (uint) start, remaining);
+        uint done = 0;
+        while (done < n) {
+            // If the DMA has come round to this block again, what is read from
+            // it may have been overwritten. Samples read before a check which
+            // passes are good, so check again before sending any of them,
+            // and if that fails, take back what was encoded from them.
+            if (block_overrun(block)) {
+                flags |= LA_RLE_END_OVERRUN;
+                break;
+            }
+            la_rle_encoder_t e_before = e;
+            uint len_before = out_len;
+            uint encoded = la_rle_encode(&e, capture_buf[block % N_BLOCKS], start + done, n - done,
+                                         out_buf[out_index], &out_len, OUT_BUF_SIZE);
+            if (block_overrun(block)) {
+                e = e_before;
+                out_len = len_before;
+                flags |= LA_RLE_END_OVERRUN;
+                break;
+            }
+            done += encoded;
+            if (done < n)
+                send_out_buf();
+        }
+        if (flags)
+            break;
+        if (POST_TRIGGER_SAMPLES)
+            remaining -= n;
+        start = 0;
+        ++block;
+    }
+    if (OUT_BUF_SIZE - out_len < 2 * LA_RLE_MAX_RECORD_BYTES)
+        send_out_buf();
+    out_len += la_rle_encode_end(&e, flags, out_buf[out_index] + out_len);
+    send_out_buf();
+    multicore_fifo_push_blocking(OUT_DONE);
+}
+
+// ----------------------------------------------------------------------------
+
+int main() {
+    stdio_init_all();
+    printf("PIO logic analyser streaming example\n");
+
+    // As in logic_analyser.c
+    bus_ctrl_hw->priority = BUSCTRL_BUS_PRIORITY_DMA_W_BITS | BUSCTRL_BUS_PRIORITY_DMA_R_BITS;
+
+    PIO pio = pio0;
+    uint sm = 0;
+    logic_analyser_init(pio, sm, CAPTURE_PIN_BASE, CAPTURE_PIN_COUNT, SAMPLE_CLK_DIV);
+
+    // Core 1 starts with output buffer 0; the rest are free
+    multicore_launch_core1(core1_entry);
+    for (uint i = 1; i < N_OUT_BUFS; ++i)
+        multicore_fifo_push_blocking(i);
+
+    printf("Capturing, triggering on a %s edge on GPIO %d\n", TRIGGER_LEVEL ? "rising" : "falling", TRIGGER_PIN);
+    capture_start(pio, sm);
+
+    // PWM example: -----------------------------------------------------------
+    gpio_set_function(CAPTURE_PIN_BASE, GPIO_FUNC_PWM);
+    gpio_set_function(CAPTURE_PIN_BASE + 1, GPIO_FUNC_PWM);
+    // Count from 0 to 99, at 1 MHz, so the period is 100 samples
+    pwm_hw->slice[0].top = 99;
+    pwm_hw->slice[0].div = 125 << PWM_CH0_DIV_INT_LSB;
+    // Channel A high for 1/4 of each period, and channel B for 3/4
+    pwm_hw->slice[0].cc =
+            (25 << PWM_CH0_CC_A_LSB) |
+            (75 << PWM_CH0_CC_B_LSB);
+    pwm_hw->slice[0].csr = PWM_CH0_CSR_EN_BITS;
+    // ------------------------------------------------------------------------
+
+    // Send whatever core 1 gives us, as raw bytes (no newline translation)
+    while (true) {
+        uint32_t msg = multicore_fifo_pop_blocking();
+        if (msg == OUT_DONE)
+            break;
+        uint index = msg >> 16;
+        uint len = msg & 0xffffu;
+        for (uint i = 0; i < len; ++i)
+            putchar_raw(out_buf[index][i]);
+        multicore_fifo_push_blocking(index);
+    }
+    pio_sm_set_enabled(pio, sm, false);
+    printf("\nCapture complete\n");
+}
@@ -0,0 +1,84 @@
+/**
+ * Copyright (c) 2022 Raspberry Pi (Trading) Ltd.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+#include "pixel_format.h"
+
+// Gamma: one table per channel, each entry already shifted into place, so
+// that a pixel is three loads and two ORs instead of three multiplies
+static uint32_t gamma_r[32];
+static uint32_t gamma_g[64];
+static uint32_t gamma_b[32];
+
+// Bit planes: entry x has bit i of x moved to bit 0 of byte i, with bits 0..3
+// in spread_lo and bits 4..7 in spread_hi. One pair of lookups per channel
+// then produces that channel's contribution to all 8 planes at once.
+static uint32_t spread_lo[256];
+static uint32_t spread_hi[256];
+
+void pixel_format_init(void) {
+    for (uint i = 0; i < 32; ++i) {
+        gamma_r[i] = gamma_correct_565_888(i << 11);
+        gamma_b[i] = gamma_correct_565_888(i);
+    }
+    for (uint i = 0; i < 64; ++i)
+        gamma_g[i] = gamma_correct_565_888(i << 5);
+    for (uint i = 0; i < 256; ++i) {
+        uint32_t lo = 0, hi = 0;
+        for (uint bit = 0; bit < 4; ++bit) {
+            lo |= (i >> bit & 1u) << (8 * bit);
+            hi |= (i >> (bit + 4) & 1u) << (8 * bit);
+        }
+        spread_lo[i] = lo;
+        spread_hi[i] = hi;
+    }
+}
+
+void pixel_span_565_to_888_gamma(uint32_t *dst, const uint16_t *src, uint n) {
+    for (uint i = 0; i < n; ++i) {
+        uint32_t pix = src[i];
+        dst[i] = gamma_r[pix >> 11] | gamma_g[(pix >> 5) & 0x3fu] | gamma_b[pix & 0x1fu];
+    }
+}
+
+void pixel_span_565_byteswap(uint16_t *dst, const uint16_t *src, uint n) {
+    const uint32_t *src2 = (const uint32_t *) src;
+    uint32_t *dst2 = (uint32_t *) dst;
+    for (uint i = 0; i < n / 2; ++i) {
+        uint32_t w = src2[i];
+        dst2[i] = ((w & 0x00ff00ffu) << 8) | ((w >> 8) & 0x00ff00ffu);
+    }
+    if (n & 1)
+        dst[n - 1] = (uint16_t) ((src[n - 1] << 8) | (src[n - 1] >> 8));
+}
+
+void pixel_span_565_pack_msb_first(uint32_t *dst, const uint16_t *src, uint n) {
+    const uint32_t *src2 = (const uint32_t *) src;
+    for (uint i = 0; i < n / 2; ++i) {
+        // Little-endian: the first pixel is in the lower half of the source word
+        uint32_t w = src2[i];
+        dst[i] = (w << 16) | (w >> 16);
+    }
+}
+
+void pixel_span_888_to_planes(uint8_t *planes, uint plane_stride, const uint32_t *top, const uint32_t *bottom, uint n) {
+    for (uint x = 0; x < n; ++x) {
+        uint32_t t = top[x];
+        uint32_t b = bottom[x];
+        uint32_t lo = spread_lo[t & 0xffu] | spread_lo[(t >> 8) & 0xffu] << 1 | spread_lo[(t >> 16) & 0xffu] << 2 |
+                      spread_lo[b & 0xffu] << 3 | spread_lo[(b >> 8) & 0xffu] << 4 | spread_lo[(b >> 16) & 0xffu] << 5;
+        uint32_t hi = spread_hi[t & 0xffu] | spread_hi[(t >> 8) & 0xffu] << 1 | spread_hi[(t >> 16) & 0xffu] << 2 |
+                      spread_hi[b & 0xffu] << 3 | spread_hi[(b >> 8) & 0xffu] << 4 | spread_hi[(b >> 16) & 0xffu] << 5;
+        uint8_t *p = planes + x;
+        p[0 * plane_stride] = (uint8_t) lo;
+        p[1 * plane_stride] = (uint8_t) (lo >> 8);
+        p[2 * plane_stride] = (uint8_t) (lo >> 16);
+        p[3 * plane_stride] = (uint8_t) (lo >> 24);
+        p[4 * plane_stride] = (uint8_t) hi;
+        p[5 * plane_stride] = (uint8_t) (hi >> 8);
+        p[6 * plane_stride] = (uint8_t) (hi >> 16);
+        p[7 * plane_stride] = (uint8_t) (hi >> 24);
+    }
+}
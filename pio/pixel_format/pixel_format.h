@@ -0,0 +1,53 @@
+/**
+ * Copyright (c) 2022 Raspberry Pi (Trading) Ltd.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+#ifndef _PIXEL_FORMAT_H
+#define _PIXEL_FORMAT_H
+
+#include "pico.h"
+
+// Pixel format conversions for the display examples, e.g. pio/hub75.
+//
+// Everything works on spans of pixels rather than one pixel at a time, and
+// per-pixel arithmetic is replaced by small lookup tables, which live in RAM
+// so that they are fast to read whilst the flash is busy. Call
+// pixel_format_init() once before using any of the span functions.
+//
+// RGB888 values here are laid out as in pio/hub75: red in bits 0..7, green in
+// bits 8..15 and blue in bits 16..23.
+
+void pixel_format_init(void);
+
+// The original per-pixel gamma correction from pio/hub75. The span version
+// below gives exactly the same results.
+static inline uint32_t gamma_correct_565_888(uint16_t pix) {
+    uint32_t r_gamma = pix & 0xf800u;
+    r_gamma *= r_gamma;
+    uint32_t g_gamma = pix & 0x07e0u;
+    g_gamma *= g_gamma;
+    uint32_t b_gamma = pix & 0x001fu;
+    b_gamma *= b_gamma;
+    return (b_gamma >> 2 << 16) | (g_gamma >> 14 << 8) | (r_gamma >> 24 << 0);
+}
+
+// Gamma correct n RGB565 pixels to RGB888
+void pixel_span_565_to_888_gamma(uint32_t *dst, const uint16_t *src, uint n);
+
+// Swap the bytes of n RGB565 pixels, e.g. for a byte-wide big-endian display
+// interface. Works two pixels at a time, so src and dst should be word aligned.
+void pixel_span_565_byteswap(uint16_t *dst, const uint16_t *src, uint n);
+
+// Pack n RGB565 pixels two per word, first pixel in the upper half, so that a
+// left-shifting (MSB first) serialiser sends them in order. n must be even.
+void pixel_span_565_pack_msb_first(uint32_t *dst, const uint16_t *src, uint n);
+
+// Split two spans of n RGB888 pixels (upper and lower half of a HUB75 panel)
+// into 8 bit planes. Plane b starts at planes + b * plane_stride, and has one
+// byte per pixel, holding bit b of R, G, B of the upper pixel in bits 0..2,
+// and of the lower pixel in bits 3..5.
+void pixel_span_888_to_planes(uint8_t *planes, uint plane_stride, const uint32_t *top, const uint32_t *bottom, uint n);
+
+#endif
@@ -0,0 +1,116 @@
+/**
+ * Copyright (c) 2022 Raspberry Pi (Trading) Ltd.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+#include <stdio.h>
+#include <string.h>
+#include "pico/stdlib.h"
+#include "pixel_format.h"
+
+// Time the span conversions in pixel_format.c against the per-pixel code they
+// replace (from the hub75 and st7789_lcd examples), and check they agree.
+//
+// The numbers that matter are the ones from the device. On a host build, the
+// compiler vectorises the simple arithmetic loops, which a Cortex-M0+ can't
+// do, so the table lookups compare much less favourably there.
+
+#define SPAN 128
+#define N_PIXELS (1u << 20)
+
+static uint16_t src[SPAN] __attribute__((aligned(4)));
+static uint16_t src_bottom[SPAN] __attribute__((aligned(4)));
+static uint32_t out888[2][SPAN];
+static uint32_t ref888[2][SPAN];
+static uint32_t out_words[SPAN];
+static uint8_t out_bytes[SPAN * 2] __attribute__((aligned(4)));
+static uint8_t planes[8][SPAN];
+static uint8_t ref_planes[8][SPAN];
+
+// --- The original per-pixel versions (kept out of line, like the span versions) ---
+
+static __noinline void ref_565_to_888(uint32_t *dst, const uint16_t *pix, uint n) {
+    for (uint i = 0; i < n; ++i)
+        dst[i] = gamma_correct_565_888(pix[i]);
+}
+
+// st7789_lcd.c used to send each pixel as two separate bytes, high byte first
+static __noinline void ref_565_split(uint8_t *dst, const uint16_t *pix, uint n) {
+    for (uint i = 0; i < n; ++i) {
+        *dst++ = pix[i] >> 8;
+        *dst++ = pix[i] & 0xff;
+    }
+}
+
+// hub75.c leaves this to the PIO program: bits n, n + 8, n + 16 of each pixel
+static __noinline void ref_888_to_planes(uint8_t planes[8][SPAN], const uint32_t *top, const uint32_t *bottom, uint n) {
+    for (uint bit = 0; bit < 8; ++bit) {
+        for (uint x = 0; x < n; ++x) {
+            uint8_t p = 0;
+            for (uint c = 0; c < 3; ++c) {
+                p |= (top[x] >> (bit + 8 * c) & 1u) << c;
+                p |= (bottom[x] >> (bit + 8 * c) & 1u) << (c + 3);
+            }
+            planes[bit][x] = p;
+        }
+    }
+}
+
+// --- Timing ---
+
+static void report(const char *name, uint64_t ref_us, uint64_t new_us, bool same) {
+    printf("%-24s per-pixel %7.2f Mpix/s, span %7.2f Mpix/s, %5.1fx %s\n", name,
+           N_PIXELS / (double) ref_us, N_PIXELS / (double) new_us, ref_us / (double) new_us,
+           same ? "" : "MISMATCH");
+}
+
+#define TIME_US(stmt) ({ \
+    uint64_t _start = time_us_64(); \
+    for (uint _n = 0; _n < N_PIXELS; _n += SPAN) { stmt; } \
+    time_us_64() - _start; \
+})
+
+int main() {
+    stdio_init_all();
+    pixel_format_init();
+
+    bool same = true;
+    for (uint v = 0; v < 0x10000; v += SPAN) {
+        for (uint i = 0; i < SPAN; ++i)
+            src[i] = v + i;
+        ref_565_to_888(ref888[0], src, SPAN);
+        pixel_span_565_to_888_gamma(out888[0], src, SPAN);
+        for (uint i = 0; i < SPAN; ++i)
+            same &= ref888[0][i] == out888[0][i];
+    }
+    for (uint i = 0; i < SPAN; ++i) {
+        src[i] = i * 0x9e37u;
+        src_bottom[i] = i * 0x7f4bu + 0x1234u;
+    }
+
+    uint64_t ref_us = TIME_US(ref_565_to_888(ref888[0], src, SPAN));
+    uint64_t new_us = TIME_US(pixel_span_565_to_888_gamma(out888[0], src, SPAN));
+    report("565 -> 888 gamma", ref_us, new_us, same);
+
+    ref_us = TIME_US(ref_565_split(out_bytes, src, SPAN));
+    new_us = TIME_US(pixel_span_565_byteswap((uint16_t *) out_words, src, SPAN));
+    same = !memcmp(out_bytes, out_words, sizeof(out_bytes));
+    report("565 byte-swapped", ref_us, new_us, same);
+
+    new_us = TIME_US(pixel_span_565_pack_msb_first(out_words, src, SPAN));
+    same = true;
+    for (uint i = 0; i < SPAN; ++i)
+        same &= (uint16_t) (out_words[i / 2] >> (i & 1 ? 0 : 16)) == src[i];
+    report("565 packed 2 per word", ref_us, new_us, same);
+
+    ref_565_to_888(out888[0], src, SPAN);
+    ref_565_to_888(out888[1], src_bottom, SPAN);
+    ref_us = TIME_US(ref_888_to_planes(ref_planes, out888[0], out888[1], SPAN));
+    new_us = TIME_US(pixel_span_888_to_planes(&planes[0][0], SPAN, out888[0], out888[1], SPAN));
+    same = !memcmp(planes, ref_planes, sizeof(planes));
+    report("888 -> bit planes", ref_us, new_us, same);
+
+    printf("Done\n");
+    return 0;
+}
@@ -0,0 +1,46 @@
+/**
+ * Copyright (c) 2022 Raspberry Pi (Trading) Ltd.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+#include "hardware/dma.h"
+#include "hardware/gpio.h"
+#include "pio_spi_multi.h"
+
+void __time_critical_func(pio_spi_multi_read_start)(const pio_spi_multi_inst_t *spi, spi_multi_read_t mode,
+                                                    uint32_t addr, uint8_t *dst, size_t len) {
+    hard_assert(spi_multi_read_width(mode) == spi->width && len);
+    uint32_t words[SPI_MULTI_MAX_CMD_WORDS];
+    uint n = spi_multi_encode_read(words, mode, addr, len);
+
+    // The RX FIFO gets a byte at a time, in the low 8 bits of each word
+    dma_channel_config c = dma_channel_get_default_config(spi->dma_chan);
+    channel_config_set_transfer_data_size(&c, DMA_SIZE_8);
+    channel_config_set_read_increment(&c, false);
+    channel_config_set_write_increment(&c, true);
+    channel_config_set_dreq(&c, pio_get_dreq(spi->pio, spi->sm, false));
+    dma_channel_configure(spi->dma_chan, &c, dst, &spi->pio->rxf[spi->sm], len, true);
+
+    gpio_put(spi->cs_pin, 0);
+    for (uint i = 0; i < n; ++i)
+        pio_sm_put_blocking(spi->pio, spi->sm, words[i]);
+}
+
+bool pio_spi_multi_is_busy(const pio_spi_multi_inst_t *spi) {
+    // The program waits at its first instruction for the next transfer, once
+    // the last clock of this one has finished
+    return dma_channel_is_busy(spi->dma_chan) || pio_sm_get_pc(spi->pio, spi->sm) != spi->prog_offs;
+}
+
+void pio_spi_multi_read_wait(const pio_spi_multi_inst_t *spi) {
+    while (pio_spi_multi_is_busy(spi))
+        tight_loop_contents();
+    gpio_put(spi->cs_pin, 1);
+}
+
+void pio_spi_multi_read_blocking(const pio_spi_multi_inst_t *spi, spi_multi_read_t mode, uint32_t addr, uint8_t *dst,
+                                 size_t len) {
+    pio_spi_multi_read_start(spi, mode, addr, dst, len);
+    pio_spi_multi_read_wait(spi);
+}
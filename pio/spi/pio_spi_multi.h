@@ -0,0 +1,38 @@
+/**
+ * Copyright (c) 2022 Raspberry Pi (Trading) Ltd.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+#ifndef _PIO_SPI_MULTI_H
+#define _PIO_SPI_MULTI_H
+
+#include "hardware/pio.h"
+#include "spi_multi.pio.h"
+#include "spi_multi_cmd.h"
+
+// A state machine running spi_dual_read (width 2) or spi_quad_read (width 4),
+// and the DMA channel which empties its RX FIFO
+typedef struct pio_spi_multi_inst {
+    PIO pio;
+    uint sm;
+    uint prog_offs;
+    uint width;
+    uint cs_pin;
+    uint dma_chan;
+} pio_spi_multi_inst_t;
+
+// Start reading len bytes at addr into dst, with a command for the program's
+// width. The command goes into the TX FIFO before this returns; the data is
+// moved by DMA.
+void pio_spi_multi_read_start(const pio_spi_multi_inst_t *spi, spi_multi_read_t mode, uint32_t addr, uint8_t *dst,
+                              size_t len);
+
+bool pio_spi_multi_is_busy(const pio_spi_multi_inst_t *spi);
+
+// Wait for the read to finish, and deselect the flash
+void pio_spi_multi_read_wait(const pio_spi_multi_inst_t *spi);
+
+void pio_spi_multi_read_blocking(const pio_spi_multi_inst_t *spi, spi_multi_read_t mode, uint32_t addr, uint8_t *dst,
+                                 size_t len);
+
+#endif
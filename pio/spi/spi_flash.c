@@ -12,6 +12,26 @@
 
 // This example uses PIO to erase, program and read back a SPI serial flash
 // memory.
+//
+// Built with PIO_SPI_FLASH_BENCHMARK=1 (as pio_spi_flash_benchmark), it
+// instead times reads of the flash with the single, dual and quad read
+// commands. The dual and quad commands need all four of the flash's data lines,
+// IO0-IO3 (DI, DO, /WP and /HOLD), on consecutive pins, so DO moves from
+// PICO_DEFAULT_SPI_RX_PIN to the pin after DI.
+
+#ifndef PIO_SPI_FLASH_BENCHMARK
+#define PIO_SPI_FLASH_BENCHMARK 0
+#endif
+
+#if PIO_SPI_FLASH_BENCHMARK
+#include <string.h>
+#include "hardware/dma.h"
+#include "pio_spi_multi.h"
+#define PIN_IO0 PICO_DEFAULT_SPI_TX_PIN
+#define PIN_MISO (PIN_IO0 + 1)
+#else
+#define PIN_MISO PICO_DEFAULT_SPI_RX_PIN
+#endif
 
 // ----------------------------------------------------------------------------
 // Generic serial flash code
@@ -27,6 +47,10 @@
 
 #define FLASH_STATUS_BUSY_MASK 0x01
 
+#define FLASH_CMD_VOLATILE_WRITE_EN 0x50
+#define FLASH_CMD_WRITE_STATUS2     0x31
+#define FLASH_STATUS2_QE_MASK       0x02
+
 void flash_read(const pio_spi_inst_t *spi, uint32_t addr, uint8_t *buf, size_t len) {
     uint8_t cmd[4] = {
             FLASH_CMD_READ,
@@ -88,6 +112,98 @@ void flash_page_program(const pio_spi_inst_t *spi, uint32_t addr, uint8_t data[]
     flash_wait_done(spi);
 }
 
+#if PIO_SPI_FLASH_BENCHMARK
+
+// Turn /WP and /HOLD into IO2 and IO3, for the quad commands. This is the
+// Winbond W25Q way; the bit is only set until the next power cycle.
+void flash_quad_enable(const pio_spi_inst_t *spi) {
+    uint8_t cmd = FLASH_CMD_VOLATILE_WRITE_EN;
+    gpio_put(spi->cs_pin, 0);
+    pio_spi_write8_blocking(spi, &cmd, 1);
+    gpio_put(spi->cs_pin, 1);
+    uint8_t status[2] = {FLASH_CMD_WRITE_STATUS2, FLASH_STATUS2_QE_MASK};
+    gpio_put(spi->cs_pin, 0);
+    pio_spi_write8_blocking(spi, status, 2);
+    gpio_put(spi->cs_pin, 1);
+    flash_wait_done(spi);
+}
+
+// ----------------------------------------------------------------------------
+// Benchmark: fill the first 64 KB of the flash with a pattern, then read it
+// back in 4 KB reads with each command in turn, all at 31.25 MHz
+
+#define BENCH_SIZE (64 * 1024)
+#define BENCH_READ 4096
+
+static uint8_t bench_buf[BENCH_SIZE];
+
+static uint8_t bench_pattern(uint32_t addr) {
+    return (uint8_t) ((addr * 2654435761u) >> 24 ^ addr);
+}
+
+static void bench_report(const char *name, uint64_t us) {
+    bool ok = true;
+    for (uint32_t i = 0; i < BENCH_SIZE; ++i)
+        ok &= bench_buf[i] == bench_pattern(i);
+    printf("%-20s %6u us, %5u KB/s, %s\n", name, (uint) us, (uint) ((uint64_t) BENCH_SIZE * 1000000 / 1024 / us),
+           ok ? "data ok" : "DATA WRONG");
+}
+
+void benchmark(const pio_spi_inst_t *spi, uint single_offs) {
+    gpio_pull_up(PIN_IO0 + 2);
+    gpio_pull_up(PIN_IO0 + 3);
+
+    puts("Writing test pattern...");
+    uint8_t page_buf[FLASH_PAGE_SIZE];
+    for (uint32_t addr = 0; addr < BENCH_SIZE; addr += FLASH_PAGE_SIZE) {
+        if (addr % FLASH_SECTOR_SIZE == 0)
+            flash_sector_erase(spi, addr);
+        for (uint i = 0; i < FLASH_PAGE_SIZE; ++i)
+            page_buf[i] = bench_pattern(addr + i);
+        flash_page_program(spi, addr, page_buf);
+    }
+    flash_quad_enable(spi);
+
+    // 4 cycles per SCK period, like the dual and quad programs at clkdiv 2
+    pio_sm_set_enabled(spi->pio, spi->sm, false);
+    pio_spi_init(spi->pio, spi->sm, single_offs, 8, 1.f, false, false, PICO_DEFAULT_SPI_SCK_PIN, PIN_IO0, PIN_MISO);
+    memset(bench_buf, 0, sizeof(bench_buf));
+    uint64_t t0 = time_us_64();
+    for (uint32_t addr = 0; addr < BENCH_SIZE; addr += BENCH_READ)
+        flash_read(spi, addr, bench_buf + addr, BENCH_READ);
+    bench_report("single (0x03)", time_us_64() - t0);
+
+    static const struct {
+        spi_multi_read_t mode;
+        const char *name;
+    } modes[] = {
+            {SPI_MULTI_READ_DUAL_OUTPUT, "dual output (0x3b)"},
+            {SPI_MULTI_READ_QUAD_OUTPUT, "quad output (0x6b)"},
+            {SPI_MULTI_READ_QUAD_IO, "quad I/O (0xeb)"},
+    };
+    uint dual_offs = pio_add_program(spi->pio, &spi_dual_read_program);
+    uint quad_offs = pio_add_program(spi->pio, &spi_quad_read_program);
+    pio_spi_multi_inst_t multi = {
+            .pio = spi->pio,
+            .sm = spi->sm,
+            .cs_pin = spi->cs_pin,
+            .dma_chan = dma_claim_unused_channel(true)
+    };
+    for (uint m = 0; m < count_of(modes); ++m) {
+        multi.width = spi_multi_read_width(modes[m].mode);
+        multi.prog_offs = multi.width == 4 ? quad_offs : dual_offs;
+        pio_sm_set_enabled(multi.pio, multi.sm, false);
+        pio_spi_multi_init(multi.pio, multi.sm, multi.prog_offs, multi.width, 2.f, PICO_DEFAULT_SPI_SCK_PIN, PIN_IO0);
+        memset(bench_buf, 0, sizeof(bench_buf));
+        t0 = time_us_64();
+        for (uint32_t addr = 0; addr < BENCH_SIZE; addr += BENCH_READ)
+            pio_spi_multi_read_blocking(&multi, modes[m].mode, addr, bench_buf + addr, BENCH_READ);
+        bench_report(modes[m].name, time_us_64() - t0);
+    }
+}
+
+#endif
+
 // ----------------------------------------------------------------------------
 // Example program
 
@@ -125,11 +241,14 @@ int main() {
                  false,   // CPOL = 0
                  PICO_DEFAULT_SPI_SCK_PIN,
                  PICO_DEFAULT_SPI_TX_PIN,
-                 PICO_DEFAULT_SPI_RX_PIN
+                 PIN_MISO
     );
     // Make the 'SPI' pins available to picotool
-    bi_decl(bi_4pins_with_names(PICO_DEFAULT_SPI_RX_PIN, "SPI RX", PICO_DEFAULT_SPI_TX_PIN, "SPI TX", PICO_DEFAULT_SPI_SCK_PIN, "SPI SCK", PICO_DEFAULT_SPI_CSN_PIN, "SPI CS"));
+    bi_decl(bi_4pins_with_names(PIN_MISO, "SPI RX", PICO_DEFAULT_SPI_TX_PIN, "SPI TX", PICO_DEFAULT_SPI_SCK_PIN, "SPI SCK", PICO_DEFAULT_SPI_CSN_PIN, "SPI CS"));
 
+#if PIO_SPI_FLASH_BENCHMARK
+    benchmark(&spi, offset);
+#else
     uint8_t page_buf[FLASH_PAGE_SIZE];
 
     const uint32_t target_addr = 0;
@@ -153,6 +272,7 @@ int main() {
 
     puts("Erase again:");
     printbuf(page_buf);
+#endif
 
     return 0;
 #endif
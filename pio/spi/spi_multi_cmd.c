@@ -0,0 +1,76 @@
+/**
+ * Copyright (c) 2022 Raspberry Pi (Trading) Ltd.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+#include "spi_multi_cmd.h"
+
+// How each command is sent: the lines used for the address and mode bits,
+// whether there are mode bits, and the number of dummy clocks
+typedef struct {
+    uint8_t cmd;
+    uint8_t addr_width;
+    uint8_t mode_bits;
+    uint8_t dummy_clocks;
+    uint8_t data_width;
+} read_cmd_t;
+
+static const read_cmd_t read_cmds[] = {
+        [SPI_MULTI_READ_DUAL_OUTPUT] = {0x3b, 1, 0, 8, 2},
+        [SPI_MULTI_READ_QUAD_OUTPUT] = {0x6b, 1, 0, 8, 4},
+        [SPI_MULTI_READ_QUAD_IO] = {0xeb, 4, 8, 4, 4},
+};
+
+// Mode bits which don't ask the flash to skip the command byte next time
+#define MODE_BITS 0xff
+
+uint spi_multi_read_width(spi_multi_read_t mode) {
+    return read_cmds[mode].data_width;
+}
+
+static uint drive_clocks(const read_cmd_t *r) {
+    return 8 + (24 + r->mode_bits) / r->addr_width + r->dummy_clocks;
+}
+
+uint32_t spi_multi_read_clocks(spi_multi_read_t mode, uint32_t len) {
+    const read_cmd_t *r = &read_cmds[mode];
+    return drive_clocks(r) + len * 8 / r->data_width;
+}
+
+typedef struct {
+    uint32_t *words;
+    uint n;
+    uint bits;
+    uint width;
+} packer_t;
+
+static void put_symbol(packer_t *p, uint32_t value) {
+    if (p->bits == 0)
+        p->words[p->n++] = 0;
+    p->bits += p->width;
+    p->words[p->n - 1] |= value << (32 - p->bits);
+    if (p->bits == 32)
+        p->bits = 0;
+}
+
+// Send the top n bits of value, line_width bits per clock
+static void put_bits(packer_t *p, uint32_t value, uint n, uint line_width) {
+    for (uint i = 0; i < n; i += line_width) {
+        uint32_t symbol = (value >> (n - i - line_width)) & ((1u << line_width) - 1);
+        put_symbol(p, symbol);
+    }
+}
+
+uint spi_multi_encode_read(uint32_t *words, spi_multi_read_t mode, uint32_t addr, uint32_t len) {
+    const read_cmd_t *r = &read_cmds[mode];
+    words[0] = drive_clocks(r) - 1;
+    words[1] = len * 8 / r->data_width - 1;
+    packer_t p = {.words = words, .n = 2, .bits = 0, .width = r->data_width};
+    put_bits(&p, r->cmd, 8, 1);
+    put_bits(&p, addr & 0xffffff, 24, r->addr_width);
+    put_bits(&p, MODE_BITS, r->mode_bits, r->addr_width);
+    for (uint i = 0; i < r->dummy_clocks; ++i)
+        put_symbol(&p, 0);
+    return p.n;
+}
@@ -0,0 +1,44 @@
+/**
+ * Copyright (c) 2022 Raspberry Pi (Trading) Ltd.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+#ifndef _SPI_MULTI_CMD_H
+#define _SPI_MULTI_CMD_H
+
+#include "pico.h"
+
+// ----------------------------------------------------------------------------
+// Puts together the words which tell the spi_dual_read and spi_quad_read
+// programs (spi_multi.pio) how to carry out a flash read command.
+//
+// Each command has up to four parts before the data: the command byte itself,
+// which always goes on IO0 alone, then the address, mode bits and dummy
+// clocks, some on one line and some on all of them. The program only knows
+// how to drive all of its lines at once, so a part which goes on one line is
+// sent a bit per clock, with the bit on IO0 and the other lines low.
+//
+// The data comes back on all the lines, most significant bits first, which
+// is the order the program shifts them in; with IO0 on the lowest pin, the
+// bytes come out of the RX FIFO as they are.
+
+typedef enum {
+    SPI_MULTI_READ_DUAL_OUTPUT, // 0x3B: address on IO0, data on IO0-1
+    SPI_MULTI_READ_QUAD_OUTPUT, // 0x6B: address on IO0, data on IO0-3
+    SPI_MULTI_READ_QUAD_IO,     // 0xEB: address, mode and data on IO0-3
+} spi_multi_read_t;
+
+// The most words spi_multi_encode_read() produces
+#define SPI_MULTI_MAX_CMD_WORDS 8
+
+// The number of data lines the command needs: the program to run it with
+uint spi_multi_read_width(spi_multi_read_t mode);
+
+// Write the words for a read of len (at least 1) bytes at addr to words, and
+// return how many there are
+uint spi_multi_encode_read(uint32_t *words, spi_multi_read_t mode, uint32_t addr, uint32_t len);
+
+// The number of SCK cycles a read of len bytes takes, command and all
+uint32_t spi_multi_read_clocks(spi_multi_read_t mode, uint32_t len);
+
+#endif
@@ -0,0 +1,235 @@
+/**
+ * Copyright (c) 2022 Raspberry Pi (Trading) Ltd.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+#include <stdio.h>
+#include <string.h>
+#include "pico/stdlib.h"
+#include "spi_multi_cmd.h"
+#include "test_rand.h"
+
+// Checks the words spi_multi_encode_read() puts together, by running them
+// through a model of the spi_dual_read and spi_quad_read programs, clock by
+// clock, against a model of a flash which knows the commands from its
+// datasheet. Also works out the throughput of each command. Both models are
+// in C, so neither a PIO nor a flash chip is needed.
+
+// The SCK the programs run at with clkdiv 2 at 125 MHz
+#define SCK_HZ 31250000
+
+// ----------------------------------------------------------------------------
+// The flash: takes in the state of IO0-IO3 on each rising edge of SCK while
+// the host drives them, then drives them itself with the data. Its contents
+// are a function of the address, so the whole 16 MB needn't be stored.
+
+static uint8_t flash_byte(uint32_t addr) {
+    addr &= 0xffffff;
+    return (uint8_t) ((addr * 2654435761u) >> 24 ^ addr);
+}
+
+typedef struct {
+    uint clocks;
+    uint8_t cmd;
+    uint32_t addr;
+    uint8_t mode;
+    // From the datasheet, once the command is known
+    uint addr_width, mode_clocks, dummy_clocks, data_width;
+    // Lines driven which should have been left alone, or low
+    bool bad_lines;
+    // Clocks driven by the host once the flash had started driving, or not
+    // driven before it did
+    bool contention;
+    bool unknown_cmd;
+    uint out_bits;
+} flash_model_t;
+
+static uint cmd_clocks(const flash_model_t *f) {
+    return 8 + 24 / f->addr_width + f->mode_clocks + f->dummy_clocks;
+}
+
+static void flash_clock_in(flash_model_t *f, uint lines, uint width) {
+    uint t = f->clocks++;
+    if (t < 8) {
+        f->cmd = (uint8_t) (f->cmd << 1 | (lines & 1));
+        if (lines & ~1u)
+            f->bad_lines = true;
+        if (t == 7) {
+            switch (f->cmd) {
+                case 0x3b:
+                    f->addr_width = 1, f->mode_clocks = 0, f->dummy_clocks = 8, f->data_width = 2;
+                    break;
+                case 0x6b:
+                    f->addr_width = 1, f->mode_clocks = 0, f->dummy_clocks = 8, f->data_width = 4;
+                    break;
+                case 0xeb:
+                    f->addr_width = 4, f->mode_clocks = 2, f->dummy_clocks = 4, f->data_width = 4;
+                    break;
+                default:
+                    f->unknown_cmd = true;
+                    f->addr_width = 1, f->data_width = width;
+            }
+        }
+        return;
+    }
+    uint addr_end = 8 + 24 / f->addr_width;
+    if (t < addr_end) {
+        f->addr = f->addr << f->addr_width | (lines & ((1u << f->addr_width) - 1));
+        if (lines >> f->addr_width)
+            f->bad_lines = true;
+    } else if (t < addr_end + f->mode_clocks) {
+        f->mode = (uint8_t) (f->mode << 4 | lines);
+    } else if (t >= cmd_clocks(f)) {
+        f->contention = true;
+    }
+}
+
+static uint flash_clock_out(flash_model_t *f) {
+    if (f->clocks++ < cmd_clocks(f))
+        f->contention = true;
+    uint32_t bit = f->out_bits;
+    f->out_bits += f->data_width;
+    uint8_t b = flash_byte(f->addr + bit / 8);
+    return (b >> (8 - f->data_width - bit % 8)) & ((1u << f->data_width) - 1);
+}
+
+// ----------------------------------------------------------------------------
+// The program: pull the clock counts, drive the values from the words, then
+// shift the pins in and push each byte
+
+static uint run_program(flash_model_t *f, uint width, const uint32_t *words, uint n, uint8_t *dst, uint32_t max_len) {
+    uint32_t x = words[0], y = words[1];
+    uint word = 2, bits = 0;
+    for (uint32_t i = 0; i <= x; ++i) {
+        uint32_t symbol = 0;
+        if (word < n) {
+            symbol = (words[word] << bits) >> (32 - width);
+            bits += width;
+            if (bits == 32) {
+                ++word;
+                bits = 0;
+            }
+        } else {
+            // Ran off the end: the real program would stall
+            f->bad_lines = true;
+        }
+        flash_clock_in(f, symbol, width);
+    }
+    uint32_t isr = 0, isr_bits = 0, len = 0;
+    for (uint32_t i = 0; i <= y; ++i) {
+        isr = isr << width | flash_clock_out(f);
+        isr_bits += width;
+        if (isr_bits == 8) {
+            if (len < max_len)
+                dst[len] = (uint8_t) isr;
+            ++len;
+            isr = isr_bits = 0;
+        }
+    }
+    // Anything left in the words would be dropped by the next pull, but
+    // shouldn't have been worth sending
+    if (word < n && !(word == n - 1 && bits))
+        f->bad_lines = true;
+    return len;
+}
+
+// ----------------------------------------------------------------------------
+
+static uint failures;
+
+static void result(const char *name, bool ok) {
+    printf("%-40s %s\n", name, ok ? "ok" : "FAILED");
+    if (!ok)
+        ++failures;
+}
+
+static const struct {
+    spi_multi_read_t mode;
+    const char *name;
+    uint8_t cmd;
+} modes[] = {
+        {SPI_MULTI_READ_DUAL_OUTPUT, "dual output (0x3b)", 0x3b},
+        {SPI_MULTI_READ_QUAD_OUTPUT, "quad output (0x6b)", 0x6b},
+        {SPI_MULTI_READ_QUAD_IO, "quad I/O (0xeb)", 0xeb},
+};
+
+#define MAX_LEN 1024
+
+static void test_mode(uint m) {
+    static uint8_t data[MAX_LEN];
+    spi_multi_read_t mode = modes[m].mode;
+    uint width = spi_multi_read_width(mode);
+    bool cmd_ok = true, lines_ok = true, timing_ok = true, data_ok = true, words_ok = true, clocks_ok = true;
+    for (uint i = 0; i < 2000; ++i) {
+        uint32_t addr = next_rand() & 0xffffff;
+        uint32_t len = 1 + (i < 1000 ? next_rand() % 16 : next_rand() % MAX_LEN);
+        uint32_t words[SPI_MULTI_MAX_CMD_WORDS + 1];
+        words[SPI_MULTI_MAX_CMD_WORDS] = 0xdeadbeef;
+        uint n = spi_multi_encode_read(words, mode, addr, len);
+        words_ok &= n <= SPI_MULTI_MAX_CMD_WORDS && words[SPI_MULTI_MAX_CMD_WORDS] == 0xdeadbeef;
+
+        flash_model_t f;
+        memset(&f, 0, sizeof(f));
+        uint32_t got = run_program(&f, width, words, n, data, MAX_LEN);
+        cmd_ok &= f.cmd == modes[m].cmd && !f.unknown_cmd && f.addr == addr && f.data_width == width;
+        if (f.mode_clocks)
+            cmd_ok &= (f.mode & 0x30) != 0x20;
+        lines_ok &= !f.bad_lines;
+        timing_ok &= !f.contention;
+        clocks_ok &= f.clocks == spi_multi_read_clocks(mode, len);
+        if (got != len) {
+            data_ok = false;
+            continue;
+        }
+        for (uint32_t j = 0; j < len; ++j)
+            data_ok &= data[j] == flash_byte(addr + j);
+    }
+    char name[64];
+    snprintf(name, sizeof(name), "%s: command and address", modes[m].name);
+    result(name, cmd_ok);
+    snprintf(name, sizeof(name), "%s: single line parts", modes[m].name);
+    result(name, lines_ok);
+    snprintf(name, sizeof(name), "%s: bus turnaround", modes[m].name);
+    result(name, timing_ok);
+    snprintf(name, sizeof(name), "%s: data", modes[m].name);
+    result(name, data_ok);
+    snprintf(name, sizeof(name), "%s: words", modes[m].name);
+    result(name, words_ok);
+    snprintf(name, sizeof(name), "%s: clock count", modes[m].name);
+    result(name, clocks_ok);
+}
+
+// Bytes per second at SCK_HZ, command and all
+static uint32_t throughput(uint32_t clocks, uint32_t len) {
+    return (uint32_t) ((uint64_t) len * SCK_HZ / clocks);
+}
+
+static void print_throughput(void) {
+    static const uint32_t lens[] = {16, 256, 4096};
+    printf("Throughput at %u MHz SCK, in KB/s, for reads of:\n%-20s", SCK_HZ / 1000000, "");
+    for (uint i = 0; i < count_of(lens); ++i)
+        printf("%8u B", lens[i]);
+    printf("\n%-20s", "single (0x03)");
+    for (uint i = 0; i < count_of(lens); ++i)
+        printf("%10u", throughput(32 + 8 * lens[i], lens[i]) / 1024);
+    printf("\n");
+    for (uint m = 0; m < count_of(modes); ++m) {
+        printf("%-20s", modes[m].name);
+        for (uint i = 0; i < count_of(lens); ++i)
+            printf("%10u", throughput(spi_multi_read_clocks(modes[m].mode, lens[i]), lens[i]) / 1024);
+        printf("\n");
+    }
+}
+
+int main() {
+    stdio_init_all();
+    printf("PIO SPI dual/quad read test\n");
+
+    for (uint m = 0; m < count_of(modes); ++m)
+        test_mode(m);
+    print_throughput();
+
+    printf(failures ? "FAILED\n" : "All good\n");
+    return failures ? 1 : 0;
+}
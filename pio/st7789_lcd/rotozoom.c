@@ -0,0 +1,47 @@
+/**
+ * Copyright (c) 2022 Raspberry Pi (Trading) Ltd.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+#include <math.h>
+#include "rotozoom.h"
+
+void rotozoom_interp_init(interp_hw_t *interp, const uint16_t *texture, uint log_size) {
+    // Lane 0 gives the u coordinate in bits log_size:1 of the texel offset, and
+    // lane 1 gives v in bits 2 * log_size:log_size + 1. ACCUM0/1 hold the
+    // current coordinates, and BASE0/1 the step per pixel. With ADD_RAW, each
+    // pop adds the step to the whole accumulator, not just the masked bits.
+    interp_config lane0_cfg = interp_default_config();
+    interp_config_set_shift(&lane0_cfg, ROTOZOOM_UNIT_LSB - 1); // -1 because 2 bytes per pixel
+    interp_config_set_mask(&lane0_cfg, 1, 1 + (log_size - 1));
+    interp_config_set_add_raw(&lane0_cfg, true);
+    interp_config lane1_cfg = interp_default_config();
+    interp_config_set_shift(&lane1_cfg, ROTOZOOM_UNIT_LSB - (1 + log_size));
+    interp_config_set_mask(&lane1_cfg, 1 + log_size, 1 + (2 * log_size - 1));
+    interp_config_set_add_raw(&lane1_cfg, true);
+
+    interp_set_config(interp, 0, &lane0_cfg);
+    interp_set_config(interp, 1, &lane1_cfg);
+    interp_set_base(interp, 2, (uintptr_t) texture);
+}
+
+void rotozoom_transform_init(rotozoom_transform_t *t, float theta, float zoom) {
+    float scale = (float) (1 << ROTOZOOM_UNIT_LSB) / zoom;
+    float c = cosf(theta) * scale;
+    float s = sinf(theta) * scale;
+    t->rotate[0] = (int32_t) c;
+    t->rotate[1] = (int32_t) -s;
+    t->rotate[2] = (int32_t) s;
+    t->rotate[3] = (int32_t) c;
+}
+
+void __not_in_flash_func(rotozoom_render_line)(interp_hw_t *interp, const rotozoom_transform_t *t, int y,
+                                               uint16_t *line, uint width) {
+    interp_set_base(interp, 0, t->rotate[0]);
+    interp_set_base(interp, 1, t->rotate[2]);
+    interp_set_accumulator(interp, 0, (uint32_t) t->rotate[1] * (uint32_t) y);
+    interp_set_accumulator(interp, 1, (uint32_t) t->rotate[3] * (uint32_t) y);
+    for (uint x = 0; x < width; ++x)
+        line[x] = *(const uint16_t *) interp_pop_full_result(interp);
+}
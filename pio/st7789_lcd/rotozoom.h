@@ -0,0 +1,38 @@
+/**
+ * Copyright (c) 2022 Raspberry Pi (Trading) Ltd.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+#ifndef _ROTOZOOM_H
+#define _ROTOZOOM_H
+
+#include "pico.h"
+#include "hardware/interp.h"
+
+// Scanline renderer for the spinning image in st7789_lcd.c, split out so that
+// each core can render its own lines, and so that the host build can check
+// the output against a plain C version.
+//
+// Lane 0 of the interpolator steps the u coordinate and lane 1 the v
+// coordinate, both 16.16 fixed point, and the full result is the address of
+// the texel. Each core has its own interp0, so call rotozoom_interp_init() on
+// every core that renders.
+
+#define ROTOZOOM_UNIT_LSB 16
+
+typedef struct {
+    // 2x2 transform from screen to texture coordinates, 16.16 fixed point:
+    // u = rotate[0] * x + rotate[1] * y, v = rotate[2] * x + rotate[3] * y
+    int32_t rotate[4];
+} rotozoom_transform_t;
+
+void rotozoom_interp_init(interp_hw_t *interp, const uint16_t *texture, uint log_size);
+
+// Rotate by theta radians, and scale the texture up by zoom
+void rotozoom_transform_init(rotozoom_transform_t *t, float theta, float zoom);
+
+// Render screen line y into line[0 .. width - 1]
+void rotozoom_render_line(interp_hw_t *interp, const rotozoom_transform_t *t, int y, uint16_t *line, uint width);
+
+#endif
@@ -10,9 +10,13 @@
 #include "pico/stdlib.h"
 #include "hardware/pio.h"
 #include "hardware/gpio.h"
-#include "hardware/interp.h"
+#include "hardware/dma.h"
+#include "hardware/irq.h"
+#include "hardware/sync.h"
+#include "pico/multicore.h"
 
 #include "st7789_lcd.pio.h"
+#include "rotozoom.h"
 #include "raspberry_256x256_rgb565.h"
 
 #define SCREEN_WIDTH 240
@@ -29,6 +33,13 @@
 
 #define SERIAL_CLK_DIV 1.f
 
+// Render alternate lines on core 1 as well as core 0
+#define RENDER_ON_BOTH_CORES 1
+
+// Lines in flight between the renderers and the DMA. Each core needs one to
+// render into whilst another is being sent.
+#define N_LINE_BUFS 4
+
 // Format: cmd length (including cmd byte), post delay in units of 5 ms, then cmd payload
 // Note the delays have been shortened a little
 static const uint8_t st7789_init_seq[] = {
@@ -79,6 +90,73 @@ static inline void st7789_start_pixels(PIO pio, uint sm) {
     lcd_set_dc_cs(1, 0);
 }
 
+// ----------------------------------------------------------------------------
+// Rendering and sending are overlapped: line y is rendered into
+// line_buf[y % N_LINE_BUFS] by core y % n_cores, whilst DMA sends earlier
+// lines to the PIO. The DMA sends lines strictly in order, and is started
+// either by its own completion IRQ (if the next line is ready) or by whichever
+// core finishes the line it was waiting for.
+
+static uint16_t line_buf[N_LINE_BUFS][SCREEN_WIDTH];
+// Set by a renderer when the line is ready, cleared when the DMA has sent it
+static volatile bool line_ready[N_LINE_BUFS];
+// Next line for the DMA to send, and whether it is busy sending one now
+static volatile uint send_line;
+static volatile bool dma_busy;
+
+static spin_lock_t *line_lock;
+static uint dma_chan;
+static rotozoom_transform_t transform;
+
+// Call with line_lock held
+static void start_next_line_locked(void) {
+    uint b = send_line % N_LINE_BUFS;
+    if (!dma_busy && send_line < SCREEN_HEIGHT && line_ready[b]) {
+        dma_busy = true;
+        dma_channel_transfer_from_buffer_now(dma_chan, line_buf[b], SCREEN_WIDTH);
+    }
+}
+
+static void __isr dma_complete_handler(void) {
+    dma_hw->ints0 = 1u << dma_chan;
+    spin_lock_unsafe_blocking(line_lock);
+    line_ready[send_line % N_LINE_BUFS] = false;
+    ++send_line;
+    dma_busy = false;
+    start_next_line_locked();
+    spin_unlock_unsafe(line_lock);
+}
+
+// Render every n_cores'th line of the frame, starting with line first.
+// Returns the time spent rendering.
+static uint32_t render_lines(uint first, uint n_cores) {
+    uint32_t render_us = 0;
+    for (uint y = first; y < SCREEN_HEIGHT; y += n_cores) {
+        uint b = y % N_LINE_BUFS;
+        // Wait for the DMA to finish with the last line in this buffer
+        while (line_ready[b])
+            tight_loop_contents();
+        uint32_t start = time_us_32();
+        rotozoom_render_line(interp0, &transform, y, line_buf[b], SCREEN_WIDTH);
+        render_us += time_us_32() - start;
+        uint32_t save = spin_lock_blocking(line_lock);
+        line_ready[b] = true;
+        if (send_line == y)
+            start_next_line_locked();
+        spin_unlock(line_lock, save);
+    }
+    return render_us;
+}
+
+static void core1_entry(void) {
+    rotozoom_interp_init(interp0, (const uint16_t *) raspberry_256x256, LOG_IMAGE_SIZE);
+    while (true) {
+        // Core 0 pushes anything to start a frame, and we push back when done
+        multicore_fifo_pop_blocking();
+        multicore_fifo_push_blocking(render_lines(1, 2));
+    }
+}
+
 int main() {
     stdio_init_all();
 
@@ -104,45 +182,61 @@ int main() {
     // Other SDKs: static image on screen, lame, boring
     // Raspberry Pi Pico SDK: spinning image on screen, bold, exciting
 
-    // Lane 0 will be u coords (bits 8:1 of addr offset), lane 1 will be v
-    // coords (bits 16:9 of addr offset), and we'll represent coords with
-    // 16.16 fixed point. ACCUM0,1 will contain current coord, BASE0/1 will
-    // contain increment vector, and BASE2 will contain image base pointer
-#define UNIT_LSB 16
-    interp_config lane0_cfg = interp_default_config();
-    interp_config_set_shift(&lane0_cfg, UNIT_LSB - 1); // -1 because 2 bytes per pixel
-    interp_config_set_mask(&lane0_cfg, 1, 1 + (LOG_IMAGE_SIZE - 1));
-    interp_config_set_add_raw(&lane0_cfg, true); // Add full accumulator to base with each POP
-    interp_config lane1_cfg = interp_default_config();
-    interp_config_set_shift(&lane1_cfg, UNIT_LSB - (1 + LOG_IMAGE_SIZE));
-    interp_config_set_mask(&lane1_cfg, 1 + LOG_IMAGE_SIZE, 1 + (2 * LOG_IMAGE_SIZE - 1));
-    interp_config_set_add_raw(&lane1_cfg, true);
-
-    interp_set_config(interp0, 0, &lane0_cfg);
-    interp_set_config(interp0, 1, &lane1_cfg);
-    interp0->base[2] = (uint32_t) raspberry_256x256;
+    // Pixels are sent by DMA straight from the line buffers, 16 bits at a
+    // time. The narrow writes are replicated across the FIFO word, and with a
+    // pull threshold of 16 the SM shifts out the top half, MSB first.
+    dma_chan = dma_claim_unused_channel(true);
+    dma_channel_config c = dma_channel_get_default_config(dma_chan);
+    channel_config_set_transfer_data_size(&c, DMA_SIZE_16);
+    channel_config_set_dreq(&c, pio_get_dreq(pio, sm, true));
+    dma_channel_configure(dma_chan, &c, &pio->txf[sm], NULL, SCREEN_WIDTH, false);
+
+    line_lock = spin_lock_instance(spin_lock_claim_unused(true));
+    dma_channel_set_irq0_enabled(dma_chan, true);
+    irq_set_exclusive_handler(DMA_IRQ_0, dma_complete_handler);
+    irq_set_enabled(DMA_IRQ_0, true);
+
+    rotozoom_interp_init(interp0, (const uint16_t *) raspberry_256x256, LOG_IMAGE_SIZE);
+    uint n_cores = 1;
+#if RENDER_ON_BOTH_CORES
+    multicore_launch_core1(core1_entry);
+    n_cores = 2;
+#endif
 
     float theta = 0.f;
     float theta_max = 2.f * (float) M_PI;
+    uint frames = 0;
+    uint64_t render_us = 0;
+    uint64_t report_start = time_us_64();
     while (1) {
         theta += 0.02f;
         if (theta > theta_max)
             theta -= theta_max;
-        int32_t rotate[4] = {
-                cosf(theta) * (1 << UNIT_LSB), -sinf(theta) * (1 << UNIT_LSB),
-                sinf(theta) * (1 << UNIT_LSB), cosf(theta) * (1 << UNIT_LSB)
-        };
-        interp0->base[0] = rotate[0];
-        interp0->base[1] = rotate[2];
+        rotozoom_transform_init(&transform, theta, 1.f);
+
         st7789_start_pixels(pio, sm);
-        for (int y = 0; y < SCREEN_HEIGHT; ++y) {
-            interp0->accum[0] = rotate[1] * y;
-            interp0->accum[1] = rotate[3] * y;
-            for (int x = 0; x < SCREEN_WIDTH; ++x) {
-                uint16_t colour = *(uint16_t *) (interp0->pop[2]);
-                st7789_lcd_put(pio, sm, colour >> 8);
-                st7789_lcd_put(pio, sm, colour & 0xff);
-            }
+        st7789_lcd_set_pull_bits(pio, sm, 16);
+        send_line = 0;
+#if RENDER_ON_BOTH_CORES
+        multicore_fifo_push_blocking(0);
+#endif
+        render_us += render_lines(0, n_cores);
+#if RENDER_ON_BOTH_CORES
+        render_us += multicore_fifo_pop_blocking();
+#endif
+        while (send_line < SCREEN_HEIGHT)
+            tight_loop_contents();
+        st7789_lcd_wait_idle(pio, sm);
+        st7789_lcd_set_pull_bits(pio, sm, 8);
+
+        ++frames;
+        uint64_t now = time_us_64();
+        if (now - report_start >= 1000000) {
+            printf("%.1f fps, %.1f us to render a line\n", frames * 1e6f / (float) (now - report_start),
+                   (float) render_us / (float) (frames * SCREEN_HEIGHT));
+            frames = 0;
+            render_us = 0;
+            report_start = now;
         }
     }
 }
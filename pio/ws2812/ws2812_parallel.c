@@ -14,6 +14,7 @@
 #include "hardware/dma.h"
 #include "hardware/irq.h"
 #include "ws2812.pio.h"
+#include "ws2812_transform.h"
 
 #define FRAC_BITS 4
 #define NUM_PIXELS 64
@@ -145,28 +146,11 @@ void add_error(value_bits_t *d, const value_bits_t *s, const value_bits_t *e) {
     }
 }
 
-typedef struct {
-    uint8_t *data;
-    uint data_len;
-    uint frac_brightness; // 256 = *1.0;
-} string_t;
-
 // takes 8 bit color values, multiply by brightness and store in bit planes
 void transform_strings(string_t **strings, uint num_strings, value_bits_t *values, uint value_length,
                        uint frac_brightness) {
-    for (uint v = 0; v < value_length; v++) {
-        memset(&values[v], 0, sizeof(values[v]));
-        for (int i = 0; i < num_strings; i++) {
-            if (v < strings[i]->data_len) {
-                // todo clamp?
-                uint32_t value = (strings[i]->data[v] * strings[i]->frac_brightness) >> 8u;
-                value = (value * frac_brightness) >> 8u;
-                for (int j = 0; j < VALUE_PLANE_COUNT && value; j++, value >>= 1u) {
-                    if (value & 1u) values[v].planes[VALUE_PLANE_COUNT - 1 - j] |= 1u << i;
-                }
-            }
-        }
-    }
+    // value_bits_t is just its planes, so an array of them is one long run of planes
+    ws2812_transform_strings(strings, num_strings, values->planes, VALUE_PLANE_COUNT, value_length, frac_brightness);
 }
 
 void dither_values(const value_bits_t *colors, value_bits_t *state, const value_bits_t *old_state, uint value_length) {
@@ -0,0 +1,67 @@
+/**
+ * Copyright (c) 2022 Raspberry Pi (Trading) Ltd.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+#include "ws2812_transform.h"
+
+// One step of the 32x32 transpose (Hacker's Delight, transpose32a): swap the
+// j x j blocks above and below the diagonal of each 2j x 2j block. The matrix
+// is transposed about its other diagonal compared to the usual picture, as
+// word 0 is the top row but bit 0 is the right hand column.
+static inline void transpose_step(uint32_t *a, uint j, uint32_t m) {
+    for (uint k = 0; k < 32; k = (k + j + 1) & ~j) {
+        uint32_t t = (a[k] ^ (a[k + j] >> j)) & m;
+        a[k] ^= t;
+        a[k + j] ^= t << j;
+    }
+}
+
+static inline void transpose32(uint32_t *a) {
+    transpose_step(a, 16, 0x0000ffffu);
+    transpose_step(a, 8, 0x00ff00ffu);
+    transpose_step(a, 4, 0x0f0f0f0fu);
+    transpose_step(a, 2, 0x33333333u);
+    transpose_step(a, 1, 0x55555555u);
+}
+
+void __not_in_flash_func(ws2812_transform_strings)(string_t **strings, uint num_strings, uint32_t *planes,
+                                                   uint plane_count, uint value_length, uint frac_brightness) {
+    // Each value takes up a power of 2 bits of a plane word, so that several
+    // values can go through the transpose at once
+    uint log_stride = 0;
+    while ((1u << log_stride) < num_strings)
+        ++log_stride;
+    const uint stride = 1u << log_stride;
+    const uint values_per_batch = 32 >> log_stride;
+    const uint32_t string_mask = stride == 32 ? 0xffffffffu : (1u << stride) - 1;
+
+    for (uint v0 = 0; v0 < value_length; v0 += values_per_batch) {
+        uint n = MIN(values_per_batch, value_length - v0);
+        // Row r of the matrix is string r % stride of value v0 + r / stride.
+        // Rows go in from the bottom up, so that after the transpose, the plane
+        // for bit b of the values is at the same index as the value for row
+        // 31 - b. This puts the planes in MSB first order, at the end.
+        uint32_t rows[32];
+        for (uint r = 0; r < 32; ++r) {
+            uint i = r & (stride - 1);
+            uint v = v0 + (r >> log_stride);
+            uint32_t value = 0;
+            if (i < num_strings && v < strings[i]->data_len) {
+                // todo clamp?
+                value = (strings[i]->data[v] * strings[i]->frac_brightness) >> 8u;
+                value = (value * frac_brightness) >> 8u;
+            }
+            rows[31 - r] = value;
+        }
+        transpose32(rows);
+        const uint32_t *msb_plane = rows + 32 - plane_count;
+        for (uint k = 0; k < n; ++k) {
+            uint32_t *dst = planes + (v0 + k) * plane_count;
+            uint shift = k << log_stride;
+            for (uint p = 0; p < plane_count; ++p)
+                dst[p] = (msb_plane[p] >> shift) & string_mask;
+        }
+    }
+}
@@ -0,0 +1,35 @@
+/**
+ * Copyright (c) 2022 Raspberry Pi (Trading) Ltd.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+#ifndef _WS2812_TRANSFORM_H
+#define _WS2812_TRANSFORM_H
+
+#include "pico.h"
+
+// Bit plane conversion for ws2812_parallel.c
+//
+// Each value (one colour component of one pixel) is stored as plane_count bit
+// planes, MSB first, where bit i of a plane belongs to string i. With the
+// FRAC_BITS of dithering in ws2812_parallel.c, plane_count is 8 + FRAC_BITS.
+
+typedef struct {
+    uint8_t *data;
+    uint data_len;
+    uint frac_brightness; // 256 = *1.0;
+} string_t;
+
+// Scale the 8 bit values of up to 32 strings by each string's brightness and
+// then by frac_brightness, and store them in bit planes, plane_count (at most
+// 32) words per value. Values past the end of a string's data are 0.
+//
+// Rather than testing each bit of each value, this builds a 32x32 bit matrix
+// from several values' worth of strings at once (32 / num_strings rounded
+// up to a power of 2), and transposes the whole matrix with word-wide masks
+// and shifts.
+void ws2812_transform_strings(string_t **strings, uint num_strings, uint32_t *planes, uint plane_count,
+                              uint value_length, uint frac_brightness);
+
+#endif
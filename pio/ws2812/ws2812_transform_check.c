@@ -0,0 +1,119 @@
+/**
+ * Copyright (c) 2022 Raspberry Pi (Trading) Ltd.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+#include <stdio.h>
+#include <string.h>
+#include "pico/stdlib.h"
+#include "ws2812_transform.h"
+#include "test_rand.h"
+
+// Check ws2812_transform_strings() against the per-bit loop it replaced in
+// ws2812_parallel.c, for every FRAC_BITS setting the plane layout allows and
+// every number of strings, then time the two.
+
+#define MAX_VALUES (64 * 4)
+#define MAX_STRINGS 32
+#define MAX_PLANES 32
+#define BENCH_REPEATS 64
+
+static uint8_t string_data[MAX_STRINGS][MAX_VALUES];
+static string_t string_storage[MAX_STRINGS];
+static string_t *strings[MAX_STRINGS];
+static uint32_t planes[MAX_VALUES * MAX_PLANES];
+static uint32_t ref_planes[MAX_VALUES * MAX_PLANES];
+
+// The original transform_strings(), with the plane count as a parameter
+// rather than VALUE_PLANE_COUNT
+static __noinline void ref_transform_strings(string_t **strings, uint num_strings, uint32_t *planes, uint plane_count,
+                                             uint value_length, uint frac_brightness) {
+    for (uint v = 0; v < value_length; v++) {
+        uint32_t *value_planes = planes + v * plane_count;
+        memset(value_planes, 0, plane_count * sizeof(uint32_t));
+        for (int i = 0; i < num_strings; i++) {
+            if (v < strings[i]->data_len) {
+                uint32_t value = (strings[i]->data[v] * strings[i]->frac_brightness) >> 8u;
+                value = (value * frac_brightness) >> 8u;
+                for (int j = 0; j < plane_count && value; j++, value >>= 1u) {
+                    if (value & 1u) value_planes[plane_count - 1 - j] |= 1u << i;
+                }
+            }
+        }
+    }
+}
+
+static void make_strings(uint num_strings) {
+    for (uint i = 0; i < num_strings; ++i) {
+        for (uint v = 0; v < MAX_VALUES; ++v)
+            string_data[i][v] = (uint8_t) next_rand();
+        string_storage[i].data = string_data[i];
+        // Mix of RGB and RGBW strings, and some short ones
+        string_storage[i].data_len = (next_rand() & 3) ? MAX_VALUES - (i & 1) * 64 : next_rand() % MAX_VALUES;
+        string_storage[i].frac_brightness = next_rand() % 0x101;
+        strings[i] = &string_storage[i];
+    }
+}
+
+static uint check(uint frac_bits, uint num_strings, uint value_length) {
+    uint plane_count = 8 + frac_bits;
+    // ws2812_parallel.c ramps frac_brightness up to 0x20 << FRAC_BITS; go a
+    // bit further, so values overflow the planes too
+    uint frac_brightness = next_rand() % (0x200u << MIN(frac_bits, 22));
+    make_strings(num_strings);
+    memset(planes, 0xaa, sizeof(planes));
+    ref_transform_strings(strings, num_strings, ref_planes, plane_count, value_length, frac_brightness);
+    ws2812_transform_strings(strings, num_strings, planes, plane_count, value_length, frac_brightness);
+    if (memcmp(planes, ref_planes, value_length * plane_count * sizeof(uint32_t))) {
+        printf("FRAC_BITS %u, %u strings, %u values, brightness %u: MISMATCH\n", frac_bits, num_strings, value_length,
+               frac_brightness);
+        return 1;
+    }
+    // Nothing written past the end
+    if (value_length * plane_count < count_of(planes) && planes[value_length * plane_count] != 0xaaaaaaaau) {
+        printf("FRAC_BITS %u, %u strings, %u values: wrote past the end\n", frac_bits, num_strings, value_length);
+        return 1;
+    }
+    return 0;
+}
+
+static void bench(uint frac_bits, uint num_strings) {
+    uint plane_count = 8 + frac_bits;
+    make_strings(num_strings);
+    uint64_t t0 = time_us_64();
+    for (uint i = 0; i < BENCH_REPEATS; ++i)
+        ref_transform_strings(strings, num_strings, ref_planes, plane_count, MAX_VALUES, 0x10 << frac_bits);
+    uint64_t t1 = time_us_64();
+    for (uint i = 0; i < BENCH_REPEATS; ++i)
+        ws2812_transform_strings(strings, num_strings, planes, plane_count, MAX_VALUES, 0x10 << frac_bits);
+    uint64_t t2 = time_us_64();
+    printf("FRAC_BITS %u, %2u strings: %7.1f us -> %7.1f us per frame (%.1fx)\n", frac_bits, num_strings,
+           (double) (t1 - t0) / BENCH_REPEATS, (double) (t2 - t1) / BENCH_REPEATS,
+           (double) (t1 - t0) / (double) (t2 - t1 ? t2 - t1 : 1));
+}
+
+int main() {
+    stdio_init_all();
+    printf("WS2812 bit plane transform check\n");
+
+    uint errors = 0;
+    for (uint frac_bits = 0; frac_bits <= MAX_PLANES - 8; ++frac_bits) {
+        for (uint num_strings = 0; num_strings <= MAX_STRINGS; ++num_strings) {
+            // Whole frames, and lengths which end part way through a batch
+            errors += check(frac_bits, num_strings, MAX_VALUES);
+            errors += check(frac_bits, num_strings, 1 + next_rand() % (MAX_VALUES - 1));
+        }
+    }
+    printf("Equivalence: %s\n", errors ? "FAILED" : "ok");
+
+    // 64 pixels of RGBW per string, as in ws2812_parallel.c
+    static const uint bench_frac_bits[] = {0, 4, 8};
+    static const uint bench_strings[] = {2, 8, 16, 32};
+    for (uint i = 0; i < count_of(bench_frac_bits); ++i)
+        for (uint j = 0; j < count_of(bench_strings); ++j)
+            bench(bench_frac_bits[i], bench_strings[j]);
+
+    printf(errors ? "FAILED\n" : "All good\n");
+    return errors ? 1 : 0;
+}
@@ -9,6 +9,7 @@
 #include "pico/stdlib.h"
 #include "pico/binary_info.h"
 #include "hardware/spi.h"
+#include "bme280_comp.h"
 
 /* Example code to talk to a bme280 humidity/temperature/pressure sensor.
 
@@ -39,71 +40,12 @@
 
 #define READ_BIT 0x80
 
-int32_t t_fine;
-
-uint16_t dig_T1;
-int16_t dig_T2, dig_T3;
-uint16_t dig_P1;
-int16_t dig_P2, dig_P3, dig_P4, dig_P5, dig_P6, dig_P7, dig_P8, dig_P9;
-uint8_t dig_H1, dig_H3;
-int8_t dig_H6;
-int16_t dig_H2, dig_H4, dig_H5;
-
-/* The following compensation functions are required to convert from the raw ADC
-data from the chip to something usable. Each chip has a different set of
-compensation parameters stored on the chip at point of manufacture, which are
-read from the chip at startup and used in these routines.
+/* The raw ADC data from the chip needs compensating to get something usable.
+Each chip has a different set of compensation parameters stored on the chip at
+point of manufacture, which are read from the chip at startup and used by the
+compensation code in i2c/bme280_comp, shared with the bmp280_i2c example.
 */
-int32_t compensate_temp(int32_t adc_T) {
-    int32_t var1, var2, T;
-    var1 = ((((adc_T >> 3) - ((int32_t) dig_T1 << 1))) * ((int32_t) dig_T2)) >> 11;
-    var2 = (((((adc_T >> 4) - ((int32_t) dig_T1)) * ((adc_T >> 4) - ((int32_t) dig_T1))) >> 12) * ((int32_t) dig_T3))
-            >> 14;
-
-    t_fine = var1 + var2;
-    T = (t_fine * 5 + 128) >> 8;
-    return T;
-}
-
-uint32_t compensate_pressure(int32_t adc_P) {
-    int32_t var1, var2;
-    uint32_t p;
-    var1 = (((int32_t) t_fine) >> 1) - (int32_t) 64000;
-    var2 = (((var1 >> 2) * (var1 >> 2)) >> 11) * ((int32_t) dig_P6);
-    var2 = var2 + ((var1 * ((int32_t) dig_P5)) << 1);
-    var2 = (var2 >> 2) + (((int32_t) dig_P4) << 16);
-    var1 = (((dig_P3 * (((var1 >> 2) * (var1 >> 2)) >> 13)) >> 3) + ((((int32_t) dig_P2) * var1) >> 1)) >> 18;
-    var1 = ((((32768 + var1)) * ((int32_t) dig_P1)) >> 15);
-    if (var1 == 0)
-        return 0;
-
-    p = (((uint32_t) (((int32_t) 1048576) - adc_P) - (var2 >> 12))) * 3125;
-    if (p < 0x80000000)
-        p = (p << 1) / ((uint32_t) var1);
-    else
-        p = (p / (uint32_t) var1) * 2;
-
-    var1 = (((int32_t) dig_P9) * ((int32_t) (((p >> 3) * (p >> 3)) >> 13))) >> 12;
-    var2 = (((int32_t) (p >> 2)) * ((int32_t) dig_P8)) >> 13;
-    p = (uint32_t) ((int32_t) p + ((var1 + var2 + dig_P7) >> 4));
-
-    return p;
-}
-
-uint32_t compensate_humidity(int32_t adc_H) {
-    int32_t v_x1_u32r;
-    v_x1_u32r = (t_fine - ((int32_t) 76800));
-    v_x1_u32r = (((((adc_H << 14) - (((int32_t) dig_H4) << 20) - (((int32_t) dig_H5) * v_x1_u32r)) +
-                   ((int32_t) 16384)) >> 15) * (((((((v_x1_u32r * ((int32_t) dig_H6)) >> 10) * (((v_x1_u32r *
-                                                                                                  ((int32_t) dig_H3))
-            >> 11) + ((int32_t) 32768))) >> 10) + ((int32_t) 2097152)) *
-                                                 ((int32_t) dig_H2) + 8192) >> 14));
-    v_x1_u32r = (v_x1_u32r - (((((v_x1_u32r >> 15) * (v_x1_u32r >> 15)) >> 7) * ((int32_t) dig_H1)) >> 4));
-    v_x1_u32r = (v_x1_u32r < 0 ? 0 : v_x1_u32r);
-    v_x1_u32r = (v_x1_u32r > 419430400 ? 419430400 : v_x1_u32r);
-
-    return (uint32_t) (v_x1_u32r >> 12);
-}
+static bme280_comp_t comp;
 
 #ifdef PICO_DEFAULT_SPI_CSN_PIN
 static inline void cs_select() {
@@ -146,41 +88,23 @@ static void read_registers(uint8_t reg, uint8_t *buf, uint16_t len) {
 /* This function reads the manufacturing assigned compensation parameters from the device */
 void read_compensation_parameters() {
     uint8_t buffer[26];
+    uint8_t humidity[BME280_CALIB_H_LEN];
 
-    read_registers(0x88, buffer, 24);
-
-    dig_T1 = buffer[0] | (buffer[1] << 8);
-    dig_T2 = buffer[2] | (buffer[3] << 8);
-    dig_T3 = buffer[4] | (buffer[5] << 8);
-
-    dig_P1 = buffer[6] | (buffer[7] << 8);
-    dig_P2 = buffer[8] | (buffer[9] << 8);
-    dig_P3 = buffer[10] | (buffer[11] << 8);
-    dig_P4 = buffer[12] | (buffer[13] << 8);
-    dig_P5 = buffer[14] | (buffer[15] << 8);
-    dig_P6 = buffer[16] | (buffer[17] << 8);
-    dig_P7 = buffer[18] | (buffer[19] << 8);
-    dig_P8 = buffer[20] | (buffer[21] << 8);
-    dig_P9 = buffer[22] | (buffer[23] << 8);
-
-    dig_H1 = buffer[25];
+    // 0x88 to 0x9f for temperature and pressure, then dig_H1 at 0xa1
+    read_registers(0x88, buffer, 26);
+    humidity[0] = buffer[25];
 
-    read_registers(0xE1, buffer, 8);
+    // The rest of the humidity parameters are at 0xe1 to 0xe7
+    read_registers(0xE1, humidity + 1, 7);
 
-    dig_H2 = buffer[0] | (buffer[1] << 8);
-    dig_H3 = (int8_t) buffer[2];
-    dig_H4 = buffer[3] << 4 | (buffer[4] & 0xf);
-    dig_H5 = (buffer[5] >> 4) | (buffer[6] << 4);
-    dig_H6 = (int8_t) buffer[7];
+    bme280_comp_init(&comp, buffer, humidity);
 }
 
-static void bme280_read_raw(int32_t *humidity, int32_t *pressure, int32_t *temperature) {
+static void bme280_read_raw(bme280_raw_t *raw) {
     uint8_t buffer[8];
 
     read_registers(0xF7, buffer, 8);
-    *pressure = ((uint32_t) buffer[0] << 12) | ((uint32_t) buffer[1] << 4) | (buffer[2] >> 4);
-    *temperature = ((uint32_t) buffer[3] << 12) | ((uint32_t) buffer[4] << 4) | (buffer[5] >> 4);
-    *humidity = (uint32_t) buffer[6] << 8 | buffer[7];
+    bme280_unpack_raw(buffer, true, raw);
 }
 #endif
 
@@ -218,20 +142,19 @@ int main() {
     write_register(0xF2, 0x1); // Humidity oversampling register - going for x1
     write_register(0xF4, 0x27);// Set rest of oversampling modes and run mode to normal
 
-    int32_t humidity, pressure, temperature;
+    bme280_raw_t raw;
+    bme280_sample_t sample;
 
     while (1) {
-        bme280_read_raw(&humidity, &pressure, &temperature);
+        bme280_read_raw(&raw);
 
         // These are the raw numbers from the chip, so we need to run through the
         // compensations to get human understandable numbers
-        pressure = compensate_pressure(pressure);
-        temperature = compensate_temp(temperature);
-        humidity = compensate_humidity(humidity);
+        bme280_comp_convert32(&comp, &raw, &sample, 1);
 
-        printf("Humidity = %.2f%%\n", humidity / 1024.0);
-        printf("Pressure = %dPa\n", pressure);
-        printf("Temp. = %.2fC\n", temperature / 100.0);
+        printf("Humidity = %.2f%%\n", sample.humidity / 1024.0);
+        printf("Pressure = %dPa\n", sample.pressure);
+        printf("Temp. = %.2fC\n", sample.temperature / 100.0);
 
         sleep_ms(1000);
     }
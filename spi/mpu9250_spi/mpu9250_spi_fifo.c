@@ -0,0 +1,273 @@
+/**
+ * Copyright (c) 2022 Raspberry Pi (Trading) Ltd.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+#include <stdio.h>
+#include "pico/stdlib.h"
+#include "pico/binary_info.h"
+#include "pico/multicore.h"
+#include "pico/util/queue.h"
+#include "hardware/spi.h"
+#include "hardware/dma.h"
+#include "imu_fusion_consumer.h"
+
+/* Example code to read a MPU9250 MEMS accelerometer and gyroscope at its full
+   1 kHz sample rate, and work out which way up it is.
+
+   Rather than reading the data registers one sample at a time, as mpu9250_spi
+   does, the MPU9250 is set to push every sample into its 512 byte FIFO, and
+   core 0 empties that every 20 ms, about 20 samples at a time, in a single
+   DMA transfer at the 20 MHz the MPU9250 can be read at, which core 0 needn't
+   wait for: the DMA interrupt ends it and hands it on. Core 1 unpacks the
+   samples, stamps them with the time they were taken, and runs them through
+   a fixed-point Madgwick filter (see i2c/imu_fusion) to give an orientation,
+   which it prints ten times a second.
+
+   Keep the sensor still for the first second, while the gyro's offset is
+   measured.
+
+   Connections are the same as for mpu9250_spi:
+
+   GPIO 4 (pin 6) MISO/spi0_rx-> ADO on MPU9250 board
+   GPIO 5 (pin 7) Chip select -> NCS on MPU9250 board
+   GPIO 6 (pin 9) SCK/spi0_sclk -> SCL on MPU9250 board
+   GPIO 7 (pin 10) MOSI/spi0_tx -> SDA on MPU9250 board
+   3.3v (pin 36) -> VCC on MPU9250 board
+   GND (pin 38)  -> GND on MPU9250 board
+*/
+
+#define PIN_MISO 4
+#define PIN_CS   5
+#define PIN_SCK  6
+#define PIN_MOSI 7
+
+#define SPI_PORT spi0
+#define READ_BIT 0x80
+
+// The MPU9250 takes register writes at up to 1 MHz, but can be read at 20 MHz
+#define SPI_WRITE_HZ (1000 * 1000)
+#define SPI_READ_HZ (20 * 1000 * 1000)
+
+#define REG_SMPLRT_DIV    0x19
+#define REG_CONFIG        0x1a
+#define REG_GYRO_CONFIG   0x1b
+#define REG_ACCEL_CONFIG  0x1c
+#define REG_ACCEL_CONFIG2 0x1d
+#define REG_FIFO_EN       0x23
+#define REG_USER_CTRL     0x6a
+#define REG_PWR_MGMT_1    0x6b
+#define REG_FIFO_COUNTH   0x72
+#define REG_FIFO_R_W      0x74
+#define REG_WHO_AM_I      0x75
+
+#define USER_CTRL_FIFO_EN     0x40
+#define USER_CTRL_FIFO_RST    0x04
+#define USER_CTRL_I2C_IF_DIS  0x10
+
+#define FIFO_SIZE 512
+#define SAMPLE_HZ 1000
+#define GYRO_RANGE_DPS 2000
+#define DRAIN_INTERVAL_MS 20
+#define CALIBRATION_SAMPLES SAMPLE_HZ
+
+// Bursts read by core 0, waiting for core 1
+#define NUM_BUFFERS 4
+static uint8_t buffers[NUM_BUFFERS][FIFO_SIZE];
+
+static queue_t full_queue;
+static queue_t free_queue;
+
+// Counted by core 0 and printed by core 1
+static volatile uint32_t fifo_resets;
+static volatile uint32_t bursts;
+
+static uint dma_tx;
+static uint dma_rx;
+
+static inline void cs_select() {
+    asm volatile("nop \n nop \n nop");
+    gpio_put(PIN_CS, 0);  // Active low
+    asm volatile("nop \n nop \n nop");
+}
+
+static inline void cs_deselect() {
+    asm volatile("nop \n nop \n nop");
+    gpio_put(PIN_CS, 1);
+    asm volatile("nop \n nop \n nop");
+}
+
+static void write_register(uint8_t reg, uint8_t data) {
+    uint8_t buf[] = {reg, data};
+    spi_set_baudrate(SPI_PORT, SPI_WRITE_HZ);
+    cs_select();
+    spi_write_blocking(SPI_PORT, buf, 2);
+    cs_deselect();
+    spi_set_baudrate(SPI_PORT, SPI_READ_HZ);
+}
+
+static void read_registers(uint8_t reg, uint8_t *buf, uint16_t len) {
+    reg |= READ_BIT;
+    cs_select();
+    spi_write_blocking(SPI_PORT, &reg, 1);
+    spi_read_blocking(SPI_PORT, 0, buf, len);
+    cs_deselect();
+}
+
+static void fifo_reset() {
+    write_register(REG_USER_CTRL, USER_CTRL_I2C_IF_DIS | USER_CTRL_FIFO_RST);
+    write_register(REG_USER_CTRL, USER_CTRL_I2C_IF_DIS | USER_CTRL_FIFO_EN);
+}
+
+static void mpu9250_init_fifo() {
+    // Reset everything, and wait for it to come back
+    write_register(REG_PWR_MGMT_1, 0x80);
+    sleep_ms(100);
+    // Clock from the gyro's PLL, and no I2C, so that noise on the SPI lines
+    // can't be mistaken for it
+    write_register(REG_PWR_MGMT_1, 0x01);
+    write_register(REG_USER_CTRL, USER_CTRL_I2C_IF_DIS);
+    // 1 kHz samples, with both low pass filters at 184 Hz
+    write_register(REG_CONFIG, 0x01);
+    write_register(REG_SMPLRT_DIV, 0);
+    write_register(REG_ACCEL_CONFIG2, 0x01);
+    // +/-2000 degrees/s and +/-4 g
+    write_register(REG_GYRO_CONFIG, 0x18);
+    write_register(REG_ACCEL_CONFIG, 0x08);
+    // Everything but the magnetometer into the FIFO, in 14 byte frames
+    write_register(REG_FIFO_EN, IMU_FIFO_EN_ACCEL_TEMP_GYRO);
+    fifo_reset();
+}
+
+static void dma_init() {
+    // The bytes clocked out while the FIFO is read don't matter
+    static const uint8_t zero = 0;
+    dma_tx = dma_claim_unused_channel(true);
+    dma_rx = dma_claim_unused_channel(true);
+
+    dma_channel_config c = dma_channel_get_default_config(dma_tx);
+    channel_config_set_transfer_data_size(&c, DMA_SIZE_8);
+    channel_config_set_dreq(&c, spi_get_dreq(SPI_PORT, true));
+    channel_config_set_read_increment(&c, false);
+    dma_channel_configure(dma_tx, &c, &spi_get_hw(SPI_PORT)->dr, &zero, 0, false);
+
+    c = dma_channel_get_default_config(dma_rx);
+    channel_config_set_transfer_data_size(&c, DMA_SIZE_8);
+    channel_config_set_dreq(&c, spi_get_dreq(SPI_PORT, false));
+    channel_config_set_read_increment(&c, false);
+    channel_config_set_write_increment(&c, true);
+    dma_channel_configure(dma_rx, &c, NULL, &spi_get_hw(SPI_PORT)->dr, 0, false);
+}
+
+// The FIFO, as seen by imu_fusion_run_drain()
+
+static uint fifo_count(void *ctx) {
+    uint8_t buf[2];
+    read_registers(REG_FIFO_COUNTH, buf, 2);
+    return (buf[0] & 0x1f) << 8 | buf[1];
+}
+
+static void fifo_reset_cb(void *ctx) {
+    fifo_reset();
+}
+
+// Read len bytes from the FIFO, in one transfer
+static void fifo_start_read(void *ctx, uint8_t *dst, uint len) {
+    uint8_t reg = REG_FIFO_R_W | READ_BIT;
+    cs_select();
+    // This waits for the register byte to go, and empties the RX FIFO after it
+    spi_write_blocking(SPI_PORT, &reg, 1);
+    dma_channel_set_write_addr(dma_rx, dst, false);
+    dma_channel_set_trans_count(dma_rx, len, false);
+    dma_channel_set_trans_count(dma_tx, len, false);
+    dma_start_channel_mask((1u << dma_tx) | (1u << dma_rx));
+}
+
+static void fifo_end_read(void *ctx) {
+    cs_deselect();
+}
+
+static void fifo_cancel_read(void *ctx) {
+    dma_channel_abort(dma_tx);
+    dma_channel_abort(dma_rx);
+    while (spi_is_busy(SPI_PORT))
+        tight_loop_contents();
+    while (spi_is_readable(SPI_PORT))
+        (void) spi_get_hw(SPI_PORT)->dr;
+    cs_deselect();
+}
+
+// Core 1 turns bursts into samples, and samples into an orientation
+static void core1_entry() {
+    static imu_sample_t samples[FIFO_SIZE / IMU_FIFO_FRAME_LEN];
+    const imu_consumer_t consumer = {
+        .full_queue = &full_queue,
+        .free_queue = &free_queue,
+        .buffers = &buffers[0][0],
+        .buffer_size = FIFO_SIZE,
+        .samples = samples,
+        .sample_hz = SAMPLE_HZ,
+        .gyro_range_dps = GYRO_RANGE_DPS,
+        .calibration_samples = CALIBRATION_SAMPLES,
+        .bursts = &bursts,
+        .fifo_resets = &fifo_resets,
+    };
+    imu_fusion_run_consumer(&consumer);
+}
+
+int main() {
+    stdio_init_all();
+
+    printf("Hello, MPU9250! Reading the FIFO via SPI DMA...\n");
+
+    // Slowly to start with, until the registers are all written
+    spi_init(SPI_PORT, SPI_WRITE_HZ);
+    gpio_set_function(PIN_MISO, GPIO_FUNC_SPI);
+    gpio_set_function(PIN_SCK, GPIO_FUNC_SPI);
+    gpio_set_function(PIN_MOSI, GPIO_FUNC_SPI);
+    // Make the SPI pins available to picotool
+    bi_decl(bi_3pins_with_func(PIN_MISO, PIN_MOSI, PIN_SCK, GPIO_FUNC_SPI));
+
+    // Chip select is active-low, so we'll initialise it to a driven-high state
+    gpio_init(PIN_CS);
+    gpio_set_dir(PIN_CS, GPIO_OUT);
+    gpio_put(PIN_CS, 1);
+    // Make the CS pin available to picotool
+    bi_decl(bi_1pin_with_name(PIN_CS, "SPI CS"));
+
+    uint8_t id;
+    read_registers(REG_WHO_AM_I, &id, 1);
+    printf("WHO_AM_I is 0x%x\n", id);
+
+    dma_init();
+    queue_init(&full_queue, sizeof(imu_burst_t), NUM_BUFFERS);
+    queue_init(&free_queue, sizeof(uint8_t), NUM_BUFFERS);
+    for (uint8_t i = 0; i < NUM_BUFFERS; ++i)
+        queue_add_blocking(&free_queue, &i);
+    multicore_launch_core1(core1_entry);
+
+    mpu9250_init_fifo();
+
+    const imu_fifo_bus_t bus = {
+        .count = fifo_count,
+        .reset = fifo_reset_cb,
+        .start_read = fifo_start_read,
+        .end_read = fifo_end_read,
+        .cancel_read = fifo_cancel_read,
+        .dma_rx = dma_rx,
+    };
+    const imu_drain_t drain = {
+        .bus = &bus,
+        .full_queue = &full_queue,
+        .free_queue = &free_queue,
+        .buffers = &buffers[0][0],
+        .buffer_size = FIFO_SIZE,
+        .interval_ms = DRAIN_INTERVAL_MS,
+        .bursts = &bursts,
+        .fifo_resets = &fifo_resets,
+    };
+    imu_fusion_run_drain(&drain);
+
+    return 0;
+}
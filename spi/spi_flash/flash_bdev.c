@@ -0,0 +1,302 @@
+/**
+ * Copyright (c) 2022 Raspberry Pi (Trading) Ltd.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+#include <string.h>
+#include "flash_bdev.h"
+
+#define NO_SECTOR UINT32_MAX
+
+void flash_bdev_init(flash_bdev_t *bd, const flash_bdev_driver_t *driver, uint32_t size) {
+    memset(bd, 0, sizeof(*bd));
+    bd->driver = *driver;
+    bd->size = size;
+    bd->op = FLASH_BDEV_OP_NONE;
+    bd->last_sector = NO_SECTOR;
+    for (uint i = 0; i < FLASH_BDEV_CACHE_SECTORS; ++i)
+        bd->cache[i].sector = NO_SECTOR;
+}
+
+static bool queue_request(flash_bdev_t *bd, const flash_bdev_request_t *req) {
+    if (bd->queue_head - bd->queue_tail == FLASH_BDEV_QUEUE_LEN)
+        return false;
+    bd->queue[bd->queue_head % FLASH_BDEV_QUEUE_LEN] = *req;
+    ++bd->queue_head;
+    ++bd->stats.requests;
+    return true;
+}
+
+static bool in_range(const flash_bdev_t *bd, uint32_t addr, uint32_t len) {
+    return addr <= bd->size && len <= bd->size - addr;
+}
+
+bool flash_bdev_read(flash_bdev_t *bd, uint32_t addr, uint8_t *dst, uint32_t len,
+                     flash_bdev_callback_t callback, void *ctx) {
+    if (!in_range(bd, addr, len))
+        return false;
+    flash_bdev_request_t req = {.type = FLASH_BDEV_READ, .addr = addr, .len = len, .dst = dst,
+                                .callback = callback, .ctx = ctx};
+    return queue_request(bd, &req);
+}
+
+bool flash_bdev_write(flash_bdev_t *bd, uint32_t addr, const uint8_t *src, uint32_t len,
+                      flash_bdev_callback_t callback, void *ctx) {
+    if (!in_range(bd, addr, len))
+        return false;
+    flash_bdev_request_t req = {.type = FLASH_BDEV_WRITE, .addr = addr, .len = len, .src = src,
+                                .callback = callback, .ctx = ctx};
+    return queue_request(bd, &req);
+}
+
+bool flash_bdev_erase(flash_bdev_t *bd, uint32_t addr, flash_bdev_callback_t callback, void *ctx) {
+    if (addr % FLASH_BDEV_SECTOR_SIZE || !in_range(bd, addr, FLASH_BDEV_SECTOR_SIZE))
+        return false;
+    flash_bdev_request_t req = {.type = FLASH_BDEV_ERASE, .addr = addr, .len = FLASH_BDEV_SECTOR_SIZE,
+                                .callback = callback, .ctx = ctx};
+    return queue_request(bd, &req);
+}
+
+bool flash_bdev_flush(flash_bdev_t *bd, flash_bdev_callback_t callback, void *ctx) {
+    flash_bdev_request_t req = {.type = FLASH_BDEV_FLUSH, .callback = callback, .ctx = ctx};
+    return queue_request(bd, &req);
+}
+
+static flash_bdev_cache_entry_t *lookup(flash_bdev_t *bd, uint32_t sector) {
+    for (uint i = 0; i < FLASH_BDEV_CACHE_SECTORS; ++i) {
+        if (bd->cache[i].valid && bd->cache[i].sector == sector)
+            return &bd->cache[i];
+    }
+    return NULL;
+}
+
+static void touch(flash_bdev_t *bd, flash_bdev_cache_entry_t *e) {
+    e->last_used = ++bd->clock;
+}
+
+// An empty entry, or else the least recently used one
+static flash_bdev_cache_entry_t *victim(flash_bdev_t *bd) {
+    flash_bdev_cache_entry_t *v = &bd->cache[0];
+    for (uint i = 0; i < FLASH_BDEV_CACHE_SECTORS; ++i) {
+        flash_bdev_cache_entry_t *e = &bd->cache[i];
+        if (!e->valid)
+            return e;
+        if (e->last_used - v->last_used > UINT32_MAX / 2)
+            v = e;
+    }
+    return v;
+}
+
+// Writes in the page buffer aren't on the flash yet, so a sector read from it
+// needs them applying as well
+static void apply_pending(flash_bdev_t *bd, flash_bdev_cache_entry_t *e) {
+    if (!bd->page_pending || bd->page_addr / FLASH_BDEV_SECTOR_SIZE != e->sector)
+        return;
+    uint8_t *p = e->data + bd->page_addr % FLASH_BDEV_SECTOR_SIZE;
+    for (uint i = bd->page_lo; i <= bd->page_hi; ++i)
+        p[i] &= bd->page_buf[i];
+}
+
+static void start_fill(flash_bdev_t *bd, uint32_t sector, bool speculative) {
+    flash_bdev_cache_entry_t *e = victim(bd);
+    e->valid = false;
+    e->sector = sector;
+    e->speculative = speculative;
+    bd->filling = e;
+    bd->op = FLASH_BDEV_OP_FILL;
+    bd->stats.bytes_read += FLASH_BDEV_SECTOR_SIZE;
+    bd->driver.start_read(bd->driver.ctx, sector * FLASH_BDEV_SECTOR_SIZE, e->data, FLASH_BDEV_SECTOR_SIZE);
+}
+
+static void start_program(flash_bdev_t *bd) {
+    uint len = bd->page_hi - bd->page_lo + 1;
+    memcpy(bd->program_buf, bd->page_buf + bd->page_lo, len);
+    bd->page_pending = false;
+    bd->op = FLASH_BDEV_OP_PROGRAM;
+    ++bd->stats.programs;
+    bd->stats.bytes_programmed += len;
+    bd->driver.start_program(bd->driver.ctx, bd->page_addr + bd->page_lo, bd->program_buf, len);
+}
+
+// Note which sector a read is in, and read ahead if it follows on from the
+// last one
+static void note_sector(flash_bdev_t *bd, uint32_t sector) {
+    if (sector == bd->last_sector)
+        return;
+    if (sector == bd->last_sector + 1) {
+        bd->readahead_sector = sector + 1;
+        bd->readahead_count = FLASH_BDEV_READAHEAD;
+    } else {
+        bd->readahead_count = 0;
+    }
+    bd->last_sector = sector;
+}
+
+// Each of these carries a request on as far as it can; they return true once
+// it is done, or false if it is waiting on the driver. Reads which hit the
+// cache, and writes to the page buffer, needn't wait for the driver to finish
+// what it is doing.
+
+static bool step_read(flash_bdev_t *bd, flash_bdev_request_t *req) {
+    while (req->pos < req->len) {
+        uint32_t addr = req->addr + req->pos;
+        uint32_t sector = addr / FLASH_BDEV_SECTOR_SIZE;
+        flash_bdev_cache_entry_t *e = lookup(bd, sector);
+        if (!e) {
+            if (bd->op != FLASH_BDEV_OP_NONE)
+                return false;
+            ++bd->stats.sector_misses;
+            note_sector(bd, sector);
+            start_fill(bd, sector, false);
+            bd->missed = bd->filling;
+            return false;
+        }
+        if (e->speculative) {
+            ++bd->stats.readahead_hits;
+            e->speculative = false;
+        }
+        // A sector filled for this read has been counted as a miss already
+        if (e == bd->missed)
+            bd->missed = NULL;
+        else
+            ++bd->stats.sector_hits;
+        note_sector(bd, sector);
+        uint offset = addr % FLASH_BDEV_SECTOR_SIZE;
+        uint n = MIN(req->len - req->pos, FLASH_BDEV_SECTOR_SIZE - offset);
+        memcpy(req->dst + req->pos, e->data + offset, n);
+        touch(bd, e);
+        req->pos += n;
+    }
+    return true;
+}
+
+static bool step_write(flash_bdev_t *bd, flash_bdev_request_t *req) {
+    while (req->pos < req->len) {
+        uint32_t addr = req->addr + req->pos;
+        uint32_t page_addr = addr - addr % FLASH_BDEV_PAGE_SIZE;
+        if (bd->page_pending && bd->page_addr != page_addr) {
+            if (bd->op != FLASH_BDEV_OP_NONE)
+                return false;
+            start_program(bd);
+        }
+        if (!bd->page_pending) {
+            memset(bd->page_buf, 0xff, sizeof(bd->page_buf));
+            bd->page_pending = true;
+            bd->page_addr = page_addr;
+            bd->page_lo = FLASH_BDEV_PAGE_SIZE - 1;
+            bd->page_hi = 0;
+        }
+        uint offset = addr - page_addr;
+        uint n = MIN(req->len - req->pos, FLASH_BDEV_PAGE_SIZE - offset);
+        const uint8_t *src = req->src + req->pos;
+        for (uint i = 0; i < n; ++i)
+            bd->page_buf[offset + i] &= src[i];
+        bd->page_lo = MIN(bd->page_lo, offset);
+        bd->page_hi = MAX(bd->page_hi, offset + n - 1);
+        flash_bdev_cache_entry_t *e = lookup(bd, addr / FLASH_BDEV_SECTOR_SIZE);
+        if (e) {
+            uint8_t *p = e->data + addr % FLASH_BDEV_SECTOR_SIZE;
+            for (uint i = 0; i < n; ++i)
+                p[i] &= src[i];
+        }
+        req->pos += n;
+    }
+    // A page which has been written all the way through is unlikely to be
+    // written again, so it needn't wait for the next page
+    if (bd->page_pending && bd->page_lo == 0 && bd->page_hi == FLASH_BDEV_PAGE_SIZE - 1 && bd->op == FLASH_BDEV_OP_NONE)
+        start_program(bd);
+    return true;
+}
+
+static bool step_erase(flash_bdev_t *bd, flash_bdev_request_t *req) {
+    if (req->pos)
+        return bd->op == FLASH_BDEV_OP_NONE;
+    if (bd->op != FLASH_BDEV_OP_NONE)
+        return false;
+    uint32_t sector = req->addr / FLASH_BDEV_SECTOR_SIZE;
+    if (bd->page_pending && bd->page_addr / FLASH_BDEV_SECTOR_SIZE == sector)
+        bd->page_pending = false;
+    // Nothing need be read to know what an erased sector holds
+    flash_bdev_cache_entry_t *e = lookup(bd, sector);
+    if (!e) {
+        e = victim(bd);
+        e->sector = sector;
+        e->valid = true;
+        e->speculative = false;
+    }
+    memset(e->data, 0xff, FLASH_BDEV_SECTOR_SIZE);
+    touch(bd, e);
+    bd->op = FLASH_BDEV_OP_ERASE;
+    ++bd->stats.erases;
+    bd->driver.start_erase(bd->driver.ctx, req->addr);
+    req->pos = 1;
+    return false;
+}
+
+static bool step_flush(flash_bdev_t *bd) {
+    if (bd->op != FLASH_BDEV_OP_NONE)
+        return false;
+    if (!bd->page_pending)
+        return true;
+    start_program(bd);
+    return false;
+}
+
+static bool step(flash_bdev_t *bd, flash_bdev_request_t *req) {
+    switch (req->type) {
+        case FLASH_BDEV_READ:
+            return step_read(bd, req);
+        case FLASH_BDEV_WRITE:
+            return step_write(bd, req);
+        case FLASH_BDEV_ERASE:
+            return step_erase(bd, req);
+        default:
+            return step_flush(bd);
+    }
+}
+
+static void read_ahead(flash_bdev_t *bd) {
+    while (bd->readahead_count && bd->op == FLASH_BDEV_OP_NONE) {
+        uint32_t sector = bd->readahead_sector++;
+        --bd->readahead_count;
+        if (sector >= bd->size / FLASH_BDEV_SECTOR_SIZE) {
+            bd->readahead_count = 0;
+        } else if (!lookup(bd, sector)) {
+            ++bd->stats.readaheads;
+            start_fill(bd, sector, true);
+        }
+    }
+}
+
+void flash_bdev_task(flash_bdev_t *bd) {
+    if (bd->op != FLASH_BDEV_OP_NONE && !bd->driver.busy(bd->driver.ctx)) {
+        if (bd->op == FLASH_BDEV_OP_FILL) {
+            bd->filling->valid = true;
+            apply_pending(bd, bd->filling);
+            touch(bd, bd->filling);
+        }
+        bd->op = FLASH_BDEV_OP_NONE;
+    }
+    while (bd->queue_tail != bd->queue_head) {
+        flash_bdev_request_t *req = &bd->queue[bd->queue_tail % FLASH_BDEV_QUEUE_LEN];
+        if (!step(bd, req))
+            return;
+        flash_bdev_callback_t callback = req->callback;
+        void *ctx = req->ctx;
+        ++bd->queue_tail;
+        if (callback)
+            callback(ctx);
+    }
+    read_ahead(bd);
+}
+
+bool flash_bdev_idle(const flash_bdev_t *bd) {
+    return bd->queue_tail == bd->queue_head &&
+           (bd->op == FLASH_BDEV_OP_NONE || (bd->op == FLASH_BDEV_OP_FILL && bd->filling->speculative));
+}
+
+void flash_bdev_wait(flash_bdev_t *bd) {
+    while (!flash_bdev_idle(bd))
+        flash_bdev_task(bd);
+}
@@ -0,0 +1,173 @@
+/**
+ * Copyright (c) 2022 Raspberry Pi (Trading) Ltd.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+#ifndef _FLASH_BDEV_H
+#define _FLASH_BDEV_H
+
+#include "pico.h"
+
+// ----------------------------------------------------------------------------
+// Block device for an external serial flash, with a sector cache.
+//
+// Reads, writes and erases are queued as requests, and carried out in order
+// by flash_bdev_task(), which should be called often (from the main loop, say).
+// It never waits for the flash: it starts an operation through the driver,
+// and comes back to it on a later call once the driver says it has finished,
+// so with a DMA driver the CPU is free while the data moves.
+//
+// Reads go through a cache of whole sectors, least recently used going first.
+// When reads move on to the next sector, the ones after it are read ahead
+// while there are no requests waiting.
+//
+// Writes have the same meaning as programming the flash, which can only clear
+// bits, so the sectors must be erased first. They are gathered into a page
+// buffer, which is only programmed when a write goes to another page, or on
+// flash_bdev_flush(), so a run of small writes costs one program per page.
+// The cache is kept up to date, so reads see the writes straight away, but
+// they are not on the flash until they have been flushed.
+//
+// The driver knows nothing of the cache or queue, so the same code runs
+// against the real flash (spi_flash_bdev.c) or a simulated one on the host
+// (flash_bdev_test.c).
+
+#define FLASH_BDEV_PAGE_SIZE 256
+#define FLASH_BDEV_SECTOR_SIZE 4096
+
+#ifndef FLASH_BDEV_CACHE_SECTORS
+#define FLASH_BDEV_CACHE_SECTORS 8
+#endif
+
+// Sectors to read ahead once reads are found to be sequential
+#ifndef FLASH_BDEV_READAHEAD
+#define FLASH_BDEV_READAHEAD 2
+#endif
+
+// Requests which can be waiting; must be a power of 2
+#ifndef FLASH_BDEV_QUEUE_LEN
+#define FLASH_BDEV_QUEUE_LEN 16
+#endif
+
+typedef struct {
+    // Start reading len bytes at addr into dst
+    void (*start_read)(void *ctx, uint32_t addr, uint8_t *dst, uint len);
+    // Start programming len bytes at addr, which lie within one page. src
+    // stays valid until the operation has finished.
+    void (*start_program)(void *ctx, uint32_t addr, const uint8_t *src, uint len);
+    // Start erasing the sector at addr
+    void (*start_erase)(void *ctx, uint32_t addr);
+    // True until the last operation started has finished, and the flash is
+    // ready for another
+    bool (*busy)(void *ctx);
+    void *ctx;
+} flash_bdev_driver_t;
+
+// Called once a request has been carried out. A write has then been taken
+// into the page buffer, so its data is no longer needed.
+typedef void (*flash_bdev_callback_t)(void *ctx);
+
+typedef enum {
+    FLASH_BDEV_READ,
+    FLASH_BDEV_WRITE,
+    FLASH_BDEV_ERASE,
+    FLASH_BDEV_FLUSH,
+} flash_bdev_request_type_t;
+
+typedef struct {
+    flash_bdev_request_type_t type;
+    uint32_t addr;
+    uint32_t len;
+    union {
+        uint8_t *dst;
+        const uint8_t *src;
+    };
+    flash_bdev_callback_t callback;
+    void *ctx;
+    // How far the request has got
+    uint32_t pos;
+} flash_bdev_request_t;
+
+typedef struct {
+    uint32_t sector;
+    uint32_t last_used;
+    bool valid;
+    // Read ahead, and not yet asked for
+    bool speculative;
+    uint8_t data[FLASH_BDEV_SECTOR_SIZE];
+} flash_bdev_cache_entry_t;
+
+typedef struct {
+    uint32_t requests;
+    uint32_t sector_hits;     // sectors a read found in the cache
+    uint32_t sector_misses;   // sectors a read had to wait for
+    uint32_t readaheads;      // sectors read ahead
+    uint32_t readahead_hits;  // of those, sectors which were asked for later
+    uint32_t programs;
+    uint32_t erases;
+    uint32_t bytes_read;      // from the flash
+    uint32_t bytes_programmed;
+} flash_bdev_stats_t;
+
+typedef struct {
+    flash_bdev_driver_t driver;
+    uint32_t size;
+    flash_bdev_request_t queue[FLASH_BDEV_QUEUE_LEN];
+    uint32_t queue_head;
+    uint32_t queue_tail;
+    // The driver operation in progress, if any
+    enum {
+        FLASH_BDEV_OP_NONE,
+        FLASH_BDEV_OP_FILL,
+        FLASH_BDEV_OP_PROGRAM,
+        FLASH_BDEV_OP_ERASE,
+    } op;
+    flash_bdev_cache_entry_t *filling;
+    // The entry last filled because a read missed
+    flash_bdev_cache_entry_t *missed;
+    // Writes waiting to be programmed: page_buf holds the page at page_addr,
+    // with only bytes page_lo to page_hi written
+    bool page_pending;
+    uint32_t page_addr;
+    uint page_lo, page_hi;
+    uint8_t page_buf[FLASH_BDEV_PAGE_SIZE];
+    // The page being programmed, so that writes can go on into page_buf
+    uint8_t program_buf[FLASH_BDEV_PAGE_SIZE];
+    // Sequential read detection
+    uint32_t last_sector;
+    uint32_t readahead_sector;
+    uint readahead_count;
+    uint32_t clock;
+    flash_bdev_cache_entry_t cache[FLASH_BDEV_CACHE_SECTORS];
+    flash_bdev_stats_t stats;
+} flash_bdev_t;
+
+// Set up a block device for a flash of size bytes, a multiple of the sector
+// size, through the given driver
+void flash_bdev_init(flash_bdev_t *bd, const flash_bdev_driver_t *driver, uint32_t size);
+
+// Queue a request. These return false, and queue nothing, if the queue is full
+// or the range doesn't lie within the flash. callback (which may be NULL) is
+// called from flash_bdev_task() with ctx once the request has been carried
+// out; it may queue more requests.
+bool flash_bdev_read(flash_bdev_t *bd, uint32_t addr, uint8_t *dst, uint32_t len,
+                     flash_bdev_callback_t callback, void *ctx);
+bool flash_bdev_write(flash_bdev_t *bd, uint32_t addr, const uint8_t *src, uint32_t len,
+                      flash_bdev_callback_t callback, void *ctx);
+// addr must be at the start of a sector. Writes to it which haven't been
+// programmed yet are dropped.
+bool flash_bdev_erase(flash_bdev_t *bd, uint32_t addr, flash_bdev_callback_t callback, void *ctx);
+// Program any writes still in the page buffer; done once they are on the flash
+bool flash_bdev_flush(flash_bdev_t *bd, flash_bdev_callback_t callback, void *ctx);
+
+// Carry the requests forward as far as possible without waiting for the flash
+void flash_bdev_task(flash_bdev_t *bd);
+
+// True once every request has been carried out, and the flash isn't busy.
+// Reading ahead doesn't count.
+bool flash_bdev_idle(const flash_bdev_t *bd);
+
+// Call flash_bdev_task() until flash_bdev_idle()
+void flash_bdev_wait(flash_bdev_t *bd);
+
+#endif
@@ -0,0 +1,375 @@
+/**
+ * Copyright (c) 2022 Raspberry Pi (Trading) Ltd.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+#include <stdio.h>
+#include <string.h>
+#include "pico/stdlib.h"
+#include "flash_bdev.h"
+#include "test_rand.h"
+
+// Runs the block device against a simulated flash, in simulated time, to
+// check that what is read back is what was written, and to measure the cache
+// hit rate and how long typical workloads take compared with the blocking
+// calls in spi_flash.c. The simulated flash is 1 MB, four times the RAM on
+// an RP2040, so there is no device build.
+
+#define SIM_SIZE (1024 * 1024)
+
+// A W25Q-series flash on a 25 MHz bus, with its typical program and erase times
+#define SIM_NS_PER_BYTE 320
+#define SIM_PROGRAM_NS 400000
+#define SIM_ERASE_NS 45000000
+
+// How long the main loop takes to come round again when it has nothing else
+// to do
+#define SIM_POLL_NS 1000
+
+// ----------------------------------------------------------------------------
+// Simulated flash: programming can only clear bits, within one page, and an
+// operation takes as long as its command and data would on the bus, plus the
+// flash's own time. The data moves straight away, but the simulation only
+// says it has finished once the time has passed.
+
+typedef struct {
+    uint8_t mem[SIM_SIZE];
+    uint64_t now_ns;
+    uint64_t done_ns;
+    uint32_t reads, programs, erases;
+    bool misuse;
+} sim_flash_t;
+
+static sim_flash_t sim;
+
+static void sim_start(sim_flash_t *s, uint64_t ns) {
+    if (s->now_ns < s->done_ns)
+        s->misuse = true;
+    s->done_ns = s->now_ns + ns;
+}
+
+static void sim_start_read(void *ctx, uint32_t addr, uint8_t *dst, uint len) {
+    sim_flash_t *s = (sim_flash_t *) ctx;
+    sim_start(s, (4 + len) * SIM_NS_PER_BYTE);
+    memcpy(dst, s->mem + addr, len);
+    ++s->reads;
+}
+
+static void sim_start_program(void *ctx, uint32_t addr, const uint8_t *src, uint len) {
+    sim_flash_t *s = (sim_flash_t *) ctx;
+    if (addr / FLASH_BDEV_PAGE_SIZE != (addr + len - 1) / FLASH_BDEV_PAGE_SIZE)
+        s->misuse = true;
+    // The write enable, then the command and data
+    sim_start(s, (1 + 4 + len) * SIM_NS_PER_BYTE + SIM_PROGRAM_NS);
+    for (uint i = 0; i < len; ++i)
+        s->mem[addr + i] &= src[i];
+    ++s->programs;
+}
+
+static void sim_start_erase(void *ctx, uint32_t addr) {
+    sim_flash_t *s = (sim_flash_t *) ctx;
+    if (addr % FLASH_BDEV_SECTOR_SIZE)
+        s->misuse = true;
+    sim_start(s, (1 + 4) * SIM_NS_PER_BYTE + SIM_ERASE_NS);
+    memset(s->mem + addr, 0xff, FLASH_BDEV_SECTOR_SIZE);
+    ++s->erases;
+}
+
+// Each time the block device looks, the main loop has gone round once more
+static bool sim_busy(void *ctx) {
+    sim_flash_t *s = (sim_flash_t *) ctx;
+    if (s->now_ns < s->done_ns) {
+        s->now_ns = MIN(s->now_ns + SIM_POLL_NS, s->done_ns);
+        return true;
+    }
+    return false;
+}
+
+// The blocking equivalent: start an operation and wait for it
+static void sim_wait(sim_flash_t *s) {
+    s->now_ns = MAX(s->now_ns, s->done_ns);
+}
+
+static void sim_init(sim_flash_t *s) {
+    memset(s, 0, sizeof(*s));
+    memset(s->mem, 0xff, sizeof(s->mem));
+}
+
+static const flash_bdev_driver_t sim_driver = {
+        .start_read = sim_start_read,
+        .start_program = sim_start_program,
+        .start_erase = sim_start_erase,
+        .busy = sim_busy,
+        .ctx = &sim,
+};
+
+// ----------------------------------------------------------------------------
+
+static flash_bdev_t bd;
+static uint failures;
+
+static void result(const char *name, bool ok) {
+    printf("%-40s %s\n", name, ok ? "ok" : "FAILED");
+    if (!ok)
+        ++failures;
+}
+
+static void setup(void) {
+    sim_init(&sim);
+    flash_bdev_init(&bd, &sim_driver, SIM_SIZE);
+}
+
+static void print_stats(void) {
+    const flash_bdev_stats_t *s = &bd.stats;
+    uint32_t lookups = s->sector_hits + s->sector_misses;
+    printf("  %u requests, %u%% sector hits, %u read ahead (%u used), %u programs, %u erases, %u KB read\n",
+           s->requests, lookups ? s->sector_hits * 100 / lookups : 0, s->readaheads, s->readahead_hits,
+           s->programs, s->erases, s->bytes_read / 1024);
+}
+
+// ----------------------------------------------------------------------------
+// Random requests, checked against a plain copy of what the flash should
+// hold. Several are queued at a time, and what each read should see is worked
+// out as it is queued.
+
+#define CHECK_SECTORS 16
+#define CHECK_SIZE (CHECK_SECTORS * FLASH_BDEV_SECTOR_SIZE)
+#define CHECK_MAX_LEN 700
+#define CHECK_BATCH 8
+
+typedef struct {
+    uint8_t data[CHECK_MAX_LEN];
+    uint8_t expected[CHECK_MAX_LEN];
+    uint32_t len;
+    bool done;
+} check_read_t;
+
+static uint8_t model[CHECK_SIZE];
+static check_read_t check_reads[CHECK_BATCH];
+static uint8_t check_writes[CHECK_BATCH][CHECK_MAX_LEN];
+static uint check_bad_reads;
+
+static void check_read_done(void *ctx) {
+    check_read_t *r = (check_read_t *) ctx;
+    r->done = true;
+    if (memcmp(r->data, r->expected, r->len))
+        ++check_bad_reads;
+}
+
+static void test_random(void) {
+    setup();
+    memset(model, 0xff, sizeof(model));
+    check_bad_reads = 0;
+    uint queued = 0, completed_reads = 0, issued_reads = 0;
+    for (uint batch = 0; batch < 2000; ++batch) {
+        for (uint i = 0; i < CHECK_BATCH; ++i) {
+            uint kind = next_rand() % 16;
+            uint32_t len = 1 + next_rand() % CHECK_MAX_LEN;
+            uint32_t addr = next_rand() % (CHECK_SIZE - len);
+            bool ok;
+            if (kind < 7) {
+                check_read_t *r = &check_reads[i];
+                r->len = len;
+                r->done = false;
+                memcpy(r->expected, model + addr, len);
+                ok = flash_bdev_read(&bd, addr, r->data, len, check_read_done, r);
+                ++issued_reads;
+            } else if (kind < 14) {
+                // Mostly clearing a few bits, as a log would
+                for (uint j = 0; j < len; ++j) {
+                    check_writes[i][j] = (uint8_t) (next_rand() | next_rand());
+                    model[addr + j] &= check_writes[i][j];
+                }
+                ok = flash_bdev_write(&bd, addr, check_writes[i], len, NULL, NULL);
+            } else if (kind < 15) {
+                addr -= addr % FLASH_BDEV_SECTOR_SIZE;
+                memset(model + addr, 0xff, FLASH_BDEV_SECTOR_SIZE);
+                ok = flash_bdev_erase(&bd, addr, NULL, NULL);
+            } else {
+                ok = flash_bdev_flush(&bd, NULL, NULL);
+            }
+            if (ok)
+                ++queued;
+        }
+        flash_bdev_wait(&bd);
+        for (uint i = 0; i < CHECK_BATCH; ++i)
+            completed_reads += check_reads[i].done;
+        memset(check_reads, 0, sizeof(check_reads));
+    }
+    result("random: all queued", queued == 2000 * CHECK_BATCH);
+    result("random: reads completed", completed_reads == issued_reads);
+    result("random: reads see earlier writes", check_bad_reads == 0);
+    flash_bdev_flush(&bd, NULL, NULL);
+    flash_bdev_wait(&bd);
+    result("random: flash matches after flush", !memcmp(sim.mem, model, CHECK_SIZE));
+    result("random: driver used correctly", !sim.misuse);
+    print_stats();
+}
+
+static void test_limits(void) {
+    setup();
+    static uint8_t buf[16];
+    result("limits: out of range refused",
+           !flash_bdev_read(&bd, SIM_SIZE - 8, buf, 16, NULL, NULL) &&
+           !flash_bdev_write(&bd, UINT32_MAX, buf, 2, NULL, NULL) &&
+           !flash_bdev_erase(&bd, SIM_SIZE, NULL, NULL) &&
+           !flash_bdev_erase(&bd, 100, NULL, NULL));
+    uint n = 0;
+    while (flash_bdev_read(&bd, 0, buf, sizeof(buf), NULL, NULL))
+        ++n;
+    result("limits: queue fills up", n == FLASH_BDEV_QUEUE_LEN && bd.stats.requests == n);
+    flash_bdev_wait(&bd);
+    result("limits: queue drains", flash_bdev_read(&bd, 0, buf, sizeof(buf), NULL, NULL));
+}
+
+// ----------------------------------------------------------------------------
+// Workloads, timed in simulated microseconds against the blocking equivalent
+
+// A reader working through a file in chunks, taking work_ns to process each
+static uint8_t chunk[512];
+static bool chunk_ready;
+
+static void chunk_done(void *ctx) {
+    chunk_ready = true;
+}
+
+static uint64_t sequential_read(uint32_t len, uint32_t chunk_len, uint64_t work_ns) {
+    uint64_t start = sim.now_ns;
+    for (uint32_t addr = 0; addr < len; addr += chunk_len) {
+        chunk_ready = false;
+        flash_bdev_read(&bd, addr, chunk, chunk_len, chunk_done, NULL);
+        while (!chunk_ready)
+            flash_bdev_task(&bd);
+        // The flash carries on reading ahead while the chunk is processed
+        sim.now_ns += work_ns;
+        flash_bdev_task(&bd);
+    }
+    return sim.now_ns - start;
+}
+
+static uint64_t sequential_read_blocking(uint32_t len, uint32_t chunk_len, uint64_t work_ns) {
+    uint64_t start = sim.now_ns;
+    for (uint32_t addr = 0; addr < len; addr += chunk_len) {
+        sim_start_read(&sim, addr, chunk, chunk_len);
+        sim_wait(&sim);
+        sim.now_ns += work_ns;
+    }
+    return sim.now_ns - start;
+}
+
+static void test_sequential(void) {
+    const uint32_t len = 256 * 1024;
+    for (uint w = 0; w < 2; ++w) {
+        uint64_t work_ns = w ? 100000 : 0;
+        setup();
+        uint64_t blocking_ns = sequential_read_blocking(len, 512, work_ns);
+        uint64_t ns = sequential_read(len, 512, work_ns);
+        printf("  256 KB in 512 byte reads, %3u us work each: %6u us, blocking %6u us\n",
+               (uint) (work_ns / 1000), (uint) (ns / 1000), (uint) (blocking_ns / 1000));
+        print_stats();
+        const flash_bdev_stats_t *s = &bd.stats;
+        if (!w) {
+            result("sequential: 7 of 8 reads hit",
+                   s->sector_hits + s->sector_misses == len / 512 && s->sector_hits >= len / 512 * 7 / 8);
+            result("sequential: read ahead is used", s->readahead_hits + 2 >= s->readaheads &&
+                                                     s->readahead_hits >= len / FLASH_BDEV_SECTOR_SIZE - 2);
+        } else {
+            // With time to read ahead while the chunks are processed, the
+            // reads cost no more than the work itself and the occasional wait
+            result("sequential: overlaps reading with work", ns < blocking_ns * 3 / 4);
+        }
+    }
+}
+
+static void test_working_set(void) {
+    setup();
+    static uint8_t buf[64];
+    // Small reads scattered over six sectors, which all fit in the cache
+    for (uint i = 0; i < 4096; ++i) {
+        flash_bdev_read(&bd, (next_rand() % 6) * 0x10000 + next_rand() % (FLASH_BDEV_SECTOR_SIZE - 64), buf, 64,
+                        NULL, NULL);
+        flash_bdev_wait(&bd);
+    }
+    result("working set: misses only to begin with", bd.stats.sector_misses == 6);
+    print_stats();
+
+    // Spread over all of the flash, the cache is no help
+    setup();
+    for (uint i = 0; i < 4096; ++i) {
+        flash_bdev_read(&bd, next_rand() % (SIM_SIZE - 64), buf, 64, NULL, NULL);
+        flash_bdev_wait(&bd);
+    }
+    print_stats();
+
+    // The time spent in flash_bdev_read() and flash_bdev_task() for a read
+    // which hits
+    setup();
+    flash_bdev_read(&bd, 0, buf, 64, NULL, NULL);
+    flash_bdev_wait(&bd);
+    const uint n = 100000;
+    uint64_t t0 = time_us_64();
+    for (uint i = 0; i < n; ++i) {
+        flash_bdev_read(&bd, (i * 64) % (FLASH_BDEV_SECTOR_SIZE - 64), buf, 64, NULL, NULL);
+        flash_bdev_task(&bd);
+    }
+    uint64_t t1 = time_us_64();
+    printf("  cached 64 byte read: %u ns each\n", (uint) ((t1 - t0) * 1000 / n));
+}
+
+// A log appended to in small records, which must stay put until they have
+// been written
+static uint8_t log_data[FLASH_BDEV_SECTOR_SIZE];
+
+static uint64_t log_writes(uint32_t record_len) {
+    uint64_t start = sim.now_ns;
+    flash_bdev_erase(&bd, 0, NULL, NULL);
+    for (uint32_t addr = 0; addr < sizeof(log_data); addr += record_len) {
+        while (!flash_bdev_write(&bd, addr, log_data + addr, record_len, NULL, NULL))
+            flash_bdev_task(&bd);
+        flash_bdev_task(&bd);
+    }
+    while (!flash_bdev_flush(&bd, NULL, NULL))
+        flash_bdev_task(&bd);
+    flash_bdev_wait(&bd);
+    return sim.now_ns - start;
+}
+
+static uint64_t log_writes_blocking(uint32_t record_len) {
+    uint64_t start = sim.now_ns;
+    sim_start_erase(&sim, 0);
+    sim_wait(&sim);
+    for (uint32_t addr = 0; addr < sizeof(log_data); addr += record_len) {
+        sim_start_program(&sim, addr, log_data + addr, record_len);
+        sim_wait(&sim);
+    }
+    return sim.now_ns - start;
+}
+
+static void test_log(void) {
+    for (uint i = 0; i < sizeof(log_data); ++i)
+        log_data[i] = (uint8_t) next_rand();
+    setup();
+    uint64_t blocking_ns = log_writes_blocking(16);
+    setup();
+    uint64_t ns = log_writes(16);
+    printf("  4 KB log in 16 byte records: %6u us, blocking %6u us\n", (uint) (ns / 1000),
+           (uint) (blocking_ns / 1000));
+    print_stats();
+    result("log: one program per page", sim.programs == sizeof(log_data) / FLASH_BDEV_PAGE_SIZE);
+    result("log: contents", !memcmp(sim.mem, log_data, sizeof(log_data)));
+}
+
+int main() {
+    stdio_init_all();
+    printf("Flash block device test\n");
+
+    test_random();
+    test_limits();
+    test_sequential();
+    test_working_set();
+    test_log();
+
+    printf(failures ? "FAILED\n" : "All good\n");
+    return failures ? 1 : 0;
+}
@@ -5,6 +5,9 @@
  */
 
 // Example of reading/writing an external serial flash using the PL022 SPI interface
+//
+// See spi_flash_bdev.c for the same flash used as a cached block device, with
+// the transfers done by DMA.
 
 #include <stdio.h>
 #include "pico/stdlib.h"
@@ -0,0 +1,303 @@
+/**
+ * Copyright (c) 2022 Raspberry Pi (Trading) Ltd.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+// Example of using an external serial flash as a block device, through the
+// PL022 SPI interface and DMA, with a sector cache (see flash_bdev.h).
+//
+// Connections are the same as for spi_flash. A log of small records is
+// written to the first few sectors, and read back in chunks; the time each
+// takes is printed alongside the same work done with blocking calls, as in
+// spi_flash.c, and how much of the time the CPU was free.
+
+#include <stdio.h>
+#include <string.h>
+#include "pico/stdlib.h"
+#include "pico/binary_info.h"
+#include "hardware/spi.h"
+#include "hardware/dma.h"
+#include "flash_bdev.h"
+
+#define FLASH_CMD_PAGE_PROGRAM 0x02
+#define FLASH_CMD_READ         0x03
+#define FLASH_CMD_STATUS       0x05
+#define FLASH_CMD_WRITE_EN     0x06
+#define FLASH_CMD_SECTOR_ERASE 0x20
+
+#define FLASH_STATUS_BUSY_MASK 0x01
+
+// The log: 16 KB of 32 byte records, read back 512 bytes at a time
+#define LOG_SECTORS 4
+#define LOG_SIZE (LOG_SECTORS * FLASH_BDEV_SECTOR_SIZE)
+#define RECORD_LEN 32
+#define CHUNK_LEN 512
+
+// The flash wants CS low for 5 ns before the first clock edge and after the
+// last (tSLCH, tCHSH), and high for 50 ns between a write and the next
+// command (tSHSL). That is 1 and 7 cycles at up to 133 MHz; each call is only
+// made once the SPI has finished with the last byte.
+static inline void cs_select(uint cs_pin) {
+    gpio_put(cs_pin, 0);
+    busy_wait_at_least_cycles(1);
+}
+
+static inline void cs_deselect(uint cs_pin) {
+    busy_wait_at_least_cycles(1);
+    gpio_put(cs_pin, 1);
+    busy_wait_at_least_cycles(7);
+}
+
+// ----------------------------------------------------------------------------
+// Driver: the command and address are written directly, as they fit in the
+// SPI FIFO, and the data is moved by a pair of DMA channels, one to keep the
+// transmit FIFO fed and one to empty the receive FIFO. After a program or
+// erase, the status register is read each time busy() is asked, until the
+// flash is ready again.
+
+typedef struct {
+    spi_inst_t *spi;
+    uint cs_pin;
+    uint tx_chan;
+    uint rx_chan;
+    bool transferring;
+    bool wait_ready;
+} spi_flash_dma_t;
+
+static void send_cmd(spi_flash_dma_t *f, uint8_t cmd, uint32_t addr) {
+    uint8_t cmdbuf[4] = {
+            cmd,
+            addr >> 16,
+            addr >> 8,
+            addr
+    };
+    spi_write_blocking(f->spi, cmdbuf, 4);
+}
+
+static void write_enable(spi_flash_dma_t *f) {
+    cs_select(f->cs_pin);
+    uint8_t cmd = FLASH_CMD_WRITE_EN;
+    spi_write_blocking(f->spi, &cmd, 1);
+    cs_deselect(f->cs_pin);
+}
+
+// Move len bytes: from src to the flash, with what comes back discarded, or
+// from the flash to dst, sending zeros
+static void start_transfer(spi_flash_dma_t *f, const uint8_t *src, uint8_t *dst, uint len) {
+    static uint8_t zero, discard;
+
+    dma_channel_config c = dma_channel_get_default_config(f->tx_chan);
+    channel_config_set_transfer_data_size(&c, DMA_SIZE_8);
+    channel_config_set_dreq(&c, spi_get_dreq(f->spi, true));
+    channel_config_set_read_increment(&c, src != NULL);
+    dma_channel_configure(f->tx_chan, &c, &spi_get_hw(f->spi)->dr, src ? src : &zero, len, false);
+
+    c = dma_channel_get_default_config(f->rx_chan);
+    channel_config_set_transfer_data_size(&c, DMA_SIZE_8);
+    channel_config_set_dreq(&c, spi_get_dreq(f->spi, false));
+    channel_config_set_read_increment(&c, false);
+    channel_config_set_write_increment(&c, dst != NULL);
+    dma_channel_configure(f->rx_chan, &c, dst ? dst : &discard, &spi_get_hw(f->spi)->dr, len, false);
+
+    f->transferring = true;
+    dma_start_channel_mask((1u << f->tx_chan) | (1u << f->rx_chan));
+}
+
+static void spi_flash_dma_start_read(void *ctx, uint32_t addr, uint8_t *dst, uint len) {
+    spi_flash_dma_t *f = (spi_flash_dma_t *) ctx;
+    cs_select(f->cs_pin);
+    send_cmd(f, FLASH_CMD_READ, addr);
+    start_transfer(f, NULL, dst, len);
+}
+
+static void spi_flash_dma_start_program(void *ctx, uint32_t addr, const uint8_t *src, uint len) {
+    spi_flash_dma_t *f = (spi_flash_dma_t *) ctx;
+    write_enable(f);
+    cs_select(f->cs_pin);
+    send_cmd(f, FLASH_CMD_PAGE_PROGRAM, addr);
+    start_transfer(f, src, NULL, len);
+    f->wait_ready = true;
+}
+
+static void spi_flash_dma_start_erase(void *ctx, uint32_t addr) {
+    spi_flash_dma_t *f = (spi_flash_dma_t *) ctx;
+    write_enable(f);
+    cs_select(f->cs_pin);
+    send_cmd(f, FLASH_CMD_SECTOR_ERASE, addr);
+    cs_deselect(f->cs_pin);
+    f->wait_ready = true;
+}
+
+static bool spi_flash_dma_busy(void *ctx) {
+    spi_flash_dma_t *f = (spi_flash_dma_t *) ctx;
+    if (f->transferring) {
+        // The last byte has been sent once it has been received
+        if (dma_channel_is_busy(f->rx_chan))
+            return true;
+        cs_deselect(f->cs_pin);
+        f->transferring = false;
+    }
+    if (f->wait_ready) {
+        cs_select(f->cs_pin);
+        uint8_t buf[2] = {FLASH_CMD_STATUS, 0};
+        spi_write_read_blocking(f->spi, buf, buf, 2);
+        cs_deselect(f->cs_pin);
+        if (buf[1] & FLASH_STATUS_BUSY_MASK)
+            return true;
+        f->wait_ready = false;
+    }
+    return false;
+}
+
+static void spi_flash_dma_init(spi_flash_dma_t *f, spi_inst_t *spi, uint cs_pin) {
+    f->spi = spi;
+    f->cs_pin = cs_pin;
+    f->tx_chan = dma_claim_unused_channel(true);
+    f->rx_chan = dma_claim_unused_channel(true);
+    f->transferring = false;
+    f->wait_ready = false;
+}
+
+// ----------------------------------------------------------------------------
+
+static spi_flash_dma_t flash;
+static flash_bdev_t bd;
+
+static uint8_t log_data[LOG_SIZE];
+static uint8_t chunk[CHUNK_LEN];
+
+static void print_stats() {
+    const flash_bdev_stats_t *s = &bd.stats;
+    printf("  %u requests, %u sector hits, %u misses, %u read ahead (%u used), %u programs, %u erases\n",
+           s->requests, s->sector_hits, s->sector_misses, s->readaheads, s->readahead_hits, s->programs, s->erases);
+}
+
+// The same work done with blocking calls, one program per record
+static void blocking_run(uint64_t *write_us, uint64_t *read_us) {
+    uint64_t t0 = time_us_64();
+    for (uint32_t addr = 0; addr < LOG_SIZE; addr += FLASH_BDEV_SECTOR_SIZE) {
+        spi_flash_dma_start_erase(&flash, addr);
+        while (spi_flash_dma_busy(&flash));
+    }
+    for (uint32_t addr = 0; addr < LOG_SIZE; addr += RECORD_LEN) {
+        write_enable(&flash);
+        cs_select(flash.cs_pin);
+        send_cmd(&flash, FLASH_CMD_PAGE_PROGRAM, addr);
+        spi_write_blocking(flash.spi, log_data + addr, RECORD_LEN);
+        cs_deselect(flash.cs_pin);
+        flash.wait_ready = true;
+        while (spi_flash_dma_busy(&flash));
+    }
+    uint64_t t1 = time_us_64();
+    for (uint32_t addr = 0; addr < LOG_SIZE; addr += CHUNK_LEN) {
+        cs_select(flash.cs_pin);
+        send_cmd(&flash, FLASH_CMD_READ, addr);
+        spi_read_blocking(flash.spi, 0, chunk, CHUNK_LEN);
+        cs_deselect(flash.cs_pin);
+    }
+    *write_us = t1 - t0;
+    *read_us = time_us_64() - t1;
+}
+
+static bool chunk_ready;
+
+static void chunk_done(void *ctx) {
+    chunk_ready = true;
+}
+
+int main() {
+    // Enable UART so we can print status output
+    stdio_init_all();
+#if !defined(spi_default) || !defined(PICO_DEFAULT_SPI_SCK_PIN) || !defined(PICO_DEFAULT_SPI_TX_PIN) || !defined(PICO_DEFAULT_SPI_RX_PIN) || !defined(PICO_DEFAULT_SPI_CSN_PIN)
+#warning spi/spi_flash_bdev example requires a board with SPI pins
+    puts("Default SPI pins were not defined");
+#else
+
+    printf("SPI flash block device example\n");
+
+    // Enable SPI 0 at 25 MHz (the read command is good for up to 50 MHz on
+    // most parts) and connect to GPIOs
+    uint baud = spi_init(spi_default, 25 * 1000 * 1000);
+    gpio_set_function(PICO_DEFAULT_SPI_RX_PIN, GPIO_FUNC_SPI);
+    gpio_set_function(PICO_DEFAULT_SPI_SCK_PIN, GPIO_FUNC_SPI);
+    gpio_set_function(PICO_DEFAULT_SPI_TX_PIN, GPIO_FUNC_SPI);
+    // Make the SPI pins available to picotool
+    bi_decl(bi_3pins_with_func(PICO_DEFAULT_SPI_RX_PIN, PICO_DEFAULT_SPI_TX_PIN, PICO_DEFAULT_SPI_SCK_PIN, GPIO_FUNC_SPI));
+
+    // Chip select is active-low, so we'll initialise it to a driven-high state
+    gpio_init(PICO_DEFAULT_SPI_CSN_PIN);
+    gpio_put(PICO_DEFAULT_SPI_CSN_PIN, 1);
+    gpio_set_dir(PICO_DEFAULT_SPI_CSN_PIN, GPIO_OUT);
+    // Make the CS pin available to picotool
+    bi_decl(bi_1pin_with_name(PICO_DEFAULT_SPI_CSN_PIN, "SPI CS"));
+
+    printf("SPI initialised at %u Hz\n", baud);
+
+    spi_flash_dma_init(&flash, spi_default, PICO_DEFAULT_SPI_CSN_PIN);
+    flash_bdev_driver_t driver = {
+            .start_read = spi_flash_dma_start_read,
+            .start_program = spi_flash_dma_start_program,
+            .start_erase = spi_flash_dma_start_erase,
+            .busy = spi_flash_dma_busy,
+            .ctx = &flash,
+    };
+    // Only the start of the flash is used, so its size needn't be known
+    flash_bdev_init(&bd, &driver, 16 * LOG_SIZE);
+
+    for (uint i = 0; i < LOG_SIZE; ++i)
+        log_data[i] = (uint8_t) (i * 7 + i / RECORD_LEN);
+
+    uint64_t blocking_write_us, blocking_read_us;
+    blocking_run(&blocking_write_us, &blocking_read_us);
+
+    // Queue the log: the erases, then the records as fast as they will go.
+    // Whenever the queue is full, the time is counted as free.
+    uint64_t idle_loops = 0;
+    uint64_t t0 = time_us_64();
+    for (uint32_t addr = 0; addr < LOG_SIZE; addr += FLASH_BDEV_SECTOR_SIZE) {
+        while (!flash_bdev_erase(&bd, addr, NULL, NULL)) {
+            flash_bdev_task(&bd);
+            ++idle_loops;
+        }
+    }
+    for (uint32_t addr = 0; addr < LOG_SIZE; addr += RECORD_LEN) {
+        while (!flash_bdev_write(&bd, addr, log_data + addr, RECORD_LEN, NULL, NULL)) {
+            flash_bdev_task(&bd);
+            ++idle_loops;
+        }
+    }
+    while (!flash_bdev_flush(&bd, NULL, NULL))
+        flash_bdev_task(&bd);
+    while (!flash_bdev_idle(&bd)) {
+        flash_bdev_task(&bd);
+        ++idle_loops;
+    }
+    uint64_t t1 = time_us_64();
+    printf("Wrote %u KB in %u byte records: %u us (blocking %u us), %llu idle loops\n", LOG_SIZE / 1024, RECORD_LEN,
+           (uint) (t1 - t0), (uint) blocking_write_us, idle_loops);
+    print_stats();
+
+    // Throw away the cache, so the log is read back from the flash
+    flash_bdev_init(&bd, &driver, 16 * LOG_SIZE);
+    bool ok = true;
+    idle_loops = 0;
+    t0 = time_us_64();
+    for (uint32_t addr = 0; addr < LOG_SIZE; addr += CHUNK_LEN) {
+        chunk_ready = false;
+        flash_bdev_read(&bd, addr, chunk, CHUNK_LEN, chunk_done, NULL);
+        while (!chunk_ready) {
+            flash_bdev_task(&bd);
+            ++idle_loops;
+        }
+        ok &= !memcmp(chunk, log_data + addr, CHUNK_LEN);
+    }
+    t1 = time_us_64();
+    printf("Read %u KB in %u byte chunks: %u us (blocking %u us), %llu idle loops\n", LOG_SIZE / 1024, CHUNK_LEN,
+           (uint) (t1 - t0), (uint) blocking_read_us, idle_loops);
+    print_stats();
+    printf(ok ? "Log read back correctly\n" : "Log didn't match!\n");
+
+    return 0;
+#endif
+}
@@ -0,0 +1,31 @@
+/**
+ * Copyright (c) 2022 Raspberry Pi (Trading) Ltd.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+#ifndef _TEST_RAND_H
+#define _TEST_RAND_H
+
+#include "pico.h"
+
+// ----------------------------------------------------------------------------
+// Pseudo-random numbers for the examples' tests and benchmarks. xorshift32 is
+// quick, and gives the same sequence on the host and the device, so that a
+// failure seen on one can be repeated on the other. Each file which includes
+// this has a sequence of its own.
+
+static uint32_t rand_state = 1;
+
+// Start the sequence again from seed, which must not be 0
+static inline void seed_rand(uint32_t seed) {
+    rand_state = seed;
+}
+
+static inline uint32_t next_rand(void) {
+    rand_state ^= rand_state << 13;
+    rand_state ^= rand_state >> 17;
+    rand_state ^= rand_state << 5;
+    return rand_state;
+}
+
+#endif
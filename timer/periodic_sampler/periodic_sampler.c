@@ -6,25 +6,28 @@
 
 #include <stdio.h>
 #include "pico/stdlib.h"
-#include "pico/util/queue.h"
+#include "spsc_ring.h"
 
 bool timer_callback(repeating_timer_t *rt);
 
-queue_t sample_fifo;
+// Only the timer callback adds, and only main() removes, so a single producer
+// single consumer ring will do; unlike queue_t it never takes a lock or
+// disables interrupts in the callback.
+spsc_ring_t sample_fifo;
 
 // using struct as an example, but primitive types can be used too
 typedef struct element {
     uint value;
 } element_t;
 
-const int FIFO_LENGTH = 32;
+#define FIFO_LENGTH 32
 
 int main() {
     stdio_init_all();
 
     int hz = 25;
 
-    queue_init(&sample_fifo, sizeof(element_t), FIFO_LENGTH);
+    spsc_ring_init(&sample_fifo, sizeof(element_t), FIFO_LENGTH);
 
     repeating_timer_t timer;
 
@@ -38,19 +41,19 @@ int main() {
 
     for (int i = 0; i < 10; i++) {
         element_t element;
-        queue_remove_blocking(&sample_fifo, &element);
+        spsc_ring_remove_blocking(&sample_fifo, &element);
         printf("Got %d: %d\n", i, element.value);
     }
 
     // now retrieve all that are available periodically (simulate polling)
     for (int i = 0; i < 10; i++) {
-        int count = queue_get_level(&sample_fifo);
+        // take everything that is there in one go
+        element_t elements[FIFO_LENGTH];
+        int count = spsc_ring_pop(&sample_fifo, elements, FIFO_LENGTH);
         if (count) {
             printf("Getting %d, %d:\n", i, count);
-            for (; count > 0; count--) {
-                element_t element;
-                queue_remove_blocking(&sample_fifo, &element);
-                printf("  got %d\n", element.value);
+            for (int j = 0; j < count; j++) {
+                printf("  got %d\n", elements[j].value);
             }
         }
         sleep_us(5000000 / hz); // sleep for 5 times the sampling period
@@ -60,11 +63,11 @@ int main() {
 
     // drain any remaining
     element_t element;
-    while (queue_try_remove(&sample_fifo, &element)) {
+    while (spsc_ring_try_remove(&sample_fifo, &element)) {
         printf("Got remaining %d\n", element.value);
     }
 
-    queue_free(&sample_fifo);
+    spsc_ring_free(&sample_fifo);
     printf("Done\n");
     return 0;
 }
@@ -76,7 +79,7 @@ bool timer_callback(repeating_timer_t *rt) {
     };
     v += 100;
 
-    if (!queue_try_add(&sample_fifo, &element)) {
+    if (!spsc_ring_try_add(&sample_fifo, &element)) {
         printf("FIFO was full\n");
     }
     return true; // keep repeating
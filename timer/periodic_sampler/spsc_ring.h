@@ -0,0 +1,136 @@
+/**
+ * Copyright (c) 2022 Raspberry Pi (Trading) Ltd.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+#ifndef _SPSC_RING_H
+#define _SPSC_RING_H
+
+#include <stdatomic.h>
+#include <stdlib.h>
+#include <string.h>
+#include "pico.h"
+
+// A wait-free ring for exactly one producer and one consumer, e.g. a timer
+// IRQ handing samples to the foreground, or one core handing data to the
+// other.
+//
+// Unlike queue_t, this takes no spin lock and never disables interrupts: the
+// producer only ever writes `tail` and the consumer only ever writes `head`.
+// Each side also keeps a private copy of the other side's index, and only
+// re-reads the shared one when the copy says the ring is full (or empty), so
+// most calls don't touch the other side's data at all.
+//
+// The element count is rounded up to a power of two, so indices can run
+// freely and wrap with a mask. Whole batches of elements can be pushed or
+// popped at once, costing at most two memcpy()s and one index update.
+
+typedef struct {
+    uint8_t *data;
+    uint element_size;
+    uint32_t mask;
+    // Producer side
+    _Atomic uint32_t tail;
+    uint32_t head_cache;
+    // Consumer side
+    _Atomic uint32_t head;
+    uint32_t tail_cache;
+} spsc_ring_t;
+
+static inline void spsc_ring_init(spsc_ring_t *r, uint element_size, uint element_count) {
+    uint32_t size = 1;
+    while (size < element_count)
+        size <<= 1;
+    r->data = (uint8_t *) calloc(size, element_size);
+    hard_assert(r->data);
+    r->element_size = element_size;
+    r->mask = size - 1;
+    atomic_store_explicit(&r->tail, 0, memory_order_relaxed);
+    atomic_store_explicit(&r->head, 0, memory_order_relaxed);
+    r->head_cache = 0;
+    r->tail_cache = 0;
+}
+
+static inline void spsc_ring_free(spsc_ring_t *r) {
+    free(r->data);
+    r->data = NULL;
+}
+
+// Number of elements in the ring. Exact from either side, though the other
+// side may change it immediately afterwards.
+static inline uint spsc_ring_get_level(spsc_ring_t *r) {
+    return atomic_load_explicit(&r->tail, memory_order_acquire) -
+           atomic_load_explicit(&r->head, memory_order_acquire);
+}
+
+// Copy between linear memory and the ring, starting at free-running index i,
+// splitting at the end of the buffer if needed
+static inline void spsc_ring_copy_in(spsc_ring_t *r, uint32_t i, const uint8_t *src, uint n) {
+    uint32_t first = (r->mask + 1) - (i & r->mask);
+    if (first > n)
+        first = n;
+    memcpy(r->data + (i & r->mask) * r->element_size, src, first * r->element_size);
+    if (n > first)
+        memcpy(r->data, src + first * r->element_size, (n - first) * r->element_size);
+}
+
+static inline void spsc_ring_copy_out(spsc_ring_t *r, uint32_t i, uint8_t *dst, uint n) {
+    uint32_t first = (r->mask + 1) - (i & r->mask);
+    if (first > n)
+        first = n;
+    memcpy(dst, r->data + (i & r->mask) * r->element_size, first * r->element_size);
+    if (n > first)
+        memcpy(dst + first * r->element_size, r->data, (n - first) * r->element_size);
+}
+
+// Producer: add up to n elements. Returns how many fitted.
+static inline uint spsc_ring_push(spsc_ring_t *r, const void *elements, uint n) {
+    uint32_t tail = atomic_load_explicit(&r->tail, memory_order_relaxed);
+    uint32_t space = r->mask + 1 - (tail - r->head_cache);
+    if (space < n) {
+        r->head_cache = atomic_load_explicit(&r->head, memory_order_acquire);
+        space = r->mask + 1 - (tail - r->head_cache);
+        if (space < n)
+            n = space;
+    }
+    if (n) {
+        spsc_ring_copy_in(r, tail, (const uint8_t *) elements, n);
+        atomic_store_explicit(&r->tail, tail + n, memory_order_release);
+    }
+    return n;
+}
+
+// Consumer: take up to n elements. Returns how many there were.
+static inline uint spsc_ring_pop(spsc_ring_t *r, void *elements, uint n) {
+    uint32_t head = atomic_load_explicit(&r->head, memory_order_relaxed);
+    uint32_t avail = r->tail_cache - head;
+    if (avail < n) {
+        r->tail_cache = atomic_load_explicit(&r->tail, memory_order_acquire);
+        avail = r->tail_cache - head;
+        if (avail < n)
+            n = avail;
+    }
+    if (n) {
+        spsc_ring_copy_out(r, head, (uint8_t *) elements, n);
+        atomic_store_explicit(&r->head, head + n, memory_order_release);
+    }
+    return n;
+}
+
+static inline bool spsc_ring_try_add(spsc_ring_t *r, const void *element) {
+    return spsc_ring_push(r, element, 1);
+}
+
+static inline bool spsc_ring_try_remove(spsc_ring_t *r, void *element) {
+    return spsc_ring_pop(r, element, 1);
+}
+
+// Consumer: wait until an element arrives. Only useful if the producer is an
+// IRQ or the other core.
+static inline void spsc_ring_remove_blocking(spsc_ring_t *r, void *element) {
+    while (!spsc_ring_pop(r, element, 1))
+        tight_loop_contents();
+}
+
+#endif
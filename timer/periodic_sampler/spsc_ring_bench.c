@@ -0,0 +1,110 @@
+/**
+ * Copyright (c) 2022 Raspberry Pi (Trading) Ltd.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+#include <stdio.h>
+#include "pico/stdlib.h"
+#include "pico/util/queue.h"
+#include "spsc_ring.h"
+
+// Compare the cost per element of queue_t (as used by periodic_sampler before)
+// with spsc_ring_t, when moving batches of 1, 8 and 64 elements at a time.
+// Both ends run on one core, so this is the cost of the calls themselves,
+// without any waiting for the other side.
+//
+// queue_t has no batch API, so a batch there is just n calls to
+// queue_try_add() followed by n calls to queue_remove_blocking().
+
+typedef struct element {
+    uint value;
+} element_t;
+
+#define FIFO_LENGTH 64
+#define ELEMENTS_PER_RUN (1u << 20)
+
+static queue_t queue;
+static spsc_ring_t ring;
+
+static uint32_t bench_queue(uint batch) {
+    element_t buf[FIFO_LENGTH];
+    uint32_t sum = 0;
+    for (uint n = 0; n < ELEMENTS_PER_RUN; n += batch) {
+        for (uint i = 0; i < batch; ++i) {
+            buf[i].value = n + i;
+            queue_try_add(&queue, &buf[i]);
+        }
+        for (uint i = 0; i < batch; ++i) {
+            queue_remove_blocking(&queue, &buf[i]);
+            sum += buf[i].value;
+        }
+    }
+    return sum;
+}
+
+static uint32_t bench_ring_single(uint batch) {
+    element_t buf[FIFO_LENGTH];
+    uint32_t sum = 0;
+    for (uint n = 0; n < ELEMENTS_PER_RUN; n += batch) {
+        for (uint i = 0; i < batch; ++i) {
+            buf[i].value = n + i;
+            spsc_ring_try_add(&ring, &buf[i]);
+        }
+        for (uint i = 0; i < batch; ++i) {
+            spsc_ring_remove_blocking(&ring, &buf[i]);
+            sum += buf[i].value;
+        }
+    }
+    return sum;
+}
+
+static uint32_t bench_ring_bulk(uint batch) {
+    element_t buf[FIFO_LENGTH];
+    uint32_t sum = 0;
+    for (uint n = 0; n < ELEMENTS_PER_RUN; n += batch) {
+        for (uint i = 0; i < batch; ++i)
+            buf[i].value = n + i;
+        spsc_ring_push(&ring, buf, batch);
+        spsc_ring_pop(&ring, buf, batch);
+        for (uint i = 0; i < batch; ++i)
+            sum += buf[i].value;
+    }
+    return sum;
+}
+
+static const struct {
+    const char *name;
+    uint32_t (*func)(uint batch);
+} benches[] = {
+    {"queue_try_add/queue_remove_blocking", bench_queue},
+    {"spsc_ring_try_add/remove_blocking", bench_ring_single},
+    {"spsc_ring_push/pop", bench_ring_bulk},
+};
+
+int main() {
+    stdio_init_all();
+
+    queue_init(&queue, sizeof(element_t), FIFO_LENGTH);
+    spsc_ring_init(&ring, sizeof(element_t), FIFO_LENGTH);
+
+    // Sum of 0 .. ELEMENTS_PER_RUN - 1, mod 2^32
+    uint32_t expected = (uint32_t) ((uint64_t) ELEMENTS_PER_RUN * (ELEMENTS_PER_RUN - 1) / 2);
+
+    static const uint batches[] = {1, 8, 64};
+    for (uint b = 0; b < count_of(batches); ++b) {
+        printf("Batches of %d:\n", batches[b]);
+        for (uint i = 0; i < count_of(benches); ++i) {
+            uint64_t start = time_us_64();
+            uint32_t sum = benches[i].func(batches[b]);
+            uint64_t elapsed = time_us_64() - start;
+            printf("  %-36s %8.2f ns/element%s\n", benches[i].name, elapsed * 1000.0 / ELEMENTS_PER_RUN,
+                   sum == expected ? "" : " WRONG ANSWER");
+        }
+    }
+
+    queue_free(&queue);
+    spsc_ring_free(&ring);
+    printf("Done\n");
+    return 0;
+}
@@ -0,0 +1,330 @@
+/**
+ * Copyright (c) 2022 Raspberry Pi (Trading) Ltd.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+#include <string.h>
+
+#include "pico.h"
+#include "hid_pipeline.h"
+
+#define KEY_MODIFIER_FIRST 0xE0
+#define KEY_MODIFIER_LAST  0xE7
+
+void hid_pipeline_init(hid_pipeline_t *p)
+{
+  memset(p, 0, sizeof(*p));
+  for (uint8_t id = 0; id < REPORT_ID_COUNT; id++)
+  {
+    p->state[id].report_id = id;
+    p->reported[id].report_id = id;
+  }
+}
+
+bool hid_pipeline_push(hid_pipeline_t *p, hid_event_t const *ev)
+{
+  uint32_t head = p->head;
+  if (head - p->tail == HID_EVENT_QUEUE_SIZE)
+  {
+    p->events_dropped++;
+    return false;
+  }
+  p->events[head % HID_EVENT_QUEUE_SIZE] = *ev;
+  // The event must be in place before hid_pipeline_next() can see it
+  __compiler_memory_barrier();
+  p->head = head + 1;
+  return true;
+}
+
+//--------------------------------------------------------------------+
+// Applying events
+//--------------------------------------------------------------------+
+
+static bool key_down(hid_report_t const *r, uint16_t key)
+{
+  if (key >= KEY_MODIFIER_FIRST && key <= KEY_MODIFIER_LAST)
+  {
+    return r->keyboard.modifier & (1u << (key - KEY_MODIFIER_FIRST));
+  }
+  for (uint i = 0; i < 6; i++)
+  {
+    if (r->keyboard.keycode[i] == key) return true;
+  }
+  return false;
+}
+
+static void set_key(hid_report_t *r, uint16_t key, bool down)
+{
+  if (key >= KEY_MODIFIER_FIRST && key <= KEY_MODIFIER_LAST)
+  {
+    uint8_t bit = (uint8_t) (1u << (key - KEY_MODIFIER_FIRST));
+    r->keyboard.modifier = down ? (r->keyboard.modifier | bit) : (r->keyboard.modifier & ~bit);
+    return;
+  }
+  // The report has a byte for each key
+  if (!key || key > 0xFF || key_down(r, key) == down) return;
+
+  uint8_t *keys = r->keyboard.keycode;
+  if (down)
+  {
+    // The keys in the order they went down; a seventh isn't reported
+    for (uint i = 0; i < 6; i++)
+    {
+      if (!keys[i])
+      {
+        keys[i] = (uint8_t) key;
+        break;
+      }
+    }
+  }else
+  {
+    uint i = 0;
+    while (keys[i] != key) i++;
+    for (; i < 5; i++) keys[i] = keys[i + 1];
+    keys[5] = 0;
+  }
+}
+
+static void set_bit32(uint32_t *bits, uint16_t n, bool set)
+{
+  if (n >= 32) return;
+  *bits = set ? (*bits | (1u << n)) : (*bits & ~(1u << n));
+}
+
+static uint8_t event_report_id(hid_event_t const *ev)
+{
+  switch (ev->type)
+  {
+    case HID_EVENT_KEY: return REPORT_ID_KEYBOARD;
+    case HID_EVENT_MOUSE_BUTTON:
+    case HID_EVENT_MOUSE_MOVE:
+    case HID_EVENT_MOUSE_WHEEL: return REPORT_ID_MOUSE;
+    case HID_EVENT_CONSUMER: return REPORT_ID_CONSUMER_CONTROL;
+    case HID_EVENT_GAMEPAD_BUTTON:
+    case HID_EVENT_GAMEPAD_HAT: return REPORT_ID_GAMEPAD;
+    default: return 0;
+  }
+}
+
+// Whether the control the event is for has changed since it was last
+// reported, so the event would overwrite a change the host hasn't seen
+static bool change_unreported(hid_pipeline_t const *p, hid_event_t const *ev)
+{
+  uint8_t id = event_report_id(ev);
+  hid_report_t const *now = &p->state[id];
+  hid_report_t const *was = &p->reported[id];
+  switch (ev->type)
+  {
+    case HID_EVENT_KEY:
+      return key_down(now, ev->code) != key_down(was, ev->code);
+
+    case HID_EVENT_MOUSE_BUTTON:
+      return (now->mouse.buttons ^ was->mouse.buttons) & ev->code;
+
+    case HID_EVENT_CONSUMER:
+      return now->consumer != was->consumer;
+
+    case HID_EVENT_GAMEPAD_BUTTON:
+      return ev->code < 32 && ((now->gamepad.buttons ^ was->gamepad.buttons) & (1u << ev->code));
+
+    default:
+      // Motion adds up, and the hat only says where it is now
+      return false;
+  }
+}
+
+// Apply an event to its report's state, or return false if it has to wait
+// for the report to go first
+static bool apply_event(hid_pipeline_t *p, hid_event_t const *ev)
+{
+  uint8_t id = event_report_id(ev);
+  if (!id) return true;
+  if (change_unreported(p, ev)) return false;
+
+  hid_report_t *r = &p->state[id];
+  switch (ev->type)
+  {
+    case HID_EVENT_KEY:
+      set_key(r, ev->code, ev->pressed);
+      break;
+
+    case HID_EVENT_MOUSE_BUTTON:
+      r->mouse.buttons = ev->pressed ? (r->mouse.buttons | ev->code) : (r->mouse.buttons & ~ev->code);
+      break;
+
+    case HID_EVENT_MOUSE_MOVE:
+      p->mouse_dx += ev->dx;
+      p->mouse_dy += ev->dy;
+      break;
+
+    case HID_EVENT_MOUSE_WHEEL:
+      p->mouse_wheel += ev->dy;
+      p->mouse_pan += ev->dx;
+      break;
+
+    case HID_EVENT_CONSUMER:
+      if (ev->pressed)
+      {
+        r->consumer = ev->code;
+      }else if (r->consumer == ev->code)
+      {
+        r->consumer = 0;
+      }
+      break;
+
+    case HID_EVENT_GAMEPAD_BUTTON:
+      set_bit32(&r->gamepad.buttons, ev->code, ev->pressed);
+      break;
+
+    case HID_EVENT_GAMEPAD_HAT:
+      r->gamepad.hat = (uint8_t) ev->code;
+      break;
+  }
+
+  if (!p->pending[id])
+  {
+    p->pending[id] = true;
+    p->pending_since_us[id] = ev->time_us;
+  }
+  return true;
+}
+
+static void apply_events(hid_pipeline_t *p)
+{
+  uint32_t tail = p->tail;
+  while (tail != p->head && apply_event(p, &p->events[tail % HID_EVENT_QUEUE_SIZE]))
+  {
+    tail++;
+  }
+  p->tail = tail;
+}
+
+//--------------------------------------------------------------------+
+// Generating reports
+//--------------------------------------------------------------------+
+
+static int8_t take_motion(int32_t *motion)
+{
+  int32_t d = *motion < -127 ? -127 : (*motion > 127 ? 127 : *motion);
+  *motion -= d;
+  return (int8_t) d;
+}
+
+// Fill in the report for an ID from its state; returns whether it says
+// anything the last one didn't
+static bool make_report(hid_pipeline_t *p, uint8_t id, hid_report_t *report)
+{
+  hid_report_t const *now = &p->state[id];
+  hid_report_t const *was = &p->reported[id];
+  *report = *now;
+  switch (id)
+  {
+    case REPORT_ID_KEYBOARD:
+      return memcmp(&now->keyboard, &was->keyboard, sizeof(now->keyboard)) != 0;
+
+    case REPORT_ID_MOUSE:
+      report->mouse.x = take_motion(&p->mouse_dx);
+      report->mouse.y = take_motion(&p->mouse_dy);
+      report->mouse.wheel = take_motion(&p->mouse_wheel);
+      report->mouse.pan = take_motion(&p->mouse_pan);
+      return now->mouse.buttons != was->mouse.buttons || report->mouse.x || report->mouse.y ||
+             report->mouse.wheel || report->mouse.pan;
+
+    case REPORT_ID_CONSUMER_CONTROL:
+      return now->consumer != was->consumer;
+
+    case REPORT_ID_GAMEPAD:
+      return now->gamepad.hat != was->gamepad.hat || now->gamepad.buttons != was->gamepad.buttons;
+
+    default:
+      return false;
+  }
+}
+
+static bool mouse_motion_left(hid_pipeline_t const *p)
+{
+  return p->mouse_dx || p->mouse_dy || p->mouse_wheel || p->mouse_pan;
+}
+
+bool hid_pipeline_has_input(hid_pipeline_t *p)
+{
+  if (p->tail != p->head) return true;
+  for (uint8_t id = 1; id < REPORT_ID_COUNT; id++)
+  {
+    if (p->pending[id]) return true;
+  }
+  return false;
+}
+
+bool hid_pipeline_next(hid_pipeline_t *p, hid_report_t *report)
+{
+  // Events go into the state even while a report is in flight, so the
+  // queue doesn't fill up
+  apply_events(p);
+  if (p->in_flight) return false;
+
+  while (1)
+  {
+    // The ID which has waited longest
+    uint8_t id = 0;
+    for (uint8_t i = 1; i < REPORT_ID_COUNT; i++)
+    {
+      if (p->pending[i] && (!id || (int32_t) (p->pending_since_us[i] - p->pending_since_us[id]) < 0))
+      {
+        id = i;
+      }
+    }
+    if (!id) return false;
+
+    bool changed = make_report(p, id, report);
+    // Motion too big for one report goes in the next
+    p->pending[id] = id == REPORT_ID_MOUSE && mouse_motion_left(p);
+    if (changed)
+    {
+      p->in_flight_was = p->reported[id];
+      p->reported[id] = *report;
+      p->in_flight = true;
+      p->in_flight_id = id;
+      p->in_flight_since_us = p->pending_since_us[id];
+      // A held back event may be able to go in now
+      apply_events(p);
+      return true;
+    }
+  }
+}
+
+void hid_pipeline_report_done(hid_pipeline_t *p, uint32_t now_us)
+{
+  if (!p->in_flight) return;
+  p->in_flight = false;
+
+  uint32_t latency_us = now_us - p->in_flight_since_us;
+  uint i = 0;
+  while (i < HID_LATENCY_BUCKETS - 1 && latency_us >= (HID_LATENCY_BUCKET_US << i)) i++;
+  p->latency_hist[i]++;
+  p->reports++;
+  p->latency_total_us += latency_us;
+  if (latency_us > p->latency_max_us) p->latency_max_us = latency_us;
+}
+
+void hid_pipeline_report_dropped(hid_pipeline_t *p)
+{
+  if (!p->in_flight) return;
+  p->in_flight = false;
+
+  // The host never saw the report, so its ID is back to what it last saw,
+  // with the report's motion still to send
+  uint8_t id = p->in_flight_id;
+  hid_report_t const *r = &p->reported[id];
+  if (id == REPORT_ID_MOUSE)
+  {
+    p->mouse_dx += r->mouse.x;
+    p->mouse_dy += r->mouse.y;
+    p->mouse_wheel += r->mouse.wheel;
+    p->mouse_pan += r->mouse.pan;
+  }
+  p->reported[id] = p->in_flight_was;
+  p->pending[id] = true;
+  p->pending_since_us[id] = p->in_flight_since_us;
+}
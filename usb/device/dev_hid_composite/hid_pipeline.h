@@ -0,0 +1,138 @@
+/**
+ * Copyright (c) 2022 Raspberry Pi (Trading) Ltd.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+#ifndef HID_PIPELINE_H_
+#define HID_PIPELINE_H_
+
+#include <stdbool.h>
+#include <stdint.h>
+
+#include "usb_descriptors.h"
+
+//--------------------------------------------------------------------+
+// Input events in, HID reports out, independent of TinyUSB.
+//
+// Input (a GPIO interrupt, a scan of a key matrix) pushes timestamped events
+// onto a queue as they happen. When the HID endpoint is ready for another
+// report, hid_pipeline_next() applies the queued events to the state of each
+// report ID, and returns a report for the ID which has waited longest:
+//
+// - change-only: an ID whose state is the same as it last reported sends
+//   nothing, and mouse motion is sent only when there is some;
+// - coalescing: all the events for an ID since its last report go in its
+//   next one, and mouse motion is summed. A press and release of the same
+//   key (or button) are never coalesced away: the release waits in the queue
+//   until the press has been reported.
+//
+// The time from the first event in a report to the host taking the report
+// (hid_pipeline_report_done()) is kept in a histogram.
+//--------------------------------------------------------------------+
+
+enum
+{
+  HID_EVENT_KEY,            // code: HID keycode, up to 0xFF (modifiers are 0xE0 - 0xE7)
+  HID_EVENT_MOUSE_BUTTON,   // code: button bit (MOUSE_BUTTON_LEFT etc)
+  HID_EVENT_MOUSE_MOVE,     // dx, dy
+  HID_EVENT_MOUSE_WHEEL,    // dy: scroll, dx: pan
+  HID_EVENT_CONSUMER,       // code: consumer control usage
+  HID_EVENT_GAMEPAD_BUTTON, // code: button number, 0 - 31
+  HID_EVENT_GAMEPAD_HAT,    // code: hat position, 0 (centred) - 8
+};
+
+typedef struct
+{
+  uint32_t time_us;
+  uint8_t type;
+  bool pressed;
+  uint16_t code;
+  int16_t dx, dy;
+} hid_event_t;
+
+// Reports as the report descriptor lays them out, less the report ID
+typedef struct
+{
+  uint8_t report_id;
+  union
+  {
+    struct
+    {
+      uint8_t modifier;
+      uint8_t keycode[6];
+    } keyboard;
+
+    struct
+    {
+      uint8_t buttons;
+      int8_t x, y, wheel, pan;
+    } mouse;
+
+    uint16_t consumer;
+
+    struct
+    {
+      uint8_t hat;
+      uint32_t buttons;
+    } gamepad;
+  };
+} hid_report_t;
+
+// Must be a power of 2
+#define HID_EVENT_QUEUE_SIZE 64
+
+// Bucket i counts latencies under 250 us << i; the last, everything longer
+#define HID_LATENCY_BUCKETS 8
+#define HID_LATENCY_BUCKET_US 250u
+
+typedef struct
+{
+  // Events, from the input side
+  hid_event_t events[HID_EVENT_QUEUE_SIZE];
+  volatile uint32_t head;
+  volatile uint32_t tail;
+  volatile uint32_t events_dropped;
+
+  // State of each report ID, as it is and as last reported; its mouse
+  // motion not yet reported; and when its first unreported event happened
+  hid_report_t state[REPORT_ID_COUNT];
+  hid_report_t reported[REPORT_ID_COUNT];
+  int32_t mouse_dx, mouse_dy, mouse_wheel, mouse_pan;
+  bool pending[REPORT_ID_COUNT];
+  uint32_t pending_since_us[REPORT_ID_COUNT];
+
+  // The report the host hasn't taken yet, and what its ID had reported
+  // before it, in case it is dropped
+  bool in_flight;
+  uint8_t in_flight_id;
+  uint32_t in_flight_since_us;
+  hid_report_t in_flight_was;
+
+  uint32_t reports;
+  uint32_t latency_hist[HID_LATENCY_BUCKETS];
+  uint32_t latency_max_us;
+  uint64_t latency_total_us;
+} hid_pipeline_t;
+
+void hid_pipeline_init(hid_pipeline_t *p);
+
+// Queue an event; false if the queue is full, and the event is dropped.
+// Safe to call from an interrupt handler, with hid_pipeline_next() in the
+// main loop.
+bool hid_pipeline_push(hid_pipeline_t *p, hid_event_t const *ev);
+
+// Whether there is anything to report (for remote wakeup, say)
+bool hid_pipeline_has_input(hid_pipeline_t *p);
+
+// The next report to send, if there is one and the last has been taken
+bool hid_pipeline_next(hid_pipeline_t *p, hid_report_t *report);
+
+// The host has taken the report: record its latency
+void hid_pipeline_report_done(hid_pipeline_t *p, uint32_t now_us);
+
+// The report couldn't be sent (the device isn't mounted): it is made again,
+// with whatever has changed since, for the next hid_pipeline_next()
+void hid_pipeline_report_dropped(hid_pipeline_t *p);
+
+#endif /* HID_PIPELINE_H_ */
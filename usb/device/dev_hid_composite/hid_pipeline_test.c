@@ -0,0 +1,386 @@
+/**
+ * Copyright (c) 2022 Raspberry Pi (Trading) Ltd.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+#include <stdio.h>
+#include <string.h>
+
+#include "pico/stdlib.h"
+#include "hid_pipeline.h"
+#include "test_rand.h"
+
+// Feeds synthetic input events through hid_pipeline.c: checks the reports it
+// makes of them, then simulates a host polling the endpoint, with input from
+// events or polled every 10ms as main.c used to, and prints the histogram of
+// input to report latency. hid_pipeline.c has no TinyUSB in it, so neither
+// does this.
+
+static int failures;
+
+static void result(const char *name, bool ok)
+{
+  printf("%-40s %s\n", name, ok ? "ok" : "FAILED");
+  if (!ok) ++failures;
+}
+
+#define KEY_A         0x04
+#define KEY_B         0x05
+#define KEY_SHIFT     0xE1
+#define VOLUME_DOWN   0xEA
+#define HAT_UP        1
+#define HAT_CENTRED   0
+
+static hid_pipeline_t hp;
+
+static void push(uint32_t time_us, uint8_t type, bool pressed, uint16_t code, int16_t dx, int16_t dy)
+{
+  hid_event_t ev = { .time_us = time_us, .type = type, .pressed = pressed, .code = code, .dx = dx, .dy = dy };
+  hid_pipeline_push(&hp, &ev);
+}
+
+static void report_str(hid_report_t const *r, char *s, size_t n)
+{
+  switch (r->report_id)
+  {
+    case REPORT_ID_KEYBOARD:
+      snprintf(s, n, "key %02x %02x %02x %02x %02x %02x %02x", r->keyboard.modifier, r->keyboard.keycode[0],
+               r->keyboard.keycode[1], r->keyboard.keycode[2], r->keyboard.keycode[3], r->keyboard.keycode[4],
+               r->keyboard.keycode[5]);
+      break;
+    case REPORT_ID_MOUSE:
+      snprintf(s, n, "mouse %x %d %d %d %d", r->mouse.buttons, r->mouse.x, r->mouse.y, r->mouse.wheel, r->mouse.pan);
+      break;
+    case REPORT_ID_CONSUMER_CONTROL:
+      snprintf(s, n, "consumer %04x", r->consumer);
+      break;
+    case REPORT_ID_GAMEPAD:
+      snprintf(s, n, "gamepad %u %08x", r->gamepad.hat, (uint) r->gamepad.buttons);
+      break;
+    default:
+      snprintf(s, n, "id %u", r->report_id);
+  }
+}
+
+// Take reports, each 1ms after the last, until there are no more, and check
+// they are the ones expected
+static bool expect(uint32_t *now_us, char const *const *expected)
+{
+  bool ok = true;
+  hid_report_t r;
+  while (hid_pipeline_next(&hp, &r))
+  {
+    char s[64];
+    report_str(&r, s, sizeof(s));
+    if (!*expected || strcmp(s, *expected))
+    {
+      printf("  got \"%s\", expected \"%s\"\n", s, *expected ? *expected : "nothing");
+      ok = false;
+    }
+    if (*expected) expected++;
+    *now_us += 1000;
+    hid_pipeline_report_done(&hp, *now_us);
+  }
+  if (*expected)
+  {
+    printf("  missing \"%s\"\n", *expected);
+    ok = false;
+  }
+  return ok;
+}
+
+//--------------------------------------------------------------------+
+// The reports made of a few sequences of events
+//--------------------------------------------------------------------+
+
+static void test_reports(void)
+{
+  uint32_t t = 0;
+  bool ok;
+
+  // A key, then shift, in one report; a press and release before the
+  // host's poll still make two reports
+  hid_pipeline_init(&hp);
+  push(t, HID_EVENT_KEY, true, KEY_A, 0, 0);
+  push(t, HID_EVENT_KEY, true, KEY_SHIFT, 0, 0);
+  push(t, HID_EVENT_KEY, true, KEY_B, 0, 0);
+  push(t, HID_EVENT_KEY, false, KEY_B, 0, 0);
+  push(t, HID_EVENT_KEY, false, KEY_A, 0, 0);
+  push(t, HID_EVENT_KEY, false, KEY_SHIFT, 0, 0);
+  ok = expect(&t, (char const *const[]) {
+    "key 02 04 05 00 00 00 00",
+    "key 00 00 00 00 00 00 00",
+    NULL
+  });
+  result("keys: coalesced, none lost", ok);
+
+  // Nothing is sent for events which change nothing
+  push(t, HID_EVENT_KEY, false, KEY_A, 0, 0);
+  push(t, HID_EVENT_GAMEPAD_HAT, false, HAT_UP, 0, 0);
+  push(t, HID_EVENT_GAMEPAD_HAT, false, HAT_CENTRED, 0, 0);
+  push(t, HID_EVENT_MOUSE_MOVE, false, 0, 5, -5);
+  push(t, HID_EVENT_MOUSE_MOVE, false, 0, -5, 5);
+  ok = expect(&t, (char const *const[]) { NULL });
+  result("change-only", ok);
+
+  // Motion adds up, and what doesn't fit in one report goes in the next
+  push(t, HID_EVENT_MOUSE_MOVE, false, 0, 5, 5);
+  push(t, HID_EVENT_MOUSE_MOVE, false, 0, 5, 5);
+  push(t, HID_EVENT_MOUSE_BUTTON, true, 1, 0, 0);
+  push(t, HID_EVENT_MOUSE_MOVE, false, 0, 290, -3);
+  push(t, HID_EVENT_MOUSE_WHEEL, false, 0, 0, -1);
+  ok = expect(&t, (char const *const[]) {
+    "mouse 1 127 7 -1 0",
+    "mouse 1 127 0 0 0",
+    "mouse 1 46 0 0 0",
+    NULL
+  });
+  result("mouse motion summed", ok);
+
+  // Oldest first, whatever the report ID: the gamepad button's release
+  // waits for its press to go, but is still older than the consumer press
+  push(t + 30, HID_EVENT_CONSUMER, true, VOLUME_DOWN, 0, 0);
+  push(t + 10, HID_EVENT_GAMEPAD_BUTTON, true, 0, 0, 0);
+  push(t + 20, HID_EVENT_GAMEPAD_BUTTON, false, 0, 0, 0);
+  push(t + 40, HID_EVENT_GAMEPAD_HAT, false, HAT_UP, 0, 0);
+  push(t + 50, HID_EVENT_CONSUMER, false, VOLUME_DOWN, 0, 0);
+  t += 100;
+  ok = expect(&t, (char const *const[]) {
+    "gamepad 0 00000001",
+    "gamepad 1 00000000",
+    "consumer 00ea",
+    "consumer 0000",
+    NULL
+  });
+  result("oldest first", ok);
+
+  // One report in flight at a time
+  hid_report_t r;
+  push(t, HID_EVENT_KEY, true, KEY_A, 0, 0);
+  push(t, HID_EVENT_MOUSE_MOVE, false, 0, 1, 0);
+  ok = hid_pipeline_next(&hp, &r) && !hid_pipeline_next(&hp, &r);
+  hid_pipeline_report_done(&hp, t);
+  ok &= hid_pipeline_next(&hp, &r) && r.report_id == REPORT_ID_MOUSE;
+  result("one report in flight", ok);
+
+  // A report which couldn't be sent is made again, with what has changed
+  // since; and its motion isn't lost
+  hid_pipeline_init(&hp);
+  push(t, HID_EVENT_KEY, true, KEY_A, 0, 0);
+  push(t, HID_EVENT_MOUSE_MOVE, false, 0, 3, 0);
+  ok = hid_pipeline_next(&hp, &r) && r.report_id == REPORT_ID_KEYBOARD;
+  hid_pipeline_report_dropped(&hp);
+  push(t, HID_EVENT_KEY, true, KEY_B, 0, 0);
+  ok &= hid_pipeline_next(&hp, &r) && r.report_id == REPORT_ID_KEYBOARD;
+  hid_pipeline_report_dropped(&hp);
+  ok &= hid_pipeline_next(&hp, &r) && r.report_id == REPORT_ID_KEYBOARD;
+  hid_pipeline_report_done(&hp, t);
+  ok &= hid_pipeline_next(&hp, &r) && r.report_id == REPORT_ID_MOUSE;
+  hid_pipeline_report_dropped(&hp);
+  ok &= expect(&t, (char const *const[]) {
+    "mouse 0 3 0 0 0",
+    NULL
+  });
+  push(t, HID_EVENT_KEY, false, KEY_A, 0, 0);
+  push(t, HID_EVENT_KEY, false, KEY_B, 0, 0);
+  ok &= expect(&t, (char const *const[]) {
+    "key 00 00 00 00 00 00 00",
+    NULL
+  });
+  result("dropped report sent again", ok);
+
+  // A keycode too big for the report's byte is no key at all
+  push(t, HID_EVENT_KEY, true, 0x104, 0, 0);
+  ok = expect(&t, (char const *const[]) { NULL });
+  result("keycode out of range ignored", ok);
+
+  // The queue drops what it has no room for, and says so
+  hid_pipeline_init(&hp);
+  for (uint i = 0; i < HID_EVENT_QUEUE_SIZE + 3; i++)
+  {
+    push(t, HID_EVENT_MOUSE_MOVE, false, 0, 1, 0);
+  }
+  ok = hp.events_dropped == 3;
+  result("full queue drops events", ok);
+
+  // Latency is from the first event in a report to the host taking it
+  hid_pipeline_init(&hp);
+  push(1000, HID_EVENT_KEY, true, KEY_A, 0, 0);
+  push(1200, HID_EVENT_KEY, true, KEY_B, 0, 0);
+  ok = hid_pipeline_next(&hp, &r);
+  hid_pipeline_report_done(&hp, 1600);
+  ok &= hp.latency_max_us == 600 && hp.latency_hist[2] == 1 && hp.reports == 1;
+  result("latency counted", ok);
+}
+
+//--------------------------------------------------------------------+
+// A simulated host, polling the endpoint, and a user pressing keys and
+// buttons and moving the mouse at random. The host keeps its own idea of
+// what is pressed from the reports, to check every press and release gets
+// to it, and all the motion.
+//--------------------------------------------------------------------+
+
+#define SIM_TIME_US   10000000
+#define SIM_KEYS      6
+
+static uint32_t host_presses, host_releases;
+static int32_t host_dx;
+static hid_report_t host_keyboard, host_gamepad;
+
+static void host_take(hid_report_t const *r)
+{
+  switch (r->report_id)
+  {
+    case REPORT_ID_KEYBOARD:
+      for (uint i = 0; i < 6; i++)
+      {
+        uint8_t k = r->keyboard.keycode[i];
+        if (k && !memchr(host_keyboard.keyboard.keycode, k, 6)) host_presses++;
+        k = host_keyboard.keyboard.keycode[i];
+        if (k && !memchr(r->keyboard.keycode, k, 6)) host_releases++;
+      }
+      host_keyboard = *r;
+      break;
+    case REPORT_ID_MOUSE:
+      host_dx += r->mouse.x;
+      break;
+    case REPORT_ID_GAMEPAD:
+      host_presses += (uint32_t) __builtin_popcount(r->gamepad.buttons & ~host_gamepad.gamepad.buttons);
+      host_releases += (uint32_t) __builtin_popcount(~r->gamepad.buttons & host_gamepad.gamepad.buttons);
+      host_gamepad = *r;
+      break;
+  }
+}
+
+// events_per_s of input; the host polls every interval_us; input_poll_us is 0
+// for events queued as they happen, or how often the input is looked at.
+// Returns whether everything got to the host.
+static bool simulate(uint32_t events_per_s, uint32_t interval_us, uint32_t input_poll_us)
+{
+  hid_pipeline_init(&hp);
+  memset(&host_keyboard, 0, sizeof(host_keyboard));
+  memset(&host_gamepad, 0, sizeof(host_gamepad));
+  host_presses = host_releases = 0;
+  host_dx = 0;
+
+  bool keys[SIM_KEYS] = { false }, buttons[4] = { false };
+  uint32_t presses = 0, releases = 0;
+  int32_t dx = 0;
+
+  // Events at random times; each either a key or button going up or down,
+  // or some motion
+  hid_event_t pending[HID_EVENT_QUEUE_SIZE];
+  uint n_pending = 0;
+  uint32_t next_event_us = next_rand() % (2000000 / events_per_s);
+
+  hid_report_t r;
+  for (uint32_t t = interval_us; t < SIM_TIME_US + 100000; t += interval_us)
+  {
+    // The input between the last poll and this one
+    while (next_event_us <= t && next_event_us < SIM_TIME_US)
+    {
+      hid_event_t ev = { .time_us = next_event_us };
+      uint32_t what = next_rand() % 8;
+      if (what < 4)
+      {
+        uint k = next_rand() % SIM_KEYS;
+        ev.type = HID_EVENT_KEY;
+        ev.code = (uint16_t) (KEY_A + k);
+        ev.pressed = keys[k] = !keys[k];
+      }else if (what < 5)
+      {
+        uint b = next_rand() % 4;
+        ev.type = HID_EVENT_GAMEPAD_BUTTON;
+        ev.code = (uint16_t) b;
+        ev.pressed = buttons[b] = !buttons[b];
+      }else
+      {
+        ev.type = HID_EVENT_MOUSE_MOVE;
+        ev.dx = (int16_t) (next_rand() % 21) - 10;
+        dx += ev.dx;
+      }
+      if (ev.type != HID_EVENT_MOUSE_MOVE) ev.pressed ? presses++ : releases++;
+
+      if (!input_poll_us)
+      {
+        hid_pipeline_push(&hp, &ev);
+        // The main loop sends it if the endpoint is free
+        if (!hp.in_flight && hid_pipeline_next(&hp, &r)) host_take(&r);
+      }else if (n_pending < count_of(pending))
+      {
+        pending[n_pending++] = ev;
+      }
+      next_event_us += 1 + next_rand() % (2000000 / events_per_s);
+    }
+
+    // Polled input is seen a poll after it happens
+    if (input_poll_us && n_pending && t % input_poll_us < interval_us)
+    {
+      for (uint i = 0; i < n_pending; i++) hid_pipeline_push(&hp, &pending[i]);
+      n_pending = 0;
+    }
+
+    // The host takes the report, if there is one, and the next one is made
+    // ready straight away
+    if (!hp.in_flight && hid_pipeline_next(&hp, &r)) host_take(&r);
+    if (hp.in_flight)
+    {
+      hid_pipeline_report_done(&hp, t);
+      if (hid_pipeline_next(&hp, &r)) host_take(&r);
+    }
+  }
+
+  return !hp.events_dropped && presses == host_presses && releases == host_releases && dx == host_dx;
+}
+
+static void print_latency(char const *name)
+{
+  printf("  %-26s", name);
+  for (uint i = 0; i < HID_LATENCY_BUCKETS; i++)
+  {
+    printf(" %5u%%", (uint) ((hp.latency_hist[i] * 100 + hp.reports / 2) / hp.reports));
+  }
+  printf(" %6u %6u\n", (uint) (hp.latency_total_us / hp.reports), (uint) hp.latency_max_us);
+}
+
+static void bench(void)
+{
+  static const uint32_t rates[] = { 20, 200, 1000 };
+  printf("\nInput to report latency (share of reports in each band, mean and max us):\n");
+  printf("  %-26s", "");
+  for (uint i = 0; i < HID_LATENCY_BUCKETS - 1; i++) printf(" %5uu", HID_LATENCY_BUCKET_US << i);
+  printf(" %6s %6s %6s\n", "longer", "mean", "max");
+
+  bool ok = true;
+  for (uint i = 0; i < count_of(rates); i++)
+  {
+    // Input looked at every 10ms, and the host polling every 5ms, as before
+    char name[64];
+    snprintf(name, sizeof(name), "%u/s, polled 10ms, 5ms", rates[i]);
+    simulate(rates[i], 5000, 10000);
+    print_latency(name);
+    uint32_t before_mean = (uint32_t) (hp.latency_total_us / hp.reports);
+
+    snprintf(name, sizeof(name), "%u/s, events, 1ms", rates[i]);
+    ok &= simulate(rates[i], 1000, 0);
+    print_latency(name);
+    // A fraction of the latency, and under two polls unless input comes
+    // faster than the host takes reports
+    ok &= hp.latency_total_us / hp.reports < before_mean / 4;
+    if (rates[i] < 1000) ok &= hp.latency_max_us < 2000;
+  }
+  result("every change reaches the host, sooner", ok);
+}
+
+int main(void)
+{
+  stdio_init_all();
+  printf("HID pipeline test\n");
+
+  test_reports();
+  bench();
+
+  printf(failures ? "FAILED\n" : "All good\n");
+  return failures ? 1 : 0;
+}
@@ -29,8 +29,10 @@
 
 #include "bsp/board.h"
 #include "tusb.h"
+#include "pico/time.h"
 
 #include "usb_descriptors.h"
+#include "hid_pipeline.h"
 
 //--------------------------------------------------------------------+
 // MACRO CONSTANT TYPEDEF PROTYPES
@@ -49,13 +51,19 @@ enum  {
 
 static uint32_t blink_interval_ms = BLINK_NOT_MOUNTED;
 
+// Input events in, reports out
+static hid_pipeline_t hid_pipe;
+
 void led_blinking_task(void);
+void input_task(void);
 void hid_task(void);
+void latency_print_task(void);
 
 /*------------- MAIN -------------*/
 int main(void)
 {
   board_init();
+  hid_pipeline_init(&hid_pipe);
   tusb_init();
 
   while (1)
@@ -63,7 +71,9 @@ int main(void)
     tud_task(); // tinyusb device task
     led_blinking_task();
 
+    input_task();
     hid_task();
+    latency_print_task();
   }
 
   return 0;
@@ -77,6 +87,8 @@ int main(void)
 void tud_mount_cb(void)
 {
   blink_interval_ms = BLINK_MOUNTED;
+  // The host starts with nothing pressed, and no report in flight
+  hid_pipeline_init(&hid_pipe);
 }
 
 // Invoked when device is unmounted
@@ -104,106 +116,52 @@ void tud_resume_cb(void)
 // USB HID
 //--------------------------------------------------------------------+
 
-static void send_hid_report(uint8_t report_id, uint32_t btn)
+static bool send_hid_report(hid_report_t *report)
 {
-  // skip if hid is not ready yet
-  if ( !tud_hid_ready() ) return;
-
-  switch(report_id)
+  switch(report->report_id)
   {
     case REPORT_ID_KEYBOARD:
-    {
-      // use to avoid send multiple consecutive zero report for keyboard
-      static bool has_keyboard_key = false;
-
-      if ( btn )
-      {
-        uint8_t keycode[6] = { 0 };
-        keycode[0] = HID_KEY_A;
-
-        tud_hid_keyboard_report(REPORT_ID_KEYBOARD, 0, keycode);
-        has_keyboard_key = true;
-      }else
-      {
-        // send empty key report if previously has key pressed
-        if (has_keyboard_key) tud_hid_keyboard_report(REPORT_ID_KEYBOARD, 0, NULL);
-        has_keyboard_key = false;
-      }
-    }
-    break;
+      return tud_hid_keyboard_report(REPORT_ID_KEYBOARD, report->keyboard.modifier, report->keyboard.keycode);
 
     case REPORT_ID_MOUSE:
-    {
-      int8_t const delta = 5;
-
-      // no button, right + down, no scroll, no pan
-      tud_hid_mouse_report(REPORT_ID_MOUSE, 0x00, delta, delta, 0, 0);
-    }
-    break;
+      return tud_hid_mouse_report(REPORT_ID_MOUSE, report->mouse.buttons, report->mouse.x, report->mouse.y,
+                                  report->mouse.wheel, report->mouse.pan);
 
     case REPORT_ID_CONSUMER_CONTROL:
-    {
-      // use to avoid send multiple consecutive zero report
-      static bool has_consumer_key = false;
-
-      if ( btn )
-      {
-        // volume down
-        uint16_t volume_down = HID_USAGE_CONSUMER_VOLUME_DECREMENT;
-        tud_hid_report(REPORT_ID_CONSUMER_CONTROL, &volume_down, 2);
-        has_consumer_key = true;
-      }else
-      {
-        // send empty key report (release key) if previously has key pressed
-        uint16_t empty_key = 0;
-        if (has_consumer_key) tud_hid_report(REPORT_ID_CONSUMER_CONTROL, &empty_key, 2);
-        has_consumer_key = false;
-      }
-    }
-    break;
+      return tud_hid_report(REPORT_ID_CONSUMER_CONTROL, &report->consumer, 2);
 
     case REPORT_ID_GAMEPAD:
     {
-      // use to avoid send multiple consecutive zero report for keyboard
-      static bool has_gamepad_key = false;
-
-      hid_gamepad_report_t report =
+      hid_gamepad_report_t gamepad =
       {
         .x   = 0, .y = 0, .z = 0, .rz = 0, .rx = 0, .ry = 0,
-        .hat = 0, .buttons = 0
+        .hat = report->gamepad.hat, .buttons = report->gamepad.buttons
       };
-
-      if ( btn )
-      {
-        report.hat = GAMEPAD_HAT_UP;
-        report.buttons = GAMEPAD_BUTTON_A;
-        tud_hid_report(REPORT_ID_GAMEPAD, &report, sizeof(report));
-
-        has_gamepad_key = true;
-      }else
-      {
-        report.hat = GAMEPAD_HAT_CENTERED;
-        report.buttons = 0;
-        if (has_gamepad_key) tud_hid_report(REPORT_ID_GAMEPAD, &report, sizeof(report));
-        has_gamepad_key = false;
-      }
+      return tud_hid_report(REPORT_ID_GAMEPAD, &gamepad, sizeof(gamepad));
     }
-    break;
 
-    default: break;
+    default: return false;
   }
 }
 
-// Every 10ms, we will sent 1 report for each HID profile (keyboard, mouse etc ..)
-// tud_hid_report_complete_cb() is used to send the next report after previous one is complete
-void hid_task(void)
+static void push_event(uint8_t type, bool pressed, uint16_t code, int16_t dx, int16_t dy)
 {
-  // Poll every 10ms
-  const uint32_t interval_ms = 10;
-  static uint32_t start_ms = 0;
+  hid_event_t ev = { .time_us = time_us_32(), .type = type, .pressed = pressed, .code = code, .dx = dx, .dy = dy };
+  hid_pipeline_push(&hid_pipe, &ev);
+}
 
-  if ( board_millis() - start_ms < interval_ms) return; // not enough time
-  start_ms += interval_ms;
+// Every 1ms, look at the button, and queue an event for each report which
+// it changes: key A, volume down, gamepad A and hat up while it is held.
+// The mouse moves right and down, 5 every 10ms.
+void input_task(void)
+{
+  static uint32_t last_us = 0;
+  static uint32_t last_move_us = 0;
+  static uint32_t last_btn = 0;
+
+  uint32_t const now_us = time_us_32();
+  if ( now_us - last_us < 1000 ) return; // not enough time
+  last_us = now_us;
 
   uint32_t const btn = board_button_read();
 
@@ -213,10 +171,71 @@ void hid_task(void)
     // Wake up host if we are in suspend mode
     // and REMOTE_WAKEUP feature is enabled by host
     tud_remote_wakeup();
-  }else
+  }
+
+  // Nothing to report to until the host is ready
+  if ( !tud_ready() )
+  {
+    last_btn = btn;
+    return;
+  }
+
+  if ( btn != last_btn )
+  {
+    bool const pressed = btn != 0;
+    push_event(HID_EVENT_KEY, pressed, HID_KEY_A, 0, 0);
+    push_event(HID_EVENT_CONSUMER, pressed, HID_USAGE_CONSUMER_VOLUME_DECREMENT, 0, 0);
+    push_event(HID_EVENT_GAMEPAD_BUTTON, pressed, 0, 0, 0); // GAMEPAD_BUTTON_A
+    push_event(HID_EVENT_GAMEPAD_HAT, false, pressed ? GAMEPAD_HAT_UP : GAMEPAD_HAT_CENTERED, 0, 0);
+    last_btn = btn;
+  }
+
+  if ( now_us - last_move_us >= 10000 )
+  {
+    push_event(HID_EVENT_MOUSE_MOVE, false, 0, 5, 5);
+    last_move_us = now_us;
+  }
+}
+
+// Send a report whenever there is one and the endpoint is free. The host
+// polls the endpoint every 1ms, so input reaches it within a frame or two.
+void hid_task(void)
+{
+  // skip if hid is not ready yet
+  if ( !tud_hid_ready() ) return;
+
+  hid_report_t report;
+  if ( hid_pipeline_next(&hid_pipe, &report) && !send_hid_report(&report) )
+  {
+    hid_pipeline_report_dropped(&hid_pipe);
+  }
+}
+
+// Every 10s, print how long input took to reach the host
+void latency_print_task(void)
+{
+  static uint32_t start_ms = 0;
+  static uint32_t last_reports = 0;
+
+  if ( board_millis() - start_ms < 10000 ) return; // not enough time
+  start_ms += 10000;
+
+  uint32_t const reports = hid_pipe.reports;
+  if ( reports == last_reports ) return;
+  last_reports = reports;
+
+  printf("%lu reports, latency mean %lu us, max %lu us, %lu events dropped\n", (unsigned long) reports,
+         (unsigned long) (hid_pipe.latency_total_us / reports), (unsigned long) hid_pipe.latency_max_us,
+         (unsigned long) hid_pipe.events_dropped);
+  for (uint i = 0; i < HID_LATENCY_BUCKETS; i++)
   {
-    // Send the 1st of report chain, the rest will be sent by tud_hid_report_complete_cb()
-    send_hid_report(REPORT_ID_KEYBOARD, btn);
+    if ( i < HID_LATENCY_BUCKETS - 1 )
+    {
+      printf("  < %5u us: %lu\n", HID_LATENCY_BUCKET_US << i, (unsigned long) hid_pipe.latency_hist[i]);
+    }else
+    {
+      printf("  longer:    %lu\n", (unsigned long) hid_pipe.latency_hist[i]);
+    }
   }
 }
 
@@ -226,14 +245,13 @@ void hid_task(void)
 void tud_hid_report_complete_cb(uint8_t instance, uint8_t const* report, uint8_t len)
 {
   (void) instance;
+  (void) report;
   (void) len;
 
-  uint8_t next_report_id = report[0] + 1;
+  hid_pipeline_report_done(&hid_pipe, time_us_32());
 
-  if (next_report_id < REPORT_ID_COUNT)
-  {
-    send_hid_report(next_report_id, board_button_read());
-  }
+  // Have the next report ready for the host's next poll
+  hid_task();
 }
 
 // Invoked when received GET_REPORT control request
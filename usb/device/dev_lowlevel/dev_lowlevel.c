@@ -25,6 +25,15 @@
 
 // Device descriptors
 #include "dev_lowlevel.h"
+// For messages from the interrupt handler
+#include "usb_trace.h"
+
+#if DEV_LOWLEVEL_STREAM
+// EP2 IN sends from a ring, which the ADC fills through DMA
+#include "usb_stream.h"
+#include "hardware/adc.h"
+#include "hardware/dma.h"
+#endif
 
 #define usb_hw_set hw_set_alias(usb_hw)
 #define usb_hw_clear hw_clear_alias(usb_hw)
@@ -33,7 +42,9 @@
 // later on
 void ep0_in_handler(uint8_t *buf, uint16_t len);
 void ep0_out_handler(uint8_t *buf, uint16_t len);
+#if !DEV_LOWLEVEL_STREAM
 void ep1_out_handler(uint8_t *buf, uint16_t len);
+#endif
 void ep2_in_handler(uint8_t *buf, uint16_t len);
 
 // Global device address
@@ -44,6 +55,15 @@ static volatile bool configured = false;
 // Global data buffer for EP0
 static uint8_t ep0_buf[64];
 
+// The endpoints by their BUFF_STATUS bit, filled in by usb_setup_endpoints()
+static usb_buf_status_table_t buf_status_table;
+
+#if DEV_LOWLEVEL_STREAM
+static usb_stream_t stream;
+// Set once the stream is set up, for the interrupt handler
+static volatile bool stream_running = false;
+#endif
+
 // Struct defining the device configuration
 static struct usb_device_configuration dev_config = {
         .device_descriptor = &device_descriptor,
@@ -68,22 +88,27 @@ static struct usb_device_configuration dev_config = {
                         // EP0 in and out share a data buffer
                         .data_buffer = &usb_dpram->ep0_buf_a[0],
                 },
+#if !DEV_LOWLEVEL_STREAM
+                // The stream only sends, so has no EP1 OUT
                 {
                         .descriptor = &ep1_out,
                         .handler = &ep1_out_handler,
                         // EP1 starts at offset 0 for endpoint control
                         .endpoint_control = &usb_dpram->ep_ctrl[0].out,
                         .buffer_control = &usb_dpram->ep_buf_ctrl[1].out,
-                        // First free EPX buffer
+                        // First two free EPX buffers
                         .data_buffer = &usb_dpram->epx_data[0 * 64],
+                        .double_buffered = true,
                 },
+#endif
                 {
                         .descriptor = &ep2_in,
                         .handler = &ep2_in_handler,
                         .endpoint_control = &usb_dpram->ep_ctrl[1].in,
                         .buffer_control = &usb_dpram->ep_buf_ctrl[2].in,
-                        // Second free EPX buffer
-                        .data_buffer = &usb_dpram->epx_data[1 * 64],
+                        // Next two free EPX buffers
+                        .data_buffer = &usb_dpram->epx_data[2 * 64],
+                        .double_buffered = true,
                 }
         }
 };
@@ -131,47 +156,18 @@ uint8_t usb_prepare_string_descriptor(const unsigned char *str) {
     return bLength;
 }
 
-/**
- * @brief Take a buffer pointer located in the USB RAM and return as an offset of the RAM.
- *
- * @param buf
- * @return uint32_t
- */
-static inline uint32_t usb_buffer_offset(volatile uint8_t *buf) {
-    return (uint32_t) buf ^ (uint32_t) usb_dpram;
-}
-
-/**
- * @brief Set up the endpoint control register for an endpoint (if applicable. Not valid for EP0).
- *
- * @param ep
- */
-void usb_setup_endpoint(const struct usb_endpoint_configuration *ep) {
-    printf("Set up endpoint 0x%x with buffer address 0x%p\n", ep->descriptor->bEndpointAddress, ep->data_buffer);
-
-    // EP0 doesn't have one so return if that is the case
-    if (!ep->endpoint_control) {
-        return;
-    }
-
-    // Get the data buffer as an offset of the USB controller's DPRAM
-    uint32_t dpram_offset = usb_buffer_offset(ep->data_buffer);
-    uint32_t reg = EP_CTRL_ENABLE_BITS
-                   | EP_CTRL_INTERRUPT_PER_BUFFER
-                   | (ep->descriptor->bmAttributes << EP_CTRL_BUFFER_TYPE_LSB)
-                   | dpram_offset;
-    *ep->endpoint_control = reg;
-}
-
 /**
  * @brief Set up the endpoint control register for each endpoint.
  *
  */
 void usb_setup_endpoints() {
-    const struct usb_endpoint_configuration *endpoints = dev_config.endpoints;
+    struct usb_endpoint_configuration *endpoints = dev_config.endpoints;
     for (int i = 0; i < USB_NUM_ENDPOINTS; i++) {
         if (endpoints[i].descriptor && endpoints[i].handler) {
+            printf("Set up endpoint 0x%x with buffer address 0x%p%s\n", endpoints[i].descriptor->bEndpointAddress,
+                   endpoints[i].data_buffer, endpoints[i].double_buffered ? " (double buffered)" : "");
             usb_setup_endpoint(&endpoints[i]);
+            buf_status_table[usb_buf_status_bit(&endpoints[i])] = &endpoints[i];
         }
     }
 }
@@ -208,6 +204,11 @@ void usb_device_init() {
     usb_hw->inte = USB_INTS_BUFF_STATUS_BITS |
                    USB_INTS_BUS_RESET_BITS |
                    USB_INTS_SETUP_REQ_BITS;
+#if DEV_LOWLEVEL_STREAM
+    // And for the NAKs the stream's endpoint sends when it has nothing to
+    // send (which it only reports while the stream is starved)
+    usb_hw_set->inte = USB_INTS_EP_STALL_NAK_BITS;
+#endif
 
     // Set up endpoints (endpoint control registers)
     // described by device configuration
@@ -217,49 +218,6 @@ void usb_device_init() {
     usb_hw_set->sie_ctrl = USB_SIE_CTRL_PULLUP_EN_BITS;
 }
 
-/**
- * @brief Given an endpoint configuration, returns true if the endpoint
- * is transmitting data to the host (i.e. is an IN endpoint)
- *
- * @param ep, the endpoint configuration
- * @return true
- * @return false
- */
-static inline bool ep_is_tx(struct usb_endpoint_configuration *ep) {
-    return ep->descriptor->bEndpointAddress & USB_DIR_IN;
-}
-
-/**
- * @brief Starts a transfer on a given endpoint.
- *
- * @param ep, the endpoint configuration.
- * @param buf, the data buffer to send. Only applicable if the endpoint is TX
- * @param len, the length of the data in buf (this example limits max len to one packet - 64 bytes)
- */
-void usb_start_transfer(struct usb_endpoint_configuration *ep, uint8_t *buf, uint16_t len) {
-    // We are asserting that the length is <= 64 bytes for simplicity of the example.
-    // For multi packet transfers see the tinyusb port.
-    assert(len <= 64);
-
-    printf("Start transfer of len %d on ep addr 0x%x\n", len, ep->descriptor->bEndpointAddress);
-
-    // Prepare buffer control register value
-    uint32_t val = len | USB_BUF_CTRL_AVAIL;
-
-    if (ep_is_tx(ep)) {
-        // Need to copy the data from the user buffer to the usb memory
-        memcpy((void *) ep->data_buffer, (void *) buf, len);
-        // Mark as full
-        val |= USB_BUF_CTRL_FULL;
-    }
-
-    // Set pid and flip for next transfer
-    val |= ep->next_pid ? USB_BUF_CTRL_DATA1_PID : USB_BUF_CTRL_DATA0_PID;
-    ep->next_pid ^= 1u;
-
-    *ep->buffer_control = val;
-}
-
 /**
  * @brief Send device descriptor to host
  *
@@ -358,7 +316,7 @@ void usb_set_device_address(volatile struct usb_setup_packet *pkt) {
     // Set address is a bit of a strange case because we have to send a 0 length status packet first with
     // address 0
     dev_addr = (pkt->wValue & 0xff);
-    printf("Set address %d\r\n", dev_addr);
+    usb_trace("Set address %d\r\n", dev_addr, 0);
     // Will set address in the callback phase
     should_set_address = true;
     usb_acknowledge_out_request();
@@ -372,7 +330,7 @@ void usb_set_device_address(volatile struct usb_setup_packet *pkt) {
  */
 void usb_set_device_configuration(volatile struct usb_setup_packet *pkt) {
     // Only one configuration so just acknowledge the request
-    printf("Device Enumerated\r\n");
+    usb_trace("Device Enumerated\r\n", 0, 0);
     usb_acknowledge_out_request();
     configured = true;
 }
@@ -386,6 +344,11 @@ void usb_handle_setup_packet(void) {
     uint8_t req_direction = pkt->bmRequestType;
     uint8_t req = pkt->bRequest;
 
+    // A SETUP packet starts a new control transfer, whatever became of the
+    // last one
+    usb_cancel_transfer(usb_get_endpoint_configuration(EP0_IN_ADDR));
+    usb_cancel_transfer(usb_get_endpoint_configuration(EP0_OUT_ADDR));
+
     // Reset PID to 1 for EP0 IN
     usb_get_endpoint_configuration(EP0_IN_ADDR)->next_pid = 1u;
 
@@ -396,7 +359,7 @@ void usb_handle_setup_packet(void) {
             usb_set_device_configuration(pkt);
         } else {
             usb_acknowledge_out_request();
-            printf("Other OUT request (0x%x)\r\n", pkt->bRequest);
+            usb_trace("Other OUT request (0x%x)\r\n", pkt->bRequest, 0);
         }
     } else if (req_direction == USB_DIR_IN) {
         if (req == USB_REQUEST_GET_DESCRIPTOR) {
@@ -405,59 +368,24 @@ void usb_handle_setup_packet(void) {
             switch (descriptor_type) {
                 case USB_DT_DEVICE:
                     usb_handle_device_descriptor();
-                    printf("GET DEVICE DESCRIPTOR\r\n");
+                    usb_trace("GET DEVICE DESCRIPTOR\r\n", 0, 0);
                     break;
 
                 case USB_DT_CONFIG:
                     usb_handle_config_descriptor(pkt);
-                    printf("GET CONFIG DESCRIPTOR\r\n");
+                    usb_trace("GET CONFIG DESCRIPTOR\r\n", 0, 0);
                     break;
 
                 case USB_DT_STRING:
                     usb_handle_string_descriptor(pkt);
-                    printf("GET STRING DESCRIPTOR\r\n");
+                    usb_trace("GET STRING DESCRIPTOR\r\n", 0, 0);
                     break;
 
                 default:
-                    printf("Unhandled GET_DESCRIPTOR type 0x%x\r\n", descriptor_type);
+                    usb_trace("Unhandled GET_DESCRIPTOR type 0x%x\r\n", descriptor_type, 0);
             }
         } else {
-            printf("Other IN request (0x%x)\r\n", pkt->bRequest);
-        }
-    }
-}
-
-/**
- * @brief Notify an endpoint that a transfer has completed.
- *
- * @param ep, the endpoint to notify.
- */
-static void usb_handle_ep_buff_done(struct usb_endpoint_configuration *ep) {
-    uint32_t buffer_control = *ep->buffer_control;
-    // Get the transfer length for this endpoint
-    uint16_t len = buffer_control & USB_BUF_CTRL_LEN_MASK;
-
-    // Call that endpoints buffer done handler
-    ep->handler((uint8_t *) ep->data_buffer, len);
-}
-
-/**
- * @brief Find the endpoint configuration for a specified endpoint number and
- * direction and notify it that a transfer has completed.
- *
- * @param ep_num
- * @param in
- */
-static void usb_handle_buff_done(uint ep_num, bool in) {
-    uint8_t ep_addr = ep_num | (in ? USB_DIR_IN : 0);
-    printf("EP %d (in = %d) done\n", ep_num, in);
-    for (uint i = 0; i < USB_NUM_ENDPOINTS; i++) {
-        struct usb_endpoint_configuration *ep = &dev_config.endpoints[i];
-        if (ep->descriptor && ep->handler) {
-            if (ep->descriptor->bEndpointAddress == ep_addr) {
-                usb_handle_ep_buff_done(ep);
-                return;
-            }
+            usb_trace("Other IN request (0x%x)\r\n", pkt->bRequest, 0);
         }
     }
 }
@@ -469,19 +397,9 @@ static void usb_handle_buff_done(uint ep_num, bool in) {
  */
 static void usb_handle_buff_status() {
     uint32_t buffers = usb_hw->buf_status;
-    uint32_t remaining_buffers = buffers;
-
-    uint bit = 1u;
-    for (uint i = 0; remaining_buffers && i < USB_NUM_ENDPOINTS * 2; i++) {
-        if (remaining_buffers & bit) {
-            // clear this in advance
-            usb_hw_clear->buf_status = bit;
-            // IN transfer for even i, OUT transfer for odd i
-            usb_handle_buff_done(i >> 1u, !(i & 1u));
-            remaining_buffers &= ~bit;
-        }
-        bit <<= 1u;
-    }
+    // clear these in advance
+    usb_hw_clear->buf_status = buffers;
+    usb_dispatch_buf_status(buf_status_table, buffers);
 }
 
 /**
@@ -508,9 +426,27 @@ void isr_usbctrl(void) {
         usb_handle_buff_status();
     }
 
+#if DEV_LOWLEVEL_STREAM
+    // The stream's endpoint has NAKed the host, for want of data
+    if (status & USB_INTS_EP_STALL_NAK_BITS) {
+        handled |= USB_INTS_EP_STALL_NAK_BITS;
+        uint32_t naks = usb_hw->ep_nak_stall_status;
+        usb_hw_clear->ep_nak_stall_status = naks;
+        for (; naks; naks &= naks - 1) {
+            usb_stream_nak(&stream);
+        }
+    }
+
+    // Send whatever the producer has added (it sets this interrupt pending
+    // when it adds some)
+    if (stream_running) {
+        usb_stream_poll(&stream);
+    }
+#endif
+
     // Bus is reset
     if (status & USB_INTS_BUS_RESET_BITS) {
-        printf("BUS RESET\n");
+        usb_trace("BUS RESET\n", 0, 0);
         handled |= USB_INTS_BUS_RESET_BITS;
         usb_hw_clear->sie_status = USB_SIE_STATUS_BUS_RESET_BITS;
         usb_bus_reset();
@@ -545,18 +481,146 @@ void ep0_out_handler(uint8_t *buf, uint16_t len) {
 }
 
 // Device specific functions
+#if DEV_LOWLEVEL_BENCH
+// EP1 OUT throws away what it receives, and EP2 IN sends the same data over
+// and over, each as fast as the host will go (see dev_lowlevel_bench.py)
+#define BENCH_TRANSFER_SIZE 4096
+
+static uint8_t bench_rx_buf[BENCH_TRANSFER_SIZE];
+static uint8_t bench_tx_buf[BENCH_TRANSFER_SIZE];
+static volatile uint32_t bench_rx_bytes, bench_tx_bytes;
+
+void ep1_out_handler(uint8_t *buf, uint16_t len) {
+    bench_rx_bytes += len;
+    usb_start_transfer(usb_get_endpoint_configuration(EP1_OUT_ADDR), bench_rx_buf, sizeof(bench_rx_buf));
+}
+
+void ep2_in_handler(uint8_t *buf, uint16_t len) {
+    bench_tx_bytes += len;
+    usb_start_transfer(usb_get_endpoint_configuration(EP2_IN_ADDR), bench_tx_buf, sizeof(bench_tx_buf));
+}
+
+static void bench(void) {
+    for (uint i = 0; i < sizeof(bench_tx_buf); i++) {
+        bench_tx_buf[i] = (uint8_t) i;
+    }
+    usb_start_transfer(usb_get_endpoint_configuration(EP1_OUT_ADDR), bench_rx_buf, sizeof(bench_rx_buf));
+    usb_start_transfer(usb_get_endpoint_configuration(EP2_IN_ADDR), bench_tx_buf, sizeof(bench_tx_buf));
+
+    uint32_t rx_bytes = 0, tx_bytes = 0;
+    while (1) {
+        sleep_ms(1000);
+        uint32_t rx = bench_rx_bytes, tx = bench_tx_bytes;
+        printf("OUT %u kB/s, IN %u kB/s\n", (rx - rx_bytes) / 1000, (tx - tx_bytes) / 1000);
+        rx_bytes = rx;
+        tx_bytes = tx;
+    }
+}
+#elif DEV_LOWLEVEL_STREAM
+// EP2 IN sends a continuous stream of ADC samples, 16 bits each at 400k
+// samples a second, as fast as the host takes them (see
+// dev_lowlevel_stream.py). A DMA channel fills the stream's ring a chunk at a
+// time, and transfers are sent straight from the ring. When the host falls
+// behind and the ring is full, chunks are dropped; when the ring is empty,
+// the host gets NAKs.
+#define STREAM_RING_SIZE (16 * 1024)
+#define STREAM_CHUNK_SIZE 1024
+#define STREAM_MAX_TRANSFER 4096
+#define STREAM_ADC_INPUT 0
+
+static uint8_t stream_ring[STREAM_RING_SIZE];
+// Where the ADC's samples go when there is no room for them in the ring
+static uint8_t stream_discard[STREAM_CHUNK_SIZE];
+static uint8_t *stream_chunk;
+static uint stream_dma_chan;
+
+void ep2_in_handler(uint8_t *buf, uint16_t len) {
+    usb_stream_transfer_done(&stream, len);
+}
+
+static void stream_dma_start(void) {
+    stream_chunk = usb_stream_reserve(&stream, STREAM_CHUNK_SIZE);
+    if (!stream_chunk) {
+        // No room: keep the ADC going, and throw this chunk away
+        usb_stream_overrun(&stream, STREAM_CHUNK_SIZE);
+        stream_chunk = stream_discard;
+    }
+    dma_channel_transfer_to_buffer_now(stream_dma_chan, stream_chunk, STREAM_CHUNK_SIZE / 2);
+}
+
+// A chunk is full: add it to the stream, and start on the next. The ADC's
+// FIFO holds four samples, so there are 10 us to do it in.
+static void stream_dma_handler(void) {
+    if (!dma_channel_get_irq1_status(stream_dma_chan)) {
+        return;
+    }
+    dma_channel_acknowledge_irq1(stream_dma_chan);
+    if (stream_chunk != stream_discard) {
+        usb_stream_commit(&stream, STREAM_CHUNK_SIZE);
+        // Have the USB interrupt handler send it
+        irq_set_pending(USBCTRL_IRQ);
+    }
+    stream_dma_start();
+}
+
+static void stream_adc(void) {
+    usb_stream_init(&stream, usb_get_endpoint_configuration(EP2_IN_ADDR), stream_ring, sizeof(stream_ring),
+                    STREAM_MAX_TRANSFER);
+    stream_running = true;
+
+    // Free running into its FIFO, with DREQ. A conversion every 120 cycles
+    // of the 48 MHz ADC clock is 400k samples a second, or 800 kB/s: flat
+    // out, at 500k, would be 1000 kB/s, more than a full speed bulk endpoint
+    // gets. usb_stream_test shows the ring keeping up at up to 900 kB/s,
+    // with the host away for 2 ms in every 10.
+    adc_init();
+    adc_gpio_init(26 + STREAM_ADC_INPUT);
+    adc_select_input(STREAM_ADC_INPUT);
+    adc_fifo_setup(true, true, 1, false, false);
+    adc_set_clkdiv(119);
+
+    stream_dma_chan = dma_claim_unused_channel(true);
+    dma_channel_config c = dma_channel_get_default_config(stream_dma_chan);
+    channel_config_set_transfer_data_size(&c, DMA_SIZE_16);
+    channel_config_set_read_increment(&c, false);
+    channel_config_set_write_increment(&c, true);
+    channel_config_set_dreq(&c, DREQ_ADC);
+    dma_channel_configure(stream_dma_chan, &c, NULL, &adc_hw->fifo, 0, false);
+    dma_channel_set_irq1_enabled(stream_dma_chan, true);
+    irq_add_shared_handler(DMA_IRQ_1, stream_dma_handler, PICO_SHARED_IRQ_HANDLER_DEFAULT_ORDER_PRIORITY);
+    irq_set_enabled(DMA_IRQ_1, true);
+
+    stream_dma_start();
+    adc_run(true);
+
+    usb_stream_stats_t last = stream.stats;
+    while (1) {
+        sleep_ms(1000);
+        usb_stream_stats_t now = stream.stats;
+        printf("%u kB/s, %u underruns, %u NAKs, %u kB dropped\n", (now.bytes - last.bytes) / 1000,
+               now.underruns - last.underruns, now.naks - last.naks, (now.overruns - last.overruns) / 1000);
+        last = now;
+    }
+}
+#else
+// The host's transfer is received straight into this buffer, a packet at a
+// time, and sent back from it. The transfer ends with a short packet, or when
+// the buffer is full.
+static uint8_t loopback_buf[1024];
+
 void ep1_out_handler(uint8_t *buf, uint16_t len) {
-    printf("RX %d bytes from host\n", len);
+    usb_trace("RX %d bytes from host\n", len, 0);
     // Send data back to host
     struct usb_endpoint_configuration *ep = usb_get_endpoint_configuration(EP2_IN_ADDR);
     usb_start_transfer(ep, buf, len);
 }
 
 void ep2_in_handler(uint8_t *buf, uint16_t len) {
-    printf("Sent %d bytes to host\n", len);
+    usb_trace("Sent %d bytes to host\n", len, 0);
     // Get ready to rx again from host
-    usb_start_transfer(usb_get_endpoint_configuration(EP1_OUT_ADDR), NULL, 64);
+    usb_start_transfer(usb_get_endpoint_configuration(EP1_OUT_ADDR), loopback_buf, sizeof(loopback_buf));
 }
+#endif
 
 int main(void) {
     stdio_init_all();
@@ -565,16 +629,23 @@ int main(void) {
 
     // Wait until configured
     while (!configured) {
-        tight_loop_contents();
+        usb_trace_print();
     }
 
+#if DEV_LOWLEVEL_BENCH
+    bench();
+#elif DEV_LOWLEVEL_STREAM
+    stream_adc();
+#else
     // Get ready to rx from host
-    usb_start_transfer(usb_get_endpoint_configuration(EP1_OUT_ADDR), NULL, 64);
+    usb_start_transfer(usb_get_endpoint_configuration(EP1_OUT_ADDR), loopback_buf, sizeof(loopback_buf));
 
-    // Everything is interrupt driven so just loop here
+    // Everything is interrupt driven so just print what the interrupt
+    // handler has to say
     while (1) {
-        tight_loop_contents();
+        usb_trace_print();
     }
+#endif
 
     return 0;
 }
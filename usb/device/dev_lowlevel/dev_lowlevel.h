@@ -8,22 +8,7 @@
 #define DEV_LOWLEVEL_H_
 
 #include "usb_common.h"
-
-// Struct in which we keep the endpoint configuration
-typedef void (*usb_ep_handler)(uint8_t *buf, uint16_t len);
-struct usb_endpoint_configuration {
-    const struct usb_endpoint_descriptor *descriptor;
-    usb_ep_handler handler;
-
-    // Pointers to endpoint + buffer control registers
-    // in the USB controller DPSRAM
-    volatile uint32_t *endpoint_control;
-    volatile uint32_t *buffer_control;
-    volatile uint8_t *data_buffer;
-
-    // Toggle after each packet (unless replying to a SETUP)
-    uint8_t next_pid;
-};
+#include "usb_transfer.h"
 
 // Struct in which we keep the device configuration
 struct usb_device_configuration {
@@ -83,13 +68,18 @@ static const struct usb_interface_descriptor interface_descriptor = {
         .bDescriptorType    = USB_DT_INTERFACE,
         .bInterfaceNumber   = 0,
         .bAlternateSetting  = 0,
+#if DEV_LOWLEVEL_STREAM
+        .bNumEndpoints      = 1,    // Interface has just EP2 IN
+#else
         .bNumEndpoints      = 2,    // Interface has 2 endpoints
+#endif
         .bInterfaceClass    = 0xff, // Vendor specific endpoint
         .bInterfaceSubClass = 0,
         .bInterfaceProtocol = 0,
         .iInterface         = 0
 };
 
+#if !DEV_LOWLEVEL_STREAM
 static const struct usb_endpoint_descriptor ep1_out = {
         .bLength          = sizeof(struct usb_endpoint_descriptor),
         .bDescriptorType  = USB_DT_ENDPOINT,
@@ -98,6 +88,7 @@ static const struct usb_endpoint_descriptor ep1_out = {
         .wMaxPacketSize   = 64,
         .bInterval        = 0
 };
+#endif
 
 static const struct usb_endpoint_descriptor ep2_in = {
         .bLength          = sizeof(struct usb_endpoint_descriptor),
@@ -113,7 +104,9 @@ static const struct usb_configuration_descriptor config_descriptor = {
         .bDescriptorType = USB_DT_CONFIG,
         .wTotalLength    = (sizeof(config_descriptor) +
                             sizeof(interface_descriptor) +
+#if !DEV_LOWLEVEL_STREAM
                             sizeof(ep1_out) +
+#endif
                             sizeof(ep2_in)),
         .bNumInterfaces  = 1,
         .bConfigurationValue = 1, // Configuration 1
@@ -0,0 +1,70 @@
+#!/usr/bin/env python3
+
+#
+# Copyright (c) 2022 Raspberry Pi (Trading) Ltd.
+#
+# SPDX-License-Identifier: BSD-3-Clause
+#
+
+# Measures the bulk throughput of dev_lowlevel_bench, which throws away what
+# it receives on EP1 OUT and sends the same 4k over and over on EP2 IN.
+
+# sudo pip3 install pyusb
+
+import time
+
+import usb.core
+import usb.util
+
+SECONDS = 5
+TRANSFER_SIZE = 4096
+
+# find our device
+dev = usb.core.find(idVendor=0x0000, idProduct=0x0001)
+
+# was it found?
+if dev is None:
+    raise ValueError('Device not found')
+
+# get an endpoint instance
+cfg = dev.get_active_configuration()
+intf = cfg[(0, 0)]
+
+outep = usb.util.find_descriptor(
+    intf,
+    # match the first OUT endpoint
+    custom_match= \
+        lambda e: \
+            usb.util.endpoint_direction(e.bEndpointAddress) == \
+            usb.util.ENDPOINT_OUT)
+
+inep = usb.util.find_descriptor(
+    intf,
+    # match the first IN endpoint
+    custom_match= \
+        lambda e: \
+            usb.util.endpoint_direction(e.bEndpointAddress) == \
+            usb.util.ENDPOINT_IN)
+
+assert inep is not None
+assert outep is not None
+
+
+def measure(name, transfer):
+    total = 0
+    start = time.monotonic()
+    while time.monotonic() - start < SECONDS:
+        total += transfer()
+    print("{}: {:.0f} kB/s".format(name, total / (time.monotonic() - start) / 1000))
+
+
+# A whole number of the device's transfers, so each one ends when its buffer
+# is full
+out_data = bytes(TRANSFER_SIZE * 4)
+measure("OUT", lambda: outep.write(out_data))
+
+expected = bytes(i & 0xff for i in range(TRANSFER_SIZE))
+first = bytes(inep.read(TRANSFER_SIZE))
+if first != expected:
+    print("IN data MISMATCH")
+measure("IN", lambda: len(inep.read(TRANSFER_SIZE * 4)))
@@ -46,3 +46,13 @@ outep.write(test_string)
 from_device = inep.read(len(test_string))
 
 print("Device Says: {}".format(''.join([chr(x) for x in from_device])))
+
+# Transfers can be longer than a packet, up to the 1024 bytes of the device's
+# buffer. The device takes a short packet as the end of a transfer, so the
+# length should not be a multiple of 64 (unless it is 1024).
+test_data = bytes(i & 0xff for i in range(1000))
+outep.write(test_data)
+from_device = inep.read(len(test_data))
+
+print("Echoed {} of {} bytes: {}".format(len(from_device), len(test_data),
+                                         "ok" if bytes(from_device) == test_data else "MISMATCH"))
@@ -0,0 +1,60 @@
+#!/usr/bin/env python3
+
+#
+# Copyright (c) 2022 Raspberry Pi (Trading) Ltd.
+#
+# SPDX-License-Identifier: BSD-3-Clause
+#
+
+# Reads the stream of ADC samples which dev_lowlevel_stream sends on EP2 IN,
+# 16 bits each, little endian, and prints the rate they arrive at and their
+# range.
+
+# sudo pip3 install pyusb
+
+import array
+import time
+
+import usb.core
+import usb.util
+
+SECONDS = 5
+READ_SIZE = 16 * 1024
+
+# find our device
+dev = usb.core.find(idVendor=0x0000, idProduct=0x0001)
+
+# was it found?
+if dev is None:
+    raise ValueError('Device not found')
+
+# get an endpoint instance
+cfg = dev.get_active_configuration()
+intf = cfg[(0, 0)]
+
+inep = usb.util.find_descriptor(
+    intf,
+    # match the first IN endpoint
+    custom_match= \
+        lambda e: \
+            usb.util.endpoint_direction(e.bEndpointAddress) == \
+            usb.util.ENDPOINT_IN)
+
+assert inep is not None
+
+# Throw away what built up in the device's ring before we started reading
+inep.read(READ_SIZE)
+
+for second in range(SECONDS):
+    total = 0
+    low, high = 0xffff, 0
+    start = time.monotonic()
+    while time.monotonic() - start < 1:
+        data = inep.read(READ_SIZE)
+        samples = array.array('H', data[:len(data) & ~1])
+        if samples:
+            low = min(low, min(samples))
+            high = max(high, max(samples))
+        total += len(data)
+    print("{:.0f} kB/s, {:.0f}k samples/s, samples {} to {}".format(
+        total / (time.monotonic() - start) / 1000, total / 2 / (time.monotonic() - start) / 1000, low, high))
@@ -0,0 +1,70 @@
+/**
+ * Copyright (c) 2022 Raspberry Pi (Trading) Ltd.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+#ifndef _HARDWARE_STRUCTS_USB_H
+#define _HARDWARE_STRUCTS_USB_H
+
+#include "pico.h"
+
+// The USB controller's DPRAM for PICO_PLATFORM=host builds, with the same
+// layout and bits as on the device, so usb_transfer.c builds there unchanged.
+// usb_emu.c plays the part of the controller (and the host) on the other
+// side of it.
+
+#define USB_NUM_ENDPOINTS 16
+
+#define USB_DPRAM_SIZE 4096
+
+typedef struct {
+    // 4K of DPSRAM at beginning. Note this supports 8, 16, and 32 bit accesses
+    volatile uint8_t setup_packet[8]; // First 8 bytes are always for setup packets
+
+    // Starts at ep1
+    struct usb_device_dpram_ep_ctrl {
+        volatile uint32_t in;
+        volatile uint32_t out;
+    } ep_ctrl[USB_NUM_ENDPOINTS - 1];
+
+    // Starts at ep0
+    struct usb_device_dpram_ep_buf_ctrl {
+        volatile uint32_t in;
+        volatile uint32_t out;
+    } ep_buf_ctrl[USB_NUM_ENDPOINTS];
+
+    // EP0 buffers are fixed. Assumes single buffered mode for EP0
+    uint8_t ep0_buf_a[0x40];
+    uint8_t ep0_buf_b[0x40];
+
+    // Rest of DPRAM can be carved up as needed
+    uint8_t epx_data[USB_DPRAM_SIZE - 0x180];
+} usb_device_dpram_t;
+
+extern usb_device_dpram_t usb_emu_dpram;
+
+#define usb_dpram (&usb_emu_dpram)
+
+// Endpoint control register
+#define EP_CTRL_ENABLE_BITS (1u << 31u)
+#define EP_CTRL_DOUBLE_BUFFERED_BITS (1u << 30u)
+#define EP_CTRL_INTERRUPT_PER_BUFFER (1u << 29u)
+#define EP_CTRL_INTERRUPT_PER_DOUBLE_BUFFER (1u << 28u)
+#define EP_CTRL_INTERRUPT_ON_NAK (1u << 16u)
+#define EP_CTRL_INTERRUPT_ON_STALL (1u << 17u)
+#define EP_CTRL_BUFFER_TYPE_LSB 26u
+#define EP_CTRL_HOST_INTERRUPT_INTERVAL_LSB 16u
+
+// Buffer control register, one half per buffer
+#define USB_BUF_CTRL_FULL      0x00008000u
+#define USB_BUF_CTRL_LAST      0x00004000u
+#define USB_BUF_CTRL_DATA0_PID 0x00000000u
+#define USB_BUF_CTRL_DATA1_PID 0x00002000u
+#define USB_BUF_CTRL_SEL       0x00001000u
+#define USB_BUF_CTRL_STALL     0x00000800u
+#define USB_BUF_CTRL_AVAIL     0x00000400u
+#define USB_BUF_CTRL_LEN_MASK  0x000003FFu
+#define USB_BUF_CTRL_LEN_LSB   0
+
+#endif
@@ -0,0 +1,106 @@
+/**
+ * Copyright (c) 2022 Raspberry Pi (Trading) Ltd.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+#include <string.h>
+
+#include "usb_emu.h"
+
+usb_device_dpram_t usb_emu_dpram;
+uint32_t usb_emu_buf_status;
+uint32_t usb_emu_ep_nak_status;
+usb_emu_stats_t usb_emu_stats;
+
+// The controller's side of each endpoint: which buffer it is on, and the
+// data toggle the host expects next. [ep_num][0] is IN, [ep_num][1] is OUT.
+static struct {
+    uint8_t sel;
+    uint8_t pid;
+} eps[USB_NUM_ENDPOINTS][2];
+
+void usb_emu_reset(void) {
+    memset(&usb_emu_dpram, 0, sizeof(usb_emu_dpram));
+    memset(eps, 0, sizeof(eps));
+    memset(&usb_emu_stats, 0, sizeof(usb_emu_stats));
+    usb_emu_buf_status = 0;
+    usb_emu_ep_nak_status = 0;
+}
+
+// Find the buffer control half and the buffer the controller is on, and the
+// bit it sets when done with it
+static volatile uint16_t *current_buffer(uint ep_num, bool out, uint8_t **buf) {
+    hard_assert(ep_num > 0 && ep_num < USB_NUM_ENDPOINTS);
+    struct usb_device_dpram_ep_ctrl *ctrl = &usb_emu_dpram.ep_ctrl[ep_num - 1];
+    uint32_t ep_ctrl = out ? ctrl->out : ctrl->in;
+    hard_assert(ep_ctrl & EP_CTRL_ENABLE_BITS);
+    volatile uint32_t *buf_ctrl = out ? &usb_emu_dpram.ep_buf_ctrl[ep_num].out : &usb_emu_dpram.ep_buf_ctrl[ep_num].in;
+    volatile uint16_t *half = (volatile uint16_t *) buf_ctrl;
+
+    if (half[0] & USB_BUF_CTRL_SEL) {
+        half[0] &= (uint16_t) ~USB_BUF_CTRL_SEL;
+        eps[ep_num][out].sel = 0;
+    }
+    uint sel = (ep_ctrl & EP_CTRL_DOUBLE_BUFFERED_BITS) ? eps[ep_num][out].sel : 0;
+    *buf = (uint8_t *) &usb_emu_dpram + (ep_ctrl & 0xffc0u) + sel * 64;
+    return &half[sel];
+}
+
+static void buffer_done(uint ep_num, bool out) {
+    struct usb_device_dpram_ep_ctrl *ctrl = &usb_emu_dpram.ep_ctrl[ep_num - 1];
+    if ((out ? ctrl->out : ctrl->in) & EP_CTRL_DOUBLE_BUFFERED_BITS)
+        eps[ep_num][out].sel ^= 1u;
+    eps[ep_num][out].pid ^= 1u;
+    usb_emu_buf_status |= 1u << (ep_num * 2 + out);
+    ++usb_emu_stats.packets;
+}
+
+static void nak(uint ep_num, bool out) {
+    struct usb_device_dpram_ep_ctrl *ctrl = &usb_emu_dpram.ep_ctrl[ep_num - 1];
+    if ((out ? ctrl->out : ctrl->in) & EP_CTRL_INTERRUPT_ON_NAK)
+        usb_emu_ep_nak_status |= 1u << (ep_num * 2 + out);
+    ++usb_emu_stats.naks;
+}
+
+static bool check_pid(uint ep_num, bool out, uint16_t buf_ctrl) {
+    bool ok = !!(buf_ctrl & USB_BUF_CTRL_DATA1_PID) == eps[ep_num][out].pid;
+    if (!ok)
+        ++usb_emu_stats.errors;
+    return ok;
+}
+
+int usb_emu_in(uint ep_num, uint8_t *data) {
+    uint8_t *buf;
+    volatile uint16_t *half = current_buffer(ep_num, false, &buf);
+    uint16_t val = *half;
+    if (!(val & USB_BUF_CTRL_AVAIL)) {
+        nak(ep_num, false);
+        return -1;
+    }
+    uint len = val & USB_BUF_CTRL_LEN_MASK;
+    if (!(val & USB_BUF_CTRL_FULL) || len > 64)
+        ++usb_emu_stats.errors;
+    check_pid(ep_num, false, val);
+    memcpy(data, buf, MIN(len, 64));
+    *half = val & (uint16_t) ~(USB_BUF_CTRL_AVAIL | USB_BUF_CTRL_FULL);
+    buffer_done(ep_num, false);
+    return (int) len;
+}
+
+bool usb_emu_out(uint ep_num, const uint8_t *data, uint len) {
+    uint8_t *buf;
+    volatile uint16_t *half = current_buffer(ep_num, true, &buf);
+    uint16_t val = *half;
+    if (!(val & USB_BUF_CTRL_AVAIL)) {
+        nak(ep_num, true);
+        return false;
+    }
+    if ((val & USB_BUF_CTRL_FULL) || len > (val & USB_BUF_CTRL_LEN_MASK))
+        ++usb_emu_stats.errors;
+    check_pid(ep_num, true, val);
+    memcpy(buf, data, MIN(len, 64));
+    *half = (uint16_t) ((val & ~(USB_BUF_CTRL_AVAIL | USB_BUF_CTRL_LEN_MASK)) | USB_BUF_CTRL_FULL | len);
+    buffer_done(ep_num, true);
+    return true;
+}
@@ -0,0 +1,55 @@
+/**
+ * Copyright (c) 2022 Raspberry Pi (Trading) Ltd.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+#ifndef USB_EMU_H_
+#define USB_EMU_H_
+
+#include "pico.h"
+#include "hardware/structs/usb.h"
+
+// ----------------------------------------------------------------------------
+// A model of the USB controller's side of the DPRAM, for PICO_PLATFORM=host
+// builds: the test plays the USB host, and asks for or sends one packet at a
+// time, as the bus would.
+//
+// The model follows the buffer control registers as the datasheet describes:
+// the controller only takes a buffer whose AVAIL bit is set, clears AVAIL
+// when it is done with it (and FULL, for IN; for OUT it sets FULL and the
+// length), and sets the endpoint's bit in buf_status. For a double buffered
+// endpoint it takes the two buffers in turn, starting from buffer 0 after
+// SEL is written. It NAKs when the buffer it is on is not available, and
+// counts as an error anything the controller would not have been given:
+// a PID out of step with the data toggle, an IN buffer not marked FULL, or a
+// packet bigger than the buffer. Control transfers and EP0 are not modelled.
+
+typedef struct {
+    uint32_t packets;
+    uint32_t naks;
+    uint32_t errors;
+} usb_emu_stats_t;
+
+// Bits set by the controller, as in the BUFF_STATUS register: bit
+// 2 * ep_num for IN, bit 2 * ep_num + 1 for OUT
+extern uint32_t usb_emu_buf_status;
+
+// Bits set, in the same layout, when the controller NAKs an endpoint whose
+// EP_CTRL_INTERRUPT_ON_NAK is set, as in the EP_STATUS_STALL_NAK register
+extern uint32_t usb_emu_ep_nak_status;
+
+extern usb_emu_stats_t usb_emu_stats;
+
+// Power on: clear the DPRAM, the status bits, the data toggles and the
+// statistics
+void usb_emu_reset(void);
+
+// The host asks an IN endpoint for a packet, and gets its length, or -1 for a
+// NAK
+int usb_emu_in(uint ep_num, uint8_t *data);
+
+// The host sends a packet to an OUT endpoint; false for a NAK
+bool usb_emu_out(uint ep_num, const uint8_t *data, uint len);
+
+#endif
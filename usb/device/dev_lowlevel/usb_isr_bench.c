@@ -0,0 +1,229 @@
+/**
+ * Copyright (c) 2022 Raspberry Pi (Trading) Ltd.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+#include <stdio.h>
+#include <string.h>
+#include "pico/stdlib.h"
+#include "usb_transfer.h"
+#include "usb_trace.h"
+#include "test_rand.h"
+
+// Replays sequences of BUFF_STATUS values through the buffer status part of
+// dev_lowlevel's interrupt handler, as it was and as it is:
+//
+// - before: a loop over the bits, a search of the endpoint list for each one
+//   which is set, and a printf;
+// - after: usb_dispatch_buf_status(), which finds the set bits with count
+//   trailing zeros and looks their endpoints up in a table, and a usb_trace.
+//
+// Checks that both reach the same endpoints in the same order, with the same
+// messages, then compares the path length (loop passes and endpoint
+// comparisons; after, it is one table read per buffer), the time taken on
+// this machine, and how much the interrupt handler prints. On an RP2040 the
+// times would differ, but the path lengths would not.
+
+static int failures;
+
+static void result(const char *name, bool ok) {
+    printf("%-40s %s\n", name, ok ? "ok" : "FAILED");
+    if (!ok)
+        ++failures;
+}
+
+// ----------------------------------------------------------------------------
+// The endpoints. None has a transfer in progress, so usb_handle_ep_buff_done()
+// has nothing to do, and only the dispatch is measured.
+
+static void ep_handler(__unused uint8_t *buf, __unused uint16_t len) {
+}
+
+static struct usb_endpoint_descriptor descriptors[USB_NUM_ENDPOINTS];
+static struct usb_endpoint_configuration endpoints[USB_NUM_ENDPOINTS];
+static uint n_endpoints;
+static usb_buf_status_table_t table;
+
+// EP0 OUT and IN, then OUT and IN of EP1 and up, as dev_lowlevel.c lists them,
+// or just EP1 OUT and EP2 IN after EP0, as it has
+static void setup_endpoints(uint n, bool as_dev_lowlevel) {
+    static const uint8_t dev_lowlevel_addrs[] = {0x00, 0x80, 0x01, 0x82};
+    memset(endpoints, 0, sizeof(endpoints));
+    memset(table, 0, sizeof(table));
+    n_endpoints = n;
+    for (uint i = 0; i < n; ++i) {
+        uint8_t addr = as_dev_lowlevel ? dev_lowlevel_addrs[i] : (uint8_t) ((i / 2) | (i & 1 ? USB_DIR_IN : 0));
+        descriptors[i] = (struct usb_endpoint_descriptor) {
+                .bLength = sizeof(struct usb_endpoint_descriptor),
+                .bDescriptorType = USB_DT_ENDPOINT,
+                .bEndpointAddress = addr,
+                .bmAttributes = USB_TRANSFER_TYPE_BULK,
+                .wMaxPacketSize = 64,
+        };
+        endpoints[i].descriptor = &descriptors[i];
+        endpoints[i].handler = ep_handler;
+        table[usb_buf_status_bit(&endpoints[i])] = &endpoints[i];
+    }
+}
+
+// ----------------------------------------------------------------------------
+// The interrupt path as it was, with counters, and snprintf standing in for
+// printf (which takes far longer, as it waits for the UART)
+
+static uint32_t old_passes, old_compares, old_chars;
+static char line[64];
+
+static void old_handle_buff_done(uint ep_num, bool in) {
+    uint8_t ep_addr = ep_num | (in ? USB_DIR_IN : 0);
+    old_chars += snprintf(line, sizeof(line), "EP %d (in = %d) done\n", ep_num, in);
+    for (uint i = 0; i < USB_NUM_ENDPOINTS; i++) {
+        struct usb_endpoint_configuration *ep = &endpoints[i];
+        ++old_compares;
+        if (ep->descriptor && ep->handler) {
+            if (ep->descriptor->bEndpointAddress == ep_addr) {
+                usb_handle_ep_buff_done(ep);
+                return;
+            }
+        }
+    }
+}
+
+static void old_handle_buff_status(uint32_t buffers) {
+    uint32_t remaining_buffers = buffers;
+
+    uint bit = 1u;
+    for (uint i = 0; remaining_buffers && i < USB_NUM_ENDPOINTS * 2; i++) {
+        ++old_passes;
+        if (remaining_buffers & bit) {
+            // IN transfer for even i, OUT transfer for odd i
+            old_handle_buff_done(i >> 1u, !(i & 1u));
+            remaining_buffers &= ~bit;
+        }
+        bit <<= 1u;
+    }
+}
+
+// ----------------------------------------------------------------------------
+
+// Every bit goes to the endpoint the old search finds for it, and the trace
+// says what the old printf did, for each set bit in order
+static bool check_same(uint32_t buffers) {
+    bool ok = true;
+    for (uint bit = 0; bit < USB_NUM_ENDPOINTS * 2; ++bit) {
+        struct usb_endpoint_configuration *found = NULL;
+        uint8_t addr = (uint8_t) ((bit >> 1) | (bit & 1 ? 0 : USB_DIR_IN));
+        for (uint i = 0; i < n_endpoints && !found; ++i) {
+            if (endpoints[i].descriptor->bEndpointAddress == addr)
+                found = &endpoints[i];
+        }
+        ok &= table[bit] == found;
+    }
+
+    usb_trace_ring.tail = usb_trace_ring.head;
+    usb_dispatch_buf_status(table, buffers);
+    for (uint bit = 0; bit < 32; ++bit) {
+        if (!(buffers & (1u << bit)))
+            continue;
+        if (usb_trace_ring.tail == usb_trace_ring.head)
+            return false;
+        usb_trace_entry_t *e = &usb_trace_ring.entries[usb_trace_ring.tail++ % USB_TRACE_SIZE];
+        char traced[64];
+        snprintf(traced, sizeof(traced), e->fmt, e->arg[0], e->arg[1]);
+        snprintf(line, sizeof(line), "EP %d (in = %d) done\n", bit >> 1, !(bit & 1));
+        ok &= !strcmp(traced, line);
+    }
+    return ok && usb_trace_ring.tail == usb_trace_ring.head;
+}
+
+static void test_trace_ring(void) {
+    usb_trace_ring.tail = usb_trace_ring.head;
+    uint32_t dropped = usb_trace_ring.dropped;
+    for (uint i = 0; i < USB_TRACE_SIZE + 10; ++i)
+        usb_trace("%d\n", i, 0);
+    bool ok = usb_trace_ring.head - usb_trace_ring.tail == USB_TRACE_SIZE && usb_trace_ring.dropped - dropped == 10;
+    // The oldest are kept
+    ok &= usb_trace_ring.entries[usb_trace_ring.tail % USB_TRACE_SIZE].arg[0] == 0;
+    usb_trace_ring.tail = usb_trace_ring.head;
+    result("trace ring drops the newest when full", ok);
+}
+
+#define REPLAY_LENGTH 4096
+#define REPLAY_ROUNDS 250
+
+static uint32_t replay[REPLAY_LENGTH];
+
+static void bench(const char *name) {
+    bool ok = true;
+    for (uint i = 0; i < REPLAY_LENGTH; ++i)
+        ok &= check_same(replay[i]);
+
+    old_passes = old_compares = old_chars = 0;
+    uint32_t set_bits = 0;
+    for (uint i = 0; i < REPLAY_LENGTH; ++i) {
+        old_handle_buff_status(replay[i]);
+        set_bits += (uint32_t) __builtin_popcount(replay[i]);
+    }
+    uint32_t passes = old_passes, compares = old_compares;
+    uint32_t old_chars_per_irq = old_chars / REPLAY_LENGTH;
+
+    // The main loop's printing isn't part of the interrupt, so the ring is
+    // emptied without it
+    uint64_t t0 = time_us_64();
+    for (uint r = 0; r < REPLAY_ROUNDS; ++r) {
+        for (uint i = 0; i < REPLAY_LENGTH; ++i)
+            old_handle_buff_status(replay[i]);
+    }
+    uint64_t t1 = time_us_64();
+    for (uint r = 0; r < REPLAY_ROUNDS; ++r) {
+        for (uint i = 0; i < REPLAY_LENGTH; ++i) {
+            usb_dispatch_buf_status(table, replay[i]);
+            usb_trace_ring.tail = usb_trace_ring.head;
+        }
+    }
+    uint64_t t2 = time_us_64();
+    uint32_t n = REPLAY_LENGTH * REPLAY_ROUNDS;
+
+    printf("\n%s, %u.%02u buffers per interrupt:\n", name, set_bits / REPLAY_LENGTH,
+           set_bits * 100 / REPLAY_LENGTH % 100);
+    printf("          %14s %18s %19s %14s\n", "loop passes", "endpoint compares", "ns on this machine",
+           "chars printed");
+    printf("  before  %11u.%02u %15u.%02u %19u %14u\n", passes / REPLAY_LENGTH, passes * 100 / REPLAY_LENGTH % 100,
+           compares / REPLAY_LENGTH, compares * 100 / REPLAY_LENGTH % 100, (uint) ((t1 - t0) * 1000 / n),
+           old_chars_per_irq);
+    printf("  after   %11u.%02u %15u.%02u %19u %14u\n", set_bits / REPLAY_LENGTH, set_bits * 100 / REPLAY_LENGTH % 100,
+           0, 0, (uint) ((t2 - t1) * 1000 / n), 0);
+    // 10 bits a character at 115200 baud, once the UART's FIFO is full
+    printf("  printing took about %u us per interrupt on the device at 115200 baud\n",
+           old_chars_per_irq * 10 * 1000000 / 115200);
+    char result_name[64];
+    snprintf(result_name, sizeof(result_name), "%s: same dispatch", name);
+    result(result_name, ok);
+}
+
+int main() {
+    stdio_init_all();
+    printf("USB interrupt path benchmark\n");
+
+    test_trace_ring();
+
+    // dev_lowlevel's loopback: EP1 OUT done, then EP2 IN
+    setup_endpoints(4, true);
+    for (uint i = 0; i < REPLAY_LENGTH; ++i)
+        replay[i] = i & 1 ? 1u << 4 : 1u << 3;
+    bench("loopback");
+
+    // Streaming both ways, double buffered: either or both, once or twice
+    for (uint i = 0; i < REPLAY_LENGTH; ++i)
+        replay[i] = (next_rand() % 3 + 1) << 3;
+    bench("bulk OUT and IN");
+
+    // Every endpoint the table can hold, all busy
+    setup_endpoints(USB_NUM_ENDPOINTS, false);
+    for (uint i = 0; i < REPLAY_LENGTH; ++i)
+        replay[i] = next_rand() & next_rand() & 0xffffu;
+    bench("16 endpoints");
+
+    printf(failures ? "FAILED\n" : "All good\n");
+    return failures ? 1 : 0;
+}
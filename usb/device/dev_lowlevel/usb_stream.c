@@ -0,0 +1,92 @@
+/**
+ * Copyright (c) 2022 Raspberry Pi (Trading) Ltd.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+#include <string.h>
+
+#include "usb_stream.h"
+
+void usb_stream_init(usb_stream_t *s, struct usb_endpoint_configuration *ep, uint8_t *ring, uint32_t size,
+                     uint16_t max_transfer) {
+    uint mps = ep->descriptor->wMaxPacketSize;
+    hard_assert(!(size & (size - 1)) && !(size % mps));
+    hard_assert(max_transfer >= mps && !(max_transfer % mps));
+    s->ep = ep;
+    s->ring = ring;
+    s->size = size;
+    s->max_transfer = max_transfer;
+    s->head = s->tail = 0;
+    // Not yet started, rather than run out
+    s->starved = true;
+    memset(&s->stats, 0, sizeof(s->stats));
+}
+
+uint8_t *usb_stream_reserve(usb_stream_t *s, uint32_t len) {
+    uint32_t head = s->head;
+    uint32_t offset = head & (s->size - 1);
+    if (s->size - (head - s->tail) < len || s->size - offset < len) {
+        return NULL;
+    }
+    return s->ring + offset;
+}
+
+void usb_stream_commit(usb_stream_t *s, uint32_t len) {
+    // The data must be in the ring before the endpoint side can see it
+    __compiler_memory_barrier();
+    s->head += len;
+}
+
+uint32_t usb_stream_write(usb_stream_t *s, const uint8_t *data, uint32_t len) {
+    uint32_t head = s->head;
+    len = MIN(len, s->size - (head - s->tail));
+    // In up to two pieces, either side of the end of the ring
+    uint32_t offset = head & (s->size - 1);
+    uint32_t first = MIN(len, s->size - offset);
+    memcpy(s->ring + offset, data, first);
+    memcpy(s->ring, data + first, len - first);
+    usb_stream_commit(s, len);
+    return len;
+}
+
+static void set_nak_interrupt(usb_stream_t *s, bool enabled) {
+    if (enabled) {
+        *s->ep->endpoint_control |= EP_CTRL_INTERRUPT_ON_NAK;
+    } else {
+        *s->ep->endpoint_control &= ~EP_CTRL_INTERRUPT_ON_NAK;
+    }
+}
+
+void usb_stream_poll(usb_stream_t *s) {
+    if (s->ep->active) {
+        return;
+    }
+    uint mps = s->ep->descriptor->wMaxPacketSize;
+    uint32_t tail = s->tail;
+    uint32_t offset = tail & (s->size - 1);
+    // tail only ever moves by whole packets, so a packet never wraps
+    uint32_t len = MIN(s->head - tail, s->size - offset);
+    len = MIN(len, s->max_transfer);
+    len -= len % mps;
+    if (!len) {
+        if (!s->starved) {
+            s->starved = true;
+            s->stats.underruns++;
+            set_nak_interrupt(s, true);
+        }
+        return;
+    }
+    if (s->starved) {
+        s->starved = false;
+        set_nak_interrupt(s, false);
+    }
+    usb_start_transfer(s->ep, s->ring + offset, (uint16_t) len);
+}
+
+void usb_stream_transfer_done(usb_stream_t *s, uint16_t len) {
+    s->stats.bytes += len;
+    s->stats.transfers++;
+    s->tail += len;
+    usb_stream_poll(s);
+}
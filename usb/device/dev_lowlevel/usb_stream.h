@@ -0,0 +1,88 @@
+/**
+ * Copyright (c) 2022 Raspberry Pi (Trading) Ltd.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+#ifndef USB_STREAM_H_
+#define USB_STREAM_H_
+
+#include "usb_transfer.h"
+
+// ----------------------------------------------------------------------------
+// A continuous stream of bytes to the host on a bulk IN endpoint, from a ring
+// which a producer (such as a DMA channel) fills.
+//
+// The producer reserves room in the ring, writes into it, and commits it.
+// The endpoint side sends the committed bytes with transfers that point
+// straight into the ring, as many whole packets at a time as there are, up to
+// max_transfer: the only copy is the one into DPRAM, a packet at a time, which
+// the controller needs. The room is given back to the producer when each
+// transfer completes.
+//
+// The producer only moves head, and the endpoint side only moves tail, so
+// neither needs a lock. The endpoint side runs in the USB interrupt handler:
+// after committing, the producer should get usb_stream_poll() called there
+// (for instance by setting the interrupt pending), as the endpoint may be
+// idle waiting for data.
+//
+// When there isn't a whole packet to send, the endpoint goes idle and the
+// host gets NAKs: an underrun. While it is idle, the endpoint's NAK interrupt
+// is enabled so usb_stream_nak() can count them, and it is disabled again
+// once data flows, so it costs nothing then.
+
+typedef struct {
+    uint32_t bytes;     // sent to the host
+    uint32_t transfers;
+    uint32_t underruns; // times the endpoint ran out of data
+    uint32_t naks;      // NAKs sent while out of data
+    uint32_t overruns;  // bytes the producer had to drop, for want of room
+} usb_stream_stats_t;
+
+typedef struct {
+    struct usb_endpoint_configuration *ep;
+    uint8_t *ring;
+    // A power of 2, and a multiple of the packet size
+    uint32_t size;
+    // Most bytes per transfer, a multiple of the packet size
+    uint16_t max_transfer;
+    // Bytes committed and sent, free running
+    volatile uint32_t head;
+    volatile uint32_t tail;
+    bool starved;
+    usb_stream_stats_t stats;
+} usb_stream_t;
+
+void usb_stream_init(usb_stream_t *s, struct usb_endpoint_configuration *ep, uint8_t *ring, uint32_t size,
+                     uint16_t max_transfer);
+
+// Producer side
+
+// Room for len more bytes, in one piece, or NULL if there isn't any yet
+uint8_t *usb_stream_reserve(usb_stream_t *s, uint32_t len);
+
+// Add len bytes, written where usb_stream_reserve() said
+void usb_stream_commit(usb_stream_t *s, uint32_t len);
+
+// Copy in as much of data as there is room for; returns the bytes taken
+uint32_t usb_stream_write(usb_stream_t *s, const uint8_t *data, uint32_t len);
+
+// Count bytes which were dropped for want of room
+static inline void usb_stream_overrun(usb_stream_t *s, uint32_t len) {
+    s->stats.overruns += len;
+}
+
+// Endpoint side, from the USB interrupt handler
+
+// Start sending, if the endpoint is idle and there is a packet to send
+void usb_stream_poll(usb_stream_t *s);
+
+// Call from the endpoint's handler when a transfer completes
+void usb_stream_transfer_done(usb_stream_t *s, uint16_t len);
+
+// Call for each NAK interrupt from the endpoint
+static inline void usb_stream_nak(usb_stream_t *s) {
+    s->stats.naks++;
+}
+
+#endif
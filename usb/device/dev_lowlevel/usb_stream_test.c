@@ -0,0 +1,239 @@
+/**
+ * Copyright (c) 2022 Raspberry Pi (Trading) Ltd.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+#include <stdio.h>
+#include <string.h>
+#include "pico/stdlib.h"
+#include "usb_stream.h"
+#include "usb_emu.h"
+#include "test_rand.h"
+
+// Runs usb_stream.c against the model of the controller in usb_emu.c: checks
+// that what the producer puts in arrives at the host in order, in whole
+// packets, sent straight from the ring, and that underruns, NAKs and overruns
+// are counted. Then simulates a DMA producer at a range of rates, to see how
+// much gets through. usb_emu.c stands in for the controller's registers and
+// DPRAM, so there is only a host build of it.
+
+static int failures;
+
+static void result(const char *name, bool ok) {
+    printf("%-40s %s\n", name, ok ? "ok" : "FAILED");
+    if (!ok)
+        ++failures;
+}
+
+// ----------------------------------------------------------------------------
+// EP2 IN, as dev_lowlevel.c has it
+
+static const struct usb_endpoint_descriptor ep2_in_desc = {
+        .bLength          = sizeof(struct usb_endpoint_descriptor),
+        .bDescriptorType  = USB_DT_ENDPOINT,
+        .bEndpointAddress = USB_DIR_IN | 2,
+        .bmAttributes     = USB_TRANSFER_TYPE_BULK,
+        .wMaxPacketSize   = 64,
+        .bInterval        = 0
+};
+
+static usb_stream_t stream;
+
+static void ep2_in_handler(__unused uint8_t *buf, uint16_t len) {
+    usb_stream_transfer_done(&stream, len);
+}
+
+static struct usb_endpoint_configuration ep2_in = {
+        .descriptor = &ep2_in_desc,
+        .handler = &ep2_in_handler,
+        .endpoint_control = &usb_dpram->ep_ctrl[1].in,
+        .buffer_control = &usb_dpram->ep_buf_ctrl[2].in,
+        .data_buffer = &usb_dpram->epx_data[2 * 64],
+        .double_buffered = true,
+};
+
+static usb_buf_status_table_t buf_status_table = {
+        [2 * 2] = &ep2_in,
+};
+
+#define MAX_RING_SIZE (16 * 1024)
+
+static uint8_t ring[MAX_RING_SIZE];
+
+static void setup_stream(uint32_t size, uint16_t max_transfer) {
+    usb_emu_reset();
+    usb_setup_endpoint(&ep2_in);
+    ep2_in.next_pid = 0;
+    usb_stream_init(&stream, &ep2_in, ring, size, max_transfer);
+}
+
+// What the interrupt handler does for the stream
+static void usb_irq(void) {
+    for (uint32_t naks = usb_emu_ep_nak_status; naks; naks &= naks - 1)
+        usb_stream_nak(&stream);
+    usb_emu_ep_nak_status = 0;
+    uint32_t buffers = usb_emu_buf_status;
+    usb_emu_buf_status = 0;
+    usb_dispatch_buf_status(buf_status_table, buffers);
+    usb_stream_poll(&stream);
+}
+
+// A transfer in progress sends straight from the ring
+static bool sending_from_ring(void) {
+    return !ep2_in.active || (ep2_in.buf >= ring && ep2_in.buf + ep2_in.len <= ring + stream.size);
+}
+
+// ----------------------------------------------------------------------------
+// A counting producer which writes whatever there is room for, at random
+// times, with pauses long enough to run the stream dry, and a host which
+// reads at random times. Every byte should arrive, in order, in whole
+// packets.
+
+static void test_order(uint32_t size, uint16_t max_transfer) {
+    setup_stream(size, max_transfer);
+    uint8_t produced = 0, expected = 0;
+    uint32_t received = 0, nak_irqs = 0;
+    bool ok = true;
+    for (uint step = 0; step < 200000; ++step) {
+        uint r = next_rand() % 8;
+        if (r < 2) {
+            if (step / 5000 % 4 == 3)
+                continue;
+            uint8_t data[700];
+            uint32_t len = next_rand() % sizeof(data);
+            for (uint i = 0; i < len; ++i)
+                data[i] = (uint8_t) (produced + i);
+            produced += (uint8_t) usb_stream_write(&stream, data, len);
+        } else if (r < 4) {
+            nak_irqs += (uint) __builtin_popcount(usb_emu_ep_nak_status);
+            usb_irq();
+        } else {
+            uint8_t pkt[64];
+            int got = usb_emu_in(2, pkt);
+            if (got < 0)
+                continue;
+            ok &= got == 64;
+            for (int i = 0; i < got; ++i)
+                ok &= pkt[i] == expected++;
+            received += (uint32_t) got;
+        }
+        ok &= sending_from_ring();
+    }
+    const usb_stream_stats_t *st = &stream.stats;
+    ok &= st->bytes <= received && received - st->bytes <= max_transfer && !usb_emu_stats.errors;
+    ok &= st->naks == nak_irqs && st->naks <= usb_emu_stats.naks && st->underruns > 0;
+    char name[64];
+    snprintf(name, sizeof(name), "in order, %uk ring, %u byte transfers", size / 1024, max_transfer);
+    result(name, ok);
+}
+
+// The producer can't reserve more than there is room for, in one piece; the
+// room comes back as transfers complete
+static void test_reserve(void) {
+    setup_stream(1024, 256);
+    bool ok = true;
+    for (uint i = 0; i < 4; ++i) {
+        uint8_t *p = usb_stream_reserve(&stream, 256);
+        ok &= p == ring + i * 256;
+        if (p)
+            usb_stream_commit(&stream, 256);
+    }
+    ok &= !usb_stream_reserve(&stream, 1);
+    usb_stream_poll(&stream);
+    // Four packets, one transfer
+    uint8_t pkt[64];
+    for (uint i = 0; i < 4; ++i) {
+        ok &= usb_emu_in(2, pkt) == 64;
+        usb_irq();
+    }
+    ok &= stream.stats.transfers == 1 && stream.tail == 256;
+    // Room at the start of the ring, but not in one piece of 512
+    ok &= !usb_stream_reserve(&stream, 512) && usb_stream_reserve(&stream, 256) == ring;
+    result("reserve and commit", ok);
+}
+
+// ----------------------------------------------------------------------------
+// Throughput. A DMA producer commits 512 byte chunks at a steady rate, and
+// drops a chunk when there is no room for it. The host asks for 64 byte
+// packets back to back, each taking as long as it would on an otherwise idle
+// full speed bus (19 to a 1 ms frame), or about 6 us for a NAK, except for a
+// 2 ms break every 10 ms, as when it is busy with other devices: the ring
+// has to hold what is produced meanwhile. The interrupt handler runs 10 us
+// after a packet, a NAK which interrupts, or the producer's commit.
+
+#define SIM_PACKET_NS 52632
+#define SIM_NAK_NS 6000
+#define SIM_ISR_LATENCY_NS 10000
+#define SIM_TIME_NS 1000000000ull
+#define SIM_CHUNK 512
+#define SIM_HOST_PERIOD_NS 10000000
+#define SIM_HOST_BREAK_NS 2000000
+
+static void simulate(uint32_t rate_kbs, uint32_t size, uint32_t *kbs, uint32_t *overrun_chunks) {
+    setup_stream(size, 4096);
+    uint64_t chunk_ns = (uint64_t) SIM_CHUNK * 1000000 / rate_kbs;
+    uint64_t t_host = 0, t_producer = chunk_ns, isr_at = UINT64_MAX;
+    while (t_host < SIM_TIME_NS) {
+        if (isr_at <= t_host && isr_at <= t_producer) {
+            usb_irq();
+            isr_at = UINT64_MAX;
+        } else if (t_producer <= t_host) {
+            if (usb_stream_reserve(&stream, SIM_CHUNK))
+                usb_stream_commit(&stream, SIM_CHUNK);
+            else
+                usb_stream_overrun(&stream, SIM_CHUNK);
+            if (isr_at == UINT64_MAX)
+                isr_at = t_producer + SIM_ISR_LATENCY_NS;
+            t_producer += chunk_ns;
+        } else if (t_host % SIM_HOST_PERIOD_NS < SIM_HOST_BREAK_NS) {
+            t_host += SIM_HOST_BREAK_NS - t_host % SIM_HOST_PERIOD_NS;
+        } else {
+            uint8_t pkt[64];
+            t_host += usb_emu_in(2, pkt) < 0 ? SIM_NAK_NS : SIM_PACKET_NS;
+            if ((usb_emu_buf_status || usb_emu_ep_nak_status) && isr_at == UINT64_MAX)
+                isr_at = t_host + SIM_ISR_LATENCY_NS;
+        }
+    }
+    *kbs = (uint32_t) ((uint64_t) stream.stats.bytes * 1000000 / t_host);
+    *overrun_chunks = stream.stats.overruns / SIM_CHUNK;
+}
+
+static void bench(void) {
+    static const uint32_t rates_kbs[] = {250, 500, 800, 900, 1500};
+    static const uint32_t sizes[] = {2048, 16384};
+    printf("\nProducer of 512 byte chunks, 4k transfers:\n");
+    printf("  producer   ring      sent  underruns    NAKs  dropped chunks\n");
+    bool ok = true;
+    for (uint i = 0; i < count_of(rates_kbs); ++i) {
+        for (uint j = 0; j < count_of(sizes); ++j) {
+            uint32_t kbs, dropped;
+            simulate(rates_kbs[i], sizes[j], &kbs, &dropped);
+            const usb_stream_stats_t *st = &stream.stats;
+            printf("  %4u kB/s  %3uk  %4u kB/s %10u %7u %15u\n", rates_kbs[i], sizes[j] / 1024, kbs, st->underruns,
+                   st->naks, dropped);
+            // With a big enough ring nothing is dropped, if the host can take
+            // it; and if it can't, it gets as much as it can
+            if (rates_kbs[i] <= 900 && sizes[j] == 16384)
+                ok &= !dropped && kbs + kbs / 50 >= rates_kbs[i];
+            if (rates_kbs[i] == 1500)
+                ok &= kbs >= 950;
+            ok &= !usb_emu_stats.errors;
+        }
+    }
+    result("the stream keeps up", ok);
+}
+
+int main() {
+    stdio_init_all();
+    printf("USB stream test\n");
+
+    test_order(4096, 1024);
+    test_order(1024, 64);
+    test_order(16384, 4096);
+    test_reserve();
+    bench();
+
+    printf(failures ? "FAILED\n" : "All good\n");
+    return failures ? 1 : 0;
+}
@@ -0,0 +1,33 @@
+/**
+ * Copyright (c) 2022 Raspberry Pi (Trading) Ltd.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+#include <stdio.h>
+
+#include "usb_trace.h"
+
+usb_trace_ring_t usb_trace_ring;
+
+uint usb_trace_print(void) {
+    uint n = 0;
+    uint32_t tail = usb_trace_ring.tail;
+    while (tail != usb_trace_ring.head) {
+        // Copy the entry out before handing its slot back
+        usb_trace_entry_t e = usb_trace_ring.entries[tail % USB_TRACE_SIZE];
+        __compiler_memory_barrier();
+        usb_trace_ring.tail = ++tail;
+        printf(e.fmt, e.arg[0], e.arg[1]);
+        n++;
+    }
+    // Only the interrupt handler writes dropped, so remember how many have
+    // been reported rather than clearing it
+    static uint32_t dropped_reported;
+    uint32_t dropped = usb_trace_ring.dropped;
+    if (dropped != dropped_reported) {
+        printf("(%u USB trace messages dropped)\n", dropped - dropped_reported);
+        dropped_reported = dropped;
+    }
+    return n;
+}
@@ -0,0 +1,76 @@
+/**
+ * Copyright (c) 2022 Raspberry Pi (Trading) Ltd.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+#ifndef USB_TRACE_H_
+#define USB_TRACE_H_
+
+#include "pico.h"
+
+// ----------------------------------------------------------------------------
+// Messages from the USB interrupt handler, printed later from the main loop.
+//
+// A printf from the interrupt handler holds up the bus for as long as it
+// takes to print: a millisecond or more over a UART. usb_trace() only stores
+// the format string (which must be a literal, or live as long) and up to two
+// arguments in a ring, and usb_trace_print() does the printing, outside the
+// interrupt. The interrupt handler is the only writer of the ring and the
+// main loop the only reader, so neither needs a lock: each only moves its own
+// index. If the ring fills up, the newest messages are dropped and counted.
+//
+// Build with USB_TRACE_ENABLED=0 to compile the messages out altogether.
+
+#ifndef USB_TRACE_ENABLED
+#define USB_TRACE_ENABLED 1
+#endif
+
+// Entries in the ring; a power of 2
+#ifndef USB_TRACE_SIZE
+#define USB_TRACE_SIZE 64
+#endif
+
+typedef struct {
+    const char *fmt;
+    uint32_t arg[2];
+} usb_trace_entry_t;
+
+typedef struct {
+    usb_trace_entry_t entries[USB_TRACE_SIZE];
+    // Free running: head is only written by usb_trace(), tail by
+    // usb_trace_print()
+    volatile uint32_t head;
+    volatile uint32_t tail;
+    volatile uint32_t dropped;
+} usb_trace_ring_t;
+
+extern usb_trace_ring_t usb_trace_ring;
+
+// Add a message to the ring; from the USB interrupt handler only
+static inline void usb_trace(const char *fmt, uint32_t arg0, uint32_t arg1) {
+#if USB_TRACE_ENABLED
+    uint32_t head = usb_trace_ring.head;
+    if (head - usb_trace_ring.tail == USB_TRACE_SIZE) {
+        usb_trace_ring.dropped++;
+        return;
+    }
+    usb_trace_entry_t *e = &usb_trace_ring.entries[head % USB_TRACE_SIZE];
+    e->fmt = fmt;
+    e->arg[0] = arg0;
+    e->arg[1] = arg1;
+    // The entry must be written before the reader can see it
+    __compiler_memory_barrier();
+    usb_trace_ring.head = head + 1;
+#else
+    (void) fmt;
+    (void) arg0;
+    (void) arg1;
+#endif
+}
+
+// Print the messages in the ring (and how many were dropped); from the main
+// loop. Returns the number printed.
+uint usb_trace_print(void);
+
+#endif
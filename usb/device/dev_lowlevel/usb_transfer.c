@@ -0,0 +1,227 @@
+/**
+ * Copyright (c) 2022 Raspberry Pi (Trading) Ltd.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+// For memcpy
+#include <string.h>
+
+#include "usb_transfer.h"
+#include "usb_trace.h"
+
+// In double buffered mode, the second buffer is always 64 bytes after the
+// first
+#define USB_BUFFER_1_OFFSET 64
+
+static inline bool ep_is_tx(const struct usb_endpoint_configuration *ep) {
+    return ep->descriptor->bEndpointAddress & USB_DIR_IN;
+}
+
+static inline uint ep_max_packet(const struct usb_endpoint_configuration *ep) {
+    return ep->descriptor->wMaxPacketSize;
+}
+
+/**
+ * @brief Take a buffer pointer located in the USB RAM and return as an offset of the RAM.
+ *
+ * @param buf
+ * @return uint32_t
+ */
+static inline uint32_t usb_buffer_offset(volatile uint8_t *buf) {
+    return (uint32_t) ((uintptr_t) buf - (uintptr_t) usb_dpram);
+}
+
+static inline volatile uint8_t *half_buffer(const struct usb_endpoint_configuration *ep, uint half) {
+    return ep->data_buffer + half * USB_BUFFER_1_OFFSET;
+}
+
+// Each half of the buffer control register is read and written on its own,
+// as the controller may be busy with the other
+static inline volatile uint16_t *half_buffer_control(const struct usb_endpoint_configuration *ep, uint half) {
+    return (volatile uint16_t *) ep->buffer_control + half;
+}
+
+static void write_half_buffer_control(const struct usb_endpoint_configuration *ep, uint half, uint16_t val) {
+    volatile uint16_t *reg = half_buffer_control(ep, half);
+    *reg = val & ~USB_BUF_CTRL_AVAIL;
+#if PICO_ON_DEVICE
+    // The controller runs from clk_usb, which can be slower than clk_sys:
+    // give it 12 cycles to see the rest of the bits before AVAIL
+    __asm volatile ("b 1f\n1: b 1f\n1: b 1f\n1: b 1f\n1: b 1f\n1: b 1f\n1:\n" : : : "memory");
+#endif
+    *reg = val;
+}
+
+/**
+ * @brief Set up the endpoint control register for an endpoint (if applicable. Not valid for EP0).
+ *
+ * @param ep
+ */
+void usb_setup_endpoint(struct usb_endpoint_configuration *ep) {
+    usb_cancel_transfer(ep);
+
+    // EP0 doesn't have one so return if that is the case
+    if (!ep->endpoint_control) {
+        return;
+    }
+
+    // Get the data buffer as an offset of the USB controller's DPRAM
+    uint32_t dpram_offset = usb_buffer_offset(ep->data_buffer);
+    uint32_t reg = EP_CTRL_ENABLE_BITS
+                   | EP_CTRL_INTERRUPT_PER_BUFFER
+                   | (ep->descriptor->bmAttributes << EP_CTRL_BUFFER_TYPE_LSB)
+                   | dpram_offset;
+    if (ep->double_buffered) {
+        reg |= EP_CTRL_DOUBLE_BUFFERED_BITS;
+    }
+    *ep->endpoint_control = reg;
+}
+
+void usb_cancel_transfer(struct usb_endpoint_configuration *ep) {
+    ep->active = false;
+    ep->armed = 0;
+    ep->next_done = 0;
+    ep->next_arm = 0;
+    // Take back both buffers, and have the controller start again from
+    // buffer 0
+    *ep->buffer_control = ep->double_buffered ? USB_BUF_CTRL_SEL : 0;
+}
+
+/**
+ * @brief Give the controller as many packets of the transfer as there are
+ * free buffers for.
+ *
+ * @param ep, the endpoint configuration.
+ */
+static void usb_arm_buffers(struct usb_endpoint_configuration *ep) {
+    uint8_t all = ep->double_buffered ? 3 : 1;
+    bool tx = ep_is_tx(ep);
+    while (ep->packets_left && ep->armed != all) {
+        uint half = ep->next_arm;
+        uint16_t len = (uint16_t) MIN(ep_max_packet(ep), ep->len - ep->queued);
+        uint16_t val = len | USB_BUF_CTRL_AVAIL;
+
+        if (tx) {
+            // Need to copy the data from the user buffer to the usb memory
+            if (len) {
+                memcpy((void *) half_buffer(ep, half), ep->buf + ep->queued, len);
+            }
+            // Mark as full
+            val |= USB_BUF_CTRL_FULL;
+        }
+
+        // Set pid and flip for next transfer
+        val |= ep->next_pid ? USB_BUF_CTRL_DATA1_PID : USB_BUF_CTRL_DATA0_PID;
+        ep->next_pid ^= 1u;
+
+        ep->queued += len;
+        --ep->packets_left;
+        ep->armed |= 1u << half;
+        ep->next_arm = half ^ ep->double_buffered;
+        write_half_buffer_control(ep, half, (uint16_t) val);
+    }
+}
+
+/**
+ * @brief Starts a transfer on a given endpoint.
+ *
+ * @param ep, the endpoint configuration.
+ * @param buf, the data to send (IN), or where to put the data received (OUT), or NULL to leave a single OUT packet
+ * in DPRAM
+ * @param len, the length of the data in buf
+ */
+void usb_start_transfer(struct usb_endpoint_configuration *ep, uint8_t *buf, uint16_t len) {
+    uint mps = ep_max_packet(ep);
+    assert(!ep->active);
+    assert(buf || len <= (ep_is_tx(ep) ? 0 : mps));
+
+    ep->buf = buf;
+    ep->len = len;
+    ep->queued = 0;
+    ep->done = 0;
+    ep->packets_left = len ? (uint16_t) ((len + mps - 1) / mps) : 1;
+
+    // An OUT endpoint may still have buffers out from the last transfer, and
+    // maybe a packet in one of them already: they are this transfer's now
+    for (uint half = 0; half < 2; half++) {
+        if ((ep->armed & (1u << half)) && ep->packets_left) {
+            ep->queued = (uint16_t) MIN(len, ep->queued + mps);
+            --ep->packets_left;
+        }
+    }
+    ep->active = true;
+
+    // Pick up any packet which has arrived, and give the controller the
+    // next packets
+    usb_handle_ep_buff_done(ep);
+}
+
+/**
+ * @brief Notify an endpoint that one or more of its buffers have been sent / received.
+ * Continues the transfer, and calls the endpoint's handler once it is complete.
+ *
+ * @param ep, the endpoint to notify.
+ */
+void usb_handle_ep_buff_done(struct usb_endpoint_configuration *ep) {
+    uint mps = ep_max_packet(ep);
+    bool tx = ep_is_tx(ep);
+
+    // The controller finishes with the buffers in the order they were given
+    // to it. Several may be done by the time the interrupt is handled, or
+    // none, if the last interrupt picked this one up already.
+    while (ep->active && (ep->armed & (1u << ep->next_done))) {
+        uint half = ep->next_done;
+        uint16_t buffer_control = *half_buffer_control(ep, half);
+        if (buffer_control & USB_BUF_CTRL_AVAIL) {
+            break;
+        }
+        ep->armed &= ~(1u << half);
+        ep->next_done = half ^ ep->double_buffered;
+
+        // Get the transfer length for this buffer
+        uint16_t len = buffer_control & USB_BUF_CTRL_LEN_MASK;
+        uint8_t *buf = ep->buf;
+        bool complete;
+        if (tx) {
+            ep->done += len;
+            complete = !ep->packets_left && !ep->armed;
+        } else {
+            if (buf) {
+                uint16_t n = MIN(len, ep->len - ep->done);
+                memcpy(buf + ep->done, (const void *) half_buffer(ep, half), n);
+                ep->done += n;
+            } else {
+                buf = (uint8_t *) half_buffer(ep, half);
+                ep->done = len;
+            }
+            // A short packet ends the transfer early
+            complete = len < mps || ep->done >= ep->len;
+        }
+
+        if (complete) {
+            ep->active = false;
+            // Call that endpoints buffer done handler, which may start
+            // another transfer
+            ep->handler(buf, ep->done);
+        }
+    }
+
+    if (ep->active) {
+        usb_arm_buffers(ep);
+    }
+}
+
+void usb_dispatch_buf_status(usb_buf_status_table_t table, uint32_t buffers) {
+    // One pass per bit which is set, rather than per bit
+    while (buffers) {
+        uint bit = (uint) __builtin_ctz(buffers);
+        buffers &= buffers - 1;
+        // IN transfer for even bits, OUT transfer for odd bits
+        usb_trace("EP %d (in = %d) done\n", bit >> 1u, !(bit & 1u));
+        struct usb_endpoint_configuration *ep = table[bit];
+        if (ep) {
+            usb_handle_ep_buff_done(ep);
+        }
+    }
+}
@@ -0,0 +1,101 @@
+/**
+ * Copyright (c) 2022 Raspberry Pi (Trading) Ltd.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+#ifndef USB_TRANSFER_H_
+#define USB_TRANSFER_H_
+
+#include "usb_common.h"
+
+// ----------------------------------------------------------------------------
+// Transfers of any length on an endpoint, a packet at a time through the
+// endpoint's buffers in the controller's DPRAM.
+//
+// An endpoint other than EP0 can be double buffered: it then has two
+// packets' worth of DPRAM, and uses both halves of its buffer control
+// register, so the controller can move one packet while the CPU fills or
+// empties the other. The controller takes the halves in turn, and raises a
+// buffer status interrupt for each; usb_handle_ep_buff_done() works through
+// the halves in the same order, copies the data to or from the caller's
+// buffer, and gives the controller the next packet, until the transfer is
+// complete, when it calls the endpoint's handler.
+//
+// An OUT transfer completes when its length has been received, or on a short
+// packet, so its length should be a multiple of the packet size. A double
+// buffered OUT endpoint may take in one packet more than the transfer asked
+// for; it is kept in DPRAM for the next transfer.
+
+typedef void (*usb_ep_handler)(uint8_t *buf, uint16_t len);
+
+// Struct in which we keep the endpoint configuration
+struct usb_endpoint_configuration {
+    const struct usb_endpoint_descriptor *descriptor;
+    // Called when a transfer completes, with its buffer and the number of
+    // bytes transferred
+    usb_ep_handler handler;
+
+    // Pointers to endpoint + buffer control registers
+    // in the USB controller DPSRAM
+    volatile uint32_t *endpoint_control;
+    volatile uint32_t *buffer_control;
+    volatile uint8_t *data_buffer;
+
+    // Two packets of DPRAM at data_buffer, used in turn (not for EP0)
+    bool double_buffered;
+
+    // Toggle after each packet (unless replying to a SETUP)
+    uint8_t next_pid;
+
+    // The transfer in progress. buf is NULL for an OUT transfer of a single
+    // packet which the handler reads straight out of DPRAM.
+    bool active;
+    uint8_t *buf;
+    uint16_t len;
+    // Bytes given to the controller (or room for them, for OUT), and done
+    uint16_t queued;
+    uint16_t done;
+    // IN packets still to be given to the controller: a transfer whose length
+    // is a multiple of the packet size ends with a zero length packet only
+    // if it is empty
+    uint16_t packets_left;
+
+    // Buffer halves given to the controller, one bit each; the half it
+    // finishes with next, and the one to give it next
+    uint8_t armed;
+    uint8_t next_done;
+    uint8_t next_arm;
+};
+
+// Set up the endpoint control register for an endpoint (if applicable. Not
+// valid for EP0), and forget any transfer in progress
+void usb_setup_endpoint(struct usb_endpoint_configuration *ep);
+
+// Start a transfer of len bytes on an endpoint. For IN, buf holds the data to
+// send; for OUT, it is where to put the data received, or NULL to leave a
+// single packet in DPRAM for the handler.
+void usb_start_transfer(struct usb_endpoint_configuration *ep, uint8_t *buf, uint16_t len);
+
+// Drop any transfer in progress, and take back the buffers (for EP0, when a
+// new SETUP packet arrives)
+void usb_cancel_transfer(struct usb_endpoint_configuration *ep);
+
+// Deal with the buffers the controller has finished with, when the
+// endpoint's bit in BUFF_STATUS is set
+void usb_handle_ep_buff_done(struct usb_endpoint_configuration *ep);
+
+// The endpoints by their bit in BUFF_STATUS: 2 * ep_num for IN, and
+// 2 * ep_num + 1 for OUT. NULL for an endpoint which isn't in use.
+typedef struct usb_endpoint_configuration *usb_buf_status_table_t[USB_NUM_ENDPOINTS * 2];
+
+static inline uint usb_buf_status_bit(const struct usb_endpoint_configuration *ep) {
+    uint8_t addr = ep->descriptor->bEndpointAddress;
+    return (addr & 0xfu) * 2 + !(addr & USB_DIR_IN);
+}
+
+// Call usb_handle_ep_buff_done() for the endpoint of each bit set in buffers
+// (a value read from BUFF_STATUS), lowest bit first
+void usb_dispatch_buf_status(usb_buf_status_table_t table, uint32_t buffers);
+
+#endif
@@ -0,0 +1,366 @@
+/**
+ * Copyright (c) 2022 Raspberry Pi (Trading) Ltd.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+#include <stdio.h>
+#include <string.h>
+#include "pico/stdlib.h"
+#include "usb_transfer.h"
+#include "usb_emu.h"
+#include "test_rand.h"
+
+// Runs usb_transfer.c against the model of the controller in usb_emu.c, with
+// the host's packets and the interrupt handler interleaved at random: checks
+// that multi-packet IN and OUT transfers arrive whole, in packets of the
+// right size and with the right PIDs, single and double buffered. Then
+// estimates the bulk throughput of each, for a range of interrupt latencies.
+// Time is simulated, so the estimates come out the same on any machine.
+
+static int failures;
+
+static void result(const char *name, bool ok) {
+    printf("%-40s %s\n", name, ok ? "ok" : "FAILED");
+    if (!ok)
+        ++failures;
+}
+
+// ----------------------------------------------------------------------------
+// The endpoints, as dev_lowlevel.c has them
+
+static const struct usb_endpoint_descriptor ep1_out_desc = {
+        .bLength          = sizeof(struct usb_endpoint_descriptor),
+        .bDescriptorType  = USB_DT_ENDPOINT,
+        .bEndpointAddress = USB_DIR_OUT | 1,
+        .bmAttributes     = USB_TRANSFER_TYPE_BULK,
+        .wMaxPacketSize   = 64,
+        .bInterval        = 0
+};
+
+static const struct usb_endpoint_descriptor ep2_in_desc = {
+        .bLength          = sizeof(struct usb_endpoint_descriptor),
+        .bDescriptorType  = USB_DT_ENDPOINT,
+        .bEndpointAddress = USB_DIR_IN | 2,
+        .bmAttributes     = USB_TRANSFER_TYPE_BULK,
+        .wMaxPacketSize   = 64,
+        .bInterval        = 0
+};
+
+static void ep1_out_handler(uint8_t *buf, uint16_t len);
+static void ep2_in_handler(uint8_t *buf, uint16_t len);
+
+static struct usb_endpoint_configuration ep1_out = {
+        .descriptor = &ep1_out_desc,
+        .handler = &ep1_out_handler,
+        .endpoint_control = &usb_dpram->ep_ctrl[0].out,
+        .buffer_control = &usb_dpram->ep_buf_ctrl[1].out,
+        .data_buffer = &usb_dpram->epx_data[0 * 64],
+};
+
+static struct usb_endpoint_configuration ep2_in = {
+        .descriptor = &ep2_in_desc,
+        .handler = &ep2_in_handler,
+        .endpoint_control = &usb_dpram->ep_ctrl[1].in,
+        .buffer_control = &usb_dpram->ep_buf_ctrl[2].in,
+        .data_buffer = &usb_dpram->epx_data[2 * 64],
+};
+
+// What the handlers do depends on the test
+static void (*on_out_done)(uint8_t *buf, uint16_t len);
+static void (*on_in_done)(uint8_t *buf, uint16_t len);
+
+static void ep1_out_handler(uint8_t *buf, uint16_t len) {
+    on_out_done(buf, len);
+}
+
+static void ep2_in_handler(uint8_t *buf, uint16_t len) {
+    on_in_done(buf, len);
+}
+
+static void setup_endpoints(bool double_buffered) {
+    usb_emu_reset();
+    ep1_out.double_buffered = ep2_in.double_buffered = double_buffered;
+    usb_setup_endpoint(&ep1_out);
+    usb_setup_endpoint(&ep2_in);
+    ep1_out.next_pid = ep2_in.next_pid = 0;
+}
+
+static usb_buf_status_table_t buf_status_table = {
+        [2 * 1 + 1] = &ep1_out,
+        [2 * 2] = &ep2_in,
+};
+
+// The buffer status part of the interrupt handler
+static void handle_buff_status(void) {
+    uint32_t buffers = usb_emu_buf_status;
+    usb_emu_buf_status = 0;
+    usb_dispatch_buf_status(buf_status_table, buffers);
+}
+
+static const char *buffering_name(bool double_buffered) {
+    return double_buffered ? "double buffered" : "single buffered";
+}
+
+// ----------------------------------------------------------------------------
+// IN: the host polls, and the interrupt comes, in any order. Each transfer
+// should arrive as full packets and then a short one (or a zero length one
+// for an empty transfer), with its handler called once, after the last.
+
+#define MAX_TRANSFER 2048
+
+static uint8_t tx_data[MAX_TRANSFER];
+static uint in_done_count;
+static uint16_t in_done_len;
+
+static void count_in_done(__unused uint8_t *buf, uint16_t len) {
+    ++in_done_count;
+    in_done_len = len;
+}
+
+static void test_in(bool double_buffered) {
+    setup_endpoints(double_buffered);
+    on_in_done = count_in_done;
+    bool ok = true;
+    for (uint n = 0; n < 500 && ok; ++n) {
+        uint16_t len = (uint16_t) (next_rand() % MAX_TRANSFER);
+        if (n % 8 == 0)
+            len &= ~63u; // a whole number of packets, or none
+        for (uint i = 0; i < len; ++i)
+            tx_data[i] = (uint8_t) next_rand();
+
+        in_done_count = 0;
+        usb_start_transfer(&ep2_in, tx_data, len);
+        uint expect_packets = len ? (len + 63) / 64 : 1;
+        uint packets = 0, pos = 0;
+        for (uint steps = 0; !in_done_count && steps < 10000; ++steps) {
+            if (next_rand() & 1) {
+                handle_buff_status();
+                continue;
+            }
+            uint8_t pkt[64];
+            int got = usb_emu_in(2, pkt);
+            if (got < 0)
+                continue;
+            ok &= packets < expect_packets && (uint) got == MIN(64u, len - pos);
+            ok &= !memcmp(pkt, tx_data + pos, (uint) got);
+            pos += (uint) got;
+            ++packets;
+        }
+        ok &= in_done_count == 1 && in_done_len == len && packets == expect_packets && pos == len;
+        // and nothing more is given to the controller
+        uint8_t pkt[64];
+        ok &= usb_emu_in(2, pkt) < 0;
+    }
+    ok &= !usb_emu_stats.errors;
+    char name[64];
+    snprintf(name, sizeof(name), "IN transfers, %s", buffering_name(double_buffered));
+    result(name, ok);
+}
+
+// ----------------------------------------------------------------------------
+// OUT: the host sends transfers of any length, each ending in a short packet,
+// while the device receives into buffers of various whole numbers of
+// packets, and doesn't always start the next one straight away. Every byte
+// should arrive, in order, and each of the host's transfers should end one
+// of the device's.
+
+#define OUT_STREAM_SIZE (256 * 1024)
+
+static uint8_t out_stream[OUT_STREAM_SIZE];
+static uint8_t rx_stream[OUT_STREAM_SIZE];
+static uint8_t rx_buf[MAX_TRANSFER];
+static uint32_t rx_pos;
+static uint16_t rx_asked;
+static uint rx_short;
+static bool rx_ok;
+
+static void collect_out_done(uint8_t *buf, uint16_t len) {
+    rx_ok &= buf == rx_buf && len <= rx_asked && rx_pos + len <= OUT_STREAM_SIZE;
+    if (rx_ok)
+        memcpy(rx_stream + rx_pos, buf, len);
+    rx_pos += len;
+    if (len < rx_asked)
+        ++rx_short;
+}
+
+static void test_out(bool double_buffered) {
+    setup_endpoints(double_buffered);
+    on_out_done = collect_out_done;
+    for (uint i = 0; i < OUT_STREAM_SIZE; ++i)
+        out_stream[i] = (uint8_t) next_rand();
+    rx_pos = rx_short = 0;
+    rx_ok = true;
+
+    uint32_t sent = 0, sent_transfers = 0;
+    uint32_t left = 0;          // of the host's transfer
+    bool in_transfer = false, host_done = false;
+    for (uint steps = 0; steps < 10000000; ++steps) {
+        if (host_done && rx_pos == sent && rx_short == sent_transfers)
+            break;
+        uint r = next_rand() % 4;
+        if (r == 0) {
+            handle_buff_status();
+        } else if (r == 1) {
+            if (!ep1_out.active) {
+                rx_asked = (uint16_t) (64 * (1 + next_rand() % (MAX_TRANSFER / 64)));
+                usb_start_transfer(&ep1_out, rx_buf, rx_asked);
+            }
+        } else if (!host_done) {
+            if (!in_transfer) {
+                if (sent + MAX_TRANSFER > OUT_STREAM_SIZE) {
+                    host_done = true;
+                    continue;
+                }
+                left = next_rand() % MAX_TRANSFER;
+                in_transfer = true;
+            }
+            // A transfer of a whole number of packets ends with a zero
+            // length one
+            uint len = MIN(64u, left);
+            if (usb_emu_out(1, out_stream + sent, len)) {
+                sent += len;
+                left -= len;
+                if (len < 64) {
+                    in_transfer = false;
+                    ++sent_transfers;
+                }
+            }
+        }
+    }
+    bool ok = rx_ok && rx_pos == sent && !memcmp(rx_stream, out_stream, sent) && rx_short == sent_transfers;
+    ok &= !usb_emu_stats.errors;
+    char name[64];
+    snprintf(name, sizeof(name), "OUT transfers, %s", buffering_name(double_buffered));
+    result(name, ok);
+}
+
+// ----------------------------------------------------------------------------
+// Loopback, as dev_lowlevel.c does it: a single OUT packet read straight out
+// of DPRAM, and sent back on EP2
+
+static uint loop_count;
+
+static void loop_out_done(uint8_t *buf, uint16_t len) {
+    usb_start_transfer(&ep2_in, buf, len);
+}
+
+static void loop_in_done(__unused uint8_t *buf, __unused uint16_t len) {
+    ++loop_count;
+    usb_start_transfer(&ep1_out, NULL, 64);
+}
+
+static void test_loopback(bool double_buffered) {
+    setup_endpoints(double_buffered);
+    on_out_done = loop_out_done;
+    on_in_done = loop_in_done;
+    loop_count = 0;
+    usb_start_transfer(&ep1_out, NULL, 64);
+    bool ok = true;
+    for (uint n = 0; n < 1000 && ok; ++n) {
+        uint8_t pkt[64], echo[64];
+        uint len = next_rand() % 65;
+        for (uint i = 0; i < len; ++i)
+            pkt[i] = (uint8_t) next_rand();
+        uint steps = 0;
+        while (!usb_emu_out(1, pkt, len) && steps++ < 100)
+            handle_buff_status();
+        int got;
+        while ((got = usb_emu_in(2, echo)) < 0 && steps++ < 100)
+            handle_buff_status();
+        ok &= got == (int) len && !memcmp(echo, pkt, len);
+    }
+    handle_buff_status();
+    ok &= loop_count == 1000 && !usb_emu_stats.errors;
+    char name[64];
+    snprintf(name, sizeof(name), "loopback, %s", buffering_name(double_buffered));
+    result(name, ok);
+}
+
+// ----------------------------------------------------------------------------
+// Throughput. The host sends or asks for 64 byte packets back to back, each
+// taking as long as it would on an otherwise idle full speed bus (19 to a 1
+// ms frame), or about 6 us for a NAK. The controller sets a buf_status bit at
+// the end of each packet, and the interrupt handler runs a given time later.
+// The device streams 4k transfers, starting the next one from the handler.
+
+#define SIM_PACKET_NS 52632
+#define SIM_NAK_NS 6000
+#define SIM_TIME_NS 100000000ull
+#define SIM_TRANSFER 4096
+
+static uint8_t sim_buf[SIM_TRANSFER];
+
+static void restart_out(__unused uint8_t *buf, __unused uint16_t len) {
+    usb_start_transfer(&ep1_out, sim_buf, SIM_TRANSFER);
+}
+
+static void restart_in(__unused uint8_t *buf, __unused uint16_t len) {
+    usb_start_transfer(&ep2_in, sim_buf, SIM_TRANSFER);
+}
+
+// Returns kB/s
+static uint32_t simulate(bool in, bool double_buffered, uint32_t latency_ns, uint32_t *naks) {
+    setup_endpoints(double_buffered);
+    on_out_done = restart_out;
+    on_in_done = restart_in;
+    if (in)
+        usb_start_transfer(&ep2_in, sim_buf, SIM_TRANSFER);
+    else
+        usb_start_transfer(&ep1_out, sim_buf, SIM_TRANSFER);
+
+    uint64_t t = 0, isr_at = UINT64_MAX, bytes = 0;
+    while (t < SIM_TIME_NS) {
+        if (isr_at <= t) {
+            handle_buff_status();
+            isr_at = UINT64_MAX;
+            continue;
+        }
+        uint8_t pkt[64] = {0};
+        bool ok = in ? usb_emu_in(2, pkt) == 64 : usb_emu_out(1, pkt, 64);
+        if (ok) {
+            t += SIM_PACKET_NS;
+            bytes += 64;
+        } else {
+            t += SIM_NAK_NS;
+        }
+        if (usb_emu_buf_status && isr_at == UINT64_MAX)
+            isr_at = t + latency_ns;
+    }
+    *naks = usb_emu_stats.naks;
+    return (uint32_t) (bytes * 1000000 / t);
+}
+
+static void bench(bool in) {
+    static const uint32_t latencies_us[] = {2, 10, 25, 50, 100, 2000};
+    printf("\nBulk %s, 4k transfers:\n", in ? "IN" : "OUT");
+    printf("  ISR latency   single buffered         double buffered\n");
+    bool ok = true;
+    for (uint i = 0; i < count_of(latencies_us); ++i) {
+        uint32_t naks[2], speed[2];
+        for (uint db = 0; db < 2; ++db)
+            speed[db] = simulate(in, db, latencies_us[i] * 1000, &naks[db]);
+        printf("  %7u us %8u kB/s %6u NAKs %8u kB/s %6u NAKs%s\n", latencies_us[i], speed[0], naks[0], speed[1],
+               naks[1], latencies_us[i] == 2000 ? " (printf in the ISR)" : "");
+        ok &= speed[1] >= speed[0] && !usb_emu_stats.errors;
+    }
+    char name[64];
+    snprintf(name, sizeof(name), "bulk %s: double buffering is faster", in ? "IN" : "OUT");
+    result(name, ok);
+}
+
+int main() {
+    stdio_init_all();
+    printf("USB transfer test\n");
+
+    for (uint db = 0; db < 2; ++db) {
+        test_in(db);
+        test_out(db);
+        test_loopback(db);
+    }
+    bench(true);
+    bench(false);
+
+    printf(failures ? "FAILED\n" : "All good\n");
+    return failures ? 1 : 0;
+}
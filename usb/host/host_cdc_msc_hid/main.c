@@ -37,6 +37,7 @@ void led_blinking_task(void);
 
 extern void cdc_task(void);
 extern void hid_app_task(void);
+extern void msc_app_task(void);
 
 /*------------- MAIN -------------*/
 int main(void)
@@ -60,6 +61,10 @@ int main(void)
 #if CFG_TUH_HID
     hid_app_task();
 #endif
+
+#if CFG_TUH_MSC
+    msc_app_task();
+#endif
   }
 
   return 0;
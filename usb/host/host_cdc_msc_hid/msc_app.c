@@ -23,15 +23,84 @@
  *
  */
 
+#include <stdlib.h>
+
+#include "bsp/board.h"
 #include "tusb.h"
+#include "msc_io.h"
 
 #if CFG_TUH_MSC
 
+// Writing to the disk destroys what is there: only set this for a disk you
+// don't want, whose contents will be lost
+#ifndef MSC_APP_WRITE_TEST
+#define MSC_APP_WRITE_TEST 0
+#endif
+
 //--------------------------------------------------------------------+
 // MACRO TYPEDEF CONSTANT ENUM DECLARATION
 //--------------------------------------------------------------------+
 static scsi_inquiry_resp_t inquiry_resp;
 
+// Requests kept queued by the benchmark, and how much each part of it moves
+#define BENCH_DEPTH 4
+#define BENCH_BYTES (1024 * 1024)
+
+enum
+{
+  BENCH_IDLE,
+  BENCH_SEQ_READ,
+  BENCH_RANDOM_READ,
+  BENCH_LOG_WRITE,
+  BENCH_FLUSH,
+  BENCH_DONE,
+};
+
+static msc_io_t msc_io;
+static uint8_t msc_dev_addr;
+
+static struct
+{
+  uint8_t stage;
+  uint32_t requests;
+  uint32_t submitted;
+  uint32_t completed;
+  uint32_t failed;
+  uint32_t start_ms;
+  uint8_t buf[BENCH_DEPTH][MSC_IO_LINE_SIZE];
+} bench;
+
+//--------------------------------------------------------------------+
+// Block I/O through READ10 and WRITE10
+//--------------------------------------------------------------------+
+
+static bool msc_io_command_cb(uint8_t dev_addr, msc_cbw_t const* cbw, msc_csw_t const* csw)
+{
+  (void) dev_addr;
+  (void) cbw;
+  msc_io_complete(&msc_io, csw->status == 0);
+  return true;
+}
+
+static bool msc_io_read10(void *ctx, void *buf, uint32_t lba, uint16_t count)
+{
+  (void) ctx;
+  return tuh_msc_read10(msc_dev_addr, 0, buf, lba, count, msc_io_command_cb);
+}
+
+static bool msc_io_write10(void *ctx, void const *buf, uint32_t lba, uint16_t count)
+{
+  (void) ctx;
+  return tuh_msc_write10(msc_dev_addr, 0, buf, lba, count, msc_io_command_cb);
+}
+
+static msc_io_backend_t const msc_io_backend =
+{
+  .read  = msc_io_read10,
+  .write = msc_io_write10,
+  .ctx   = NULL
+};
+
 bool inquiry_complete_cb(uint8_t dev_addr, msc_cbw_t const* cbw, msc_csw_t const* csw)
 {
   if (csw->status != 0)
@@ -50,9 +119,121 @@ bool inquiry_complete_cb(uint8_t dev_addr, msc_cbw_t const* cbw, msc_csw_t const
   printf("Disk Size: %lu MB\r\n", block_count / ((1024*1024)/block_size));
   printf("Block Count = %lu, Block Size: %lu\r\n", block_count, block_size);
 
+  if (block_size != MSC_IO_BLOCK_SIZE || block_count < 2 * BENCH_BYTES / MSC_IO_BLOCK_SIZE)
+  {
+    printf("Not running the block I/O benchmark on this disk\r\n");
+    return true;
+  }
+
+  msc_dev_addr = dev_addr;
+  msc_io_init(&msc_io, &msc_io_backend, block_count);
+  bench.stage = BENCH_SEQ_READ;
   return true;
 }
 
+//--------------------------------------------------------------------+
+// Benchmark
+//--------------------------------------------------------------------+
+
+static void bench_request_done(void *arg, bool ok)
+{
+  (void) arg;
+  bench.completed++;
+  if (!ok) bench.failed++;
+}
+
+static void bench_start(uint32_t requests)
+{
+  bench.requests = requests;
+  bench.submitted = 0;
+  bench.completed = 0;
+  bench.failed = 0;
+  bench.start_ms = board_millis();
+}
+
+static bool bench_submit(void)
+{
+  uint32_t const n = bench.submitted;
+  uint8_t *buf = bench.buf[n % BENCH_DEPTH];
+  uint32_t const lines = msc_io.block_count / MSC_IO_LINE_BLOCKS;
+
+  switch (bench.stage)
+  {
+    case BENCH_SEQ_READ:
+      return msc_io_read(&msc_io, n * MSC_IO_LINE_BLOCKS, MSC_IO_LINE_BLOCKS, buf, bench_request_done, NULL);
+
+    case BENCH_RANDOM_READ:
+      return msc_io_read(&msc_io, (uint32_t) rand() % lines * MSC_IO_LINE_BLOCKS, MSC_IO_LINE_BLOCKS, buf,
+                         bench_request_done, NULL);
+
+    case BENCH_LOG_WRITE:
+      // A record of a block at a time, over the second MB of the disk
+      memset(buf, 0, MSC_IO_BLOCK_SIZE);
+      snprintf((char *) buf, MSC_IO_BLOCK_SIZE, "record %lu at %lu ms\n", n, board_millis());
+      return msc_io_write(&msc_io, BENCH_BYTES / MSC_IO_BLOCK_SIZE + n, 1, buf, bench_request_done, NULL);
+
+    default:
+      return msc_io_flush(&msc_io, bench_request_done, NULL);
+  }
+}
+
+static void bench_report(char const *name)
+{
+  uint32_t const ms = board_millis() - bench.start_ms;
+  uint32_t const bytes = bench.stage == BENCH_LOG_WRITE ? bench.requests * MSC_IO_BLOCK_SIZE
+                                                        : bench.requests * MSC_IO_LINE_SIZE;
+  uint32_t const kb_per_s = ms ? bytes / ms : 0;
+  printf("%-22s %lu.%03lu MB/s, %lu ms, %lu failed\r\n", name, kb_per_s / 1000, kb_per_s % 1000, ms, bench.failed);
+}
+
+void msc_app_task(void)
+{
+  if (bench.stage == BENCH_IDLE || bench.stage == BENCH_DONE) return;
+
+  if (!bench.requests)
+  {
+    bench_start(bench.stage == BENCH_LOG_WRITE ? BENCH_BYTES / MSC_IO_BLOCK_SIZE :
+                bench.stage == BENCH_FLUSH ? 1 : BENCH_BYTES / MSC_IO_LINE_SIZE);
+  }
+
+  while (bench.submitted < bench.requests && bench.submitted - bench.completed < BENCH_DEPTH && bench_submit())
+  {
+    bench.submitted++;
+  }
+  if (bench.completed < bench.requests) return;
+
+  switch (bench.stage)
+  {
+    case BENCH_SEQ_READ:
+      bench_report("Sequential read, 4k");
+      bench.stage = BENCH_RANDOM_READ;
+      break;
+
+    case BENCH_RANDOM_READ:
+      bench_report("Random read, 4k");
+      bench.stage = MSC_APP_WRITE_TEST ? BENCH_LOG_WRITE : BENCH_DONE;
+      break;
+
+    case BENCH_LOG_WRITE:
+      bench_report("Log write, 512");
+      bench.stage = BENCH_FLUSH;
+      break;
+
+    default:
+      printf("Flush %s\r\n", bench.failed ? "failed" : "ok");
+      bench.stage = BENCH_DONE;
+      break;
+  }
+  bench.requests = 0;
+
+  if (bench.stage == BENCH_DONE)
+  {
+    printf("%lu commands, %lu blocks read, %lu written, %lu from or to the cache, %lu lines read ahead, "
+           "%lu of them used\r\n", msc_io.stats.commands, msc_io.stats.blocks_read, msc_io.stats.blocks_written,
+           msc_io.stats.hits, msc_io.stats.lines_read_ahead, msc_io.stats.read_ahead_hits);
+  }
+}
+
 //------------- IMPLEMENTATION -------------//
 void tuh_msc_mount_cb(uint8_t dev_addr)
 {
@@ -84,6 +265,8 @@ void tuh_msc_umount_cb(uint8_t dev_addr)
 {
   (void) dev_addr;
   printf("A MassStorage device is unmounted\r\n");
+  bench.stage = BENCH_IDLE;
+  bench.requests = 0;
 
 //  uint8_t phy_disk = dev_addr-1;
 //
@@ -0,0 +1,591 @@
+/**
+ * Copyright (c) 2022 Raspberry Pi (Trading) Ltd.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+#include <string.h>
+
+#include "pico.h"
+#include "msc_io.h"
+
+enum
+{
+  OP_READ,
+  OP_WRITE,
+  OP_FLUSH,
+};
+
+// Commands to the device
+enum
+{
+  CMD_NONE,
+  CMD_FETCH,        // a line, for the request at the head of the queue
+  CMD_READ_AHEAD,   // a line, for requests which haven't come yet
+  CMD_WRITE_BACK,   // a run of dirty blocks of a line
+  CMD_READ_DIRECT,  // into the buffer of the request at the head of the queue
+  CMD_WRITE_DIRECT, // from it
+};
+
+// What became of the request at the head of the queue
+enum
+{
+  SERVE_DONE,
+  SERVE_STARTED, // a command for it
+  SERVE_WAIT,    // for the command in progress
+};
+
+#define NO_LBA UINT32_MAX
+
+// Most lines read into the cache in one command
+#define MAX_RUN_LINES (MSC_IO_LINES / 2)
+
+static inline uint32_t line_start(uint32_t lba)
+{
+  return lba & ~(uint32_t) (MSC_IO_LINE_BLOCKS - 1);
+}
+
+static inline uint8_t block_bit(uint32_t lba)
+{
+  return (uint8_t) (1u << (lba % MSC_IO_LINE_BLOCKS));
+}
+
+static inline uint8_t *line_data(msc_io_t *io, msc_io_line_t const *line)
+{
+  return io->data[line - io->lines];
+}
+
+// The blocks of the line at lba which are on the device: all of them, but
+// for the last line
+static uint8_t line_blocks(msc_io_t const *io, uint32_t lba)
+{
+  uint32_t n = io->block_count - lba;
+  return n >= MSC_IO_LINE_BLOCKS ? (uint8_t) ((1u << MSC_IO_LINE_BLOCKS) - 1) : (uint8_t) ((1u << n) - 1);
+}
+
+// The blocks of a line from lba to lba + count
+static uint8_t range_blocks(msc_io_line_t const *line, uint32_t lba, uint32_t count)
+{
+  uint8_t blocks = 0;
+  for (uint b = 0; b < MSC_IO_LINE_BLOCKS; b++)
+  {
+    if (line->lba + b >= lba && line->lba + b < lba + count) blocks |= (uint8_t) (1u << b);
+  }
+  return blocks;
+}
+
+static msc_io_line_t *find_line(msc_io_t *io, uint32_t lba)
+{
+  lba = line_start(lba);
+  for (int i = 0; i < MSC_IO_LINES; i++)
+  {
+    if (io->lines[i].lba == lba) return &io->lines[i];
+  }
+  return NULL;
+}
+
+static void forget_line(msc_io_line_t *line)
+{
+  line->lba = NO_LBA;
+  line->valid = 0;
+  line->dirty = 0;
+  line->ahead = false;
+}
+
+// Whether a line can be used for another without writing it back
+static inline bool line_reusable(msc_io_line_t const *line)
+{
+  return !line->busy && !line->dirty;
+}
+
+void msc_io_init(msc_io_t *io, msc_io_backend_t const *backend, uint32_t block_count)
+{
+  memset(io, 0, sizeof(*io));
+  io->backend = *backend;
+  io->block_count = block_count;
+  io->read_ahead_lines = MSC_IO_READ_AHEAD_LINES;
+  for (int i = 0; i < MSC_IO_LINES; i++) forget_line(&io->lines[i]);
+}
+
+//--------------------------------------------------------------------+
+// Commands
+//--------------------------------------------------------------------+
+
+static void finish(msc_io_t *io, bool ok);
+
+static void start(msc_io_t *io, uint8_t cmd, msc_io_line_t *line, uint lines, void *buf, uint32_t lba,
+                  uint16_t count)
+{
+  bool const write = cmd == CMD_WRITE_BACK || cmd == CMD_WRITE_DIRECT;
+  io->cmd = cmd;
+  io->cmd_line = line;
+  io->cmd_lines = (uint8_t) lines;
+  io->cmd_lba = lba;
+  io->cmd_count = count;
+  for (uint i = 0; i < lines; i++) line[i].busy = true;
+  io->stats.commands++;
+
+  bool sent = write ? io->backend.write(io->backend.ctx, buf, lba, count)
+                    : io->backend.read(io->backend.ctx, buf, lba, count);
+  if (!sent) finish(io, false);
+}
+
+// Write back the first run of dirty blocks in a line, carrying on into the
+// lines after it while they follow on
+static void write_back(msc_io_t *io, msc_io_line_t *line)
+{
+  uint const first = (uint) __builtin_ctz(line->dirty);
+  uint count = 0;
+  uint lines = 1;
+  msc_io_line_t const *last = line;
+  uint b = first;
+  while (1)
+  {
+    while (b < MSC_IO_LINE_BLOCKS && (last->dirty & (1u << b)))
+    {
+      b++;
+      count++;
+    }
+    msc_io_line_t const *next = last + 1;
+    if (b < MSC_IO_LINE_BLOCKS || next == io->lines + MSC_IO_LINES || next->busy ||
+        next->lba != last->lba + MSC_IO_LINE_BLOCKS || !(next->dirty & 1))
+    {
+      break;
+    }
+    last = next;
+    lines++;
+    b = 0;
+  }
+  start(io, CMD_WRITE_BACK, line, lines, line_data(io, line) + first * MSC_IO_BLOCK_SIZE, line->lba + first,
+        (uint16_t) count);
+}
+
+// The n lines next to each other which can be reused, and were used least
+// recently; NULL if there aren't any
+static msc_io_line_t *find_reusable(msc_io_t *io, uint n)
+{
+  msc_io_line_t *best = NULL;
+  uint32_t best_age = 0;
+  for (uint i = 0; i + n <= MSC_IO_LINES; i++)
+  {
+    uint32_t age = UINT32_MAX;
+    for (uint j = i; j < i + n && age; j++)
+    {
+      msc_io_line_t const *line = &io->lines[j];
+      if (!line_reusable(line))
+      {
+        age = 0;
+      }else if (line->lba != NO_LBA)
+      {
+        age = MIN(age, io->clock - line->last_used + 1);
+      }
+    }
+    if (age > best_age)
+    {
+      best = &io->lines[i];
+      best_age = age;
+    }
+  }
+  return best;
+}
+
+static void take_line(msc_io_t *io, msc_io_line_t *line, uint32_t lba)
+{
+  forget_line(line);
+  line->lba = line_start(lba);
+  line->last_used = ++io->clock;
+}
+
+// A line for the blocks at lba, written to a block at a time: the one after
+// the line before it if it can be, so they can be written back together, or
+// the one used least recently. NULL if there isn't one yet: if a dirty line
+// has to go, its write back is started.
+static msc_io_line_t *alloc_line(msc_io_t *io, uint32_t lba)
+{
+  msc_io_line_t *line = NULL;
+  msc_io_line_t *prev = line_start(lba) ? find_line(io, line_start(lba) - MSC_IO_LINE_BLOCKS) : NULL;
+  if (prev && prev + 1 < io->lines + MSC_IO_LINES && line_reusable(prev + 1))
+  {
+    line = prev + 1;
+  }else
+  {
+    line = find_reusable(io, 1);
+  }
+
+  if (!line)
+  {
+    if (io->cmd != CMD_NONE) return NULL;
+    msc_io_line_t *victim = NULL;
+    for (int i = 0; i < MSC_IO_LINES; i++)
+    {
+      msc_io_line_t *l = &io->lines[i];
+      if (!l->busy && (!victim || (int32_t) (l->last_used - victim->last_used) < 0)) victim = l;
+    }
+    if (victim) write_back(io, victim);
+    return NULL;
+  }
+  take_line(io, line, lba);
+  return line;
+}
+
+// Read up to n lines from the one at lba into the cache, stopping at one
+// that is cached already. Returns whether a command was started.
+static bool read_lines(msc_io_t *io, uint32_t lba, uint n, uint8_t cmd)
+{
+  lba = line_start(lba);
+  n = MIN(n, MAX_RUN_LINES);
+  for (uint i = 0; i < n; i++)
+  {
+    uint32_t const at = lba + i * MSC_IO_LINE_BLOCKS;
+    msc_io_line_t *line = at < io->block_count ? find_line(io, at) : NULL;
+    if (at >= io->block_count || (line && (!line_reusable(line) || (i && line->valid == line_blocks(io, at)))))
+    {
+      n = i;
+      break;
+    }
+    // Clean, and only partly read: read it all again
+    if (line) forget_line(line);
+  }
+
+  msc_io_line_t *run = NULL;
+  while (n && !(run = find_reusable(io, n))) n--;
+  if (!run) return false;
+
+  for (uint i = 0; i < n; i++)
+  {
+    take_line(io, &run[i], lba + i * MSC_IO_LINE_BLOCKS);
+    run[i].ahead = cmd == CMD_READ_AHEAD || i;
+  }
+  io->stats.lines_read_ahead += cmd == CMD_READ_AHEAD ? n : n - 1;
+  start(io, cmd, run, n, line_data(io, run), lba, (uint16_t) MIN(n * MSC_IO_LINE_BLOCKS, io->block_count - lba));
+  return true;
+}
+
+// Copy what the cache has of the blocks read straight from the device over
+// them: it is never older
+static void overlay_cache(msc_io_t *io, uint32_t lba, uint16_t count, uint8_t *buf)
+{
+  for (int i = 0; i < MSC_IO_LINES; i++)
+  {
+    msc_io_line_t const *line = &io->lines[i];
+    if (line->lba == NO_LBA || !line->valid) continue;
+    for (uint b = 0; b < MSC_IO_LINE_BLOCKS; b++)
+    {
+      uint32_t const block = line->lba + b;
+      if ((line->valid & (1u << b)) && block >= lba && block < lba + count)
+      {
+        memcpy(buf + (block - lba) * MSC_IO_BLOCK_SIZE, line_data(io, line) + b * MSC_IO_BLOCK_SIZE,
+               MSC_IO_BLOCK_SIZE);
+      }
+    }
+  }
+}
+
+static void finish(msc_io_t *io, bool ok)
+{
+  msc_io_request_t *r = &io->queue[io->tail % MSC_IO_QUEUE_SIZE];
+  uint8_t const cmd = io->cmd;
+  uint16_t const count = io->cmd_count;
+  io->cmd = CMD_NONE;
+  if (!ok) io->stats.errors++;
+
+  for (uint i = 0; i < io->cmd_lines; i++)
+  {
+    msc_io_line_t *line = &io->cmd_line[i];
+    uint8_t const blocks = range_blocks(line, io->cmd_lba, count);
+    line->busy = false;
+    if (cmd == CMD_WRITE_BACK)
+    {
+      // If it failed, there is nothing better to do with the data than drop
+      // it, and say so at the next flush
+      line->dirty &= (uint8_t) ~blocks;
+    }else if (ok)
+    {
+      line->valid = blocks;
+    }else
+    {
+      forget_line(line);
+    }
+  }
+  io->cmd_line = NULL;
+  io->cmd_lines = 0;
+
+  switch (cmd)
+  {
+    case CMD_FETCH:
+    case CMD_READ_AHEAD:
+      if (ok)
+      {
+        io->stats.blocks_read += count;
+      }else
+      {
+        if (cmd == CMD_FETCH) r->failed = true;
+        // Don't try again
+        io->sequential = false;
+      }
+      break;
+
+    case CMD_WRITE_BACK:
+      if (ok)
+      {
+        io->stats.blocks_written += count;
+      }else
+      {
+        io->write_back_failed = true;
+      }
+      break;
+
+    case CMD_READ_DIRECT:
+      if (ok)
+      {
+        overlay_cache(io, r->lba + r->done, count, r->buf + r->done * MSC_IO_BLOCK_SIZE);
+        r->done += count;
+        io->stats.blocks_read += count;
+      }else
+      {
+        r->failed = true;
+      }
+      break;
+
+    case CMD_WRITE_DIRECT:
+      if (ok)
+      {
+        r->done += count;
+        io->stats.blocks_written += count;
+      }else
+      {
+        r->failed = true;
+      }
+      break;
+
+    default:
+      break;
+  }
+}
+
+//--------------------------------------------------------------------+
+// Requests
+//--------------------------------------------------------------------+
+
+static int serve_read(msc_io_t *io, msc_io_request_t *r)
+{
+  while (r->done < r->count && !r->failed)
+  {
+    uint32_t const lba = r->lba + r->done;
+    msc_io_line_t *line = find_line(io, lba);
+    if (line && (line->valid & block_bit(lba)))
+    {
+      memcpy(r->buf + r->done * MSC_IO_BLOCK_SIZE,
+             line_data(io, line) + (lba % MSC_IO_LINE_BLOCKS) * MSC_IO_BLOCK_SIZE, MSC_IO_BLOCK_SIZE);
+      line->last_used = ++io->clock;
+      if (line->ahead)
+      {
+        line->ahead = false;
+        io->stats.read_ahead_hits++;
+      }
+      io->stats.hits++;
+      r->done++;
+      continue;
+    }
+
+    if (io->cmd != CMD_NONE) return SERVE_WAIT;
+
+    // Following on from the last read: read ahead too, through the cache.
+    // Otherwise a line or more goes straight into the request's buffer, and
+    // a little less into the cache.
+    uint16_t const left = (uint16_t) (r->count - r->done);
+    uint const lines = (lba % MSC_IO_LINE_BLOCKS + left + MSC_IO_LINE_BLOCKS - 1) / MSC_IO_LINE_BLOCKS;
+    uint const ahead = r->lba == io->next_read_lba ? io->read_ahead_lines : 0;
+    if (line && line->dirty)
+    {
+      // Written in part; write it back before reading the rest over it
+      write_back(io, line);
+    }else if (left >= MSC_IO_LINE_BLOCKS && (!ahead || lines >= MAX_RUN_LINES))
+    {
+      start(io, CMD_READ_DIRECT, NULL, 0, r->buf + r->done * MSC_IO_BLOCK_SIZE, lba, left);
+    }else if (!read_lines(io, lba, lines + ahead, CMD_FETCH))
+    {
+      // Every line is dirty
+      alloc_line(io, lba);
+    }
+    return SERVE_STARTED;
+  }
+
+  io->sequential = !r->failed && r->lba == io->next_read_lba;
+  io->next_read_lba = r->lba + r->count;
+  return SERVE_DONE;
+}
+
+static int serve_write(msc_io_t *io, msc_io_request_t *r)
+{
+  while (r->done < r->count && !r->failed)
+  {
+    uint32_t const lba = r->lba + r->done;
+    uint16_t const left = (uint16_t) (r->count - r->done);
+    uint16_t const whole = left & (uint16_t) ~(MSC_IO_LINE_BLOCKS - 1);
+
+    // Whole lines go straight from the request's buffer, unless there are
+    // few of them, following on from the last write, to go back with it
+    bool const append = r->lba == io->next_write_lba && whole < MSC_IO_WRITE_BACK_LINES * MSC_IO_LINE_BLOCKS;
+    if (lba % MSC_IO_LINE_BLOCKS == 0 && whole && !append)
+    {
+      // Any cached copies of them are out of date
+      if (io->cmd != CMD_NONE) return SERVE_WAIT;
+      for (int i = 0; i < MSC_IO_LINES; i++)
+      {
+        msc_io_line_t *line = &io->lines[i];
+        if (line->lba != NO_LBA && line->lba >= lba && line->lba < lba + whole) forget_line(line);
+      }
+      start(io, CMD_WRITE_DIRECT, NULL, 0, r->buf + r->done * MSC_IO_BLOCK_SIZE, lba, whole);
+      return SERVE_STARTED;
+    }
+
+    msc_io_line_t *line = find_line(io, lba);
+    if (line && line->busy) return SERVE_WAIT;
+    if (!line)
+    {
+      // With the device idle, no line is busy, so if there isn't one to have
+      // a write back has been started (and may already have failed)
+      bool const idle = io->cmd == CMD_NONE;
+      line = alloc_line(io, lba);
+      if (!line) return idle ? SERVE_STARTED : SERVE_WAIT;
+    }
+    memcpy(line_data(io, line) + (lba % MSC_IO_LINE_BLOCKS) * MSC_IO_BLOCK_SIZE,
+           r->buf + r->done * MSC_IO_BLOCK_SIZE, MSC_IO_BLOCK_SIZE);
+    line->valid |= block_bit(lba);
+    line->dirty |= block_bit(lba);
+    line->ahead = false;
+    line->last_used = ++io->clock;
+    io->stats.hits++;
+    r->done++;
+  }
+
+  io->next_write_lba = r->lba + r->count;
+  return SERVE_DONE;
+}
+
+static int serve_flush(msc_io_t *io, msc_io_request_t *r)
+{
+  if (io->cmd != CMD_NONE) return SERVE_WAIT;
+  for (int i = 0; i < MSC_IO_LINES; i++)
+  {
+    if (io->lines[i].dirty)
+    {
+      write_back(io, &io->lines[i]);
+      return SERVE_STARTED;
+    }
+  }
+  r->failed = io->write_back_failed;
+  io->write_back_failed = false;
+  return SERVE_DONE;
+}
+
+// With nothing queued and the device idle: write back full lines, or read
+// ahead of a sequential reader. Returns whether it started a command.
+static bool background(msc_io_t *io)
+{
+  for (int i = 0; i < MSC_IO_LINES; i++)
+  {
+    msc_io_line_t *line = &io->lines[i];
+    if (line->busy || line->dirty != line_blocks(io, line->lba) || !line->dirty) continue;
+
+    // A run of full lines, which waits while the writer is adding to it and
+    // it can get longer
+    uint n = 1;
+    while (i + n < MSC_IO_LINES && io->lines[i + n].lba == line->lba + n * MSC_IO_LINE_BLOCKS &&
+           !io->lines[i + n].busy && io->lines[i + n].dirty == line_blocks(io, io->lines[i + n].lba))
+    {
+      n++;
+    }
+    bool const growing = line->lba + n * MSC_IO_LINE_BLOCKS == line_start(io->next_write_lba);
+    if (n >= MSC_IO_WRITE_BACK_LINES || !growing || i + n == MSC_IO_LINES)
+    {
+      write_back(io, line);
+      return true;
+    }
+    i += (int) n - 1;
+  }
+
+  if (!io->sequential) return false;
+  uint32_t lba = line_start(io->next_read_lba);
+  for (uint i = 0; i < io->read_ahead_lines && lba < io->block_count; i++, lba += MSC_IO_LINE_BLOCKS)
+  {
+    msc_io_line_t const *line = find_line(io, lba);
+    if (!line) return read_lines(io, lba, io->read_ahead_lines - i, CMD_READ_AHEAD);
+    if (!line->dirty && !line->busy && line->valid != line_blocks(io, lba))
+    {
+      return read_lines(io, lba, io->read_ahead_lines - i, CMD_READ_AHEAD);
+    }
+  }
+  return false;
+}
+
+static void advance(msc_io_t *io)
+{
+  // Callbacks may queue more requests; they are picked up here
+  if (io->advancing) return;
+  io->advancing = true;
+
+  while (1)
+  {
+    if (io->tail != io->head)
+    {
+      msc_io_request_t *r = &io->queue[io->tail % MSC_IO_QUEUE_SIZE];
+      int state = r->op == OP_READ ? serve_read(io, r) : (r->op == OP_WRITE ? serve_write(io, r) : serve_flush(io, r));
+      if (state == SERVE_DONE)
+      {
+        msc_io_request_t const done = *r;
+        io->tail++;
+        if (done.cb) done.cb(done.arg, !done.failed);
+        continue;
+      }
+      // Carry on if the command failed to start
+      if (state == SERVE_STARTED && io->cmd == CMD_NONE) continue;
+      break;
+    }
+    if (io->cmd != CMD_NONE || !background(io)) break;
+  }
+
+  io->advancing = false;
+}
+
+static bool submit(msc_io_t *io, uint8_t op, uint32_t lba, uint16_t count, void *buf, msc_io_done_cb_t cb,
+                   void *arg)
+{
+  if (io->head - io->tail == MSC_IO_QUEUE_SIZE) return false;
+  if (op != OP_FLUSH && (!count || lba >= io->block_count || count > io->block_count - lba)) return false;
+
+  io->queue[io->head % MSC_IO_QUEUE_SIZE] = (msc_io_request_t) {
+    .op = op, .lba = lba, .count = count, .buf = buf, .cb = cb, .arg = arg
+  };
+  io->head++;
+  advance(io);
+  return true;
+}
+
+bool msc_io_read(msc_io_t *io, uint32_t lba, uint16_t count, void *buf, msc_io_done_cb_t cb, void *arg)
+{
+  return submit(io, OP_READ, lba, count, buf, cb, arg);
+}
+
+bool msc_io_write(msc_io_t *io, uint32_t lba, uint16_t count, void const *buf, msc_io_done_cb_t cb, void *arg)
+{
+  // Only read from
+  return submit(io, OP_WRITE, lba, count, (void *) buf, cb, arg);
+}
+
+bool msc_io_flush(msc_io_t *io, msc_io_done_cb_t cb, void *arg)
+{
+  return submit(io, OP_FLUSH, 0, 0, NULL, cb, arg);
+}
+
+bool msc_io_idle(msc_io_t const *io)
+{
+  return io->tail == io->head && io->cmd == CMD_NONE;
+}
+
+void msc_io_complete(msc_io_t *io, bool ok)
+{
+  finish(io, ok);
+  advance(io);
+}
@@ -0,0 +1,170 @@
+/**
+ * Copyright (c) 2022 Raspberry Pi (Trading) Ltd.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+#ifndef MSC_IO_H_
+#define MSC_IO_H_
+
+#include <stdbool.h>
+#include <stdint.h>
+
+//--------------------------------------------------------------------+
+// Queued block I/O on a mass storage device, independent of TinyUSB.
+//
+// The application queues up to MSC_IO_QUEUE_SIZE reads and writes, each
+// with a callback, and carries on. They are done in order. A bulk-only mass
+// storage device takes one command at a time, and each costs a few ms on top
+// of its data, so they are not sent to it one for one: instead they go
+// through a cache of MSC_IO_LINES lines of 4k, and commands are made as big
+// as they can be:
+//
+// - a write of less than a line, or of a few whole lines following on from
+//   the last write, goes into the cache, and completes at once. Full lines
+//   are written back in the background, MSC_IO_WRITE_BACK_LINES at a time
+//   while the writer is still adding to them (so a stream of log records
+//   goes to the device 16k at a time). Anything else is written back when
+//   it has to make way, or on msc_io_flush();
+// - a read is answered from the cache where it can be. A read which misses
+//   and follows on from the last read reads its lines and
+//   MSC_IO_READ_AHEAD_LINES more into the cache, and while the device is
+//   idle, the lines after a sequential reader are read ahead. Any other read
+//   of a line or more goes straight into the caller's buffer, and a smaller
+//   one reads in its line;
+// - other writes of whole lines go straight from the caller's buffer, which
+//   must stay untouched until the write completes.
+//
+// The cache is never older than the device, so what is read always includes
+// what was written before it, even if it hasn't been written back yet.
+//
+// The device is driven through a backend: msc_app.c's sends READ10 and
+// WRITE10 commands with TinyUSB, and msc_io_mock.c has a simulated device
+// for the tests. Call msc_io_complete() when a command finishes.
+//--------------------------------------------------------------------+
+
+#define MSC_IO_BLOCK_SIZE   512
+#define MSC_IO_LINE_BLOCKS  8
+#define MSC_IO_LINE_SIZE    (MSC_IO_BLOCK_SIZE * MSC_IO_LINE_BLOCKS)
+
+#ifndef MSC_IO_LINES
+#define MSC_IO_LINES 8
+#endif
+
+// Must be a power of 2
+#ifndef MSC_IO_QUEUE_SIZE
+#define MSC_IO_QUEUE_SIZE 8
+#endif
+
+// At most MSC_IO_LINES / 2
+#ifndef MSC_IO_READ_AHEAD_LINES
+#define MSC_IO_READ_AHEAD_LINES 4
+#endif
+
+#ifndef MSC_IO_WRITE_BACK_LINES
+#define MSC_IO_WRITE_BACK_LINES 4
+#endif
+
+typedef void (*msc_io_done_cb_t)(void *arg, bool ok);
+
+typedef struct
+{
+  // Start a command on the device; false if it can't be sent
+  bool (*read)(void *ctx, void *buf, uint32_t lba, uint16_t count);
+  bool (*write)(void *ctx, void const *buf, uint32_t lba, uint16_t count);
+  void *ctx;
+} msc_io_backend_t;
+
+typedef struct
+{
+  uint8_t op;
+  bool failed;
+  uint32_t lba;
+  uint16_t count;
+  // Blocks done so far
+  uint16_t done;
+  uint8_t *buf;
+  msc_io_done_cb_t cb;
+  void *arg;
+} msc_io_request_t;
+
+typedef struct
+{
+  // First block, or UINT32_MAX if the line is free
+  uint32_t lba;
+  // A bit per block
+  uint8_t valid;
+  uint8_t dirty;
+  // A command is reading into or writing from it
+  bool busy;
+  // Read ahead, and not used yet
+  bool ahead;
+  uint32_t last_used;
+} msc_io_line_t;
+
+typedef struct
+{
+  uint32_t commands;
+  uint32_t blocks_read;
+  uint32_t blocks_written;
+  // Blocks of requests answered from or written to the cache
+  uint32_t hits;
+  uint32_t lines_read_ahead;
+  uint32_t read_ahead_hits;
+  uint32_t errors;
+} msc_io_stats_t;
+
+typedef struct
+{
+  msc_io_backend_t backend;
+  uint32_t block_count;
+  uint8_t read_ahead_lines;
+
+  msc_io_request_t queue[MSC_IO_QUEUE_SIZE];
+  uint32_t head;
+  uint32_t tail;
+
+  msc_io_line_t lines[MSC_IO_LINES];
+  // Each line's data, in order, so a command can cover lines next to each
+  // other
+  uint8_t data[MSC_IO_LINES][MSC_IO_LINE_SIZE];
+  uint32_t clock;
+
+  // The command in progress, if any, and the lines it is for
+  uint8_t cmd;
+  msc_io_line_t *cmd_line;
+  uint8_t cmd_lines;
+  uint32_t cmd_lba;
+  uint16_t cmd_count;
+
+  // Where the next read and write go, if they follow on from the last
+  uint32_t next_read_lba;
+  uint32_t next_write_lba;
+  // Reads are sequential, so worth reading ahead of
+  bool sequential;
+  // A write back failed since the last flush
+  bool write_back_failed;
+  bool advancing;
+
+  msc_io_stats_t stats;
+} msc_io_t;
+
+void msc_io_init(msc_io_t *io, msc_io_backend_t const *backend, uint32_t block_count);
+
+// Queue a read or write of count blocks from lba; false if the queue is full,
+// or count is 0, or the blocks are off the end of the device. cb is called
+// when it is done, maybe before this returns.
+bool msc_io_read(msc_io_t *io, uint32_t lba, uint16_t count, void *buf, msc_io_done_cb_t cb, void *arg);
+bool msc_io_write(msc_io_t *io, uint32_t lba, uint16_t count, void const *buf, msc_io_done_cb_t cb, void *arg);
+
+// Queue a write back of everything in the cache; its callback says whether
+// every write back since the last flush worked
+bool msc_io_flush(msc_io_t *io, msc_io_done_cb_t cb, void *arg);
+
+// Whether there is nothing queued, and the device is idle
+bool msc_io_idle(msc_io_t const *io);
+
+// The backend's command has finished
+void msc_io_complete(msc_io_t *io, bool ok);
+
+#endif /* MSC_IO_H_ */
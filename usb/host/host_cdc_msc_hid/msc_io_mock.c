@@ -0,0 +1,70 @@
+/**
+ * Copyright (c) 2022 Raspberry Pi (Trading) Ltd.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+#include <string.h>
+
+#include "msc_io_mock.h"
+
+static bool start(msc_io_mock_t *m, bool write, void *buf, uint32_t lba, uint16_t count)
+{
+  if (m->refuse || m->busy || lba + count > m->block_count) return false;
+  m->busy = true;
+  m->write = write;
+  m->buf = buf;
+  m->lba = lba;
+  m->count = count;
+  m->done_us = m->now_us + m->command_us + (uint64_t) count * MSC_IO_BLOCK_SIZE * m->ns_per_byte / 1000 +
+               (write ? m->write_us : 0);
+  return true;
+}
+
+static bool mock_read(void *ctx, void *buf, uint32_t lba, uint16_t count)
+{
+  return start(ctx, false, buf, lba, count);
+}
+
+static bool mock_write(void *ctx, void const *buf, uint32_t lba, uint16_t count)
+{
+  return start(ctx, true, (void *) buf, lba, count);
+}
+
+void msc_io_mock_init(msc_io_mock_t *m, msc_io_t *io, uint8_t *disk, uint32_t block_count)
+{
+  memset(m, 0, sizeof(*m));
+  m->io = io;
+  m->disk = disk;
+  m->block_count = block_count;
+  // 19 packets of 64 bytes in a 1ms frame, and a frame each for the CBW and
+  // the CSW; writes wait 1ms more for the flash
+  m->command_us = 2000;
+  m->ns_per_byte = 1000000 / (19 * 64);
+  m->write_us = 1000;
+
+  msc_io_backend_t const backend = { .read = mock_read, .write = mock_write, .ctx = m };
+  msc_io_init(io, &backend, block_count);
+}
+
+bool msc_io_mock_run(msc_io_mock_t *m)
+{
+  if (!m->busy) return false;
+  m->now_us = m->done_us;
+  m->busy = false;
+
+  bool const ok = ++m->commands != m->fail_command;
+  if (ok)
+  {
+    uint8_t *disk = m->disk + m->lba * MSC_IO_BLOCK_SIZE;
+    if (m->write)
+    {
+      memcpy(disk, m->buf, m->count * MSC_IO_BLOCK_SIZE);
+    }else
+    {
+      memcpy(m->buf, disk, m->count * MSC_IO_BLOCK_SIZE);
+    }
+  }
+  msc_io_complete(m->io, ok);
+  return true;
+}
@@ -0,0 +1,55 @@
+/**
+ * Copyright (c) 2022 Raspberry Pi (Trading) Ltd.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+#ifndef MSC_IO_MOCK_H_
+#define MSC_IO_MOCK_H_
+
+#include "msc_io.h"
+
+//--------------------------------------------------------------------+
+// A simulated mass storage device for msc_io.c, for tests on the host: a
+// disk in RAM, which takes one command at a time, each taking as long as it
+// would over full speed USB. Time is simulated, and moves on only in
+// msc_io_mock_run().
+//--------------------------------------------------------------------+
+
+typedef struct
+{
+  uint8_t *disk;
+  uint32_t block_count;
+
+  // Per command (the CBW, the CSW, and the device getting going), and per
+  // byte of data; writes take write_us more per command, for the flash
+  uint32_t command_us;
+  uint32_t ns_per_byte;
+  uint32_t write_us;
+  // Fail the command with this number (counting from 1), if not 0
+  uint32_t fail_command;
+  // Refuse to start any command while set, as if the device had gone
+  bool refuse;
+
+  msc_io_t *io;
+  uint64_t now_us;
+  uint32_t commands;
+
+  // The command in progress
+  bool busy;
+  bool write;
+  uint8_t *buf;
+  uint32_t lba;
+  uint16_t count;
+  uint64_t done_us;
+} msc_io_mock_t;
+
+// A device with the timing of a typical USB stick at full speed, and io set
+// up to use it
+void msc_io_mock_init(msc_io_mock_t *m, msc_io_t *io, uint8_t *disk, uint32_t block_count);
+
+// Move time on to the end of the command in progress, and complete it;
+// false if there isn't one
+bool msc_io_mock_run(msc_io_mock_t *m);
+
+#endif /* MSC_IO_MOCK_H_ */
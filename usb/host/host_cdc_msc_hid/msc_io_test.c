@@ -0,0 +1,423 @@
+/**
+ * Copyright (c) 2022 Raspberry Pi (Trading) Ltd.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "pico/stdlib.h"
+#include "msc_io_mock.h"
+#include "test_rand.h"
+
+// Runs msc_io.c against the simulated device in msc_io_mock.c: checks that
+// random reads and writes, queued several at a time, see and leave the same
+// data as they would done one by one on the device, and that errors are
+// passed on. Then measures sequential and random access, in simulated time,
+// against sending one command per request and waiting for it. The mock
+// keeps its own clock, so the rates don't depend on the machine running it.
+
+static int failures;
+
+static void result(const char *name, bool ok)
+{
+  printf("%-40s %s\n", name, ok ? "ok" : "FAILED");
+  if (!ok) ++failures;
+}
+
+static msc_io_t io;
+static msc_io_mock_t mock;
+
+static void run_until_idle(void)
+{
+  while (msc_io_mock_run(&mock)) {}
+}
+
+//--------------------------------------------------------------------+
+// Random reads and writes, checked against a copy of the disk which they
+// are applied to in order
+//--------------------------------------------------------------------+
+
+#define TEST_BLOCKS     2048
+#define TEST_SPAN       160
+#define TEST_MAX_COUNT  20
+
+typedef struct
+{
+  bool used;
+  bool write;
+  bool done;
+  bool ok;
+  uint8_t buf[TEST_MAX_COUNT * MSC_IO_BLOCK_SIZE];
+  uint8_t expected[TEST_MAX_COUNT * MSC_IO_BLOCK_SIZE];
+  uint16_t count;
+} slot_t;
+
+static uint8_t disk[TEST_BLOCKS * MSC_IO_BLOCK_SIZE];
+static uint8_t ref[TEST_BLOCKS * MSC_IO_BLOCK_SIZE];
+static slot_t slots[MSC_IO_QUEUE_SIZE];
+
+static void slot_done(void *arg, bool ok)
+{
+  slot_t *s = arg;
+  s->done = true;
+  s->ok = ok;
+}
+
+static bool flush_ok, flush_done;
+
+static void flush_cb(void *arg, bool ok)
+{
+  (void) arg;
+  flush_done = true;
+  flush_ok = ok;
+}
+
+// Over span blocks from block 512, or at the end of a disk of an odd size
+static void test_consistency(uint depth, uint span, bool at_end)
+{
+  uint32_t const blocks = at_end ? TEST_BLOCKS - 3 : TEST_BLOCKS;
+  uint32_t const base = at_end ? blocks - span : 512;
+  for (uint i = 0; i < sizeof(disk); i++) disk[i] = (uint8_t) next_rand();
+  memcpy(ref, disk, sizeof(ref));
+  msc_io_mock_init(&mock, &io, disk, blocks);
+  memset(slots, 0, sizeof(slots));
+
+  bool ok = true;
+  uint outstanding = 0;
+  uint32_t next_lba = 0;
+  for (uint step = 0; step < 20000; step++)
+  {
+    for (uint i = 0; i < depth; i++)
+    {
+      slot_t *s = &slots[i];
+      if (!s->used || !s->done) continue;
+      ok &= s->ok && (s->write || !memcmp(s->buf, s->expected, s->count * MSC_IO_BLOCK_SIZE));
+      s->used = false;
+      outstanding--;
+    }
+
+    if (outstanding < depth && next_rand() % 3)
+    {
+      slot_t *s = &slots[0];
+      while (s->used) s++;
+      // Near the start of the disk, so requests overlap; half of them
+      // following on from the last, and some runs of whole lines
+      uint32_t lba = base + next_rand() % span;
+      if (next_rand() % 2 && next_lba + TEST_MAX_COUNT <= base + span) lba = next_lba;
+      s->count = (uint16_t) (1 + next_rand() % TEST_MAX_COUNT);
+      if (next_rand() % 4 == 0)
+      {
+        lba &= ~(uint32_t) (MSC_IO_LINE_BLOCKS - 1);
+        s->count = MSC_IO_LINE_BLOCKS * (1 + next_rand() % 2);
+      }
+      if (lba + s->count > base + span) s->count = (uint16_t) (base + span - lba);
+      next_lba = lba + s->count;
+      s->write = next_rand() % 2;
+      s->used = true;
+      s->done = false;
+      size_t const bytes = s->count * MSC_IO_BLOCK_SIZE;
+      uint8_t *at = ref + lba * MSC_IO_BLOCK_SIZE;
+      if (s->write)
+      {
+        for (size_t i = 0; i < bytes; i++) s->buf[i] = (uint8_t) next_rand();
+        memcpy(at, s->buf, bytes);
+        ok &= msc_io_write(&io, lba, s->count, s->buf, slot_done, s);
+      }else
+      {
+        memset(s->buf, 0, bytes);
+        memcpy(s->expected, at, bytes);
+        ok &= msc_io_read(&io, lba, s->count, s->buf, slot_done, s);
+      }
+      outstanding++;
+    }else if (!msc_io_mock_run(&mock) && outstanding)
+    {
+      // Nothing for the device to do, and still requests waiting
+      bool waiting = false;
+      for (uint i = 0; i < depth; i++) waiting |= slots[i].used && !slots[i].done;
+      ok &= !waiting;
+    }
+
+    if (step % 5000 == 4999)
+    {
+      flush_done = false;
+      ok &= msc_io_flush(&io, flush_cb, NULL);
+    }
+  }
+
+  flush_done = false;
+  while (!msc_io_flush(&io, flush_cb, NULL)) msc_io_mock_run(&mock);
+  run_until_idle();
+  ok &= flush_done && flush_ok && msc_io_idle(&io) && !memcmp(disk, ref, sizeof(disk));
+
+  char name[64];
+  snprintf(name, sizeof(name), "consistent, %u deep, %u block span%s", depth, span, at_end ? ", end" : "");
+  result(name, ok);
+}
+
+//--------------------------------------------------------------------+
+// Errors, read ahead, and requests which can't be queued
+//--------------------------------------------------------------------+
+
+static bool req_done, req_ok;
+
+static void req_cb(void *arg, bool ok)
+{
+  (void) arg;
+  req_done = true;
+  req_ok = ok;
+}
+
+static void flag_cb(void *arg, bool ok)
+{
+  (void) ok;
+  *(bool *) arg = true;
+}
+
+static bool do_read(uint32_t lba, uint16_t count, uint8_t *buf)
+{
+  req_done = false;
+  if (!msc_io_read(&io, lba, count, buf, req_cb, NULL)) return false;
+  while (!req_done && msc_io_mock_run(&mock)) {}
+  return req_done && req_ok;
+}
+
+static void test_errors(void)
+{
+  static uint8_t buf[16 * MSC_IO_BLOCK_SIZE];
+  msc_io_mock_init(&mock, &io, disk, TEST_BLOCKS);
+
+  // A read straight into the buffer, and one through the cache
+  mock.fail_command = 1;
+  bool ok = !do_read(0, 16, buf);
+  mock.fail_command = 2;
+  ok &= !do_read(100, 1, buf);
+  ok &= do_read(100, 1, buf) && !memcmp(buf, disk + 100 * MSC_IO_BLOCK_SIZE, MSC_IO_BLOCK_SIZE);
+
+  // A write back: the write went into the cache, so it is the flush which
+  // fails, and the next one is fine
+  req_done = false;
+  ok &= msc_io_write(&io, 200, 1, buf, req_cb, NULL) && req_done && req_ok;
+  mock.fail_command = mock.commands + 1;
+  flush_done = false;
+  msc_io_flush(&io, flush_cb, NULL);
+  run_until_idle();
+  ok &= flush_done && !flush_ok;
+  flush_done = false;
+  msc_io_flush(&io, flush_cb, NULL);
+  run_until_idle();
+  ok &= flush_done && flush_ok && io.stats.errors == 3;
+  result("errors are passed on", ok);
+}
+
+// A write which needs a line when they are all dirty, with the device
+// refusing the write back to make room: it still completes, and the flush
+// reports the lost blocks
+static void test_refused(void)
+{
+  static uint8_t buf[MSC_IO_BLOCK_SIZE];
+  static bool done[MSC_IO_LINES + 1];
+  msc_io_mock_init(&mock, &io, disk, TEST_BLOCKS);
+  mock.refuse = true;
+
+  bool ok = true;
+  for (uint i = 0; i <= MSC_IO_LINES; i++)
+  {
+    done[i] = false;
+    ok &= msc_io_write(&io, i * MSC_IO_LINE_BLOCKS + 1, 1, buf, flag_cb, &done[i]);
+  }
+  run_until_idle();
+  for (uint i = 0; i <= MSC_IO_LINES; i++) ok &= done[i];
+  ok &= msc_io_idle(&io);
+
+  flush_done = false;
+  msc_io_flush(&io, flush_cb, NULL);
+  run_until_idle();
+  ok &= flush_done && !flush_ok && msc_io_idle(&io);
+  result("refused commands complete", ok);
+}
+
+static void test_read_ahead(void)
+{
+  static uint8_t buf[MSC_IO_LINE_SIZE];
+  msc_io_mock_init(&mock, &io, disk, TEST_BLOCKS);
+
+  // Sequential reads of a line, one at a time: each after the first is
+  // read ahead while the last is being dealt with
+  bool ok = true;
+  for (uint32_t lba = 0; lba < 64 * MSC_IO_LINE_BLOCKS; lba += MSC_IO_LINE_BLOCKS)
+  {
+    ok &= do_read(lba, MSC_IO_LINE_BLOCKS, buf) && !memcmp(buf, disk + lba * MSC_IO_BLOCK_SIZE, sizeof(buf));
+    // The device has the next line to read while the application thinks
+    msc_io_mock_run(&mock);
+  }
+  ok &= io.stats.read_ahead_hits >= 62;
+  run_until_idle();
+
+  // A block at a time: a command per line
+  uint32_t commands = io.stats.commands;
+  for (uint32_t lba = 1024; lba < 1024 + 64; lba++)
+  {
+    ok &= do_read(lba, 1, buf) && !memcmp(buf, disk + lba * MSC_IO_BLOCK_SIZE, MSC_IO_BLOCK_SIZE);
+  }
+  run_until_idle();
+  ok &= io.stats.commands - commands <= 64 / MSC_IO_LINE_BLOCKS + MSC_IO_READ_AHEAD_LINES;
+  result("sequential reads are read ahead", ok);
+}
+
+static void test_rejects(void)
+{
+  static uint8_t buf[MSC_IO_BLOCK_SIZE];
+  msc_io_mock_init(&mock, &io, disk, TEST_BLOCKS);
+  bool ok = !msc_io_read(&io, TEST_BLOCKS - 1, 2, buf, NULL, NULL) && !msc_io_read(&io, 0, 0, buf, NULL, NULL);
+  uint queued = 0;
+  while (msc_io_read(&io, queued * MSC_IO_LINE_BLOCKS, 1, buf, NULL, NULL)) queued++;
+  ok &= queued == MSC_IO_QUEUE_SIZE;
+  run_until_idle();
+  ok &= msc_io_idle(&io);
+  result("full queue and bad requests refused", ok);
+}
+
+//--------------------------------------------------------------------+
+// Throughput. The application spends 50us on each block it reads or writes,
+// and keeps up to depth requests queued, with read ahead off and then on.
+// Before, each request was a command of its own, and the application waited
+// for it, then spent its time on the data. Queued, the application gets on
+// with the last request's data while the next one's command runs: that is
+// all random 4k requests gain (0.710 to 0.763 MB/s reading), as there is
+// nothing to merge or read ahead.
+//--------------------------------------------------------------------+
+
+#define BENCH_BLOCKS    16384
+#define BENCH_BYTES     (1024 * 1024)
+#define BENCH_THINK_US  50
+#define BENCH_MAX_DEPTH 4
+
+static uint32_t bench_completed;
+
+static void bench_cb(void *arg, bool ok)
+{
+  (void) arg;
+  (void) ok;
+  bench_completed++;
+}
+
+static uint32_t bench_lba(uint32_t i, uint16_t count, bool random)
+{
+  return random ? next_rand() % (BENCH_BLOCKS / count) * count : i * count;
+}
+
+// MB/s done one command at a time
+static float bench_before(bool write, uint16_t count)
+{
+  uint64_t const per_request_us = mock.command_us + (write ? mock.write_us : 0) +
+                                  (uint64_t) count * MSC_IO_BLOCK_SIZE * mock.ns_per_byte / 1000 +
+                                  count * BENCH_THINK_US;
+  return (float) count * MSC_IO_BLOCK_SIZE / (float) per_request_us;
+}
+
+static float bench_after(bool write, uint16_t count, bool random, uint depth, uint8_t read_ahead)
+{
+  static uint8_t bench_disk[BENCH_BLOCKS * MSC_IO_BLOCK_SIZE];
+  static uint8_t bufs[BENCH_MAX_DEPTH][MSC_IO_LINE_SIZE];
+  msc_io_mock_init(&mock, &io, bench_disk, BENCH_BLOCKS);
+  io.read_ahead_lines = read_ahead;
+
+  uint32_t const n = BENCH_BYTES / (count * MSC_IO_BLOCK_SIZE);
+  uint32_t submitted = 0;
+  uint64_t app_ready_us = 0;
+  bench_completed = 0;
+  while (bench_completed < n)
+  {
+    bool const can_submit = submitted < n && submitted - bench_completed < depth;
+    if (can_submit && app_ready_us <= mock.now_us)
+    {
+      uint8_t *buf = bufs[submitted % depth];
+      uint32_t const lba = bench_lba(submitted, count, random);
+      if (write)
+      {
+        msc_io_write(&io, lba, count, buf, bench_cb, NULL);
+      }else
+      {
+        msc_io_read(&io, lba, count, buf, bench_cb, NULL);
+      }
+      submitted++;
+      app_ready_us = mock.now_us + count * BENCH_THINK_US;
+    }else if (mock.busy && (!can_submit || mock.done_us <= app_ready_us))
+    {
+      msc_io_mock_run(&mock);
+    }else if (can_submit)
+    {
+      mock.now_us = app_ready_us;
+    }else
+    {
+      break;
+    }
+  }
+  flush_done = false;
+  msc_io_flush(&io, flush_cb, NULL);
+  run_until_idle();
+  if (bench_completed != n || !flush_done) return 0;
+  return (float) BENCH_BYTES / (float) mock.now_us;
+}
+
+static void bench(void)
+{
+  printf("\nThroughput, MB/s:\n");
+  printf("  %-28s %8s %10s %14s %14s\n", "", "before", "1 deep", "1 deep, ahead", "4 deep, ahead");
+
+  static const struct
+  {
+    char const *name;
+    bool write;
+    uint16_t count;
+    bool random;
+  } workloads[] = {
+    { "sequential read, 4k",    false, 8, false },
+    { "sequential read, 512",   false, 1, false },
+    { "random read, 4k",        false, 8, true  },
+    { "sequential write, 4k",   true,  8, false },
+    { "sequential write, 512",  true,  1, false },
+    { "random write, 4k",       true,  8, true  },
+  };
+
+  bool ok = true;
+  for (uint i = 0; i < count_of(workloads); i++)
+  {
+    bool const write = workloads[i].write;
+    uint16_t const count = workloads[i].count;
+    bool const random = workloads[i].random;
+    float const before = bench_before(write, count);
+    float const one = bench_after(write, count, random, 1, 0);
+    float const ahead = bench_after(write, count, random, 1, MSC_IO_READ_AHEAD_LINES);
+    float const deep = bench_after(write, count, random, 4, MSC_IO_READ_AHEAD_LINES);
+    printf("  %-28s %8.3f %10.3f %14.3f %14.3f\n", workloads[i].name, before, one, ahead, deep);
+
+    // Never slower; and sequential access, or small requests, faster
+    ok &= one > 0 && ahead > 0 && deep >= before * 0.98f;
+    if (!random || count < MSC_IO_LINE_BLOCKS) ok &= deep > before * 1.2f;
+  }
+  result("queued I/O is faster", ok);
+}
+
+int main(void)
+{
+  stdio_init_all();
+  printf("MSC block I/O test\n");
+
+  test_consistency(1, TEST_SPAN, false);
+  test_consistency(4, TEST_SPAN, false);
+  // Less one for the flushes
+  test_consistency(MSC_IO_QUEUE_SIZE - 1, 4 * MSC_IO_LINES * MSC_IO_LINE_BLOCKS, false);
+  test_consistency(4, TEST_SPAN, true);
+  test_errors();
+  test_read_ahead();
+  test_refused();
+  test_rejects();
+  bench();
+
+  printf(failures ? "FAILED\n" : "All good\n");
+  return failures ? 1 : 0;
+}